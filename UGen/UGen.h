@@ -92,6 +92,7 @@ BEGIN_UGEN_NAMESPACE
 #include "core/ugen_Bits.h"
 #include "core/ugen_Value.h"
 #include "core/ugen_Arrays.h"
+#include "core/ugen_ThreadPool.h"
 #include "basics/ugen_ScalarUGens.h"
 #include "basics/ugen_UnaryOpUGens.h"
 #include "basics/ugen_BinaryOpUGens.h"
@@ -109,20 +110,28 @@ BEGIN_UGEN_NAMESPACE
 #include "envelopes/ugen_Env.h"
 #include "envelopes/ugen_EnvGen.h"
 #include "buffers/ugen_Buffer.h"
+#include "buffers/ugen_BufferDispatcher.h"
+#include "buffers/ugen_SamplePool.h"
 #include "buffers/ugen_PlayBuf.h"
+#include "buffers/ugen_CompressedBuffer.h"
 #include "oscillators/wavetable/ugen_TableOsc.h"
+#include "oscillators/wavetable/ugen_WavetableOsc.h"
 #include "oscillators/simple/ugen_LFSaw.h"
 #include "oscillators/simple/ugen_LFPulse.h"
 #include "oscillators/simple/ugen_Impulse.h"
 #include "oscillators/simple/ugen_FSinOsc.h"
+#include "oscillators/simple/ugen_OscBank.h"
 #include "oscillators/simple/ugen_Triggers.h"
 #include "filters/control/ugen_Lag.h"
 #include "filters/control/ugen_Decay.h"
 #include "filters/ugen_SOS.h"
 #include "filters/ugen_LeakDC.h"
+#include "filters/ugen_FilterCoeffTable.h"
 #include "filters/simple/ugen_LPF.h"
 #include "filters/simple/ugen_HPF.h"
 #include "filters/ugen_BEQ.h"
+#include "filters/ugen_BiquadBank.h"
+#include "filters/ugen_ParametricEQ.h"
 #include "spawn/ugen_Spawn.h"
 #include "spawn/ugen_TSpawn.h"
 #include "spawn/ugen_VoicerBase.h"
@@ -140,17 +149,22 @@ BEGIN_UGEN_NAMESPACE
 #include "noise/ugen_Dust.h"
 #include "noise/ugen_LFNoise.h"
 #include "delays/ugen_Delay.h"
+#include "delays/ugen_FDN.h"
 #include "pan/ugen_BasicPan.h"
 #include "fft/ugen_FFTEngine.h"
+#include "fft/ugen_STFT.h"
 
 #ifdef UGEN_HRTF
 #include "convolution/ugen_HRTF.h"
+#include "convolution/ugen_BinauralPan.h"
 #endif
 
 #ifndef UGEN_ANDROID
 // just not yet.. 
 	#include "core/ugen_TextFile.h" // std lib
 	#include "core/ugen_Collections.h"
+	#include "core/ugen_AtomicSpinLock.h"
+	#include "core/ugen_LockFreeFifo.h"
 	#include "oscillators/ugen_OscillatorUGens.h"
 	#include "envelopes/ugen_ASR.h"
 	#include "filters/dynamics/ugen_Normaliser.h"
@@ -35,6 +35,18 @@
  ==============================================================================
  */
 
+#if !defined(UGEN_JUCE)
+	#if defined(WIN32)
+		#ifndef NOMINMAX
+			#define NOMINMAX
+		#endif
+		#include <windows.h>
+	#else
+		#include <pthread.h>
+		#include <unistd.h>
+	#endif
+#endif
+
 #include "../core/ugen_StandardHeader.h"
 
 BEGIN_UGEN_NAMESPACE
@@ -59,6 +71,15 @@ void DataRecorderUGenInternal::processBlock(bool& shouldDelete, const unsigned i
 {
 	int numSamplesToProcess = uGenOutput.getBlockSize();
 	const float *trigSamples = inputs[Trig].processBlock(shouldDelete, blockID, 0);
+	const int numInputChannels = inputs[Input].getNumChannels();
+	
+	// copy the inputs to the outputs first so the input is only processed once per block
+	for(int channel = 0; channel < numInputChannels; channel++)
+	{
+		float *inputValues = inputs[Input].processBlock(shouldDelete, blockID, channel);
+		float *outputValues = proxies[channel]->getSampleData();
+		memcpy(outputValues, inputValues, numSamplesToProcess * sizeof(float));
+	}
 	
 	for(int i = 0; i < numSamplesToProcess; i++)
 	{
@@ -72,9 +93,9 @@ void DataRecorderUGenInternal::processBlock(bool& shouldDelete, const unsigned i
 				fileWriter.write(" ");
 			}
 				
-			for(int channel = 0; channel < inputs[Input].getNumChannels(); channel++)
+			for(int channel = 0; channel < numInputChannels; channel++)
 			{
-				float *values = inputs[Input].processBlock(shouldDelete, blockID, channel);
+				float *values = proxies[channel]->getSampleData();
 				float value = values[i];
 				fileWriter.writeValue(value);
 				fileWriter.write(" ");
@@ -85,18 +106,402 @@ void DataRecorderUGenInternal::processBlock(bool& shouldDelete, const unsigned i
 		
 		lastTrig = thisTrig;
 	}
+}
+
+DataRecorder::DataRecorder(UGen const& input, UGen const& trig, Text const& file, const bool timeStamp) throw()
+{
+	DataRecorderUGenInternal *internal = new DataRecorderUGenInternal(input, trig.mix(), file, timeStamp);
+	initInternal(input.getNumChannels());
+	generateFromProxyOwner(internal);	
+}
+
+static const char binaryDataMagic[4] = { 'U', 'G', 'D', 'R' };
+static const unsigned int binaryDataVersion = 1;
+static const unsigned int binaryDataTimeStampFlag = 1;
+
+#if defined(UGEN_JUCE)
+/** Flushes a BinaryDataWriter periodically. */
+class BinaryDataWriterThread : public Thread
+{
+public:
+	BinaryDataWriterThread(BinaryDataWriter& writerToUse) throw()
+	:	Thread("BinaryDataWriter"),
+		writer(writerToUse)
+	{
+	}
+	
+	void run()
+	{
+		while(!threadShouldExit())
+		{
+			writer.flush();
+			wait(20);
+		}
+	}
+	
+private:
+	BinaryDataWriter& writer;
+};
+#else
+/** Flushes a BinaryDataWriter periodically using a native thread. 
+ This has the same startThread() and stopThread() calls as the Juce version above. */
+class BinaryDataWriterThread
+{
+public:
+	BinaryDataWriterThread(BinaryDataWriter& writerToUse) throw()
+	:	writer(writerToUse),
+		shouldExit(0),
+		started(false)
+	{
+	}
+	
+	void startThread() throw()
+	{
+#if defined(WIN32)
+		handle = CreateThread(0, 0, threadEntry, this, 0, 0);
+		started = handle != 0;
+#else
+		started = pthread_create(&thread, 0, threadEntry, this) == 0;
+#endif
+	}
+	
+	void stopThread(const int /*timeOutMilliseconds*/) throw()
+	{
+		if(!started) return;
+		
+		shouldExit = 1;
+		
+#if defined(WIN32)
+		WaitForSingleObject(handle, INFINITE);
+		CloseHandle(handle);
+#else
+		pthread_join(thread, 0);
+#endif
+		started = false;
+	}
+	
+private:
+	void run() throw()
+	{
+		while(!shouldExit)
+		{
+			writer.flush();
+			
+#if defined(WIN32)
+			Sleep(20);
+#else
+			usleep(20000);
+#endif
+		}
+	}
+	
+#if defined(WIN32)
+	static DWORD WINAPI threadEntry(LPVOID context)
+	{
+		static_cast<BinaryDataWriterThread*> (context)->run();
+		return 0;
+	}
+	
+	HANDLE handle;
+#else
+	static void* threadEntry(void* context)
+	{
+		static_cast<BinaryDataWriterThread*> (context)->run();
+		return 0;
+	}
+	
+	pthread_t thread;
+#endif
+	
+	BinaryDataWriter& writer;
+	volatile int shouldExit;
+	bool started;
+};
+#endif
+
+BinaryDataWriter::BinaryDataWriter(Text const& path, 
+								   const int numChannelsToUse, 
+								   const bool timeStampToUse, 
+								   const int fifoFrames) throw()
+:	numChannels(numChannelsToUse),
+	timeStamp(timeStampToUse),
+	maxChunkFrames(ugen::max(1, fifoFrames / 2)),
+	file(fopen(path.getArray(), "wb")),
+	fifo(fifoFrames * numChannelsToUse),
+	timeStampFifo(timeStampToUse ? fifoFrames : 1),
+	numDropped(0),
+	chunk(new float[ugen::max(1, fifoFrames / 2) * numChannelsToUse]),
+	chunkTimeStamps(new unsigned int[ugen::max(1, fifoFrames / 2)]),
+	columns(new float[ugen::max(1, fifoFrames / 2)]),
+	thread(0)
+{
+	ugen_assert(numChannels > 0);
+	
+	if(file != 0)
+	{
+		const unsigned int header[3] = { binaryDataVersion, 
+										 (unsigned int)numChannels, 
+										 timeStamp ? binaryDataTimeStampFlag : 0 };
+		fwrite(binaryDataMagic, 1, sizeof(binaryDataMagic), file);
+		fwrite(header, sizeof(unsigned int), 3, file);
+		
+		thread = new BinaryDataWriterThread(*this);
+		thread->startThread();
+	}
+}
+
+BinaryDataWriter::~BinaryDataWriter()
+{
+	if(thread != 0)
+	{
+		thread->stopThread(4000);
+		delete thread;
+	}
+	
+	flush();
+	
+	if(file != 0)
+		fclose(file);
+	
+	delete [] chunk;
+	delete [] chunkTimeStamps;
+	delete [] columns;
+}
+
+bool BinaryDataWriter::writeFrame(const unsigned int time, const float* values) throw()
+{
+	if(file == 0) return false;
+	
+	// check both FIFOs first so a frame is either written completely or dropped
+	if((fifo.getFreeSpace() < numChannels) || (timeStamp && (timeStampFifo.getFreeSpace() < 1)))
+	{
+		numDropped++;
+		return false;
+	}
+	
+	// write the values before the time stamp as flush() counts frames using the time stamps
+	fifo.write(values, numChannels);
+	
+	if(timeStamp)
+		timeStampFifo.write(time);
+	
+	return true;
+}
+
+void BinaryDataWriter::flush() throw()
+{
+	if(file == 0) return;
+	
+	for(;;)
+	{
+		int numFrames = ugen::min(fifo.getNumReady() / numChannels, maxChunkFrames);
+		
+		if(timeStamp)
+			numFrames = ugen::min(numFrames, timeStampFifo.getNumReady());
+		
+		if(numFrames <= 0) 
+			break;
+		
+		fifo.read(chunk, numFrames * numChannels);
+		
+		const unsigned int chunkHeader = numFrames;
+		fwrite(&chunkHeader, sizeof(unsigned int), 1, file);
+		
+		if(timeStamp)
+		{
+			timeStampFifo.read(chunkTimeStamps, numFrames);
+			fwrite(chunkTimeStamps, sizeof(unsigned int), numFrames, file);
+		}
+		
+		// then each channel as a column
+		for(int channel = 0; channel < numChannels; channel++)
+		{
+			const float* source = chunk + channel;
+			
+			for(int i = 0; i < numFrames; i++, source += numChannels)
+				columns[i] = *source;
+			
+			fwrite(columns, sizeof(float), numFrames, file);
+		}
+	}
+	
+	fflush(file);
+}
+
+BinaryDataReader::BinaryDataReader(Text const& path) throw()
+:	valid(false),
+	truncated(false)
+{
+	FILE* file = fopen(path.getArray(), "rb");
+	
+	if(file == 0) return;
+	
+	char magic[4];
+	unsigned int header[3];
+	
+	if((fread(magic, 1, sizeof(magic), file) != sizeof(magic)) || 
+	   (memcmp(magic, binaryDataMagic, sizeof(magic)) != 0) ||
+	   (fread(header, sizeof(unsigned int), 3, file) != 3) ||
+	   (header[0] != binaryDataVersion) ||
+	   (header[1] == 0))
+	{
+		fclose(file);
+		return;
+	}
+	
+	const int numChannels = header[1];
+	const bool hasStamps = (header[2] & binaryDataTimeStampFlag) != 0;
+	
+	// first pass to count the frames in the complete chunks, a recording which was interrupted 
+	// (e.g., by a crash) may end with a partly written chunk which is left out
+	const long dataStart = ftell(file);
+	fseek(file, 0, SEEK_END);
+	const long fileSize = ftell(file);
+	fseek(file, dataStart, SEEK_SET);
+	
+	const int columnsPerChunk = numChannels + (hasStamps ? 1 : 0);
+	long position = dataStart;
+	int totalFrames = 0;
+	unsigned int numFrames;
+	
+	while(fread(&numFrames, sizeof(unsigned int), 1, file) == 1)
+	{
+		const double chunkSize = (double)numFrames * columnsPerChunk * sizeof(float);
+		
+		if((position + (double)sizeof(unsigned int) + chunkSize) > fileSize)
+		{
+			truncated = true;
+			break;
+		}
+		
+		position += sizeof(unsigned int) + (long)chunkSize;
+		totalFrames += numFrames;
+		
+		if(fseek(file, position, SEEK_SET) != 0)
+			break;
+	}
+	
+	if((position < fileSize) && !truncated)
+		truncated = true; // a partial chunk header
+	
+	fseek(file, dataStart, SEEK_SET);
+	
+	if(totalFrames > 0)
+	{
+		valid = true;
+		data = Buffer::withSize(totalFrames, numChannels, true);
+		
+		if(hasStamps)
+			timeStamps = UnsignedIntArray::withSize(totalFrames);
+		
+		int offset = 0;
+		
+		while((offset < totalFrames) && (fread(&numFrames, sizeof(unsigned int), 1, file) == 1))
+		{
+			if(hasStamps && (fread(timeStamps.getArray() + offset, sizeof(unsigned int), numFrames, file) != numFrames))
+				break;
+			
+			int channel;
+			
+			for(channel = 0; channel < numChannels; channel++)
+			{
+				if(fread(data.getData(channel) + offset, sizeof(float), numFrames, file) != numFrames)
+					break;
+			}
+			
+			if(channel < numChannels)
+				break;
+			
+			offset += numFrames;
+		}
+		
+		if(offset < totalFrames)
+		{
+			// the chunks were complete so a short read here is a read error
+			valid = false;
+			data = Buffer();
+			timeStamps = UnsignedIntArray();
+		}
+	}
+	
+	fclose(file);
+}
+
+Buffer BinaryDataReader::getTimeStampsInSeconds(const double sampleRateIn) const throw()
+{
+	const int numFrames = timeStamps.size();
+	
+	if(numFrames == 0) return Buffer();
+	
+	const double reciprocalSampleRate = 1.0 / (sampleRateIn == 0.0 ? UGen::getSampleRate() : sampleRateIn);
+	Buffer seconds = Buffer::withSize(numFrames, 1, false);
+	float* secondsSamples = seconds.getData(0);
+	const unsigned int* stampSamples = timeStamps.getArray();
+	
+	for(int i = 0; i < numFrames; i++)
+		secondsSamples[i] = (float)(stampSamples[i] * reciprocalSampleRate);
+	
+	return seconds;
+}
+
+BinaryDataRecorderUGenInternal::BinaryDataRecorderUGenInternal(UGen const& input, 
+															   UGen const& trig, 
+															   Text const& file, 
+															   const bool _timeStamp) throw()
+:	ProxyOwnerUGenInternal(NumInputs, input.getNumChannels()-1),
+	writer(file, input.getNumChannels(), _timeStamp),
+	lastTrig(0.f),
+	timeStamp(_timeStamp),
+	inputSamples(new const float*[input.getNumChannels()]),
+	frame(new float[input.getNumChannels()])
+{
+	inputs[Input] = input;
+	inputs[Trig] = trig;
+}
+
+BinaryDataRecorderUGenInternal::~BinaryDataRecorderUGenInternal()
+{
+	delete [] inputSamples;
+	delete [] frame;
+}
+
+void BinaryDataRecorderUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
+{
+	const int numSamplesToProcess = uGenOutput.getBlockSize();
+	const float *trigSamples = inputs[Trig].processBlock(shouldDelete, blockID, 0);
+	const int numInputChannels = inputs[Input].getNumChannels();
 	
-	for(int channel = 0; channel < inputs[Input].getNumChannels(); channel++)
+	for(int channel = 0; channel < numInputChannels; channel++)
 	{
 		float *inputValues = inputs[Input].processBlock(shouldDelete, blockID, channel);
 		float *outputValues = proxies[channel]->getSampleData();
 		memcpy(outputValues, inputValues, numSamplesToProcess * sizeof(float));
+		inputSamples[channel] = outputValues;
 	}
+	
+	LOCAL_DECLARE(float, lastTrig);
+	
+	for(int i = 0; i < numSamplesToProcess; i++)
+	{
+		const float thisTrig = trigSamples[i];
+		
+		if(thisTrig > 0.f && lastTrig <= 0.f)
+		{
+			for(int channel = 0; channel < numInputChannels; channel++)
+				frame[channel] = inputSamples[channel][i];
+			
+			writer.writeFrame(blockID + i, frame);
+		}
+		
+		lastTrig = thisTrig;
+	}
+	
+	LOCAL_COPY(lastTrig);
 }
 
-DataRecorder::DataRecorder(UGen const& input, UGen const& trig, Text const& file, const bool timeStamp) throw()
+BinaryDataRecorder::BinaryDataRecorder(UGen const& input, UGen const& trig, Text const& file, const bool timeStamp) throw()
 {
-	DataRecorderUGenInternal *internal = new DataRecorderUGenInternal(input, trig.mix(), file, timeStamp);
+	BinaryDataRecorderUGenInternal *internal = new BinaryDataRecorderUGenInternal(input, trig.mix(), file, timeStamp);
 	initInternal(input.getNumChannels());
 	generateFromProxyOwner(internal);	
 }
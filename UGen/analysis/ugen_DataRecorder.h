@@ -40,6 +40,7 @@
 
 #include "../core/ugen_UGen.h"
 #include "../core/ugen_TextFile.h"
+#include "../core/ugen_LockFreeFifo.h"
 
 /** @ingroup UGenInternals */
 class DataRecorderUGenInternal : public ProxyOwnerUGenInternal
@@ -62,6 +63,128 @@ UGenSublcassDeclaration(DataRecorder,
 								 (UGen const& input, UGen const& trig, Text const& file, const bool timeStamp = false),
 								 COMMON_UGEN_DOCS);
 
+class BinaryDataWriterThread;
+
+/** Writes triggered frames of data to a compact binary file.
+ 
+ Frames are queued from the audio thread into LockFreeFifo objects and written to disk 
+ by flush() which is called periodically by a background thread owned by the writer 
+ (a Juce Thread in Juce builds, otherwise a native thread) so the audio thread never
+ touches the file.
+ 
+ The file is stored in columns so each channel's values are contiguous:
+ @code
+ header:	char[4] "UGDR", uint32 version, uint32 numChannels, uint32 flags (1 = time stamps)
+ chunks:	uint32 numFrames, 
+			[uint32 timeStamps[numFrames]], 
+			float channel0[numFrames], ... float channelN-1[numFrames]
+ @endcode
+ All values are native (little) endian.
+ 
+ @see BinaryDataRecorder, BinaryDataReader */
+class BinaryDataWriter
+{
+public:
+	BinaryDataWriter(Text const& path, 
+					 const int numChannels, 
+					 const bool timeStamp, 
+					 const int fifoFrames = 8192) throw();
+	~BinaryDataWriter();
+	
+	inline int getNumChannels() const throw()		{ return numChannels;						}
+	inline bool isOpen() const throw()				{ return file != 0;							}
+	
+	/** The number of frames lost because the FIFO was full. */
+	inline int getNumDroppedFrames() const throw()	{ return numDropped;						}
+	
+	/** Returns true if the FIFO is more than half full. */
+	inline bool needsFlush() const throw()			{ return fifo.getNumReady() > fifo.getCapacity() / 2; }
+	
+	/** Queue one frame of @c numChannels values, this is safe to call from the audio thread. */
+	bool writeFrame(const unsigned int timeStamp, const float* values) throw();
+	
+	/** Write any queued frames to the file. 
+	 This is called by the writer's background thread (and by the destructor once the thread
+	 has stopped) so it should not normally be called directly. */
+	void flush() throw();
+	
+private:
+	const int numChannels;
+	const bool timeStamp;
+	const int maxChunkFrames;
+	FILE* file;
+	LockFreeFifo<float> fifo;
+	LockFreeFifo<unsigned int> timeStampFifo;
+	volatile int numDropped;
+	float* chunk;
+	unsigned int* chunkTimeStamps;
+	float* columns;
+	BinaryDataWriterThread* thread;
+	
+	BinaryDataWriter (const BinaryDataWriter&);
+    const BinaryDataWriter& operator= (const BinaryDataWriter&);
+};
+
+/** Reads files written by BinaryDataRecorder (or BinaryDataWriter) into Buffer objects. 
+ @see BinaryDataRecorder */
+class BinaryDataReader
+{
+public:
+	/** Read an entire file. 
+	 If the file ends with an incomplete chunk (e.g., the recording was interrupted) the complete 
+	 chunks before it are read and isTruncated() returns true. */
+	BinaryDataReader(Text const& path) throw();
+	
+	inline bool isValid() const throw()							{ return valid;					}
+	inline bool isTruncated() const throw()						{ return truncated;				}
+	inline int getNumChannels() const throw()					{ return data.getNumChannels(); }
+	inline int getNumFrames() const throw()						{ return data.size();			}
+	inline bool hasTimeStamps() const throw()					{ return timeStamps.size() > 0; }
+	
+	/** The recorded values with one Buffer channel per recorded channel. */
+	inline Buffer const& getData() const throw()				{ return data;					}
+	
+	/** The time stamps (in samples) of each frame if these were recorded. */
+	inline UnsignedIntArray const& getTimeStamps() const throw()	{ return timeStamps;		}
+	
+	/** The time stamps converted to seconds using a given sample rate (0 uses UGen::getSampleRate()). */
+	Buffer getTimeStampsInSeconds(const double sampleRate = 0.0) const throw();
+	
+private:
+	bool valid;
+	bool truncated;
+	Buffer data;
+	UnsignedIntArray timeStamps;
+};
+
+/** @ingroup UGenInternals */
+class BinaryDataRecorderUGenInternal : public ProxyOwnerUGenInternal
+{
+public:
+	BinaryDataRecorderUGenInternal(UGen const& input, UGen const& trig, Text const& file, const bool timeStamp = false) throw();
+	~BinaryDataRecorderUGenInternal();
+	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
+	enum Inputs { Input, Trig, NumInputs };
+	
+protected:	
+	BinaryDataWriter writer;
+	float lastTrig;
+	const bool timeStamp;
+	const float** inputSamples;
+	float* frame;
+};
+
+/** Record the state of an input UGen at a given trigger into a binary file.
+ This is the same as DataRecorder except values are queued on the audio thread 
+ and written as binary in the background which is suitable for high trigger rates.
+ Use BinaryDataReader to load the file back into Buffer objects.
+ @see BinaryDataWriter, BinaryDataReader */
+UGenSublcassDeclaration(BinaryDataRecorder,
+								 (input, trig, file, timeStamp), 
+								 (UGen const& input, UGen const& trig, Text const& file, const bool timeStamp = false),
+								 COMMON_UGEN_DOCS);
+
 
 
 #endif // _UGEN_ugen_DataRecorder_H_
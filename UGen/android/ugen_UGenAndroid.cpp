@@ -51,7 +51,12 @@
 #include "../basics/ugen_UnaryOpUGens.cpp"
 #include "../basics/ugen_WrapFold.cpp"
 #include "../buffers/ugen_Buffer.cpp"
+#include "../buffers/ugen_BufferDispatcher.cpp"
+#include "../buffers/ugen_CompressedBuffer.cpp"
+#include "../buffers/ugen_Interpolation.cpp"
 #include "../buffers/ugen_PlayBuf.cpp"
+#include "../buffers/ugen_Resampler.cpp"
+#include "../buffers/ugen_SamplePool.cpp"
 #include "../core/ugen_Arrays.cpp"
 #include "../core/ugen_Bits.cpp"
 #include "../core/ugen_Deleter.cpp"
@@ -59,6 +64,7 @@
 #include "../core/ugen_Random.cpp"
 #include "../core/ugen_SmartPointer.cpp"
 #include "../core/ugen_Text.cpp"
+#include "../core/ugen_ThreadPool.cpp"
 #include "../core/ugen_UGen.cpp"
 #include "../core/ugen_UGenArray.cpp"
 #include "../core/ugen_UGenInternal.cpp"
@@ -70,14 +76,19 @@
 #include "../filters/control/ugen_Lag.cpp"
 
 #include "../oscillators/wavetable/ugen_TableOsc.cpp"
+#include "../oscillators/wavetable/ugen_WavetableOsc.cpp"
 
+#include "../filters/ugen_FilterCoeffTable.cpp"
 #include "../filters/ugen_BEQ.cpp"
+#include "../filters/ugen_BiquadBank.cpp"
+#include "../filters/ugen_ParametricEQ.cpp"
 #include "../filters/control/ugen_Decay.cpp"
 #include "../filters/ugen_SOS.cpp"
 #include "../filters/ugen_LeakDC.cpp"
 #include "../filters/simple/ugen_LPF.cpp"
 #include "../filters/simple/ugen_HPF.cpp"
 #include "../oscillators/simple/ugen_LFSaw.cpp"
+#include "../oscillators/simple/ugen_OscBank.cpp"
 #include "../oscillators/simple/ugen_LFPulse.cpp"
 #include "../oscillators/simple/ugen_Impulse.cpp"
 #include "../oscillators/simple/ugen_FSinOsc.cpp"
@@ -85,6 +96,7 @@
 #include "../spawn/ugen_Spawn.cpp"
 #include "../spawn/ugen_TSpawn.cpp"
 #include "../spawn/ugen_VoicerBase.cpp"
+#include "../spawn/ugen_VoicerVoiceTable.cpp"
 #include "../spawn/ugen_Textures.cpp"
 #include "../analysis/ugen_Amplitude.cpp"
 #include "../analysis/ugen_Maxima.cpp"
@@ -98,9 +110,13 @@
 #include "../noise/ugen_Dust.cpp"
 #include "../noise/ugen_LFNoise.cpp"
 #include "../delays/ugen_Delay.cpp"
+#include "../delays/ugen_FDN.cpp"
 #include "../pan/ugen_BasicPan.cpp"
 #include "../fft/ugen_FFTEngine.cpp"
 #include "../fft/ugen_FFTEngineInternal.cpp"
+#include "../fft/ugen_STFT.cpp"
+#include "../convolution/ugen_HRTF.cpp"
+#include "../convolution/ugen_BinauralPan.cpp"
 
 //BEGIN_UGEN_NAMESPACE
 
@@ -80,7 +80,60 @@ BinaryOpSymbolUGenDefinitionNoProcessBlock(Multiply,		*,	*);
 #else
 BinaryOpSymbolUGenDefinition(Add,					+,	+);
 BinaryOpSymbolUGenDefinition(Subtract,				-,	-);
-BinaryOpSymbolUGenDefinition(Multiply,				*,	*);
+BinaryOpSymbolUGenDefinitionNoProcessBlock(Multiply,		*,	*);
+
+void BinaryMultiplyUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
+{
+	int numSamplesToProcess = uGenOutput.getBlockSize();
+	float* outputSamples = uGenOutput.getSampleData();
+	const float* leftOperandSamples = inputs[LeftOperand].processBlock(shouldDelete, blockID, channel);
+	
+	if(inputs[LeftOperand].isSilent(channel))
+	{
+		// the result is silent but the right operand is processed to keep its state in step
+		inputs[RightOperand].processBlock(shouldDelete, blockID, channel);
+		uGenOutput.setSilentAndClear();
+		return;
+	}
+	
+	const float* rightOperandSamples = inputs[RightOperand].processBlock(shouldDelete, blockID, channel);
+	
+	if(inputs[RightOperand].isSilent(channel))
+	{
+		uGenOutput.setSilentAndClear();
+		return;
+	}
+	
+	const bool leftIsConstant = inputs[LeftOperand].isConstant(channel);
+	const bool rightIsConstant = inputs[RightOperand].isConstant(channel);
+	
+	if(leftIsConstant && rightIsConstant)
+	{
+		const float value = leftOperandSamples[0] * rightOperandSamples[0];
+		
+		while(numSamplesToProcess--)
+			*outputSamples++ = value;
+		
+		uGenOutput.setConstant(true);
+	}
+	else if(leftIsConstant || rightIsConstant)
+	{
+		const float gain = leftIsConstant ? leftOperandSamples[0] : rightOperandSamples[0];
+		const float* inputSamples = leftIsConstant ? rightOperandSamples : leftOperandSamples;
+		
+		while(numSamplesToProcess--)
+			*outputSamples++ = *inputSamples++ * gain;
+		
+		uGenOutput.setSilent(false);
+	}
+	else
+	{
+		while(numSamplesToProcess--)
+			*outputSamples++ = *leftOperandSamples++ * *rightOperandSamples++;
+		
+		uGenOutput.setSilent(false);
+	}
+}
 #endif
 
 BinaryOpSymbolUGenDefinition(LessThan,				<,	<);
@@ -189,31 +242,20 @@ void BinaryDivideUGenInternal::processBlock(bool& shouldDelete, const unsigned i
 
 void BinaryDivideUGenInternalK::processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw() 
 { 
-	const int krBlockSize = UGen::getControlRateBlockSize(); 
-	unsigned int blockPosition = blockID % krBlockSize; 
-	int numSamplesToProcess = uGenOutput.getBlockSize(); 
-	float* outputSamples = uGenOutput.getSampleData(); 
-	float* leftOperandSamples = inputs[LeftOperand].processBlock(shouldDelete, blockID, channel); 
-	float* rightOperandSamples = inputs[RightOperand].processBlock(shouldDelete, blockID, channel); 
-	int numKrSamples = blockPosition % krBlockSize; 
+	const UGenOutput* leftOperandOutput = inputs[LeftOperand].processControlBlock(shouldDelete, blockID, channel); 
+	const UGenOutput* rightOperandOutput = inputs[RightOperand].processControlBlock(shouldDelete, blockID, channel); 
 	
-	while(numSamplesToProcess > 0) 
-	{ 
-		if(numKrSamples == 0) 
-			value = *leftOperandSamples / *rightOperandSamples; // maybe should "zap" the output?
-		
-		numKrSamples		=  krBlockSize - numKrSamples; 
-		blockPosition		+= numKrSamples; 
-		leftOperandSamples	+= numKrSamples; 
-		rightOperandSamples += numKrSamples; 
+	int controlIndex = uGenOutput.beginControlBlock(blockID, false); 
+	const int numControlValues = uGenOutput.getNumControlValues(); 
+	float* controlValues = uGenOutput.getControlValues(); 
 	
-		while(numSamplesToProcess && numKrSamples) 
-		{ 
-			*outputSamples++ = value; 
-			--numSamplesToProcess; 
-			--numKrSamples; 
-		} 
+	for(; controlIndex < numControlValues; ++controlIndex) 
+	{ 
+		const int position = uGenOutput.getControlValuePosition(controlIndex); 
+		controlValues[controlIndex] = leftOperandOutput->getControlValue(position) / rightOperandOutput->getControlValue(position); // maybe should "zap" the output?
 	}
+	
+	value = uGenOutput.getLastRenderedValue();
 } 
 
 UGen operator / (const float leftOperand, UGen const& rightOperand) throw() 
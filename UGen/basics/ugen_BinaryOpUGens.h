@@ -91,43 +91,18 @@
 	
 
 #define BinaryOpSymbolUGenProcessBlock_K(shouldDelete_, blockID_, channel_, OPSYMBOL_INTERNAL)							\
-		const int krBlockSize = UGen::getControlRateBlockSize();														\
-		unsigned int blockPosition = blockID % krBlockSize;																\
-		int numSamplesToProcess = uGenOutput.getBlockSize();															\
-		float* outputSamples = uGenOutput.getSampleData();																\
-		float* leftOperandSamples = inputs[LeftOperand].processBlock(shouldDelete, blockID_, channel_);					\
-		float* rightOperandSamples = inputs[RightOperand].processBlock(shouldDelete, blockID_, channel_);				\
-																														\
-		int numKrSamples = blockPosition % krBlockSize;																	\
-																														\
-			while(numSamplesToProcess > 0) {																			\
-				float nextValue = value;																				\
-				if(numKrSamples == 0)																					\
-					nextValue = *leftOperandSamples OPSYMBOL_INTERNAL *rightOperandSamples;								\
-																														\
-				numKrSamples = krBlockSize - numKrSamples;																\
-																														\
-				blockPosition		+= numKrSamples;																	\
-				leftOperandSamples	+= numKrSamples;																	\
-				rightOperandSamples	+= numKrSamples;																	\
+		const UGenOutput* leftOperandOutput = inputs[LeftOperand].processControlBlock(shouldDelete_, blockID_, channel_);	\
+		const UGenOutput* rightOperandOutput = inputs[RightOperand].processControlBlock(shouldDelete_, blockID_, channel_);	\
+		int controlIndex = uGenOutput.beginControlBlock(blockID_);														\
+		const int numControlValues = uGenOutput.getNumControlValues();													\
+		float* controlValues = uGenOutput.getControlValues();															\
+																														\
+		for(; controlIndex < numControlValues; ++controlIndex) {														\
+			const int position = uGenOutput.getControlValuePosition(controlIndex);										\
+			controlValues[controlIndex] = leftOperandOutput->getControlValue(position) OPSYMBOL_INTERNAL rightOperandOutput->getControlValue(position);	\
+		}																												\
 																														\
-				if(nextValue == value) {																				\
-					while(numSamplesToProcess && numKrSamples) {														\
-						*outputSamples++ = nextValue;																	\
-						--numSamplesToProcess;																			\
-						--numKrSamples;																					\
-					}																									\
-				} else {																								\
-					float valueSlope = (nextValue - value) / (float)UGen::getControlRateBlockSize();					\
-					while(numSamplesToProcess && numKrSamples) {														\
-						*outputSamples++ = value;																		\
-						value += valueSlope;																			\
-						--numSamplesToProcess;																			\
-						--numKrSamples;																					\
-					}																									\
-					value = nextValue;																					\
-				}																										\
-			}																											\
+		value = uGenOutput.getLastRenderedValue();																		\
 
 
 #define BinaryOpFunctionUGenProcessBlock(shouldDelete_, blockID_, channel_, OPFUNCTION_INTERNAL)						\
@@ -142,43 +117,18 @@
 
 
 #define BinaryOpFunctionUGenProcessBlock_K(shouldDelete_, blockID_, channel_, OPFUNCTION_INTERNAL)						\
-		const int krBlockSize = UGen::getControlRateBlockSize();														\
-		unsigned int blockPosition = blockID % krBlockSize;																\
-		int numSamplesToProcess = uGenOutput.getBlockSize();															\
-		float* outputSamples = uGenOutput.getSampleData();																\
-		float* leftOperandSamples = inputs[LeftOperand].processBlock(shouldDelete_, blockID_, channel_);					\
-		float* rightOperandSamples = inputs[RightOperand].processBlock(shouldDelete_, blockID_, channel_);				\
-																														\
-		int numKrSamples = blockPosition & krBlockSize;																	\
-																														\
-			while(numSamplesToProcess > 0) {																			\
-				float nextValue = value;																				\
-				if(numKrSamples == 0)																					\
-					nextValue = OPFUNCTION_INTERNAL(*leftOperandSamples, *rightOperandSamples);							\
-																														\
-				numKrSamples = krBlockSize - numKrSamples;																\
-																														\
-				blockPosition		+= numKrSamples;																	\
-				leftOperandSamples	+= numKrSamples;																	\
-				rightOperandSamples	+= numKrSamples;																	\
+		const UGenOutput* leftOperandOutput = inputs[LeftOperand].processControlBlock(shouldDelete_, blockID_, channel_);	\
+		const UGenOutput* rightOperandOutput = inputs[RightOperand].processControlBlock(shouldDelete_, blockID_, channel_);	\
+		int controlIndex = uGenOutput.beginControlBlock(blockID_);														\
+		const int numControlValues = uGenOutput.getNumControlValues();													\
+		float* controlValues = uGenOutput.getControlValues();															\
+																														\
+		for(; controlIndex < numControlValues; ++controlIndex) {														\
+			const int position = uGenOutput.getControlValuePosition(controlIndex);										\
+			controlValues[controlIndex] = OPFUNCTION_INTERNAL(leftOperandOutput->getControlValue(position), rightOperandOutput->getControlValue(position));	\
+		}																												\
 																														\
-				if(nextValue == value) {																				\
-					while(numSamplesToProcess && numKrSamples) {														\
-						*outputSamples++ = nextValue;																	\
-						--numSamplesToProcess;																			\
-						--numKrSamples;																					\
-					}																									\
-				} else {																								\
-					float valueSlope = (nextValue - value) / (float)UGen::getControlRateBlockSize();					\
-					while(numSamplesToProcess && numKrSamples) {														\
-						*outputSamples++ = value;																		\
-						value += valueSlope;																			\
-						--numSamplesToProcess;																			\
-						--numKrSamples;																					\
-					}																									\
-					value = nextValue;																					\
-				}																										\
-			}																											\
+		value = uGenOutput.getLastRenderedValue();																		\
 
 
 #define BinaryOpCommonUGenDeclaration(OPNAME)																			\
@@ -199,6 +149,7 @@
 			Binary##OPNAME##UGenInternalK(UGen const& leftOperand, UGen const& rightOperand) throw();					\
 			UGenInternal* getKr() throw() { incrementRefCount(); return this; }											\
 			void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();				\
+			float getValue(const int channel) const throw() { (void)channel; return value; }							\
 		private:																										\
 			float value;																								\
 		};																												\
@@ -755,10 +706,7 @@ public:
 	BinaryDivideUGenInternalK(UGen const& leftOperand, UGen const& rightOperand) throw(); 
 	UGenInternal* getKr() throw() { incrementRefCount(); return this; } 
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw(); 
-	float getValue(const int channel) const throw() 
-	{ 
-		return inputs[LeftOperand].getValue(channel) / inputs[RightOperand].getValue(channel);
-	}
+	float getValue(const int channel) const throw() { (void)channel; return value; }
 	
 private: 
 	float value; 
@@ -42,6 +42,83 @@ BEGIN_UGEN_NAMESPACE
 #include "ugen_MixUGen.h"
 
 
+/** Sum one pass of up to MixKernels::MaxInputsPerPass inputs, optionally with gains. */
+template<int NumInputs, bool UseGains>
+static inline void mixKernelPass(float* const outputSamples, 
+								 const float* const* const inputSamples, 
+								 const float* const gains,
+								 const int numSamples, 
+								 const bool shouldAccumulate) throw()
+{
+	const float* const input0 = inputSamples[0];
+	const float* const input1 = NumInputs > 1 ? inputSamples[1] : 0;
+	const float* const input2 = NumInputs > 2 ? inputSamples[2] : 0;
+	const float* const input3 = NumInputs > 3 ? inputSamples[3] : 0;
+	const float gain0 = UseGains ? gains[0] : 1.f;
+	const float gain1 = UseGains && NumInputs > 1 ? gains[1] : 1.f;
+	const float gain2 = UseGains && NumInputs > 2 ? gains[2] : 1.f;
+	const float gain3 = UseGains && NumInputs > 3 ? gains[3] : 1.f;
+	
+	for(int i = 0; i < numSamples; ++i)
+	{
+		float sum = shouldAccumulate ? outputSamples[i] : 0.f;
+		sum += UseGains ? input0[i] * gain0 : input0[i];
+		if(NumInputs > 1) sum += UseGains ? input1[i] * gain1 : input1[i];
+		if(NumInputs > 2) sum += UseGains ? input2[i] * gain2 : input2[i];
+		if(NumInputs > 3) sum += UseGains ? input3[i] * gain3 : input3[i];
+		outputSamples[i] = sum;
+	}
+}
+
+template<bool UseGains>
+static void mixKernel(float* const outputSamples, 
+					  const float* const* inputSamples, 
+					  const float* gains,
+					  int numInputs, 
+					  const int numSamples, 
+					  bool shouldAccumulate) throw()
+{
+	ugen_assert(shouldAccumulate || numInputs > 0);
+	
+	while(numInputs > 0)
+	{
+		const int numInputsThisPass = numInputs < MixKernels::MaxInputsPerPass ? numInputs : (int)MixKernels::MaxInputsPerPass;
+		
+		switch(numInputsThisPass)
+		{
+			case 1:  mixKernelPass<1, UseGains>(outputSamples, inputSamples, gains, numSamples, shouldAccumulate); break;
+			case 2:  mixKernelPass<2, UseGains>(outputSamples, inputSamples, gains, numSamples, shouldAccumulate); break;
+			case 3:  mixKernelPass<3, UseGains>(outputSamples, inputSamples, gains, numSamples, shouldAccumulate); break;
+			default: mixKernelPass<4, UseGains>(outputSamples, inputSamples, gains, numSamples, shouldAccumulate); break;
+		}
+		
+		inputSamples += numInputsThisPass;
+		if(UseGains) gains += numInputsThisPass;
+		numInputs -= numInputsThisPass;
+		shouldAccumulate = true;
+	}
+}
+
+void MixKernels::mix(float* const outputSamples, 
+					 const float* const* const inputSamples, 
+					 const int numInputs, 
+					 const int numSamples, 
+					 const bool shouldAccumulate) throw()
+{
+	mixKernel<false>(outputSamples, inputSamples, 0, numInputs, numSamples, shouldAccumulate);
+}
+
+void MixKernels::mix(float* const outputSamples, 
+					 const float* const* const inputSamples, 
+					 const float* const gains,
+					 const int numInputs, 
+					 const int numSamples, 
+					 const bool shouldAccumulate) throw()
+{
+	mixKernel<true>(outputSamples, inputSamples, gains, numInputs, numSamples, shouldAccumulate);
+}
+
+
 MixUGenInternal::MixUGenInternal(UGen const& array, bool shouldAllowAutoDelete) throw()
 :	UGenInternal(1),
 	shouldAllowAutoDelete_(shouldAllowAutoDelete)
@@ -65,38 +142,46 @@ void MixUGenInternal::prepareForBlock(const int actualBlockSize, const unsigned
 
 #if !defined(UGEN_VFP) && !defined(UGEN_NEON) && !defined(UGEN_VDSP)
 void MixUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
-{
-	int channel = 0;
-	
+{	
 	bool shouldDeleteLocal = false;
 	bool& shouldDeleteToPass = shouldAllowAutoDelete_ ? shouldDelete : shouldDeleteLocal;	
-	int numSamplesToProcess = uGenOutput.getBlockSize();
-	float* const outputSamplesBase = uGenOutput.getSampleData();
-	const float* channelSamples = inputs->processBlock(shouldDeleteToPass, blockID, channel);
-	
-	float* outputSamples = outputSamplesBase;
-	while(numSamplesToProcess--)
-	{
-		*outputSamples++ = *channelSamples++;
-	}
-	
-	channel++;
+	float* const outputSamples = uGenOutput.getSampleData();
+	const int numSamplesToProcess = uGenOutput.getBlockSize();
+	const float* passSamples[MixKernels::MaxInputsPerPass];
+	int numPassInputs = 0;
+	bool isEmpty = true;
 	 
 	int numChannels = inputs->getNumChannels();
 	
-	for(/* leave channel value alone */; channel < numChannels; channel++)
+	for(int channel = 0; channel < numChannels; channel++)
 	{
 		shouldDeleteLocal = false;
-		int numSamplesToProcess = uGenOutput.getBlockSize();
-		outputSamples = outputSamplesBase;
 		const float* channelSamples = inputs->processBlock(shouldDeleteToPass, blockID, channel);
-				
-		while(numSamplesToProcess--)
+		
+		// silent inputs contribute nothing to the mix
+		if(inputs->isSilent(channel))
+			continue;
+		
+		passSamples[numPassInputs++] = channelSamples;
+		
+		if(numPassInputs == MixKernels::MaxInputsPerPass)
 		{
-			*outputSamples++ += *channelSamples++;
+			MixKernels::mix(outputSamples, passSamples, numPassInputs, numSamplesToProcess, !isEmpty);
+			numPassInputs = 0;
+			isEmpty = false;
 		}
 	}
 	
+	if(numPassInputs > 0)
+	{
+		MixKernels::mix(outputSamples, passSamples, numPassInputs, numSamplesToProcess, !isEmpty);
+		isEmpty = false;
+	}
+	
+	if(isEmpty)
+		uGenOutput.setSilentAndClear();
+	else
+		uGenOutput.setSilent(false);
 }
 #endif
 
@@ -166,14 +251,15 @@ void MixArrayUGenInternal::processBlock(bool& shouldDelete, const unsigned int b
 	bool shouldDeleteLocal;
 	bool& shouldDeleteToPass = shouldAllowAutoDelete_ ? shouldDelete : shouldDeleteLocal;	
 	const int numOutputChannels = getNumChannels();
-	const int blockSizeBytes = uGenOutput.getBlockSize() * sizeof(float);
 	const int arraySize = array_.size();
 	const int numSamplesToProcess = uGenOutput.getBlockSize();
+	const float* passSamples[MixKernels::MaxInputsPerPass];
 	
 	for(int channel = 0; channel < numOutputChannels; channel++)
 	{
-		float * const outputSamplesBase = proxies[channel]->getSampleData();
-		memset(outputSamplesBase, 0, blockSizeBytes);
+		float * const outputSamples = proxies[channel]->getSampleData();
+		int numPassInputs = 0;
+		bool isEmpty = true;
 
 		for(int arrayIndex = 0; arrayIndex < arraySize; arrayIndex++)
 		{
@@ -184,20 +270,116 @@ void MixArrayUGenInternal::processBlock(bool& shouldDelete, const unsigned int b
 			if(shouldWrapChannels_ || (channel < ugen.getNumChannels()))
 			{
 				shouldDeleteLocal = false;
-				float* outputSamples = outputSamplesBase;
 				const float* channelSamples = ugen.processBlock(shouldDeleteToPass, blockID, channel);
-										
-				for(int i = 0; i < numSamplesToProcess; ++i)
+				
+				if(ugen.isSilent(channel)) continue;
+				
+				passSamples[numPassInputs++] = channelSamples;
+				
+				if(numPassInputs == MixKernels::MaxInputsPerPass)
 				{
-					outputSamples[i] += channelSamples[i];
+					MixKernels::mix(outputSamples, passSamples, numPassInputs, numSamplesToProcess, !isEmpty);
+					numPassInputs = 0;
+					isEmpty = false;
 				}
 			}
 		}
+		
+		if(numPassInputs > 0)
+		{
+			MixKernels::mix(outputSamples, passSamples, numPassInputs, numSamplesToProcess, !isEmpty);
+			isEmpty = false;
+		}
+		
+		if(isEmpty)
+			proxies[channel]->getOutputRef().setSilentAndClear();
+		else
+			proxies[channel]->getOutputRef().setSilent(false);
 	}
 }
 #endif
 
+MixMatrixUGenInternal::MixMatrixUGenInternal(UGen const& input, Buffer const& gains) throw()
+:	ProxyOwnerUGenInternal(NumInputs, ugen::max(1, gains.getNumChannels()) - 1),
+	numInputChannels(input.getNumChannels()),
+	gains_(gains),
+	channelSamples(ObjectArray<const float*>::withSize(numInputChannels))
+{
+	ugen_assert(gains.size() >= numInputChannels);
+	
+	inputs[Input] = input;
+}
+
+void MixMatrixUGenInternal::prepareInputs(const int actualBlockSize, const unsigned int blockID, const int /*channel*/) throw()
+{
+	inputs[Input].prepareForBlock(actualBlockSize, blockID, -1);
+}
+
+float MixMatrixUGenInternal::getValue(const int channel) const throw()
+{
+	float value = 0.f;
+	
+	for(int inputChannel = 0; inputChannel < numInputChannels; inputChannel++)
+		value += inputs[Input].getValue(inputChannel) * gains_.getSample(channel, inputChannel);
+	
+	return value;
+}
 
+void MixMatrixUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
+{
+	const int numOutputChannels = getNumChannels();
+	const int numSamplesToProcess = uGenOutput.getBlockSize();
+	const int numGains = ugen::min(numInputChannels, gains_.size());
+	const float** const samples = channelSamples.getArray();
+	const float* passSamples[MixKernels::MaxInputsPerPass];
+	float passGains[MixKernels::MaxInputsPerPass];
+	
+	// each input is processed once whichever outputs it is routed to
+	for(int inputChannel = 0; inputChannel < numInputChannels; inputChannel++)
+	{
+		samples[inputChannel] = inputs[Input].processBlock(shouldDelete, blockID, inputChannel);
+		
+		if(inputs[Input].isSilent(inputChannel))
+			samples[inputChannel] = 0;
+	}
+	
+	for(int channel = 0; channel < numOutputChannels; channel++)
+	{
+		float* const outputSamples = proxies[channel]->getSampleData();
+		const float* const gainSamples = gains_.getData(channel);
+		int numPassInputs = 0;
+		bool isEmpty = true;
+		
+		for(int inputChannel = 0; inputChannel < numGains; inputChannel++)
+		{
+			const float gain = gainSamples[inputChannel];
+			
+			if((samples[inputChannel] == 0) || (gain == 0.f)) continue;
+			
+			passSamples[numPassInputs] = samples[inputChannel];
+			passGains[numPassInputs] = gain;
+			numPassInputs++;
+			
+			if(numPassInputs == MixKernels::MaxInputsPerPass)
+			{
+				MixKernels::mix(outputSamples, passSamples, passGains, numPassInputs, numSamplesToProcess, !isEmpty);
+				numPassInputs = 0;
+				isEmpty = false;
+			}
+		}
+		
+		if(numPassInputs > 0)
+		{
+			MixKernels::mix(outputSamples, passSamples, passGains, numPassInputs, numSamplesToProcess, !isEmpty);
+			isEmpty = false;
+		}
+		
+		if(isEmpty)
+			proxies[channel]->getOutputRef().setSilentAndClear();
+		else
+			proxies[channel]->getOutputRef().setSilent(false);
+	}
+}
 
 
 Mix::Mix(UGen const& array, bool shouldAllowAutoDelete) throw()
@@ -237,5 +419,19 @@ void Mix::constructMixArrayWithProxies(MixArrayUGenInternal* internal)
 	}	
 }
 
+MixMatrix::MixMatrix(UGen const& input, Buffer const& gains) throw()
+{
+	MixMatrixUGenInternal* internal = new MixMatrixUGenInternal(input, gains);
+	const int numChannels = internal->getNumChannels();
+	
+	initInternal(numChannels);
+	
+	for(int i = 0; i < numChannels; i++)
+	{
+		internalUGens[i] = i == 0 ? (UGenInternal*)internal : internal->getProxy(i);
+		internalUGens[i]->initValue(internal->getValue(i));
+	}
+}
+
 END_UGEN_NAMESPACE
 
@@ -43,6 +43,41 @@
 #include "../core/ugen_UGenArray.h"
 
 
+/** Block mixing kernels shared by the mixing UGenInternals.
+ These sum up to MaxInputsPerPass input blocks in each pass over the output block
+ so the output is read and written once for every MaxInputsPerPass inputs rather than
+ once for every input. The inputs are always summed in order so the result does not
+ depend on how the inputs are grouped into passes by the caller.
+ @see MixUGenInternal, MixArrayUGenInternal, MixMatrixUGenInternal */
+class MixKernels
+{
+public:
+	enum Constants { MaxInputsPerPass = 4 };
+	
+	/** Sum a number of input blocks into an output block.
+	 @param outputSamples		The output block.
+	 @param inputSamples		An array of pointers to the input blocks.
+	 @param numInputs			The number of input blocks, this may be more than MaxInputsPerPass.
+	 @param numSamples			The number of samples in each block.
+	 @param shouldAccumulate	If true the inputs are added to the output, if false the output
+								is overwritten (and numInputs must be at least 1). */
+	static void mix(float* const outputSamples, 
+					const float* const* const inputSamples, 
+					const int numInputs, 
+					const int numSamples, 
+					const bool shouldAccumulate) throw();
+	
+	/** Sum a number of input blocks into an output block, scaling each by a gain. 
+	 @see mix(float* const, const float* const* const, const int, const int, const bool) */
+	static void mix(float* const outputSamples, 
+					const float* const* const inputSamples, 
+					const float* const gains,
+					const int numInputs, 
+					const int numSamples, 
+					const bool shouldAccumulate) throw();
+};
+
+
 /** A UGenInternal which mixes input UGen channels down to a single channel. 
  @see Mix, MixArrayUGenInternal, MixFill
  @ingroup UGenInternals */
@@ -192,6 +227,50 @@ private:
 	void constructMixArrayWithProxies(MixArrayUGenInternal* internal);
 };
 
+/** A UGenInternal which routes the channels of a UGen to a number of outputs using a matrix of gains.
+ Inputs with a zero gain for an output are not added to it and silent inputs are skipped.
+ @see MixMatrix, MixKernels
+ @ingroup UGenInternals */
+class MixMatrixUGenInternal : public ProxyOwnerUGenInternal
+{
+public:
+	MixMatrixUGenInternal(UGen const& input, Buffer const& gains) throw();
+	
+	void prepareInputs(const int actualBlockSize, const unsigned int blockID, const int channel) throw();
+	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
+	float getValue(const int channel) const throw();
+	
+	enum Inputs { Input, NumInputs };
+	
+private:
+	const int numInputChannels;
+	Buffer gains_;
+	ObjectArray<const float*> channelSamples;	// the input blocks, null for silent channels
+};
+
+#define MixMatrix_Docs	@param input	The input channels to mix.														\
+						@param gains	The matrix of gains. This should have one channel for each output and the		\
+										size of the Buffer should be the number of input channels, the sample at		\
+										[output][input] being the gain of that input in that output. Input channels		\
+										with a zero gain for an output cost nothing for that output.
+
+/** Mix the channels of a UGen to a number of outputs using a matrix of gains.
+ 
+ This is much more efficient than using many Mix UGens on scaled inputs as it uses
+ a single node with each input processed once. For example, to mix four channels 
+ to stereo with the first two on the left, the last two on the right:
+ @code
+	UGen source = SinOsc::AR(U(100, 200, 300, 400), 0, 0.1);
+	UGen stereo = MixMatrix::AR(source, Buffer(Buffer(1.0, 1.0, 0.0, 0.0), Buffer(0.0, 0.0, 1.0, 1.0)));
+ @endcode
+ 
+ @ingroup AllUGens MathsUGens
+ @see Mix */
+UGenSublcassDeclaration(MixMatrix, (input, gains),
+						(UGen const& input, Buffer const& gains), 
+						COMMON_UGEN_DOCS MixMatrix_Docs);
+
 #define EVENT_MIXFILLFUNCTION_DOCS					You must implement this virtual function in your subclass.						\
 													The parent MixFill UGen calls this function multiple times to					\
 													create an array of UGen instances to mix.										\
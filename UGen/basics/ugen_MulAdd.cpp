@@ -59,7 +59,9 @@ UGenInternal* MulAddUGenInternal::getChannel(const int channel) throw()
 
 UGenInternal* MulAddUGenInternal::getKr() throw()
 { 
-	return new MulAddUGenInternal(inputs[Input].kr(), inputs[Mul].kr(), inputs[Add].kr()); 
+	MulAddUGenInternalK* internal = new MulAddUGenInternalK(inputs[Input].kr(), inputs[Mul].kr(), inputs[Add].kr()); 
+	internal->initValue(getValue(0));
+	return internal;
 }
 
 #if !defined(UGEN_VFP) && !defined(UGEN_NEON) && !defined(UGEN_VDSP)
@@ -79,56 +81,23 @@ void MulAddUGenInternal::processBlock(bool& shouldDelete, const unsigned int blo
 
 void MulAddUGenInternalK::processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
 {
-	const int krBlockSize = UGen::getControlRateBlockSize();
-	unsigned int blockPosition = blockID % krBlockSize;
-	int numSamplesToProcess = uGenOutput.getBlockSize();
-	float* outputSamples = uGenOutput.getSampleData();
-	float* inputSamples = inputs[Input].processBlock(shouldDelete, blockID, channel);
-	float* mulSamples = inputs[Mul].processBlock(shouldDelete, blockID, channel);
-	float* addSamples = inputs[Add].processBlock(shouldDelete, blockID, channel);
+	const UGenOutput* inputOutput = inputs[Input].processControlBlock(shouldDelete, blockID, channel);
+	const UGenOutput* mulOutput = inputs[Mul].processControlBlock(shouldDelete, blockID, channel);
+	const UGenOutput* addOutput = inputs[Add].processControlBlock(shouldDelete, blockID, channel);
 	
-	int numKrSamples = blockPosition % krBlockSize;
+	int controlIndex = uGenOutput.beginControlBlock(blockID);
+	const int numControlValues = uGenOutput.getNumControlValues();
+	float* controlValues = uGenOutput.getControlValues();
 	
-	while(numSamplesToProcess > 0)
+	for(; controlIndex < numControlValues; ++controlIndex)
 	{
-		float nextValue = value;
-		
-		if(numKrSamples == 0)			
-		{
-			nextValue = *inputSamples * *mulSamples + *addSamples;
-		}
-		
-		numKrSamples = krBlockSize - numKrSamples;
-		
-		blockPosition		+= numKrSamples;
-		inputSamples		+= numKrSamples;
-		mulSamples			+= numKrSamples;
-		addSamples			+= numKrSamples;
-		
-		if(value == nextValue)
-		{
-			while(numSamplesToProcess && numKrSamples)
-			{
-				*outputSamples++ = nextValue;
-				--numSamplesToProcess;
-				--numKrSamples;
-			}
-		}
-		else
-		{
-			float valueSlope = (nextValue - value) / (float)UGen::getControlRateBlockSize();
-
-			while(numSamplesToProcess && numKrSamples)
-			{
-				*outputSamples++ = value;
-				value += valueSlope;
-				--numSamplesToProcess;
-				--numKrSamples;
-			}
-			
-			value = nextValue;
-		}
+		const int position = uGenOutput.getControlValuePosition(controlIndex);
+		controlValues[controlIndex] = inputOutput->getControlValue(position) 
+									* mulOutput->getControlValue(position) 
+									+ addOutput->getControlValue(position);
 	}
+	
+	value = uGenOutput.getLastRenderedValue();
 }
 
 MulAdd::MulAdd(UGen const& input, UGen const& mul, UGen const& add) throw()
@@ -83,11 +83,22 @@ void PauseUGenInternal::processBlock(bool& shouldDelete, const unsigned int bloc
 #else
 		memset(outputSamples, 0, numSamplesToProcess * sizeof(float));
 #endif
+		uGenOutput.setSilent(true);
 	}
 	else
 	{
 		float* inputSamples = inputs[Input].processBlock(shouldDelete, blockID, channel);
 		
+		if(inputs[Input].isSilent(channel))
+		{
+			memset(outputSamples, 0, numSamplesToProcess * sizeof(float));
+			uGenOutput.setSilent(true);
+			prevLevel = currentLevel;
+			return;
+		}
+		
+		uGenOutput.setSilent(false);
+		
 		if(currentLevel != prevLevel)
 		{
 			float inc = (currentLevel - prevLevel) / (float)numSamplesToProcess;
@@ -61,9 +61,7 @@ UGenInternal* NullUGenInternal::getKr() throw()
 
 void NullUGenInternal::processBlock(bool& /*shouldDelete*/, const unsigned int /*blockID*/, const int /*channel*/) throw()
 {	
-	int numSamplesToProcess = uGenOutput.getBlockSize();
-	float* outputSamples = uGenOutput.getSampleData();
-	memset(outputSamples, 0, numSamplesToProcess * sizeof(float));
+	uGenOutput.setSilentAndClear();
 }
 
 NullUGenInternal* NullUGenInternal::getInstance() throw()
@@ -108,6 +106,11 @@ void ScalarUGenInternal::processBlock(bool& /*shouldDelete*/, const unsigned int
 	memset(outputSamples, 0, numSamplesToProcess * sizeof(float));
 	for(int i = 0; i < numSamplesToProcess; ++i)
 		outputSamples[i] += value_;
+	
+	if(value_ == 0.f)
+		uGenOutput.setSilent(true);
+	else
+		uGenOutput.setConstant(true);
 }
 #endif
 
@@ -79,40 +79,17 @@
 			}																													\
 
 #define UnaryOpUGenProcessBlock_K(shouldDelete_, blockID_, channel_, OPFUNCTION_INTERNAL)										\
-		const int krBlockSize = UGen::getControlRateBlockSize();																\
-		unsigned int blockPosition = blockID % krBlockSize;																		\
-		int numSamplesToProcess = uGenOutput.getBlockSize();																	\
-		float* outputSamples = uGenOutput.getSampleData();																		\
-		float* inputSamples = inputs[Operand].processBlock(shouldDelete_, blockID_, channel_);									\
-																																\
-		int numKrSamples = blockPosition % krBlockSize;																			\
-																																\
-			while(numSamplesToProcess > 0) {																					\
-				float nextValue = value;																						\
-				if(numKrSamples == 0) nextValue = OPFUNCTION_INTERNAL(*inputSamples);											\
+		const UGenOutput* operandOutput = inputs[Operand].processControlBlock(shouldDelete_, blockID_, channel_);				\
+		int controlIndex = uGenOutput.beginControlBlock(blockID_);																\
+		const int numControlValues = uGenOutput.getNumControlValues();															\
+		float* controlValues = uGenOutput.getControlValues();																	\
 																																\
-				numKrSamples = krBlockSize - numKrSamples;																		\
-																																\
-				blockPosition		+= numKrSamples;																			\
-				inputSamples		+= numKrSamples;																			\
+		for(; controlIndex < numControlValues; ++controlIndex) {																\
+			const int position = uGenOutput.getControlValuePosition(controlIndex);												\
+			controlValues[controlIndex] = OPFUNCTION_INTERNAL(operandOutput->getControlValue(position));						\
+		}																														\
 																																\
-				if(nextValue == value) {																						\
-					while(numSamplesToProcess && numKrSamples) {																\
-						*outputSamples++ = nextValue;																			\
-						--numSamplesToProcess;																					\
-						--numKrSamples;																							\
-					}																											\
-				} else {																										\
-					float valueSlope = (nextValue - value) / (float)UGen::getControlRateBlockSize();							\
-					while(numSamplesToProcess && numKrSamples) {																\
-						*outputSamples++ = value;																				\
-						value += valueSlope;																					\
-						--numSamplesToProcess;																					\
-						--numKrSamples;																							\
-					}																											\
-					value = nextValue;																							\
-				}																												\
-			}																													\
+		value = uGenOutput.getLastRenderedValue();																				\
 
 #define UnaryOpUGenDeclaration(OPNAME, OPFUNCTION)																				\
 		/** Internal for Unary##OPNAME##UGen. @ingroup UGenInternals */															\
@@ -132,6 +109,7 @@
 			Unary##OPNAME##UGenInternalK(UGen const& operand) throw();															\
 			UGenInternal* getKr() throw() {  incrementRefCount(); return this; }												\
 			void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();						\
+			float getValue(const int channel) const throw() { (void)channel; return value; }									\
 		private:																												\
 			float value;																										\
 		};																														\
@@ -40,6 +40,8 @@
 BEGIN_UGEN_NAMESPACE
 
 #include "ugen_Buffer.h"
+#include "ugen_BufferDispatcher.h"
+#include "ugen_SamplePool.h"
 #include "../core/ugen_UGen.h"
 #include "../core/ugen_Random.h"
 #include "../core/ugen_Value.h"
@@ -62,7 +64,9 @@ BufferChannelInternal::BufferChannelInternal(const unsigned int size, bool zeroD
 	size_(size),
 	allocatedSize(size),
 	currentWriteBlockID((unsigned int)-1), //FIMXE
-	circularHead(-1), previousCircularHead(-1)
+	circularHead(-1), previousCircularHead(-1),
+	loadedSource(0),
+	loadState(NotLoading)
 {
 //	ugen_assert(size > 0);
 	
@@ -89,7 +93,9 @@ BufferChannelInternal::BufferChannelInternal(const unsigned int size,
 	size_(size),
 	allocatedSize(0),
 	currentWriteBlockID((unsigned int)-1), // FIXME
-	circularHead(-1), previousCircularHead(-1)
+	circularHead(-1), previousCircularHead(-1),
+	loadedSource(0),
+	loadState(NotLoading)
 {
 	ugen_assert(size > 0);
 	ugen_assert(sourceDataSize > 0);
@@ -125,7 +131,9 @@ BufferChannelInternal::BufferChannelInternal(const unsigned int size, const doub
 :	size_(size),
 	allocatedSize(size),
 	currentWriteBlockID((unsigned int)-1), //FIXME
-	circularHead(-1), previousCircularHead(-1)
+	circularHead(-1), previousCircularHead(-1),
+	loadedSource(0),
+	loadState(NotLoading)
 {
 	ugen_assert(size >= 2);
 	
@@ -151,6 +159,9 @@ BufferChannelInternal::~BufferChannelInternal() throw()
 	if(allocatedSize > 0)
 		delete [] data;
 	
+	if(loadedSource != 0)
+		loadedSource->decrementRefCount();
+	
 	data = 0;
 	size_= 0;
 	allocatedSize = 0;
@@ -456,7 +467,7 @@ Buffer::Buffer(String const& audioFilePath, double* sampleRate, int* bits, MetaD
 		double currentSampleRate = UGen::getSampleRate();
 		
 		if((fileSampleRate != 0.0) && (fileSampleRate != currentSampleRate))
-			operator= (changeSampleRate(fileSampleRate, currentSampleRate));		
+			operator= (changeSampleRate(fileSampleRate, currentSampleRate, Resampler::Default, Resampler::getMultiThreadedByDefault()));		
 	}
 	else
 	{
@@ -477,7 +488,7 @@ Buffer::Buffer(const char *audioFilePath, int *bits, double* sampleRate, MetaDat
 		double currentSampleRate = UGen::getSampleRate();
 		
 		if((fileSampleRate != 0.0) && (fileSampleRate != currentSampleRate))
-			operator= (changeSampleRate(fileSampleRate, currentSampleRate));
+			operator= (changeSampleRate(fileSampleRate, currentSampleRate, Resampler::Default, Resampler::getMultiThreadedByDefault()));
 	}
 	else
 	{
@@ -498,7 +509,7 @@ Buffer::Buffer(Text const& audioFilePath, int *bits, double* sampleRate, MetaDat
 		double currentSampleRate = UGen::getSampleRate();
 		
 		if((fileSampleRate != 0.0) && (fileSampleRate != currentSampleRate))
-			operator= (changeSampleRate(fileSampleRate, currentSampleRate));			
+			operator= (changeSampleRate(fileSampleRate, currentSampleRate, Resampler::Default, Resampler::getMultiThreadedByDefault()));			
 	}
 	else
 	{
@@ -519,7 +530,7 @@ Buffer::Buffer(const File& audioFile, double* sampleRate, int *bits, MetaData* m
 		if((fileSampleRate != 0.0) && (fileSampleRate != currentSampleRate))
 		{
 			ugen_assert(metaData == 0); // meta data markers will be incorrect at the new sample rate
-			operator= (changeSampleRate(fileSampleRate, currentSampleRate));		
+			operator= (changeSampleRate(fileSampleRate, currentSampleRate, Resampler::Default, Resampler::getMultiThreadedByDefault()));		
 		}
 	}
 	else
@@ -717,7 +728,7 @@ Buffer::Buffer(const char *audioFilePath, int *bits, double* sampleRate, MetaDat
 		double currentSampleRate = UGen::getSampleRate();
 		
 		if((fileSampleRate != 0.0) && (fileSampleRate != currentSampleRate))
-			operator= (changeSampleRate(fileSampleRate, currentSampleRate));
+			operator= (changeSampleRate(fileSampleRate, currentSampleRate, Resampler::Default, Resampler::getMultiThreadedByDefault()));
 	}
 	else
 	{
@@ -735,7 +746,7 @@ Buffer::Buffer(Text const& audioFilePath, int *bits, double* sampleRate, MetaDat
 		if((fileSampleRate != 0.0) && (fileSampleRate != currentSampleRate))
 		{
 			ugen_assert(metaData == 0); // meta data markers will be incorrect at the new sample rate
-			operator= (changeSampleRate(fileSampleRate, currentSampleRate));			
+			operator= (changeSampleRate(fileSampleRate, currentSampleRate, Resampler::Default, Resampler::getMultiThreadedByDefault()));			
 		}
 	}
 	else
@@ -2459,17 +2470,73 @@ Buffer Buffer::resample(const int newSize) const throw()
 	}
 }
 
-Buffer Buffer::changeSampleRate(const double oldSampleRate, const double newSampleRateIn) const throw()
+Buffer Buffer::resample(const int newSize, const Resampler::Quality quality, const bool multiThreaded) const throw()
+{
+	ugen_assert(newSize > 0);
+	
+	if(size_ == 0 || size_ == newSize)
+	{
+		return *this;
+	}
+	else
+	{
+		Buffer newBuffer = Buffer::withSize(newSize, numChannels_, false);
+		
+		const float** inputs = new const float*[numChannels_];
+		float** outputs = new float*[numChannels_];
+		
+		for(int channel = 0; channel < numChannels_; channel++)
+		{
+			inputs[channel] = channels[channel]->data;
+			outputs[channel] = newBuffer.channels[channel]->data;
+		}
+		
+		Resampler resampler(size_, newSize, quality);
+		resampler.process(inputs, size_, outputs, newSize, numChannels_, multiThreaded);
+		
+		delete [] inputs;
+		delete [] outputs;
+		
+		return newBuffer;
+	}
+}
+
+Buffer Buffer::changeSampleRate(const double oldSampleRate, 
+								const double newSampleRateIn, 
+								const Resampler::Quality quality,
+								const bool multiThreaded) const throw()
 {
 	const double newSampleRate = newSampleRateIn == 0.0 ? UGen::getSampleRate() : newSampleRateIn;
 	
-	if(oldSampleRate == newSampleRate)
+	if(oldSampleRate == newSampleRate || size_ == 0)
 	{
 		return *this;
 	}
 	else
 	{
-		return resample(size_ * (newSampleRate / oldSampleRate));
+		const int newSize = (int)(size_ * (newSampleRate / oldSampleRate));
+		
+		if(newSize <= 0) 
+			return Buffer();
+		
+		Buffer newBuffer = Buffer::withSize(newSize, numChannels_, false);
+		
+		const float** inputs = new const float*[numChannels_];
+		float** outputs = new float*[numChannels_];
+		
+		for(int channel = 0; channel < numChannels_; channel++)
+		{
+			inputs[channel] = channels[channel]->data;
+			outputs[channel] = newBuffer.channels[channel]->data;
+		}
+		
+		Resampler resampler(oldSampleRate, newSampleRate, quality);
+		resampler.process(inputs, size_, outputs, newSize, numChannels_, multiThreaded);
+		
+		delete [] inputs;
+		delete [] outputs;
+		
+		return newBuffer;
 	}
 }
 
@@ -2722,6 +2789,79 @@ void Buffer::synthAndSend(const int size, UGen const& graph, BufferReceiver* rec
 	receiver->handleBuffer(result, 0.0, bufferID);
 }
 
+Buffer Buffer::loadAsync(Text const& audioFilePath, 
+						 SampleLoadReceiver* receiver, 
+						 const int numChannels, 
+						 const double sampleRate) throw()
+{
+	return SamplePool::getShared().loadAsync(audioFilePath, receiver, numChannels, sampleRate);
+}
+
+ObjectArray<Buffer> Buffer::loadAsync(TextArray const& audioFilePaths, 
+									  SampleLoadReceiver* receiver, 
+									  const int numChannels, 
+									  const double sampleRate) throw()
+{
+	return SamplePool::getShared().loadAsync(audioFilePaths, receiver, numChannels, sampleRate);
+}
+
+Buffer Buffer::createLoading(const int numChannels) throw()
+{
+	ugen_assert(numChannels > 0);
+	
+	Buffer placeholder;
+	placeholder.numChannels_ = numChannels;
+	placeholder.channels = new BufferChannelInternal*[numChannels];
+	
+	for(int channel = 0; channel < numChannels; channel++)
+	{
+		placeholder.channels[channel] = new BufferChannelInternal(0, false);
+		placeholder.channels[channel]->loadState = BufferChannelInternal::Loading;
+	}
+	
+	return placeholder;
+}
+
+void Buffer::finishLoading(Buffer const& loaded) throw()
+{
+	ugen_assert(isLoading());
+	
+	if(loaded.size_ > 0)
+	{
+		for(int channel = 0; channel < numChannels_; channel++)
+		{
+			BufferChannelInternal* source = loaded.channels[channel % loaded.numChannels_];
+			BufferChannelInternal* placeholder = channels[channel];
+			
+			// the placeholder channel keeps the loaded channel alive, released in its destructor 
+			// on whichever thread drops the last copy of the placeholder
+			source->incrementRefCount();
+			placeholder->loadedSource = source;
+			placeholder->data = source->data;
+			placeholder->size_ = loaded.size_;
+		}
+	}
+	
+	// the data must be visible to other threads before they see the new state
+	ugen_memoryBarrier();
+	
+	for(int channel = numChannels_-1; channel >= 0; channel--)
+		channels[channel]->loadState = BufferChannelInternal::Loaded;
+	
+	size_ = channels[0]->size_;
+}
+
+bool Buffer::updateAfterLoading() throw()
+{
+	if((size_ == 0) && (numChannels_ > 0) && (channels[0]->loadState == BufferChannelInternal::Loaded))
+	{
+		ugen_memoryBarrier();
+		size_ = channels[0]->size_;
+	}
+	
+	return size_ > 0;
+}
+
 Buffer Buffer::reciprocalExceptZero() const throw()
 {
 	Buffer newBuffer = Buffer::withSize(size_, numChannels_, false);
@@ -3103,12 +3243,20 @@ ComplexBuffer ComplexBuffer::operator* (ComplexBuffer const& rightOperand) const
 //
 
 
+bool BufferSender::deferredByDefault = false;
+
 BufferSender::BufferSender() throw()
+:	queue(0),
+	maximumSize(0),
+	maximumChannels(0),
+	numSlots(0)
 {
 }
 
 BufferSender::~BufferSender()
 {
+	setDeferred(false);
+	
 	const int size = receivers.size();
 	for(int channel = 0; channel < size; channel++)
 	{
@@ -3137,6 +3285,24 @@ void BufferSender::removeBufferReceiver(BufferReceiver* receiver) throw()
 }
 
 void BufferSender::sendBuffer(Buffer const& buffer, const double value1, const int value2) throw()
+{
+	if(queue != 0)
+		queue->write(buffer, buffer.size(), value1, value2);
+	else
+		deliverBuffer(buffer, value1, value2);
+}
+
+void BufferSender::sendBufferRegion(Buffer const& buffer, const int numSamples, const double value1, const int value2) throw()
+{
+	if(queue != 0)
+		queue->write(buffer, numSamples, value1, value2);
+	else if(numSamples == buffer.size())
+		deliverBuffer(buffer, value1, value2);
+	else
+		deliverBuffer(buffer.getRegion(0, numSamples-1), value1, value2);
+}
+
+void BufferSender::deliverBuffer(Buffer const& buffer, const double value1, const int value2) throw()
 {
 	const int size = receivers.size();
 	for(int channel = 0; channel < size; channel++)
@@ -3145,12 +3311,90 @@ void BufferSender::sendBuffer(Buffer const& buffer, const double value1, const i
 	}
 }
 
+void BufferSender::setMaximumBufferSize(const int maximumSizeToUse, const int maximumChannelsToUse, const int numSlotsToUse) throw()
+{
+	ugen_assert(queue == 0); // should be called before the sender is deferred
+	
+	maximumSize = maximumSizeToUse;
+	maximumChannels = maximumChannelsToUse;
+	numSlots = numSlotsToUse;
+}
+
+void BufferSender::setDeferred(const bool shouldDefer) throw()
+{
+	if(shouldDefer)
+	{
+		if((queue != 0) || (maximumSize < 1)) return;
+		
+		queue = new BufferSenderQueue(maximumSize, maximumChannels, numSlots);
+		BufferDispatcher::retainShared()->add(this);
+	}
+	else if(queue != 0)
+	{
+		BufferDispatcher::getShared().remove(this);
+		BufferDispatcher::releaseShared();
+		delete queue;
+		queue = 0;
+	}
+}
+
+int BufferSender::getNumDropped() const throw()
+{
+	return queue != 0 ? queue->getNumDropped() : 0;
+}
+
+void BufferSender::resetNumDropped() throw()
+{
+	if(queue != 0) queue->resetNumDropped();
+}
+
+int BufferSender::dispatchPendingBuffers() throw()
+{
+	if(queue == 0) return 0;
+	
+	Buffer buffer;
+	double value1;
+	int value2;
+	int numDispatched = 0;
+	
+	while(queue->read(buffer, value1, value2))
+	{
+		deliverBuffer(prepareDeferredBuffer(buffer), value1, value2);
+		numDispatched++;
+	}
+	
+	return numDispatched;
+}
+
+bool BufferSender::readPendingBuffer(Buffer& buffer, double& value1, int& value2) throw()
+{
+	return (queue != 0) && queue->read(buffer, value1, value2);
+}
+
+Buffer BufferSender::preparePendingBuffer(Buffer const& buffer, BufferReceiverArray& receiversToDeliverTo) throw()
+{
+	receiversToDeliverTo = receivers.copy();
+	return prepareDeferredBuffer(buffer);
+}
+
+void BufferSender::setDeferredByDefault(const bool shouldDefer) throw()
+{
+	deferredByDefault = shouldDefer;
+}
+
+bool BufferSender::getDeferredByDefault() throw()
+{
+	return deferredByDefault;
+}
+
 BufferReceiver::BufferReceiver() throw()
 {
 }
 
 BufferReceiver::~BufferReceiver()
 {	
+	BufferDispatcher::removeReceiverFromShared(this);
+	
 	const int size = senders.size();
 	for(int channel = 0; channel < size; channel++)
 	{
@@ -44,6 +44,8 @@
 #include "../envelopes/ugen_EnvCurve.h"
 #include "../core/ugen_Arrays.h"
 #include "../core/ugen_Text.h"
+#include "ugen_Resampler.h"
+#include "ugen_Interpolation.h"
 
 class CuePointInternal : public SmartPointer
 {
@@ -307,12 +309,16 @@ public:
 	friend class TapOutUGenInternal;
 	
 private:
+	enum LoadState { NotLoading, Loading, Loaded };
+	
 	float* data;
 	unsigned int size_;
 	unsigned int allocatedSize;
 	unsigned int currentWriteBlockID;
 	int circularHead; // -1 means it is not a crcular buffer
 	int previousCircularHead;
+	BufferChannelInternal* loadedSource; // the channel sharing its data with a placeholder from Buffer::loadAsync()
+	volatile int loadState;
 	
 	BufferChannelInternal (const BufferChannelInternal&);
     const BufferChannelInternal& operator= (const BufferChannelInternal&);
@@ -342,6 +348,7 @@ class Value;
 class ValueArray;
 class UGen;
 class BufferReceiver;
+class SampleLoadReceiver;
 
 /**
  Buffer stores one or more arrays of floats.
@@ -603,6 +610,51 @@ public:
 			   int bitDepth = 24,
 			   MetaData const& metaData = MetaData()) throw();
 	
+	/** Start loading an audio file on the worker threads of SamplePool::getShared() and return at once.
+	 This returns a placeholder Buffer with no samples which fills in when the file has loaded, 
+	 PlayBuf plays it as silence until then. Other copies of the placeholder (e.g., yours) have
+	 the loaded samples after calling updateAfterLoading().
+	 @param audioFilePath	The path of the audio file.
+	 @param receiver		An optional SampleLoadReceiver to tell when the file has loaded.
+	 @param numChannels		The number of channels of the placeholder, the file's channels are
+							wrapped or dropped to fit.
+	 @param sampleRate		The sample rate to convert to, 0 uses UGen::getSampleRate().
+	 @see SamplePool::loadAsync() */
+	static Buffer loadAsync(Text const& audioFilePath, 
+							SampleLoadReceiver* receiver = 0, 
+							const int numChannels = 1, 
+							const double sampleRate = 0.0) throw();
+	
+	/** Start loading several audio files, the receiver is sent the progress after each file. 
+	 @see loadAsync() */
+	static ObjectArray<Buffer> loadAsync(TextArray const& audioFilePaths, 
+										 SampleLoadReceiver* receiver = 0, 
+										 const int numChannels = 1, 
+										 const double sampleRate = 0.0) throw();
+	
+	/** Returns true if this is a placeholder from loadAsync() whose file has not finished loading. */
+	inline bool isLoading() const throw()
+	{ 
+		return (numChannels_ > 0) && (channels[0]->loadState == BufferChannelInternal::Loading); 
+	}
+	
+	/** Give a placeholder from loadAsync() the loaded samples once its file has finished loading.
+	 This doesn't allocate memory so it can be called on the audio thread.
+	 @return	true if the Buffer has samples. */
+	bool updateAfterLoading() throw();
+	
+	/** @internal Create a placeholder for loadAsync(). 
+	 The loader's copy of the placeholder must be made on the requesting thread before the placeholder 
+	 is handed to another thread, after that the copies may be released on any thread since the 
+	 reference counts are atomic. */
+	static Buffer createLoading(const int numChannels) throw();
+	
+	/** @internal Fill a placeholder from loadAsync() with the loaded samples (sharing their data). 
+	 Pass an empty Buffer if the file failed to load. This is called on the loading thread while 
+	 other copies of the placeholder may be in use on other threads so it only changes the shared 
+	 channels and their load state. */
+	void finishLoading(Buffer const& loaded) throw();
+	
 #if defined(JUCE_VERSION) || defined(DOXYGEN)
 	/** Constuct a Buffer from a Juce AudioSampleBuffer. 
 	 Here there's an option to copy the data or just use the data from the AudioSampleBuffer directly. In the
@@ -805,6 +857,18 @@ public:
 	
 	inline int allocatedSize() const throw()											{ return channels[0]->allocatedSize; }
 	
+	/** Return the largest number of references to the data of any of this Buffer's channels.
+	 i.e., 1 if no other Buffer is sharing this Buffer's data (or 0 if the Buffer is empty). */
+	inline int getRefCount() const throw()
+	{
+		int refCount = 0;
+		
+		for(int i = 0; i < numChannels_; i++)
+			refCount = ugen::max(refCount, channels[i]->getRefCount());
+		
+		return refCount;
+	}
+	
 	/** Set all samples in all channels to zero. */
 	inline void clear() throw()
 	{
@@ -1089,8 +1153,26 @@ public:
 					EnvCurve const& fadeInShape  = EnvCurve::Linear, 
 					EnvCurve const& fadeOutShape = EnvCurve::Linear) const throw();
 	
+	/** Create a new Buffer resized to @c newSize using linear interpolation.
+	 The first and last samples of the original are mapped to the first and last samples
+	 of the new Buffer which is generally what is needed for tables and windows. */
 	Buffer resample(const int newSize) const throw();
-	Buffer changeSampleRate(const double oldSampleRate, const double newSampleRate = 0.0) const throw();
+	
+	/** Create a new Buffer resized to @c newSize using a band-limited Resampler.
+	 @param newSize			The new size in samples.
+	 @param quality			The Resampler quality.
+	 @param multiThreaded	If true each channel is resampled on its own thread (Juce only). */
+	Buffer resample(const int newSize, const Resampler::Quality quality, const bool multiThreaded = false) const throw();
+	
+	/** Create a new Buffer converted from one sample rate to another.
+	 @param oldSampleRate	The sample rate of the data in this Buffer.
+	 @param newSampleRate	The required sample rate, 0 uses UGen::getSampleRate().
+	 @param quality			The Resampler quality.
+	 @param multiThreaded	If true each channel is resampled on its own thread (Juce only). */
+	Buffer changeSampleRate(const double oldSampleRate, 
+							const double newSampleRate = 0.0, 
+							const Resampler::Quality quality = Resampler::Default,
+							const bool multiThreaded = false) const throw();
 	
 	Buffer reverse() const throw();
 	Buffer mix() const throw();
@@ -1327,6 +1409,7 @@ protected:
 
 class BufferReceiver;
 class BufferSender;
+class BufferSenderQueue;
 typedef ObjectArray<BufferReceiver*> BufferReceiverArray;
 typedef ObjectArray<BufferSender*> BufferSenderArray;
 
@@ -1334,7 +1417,11 @@ typedef ObjectArray<BufferSender*> BufferSenderArray;
 /** Subclasses of this collect samples into a Buffer and transmit it to BufferReceiver objects.
  This mechanism is used by the ScopeGUI class and the Sender UGen to display time-domain sample data.
  The FFTSender UGen collects buffers and sends FFT-transformed buffers (e.g., to a ScopeGUI) for
- dealing with spectral data. But they can be used for other purposes too. */
+ dealing with spectral data. But they can be used for other purposes too. 
+ 
+ By default the receivers are called from sendBuffer() i.e., usually on the audio thread. If the
+ sender is deferred (see setDeferred()) sendBuffer() just copies the Buffer into preallocated 
+ storage and the shared BufferDispatcher calls the receivers on another thread. */
 class BufferSender
 {
 public:
@@ -1345,11 +1432,59 @@ public:
 	void removeBufferReceiver(BufferReceiver* receiver) throw();
 	void sendBuffer(Buffer const& buffer, const double value1 = 0.0, const int value2 = 0) throw();
 	
+	/** Send only the first @c numSamples samples of a Buffer. 
+	 When deferred this avoids making a new Buffer on the audio thread. */
+	void sendBufferRegion(Buffer const& buffer, const int numSamples, const double value1 = 0.0, const int value2 = 0) throw();
+	
+	/** Set whether the Buffer objects should be delivered to the receivers by BufferDispatcher::getShared().
+	 This allocates the storage so it should not be called while the sender is being processed. 
+	 It has no effect unless the subclass has called setMaximumBufferSize(). */
+	void setDeferred(const bool shouldDefer) throw();
+	inline bool isDeferred() const throw() { return queue != 0; }
+	
+	/** The number of Buffer objects dropped because the receivers were not keeping up (deferred senders only). */
+	int getNumDropped() const throw();
+	void resetNumDropped() throw();
+	
+	/** Deliver any Buffer objects waiting in a deferred sender, returns the number delivered. */
+	int dispatchPendingBuffers() throw();
+	
+	/** Take the next Buffer waiting in a deferred sender without delivering it, returns false if there are none. 
+	 This is called by the BufferDispatcher which then prepares the Buffer with preparePendingBuffer(). */
+	bool readPendingBuffer(Buffer& buffer, double& value1, int& value2) throw();
+	
+	/** Prepare a Buffer taken with readPendingBuffer() (see prepareDeferredBuffer()) and copy the 
+	 receivers it should be delivered to, the BufferDispatcher then delivers it without using the sender. */
+	Buffer preparePendingBuffer(Buffer const& buffer, BufferReceiverArray& receiversToDeliverTo) throw();
+	
+	/** Set whether new senders are deferred, this is false by default. */
+	static void setDeferredByDefault(const bool shouldDefer) throw();
+	static bool getDeferredByDefault() throw();
+	
 protected:
 	BufferReceiverArray receivers;
+	
+	/** Set the largest Buffer that will be sent, this is needed before the sender can be deferred. */
+	void setMaximumBufferSize(const int maximumSize, const int maximumChannels, const int numSlots = 4) throw();
+	
+	/** Called on the dispatcher's thread with each Buffer from a deferred sender before it is delivered.
+	 Subclasses can use this to move expensive work away from the audio thread, those which do
+	 should call setDeferred(false) in their destructor. */
+	virtual Buffer prepareDeferredBuffer(Buffer const& buffer) throw() { return buffer; }
+	
+private:
+	void deliverBuffer(Buffer const& buffer, const double value1, const int value2) throw();
+	
+	BufferSenderQueue* queue;
+	int maximumSize, maximumChannels, numSlots;
+	static bool deferredByDefault;
 };
 
-/** Subclasses of this receive Buffer objects from BufferSender objects. */
+/** Subclasses of this receive Buffer objects from BufferSender objects. 
+ Receivers of deferred senders have handleBuffer() called on the BufferDispatcher's thread, the 
+ destructor removes the receiver from the dispatcher but subclasses which may be deleted while the 
+ dispatcher is running should call BufferDispatcher::removeReceiverFromShared() in their own 
+ destructor so handleBuffer() isn't called while they are being deleted. */
 class BufferReceiver
 {
 public:
@@ -0,0 +1,404 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_BufferDispatcher.h"
+
+BufferSenderQueue::BufferSenderQueue(const int maximumSizeToUse, const int maximumChannelsToUse, const int numSlotsToUse) throw()
+:	maximumSize(maximumSizeToUse < 1 ? 1 : maximumSizeToUse),
+	maximumChannels(maximumChannelsToUse < 1 ? 1 : maximumChannelsToUse),
+	numSlots(numSlotsToUse < 2 ? 2 : numSlotsToUse),
+	slots(new Buffer[numSlots]),
+	pending(numSlots),
+	freeSlots(numSlots),
+	numDropped(0)
+{
+	for(int slot = 0; slot < numSlots; slot++)
+	{
+		slots[slot] = Buffer::newClear(maximumSize, maximumChannels, true);
+		freeSlots.write(slot);
+	}
+}
+
+BufferSenderQueue::~BufferSenderQueue()
+{
+	delete [] slots;
+}
+
+bool BufferSenderQueue::write(Buffer const& buffer, const int numSamples, const double value1, const int value2) throw()
+{
+	const int numChannels = buffer.getNumChannels();
+	int slot;
+	
+	if((numSamples < 1) || (numChannels < 1))
+		return false;
+	
+	if((numSamples > maximumSize) || (numChannels > maximumChannels) || !freeSlots.read(slot))
+	{
+		numDropped++;
+		return false;
+	}
+	
+	Buffer& slotBuffer = slots[slot];
+	
+	for(int channel = 0; channel < numChannels; channel++)
+	{
+		memcpy(slotBuffer.getData(channel), buffer.getData(channel), numSamples * sizeof(float));
+	}
+	
+	BufferSenderMessage message;
+	message.slot = slot;
+	message.size = numSamples;
+	message.numChannels = numChannels;
+	message.value1 = value1;
+	message.value2 = value2;
+	
+	pending.write(message); // there are only numSlots slots so this can't be full
+	return true;
+}
+
+bool BufferSenderQueue::read(Buffer& buffer, double& value1, int& value2) throw()
+{
+	BufferSenderMessage message;
+	
+	if(!pending.read(message))
+		return false;
+	
+	Buffer const& slotBuffer = slots[message.slot];
+	
+	if((message.size == maximumSize) && (message.numChannels == maximumChannels))
+		buffer = slotBuffer.copy();
+	else
+		buffer = slotBuffer.getRegion(0, message.size-1, 0, message.numChannels-1);
+	
+	value1 = message.value1;
+	value2 = message.value2;
+	
+	freeSlots.write(message.slot);
+	return true;
+}
+
+BufferDispatcher* BufferDispatcher::shared = 0;
+int BufferDispatcher::sharedRefCount = 0;
+static volatile int hasOwnReference = 0;
+static AtomicSpinLock sharedLock;
+
+#if defined(UGEN_JUCE)
+/** Polls a BufferDispatcher until it is asked to stop. */
+class BufferDispatcherThread : public Thread
+{
+public:
+	BufferDispatcherThread(BufferDispatcher& dispatcherToUse) throw()
+	:	Thread("BufferDispatcher"),
+		dispatcher(dispatcherToUse)
+	{
+	}
+	
+	void run()
+	{
+		while(!threadShouldExit())
+		{
+			dispatcher.dispatchPendingBuffers();
+			wait(dispatcher.getInterval());
+		}
+	}
+	
+private:
+	BufferDispatcher& dispatcher;
+};
+#endif
+
+BufferDispatcher::BufferDispatcher(const int intervalMsToUse) throw()
+:	lock(0),
+	delivering(0),
+	deliveryReceivers(0),
+	numDeliveryReceivers(0),
+	deliveringTo(0),
+	intervalMs(intervalMsToUse < 1 ? 1 : intervalMsToUse)
+{
+#if defined(UGEN_JUCE)
+	thread = new BufferDispatcherThread(*this);
+	thread->startThread();
+#endif
+}
+
+BufferDispatcher::~BufferDispatcher()
+{
+#if defined(UGEN_JUCE)
+	thread->signalThreadShouldExit();
+	thread->notify();
+	thread->stopThread(4000);
+	delete thread;
+#endif
+	
+	ugen_assert(senders.size() == 0); // senders should have been deleted first
+}
+
+void BufferDispatcher::enterLock() throw()
+{
+	while(!ugen_atomicCompareAndSet(lock, 0, 1))
+	{
+#if defined(UGEN_JUCE)
+		Thread::yield();
+#endif
+	}
+	
+	ugen_memoryBarrier();
+}
+
+void BufferDispatcher::exitLock() throw()
+{
+	ugen_memoryBarrier();
+	lock = 0;
+}
+
+void BufferDispatcher::add(BufferSender* sender) throw()
+{
+	if(sender == 0) { ugen_assertfalse; return; }
+	
+	enterLock();
+	
+	if(!senders.contains(sender))
+		senders.add(sender);
+	
+	exitLock();
+}
+
+void BufferDispatcher::remove(BufferSender* sender) throw()
+{
+	if(sender == 0) { ugen_assertfalse; return; }
+	
+	enterLock();
+	senders.removeItem(sender);
+	exitLock();
+	
+	// wait if a Buffer from this sender is being prepared (this is never held while calling the receivers)
+	while(delivering == sender)
+	{
+#if defined(UGEN_JUCE)
+		Thread::yield();
+#endif
+	}
+	
+	ugen_memoryBarrier();
+}
+
+void BufferDispatcher::removeReceiver(BufferReceiver* receiver) throw()
+{
+	if(receiver == 0) { ugen_assertfalse; return; }
+	
+	receiverLock.enter();
+	
+	for(int i = 0; i < numDeliveryReceivers; i++)
+	{
+		if(deliveryReceivers[i] == receiver)
+			deliveryReceivers[i] = 0;
+	}
+	
+	receiverLock.exit();
+	
+	// wait if this receiver's handleBuffer() is being called
+	while(deliveringTo == receiver)
+	{
+#if defined(UGEN_JUCE)
+		Thread::yield();
+#endif
+	}
+	
+	ugen_memoryBarrier();
+}
+
+int BufferDispatcher::dispatchPendingBuffers() throw()
+{
+	// take the waiting Buffer objects under the lock...
+	BufferDispatcherMessageArray messages;
+	BufferDispatcherMessage message;
+	
+	enterLock();
+	
+	const int size = senders.size();
+	for(int i = 0; i < size; i++)
+	{
+		message.sender = senders[i];
+		
+		while(message.sender->readPendingBuffer(message.buffer, message.value1, message.value2))
+			messages.add(message);
+	}
+	
+	exitLock();
+	
+	// ...and prepare them after releasing it, skipping any senders removed in the meantime
+	const int numMessages = messages.size();
+	int numDispatched = 0;
+	
+	for(int i = 0; i < numMessages; i++)
+	{
+		BufferDispatcherMessage const& pending = messages[i];
+		
+		enterLock();
+		
+		if(!senders.contains(pending.sender))
+		{
+			exitLock();
+			continue;
+		}
+		
+		delivering = pending.sender;
+		exitLock();
+		
+		BufferReceiverArray receivers;
+		const Buffer buffer = pending.sender->preparePendingBuffer(pending.buffer, receivers);
+		
+		ugen_memoryBarrier();
+		delivering = 0;
+		
+		// the sender may be deleted from here on, the receivers are called without using it and
+		// any receiver deleted in the meantime is cleared from the array by removeReceiver()
+		receiverLock.enter();
+		deliveryReceivers = receivers.getArray();
+		numDeliveryReceivers = receivers.size();
+		receiverLock.exit();
+		
+		for(int j = 0; j < receivers.size(); j++)
+		{
+			receiverLock.enter();
+			BufferReceiver* const receiver = deliveryReceivers[j];
+			deliveringTo = receiver;
+			receiverLock.exit();
+			
+			if(receiver != 0)
+				receiver->handleBuffer(buffer, pending.value1, pending.value2);
+			
+			ugen_memoryBarrier();
+			deliveringTo = 0;
+		}
+		
+		receiverLock.enter();
+		deliveryReceivers = 0;
+		numDeliveryReceivers = 0;
+		receiverLock.exit();
+		
+		numDispatched++;
+	}
+	
+	return numDispatched;
+}
+
+BufferDispatcher* BufferDispatcher::retainShared() throw()
+{
+	const ScopedAtomicSpinLock sl(sharedLock);
+	
+	if(shared == 0)
+	{
+		BufferDispatcher* const dispatcher = new BufferDispatcher();
+		ugen_memoryBarrier(); // the dispatcher must be complete before other threads can see it
+		shared = dispatcher;
+	}
+	
+	sharedRefCount++;
+	
+	return shared;
+}
+
+void BufferDispatcher::releaseShared() throw()
+{
+	BufferDispatcher* dispatcher = 0;
+	
+	{
+		const ScopedAtomicSpinLock sl(sharedLock);
+		
+		ugen_assert(sharedRefCount > 0);
+		
+		if(--sharedRefCount == 0)
+		{
+			dispatcher = shared;
+			shared = 0;
+		}
+	}
+	
+	delete dispatcher; // stopping the thread may take a while so this is done outside the lock
+}
+
+void BufferDispatcher::createShared() throw()
+{
+	// UGen++ holds one reference itself between UGen::initialise() and UGen::shutdown()
+	if(ugen_atomicCompareAndSet(hasOwnReference, 0, 1))
+		retainShared();
+}
+
+BufferDispatcher& BufferDispatcher::getShared() throw()
+{
+	if(shared == 0)
+	{
+		ugen_assertfalse; // UGen::initialise() should have created the dispatcher
+		createShared();
+	}
+	
+	return *shared;
+}
+
+void BufferDispatcher::deleteShared() throw()
+{
+	if(ugen_atomicCompareAndSet(hasOwnReference, 1, 0))
+		releaseShared();
+}
+
+void BufferDispatcher::removeReceiverFromShared(BufferReceiver* receiver) throw()
+{
+	BufferDispatcher* dispatcher;
+	
+	{
+		// hold a reference (without creating the dispatcher) so it isn't deleted while waiting
+		const ScopedAtomicSpinLock sl(sharedLock);
+		
+		dispatcher = shared;
+		
+		if(dispatcher == 0)
+			return;
+		
+		sharedRefCount++;
+	}
+	
+	dispatcher->removeReceiver(receiver);
+	releaseShared();
+}
+
+END_UGEN_NAMESPACE
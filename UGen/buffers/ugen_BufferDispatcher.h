@@ -0,0 +1,190 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_BufferDispatcher_H_
+#define _UGEN_ugen_BufferDispatcher_H_
+
+#include "ugen_Buffer.h"
+#include "../core/ugen_LockFreeFifo.h"
+
+/** @internal A Buffer taken from a BufferSender waiting to be delivered by a BufferDispatcher. */
+struct BufferDispatcherMessage
+{
+	BufferSender* sender;
+	Buffer buffer;
+	double value1;
+	int value2;
+};
+
+typedef ObjectArray<BufferDispatcherMessage> BufferDispatcherMessageArray;
+
+/** @internal A Buffer waiting in a BufferSenderQueue. */
+struct BufferSenderMessage
+{
+	int slot;
+	int size;
+	int numChannels;
+	double value1;
+	int value2;
+};
+
+/** Passes Buffer objects from a BufferSender on the audio thread to a BufferDispatcher.
+ 
+ All the slots are allocated at construction time. The audio thread copies each Buffer into 
+ a free slot and posts the slot through a LockFreeFifo, the dispatcher takes a copy of the slot 
+ and hands the slot back through another LockFreeFifo. If the receivers are too slow to keep 
+ up there will be no free slots and the Buffer is dropped (and counted). Buffer objects which 
+ are too long or have too many channels for the slots are dropped too.
+ @see BufferSender::setDeferred() */
+class BufferSenderQueue
+{
+public:
+	BufferSenderQueue(const int maximumSize, const int maximumChannels, const int numSlots) throw();
+	~BufferSenderQueue();
+	
+	/** Copy the first @c numSamples of a Buffer into a free slot, this must only be called from the audio thread. */
+	bool write(Buffer const& buffer, const int numSamples, const double value1, const int value2) throw();
+	
+	/** Get a copy of the next Buffer, this must only be called from the dispatcher thread. */
+	bool read(Buffer& buffer, double& value1, int& value2) throw();
+	
+	inline int getMaximumSize() const throw()		{ return maximumSize;		}
+	inline int getMaximumChannels() const throw()	{ return maximumChannels;	}
+	inline int getNumDropped() const throw()		{ return numDropped;		}
+	inline void resetNumDropped() throw()			{ numDropped = 0;			}
+	
+private:
+	const int maximumSize, maximumChannels, numSlots;
+	Buffer* slots;
+	LockFreeFifo<BufferSenderMessage> pending;
+	LockFreeFifo<int> freeSlots;
+	volatile int numDropped;
+	
+	BufferSenderQueue (const BufferSenderQueue&);
+    const BufferSenderQueue& operator= (const BufferSenderQueue&);
+};
+
+class BufferDispatcherThread;
+
+/** Delivers the Buffer objects from deferred BufferSender objects to their BufferReceiver objects.
+ 
+ This allows scopes, analysers and so on to do their work away from the audio thread. In Juce 
+ builds the dispatcher polls its senders on its own thread. Elsewhere the host should call 
+ dispatchPendingBuffers() regularly from a thread of its choosing (e.g., from a timer), the 
+ receivers' handleBuffer() functions will be called on that thread.
+ 
+ Senders are added and removed under a spin lock. The dispatcher holds this only while taking the 
+ waiting Buffer objects from the senders. Each Buffer is then prepared by its sender (see 
+ BufferSender::preparePendingBuffer()), which also copies the sender's receivers, and finally passed
+ to these receivers after the dispatcher has finished with the sender. So adding or removing a 
+ sender (e.g., from the audio thread) never waits for the receivers: removing a sender only waits 
+ if the dispatcher is preparing a Buffer from that sender at the time, so a sender is never deleted 
+ while the dispatcher is using it. A BufferReceiver removes itself from the dispatcher when it is 
+ deleted, this waits (on the thread deleting the receiver) if its handleBuffer() is being called.
+ 
+ The shared dispatcher is created by UGen::initialise(), each deferred sender holds a reference 
+ to it so it is kept until the last of these is deleted even after UGen::shutdown().
+ @see BufferSender::setDeferred() */
+class BufferDispatcher
+{
+public:
+	/** Create a dispatcher which checks for new Buffer objects every @c intervalMs milliseconds. */
+	BufferDispatcher(const int intervalMs = 10) throw();
+	~BufferDispatcher();
+	
+	void add(BufferSender* sender) throw();
+	void remove(BufferSender* sender) throw();
+	
+	/** Stop delivering Buffer objects to a receiver which is being deleted.
+	 This waits if the receiver's handleBuffer() is being called by the dispatcher. */
+	void removeReceiver(BufferReceiver* receiver) throw();
+	
+	/** Deliver all the waiting Buffer objects, returns the number delivered. */
+	int dispatchPendingBuffers() throw();
+	
+	inline int getInterval() const throw() { return intervalMs; }
+	
+	/** Get a dispatcher shared by the whole application. 
+	 The dispatcher is created by UGen::initialise(). This doesn't add a reference so the result 
+	 must not be kept, use retainShared() for that. */
+	static BufferDispatcher& getShared() throw();
+	
+	/** Get the shared dispatcher and add a reference to it, this keeps it alive (even after 
+	 UGen::shutdown()) until the reference is removed with releaseShared(). */
+	static BufferDispatcher* retainShared() throw();
+	
+	/** Remove a reference added by retainShared(), the dispatcher is stopped and deleted with its last reference. */
+	static void releaseShared() throw();
+	
+	/** Create the shared dispatcher if it doesn't exist yet and add UGen++'s own reference to it (if 
+	 it doesn't already hold it), this is called by UGen::initialise(). */
+	static void createShared() throw();
+	
+	/** Remove the reference added by createShared(), this is called by UGen::shutdown(). The
+	 dispatcher is stopped and deleted unless a deferred BufferSender still has a reference. */
+	static void deleteShared() throw();
+	
+	/** Call removeReceiver() on the shared dispatcher if it exists, this is called by the BufferReceiver destructor. */
+	static void removeReceiverFromShared(BufferReceiver* receiver) throw();
+	
+private:
+	void enterLock() throw();
+	void exitLock() throw();
+	
+	BufferSenderArray senders;
+	volatile int lock;
+	BufferSender* volatile delivering;
+	AtomicSpinLock receiverLock;
+	BufferReceiver** volatile deliveryReceivers;
+	volatile int numDeliveryReceivers;
+	BufferReceiver* volatile deliveringTo;
+	const int intervalMs;
+	
+#if defined(UGEN_JUCE)
+	BufferDispatcherThread* thread;
+#endif
+	
+	static BufferDispatcher* shared;
+	static int sharedRefCount;
+	
+	BufferDispatcher (const BufferDispatcher&);
+    const BufferDispatcher& operator= (const BufferDispatcher&);
+};
+
+
+#endif // _UGEN_ugen_BufferDispatcher_H_
@@ -0,0 +1,375 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_CompressedBuffer.h"
+
+CompressedBufferInternal::CompressedBufferInternal(Buffer const& source, const int blockSizeToUse) throw()
+:	numChannels(source.getNumChannels()),
+	size(source.size()),
+	blockSize(ugen::max(1, blockSizeToUse)),
+	numBlocks((size + blockSize - 1) / blockSize),
+	samples(numChannels > 0 ? new short*[numChannels] : 0),
+	scales(numChannels > 0 ? new float*[numChannels] : 0)
+{
+	for(int channel = 0; channel < numChannels; channel++)
+	{
+		const float* sourceSamples = source.getData(channel);
+		short* outputSamples = samples[channel] = new short[size];
+		float* blockScales = scales[channel] = new float[numBlocks];
+		
+		for(int block = 0; block < numBlocks; block++)
+		{
+			const int numSamples = ugen::min(blockSize, size - block * blockSize);
+			
+			float peak = 0.f;
+			for(int i = 0; i < numSamples; i++)
+				peak = ugen::max(peak, (float)fabs(sourceSamples[i]));
+			
+			// the smallest power of two at or above the peak maps to the full 16-bit range
+			int exponent = 0;
+			if(peak > 0.f)
+			{
+				const float mantissa = frexpf(peak, &exponent);
+				if(mantissa == 0.5f) exponent--;
+			}
+			
+			const float scale = ldexpf(1.f, exponent - 15);
+			const float factor = 1.f / scale;
+			blockScales[block] = scale;
+			
+			for(int i = 0; i < numSamples; i++)
+			{
+				const float value = floorf(sourceSamples[i] * factor + 0.5f);
+				*outputSamples++ = (short)ugen::clip(value, -32768.f, 32767.f);
+			}
+			
+			sourceSamples += numSamples;
+		}
+	}
+}
+
+CompressedBufferInternal::~CompressedBufferInternal() throw()
+{
+	for(int channel = 0; channel < numChannels; channel++)
+	{
+		delete [] samples[channel];
+		delete [] scales[channel];
+	}
+	
+	delete [] samples;
+	delete [] scales;
+}
+
+CompressedBuffer::CompressedBuffer() throw()
+:	SmartPointerContainer<CompressedBufferInternal>(new CompressedBufferInternal(Buffer(), 1))
+{
+}
+
+CompressedBuffer::CompressedBuffer(Buffer const& source, const int blockSize) throw()
+:	SmartPointerContainer<CompressedBufferInternal>(new CompressedBufferInternal(source, blockSize))
+{
+}
+
+int CompressedBuffer::getNumBytes() const throw()
+{
+	const CompressedBufferInternal* internal = getInternal();
+	return internal->numChannels * (internal->size * (int)sizeof(short) + internal->numBlocks * (int)sizeof(float));
+}
+
+void CompressedBuffer::decode(const int channel, const int startSample, const int numSamples, float* destination) const throw()
+{
+	ugen_assert(channel >= 0 && channel < getNumChannels());
+	ugen_assert(numSamples >= 0);
+	
+	const CompressedBufferInternal* internal = getInternal();
+	const int size = internal->size;
+	const int blockSize = internal->blockSize;
+	
+	int index = startSample;
+	int numSamplesToProcess = numSamples;
+	
+	// before the start
+	while((numSamplesToProcess > 0) && (index < 0))
+	{
+		*destination++ = 0.f;
+		index++;
+		numSamplesToProcess--;
+	}
+	
+	const short* inputSamples = internal->samples[channel] + index;
+	const float* blockScales = internal->scales[channel];
+	
+	while((numSamplesToProcess > 0) && (index < size))
+	{
+		const int block = index / blockSize;
+		const int numBlockSamples = ugen::min(numSamplesToProcess, ugen::min((block + 1) * blockSize, size) - index);
+		const float scale = blockScales[block];
+		
+		for(int i = 0; i < numBlockSamples; i++)
+			*destination++ = scale * (float)*inputSamples++;
+		
+		index += numBlockSamples;
+		numSamplesToProcess -= numBlockSamples;
+	}
+	
+	// after the end
+	if(numSamplesToProcess > 0)
+		memset(destination, 0, numSamplesToProcess * sizeof(float));
+}
+
+float CompressedBuffer::getSample(const int channel, const int index) const throw()
+{
+	ugen_assert(channel >= 0 && channel < getNumChannels());
+	
+	const CompressedBufferInternal* internal = getInternal();
+	
+	if((index < 0) || (index >= internal->size))
+		return 0.f;
+	
+	return internal->scales[channel][index / internal->blockSize] * (float)internal->samples[channel][index];
+}
+
+Buffer CompressedBuffer::decompress() const throw()
+{
+	if(size() == 0)
+		return Buffer();
+	
+	Buffer buffer = Buffer::withSize(size(), getNumChannels(), false);
+	
+	for(int channel = 0; channel < getNumChannels(); channel++)
+		decode(channel, 0, size(), buffer.getData(channel));
+	
+	return buffer;
+}
+
+CompressedPlayBufUGenInternal::CompressedPlayBufUGenInternal(CompressedBuffer const& buffer, 
+															 UGen const& rate, 
+															 UGen const& trig, 
+															 UGen const& offset, 
+															 UGen const& loop, 
+															 const UGen::DoneAction doneAction,
+															 const Interpolation::Mode interpolation) throw()
+:	ProxyOwnerUGenInternal(NumInputs, buffer.getNumChannels() - 1),
+	buffer_(buffer),
+	bufferPos(0.0),
+	lastTrig(0.f),
+	doneAction_(doneAction),
+	shouldDeleteValue(doneAction_ == UGen::DeleteWhenDone),
+	interpolation_(interpolation),
+	pointsBefore(Interpolation::getNumPointsBefore(interpolation)),
+	scratchSize(pointsBefore + buffer.getBlockSize() + Interpolation::getNumPointsAfter(interpolation)),
+	scratch(new float[scratchSize * buffer.getNumChannels()]),
+	outputData(new float*[buffer.getNumChannels()]),
+	currentBlock(-1)
+{
+	inputs[Rate] = rate;
+	inputs[Trig] = trig;
+	inputs[Offset] = offset;
+	inputs[Loop] = loop;
+	
+	if(interpolation_ == Interpolation::Sinc)
+		Interpolation::initialise();
+}
+
+CompressedPlayBufUGenInternal::~CompressedPlayBufUGenInternal()
+{
+	delete [] scratch;
+	delete [] outputData;
+}
+
+void CompressedPlayBufUGenInternal::prepareForBlock(const int /*actualBlockSize*/, const unsigned int /*blockID*/, const int /*channel*/) throw()
+{
+	if(isDone()) sendDoneInternal();
+}
+
+void CompressedPlayBufUGenInternal::decodeBlock(const int block) throw()
+{
+	const int size = buffer_.size();
+	const int start = block * buffer_.getBlockSize() - pointsBefore;
+	
+	for(int channel = 0; channel < getNumChannels(); channel++)
+	{
+		float* channelScratch = scratch + channel * scratchSize;
+		
+		// the points either side of the block wrap around to the other end of the data 
+		// whether looping or not, in common with PlayBuf and Buffer::getSampleUnchecked()
+		int index = start;
+		int numSamplesToProcess = scratchSize;
+		
+		while(numSamplesToProcess > 0)
+		{
+			const int wrappedIndex = ((index % size) + size) % size;
+			const int numSamples = ugen::min(numSamplesToProcess, size - wrappedIndex);
+			buffer_.decode(channel, wrappedIndex, numSamples, channelScratch);
+			channelScratch += numSamples;
+			index += numSamples;
+			numSamplesToProcess -= numSamples;
+		}
+	}
+	
+	currentBlock = block;
+}
+
+void CompressedPlayBufUGenInternal::writeSamples(const int sampleIndex, const double position) throw()
+{
+	const int index = (int)position;
+	const float frac = (float)(position - (double)index);
+	const int blockSize = buffer_.getBlockSize();
+	const int block = index / blockSize;
+	
+	if(block != currentBlock)
+		decodeBlock(block);
+	
+	const int scratchIndex = index - block * blockSize + pointsBefore;
+	
+	for(int channel = 0; channel < getNumChannels(); channel++)
+		outputData[channel][sampleIndex] = Interpolation::lookup(interpolation_, scratch + channel * scratchSize, scratchSize, scratchIndex, frac);
+}
+
+void CompressedPlayBufUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
+{
+	const int blockSize = uGenOutput.getBlockSize();
+	const int bufferSize = buffer_.size();
+	const double lastBufferPosition = bufferSize-1;
+	
+	const float* rateSamples = inputs[Rate].processBlock(shouldDelete, blockID, 0);
+	const float* trigSamples = inputs[Trig].processBlock(shouldDelete, blockID, 0);
+	const float* offsetSamples = inputs[Offset].processBlock(shouldDelete, blockID, 0);
+	const float* loopSamples = inputs[Loop].processBlock(shouldDelete, blockID, 0);
+	
+	for(int channel = 0; channel < getNumChannels(); channel++)
+		outputData[channel] = proxies[channel]->getSampleData();
+	
+	int numSilentSamples = 0;
+	
+	for(int i = 0; i < blockSize; i++)
+	{
+		const float thisTrig = trigSamples[i];
+		
+		if(thisTrig > 0.f && lastTrig <= 0.f)
+			bufferPos = 0.0;
+		
+		lastTrig = thisTrig;
+		
+		double position = offsetSamples[i] + bufferPos;
+		
+		if(loopSamples[i] >= 0.5f)
+		{
+			if(position >= bufferSize)
+				position -= bufferSize;
+			else if(position < 0)
+				position += bufferSize;
+			
+			if((position < 0.0) || ((int)position >= bufferSize))
+			{
+				for(int channel = 0; channel < getNumChannels(); channel++)
+					outputData[channel][i] = 0.f;
+			}
+			else
+			{
+				writeSamples(i, position);
+			}
+			
+			bufferPos += rateSamples[i];
+			
+			if(bufferPos >= bufferSize)
+				bufferPos -= bufferSize;
+			else if(bufferPos < 0)
+				bufferPos += bufferSize;
+		}
+		else
+		{
+			if((position <= 0.0) || (position > lastBufferPosition))
+			{
+				for(int channel = 0; channel < getNumChannels(); channel++)
+					outputData[channel][i] = 0.f;
+				
+				++numSilentSamples;
+			}
+			else
+			{
+				writeSamples(i, position);
+			}
+			
+			bufferPos += rateSamples[i];
+		}
+	}
+	
+	for(int channel = 0; channel < getNumChannels(); channel++)
+		proxies[channel]->getOutputRef().setSilent(numSilentSamples == blockSize);
+	
+	if((bufferPos >= bufferSize) || (bufferPos < 0))
+	{
+		shouldDelete = shouldDelete ? true : shouldDeleteValue;
+		setIsDone();
+	}
+}
+
+CompressedPlayBuf::CompressedPlayBuf(CompressedBuffer const& buffer, 
+									 UGen const& rate, 
+									 UGen const& trig, 
+									 UGen const& offset, 
+									 UGen const& loop, 
+									 const UGen::DoneAction doneAction,
+									 const Interpolation::Mode interpolation) throw()
+{
+	const int numChannels = buffer.getNumChannels();
+	
+	if(numChannels > 0 && buffer.size() > 0)
+	{
+		initInternal(numChannels);
+		
+		UGen offsetChecked = offset.mix();
+		generateFromProxyOwner(new CompressedPlayBufUGenInternal(buffer, 
+																 rate.mix(), 
+																 trig.mix(), 
+																 offsetChecked, 
+																 loop.mix(), 
+																 doneAction,
+																 interpolation));
+		
+		for(int i = 0; i < numChannels; i++)
+			internalUGens[i]->initValue(buffer.getSample(i, (int)offsetChecked.getValue(0)));
+	}
+}
+
+END_UGEN_NAMESPACE
@@ -0,0 +1,180 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_CompressedBuffer_H_
+#define _UGEN_ugen_CompressedBuffer_H_
+
+#include "../core/ugen_UGen.h"
+#include "ugen_Buffer.h"
+#include "ugen_Interpolation.h"
+
+#ifdef Trig
+#undef Trig
+#endif
+
+/** @internal The data of a CompressedBuffer. */
+class CompressedBufferInternal : public SmartPointer
+{
+public:
+	CompressedBufferInternal(Buffer const& source, const int blockSize) throw();
+	~CompressedBufferInternal() throw();
+	
+	friend class CompressedBuffer;
+	
+private:
+	const int numChannels;
+	const int size;
+	const int blockSize;
+	const int numBlocks;
+	short** samples;	// one array of 16-bit samples for each channel
+	float** scales;		// the value of one step of the 16-bit samples for each block of each channel
+	
+	CompressedBufferInternal (const CompressedBufferInternal&);
+    const CompressedBufferInternal& operator= (const CompressedBufferInternal&);
+};
+
+/** Read-only sample data stored as 16-bit integers, half the memory of a Buffer.
+ 
+ The samples are divided into fixed size blocks and each block of each channel is scaled by 
+ a power of two to fit its peak level. This is lossless for data from 16-bit (or lower) audio 
+ files and gives quieter blocks extra resolution. Since the blocks are a fixed size any part 
+ of the data can be found directly, decode() converts a range of samples back to floats.
+ 
+ Use CompressedPlayBuf to play one, this decodes a block at a time into a small scratch area.
+ @see Buffer, CompressedPlayBuf */
+class CompressedBuffer : public SmartPointerContainer<CompressedBufferInternal>
+{
+public:
+	/** Create an empty CompressedBuffer. */
+	CompressedBuffer() throw();
+	
+	/** Compress the data in a Buffer.
+	 @param source		The Buffer to compress.
+	 @param blockSize	The number of samples in each block, these are the units decoded by CompressedPlayBuf. */
+	CompressedBuffer(Buffer const& source, const int blockSize = 1024) throw();
+	
+	inline int getNumChannels() const throw()	{ return getInternal()->numChannels;	}
+	inline int size() const throw()				{ return getInternal()->size;			}
+	inline int getBlockSize() const throw()		{ return getInternal()->blockSize;		}
+	inline int getNumBlocks() const throw()		{ return getInternal()->numBlocks;		}
+	
+	/** Returns the memory (in bytes) used by the compressed data. */
+	int getNumBytes() const throw();
+	
+	/** Decode a range of samples from one channel, samples outside the data are set to 0. */
+	void decode(const int channel, const int startSample, const int numSamples, float* destination) const throw();
+	
+	/** Decode a single sample, 0 outside the data. */
+	float getSample(const int channel, const int index) const throw();
+	
+	/** Decode all the data into a new Buffer. */
+	Buffer decompress() const throw();
+};
+
+
+/** A UGenInternal which plays a CompressedBuffer.
+ 
+ The blocks of the CompressedBuffer are decoded one at a time as the playback position
+ reaches them, along with the few samples either side of the block which the interpolation
+ needs. Playback runs in the same way as PlayBuf, as with PlayBuf the interpolation points
+ either side of the first and last samples wrap around to the other end of the data whether
+ looping or not.
+ 
+ @see CompressedPlayBuf
+ @ingroup UGenInternals */
+class CompressedPlayBufUGenInternal :	public ProxyOwnerUGenInternal,
+										public DoneActionSender
+{
+public:
+	CompressedPlayBufUGenInternal(CompressedBuffer const& buffer, 
+								  UGen const& rate, 
+								  UGen const& trig, 
+								  UGen const& offset, 
+								  UGen const& loop, 
+								  const UGen::DoneAction doneAction,
+								  const Interpolation::Mode interpolation) throw();
+	~CompressedPlayBufUGenInternal();
+	void prepareForBlock(const int actualBlockSize, const unsigned int blockID, const int channel) throw();
+	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
+	enum Inputs { Rate, Trig, Offset, Loop, NumInputs };
+	
+private:
+	void decodeBlock(const int block) throw();
+	void writeSamples(const int sampleIndex, const double position) throw();
+	
+	CompressedBuffer buffer_;
+	double bufferPos;
+	float lastTrig;
+	const UGen::DoneAction doneAction_;
+	const bool shouldDeleteValue;
+	const Interpolation::Mode interpolation_;
+	const int pointsBefore;
+	const int scratchSize;
+	float* const scratch;
+	float** const outputData;
+	int currentBlock;
+};
+
+#define CompressedPlayBuf_Docs	@param buffer	The CompressedBuffer to play, its number of channels determines the		\
+												number of channels of this CompressedPlayBuf.							\
+								@param rate		The rate of playback where 1 is normal speed.							\
+								@param trig		A trigger that will send the playback head back to the offset.			\
+								@param offset	A modulatable offset into the CompressedBuffer in samples.				\
+								@param loop		A loop flag to indicate the data should loop (1) or just play one-shot (0). \
+								@param doneAction If looping is off and the done action is UGen::DeleteWhenDone then this	\
+												  UGen will fire a delete action when playback reaches the end.			\
+								@param interpolation The interpolation mode used when reading between samples.
+
+/** A UGen which plays a CompressedBuffer.
+ 
+ This works like PlayBuf but for sample data stored in half the memory.
+ 
+ @ingroup AllUGens SoundFileUGens
+ @see CompressedPlayBufUGenInternal, PlayBuf */
+UGenSublcassDeclaration(CompressedPlayBuf, (buffer, rate, trig, offset, loop, doneAction, interpolation),
+						(CompressedBuffer const& buffer, 
+						 UGen const& rate = UGen::get1(), 
+						 UGen const& trig = UGen::get0(), 
+						 UGen const& offset = UGen::get0(), 
+						 UGen const& loop = UGen::get0(),
+						 const UGen::DoneAction doneAction = UGen::DeleteWhenDone,
+						 const Interpolation::Mode interpolation = Interpolation::Linear), COMMON_UGEN_DOCS CompressedPlayBuf_Docs);
+
+
+#endif // _UGEN_ugen_CompressedBuffer_H_
@@ -0,0 +1,63 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_Interpolation.h"
+#include "ugen_Resampler.h"
+#include "../core/ugen_AtomicSpinLock.h"
+
+float Interpolation::sincTable[(Interpolation::SincPhases + 1) * Interpolation::SincTaps];
+bool Interpolation::sincTableReady = false;
+
+void Interpolation::initialise() throw()
+{
+	if(sincTableReady) return;
+	
+	// with the cutoff at Nyquist the zero crossings fall on whole sample positions so reads at
+	// these positions return the samples unchanged, in common with the other modes
+	Resampler::createSincTable(sincTable, SincTaps, SincPhases, 1.0, 5.0, SincTaps / 2);
+	
+	ugen_memoryBarrier();
+	sincTableReady = true;
+}
+
+END_UGEN_NAMESPACE
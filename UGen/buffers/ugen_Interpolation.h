@@ -0,0 +1,191 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#ifndef _UGEN_ugen_Interpolation_H_
+#define _UGEN_ugen_Interpolation_H_
+
+#include "../basics/ugen_InlineBinaryOps.h"
+
+/** Interpolated reads from circular arrays of samples.
+ 
+ These are used by UGens which read from a Buffer at fractional positions (e.g., PlayBuf,
+ TapOutL and the DelayL family) and may select one of the modes here. 
+ 
+ All the functions read the value at index+frac where index is a whole sample position 
+ (0...size-1) and frac is in the range 0...1. Points either side of the index are wrapped
+ around the ends of the array, in common with Buffer::getSampleUnchecked().
+ 
+ - Linear uses the two points index and index+1.
+ - Cubic uses 4-point, 3rd-order Hermite interpolation on the points index-1...index+2.
+ - Sinc uses an 8 tap Kaiser-windowed sinc kernel on the points index-3...index+4. 
+   The kernel is stored as a table of SincPhases filter phases (built by initialise()) 
+   and neighbouring phases are linearly interpolated.
+ 
+ @see Resampler */
+class Interpolation
+{
+public:
+	/** Interpolation modes. */
+	enum Mode
+	{
+		Linear,		///< Linear interpolation between neighbouring samples (fastest)
+		Cubic,		///< 4-point Hermite interpolation
+		Sinc,		///< 8-point windowed sinc interpolation (best)
+		NumModes
+	};
+	
+	enum Constants
+	{
+		SincTaps = 8,
+		SincPhases = 256
+	};
+	
+	/** Build the sinc kernel table. 
+	 This should be called before any Sinc reads are made, UGens which use Sinc mode call 
+	 this from their constructors. */
+	static void initialise() throw();
+	
+	/** Get the number of points before the index needed by a mode. */
+	static inline int getNumPointsBefore(const Mode mode) throw()
+	{
+		return mode == Sinc ? SincTaps / 2 - 1 : mode == Cubic ? 1 : 0;
+	}
+	
+	/** Get the number of points after the index needed by a mode. */
+	static inline int getNumPointsAfter(const Mode mode) throw()
+	{
+		return mode == Sinc ? SincTaps / 2 : mode == Cubic ? 2 : 1;
+	}
+	
+	static inline float linear(const float* samples, const int size, const int index, const float frac) throw()
+	{
+		const float value0 = samples[index];
+		const float value1 = samples[index + 1 < size ? index + 1 : 0];
+		return value0 + frac * (value1 - value0);
+	}
+	
+	static inline float cubic(const float* samples, const int size, const int index, const float frac) throw()
+	{
+		float ym1, y0, y1, y2;
+		
+		if(index >= 1 && index + 2 < size)
+		{
+			const float* points = samples + index;
+			ym1 = points[-1];
+			y0 = points[0];
+			y1 = points[1];
+			y2 = points[2];
+		}
+		else
+		{
+			ym1 = samples[wrap(index - 1, size)];
+			y0 = samples[index];
+			y1 = samples[wrap(index + 1, size)];
+			y2 = samples[wrap(index + 2, size)];
+		}
+		
+		// 4-point, 3rd-order Hermite (x-form)
+		const float c1 = 0.5f * (y1 - ym1);
+		const float c2 = ym1 - 2.5f * y0 + 2.f * y1 - 0.5f * y2;
+		const float c3 = 0.5f * (y2 - ym1) + 1.5f * (y0 - y1);
+		
+		return ((c3 * frac + c2) * frac + c1) * frac + y0;
+	}
+	
+	static inline float sinc(const float* samples, const int size, const int index, const float frac) throw()
+	{
+		const float phasePosition = frac * (float)SincPhases;
+		const int phase = ugen::min((int)phasePosition, SincPhases - 1); // frac may round up to 1
+		const float phaseFrac = phasePosition - (float)phase;
+		const int first = index - (SincTaps / 2 - 1);
+		
+		if(first >= 0 && first + SincTaps <= size)
+			return sincDotProduct(samples + first, phase, phaseFrac);
+		
+		float points[SincTaps];
+		
+		for(int tap = 0; tap < SincTaps; tap++)
+			points[tap] = samples[wrap(first + tap, size)];
+		
+		return sincDotProduct(points, phase, phaseFrac);
+	}
+	
+	/** Read with a particular interpolation mode. */
+	static inline float lookup(const Mode mode, const float* samples, const int size, const int index, const float frac) throw()
+	{
+		switch(mode)
+		{
+			case Cubic:	return cubic(samples, size, index, frac);
+			case Sinc:	return sinc(samples, size, index, frac);
+			default:	return linear(samples, size, index, frac);
+		}
+	}
+	
+private:
+	static inline int wrap(int index, const int size) throw()
+	{
+		index %= size;
+		return index < 0 ? index + size : index;
+	}
+	
+	static inline float sincDotProduct(const float* points, const int phase, const float phaseFrac) throw()
+	{
+		// interpolate the two neighbouring phases to get the kernel, then apply it
+		const float* coeffs0 = sincTable + phase * SincTaps;
+		const float* coeffs1 = coeffs0 + SincTaps;
+		float sum0 = 0.f, sum1 = 0.f, sum2 = 0.f, sum3 = 0.f;
+		
+		for(int tap = 0; tap < SincTaps; tap += 4)
+		{
+			sum0 += points[tap]   * (coeffs0[tap]   + phaseFrac * (coeffs1[tap]   - coeffs0[tap]));
+			sum1 += points[tap+1] * (coeffs0[tap+1] + phaseFrac * (coeffs1[tap+1] - coeffs0[tap+1]));
+			sum2 += points[tap+2] * (coeffs0[tap+2] + phaseFrac * (coeffs1[tap+2] - coeffs0[tap+2]));
+			sum3 += points[tap+3] * (coeffs0[tap+3] + phaseFrac * (coeffs1[tap+3] - coeffs0[tap+3]));
+		}
+		
+		return (sum0 + sum1) + (sum2 + sum3);
+	}
+	
+	static float sincTable[(SincPhases + 1) * SincTaps];
+	static bool sincTableReady;
+	
+	Interpolation();
+};
+
+#endif // _UGEN_ugen_Interpolation_H_
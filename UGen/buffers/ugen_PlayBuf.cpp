@@ -82,7 +82,8 @@ PlayBufUGenInternal::PlayBufUGenInternal(Buffer const& buffer,
 										 UGen const& offset, 
 										 UGen const& loop, 
 										 const UGen::DoneAction doneAction,
-										 MetaData const& metaDataToUse) throw()
+										 MetaData const& metaDataToUse,
+										 const Interpolation::Mode interpolation) throw()
 :	ProxyOwnerUGenInternal(NumInputs, buffer.getNumChannels() - 1),
 	buffer_(buffer),
 	bufferPos(0.0),
@@ -90,17 +91,28 @@ PlayBufUGenInternal::PlayBufUGenInternal(Buffer const& buffer,
 	doneAction_(doneAction),
 	shouldDeleteValue(doneAction_ == UGen::DeleteWhenDone),
 	metaData(metaDataToUse),
-	prevPosArray(buffer_.getNumChannels() > 1 ? DoubleArray::series(buffer_.getNumChannels(), -1.0, 0.0) : DoubleArray(-1)) // fill with -1
+	prevPosArray(buffer_.getNumChannels() > 1 ? DoubleArray::series(buffer_.getNumChannels(), -1.0, 0.0) : DoubleArray(-1)), // fill with -1
+	outputData(new float*[buffer_.getNumChannels()]),
+	channelData(new const float*[buffer_.getNumChannels()]),
+	interpolation_(interpolation)
 {
 	inputs[Rate] = rate;
 	inputs[Trig] = trig;
 	inputs[Offset] = offset;
 	inputs[Loop] = loop;	
+	
+	for(int channel = 0; channel < buffer_.getNumChannels(); channel++)
+		channelData[channel] = buffer_.getData(channel);
+	
+	if(interpolation_ == Interpolation::Sinc)
+		Interpolation::initialise();
 }
 
 PlayBufUGenInternal::~PlayBufUGenInternal()
 {
 //	printf("PlayBufUGenInternal deleted %p\n", this);
+	delete [] outputData;
+	delete [] channelData;
 }
 
 // don't do this? no need?
@@ -112,7 +124,8 @@ UGenInternal* PlayBufUGenInternal::getChannel(const int channel) throw()
 															inputs[Offset], 
 															inputs[Loop], 
 															doneAction_,
-															metaData);
+															metaData,
+															interpolation_);
 	internal->bufferPos = bufferPos;
 	internal->lastTrig = lastTrig;
 	return internal;
@@ -127,6 +140,240 @@ void PlayBufUGenInternal::prepareForBlock(const int /*actualBlockSize*/, const u
 }
 
 void PlayBufUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
+{	
+	if(buffer_.isLoading())
+	{
+		// a placeholder from Buffer::loadAsync() plays silence until the file has loaded
+		const int blockSize = uGenOutput.getBlockSize();
+		
+		for(int channel = 0; channel < getNumChannels(); channel++)
+			memset(proxies[channel]->getSampleData(), 0, blockSize * sizeof(float));
+		
+		return;
+	}
+	
+	if((buffer_.size() == 0) && buffer_.updateAfterLoading())
+	{
+		for(int channel = 0; channel < buffer_.getNumChannels(); channel++)
+			channelData[channel] = buffer_.getData(channel);
+	}
+	
+	if(metaData.getNumCuePoints() > 0)
+	{
+		processBlockCuePoints(shouldDelete, blockID);
+	}
+	else
+	{
+		const float* rateSamples = inputs[Rate].processBlock(shouldDelete, blockID, 0);
+		const float* trigSamples = inputs[Trig].processBlock(shouldDelete, blockID, 0);
+		const float* offsetSamples = inputs[Offset].processBlock(shouldDelete, blockID, 0);
+		const float* loopSamples = inputs[Loop].processBlock(shouldDelete, blockID, 0);
+		
+		for(int channel = 0; channel < getNumChannels(); channel++)
+			outputData[channel] = proxies[channel]->getSampleData();
+		
+		if(inputs[Trig].isConstant(0))
+		{
+			// a constant trigger can only fire on the first sample
+			if(*trigSamples > 0.f && lastTrig <= 0.f)
+				bufferPos = 0.0;
+			
+			lastTrig = *trigSamples;
+			trigSamples = 0;
+		}
+		
+		const bool loopIsConstant = inputs[Loop].isConstant(0);
+		
+		if(!(trigSamples == 0 && 
+			 loopIsConstant && 
+			 inputs[Rate].isConstant(0) && 
+			 inputs[Offset].isConstant(0) && 
+			 processBlockCopy(*rateSamples, *offsetSamples, *loopSamples >= 0.5f)))
+		{
+			processBlockShared(rateSamples, trigSamples, offsetSamples, loopSamples, loopIsConstant);
+		}
+	}
+	
+	if(bufferPos >= buffer_.size())
+	{
+		shouldDelete = shouldDelete ? true : shouldDeleteValue;
+		setIsDone();
+		sendMetaData(buffer_, metaData, MetaData::ReachedEnd);
+	}
+	else if(bufferPos < 0)
+	{
+		shouldDelete = shouldDelete ? true : shouldDeleteValue;
+		setIsDone();
+		sendMetaData(buffer_, metaData, MetaData::ReachedStart);		
+	}
+}
+
+bool PlayBufUGenInternal::processBlockCopy(const float rate, const float offset, const bool loop) throw()
+{
+	const int blockSize = uGenOutput.getBlockSize();
+	const int bufferSize = buffer_.size();
+	const double position = offset + bufferPos;
+	
+	// only whole sample positions at unit rate can be copied directly
+	if((rate != 1.f) || (position <= -1073741824.0) || (position >= 1073741824.0) || (position != (double)(int)position))
+		return false;
+	
+	int start = (int)position;
+	
+	if(loop)
+	{
+		// the position should only need wrapping once per sample
+		if((bufferPos < 0.0) || (bufferPos >= bufferSize) || (offset <= -bufferSize) || (offset >= bufferSize))
+			return false;
+		
+		if(start >= bufferSize)
+			start -= bufferSize;
+		else if(start < 0)
+			start += bufferSize;
+		
+		int numSamplesDone = 0;
+		
+		while(numSamplesDone < blockSize)
+		{
+			const int numSamplesThisTime = ugen::min(blockSize - numSamplesDone, bufferSize - start);
+			
+			for(int channel = 0; channel < getNumChannels(); channel++)
+				memcpy(outputData[channel] + numSamplesDone, channelData[channel] + start, numSamplesThisTime * sizeof(float));
+			
+			numSamplesDone += numSamplesThisTime;
+			start = 0;
+		}
+		
+		int numLoops = 0;
+		bufferPos += blockSize;
+		
+		while(bufferPos >= bufferSize)
+		{
+			bufferPos -= bufferSize;
+			numLoops++;
+		}
+		
+		for(int channel = 0; channel < getNumChannels(); channel++)
+			proxies[channel]->getOutputRef().setSilent(false);
+		
+		sendLoopMetaData(numLoops);
+	}
+	else
+	{
+		// the first sample of the Buffer is treated as out of range in one-shot mode
+		const int first = ugen::min(ugen::max(1 - start, 0), blockSize);
+		const int end = ugen::min(ugen::max(bufferSize - start, first), blockSize);
+		
+		for(int channel = 0; channel < getNumChannels(); channel++)
+		{
+			float* outputSamples = outputData[channel];
+			
+			memset(outputSamples, 0, first * sizeof(float));
+			if(end > first)
+				memcpy(outputSamples + first, channelData[channel] + start + first, (end - first) * sizeof(float));
+			
+			memset(outputSamples + end, 0, (blockSize - end) * sizeof(float));
+			
+			proxies[channel]->getOutputRef().setSilent(first == end);
+		}
+		
+		bufferPos += blockSize;
+	}
+	
+	return true;
+}
+
+void PlayBufUGenInternal::processBlockShared(const float* rateSamples, 
+											 const float* trigSamples, 
+											 const float* offsetSamples, 
+											 const float* loopSamples, 
+											 const bool loopIsConstant) throw()
+{
+	const int blockSize = uGenOutput.getBlockSize();
+	const int bufferSize = buffer_.size();
+	const double lastBufferPosition = bufferSize-1;
+	const bool constantLoop = *loopSamples >= 0.5f;
+	
+	int numSilentSamples = 0;
+	int numLoops = 0;
+	
+	for(int i = 0; i < blockSize; i++)
+	{
+		if(trigSamples != 0)
+		{
+			const float thisTrig = trigSamples[i];
+			
+			if(thisTrig > 0.f && lastTrig <= 0.f)
+				bufferPos = 0.0;
+			
+			lastTrig = thisTrig;
+		}
+		
+		double position = offsetSamples[i] + bufferPos;
+		
+		if(loopIsConstant ? constantLoop : (loopSamples[i] >= 0.5f))
+		{
+			if(position >= bufferSize)
+				position -= bufferSize;
+			else if(position < 0)
+				position += bufferSize;
+			
+			if((position < 0.0) || ((int)position >= bufferSize))
+				writeZeros(i);
+			else
+				writeSamples(i, position);
+			
+			bufferPos += rateSamples[i];
+			
+			if(bufferPos >= bufferSize)
+			{
+				bufferPos -= bufferSize;
+				numLoops++;
+			}
+			else if(bufferPos < 0)
+			{
+				bufferPos += bufferSize;
+				numLoops++;
+			}
+		}
+		else
+		{
+			if((position <= 0.0) || (position > lastBufferPosition))
+			{
+				writeZeros(i);
+				++numSilentSamples;
+			}
+			else
+			{
+				writeSamples(i, position);
+			}
+			
+			bufferPos += rateSamples[i];
+		}
+	}
+	
+	// out of range (e.g., stopped after reaching the end without looping) for the whole block
+	for(int channel = 0; channel < getNumChannels(); channel++)
+		proxies[channel]->getOutputRef().setSilent(numSilentSamples == blockSize);
+	
+	sendLoopMetaData(numLoops);
+}
+
+void PlayBufUGenInternal::sendLoopMetaData(const int numLoops) throw()
+{
+	if(numLoops == 0) return;
+	
+	for(int channel = 0; channel < getNumChannels(); channel++)
+	{
+		for(int i = 0; i < numLoops; i++)
+		{
+			sendMetaData(buffer_, metaData, MetaData::ReachedEnd, channel);
+			sendMetaData(buffer_, metaData, MetaData::ReachedStart, channel);
+		}
+	}
+}
+
+void PlayBufUGenInternal::processBlockCuePoints(bool& shouldDelete, const unsigned int blockID) throw()
 {	
 	const int numCuesPoints = metaData.getNumCuePoints();
 
@@ -147,6 +394,7 @@ void PlayBufUGenInternal::processBlock(bool& shouldDelete, const unsigned int bl
 		float* loopSamples = inputs[Loop].processBlock(shouldDelete, blockID, 0);
 						
 		double prevPos = prevPosArray[channel];
+		int numSilentSamples = 0;
 		
 		while(numSamplesToProcess) 
 		{				
@@ -169,7 +417,9 @@ void PlayBufUGenInternal::processBlock(bool& shouldDelete, const unsigned int bl
 					position += bufferSize;
 				}
 				
-				*outputSamples++ = buffer_.getSample(channel, position);
+				*outputSamples++ = interpolation_ == Interpolation::Linear ? 
+								   buffer_.getSample(channel, position) : 
+								   readSampleInterpolated(channel, position);
 				channelBufferPos += *rateSamples++;
 			
 				if(channelBufferPos >= bufferSize)
@@ -202,10 +452,13 @@ void PlayBufUGenInternal::processBlock(bool& shouldDelete, const unsigned int bl
 				if((position <= 0.0) || (position > lastBufferPosition))
 				{	
 					*outputSamples++ = 0.0;
+					++numSilentSamples;
 				}
 				else
 				{
-					*outputSamples++ = buffer_.getSampleUnchecked(channel, position);
+					*outputSamples++ = interpolation_ == Interpolation::Linear ? 
+									   buffer_.getSampleUnchecked(channel, position) : 
+									   readSampleInterpolated(channel, position);
 				}
 				
 				channelBufferPos += *rateSamples++;
@@ -216,22 +469,12 @@ void PlayBufUGenInternal::processBlock(bool& shouldDelete, const unsigned int bl
 		}		
 		
 		prevPosArray[channel] = prevPos;
+		
+		// out of range (e.g., stopped after reaching the end without looping) for the whole block
+		proxies[channel]->getOutputRef().setSilent(numSilentSamples == blockSize);
 	}
 	
 	bufferPos = channelBufferPos;
-	
-	if(bufferPos >= buffer_.size())
-	{
-		shouldDelete = shouldDelete ? true : shouldDeleteValue;
-		setIsDone();
-		sendMetaData(buffer_, metaData, MetaData::ReachedEnd);
-	}
-	else if(bufferPos < 0)
-	{
-		shouldDelete = shouldDelete ? true : shouldDeleteValue;
-		setIsDone();
-		sendMetaData(buffer_, metaData, MetaData::ReachedStart);		
-	}
 }
 
 void PlayBufUGenInternal::checkMetaDataCuePoints(const double currentPosition, 
@@ -292,29 +535,35 @@ PlayBuf::PlayBuf(Buffer const& buffer,
 				 UGen const& startPos, 
 				 UGen const& loop, 
 				 const UGen::DoneAction doneAction,
-				 MetaData const& metaData) throw()
+				 MetaData const& metaData,
+				 const Interpolation::Mode interpolation) throw()
 {	
 	// just mix the input ugens, they should be mono
 	// mix() will just return the original UGen if it has only one channel anyway
 	
 	const int numChannels = buffer.getNumChannels();
 	
-	if(numChannels > 0 && buffer.size() > 0)
+	// a placeholder from Buffer::loadAsync() may have loaded since this copy of it was made
+	Buffer bufferChecked = buffer;
+	bufferChecked.updateAfterLoading();
+	
+	if(numChannels > 0 && (bufferChecked.size() > 0 || bufferChecked.isLoading()))
 	{
 		initInternal(numChannels);
 		
 		UGen startPosChecked = startPos.mix();
-		generateFromProxyOwner(new PlayBufUGenInternal(buffer, 
+		generateFromProxyOwner(new PlayBufUGenInternal(bufferChecked, 
 													   rate.mix(), 
 													   trigger.mix(), 
 													   startPosChecked, 
 													   loop.mix(), 
 													   doneAction,
-													   metaData));
+													   metaData,
+													   interpolation));
 
 		for(int i = 0; i < numChannels; i++)
 		{
-			internalUGens[i]->initValue(buffer.getSample(i, startPosChecked.getValue(0)));
+			internalUGens[i]->initValue(bufferChecked.getSample(i, startPosChecked.getValue(0)));
 		}
 	}	
 	else
@@ -41,6 +41,7 @@
 
 #include "../core/ugen_UGen.h"
 #include "ugen_Buffer.h"
+#include "ugen_Interpolation.h"
 
 #ifdef Trig
 #undef Trig
@@ -97,7 +98,8 @@ public:
 						UGen const& offset, 
 						UGen const& loop, 
 						const UGen::DoneAction doneAction,
-						MetaData const& metaData) throw();
+						MetaData const& metaData,
+						const Interpolation::Mode interpolation = Interpolation::Linear) throw();
 	~PlayBufUGenInternal();
 	UGenInternal* getChannel(const int channel) throw();
 	void prepareForBlock(const int actualBlockSize, const unsigned int blockID, const int channel) throw();
@@ -123,6 +125,71 @@ protected:
 	const bool shouldDeleteValue;	
 	MetaData metaData;
 	DoubleArray prevPosArray;
+	float** const outputData;
+	const float** const channelData;
+	const Interpolation::Mode interpolation_;
+	
+private:
+	void processBlockCuePoints(bool& shouldDelete, const unsigned int blockID) throw();
+	bool processBlockCopy(const float rate, const float offset, const bool loop) throw();
+	void processBlockShared(const float* rateSamples, 
+							const float* trigSamples, 
+							const float* offsetSamples, 
+							const float* loopSamples, 
+							const bool loopIsConstant) throw();
+	void sendLoopMetaData(const int numLoops) throw();
+	
+	/** Write interpolated samples from all channels at the same position. */
+	inline void writeSamples(const int sampleIndex, const double position) throw()
+	{
+		if(interpolation_ != Interpolation::Linear)
+		{
+			writeSamplesInterpolated(sampleIndex, position);
+			return;
+		}
+		
+		const float fIndex = (float)position;
+		const int iIndex0 = (int)fIndex;
+		int iIndex1 = iIndex0 + 1;
+		if(iIndex1 >= buffer_.size())
+			iIndex1 = 0;
+		const float frac1 = fIndex - (float)iIndex0;
+		const float frac0 = 1.f - frac1;
+		
+		for(int channel = 0; channel < buffer_.getNumChannels(); channel++)
+		{
+			const float* data = channelData[channel];
+			outputData[channel][sampleIndex] = data[iIndex0] * frac0 + data[iIndex1] * frac1;
+		}
+	}
+	
+	/** Write samples from all channels using the cubic or sinc interpolation mode. */
+	inline void writeSamplesInterpolated(const int sampleIndex, const double position) throw()
+	{
+		const int bufferSize = buffer_.size();
+		const int index = (int)position;
+		const float frac = (float)(position - (double)index);
+		
+		for(int channel = 0; channel < buffer_.getNumChannels(); channel++)
+			outputData[channel][sampleIndex] = Interpolation::lookup(interpolation_, channelData[channel], bufferSize, index, frac);
+	}
+	
+	/** Read a single channel using the cubic or sinc interpolation mode, 
+	 positions outside the Buffer return 0. */
+	inline float readSampleInterpolated(const int channel, const double position) const throw()
+	{
+		if((position < 0.0) || (position >= buffer_.size()))
+			return 0.f;
+		
+		const int index = (int)position;
+		return Interpolation::lookup(interpolation_, channelData[channel], buffer_.size(), index, (float)(position - (double)index));
+	}
+	
+	inline void writeZeros(const int sampleIndex) throw()
+	{
+		for(int channel = 0; channel < buffer_.getNumChannels(); channel++)
+			outputData[channel][sampleIndex] = 0.f;
+	}
 };
 
 #define PlayBuf_Docs	@param buffer	The Buffer to play, this number of channels witll determin the					\
@@ -137,25 +204,31 @@ protected:
 						@param loop		A loop flag to indicate the Buffer should loop (1) or just play one-shot (0).	\
 						@param doneAction If looping is off and the done action is UGen::DeleteWhenDone then this		\
 										  UGen will fire a delete action when playback reaches the end of the Buffer.	\
-						@param metaData An optional collection of metaData associated with the Buffer			
+						@param metaData An optional collection of metaData associated with the Buffer					\
+						@param interpolation The interpolation mode used when reading between samples (i.e., when		\
+										the rate or offset is not a whole number), Interpolation::Cubic or				\
+										Interpolation::Sinc reduce the aliasing and high frequency loss of linear		\
+										interpolation when playing at different pitches.	
 	
 
 /** A UGen which can playback a Buffer.
  
  This should have a number of channels equal to that in the Buffer. 
  All other inputs should be a single channel (and will be mixed to mono 
- if they aren't before use).
+ if they aren't before use). A placeholder Buffer from Buffer::loadAsync()
+ plays silence until its file has loaded.
  
  @ingroup AllUGens SoundFileUGens
  @see PlayBufUGenInternal */
-UGenSublcassDeclaration(PlayBuf, (buffer, rate, trig, offset, loop, doneAction, metaData),
+UGenSublcassDeclaration(PlayBuf, (buffer, rate, trig, offset, loop, doneAction, metaData, interpolation),
 						(Buffer const& buffer, 
 						 UGen const& rate = UGen::get1(), 
 						 UGen const& trig = UGen::get0(), 
 						 UGen const& offset = UGen::get0(), 
 						 UGen const& loop = UGen::get0(),
 						 const UGen::DoneAction doneAction = UGen::DeleteWhenDone,
-						 MetaData const& metaData = MetaData()), COMMON_UGEN_DOCS PlayBuf_Docs);
+						 MetaData const& metaData = MetaData(),
+						 const Interpolation::Mode interpolation = Interpolation::Linear), COMMON_UGEN_DOCS PlayBuf_Docs);
 
 
 
@@ -0,0 +1,405 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_Resampler.h"
+#include "../core/ugen_Constants.h"
+#include "../basics/ugen_InlineBinaryOps.h"
+
+Resampler::Quality Resampler::defaultQuality = Resampler::High;
+bool Resampler::multiThreadedByDefault = false;
+
+static const int resamplerMaxRationalPhases = 1024;
+static const int resamplerInterpolatedPhases = 512;
+
+static inline int resamplerGCD(int a, int b) throw()
+{
+	while(b != 0)
+	{
+		const int t = a % b;
+		a = b;
+		b = t;
+	}
+	
+	return a;
+}
+
+/** Zeroth order modified Bessel function of the first kind (for the Kaiser window). */
+static double resamplerBesselI0(const double x) throw()
+{
+	const double halfX = x * 0.5;
+	double sum = 1.0;
+	double term = 1.0;
+	
+	for(int k = 1; k < 64; k++)
+	{
+		const double factor = halfX / (double)k;
+		term *= factor * factor;
+		sum += term;
+		
+		if(term < sum * 1.0e-12)
+			break;
+	}
+	
+	return sum;
+}
+
+static inline float resamplerDotProduct(const float* a, const float* b, const int size) throw()
+{
+#if defined(UGEN_VDSP)
+	float result;
+	vDSP_dotpr(a, 1, b, 1, &result, size);
+	return result;
+#else
+	// numTaps is always a multiple of 4, four independent sums let the compiler vectorise this
+	float sum0 = 0.f, sum1 = 0.f, sum2 = 0.f, sum3 = 0.f;
+	
+	for(int i = 0; i < size; i += 4)
+	{
+		sum0 += a[i]   * b[i];
+		sum1 += a[i+1] * b[i+1];
+		sum2 += a[i+2] * b[i+2];
+		sum3 += a[i+3] * b[i+3];
+	}
+	
+	return (sum0 + sum1) + (sum2 + sum3);
+#endif
+}
+
+Resampler::Resampler(const int inputSize, const int outputSize, const Quality qualityIn) throw()
+:	quality(qualityIn == Default ? defaultQuality : qualityIn),
+	numTaps(2),
+	numPhases(0),
+	up(0), down(0),
+	step(1.0),
+	table(0)
+{
+	ugen_assert(inputSize > 0);
+	ugen_assert(outputSize > 0);
+	
+	const int divisor = resamplerGCD(outputSize, inputSize);
+	init(outputSize / divisor, inputSize / divisor, (double)outputSize / (double)inputSize);
+}
+
+Resampler::Resampler(const double oldSampleRate, const double newSampleRate, const Quality qualityIn) throw()
+:	quality(qualityIn == Default ? defaultQuality : qualityIn),
+	numTaps(2),
+	numPhases(0),
+	up(0), down(0),
+	step(1.0),
+	table(0)
+{
+	ugen_assert(oldSampleRate > 0.0);
+	ugen_assert(newSampleRate > 0.0);
+	
+	const int oldRate = (int)oldSampleRate;
+	const int newRate = (int)newSampleRate;
+	
+	if(((double)oldRate == oldSampleRate) && ((double)newRate == newSampleRate))
+	{
+		const int divisor = resamplerGCD(newRate, oldRate);
+		init(newRate / divisor, oldRate / divisor, newSampleRate / oldSampleRate);
+	}
+	else
+	{
+		init(0, 0, newSampleRate / oldSampleRate);
+	}
+}
+
+Resampler::~Resampler()
+{
+	delete [] table;
+}
+
+void Resampler::init(const int upFactor, const int downFactor, const double ratio) throw()
+{
+	step = 1.0 / ratio;
+	
+	if(quality <= Linear || quality >= NumQualities)
+	{
+		quality = Linear;
+		return;
+	}
+	
+	static const int zeroCrossingsForQuality[]	= { 0, 8,    16,   32,   64    };
+	static const double betaForQuality[]		= { 0, 5.0,  6.5,  8.6,  10.0  };
+	static const double rolloffForQuality[]		= { 0, 0.85, 0.9,  0.94, 0.97  };
+	
+	const int zeroCrossings = zeroCrossingsForQuality[quality];
+	const double beta = betaForQuality[quality];
+	const double cutoff = rolloffForQuality[quality] * ugen::min(1.0, ratio); // relative to the input Nyquist
+	const double halfWidth = zeroCrossings / cutoff;
+	
+	numTaps = quantiseUp(2 * (int)std::ceil(halfWidth), 4);
+	
+	if((upFactor > 0) && (upFactor <= resamplerMaxRationalPhases))
+	{
+		up = upFactor;
+		down = downFactor;
+		numPhases = up;
+	}
+	else
+	{
+		numPhases = resamplerInterpolatedPhases;
+	}
+	
+	table = new float[(numPhases + 1) * numTaps];
+	createSincTable(table, numTaps, numPhases, cutoff, beta, halfWidth);
+}
+
+void Resampler::createSincTable(float* table, 
+								const int numTaps, 
+								const int numPhases, 
+								const double cutoff, 
+								const double beta, 
+								const double halfWidth) throw()
+{
+	const int numRows = numPhases + 1;
+	const int firstTapOffset = numTaps / 2 - 1;
+	const double windowScale = 1.0 / resamplerBesselI0(beta);
+	
+	for(int row = 0; row < numRows; row++)
+	{
+		const double fraction = (double)row / (double)numPhases;
+		float* coeffs = table + row * numTaps;
+		double sum = 0.0;
+		
+		for(int tap = 0; tap < numTaps; tap++)
+		{
+			const double distance = (double)(tap - firstTapOffset) - fraction;
+			const double windowPosition = distance / halfWidth;
+			double value = 0.0;
+			
+			if(windowPosition > -1.0 && windowPosition < 1.0)
+			{
+				const double x = pi * cutoff * distance;
+				const double sinc = (x == 0.0) ? 1.0 : std::sin(x) / x;
+				const double window = resamplerBesselI0(beta * std::sqrt(1.0 - windowPosition * windowPosition)) * windowScale;
+				value = cutoff * sinc * window;
+			}
+			
+			coeffs[tap] = (float)value;
+			sum += value;
+		}
+		
+		// normalise each phase for unity gain at DC
+		if(sum != 0.0)
+		{
+			const float scale = (float)(1.0 / sum);
+			for(int tap = 0; tap < numTaps; tap++)
+				coeffs[tap] *= scale;
+		}
+	}
+}
+
+void Resampler::processLinear(const float* input, const int inputSize, float* output, const int outputSize) const throw()
+{
+	const int lastIndex = inputSize - 1;
+	
+	for(int i = 0; i < outputSize; i++)
+	{
+		const double position = (double)i * step;
+		const int index0 = (int)position;
+		
+		if(index0 >= lastIndex)
+		{
+			output[i] = index0 == lastIndex ? input[lastIndex] : 0.f;
+		}
+		else
+		{
+			const float frac = (float)(position - (double)index0);
+			const float value0 = input[index0];
+			output[i] = value0 + frac * (input[index0+1] - value0);
+		}
+	}
+}
+
+void Resampler::process(const float* input, const int inputSize, float* output, const int outputSize) const throw()
+{
+	ugen_assert(inputSize > 0);
+	ugen_assert(outputSize >= 0);
+	
+	if(quality == Linear)
+	{
+		processLinear(input, inputSize, output, outputSize);
+		return;
+	}
+	
+	// pad the input with zeros so the inner loop never needs bounds checks
+	const int firstTapOffset = numTaps / 2 - 1;
+	const int lastBase = (int)((double)(outputSize - 1) * step) + 1;
+	const int leftPad = numTaps;
+	const int rightPad = ugen::max(0, lastBase - inputSize) + numTaps * 2;
+	const int paddedSize = leftPad + inputSize + rightPad;
+	
+	float* padded = new float[paddedSize];
+	memset(padded, 0, leftPad * sizeof(float));
+	memcpy(padded + leftPad, input, inputSize * sizeof(float));
+	memset(padded + leftPad + inputSize, 0, rightPad * sizeof(float));
+	
+	const float* start = padded + leftPad - firstTapOffset;
+	
+	if(up > 0)
+	{
+		// exact rational ratio, one filter phase per output phase
+		unsigned int base = 0;
+		int phase = 0;
+		
+		for(int i = 0; i < outputSize; i++)
+		{
+			output[i] = resamplerDotProduct(start + base, table + phase * numTaps, numTaps);
+			
+			phase += down;
+			base += phase / up;
+			phase %= up;
+		}
+	}
+	else
+	{
+		for(int i = 0; i < outputSize; i++)
+		{
+			const double position = (double)i * step;
+			const int base = (int)position;
+			const double phasePosition = (position - (double)base) * numPhases;
+			const int phase = (int)phasePosition;
+			const float frac = (float)(phasePosition - (double)phase);
+			
+			const float* inputSamples = start + base;
+			const float* coeffs = table + phase * numTaps;
+			const float value0 = resamplerDotProduct(inputSamples, coeffs, numTaps);
+			const float value1 = resamplerDotProduct(inputSamples, coeffs + numTaps, numTaps);
+			
+			output[i] = value0 + frac * (value1 - value0);
+		}
+	}
+	
+	delete [] padded;
+}
+
+#if defined(UGEN_JUCE)
+/** Resamples one channel on a separate thread. */
+class ResamplerThread : public Thread
+{
+public:
+	ResamplerThread(Resampler const& resamplerToUse, 
+					const float* inputToUse, const int inputSizeToUse, 
+					float* outputToUse, const int outputSizeToUse) throw()
+	:	Thread("Resampler"),
+		resampler(resamplerToUse),
+		input(inputToUse), inputSize(inputSizeToUse),
+		output(outputToUse), outputSize(outputSizeToUse)
+	{
+	}
+	
+	void run()
+	{
+		resampler.process(input, inputSize, output, outputSize);
+	}
+	
+private:
+	Resampler const& resampler;
+	const float* input;
+	const int inputSize;
+	float* output;
+	const int outputSize;
+};
+#endif
+
+void Resampler::process(const float** inputs, const int inputSize, 
+						float** outputs, const int outputSize, 
+						const int numChannels, 
+						const bool multiThreaded) const throw()
+{
+#if defined(UGEN_JUCE)
+	if(multiThreaded && numChannels > 1 && quality != Linear)
+	{
+		ObjectArray<ResamplerThread*> threads;
+		
+		for(int channel = 1; channel < numChannels; channel++)
+		{
+			ResamplerThread* thread = new ResamplerThread(*this, inputs[channel], inputSize, outputs[channel], outputSize);
+			threads.add(thread);
+			thread->startThread();
+		}
+		
+		// do the first channel on this thread
+		process(inputs[0], inputSize, outputs[0], outputSize);
+		
+		for(int i = 0; i < threads.length(); i++)
+		{
+			threads[i]->waitForThreadToExit(-1);
+			delete threads[i];
+		}
+		
+		return;
+	}
+#else
+	(void)multiThreaded;
+#endif
+	
+	for(int channel = 0; channel < numChannels; channel++)
+	{
+		process(inputs[channel], inputSize, outputs[channel], outputSize);
+	}
+}
+
+void Resampler::setDefaultQuality(const Quality newQuality) throw()
+{
+	ugen_assert(newQuality >= Linear && newQuality < NumQualities);
+	defaultQuality = newQuality;
+}
+
+Resampler::Quality Resampler::getDefaultQuality() throw()
+{
+	return defaultQuality;
+}
+
+void Resampler::setMultiThreadedByDefault(const bool shouldUseThreads) throw()
+{
+	multiThreadedByDefault = shouldUseThreads;
+}
+
+bool Resampler::getMultiThreadedByDefault() throw()
+{
+	return multiThreadedByDefault;
+}
+
+END_UGEN_NAMESPACE
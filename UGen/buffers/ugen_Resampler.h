@@ -0,0 +1,143 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_Resampler_H_
+#define _UGEN_ugen_Resampler_H_
+
+/** Windowed-sinc polyphase sample rate converter.
+ 
+ This holds a table of Kaiser-windowed sinc filter phases designed for a particular
+ conversion ratio. Where the ratio can be expressed as a reasonably small fraction 
+ (e.g., 44.1kHz / 48kHz = 147 / 160) one table row is stored per output phase and no 
+ interpolation between phases is needed. Otherwise a finely spaced table is used and 
+ neighbouring phases are linearly interpolated. When downsampling the filter cutoff is 
+ lowered to the new Nyquist frequency to avoid aliasing.
+ 
+ The inner loop is a contiguous multiply-accumulate over the filter taps (vDSP is used
+ if UGEN_VDSP is defined).
+ 
+ This is used by Buffer::resample() and Buffer::changeSampleRate() (and therefore
+ when audio files are loaded at a sample rate different to UGen::getSampleRate()).
+ 
+ @see Buffer::resample(), Buffer::changeSampleRate() */
+class Resampler
+{
+public:
+	/** Resampling quality settings. 
+	 Higher qualities use more filter taps and a steeper transition band. */
+	enum Quality
+	{
+		Default = -1,	///< Use the quality set by setDefaultQuality()
+		Linear,			///< Linear interpolation (fast, no anti-aliasing)
+		Low,			///< 8 zero crossings each side
+		Medium,			///< 16 zero crossings each side
+		High,			///< 32 zero crossings each side
+		Best,			///< 64 zero crossings each side
+		NumQualities
+	};
+	
+	/** Construct a Resampler for an arbitrary ratio.
+	 @param inputSize	The size of the input data (in samples).
+	 @param outputSize	The size of the output data (in samples).
+	 @param quality		The resampling quality. */
+	Resampler(const int inputSize, const int outputSize, const Quality quality = Default) throw();
+	
+	/** Construct a Resampler for a sample rate conversion.
+	 If both sample rates are whole numbers the exact rational ratio is used. */
+	Resampler(const double oldSampleRate, const double newSampleRate, const Quality quality = Default) throw();
+	
+	~Resampler();
+	
+	/** Get the quality that is actually used by this Resampler. */
+	inline Quality getQuality() const throw()		{ return quality;	}
+	
+	/** Get the number of filter taps for each output sample. */
+	inline int getNumTaps() const throw()			{ return numTaps;	}
+	
+	/** Resample one channel of data. 
+	 Input samples outside the range 0...inputSize-1 are assumed to be zero. */
+	void process(const float* input, const int inputSize, float* output, const int outputSize) const throw();
+	
+	/** Resample several channels of data, optionally using a separate thread for each channel.
+	 Threads are only available in Juce builds, otherwise the channels are processed in turn. */
+	void process(const float** inputs, const int inputSize, 
+				 float** outputs, const int outputSize, 
+				 const int numChannels, 
+				 const bool multiThreaded) const throw();
+	
+	/** Set the quality used when Resampler::Default is requested. */
+	static void setDefaultQuality(const Quality newQuality) throw();
+	static Quality getDefaultQuality() throw();
+	
+	/** Set whether multiple channels should be resampled using multiple threads by default. 
+	 This applies when Buffer objects are loaded from audio files. */
+	static void setMultiThreadedByDefault(const bool shouldUseThreads) throw();
+	static bool getMultiThreadedByDefault() throw();
+	
+	/** Fill a table with (numPhases+1) rows of numTaps Kaiser-windowed sinc coefficients.
+	 Row r is the filter for a fractional position of r/numPhases between taps numTaps/2-1 
+	 and numTaps/2, each row is normalised for unity gain at DC.
+	 @param cutoff		The cutoff frequency relative to the Nyquist frequency.
+	 @param beta		The Kaiser window shape parameter.
+	 @param halfWidth	The half-width of the window in samples. */
+	static void createSincTable(float* table, 
+								const int numTaps, 
+								const int numPhases, 
+								const double cutoff, 
+								const double beta, 
+								const double halfWidth) throw();
+	
+private:
+	void init(const int upFactor, const int downFactor, const double ratio) throw();
+	void processLinear(const float* input, const int inputSize, float* output, const int outputSize) const throw();
+	
+	Quality quality;
+	int numTaps;
+	int numPhases;
+	int up, down;		// > 0 if the exact rational ratio is in use
+	double step;		// input samples per output sample
+	float* table;		// (numPhases+1) rows of numTaps coefficients
+	
+	static Quality defaultQuality;
+	static bool multiThreadedByDefault;
+	
+	Resampler (const Resampler&);
+    const Resampler& operator= (const Resampler&);
+};
+
+#endif // _UGEN_ugen_Resampler_H_
@@ -0,0 +1,671 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#if !defined(UGEN_JUCE)
+	#include <sys/stat.h>
+#endif
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_SamplePool.h"
+#include "../core/ugen_AtomicSpinLock.h"
+#include "../core/ugen_UGen.h"
+
+SamplePoolEntry::SamplePoolEntry(Text const& pathToUse, 
+								 const double modificationTimeToUse, 
+								 const double sampleRateToUse, 
+								 const State stateToUse) throw()
+:	path(pathToUse),
+	modificationTime(modificationTimeToUse),
+	sampleRate(sampleRateToUse),
+	state(stateToUse),
+	lastUsed(0)
+{
+}
+
+bool SamplePoolEntry::matches(const char* otherPath, const double otherModificationTime, const double otherSampleRate) const throw()
+{
+	return (modificationTime == otherModificationTime) && matchesPath(otherPath, otherSampleRate);
+}
+
+bool SamplePoolEntry::matchesPath(const char* otherPath, const double otherSampleRate) const throw()
+{
+	return (sampleRate == otherSampleRate) && (strcmp(path.getArray(), otherPath) == 0);
+}
+
+SamplePoolRequest::SamplePoolRequest(Text const& pathToUse, 
+									 const double sampleRateToUse, 
+									 Buffer const& placeholderToUse, 
+									 SampleLoadReceiver* receiverToUse, 
+									 SamplePoolBatch* batchToUse) throw()
+:	path(pathToUse),
+	sampleRate(sampleRateToUse),
+	placeholder(placeholderToUse),
+	receiver(receiverToUse),
+	batch(batchToUse),
+	notifying(false)
+{
+}
+
+SamplePool* SamplePool::shared = 0;
+
+#if defined(UGEN_JUCE)
+/** Loads the samples queued in a SamplePool until it is asked to stop. */
+class SamplePoolThread : public Thread
+{
+public:
+	SamplePoolThread(SamplePool& poolToUse) throw()
+	:	Thread("SamplePool"),
+		pool(poolToUse)
+	{
+	}
+	
+	void run()
+	{
+		while(!threadShouldExit())
+		{
+			if(!pool.loadNextPendingSample())
+				wait(-1);
+		}
+	}
+	
+private:
+	SamplePool& pool;
+};
+#endif
+
+SamplePool::SamplePool(const double memoryBudgetToUse, const int numThreadsToUse) throw()
+:	lock(0),
+	memoryBudget(memoryBudgetToUse),
+	memoryUsage(0.0),
+	useCount(0)
+{
+	ugen_assert(memoryBudget >= 0.0);
+	ugen_assert(numThreadsToUse >= 0);
+	
+#if defined(UGEN_JUCE)
+	numThreads = numThreadsToUse > 0 ? numThreadsToUse : 0;
+	threads = numThreads > 0 ? new SamplePoolThread*[numThreads] : 0;
+	
+	for(int i = 0; i < numThreads; i++)
+	{
+		threads[i] = new SamplePoolThread(*this);
+		threads[i]->startThread();
+	}
+#else
+	(void)numThreadsToUse;
+#endif
+}
+
+SamplePool::~SamplePool()
+{
+#if defined(UGEN_JUCE)
+	for(int i = 0; i < numThreads; i++)
+	{
+		threads[i]->signalThreadShouldExit();
+		threads[i]->notify();
+	}
+	
+	// a thread may be part way through loading a file
+	for(int i = 0; i < numThreads; i++)
+	{
+		threads[i]->stopThread(-1);
+		delete threads[i];
+	}
+	
+	delete [] threads;
+#endif
+	
+	for(int i = 0; i < requests.size(); i++)
+	{
+		requests[i]->placeholder.finishLoading(Buffer());
+		finishRequest(requests[i]);
+	}
+	
+	for(int i = 0; i < entries.size(); i++)
+		delete entries[i];
+}
+
+void SamplePool::enterLock() throw()
+{
+	while(!ugen_atomicCompareAndSet(lock, 0, 1))
+	{
+#if defined(UGEN_JUCE)
+		Thread::yield();
+#endif
+	}
+	
+	ugen_memoryBarrier();
+}
+
+void SamplePool::exitLock() throw()
+{
+	ugen_memoryBarrier();
+	lock = 0;
+}
+
+double SamplePool::getSampleRate(const double sampleRate) const throw()
+{
+	return sampleRate > 0.0 ? sampleRate : UGen::getSampleRate();
+}
+
+int SamplePool::findEntry(const char* path, const double modificationTime, const double sampleRate) const throw()
+{
+	for(int i = 0; i < entries.size(); i++)
+	{
+		if(entries[i]->matches(path, modificationTime, sampleRate))
+			return i;
+	}
+	
+	return -1;
+}
+
+Buffer SamplePool::get(Text const& path, const double sampleRateIn) throw()
+{
+	const double sampleRate = getSampleRate(sampleRateIn);
+	const double modificationTime = getModificationTime(path);
+	
+	while(true)
+	{
+		SamplePoolEntry* entry = 0;
+		
+		enterLock();
+		
+		const int index = findEntry(path.getArray(), modificationTime, sampleRate);
+		
+		if(index < 0)
+		{
+			removeStaleEntries(path.getArray(), modificationTime, sampleRate);
+			entry = new SamplePoolEntry(path, modificationTime, sampleRate, SamplePoolEntry::Loading);
+			entries.add(entry);
+		}
+		else if(entries[index]->state == SamplePoolEntry::Queued)
+		{
+			// take over loading the sample if it is still waiting in the queue
+			entry = entries[index];
+			entry->state = SamplePoolEntry::Loading;
+		}
+		else if(entries[index]->state != SamplePoolEntry::Loading)
+		{
+			entries[index]->lastUsed = ++useCount;
+			Buffer buffer = entries[index]->buffer;
+			exitLock();
+			return buffer;
+		}
+		
+		exitLock();
+		
+		if(entry != 0)
+			return loadEntry(entry);
+		
+		// another thread is loading this sample, look again shortly since the entry may 
+		// have been evicted or purged by the time it has finished
+#if defined(UGEN_JUCE)
+		Thread::sleep(1);
+#endif
+	}
+}
+
+Buffer SamplePool::getIfLoaded(Text const& path, const double sampleRateIn) throw()
+{
+	const double sampleRate = getSampleRate(sampleRateIn);
+	const double modificationTime = getModificationTime(path);
+	
+	enterLock();
+	
+	const int index = findEntry(path.getArray(), modificationTime, sampleRate);
+	
+	if((index >= 0) && (entries[index]->state == SamplePoolEntry::Loaded))
+	{
+		SamplePoolEntry* entry = entries[index];
+		entry->lastUsed = ++useCount;
+		Buffer buffer = entry->buffer;
+		exitLock();
+		return buffer;
+	}
+	
+	exitLock();
+	
+	if(index < 0)
+		preload(path, sampleRate);
+	
+	return Buffer();
+}
+
+void SamplePool::preload(Text const& path, const double sampleRateIn) throw()
+{
+	const double sampleRate = getSampleRate(sampleRateIn);
+	const double modificationTime = getModificationTime(path);
+	bool added = false;
+	
+	enterLock();
+	
+	if(findEntry(path.getArray(), modificationTime, sampleRate) < 0)
+	{
+		removeStaleEntries(path.getArray(), modificationTime, sampleRate);
+		entries.add(new SamplePoolEntry(path, modificationTime, sampleRate, SamplePoolEntry::Queued));
+		added = true;
+	}
+	
+	exitLock();
+	
+	if(added)
+		notifyThreads();
+}
+
+Buffer SamplePool::loadAsync(Text const& path, 
+							 SampleLoadReceiver* receiver, 
+							 const int numChannels, 
+							 const double sampleRate) throw()
+{
+	return loadAsync(TextArray(path), receiver, numChannels, sampleRate)[0];
+}
+
+ObjectArray<Buffer> SamplePool::loadAsync(TextArray const& paths, 
+										  SampleLoadReceiver* receiver, 
+										  const int numChannels, 
+										  const double sampleRateIn) throw()
+{
+	const int numPaths = paths.size();
+	const double sampleRate = getSampleRate(sampleRateIn);
+	ObjectArray<Buffer> placeholders;
+	
+	if(numPaths == 0)
+		return placeholders;
+	
+	SamplePoolBatch* batch = new SamplePoolBatch;
+	batch->numRequested = numPaths;
+	batch->numLoaded = 0;
+	batch->numRemaining = numPaths;
+	
+	SamplePoolRequestArray newRequests;
+	
+	for(int i = 0; i < numPaths; i++)
+	{
+		// the request's reference to the placeholder is taken here, before a worker thread can see it
+		Buffer placeholder = Buffer::createLoading(numChannels);
+		placeholders.add(placeholder);
+		newRequests.add(new SamplePoolRequest(paths[i], sampleRate, placeholder, receiver, batch));
+	}
+	
+	enterLock();
+	requests.add(newRequests);
+	exitLock();
+	
+	notifyThreads();
+	
+	return placeholders;
+}
+
+void SamplePool::cancel(SampleLoadReceiver* receiver) throw()
+{
+	if(receiver == 0)
+		return;
+	
+	while(true)
+	{
+		bool notifying = false;
+		
+		enterLock();
+		
+		for(int i = requests.size() - 1; i >= 0; i--)
+		{
+			SamplePoolRequest* request = requests[i];
+			
+			if(request->receiver == receiver)
+			{
+				requests.remove(i);
+				request->placeholder.finishLoading(Buffer());
+				finishRequest(request);
+			}
+		}
+		
+		for(int i = 0; i < activeRequests.size(); i++)
+		{
+			SamplePoolRequest* request = activeRequests[i];
+			
+			if(request->receiver == receiver)
+			{
+				if(request->notifying)
+					notifying = true;
+				else
+					request->receiver = 0;
+			}
+		}
+		
+		exitLock();
+		
+		if(!notifying)
+			return;
+		
+		// the receiver is being called on another thread
+#if defined(UGEN_JUCE)
+		Thread::sleep(1);
+#endif
+	}
+}
+
+bool SamplePool::isLoaded(Text const& path, const double sampleRateIn) throw()
+{
+	const double sampleRate = getSampleRate(sampleRateIn);
+	const double modificationTime = getModificationTime(path);
+	
+	enterLock();
+	const int index = findEntry(path.getArray(), modificationTime, sampleRate);
+	const bool loaded = (index >= 0) && (entries[index]->state == SamplePoolEntry::Loaded);
+	exitLock();
+	
+	return loaded;
+}
+
+int SamplePool::loadPendingSamples() throw()
+{
+	int numLoaded = 0;
+	
+	while(loadNextPendingSample())
+		numLoaded++;
+	
+	return numLoaded;
+}
+
+bool SamplePool::loadNextPendingSample() throw()
+{
+	if(loadNextRequest())
+		return true;
+	
+	SamplePoolEntry* entry = 0;
+	
+	enterLock();
+	
+	for(int i = 0; i < entries.size(); i++)
+	{
+		if(entries[i]->state == SamplePoolEntry::Queued)
+		{
+			entry = entries[i];
+			entry->state = SamplePoolEntry::Loading;
+			break;
+		}
+	}
+	
+	exitLock();
+	
+	if(entry == 0)
+		return false;
+	
+	loadEntry(entry);
+	return true;
+}
+
+bool SamplePool::loadNextRequest() throw()
+{
+	enterLock();
+	
+	if(requests.size() == 0)
+	{
+		exitLock();
+		return false;
+	}
+	
+	SamplePoolRequest* request = requests[0];
+	requests.remove(0);
+	activeRequests.add(request);
+	
+	exitLock();
+	
+	const Buffer buffer = get(request->path, request->sampleRate);
+	request->placeholder.finishLoading(buffer);
+	
+	enterLock();
+	
+	const int numLoaded = ++request->batch->numLoaded;
+	SampleLoadReceiver* receiver = request->receiver;
+	request->notifying = receiver != 0;
+	
+	exitLock();
+	
+	if(receiver != 0)
+	{
+		receiver->handleSampleLoaded(request->path, buffer);
+		receiver->handleSampleLoadProgress(numLoaded, request->batch->numRequested);
+	}
+	
+	enterLock();
+	activeRequests.removeItem(request);
+	finishRequest(request);
+	exitLock();
+	
+	return true;
+}
+
+void SamplePool::finishRequest(SamplePoolRequest* request) throw()
+{
+	// called with the lock held
+	if(--request->batch->numRemaining == 0)
+		delete request->batch;
+	
+	delete request;
+}
+
+int SamplePool::getNumPendingSamples() throw()
+{
+	enterLock();
+	
+	int numPending = requests.size();
+	
+	for(int i = 0; i < entries.size(); i++)
+	{
+		if((entries[i]->state == SamplePoolEntry::Queued) || (entries[i]->state == SamplePoolEntry::Loading))
+			numPending++;
+	}
+	
+	exitLock();
+	
+	return numPending;
+}
+
+Buffer SamplePool::loadEntry(SamplePoolEntry* entry) throw()
+{
+	// the entry is in the Loading state so will not be removed or changed by another thread
+	// until the lock is released below, it must not be used after that
+	Buffer buffer = loadBuffer(entry->path, entry->sampleRate);
+	
+	enterLock();
+	
+	entry->buffer = buffer;
+	entry->state = buffer.size() > 0 ? SamplePoolEntry::Loaded : SamplePoolEntry::Failed;
+	entry->lastUsed = ++useCount;
+	memoryUsage += entry->getNumBytes();
+	evict(); // won't remove this entry since the buffer here shares its data
+	
+	exitLock();
+	
+	return buffer;
+}
+
+void SamplePool::removeEntry(const int index) throw()
+{
+	SamplePoolEntry* entry = entries[index];
+	memoryUsage -= entry->getNumBytes();
+	entries.remove(index);
+	delete entry;
+}
+
+void SamplePool::removeStaleEntries(const char* path, const double modificationTime, const double sampleRate) throw()
+{
+	// earlier versions of a file which has changed, unless they are still being loaded or used
+	for(int i = entries.size() - 1; i >= 0; i--)
+	{
+		SamplePoolEntry* entry = entries[i];
+		
+		if((entry->state != SamplePoolEntry::Loading) &&
+		   (entry->modificationTime != modificationTime) && 
+		   entry->matchesPath(path, sampleRate) &&
+		   (entry->buffer.getRefCount() <= 1))
+		{
+			removeEntry(i);
+		}
+	}
+}
+
+void SamplePool::evict() throw()
+{
+	if(memoryBudget <= 0.0)
+		return;
+	
+	while(memoryUsage > memoryBudget)
+	{
+		int oldestIndex = -1;
+		
+		for(int i = 0; i < entries.size(); i++)
+		{
+			SamplePoolEntry* entry = entries[i];
+			
+			if((entry->state == SamplePoolEntry::Loaded) && 
+			   (entry->buffer.getRefCount() <= 1) &&
+			   ((oldestIndex < 0) || (entry->lastUsed < entries[oldestIndex]->lastUsed)))
+			{
+				oldestIndex = i;
+			}
+		}
+		
+		if(oldestIndex < 0)
+			return; // everything left is in use
+		
+		removeEntry(oldestIndex);
+	}
+}
+
+void SamplePool::setMemoryBudget(const double newMemoryBudget) throw()
+{
+	ugen_assert(newMemoryBudget >= 0.0);
+	
+	enterLock();
+	memoryBudget = newMemoryBudget;
+	evict();
+	exitLock();
+}
+
+int SamplePool::getNumSamples() throw()
+{
+	enterLock();
+	const int numSamples = entries.size();
+	exitLock();
+	
+	return numSamples;
+}
+
+void SamplePool::purge() throw()
+{
+	enterLock();
+	
+	for(int i = entries.size() - 1; i >= 0; i--)
+	{
+		SamplePoolEntry* entry = entries[i];
+		
+		if(((entry->state == SamplePoolEntry::Loaded) && (entry->buffer.getRefCount() <= 1)) || 
+		   (entry->state == SamplePoolEntry::Failed))
+		{
+			removeEntry(i);
+		}
+	}
+	
+	exitLock();
+}
+
+void SamplePool::notifyThreads() throw()
+{
+#if defined(UGEN_JUCE)
+	for(int i = 0; i < numThreads; i++)
+		threads[i]->notify();
+#endif
+}
+
+Buffer SamplePool::loadBuffer(Text const& path, const double sampleRate) throw()
+{
+#if defined(UGEN_JUCE) || defined(UGEN_IPHONE)
+	double fileSampleRate = 0.0;
+	Buffer buffer(path, 0, &fileSampleRate);
+	
+	if((fileSampleRate != 0.0) && (fileSampleRate != sampleRate))
+		buffer = buffer.changeSampleRate(fileSampleRate, sampleRate);
+	
+	return buffer;
+#else
+	// audio files can't be loaded in this build, override loadBuffer() to provide the samples
+	(void)path;
+	(void)sampleRate;
+	ugen_assertfalse;
+	return Buffer();
+#endif
+}
+
+double SamplePool::getModificationTime(Text const& path) throw()
+{
+#if defined(UGEN_JUCE)
+	File file(path.getArray());
+	return file.exists() ? (double)file.getLastModificationTime().toMilliseconds() : 0.0;
+#else
+	struct stat info;
+	return stat(path.getArray(), &info) == 0 ? (double)info.st_mtime : 0.0;
+#endif
+}
+
+SamplePool& SamplePool::getShared() throw()
+{
+	if(shared == 0)
+	{
+#if defined(UGEN_JUCE)
+		shared = new SamplePool(0.0, ugen::max(1, SystemStats::getNumCpus() - 1));
+#else
+		shared = new SamplePool();
+#endif
+	}
+	
+	return *shared;
+}
+
+void SamplePool::deleteShared() throw()
+{
+	delete shared;
+	shared = 0;
+}
+
+END_UGEN_NAMESPACE
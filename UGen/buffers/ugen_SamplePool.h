@@ -0,0 +1,259 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#ifndef _UGEN_ugen_SamplePool_H_
+#define _UGEN_ugen_SamplePool_H_
+
+#include "ugen_Buffer.h"
+#include "../core/ugen_Text.h"
+
+/** @internal One audio file in a SamplePool. */
+class SamplePoolEntry
+{
+public:
+	enum State { Queued, Loading, Loaded, Failed };
+	
+	SamplePoolEntry(Text const& path, const double modificationTime, const double sampleRate, const State state) throw();
+	
+	bool matches(const char* path, const double modificationTime, const double sampleRate) const throw();
+	bool matchesPath(const char* path, const double sampleRate) const throw();
+	inline int getNumBytes() const throw() { return buffer.size() * buffer.getNumChannels() * (int)sizeof(float); }
+	
+	Text path;
+	double modificationTime;
+	double sampleRate;
+	Buffer buffer;
+	State state;
+	unsigned int lastUsed;
+};
+
+typedef ObjectArray<SamplePoolEntry*> SamplePoolEntryArray;
+
+/** Receives the samples loaded by SamplePool::loadAsync() or Buffer::loadAsync().
+ The functions are called on the thread which loaded the sample (a worker thread in Juce builds). */
+class SampleLoadReceiver
+{
+public:
+	virtual ~SampleLoadReceiver() { }
+	
+	/** Called when a sample has finished loading, @c buffer is empty if the file could not be loaded. */
+	virtual void handleSampleLoaded(Text const& path, Buffer const& buffer) = 0;
+	
+	/** Called after each sample of a call to loadAsync() has finished loading (or failed). */
+	virtual void handleSampleLoadProgress(const int /*numLoaded*/, const int /*numRequested*/) { }
+};
+
+/** @internal The progress of one call to SamplePool::loadAsync(). */
+struct SamplePoolBatch
+{
+	int numRequested;
+	int numLoaded;
+	int numRemaining;
+};
+
+/** @internal A placeholder Buffer waiting for SamplePool::loadAsync() to load its sample. */
+class SamplePoolRequest
+{
+public:
+	SamplePoolRequest(Text const& path, 
+					  const double sampleRate, 
+					  Buffer const& placeholder, 
+					  SampleLoadReceiver* receiver, 
+					  SamplePoolBatch* batch) throw();
+	
+	Text path;
+	double sampleRate;
+	Buffer placeholder;
+	SampleLoadReceiver* receiver;
+	SamplePoolBatch* batch;
+	bool notifying;
+};
+
+typedef ObjectArray<SamplePoolRequest*> SamplePoolRequestArray;
+
+class SamplePoolThread;
+
+/** A cache of Buffer objects loaded from audio files which are shared by all their users.
+ 
+ Each audio file is loaded (and converted to the required sample rate) only once however many 
+ voices, Spawn events or plugin instances ask for it. Samples are identified by their path, the 
+ modification time of the file and the sample rate so a file which has changed on disk is loaded 
+ again. The Buffer objects returned share the pool's copy of the sample data and so must be
+ treated as read-only.
+ 
+ Samples may be loaded synchronously with get() or queued with preload() or loadAsync(). In Juce 
+ builds queued samples are loaded by the pool's worker threads. Elsewhere the host should call 
+ loadPendingSamples() from a thread of its choosing.
+ 
+ If a memory budget is set the least recently used samples are removed when the pool goes over 
+ budget, but only those which are not being used elsewhere (i.e., no other Buffer shares their
+ data). The pool may therefore stay over budget until some samples are released.
+ 
+ The pool's list of samples is protected by a spin lock which is never held while a file is 
+ being loaded, the pool must not be used from the audio thread. The Buffer objects returned may 
+ be copied and released on any thread since their reference counts are atomic.
+ @see Buffer */
+class SamplePool
+{
+public:
+	/** Create a pool.
+	 @param memoryBudget	The size (in bytes) of sample data to keep in memory, 0 for no limit.
+	 @param numThreads		The number of worker threads to load queued samples (Juce only). */
+	SamplePool(const double memoryBudget = 0.0, const int numThreads = 1) throw();
+	virtual ~SamplePool();
+	
+	/** Get a sample, loading it on this thread if it is not already in the pool.
+	 If the sample is being loaded by another thread this waits for it to finish.
+	 @param path		The path of the audio file.
+	 @param sampleRate	The sample rate required, 0 uses UGen::getSampleRate().
+	 @return			The sample or an empty Buffer if the file could not be loaded. */
+	Buffer get(Text const& path, const double sampleRate = 0.0) throw();
+	
+	/** Get a sample only if it is already loaded, otherwise queue it for loading and return an empty Buffer. */
+	Buffer getIfLoaded(Text const& path, const double sampleRate = 0.0) throw();
+	
+	/** Queue a sample for loading, this returns immediately. */
+	void preload(Text const& path, const double sampleRate = 0.0) throw();
+	
+	/** Queue a sample for loading and return a placeholder Buffer which is filled in when it has loaded.
+	 PlayBuf plays the placeholder as silence until then.
+	 @param path		The path of the audio file.
+	 @param receiver	An optional SampleLoadReceiver to tell when the sample has loaded.
+	 @param numChannels	The number of channels of the placeholder, the file's channels are
+						wrapped or dropped to fit.
+	 @param sampleRate	The sample rate required, 0 uses UGen::getSampleRate().
+	 @see Buffer::loadAsync(), Buffer::updateAfterLoading() */
+	Buffer loadAsync(Text const& path, 
+					 SampleLoadReceiver* receiver = 0, 
+					 const int numChannels = 1, 
+					 const double sampleRate = 0.0) throw();
+	
+	/** Queue several samples for loading, returning a placeholder for each.
+	 The samples are loaded in parallel if the pool has several threads. The receiver is 
+	 sent the progress after each sample. */
+	ObjectArray<Buffer> loadAsync(TextArray const& paths, 
+								  SampleLoadReceiver* receiver = 0, 
+								  const int numChannels = 1, 
+								  const double sampleRate = 0.0) throw();
+	
+	/** Stop sending loaded samples to a receiver, this must be called before the receiver is deleted.
+	 Samples queued for the receiver which have not started loading are cancelled, their placeholders
+	 are left empty as if the files failed to load. If the receiver is being called on another thread 
+	 this waits for it to return. */
+	void cancel(SampleLoadReceiver* receiver) throw();
+	
+	/** Returns true if a sample is loaded and up to date. */
+	bool isLoaded(Text const& path, const double sampleRate = 0.0) throw();
+	
+	/** Load all the queued samples on this thread, returns the number loaded. 
+	 This is called by the worker threads in Juce builds. */
+	int loadPendingSamples() throw();
+	
+	/** Load the next queued sample on this thread, returns false if there were none. */
+	bool loadNextPendingSample() throw();
+	
+	/** Returns the number of samples queued or being loaded (including those for loadAsync()). */
+	int getNumPendingSamples() throw();
+	
+	/** Set the size (in bytes) of sample data to keep in memory, 0 for no limit. */
+	void setMemoryBudget(const double newMemoryBudget) throw();
+	inline double getMemoryBudget() const throw()	{ return memoryBudget;	}
+	
+	/** Returns the size (in bytes) of the loaded sample data. */
+	inline double getMemoryUsage() const throw()	{ return memoryUsage;	}
+	
+	/** Returns the number of samples in the pool (loaded, queued or failed). */
+	int getNumSamples() throw();
+	
+	/** Remove all the samples which are not being used elsewhere. 
+	 Samples which failed to load are removed too so they will be tried again. */
+	void purge() throw();
+	
+	/** Get a pool shared by the whole application. 
+	 This has no memory budget and (in Juce builds) a worker thread for each processor after the first, 
+	 or one on a single processor machine. */
+	static SamplePool& getShared() throw();
+	
+	/** Stop and delete the shared pool (if it was created).
+	 This should be called when shutting down in Juce applications. */
+	static void deleteShared() throw();
+	
+protected:
+	/** Load an audio file converted to a sample rate. 
+	 Subclasses can override this to load from other sources. This is called without the lock held,
+	 possibly from several threads at once. */
+	virtual Buffer loadBuffer(Text const& path, const double sampleRate) throw();
+	
+	/** Returns the modification time of the file (in any units) or 0 if it does not exist. */
+	virtual double getModificationTime(Text const& path) throw();
+	
+private:
+	void enterLock() throw();
+	void exitLock() throw();
+	
+	double getSampleRate(const double sampleRate) const throw();
+	int findEntry(const char* path, const double modificationTime, const double sampleRate) const throw();
+	void removeStaleEntries(const char* path, const double modificationTime, const double sampleRate) throw();
+	Buffer loadEntry(SamplePoolEntry* entry) throw();
+	bool loadNextRequest() throw();
+	void finishRequest(SamplePoolRequest* request) throw();
+	void removeEntry(const int index) throw();
+	void evict() throw();
+	void notifyThreads() throw();
+	
+	SamplePoolEntryArray entries;
+	SamplePoolRequestArray requests;
+	SamplePoolRequestArray activeRequests;
+	volatile int lock;
+	double memoryBudget;
+	double memoryUsage;
+	unsigned int useCount;
+	
+#if defined(UGEN_JUCE)
+	SamplePoolThread** threads;
+	int numThreads;
+#endif
+	
+	static SamplePool* shared;
+	
+	SamplePool (const SamplePool&);
+    const SamplePool& operator= (const SamplePool&);
+};
+
+#endif // _UGEN_ugen_SamplePool_H_
@@ -46,11 +46,13 @@ BEGIN_UGEN_NAMESPACE
 XFadeLoopSpecInternal::XFadeLoopSpecInternal(Buffer const& sound, 
 											 const int startLoop, 
 											 const int endLoop, 
-											 const float fadeTime)
+											 const float fadeTime,
+											 const Interpolation::Mode interpolation)
 :	numChannels(sound.getNumChannels()),
 	fadeTime_(ugen::max(fadeTime, 0.f)),
 	startLoop_(ugen::clip(startLoop, 0, sound.size())),
 	endLoop_(ugen::clip(endLoop, startLoop_, sound.size())),
+	interpolation_(interpolation),
 	soundOnset(sound),
 	soundLoop(sound.getRegion(startLoop_, endLoop_ + fadeTime_ * UGen::getSampleRate() - 1).loopFade(fadeTime_))	
 {
@@ -59,11 +61,13 @@ XFadeLoopSpecInternal::XFadeLoopSpecInternal(Buffer const& sound,
 XFadeLoopSpec::XFadeLoopSpec(Buffer const& sound, 
 							 const int startLoop, 
 							 const int endLoop, 
-							 const float fadeTime)
+							 const float fadeTime,
+							 const Interpolation::Mode interpolation)
 :	SmartPointerContainer<XFadeLoopSpecInternal>(new XFadeLoopSpecInternal(sound, 
 																		   startLoop, 
 																		   endLoop, 
-																		   fadeTime))
+																		   fadeTime,
+																		   interpolation))
 {
 }
 
@@ -76,10 +80,14 @@ UGen XFadeLoopPlayBufUGenInternal::OnsetLoopXFade::spawnEvent(TrigXFadeUGenInter
 															  const int eventCount, 
 															  void* /*extraArgs*/)
 {
+	const Interpolation::Mode interpolation = getOwner()->interpolation;
+	
 	if(eventCount == 0)
-		return PlayBuf::AR(getOwner()->soundOnset, getOwner()->inputs[XFadeLoopPlayBufUGenInternal::Rate], 0, 0, 0);
+		return PlayBuf::AR(getOwner()->soundOnset, getOwner()->inputs[XFadeLoopPlayBufUGenInternal::Rate], 0, 0, 0, 
+						   UGen::DeleteWhenDone, MetaData(), interpolation);
 	else if(eventCount == 1)
-		return PlayBuf::AR(getOwner()->soundLoop, getOwner()->inputs[XFadeLoopPlayBufUGenInternal::Rate], 0, 0, 1);
+		return PlayBuf::AR(getOwner()->soundLoop, getOwner()->inputs[XFadeLoopPlayBufUGenInternal::Rate], 0, 0, 1, 
+						   UGen::DeleteWhenDone, MetaData(), interpolation);
 	else
 		return 0;
 }
@@ -89,6 +97,7 @@ XFadeLoopPlayBufUGenInternal::XFadeLoopPlayBufUGenInternal(XFadeLoopSpec const&
 	fadeTime(spec.getFadeTime()),
 	startLoop(spec.getStartLoop()),
 	endLoop(spec.getEndLoop()),
+	interpolation(spec.getInterpolation()),
 	soundOnset(spec.getSoundOnset()),
 	soundLoop(spec.getSoundLoop()),
 	bufferData(new float*[spec.getNumChannels()])
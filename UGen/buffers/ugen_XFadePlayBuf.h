@@ -40,11 +40,16 @@
 
 #include "../core/ugen_UGen.h"
 #include "../spawn/ugen_Textures.h"
+#include "ugen_Interpolation.h"
 
 class XFadeLoopSpecInternal : public SmartPointer
 {
 public:
-	XFadeLoopSpecInternal(Buffer const& sound, const int startLoop, const int endLoop, const float fadeTime = 0.05f);
+	XFadeLoopSpecInternal(Buffer const& sound, 
+						  const int startLoop, 
+						  const int endLoop, 
+						  const float fadeTime = 0.05f, 
+						  const Interpolation::Mode interpolation = Interpolation::Linear);
 	
 	friend class XFadeLoopPlayBufUGenInternal;
 	friend class XFadeLoopSpec;
@@ -54,6 +59,7 @@ private:
 	const float fadeTime_;
 	const int startLoop_;
 	const int endLoop_;
+	const Interpolation::Mode interpolation_;
 	Buffer soundOnset;
 	Buffer soundLoop;	
 };
@@ -61,12 +67,17 @@ private:
 class XFadeLoopSpec : public SmartPointerContainer<XFadeLoopSpecInternal>
 {
 public:
-	XFadeLoopSpec(Buffer const& sound, const int startLoop, const int endLoop, const float fadeTime = 0.05f);
+	XFadeLoopSpec(Buffer const& sound, 
+				  const int startLoop, 
+				  const int endLoop, 
+				  const float fadeTime = 0.05f, 
+				  const Interpolation::Mode interpolation = Interpolation::Linear);
 	
 	inline int getNumChannels() const			{ return getInternal()->numChannels;	}
 	inline float getFadeTime() const			{ return getInternal()->fadeTime_;		}
 	inline int getStartLoop() const				{ return getInternal()->startLoop_;		}
 	inline int getEndLoop() const				{ return getInternal()->endLoop_;		}
+	inline Interpolation::Mode getInterpolation() const	{ return getInternal()->interpolation_;	}
 	inline const Buffer& getSoundOnset() const	{ return getInternal()->soundOnset;		}
 	inline const Buffer& getSoundLoop() const	{ return getInternal()->soundLoop;		}	
 	
@@ -90,6 +101,7 @@ private:
 	const float fadeTime;
 	const int startLoop;
 	const int endLoop;
+	const Interpolation::Mode interpolation;
 	Buffer soundOnset;
 	Buffer soundLoop;
 	
@@ -113,9 +125,14 @@ class XFadeLoopPlayBuf : public UGen
 public: 	
 	XFadeLoopPlayBuf (XFadeLoopSpec const& spec, UGen const& rate = 1.f) throw();
 	
-	static inline UGen AR (Buffer const& sound, const int startLoop, const int endLoop, const float fadeTime = 0.05f, UGen const& rate = 1.f) throw() 
+	static inline UGen AR (Buffer const& sound, 
+						   const int startLoop, 
+						   const int endLoop, 
+						   const float fadeTime = 0.05f, 
+						   UGen const& rate = 1.f, 
+						   const Interpolation::Mode interpolation = Interpolation::Linear) throw() 
 	{ 
-		return XFadeLoopPlayBuf (XFadeLoopSpec(sound, startLoop, endLoop, fadeTime), rate); 
+		return XFadeLoopPlayBuf (XFadeLoopSpec(sound, startLoop, endLoop, fadeTime, interpolation), rate); 
 	} 	
 	
 	static inline UGen AR (XFadeLoopSpec const& spec, UGen const& rate = 1.f) throw() 
@@ -0,0 +1,402 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#if defined(UGEN_HRTF)
+
+#if !defined(WIN32) && !defined(UGEN_IPHONE) && !defined(UGEN_ANDROID)
+	#include <Accelerate/Accelerate.h>
+	#include <CoreServices/CoreServices.h>
+#endif
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_BinauralPan.h"
+#include "../fft/ugen_FFTEngineInternal.h"
+#include "../basics/ugen_InlineBinaryOps.h"
+#include "../core/ugen_Bits.h"
+
+
+static int calculateBinauralPanFFTSize(HRTFSet const& hrtfSet, const double sampleRate) throw()
+{
+	const double ratio = hrtfSet.getSampleRate() > 0.0 ? sampleRate / hrtfSet.getSampleRate() : 1.0;
+	const int responseSize = ugen::max(1, (int)(hrtfSet.getResponseSize() * ratio + 0.5));
+	
+	// the hop is half the FFT size and must be at least as long as the responses
+	return ugen::max(16, (int)Bits::nextPowerOf2(responseSize * 2));
+}
+
+BinauralPanSpectra::BinauralPanSpectra(HRTFSet const& hrtfSetToUse, const double sampleRateToUse) throw()
+:	hrtfSet(hrtfSetToUse),
+	sampleRate(sampleRateToUse),
+	next(0),
+	refCount(1),
+	numResponses(hrtfSet.getNumResponses()),
+	fftSize(calculateBinauralPanFFTSize(hrtfSet, sampleRate)),
+	spectra(Buffer::newClear(ugen::max(1, numResponses) * fftSize, 2))
+{
+	const int fftSizeHalved = fftSize / 2;
+	const bool resample = hrtfSet.getSampleRate() > 0.0 && hrtfSet.getSampleRate() != sampleRate;
+	FFTEngine fftEngine(fftSize);
+	Buffer temp(BufferSpec(fftSize, 1, false));
+	float* const tempSamples = temp.getData();
+	
+	for(int i = 0; i < numResponses; i++)
+	{
+		Buffer response = hrtfSet.getResponseAtIndex(i);
+		
+		if(resample)
+			response = response.changeSampleRate(hrtfSet.getSampleRate(), sampleRate);
+		
+		const int responseSize = ugen::min(response.size(), fftSizeHalved);
+		
+		for(int channel = 0; channel < 2; channel++)
+		{
+			memcpy(tempSamples, response.getData(channel % response.getNumChannels()), responseSize * sizeof(float));
+			memset(tempSamples + responseSize, 0, (fftSize - responseSize) * sizeof(float));
+			
+			DSPSplitComplex spectrum;
+			spectrum.realp = spectra.getData(channel) + i * fftSize;
+			spectrum.imagp = spectrum.realp + fftSizeHalved;
+			fftEngine.getInternal()->fft(spectrum, tempSamples);
+		}
+	}
+}
+
+BinauralPanSpectra* BinauralPanSpectra::first = 0;
+AtomicSpinLock BinauralPanSpectra::lock;
+bool BinauralPanSpectra::keepUnused = true;
+
+BinauralPanSpectra& BinauralPanSpectra::getInstance(HRTFSet const& hrtfSet) throw()
+{
+	// one for each set and sample rate, these are kept until UGen::shutdown() even when unused
+	const ScopedAtomicSpinLock sl(lock);
+	const double sampleRate = UGen::getSampleRate();
+	
+	keepUnused = true;
+	
+	for(BinauralPanSpectra* spectra = first; spectra != 0; spectra = spectra->next)
+	{
+		if(spectra->hrtfSet == hrtfSet && spectra->sampleRate == sampleRate)
+		{
+			spectra->refCount++;
+			return *spectra;
+		}
+	}
+	
+	BinauralPanSpectra* spectra = new BinauralPanSpectra(hrtfSet, sampleRate);
+	spectra->next = first;
+	first = spectra;
+	
+	return *spectra;
+}
+
+void BinauralPanSpectra::release() throw()
+{
+	{
+		const ScopedAtomicSpinLock sl(lock);
+		
+		ugen_assert(refCount > 0);
+		
+		if((--refCount > 0) || keepUnused)
+			return;
+		
+		BinauralPanSpectra** link = &first;
+		
+		while(*link != this)
+			link = &(*link)->next;
+		
+		*link = next;
+	}
+	
+	delete this;
+}
+
+void BinauralPanSpectra::deleteUnused() throw()
+{
+	BinauralPanSpectra* unused = 0;
+	
+	{
+		const ScopedAtomicSpinLock sl(lock);
+		
+		keepUnused = false;
+		
+		BinauralPanSpectra** link = &first;
+		
+		while(*link != 0)
+		{
+			BinauralPanSpectra* const spectra = *link;
+			
+			if(spectra->refCount == 0)
+			{
+				*link = spectra->next;
+				spectra->next = unused;
+				unused = spectra;
+			}
+			else link = &spectra->next;
+		}
+	}
+	
+	while(unused != 0) // deleted outside the lock
+	{
+		BinauralPanSpectra* const spectra = unused;
+		unused = spectra->next;
+		delete spectra;
+	}
+}
+
+/** Multiply two packed split spectra (DC in the first real element, Nyquist in the first imaginary element). */
+static inline void binauralPanMultiply(const float* const input, 
+									   const float* const filter, 
+									   float* const output,
+									   const int fftSizeHalved) throw()
+{
+	const float* const inputReal = input;
+	const float* const inputImag = input + fftSizeHalved;
+	const float* const filterReal = filter;
+	const float* const filterImag = filter + fftSizeHalved;
+	float* const outputReal = output;
+	float* const outputImag = output + fftSizeHalved;
+	
+	outputReal[0] = inputReal[0] * filterReal[0];
+	outputImag[0] = inputImag[0] * filterImag[0];
+	
+	for(int i = 1; i < fftSizeHalved; i++)
+	{
+		outputReal[i] = inputReal[i] * filterReal[i] - inputImag[i] * filterImag[i];
+		outputImag[i] = inputReal[i] * filterImag[i] + inputImag[i] * filterReal[i];
+	}
+}
+
+BinauralPanUGenInternal::BinauralPanUGenInternal(UGen const& input, 
+												 UGen const& azimuth, 
+												 UGen const& elevation,
+												 HRTFSet const& hrtfSet) throw()
+:	ProxyOwnerUGenInternal(NumInputs, 1),
+	spectra(BinauralPanSpectra::getInstance(hrtfSet)),
+	fftSize(spectra.getFFTSize()),
+	hopSize(fftSize / 2),
+	scale(1.f / fftSize),
+	fftEngine(fftSize),
+	inputBuffer(BufferSpec(fftSize, 1, true)),
+	outputBuffer(BufferSpec(hopSize, 2, true)),
+	filters(BufferSpec(fftSize, 2, true)),
+	newFilters(BufferSpec(fftSize, 2, true)),
+	fftBuffer(BufferSpec(fftSize * 3, 1, true)),
+	position(0),
+	filtersValid(false),
+	numResponses(0)
+{
+	inputs[Input] = input;
+	inputs[Azimuth] = azimuth;
+	inputs[Elevation] = elevation;
+}
+
+BinauralPanUGenInternal::~BinauralPanUGenInternal()
+{
+	spectra.release();
+}
+
+void BinauralPanUGenInternal::updateFilters() throw()
+{
+	for(int ear = 0; ear < 2; ear++)
+	{
+		float* const filterSamples = newFilters.getData(ear);
+		const float* const firstSpectrum = spectra.getSpectrum(responseIndices[0], ear);
+		const float firstWeight = weights[0];
+		
+		for(int i = 0; i < fftSize; i++)
+			filterSamples[i] = firstSpectrum[i] * firstWeight;
+		
+		for(int j = 1; j < numResponses; j++)
+		{
+			const float* const spectrum = spectra.getSpectrum(responseIndices[j], ear);
+			const float weight = weights[j];
+			
+			for(int i = 0; i < fftSize; i++)
+				filterSamples[i] += spectrum[i] * weight;
+		}
+	}
+}
+
+void BinauralPanUGenInternal::processHop(const float azimuth, const float elevation) throw()
+{
+	FFTEngineInternal* const engine = fftEngine.getInternal();
+	const int fftSizeHalved = fftSize >> 1;
+	float* const inputSamples = inputBuffer.getData();
+	float* const inputSpectrumSamples = fftBuffer.getData();
+	float* const productSamples = inputSpectrumSamples + fftSize;
+	float* const resultSamples = productSamples + fftSize;
+	const float* const validResultSamples = resultSamples + (fftSize - hopSize);
+	
+	DSPSplitComplex inputSpectrum;
+	inputSpectrum.realp = inputSpectrumSamples;
+	inputSpectrum.imagp = inputSpectrumSamples + fftSizeHalved;
+	
+	DSPSplitComplex product;
+	product.realp = productSamples;
+	product.imagp = productSamples + fftSizeHalved;
+	
+	// one forward FFT per hop shared by both ears and both filters (overlap-save)
+	engine->fft(inputSpectrum, inputSamples);
+	memcpy(inputSamples, inputSamples + hopSize, (fftSize - hopSize) * sizeof(float));
+	
+	int newIndices[MaxResponses];
+	float newWeights[MaxResponses];
+	const int newNumResponses = spectra.getHRTFSet().getInterpolatedResponses(azimuth, elevation, newIndices, newWeights);
+	
+	if(newNumResponses == 0)
+	{
+		// e.g., an empty HRTFSet
+		memset(outputBuffer.getData(0), 0, hopSize * sizeof(float));
+		memset(outputBuffer.getData(1), 0, hopSize * sizeof(float));
+		return;
+	}
+	
+	bool changed = !filtersValid || (newNumResponses != numResponses);
+	
+	for(int j = 0; (j < newNumResponses) && !changed; j++)
+		changed = (newIndices[j] != responseIndices[j]) || (newWeights[j] != weights[j]);
+	
+	if(changed)
+	{
+		numResponses = newNumResponses;
+		memcpy(responseIndices, newIndices, sizeof(responseIndices));
+		memcpy(weights, newWeights, sizeof(weights));
+		updateFilters();
+	}
+	
+	for(int ear = 0; ear < 2; ear++)
+	{
+		float* const outputSamples = outputBuffer.getData(ear);
+		
+		if(filtersValid)
+		{
+			binauralPanMultiply(inputSpectrumSamples, filters.getData(ear), productSamples, fftSizeHalved);
+			engine->ifft(resultSamples, product);
+			
+			for(int i = 0; i < hopSize; i++)
+				outputSamples[i] = validResultSamples[i] * scale;
+		}
+		
+		if(changed)
+		{
+			binauralPanMultiply(inputSpectrumSamples, newFilters.getData(ear), productSamples, fftSizeHalved);
+			engine->ifft(resultSamples, product);
+			
+			if(filtersValid)
+			{
+				// crossfade from the old filter to the new one over this hop
+				const float fadeIncrement = 1.f / hopSize;
+				float fade = fadeIncrement;
+				
+				for(int i = 0; i < hopSize; i++)
+				{
+					const float oldValue = outputSamples[i];
+					outputSamples[i] = oldValue + (validResultSamples[i] * scale - oldValue) * fade;
+					fade += fadeIncrement;
+				}
+			}
+			else
+			{
+				for(int i = 0; i < hopSize; i++)
+					outputSamples[i] = validResultSamples[i] * scale;
+			}
+		}
+	}
+	
+	if(changed)
+	{
+		Buffer temp = filters;
+		filters = newFilters;
+		newFilters = temp;
+		filtersValid = true;
+	}
+}
+
+void BinauralPanUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
+{
+	int numSamplesToProcess = uGenOutput.getBlockSize();
+	float* outputSamples0 = proxies[0]->getSampleData();
+	float* outputSamples1 = proxies[1]->getSampleData();
+	const float* inputSamples = inputs[Input].processBlock(shouldDelete, blockID, 0);
+	const float* azimuthSamples = inputs[Azimuth].processBlock(shouldDelete, blockID, 0);
+	const float* elevationSamples = inputs[Elevation].processBlock(shouldDelete, blockID, 0);
+	
+	float* const hopSamples = inputBuffer.getData() + (fftSize - hopSize);
+	const float* const outputBufferSamples0 = outputBuffer.getData(0);
+	const float* const outputBufferSamples1 = outputBuffer.getData(1);
+	
+	while(numSamplesToProcess > 0)
+	{
+		const int numSamplesThisTime = ugen::min(numSamplesToProcess, hopSize - position);
+		const int numBytesThisTime = numSamplesThisTime * sizeof(float);
+		
+		memcpy(hopSamples + position, inputSamples, numBytesThisTime);
+		memcpy(outputSamples0, outputBufferSamples0 + position, numBytesThisTime);
+		memcpy(outputSamples1, outputBufferSamples1 + position, numBytesThisTime);
+		
+		position += numSamplesThisTime;
+		numSamplesToProcess -= numSamplesThisTime;
+		inputSamples += numSamplesThisTime;
+		azimuthSamples += numSamplesThisTime;
+		elevationSamples += numSamplesThisTime;
+		outputSamples0 += numSamplesThisTime;
+		outputSamples1 += numSamplesThisTime;
+		
+		if(position == hopSize)
+		{
+			processHop(azimuthSamples[-1], elevationSamples[-1]);
+			position = 0;
+		}
+	}
+}
+
+BinauralPan::BinauralPan(UGen const& input, UGen const& azimuth, UGen const& elevation, HRTFSet const& hrtfSet) throw()
+{
+	initInternal(2);
+	
+	BinauralPanUGenInternal* internal = new BinauralPanUGenInternal(input.mix(), azimuth.mix(), elevation.mix(), hrtfSet);
+	internalUGens[0] = internal;
+	internalUGens[1] = internal->getProxy(1);
+}
+
+END_UGEN_NAMESPACE
+
+#endif // UGEN_HRTF
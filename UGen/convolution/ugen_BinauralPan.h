@@ -0,0 +1,161 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_BinauralPan_H_
+#define _UGEN_ugen_BinauralPan_H_
+
+#include "../core/ugen_UGen.h"
+#include "../fft/ugen_FFTEngine.h"
+#include "../core/ugen_AtomicSpinLock.h"
+#include "ugen_HRTF.h"
+
+/** Stores the spectra of all the responses in an HRTFSet for BinauralPan.
+ This is created once for each HRTFSet and sample rate (when the first BinauralPan 
+ using them is created) and shared by all BinauralPan instances. Each instance holds a 
+ reference, the spectra are kept when unused (so new instances don't recalculate them) 
+ until UGen::shutdown() calls deleteUnused(). The spectra are
+ read-only once created (each BinauralPan has its own FFTEngine). Each spectrum is stored in the packed split 
+ format used by FFTEngine i.e., fftSize/2 real values followed by fftSize/2 imaginary
+ values (with the Nyquist value in the first imaginary element). Responses are 
+ resampled if the set's sample rate differs from the current sample rate.
+ @see BinauralPan, HRTFSet */
+class BinauralPanSpectra
+{
+public:
+	/** Get the spectra for an HRTFSet at the current sample rate and add a reference for the caller, 
+	 which must call release() when it no longer needs them. These are calculated if necessary. */
+	static BinauralPanSpectra& getInstance(HRTFSet const& hrtfSet) throw();
+	
+	/** Remove a reference added by getInstance(). */
+	void release() throw();
+	
+	/** Delete the spectra which no BinauralPan is using, this is called by UGen::shutdown().
+	 Spectra still in use are deleted when they are released after this (until getInstance() is called again). */
+	static void deleteUnused() throw();
+	
+	inline HRTFSet& getHRTFSet() throw()			{ return hrtfSet;		}
+	inline int getFFTSize() const throw()			{ return fftSize;		}
+	inline int getNumResponses() const throw()		{ return numResponses;	}
+	
+	/** Returns the spectrum of one channel (ear) of a response.
+	 @param responseIndex	A response index as used by HRTF::getResponseAtIndex().
+	 @param channel			0 for the left ear or 1 for the right ear. */
+	inline const float* getSpectrum(const int responseIndex, const int channel) const throw()
+	{
+		return spectra.getData(channel) + responseIndex * fftSize;
+	}
+	
+private:
+	BinauralPanSpectra(HRTFSet const& hrtfSet, const double sampleRate) throw();
+	
+	HRTFSet hrtfSet;
+	const double sampleRate;
+	BinauralPanSpectra* next;
+	int refCount;
+	int numResponses;
+	int fftSize;
+	Buffer spectra;
+	
+	static BinauralPanSpectra* first;
+	static AtomicSpinLock lock;
+	static bool keepUnused;
+};
+
+/** @ingroup UGenInternals */
+class BinauralPanUGenInternal : public ProxyOwnerUGenInternal
+{
+public:
+	BinauralPanUGenInternal(UGen const& input, UGen const& azimuth, UGen const& elevation, HRTFSet const& hrtfSet) throw();
+	~BinauralPanUGenInternal();
+	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
+	enum Inputs { Input, Azimuth, Elevation, NumInputs };
+	enum Constants { MaxResponses = 4 };
+	
+protected:
+	void processHop(const float azimuth, const float elevation) throw();
+	void updateFilters() throw();
+	
+	BinauralPanSpectra& spectra;
+	const int fftSize;
+	const int hopSize;
+	const float scale;
+	FFTEngine fftEngine;		// not shared since the engine has its own work space
+	Buffer inputBuffer;			// the most recent fftSize input samples
+	Buffer outputBuffer;		// hopSize samples per ear waiting to be output
+	Buffer filters;				// the current interpolated spectrum per ear
+	Buffer newFilters;			// the target spectrum per ear when the direction changes
+	Buffer fftBuffer;			// input spectrum, product spectrum, ifft result
+	int position;
+	bool filtersValid;
+	
+	int numResponses;
+	int responseIndices[MaxResponses];
+	float weights[MaxResponses];
+};
+
+#define BinauralPan_Docs	@param input		The (mono) input source, multichannel inputs are mixed to mono.			\
+							@param azimuth		The azimuth in radians, 0 is straight ahead, positive values are		\
+												to the right and negative values to the left (-pi to pi).				\
+												This is sampled once per processing hop.								\
+							@param elevation	The elevation in radians (-40 to 90 degrees for the KEMAR data).		\
+												This is sampled once per processing hop.								\
+							@param hrtfSet		The HRIRs to use, the built-in KEMAR set by default.
+
+/** Dynamic binaural panner using the HRTF data.
+ This convolves a mono source with the HRIRs for a direction that may change
+ continuously. The responses measured closest to the requested direction are
+ interpolated (bilinearly across azimuth and elevation) in the frequency domain 
+ and when the direction changes the output crossfades from the old filter to the 
+ new one over one processing hop.
+ 
+ The spectra of all the responses are computed once per HRTFSet and shared by all 
+ instances (see BinauralPanSpectra) so the cost per source is one FFT and two or 
+ four inverse FFTs per hop. The hop size is half the FFT size and at least the 
+ response size (128 samples for the built-in KEMAR data) which is also the latency 
+ of the output.
+ 
+ The output is two channels (left and right).
+ @ingroup AllUGens FFTUGens
+ @see HRTF, Pan2, PanB */
+UGenSublcassDeclaration(BinauralPan, (input, azimuth, elevation, hrtfSet),
+						(UGen const& input, UGen const& azimuth = 0.f, UGen const& elevation = 0.f, 
+						 HRTFSet const& hrtfSet = HRTFSet::getDefault()), 
+						COMMON_UGEN_DOCS BinauralPan_Docs);
+
+#endif // _UGEN_ugen_BinauralPan_H_
@@ -209,6 +209,7 @@ PartConvolveUGenInternal::PartConvolveUGenInternal(UGen const& input,
 	fftSizeLog2(Bits::countTrailingZeros(fftSize)),
 	fftSizeOver4(fftSize >> 2),
 	bufferSize(partImpulse.getBufferSize()),
+	numSilentSamples(0),
 	resetAll(1),
 	fftEngine(partImpulse.getFFTEngine()),
 	scaleMultD(1.0 / (double) (fftSize)),// * 4)),	// trying without * 4 not sure the level output is right... yes without the *4 seems correct? not checked with fftw though (FFTReal and vDSP checked I think)
@@ -258,6 +259,25 @@ void PartConvolveUGenInternal::processBlock(bool& shouldDelete, const unsigned i
     
     vFloat *outputSamples = (vFloat*)uGenOutput.getSampleData();		
 	vFloat *inputSamples = (vFloat*)inputs[Input].processBlock(shouldDelete, blockID, channel);
+	
+	if(inputs[Input].isSilent(channel) && !resetAll)
+	{
+		// once the input history and the overlapping FFT buffers hold only zeros the 
+		// output will be silent until the input returns so the block can be skipped
+		if(numSilentSamples >= bufferSize * 2 + fftSize)
+		{
+			uGenOutput.setSilentAndClear();
+			return;
+		}
+		
+		numSilentSamples += numSamples;
+	}
+	else
+	{
+		numSilentSamples = 0;
+	}
+	
+	uGenOutput.setSilent(false);
     	
 	DSPSplitComplex impulseTemp, bufferTemp;
 	DSPSplitComplex impulse;
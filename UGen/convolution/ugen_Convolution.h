@@ -138,6 +138,7 @@ protected:
 	int fftSizeOver4;
 	
 	long bufferSize;
+	long numSilentSamples;
 	int resetAll;
 	
 	FFTEngine fftEngine;
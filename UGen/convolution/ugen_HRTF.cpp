@@ -41,8682 +41,2456 @@
 
 #if defined(UGEN_HRTF)
 
-#include "ugen_StandardHeader.h"
+#include "../core/ugen_StandardHeader.h"
 
 BEGIN_UGEN_NAMESPACE
 
 #include "ugen_HRTF.h"
 #include "../basics/ugen_InlineUnaryOps.h"
+#include "../basics/ugen_InlineBinaryOps.h"
 
-static const short ugen_H_10e000a0c[] = { 
-	5, -8, 20, -30, 34, -54, 64, -83, 80, -87, 97, 7, 4586, 6731, -8758, -4086, 
-	2447, -5276, 6626, 10259, 2467, 6954, 16043, 745, -11931, 1719, -1529, -13710, -4321, 1345, -7484, -5197, 
-	2167, 1743, -412, 1518, 4592, 2710, 1891, 3654, 1259, -1482, 95, -20, -2804, -3755, -2558, -3076, 
-	-3619, -1859, -1317, -1033, 1001, 1767, 1523, 1851, 1948, 1563, 1018, 499, 266, -156, -916, -969, 
-	-1025, -1456, -1406, -1031, -965, -783, -286, 37, 84, 444, 770, 709, 589, 488, 370, 23, 
-	-333, -386, -429, -693, -601, -411, -524, -504, -263, -79, -15, 104, 268, 162, 132, 262, 
-	244, 89, -26, -104, -316, -428, -440, -414, -369, -289, -143, -37, 6, 77, 87, 30, 
-	11, 15, -12, -34, -68, -142, -173, -167, -145, -108, -61, -66, -40, 4, 7, 58
-};
-
-static const short ugen_H_10e000a1c[] = { 
-	5, -8, 20, -30, 34, -54, 64, -83, 80, -87, 97, 7, 4586, 6731, -8758, -4086, 
-	2447, -5276, 6626, 10259, 2467, 6954, 16043, 745, -11931, 1719, -1529, -13710, -4321, 1345, -7484, -5197, 
-	2167, 1743, -412, 1518, 4592, 2710, 1891, 3654, 1259, -1482, 95, -20, -2804, -3755, -2558, -3076, 
-	-3619, -1859, -1317, -1033, 1001, 1767, 1523, 1851, 1948, 1563, 1018, 499, 266, -156, -916, -969, 
-	-1025, -1456, -1406, -1031, -965, -783, -286, 37, 84, 444, 770, 709, 589, 488, 370, 23, 
-	-333, -386, -429, -693, -601, -411, -524, -504, -263, -79, -15, 104, 268, 162, 132, 262, 
-	244, 89, -26, -104, -316, -428, -440, -414, -369, -289, -143, -37, 6, 77, 87, 30, 
-	11, 15, -12, -34, -68, -142, -173, -167, -145, -108, -61, -66, -40, 4, 7, 58
-};
-
-static const short ugen_H_10e005a0c[] = { 
-	0, 3, -5, 14, -22, 27, -45, 58, -76, 80, -90, 107, 74, 4554, 5316, -7916, 
-	-2565, 1459, -4570, 6394, 8670, 2498, 6815, 14046, 555, -9550, 1582, -1978, -11787, -3662, 460, -6746, 
-	-4442, 1408, 1249, -366, 1392, 3981, 2360, 2073, 3478, 890, -1164, 154, -334, -2554, -3053, -2054, 
-	-2818, -3091, -1352, -1049, -1177, 441, 1361, 1227, 1331, 1465, 1443, 1050, 558, 324, -180, -779, 
-	-759, -955, -1410, -1283, -942, -886, -655, -205, 58, 67, 377, 651, 572, 437, 416, 339, 
-	12, -315, -335, -343, -605, -550, -400, -445, -417, -260, -144, -106, 42, 208, 128, 129, 
-	250, 227, 89, -3, -103, -283, -350, -338, -325, -306, -259, -168, -72, -27, 24, 21, 
-	-29, -55, -36, -22, -37, -44, -78, -98, -107, -98, -77, -68, -80, -62, -23, 11
-};
-
-static const short ugen_H_10e005a1c[] = { 
-	-8, 23, -32, 34, -50, 48, -53, 29, -15, 8, -8, 3460, 9005, -7314, -7899, 3635, 
-	-5312, 5082, 12068, 3093, 5776, 17402, 4211, -14313, -182, 819, -14436, -6658, 2378, -6957, -7061, 1974, 
-	2609, -393, 842, 4985, 3245, 1356, 4035, 2424, -1596, -222, 489, -2516, -4229, -3147, -3403, -4385, 
-	-2447, -1191, -1157, 784, 2140, 1886, 2147, 2374, 1934, 1176, 490, 190, -187, -994, -1054, -1006, 
-	-1480, -1483, -1045, -1017, -941, -430, 11, 83, 393, 809, 754, 631, 574, 461, 103, -290, 
-	-395, -396, -716, -695, -474, -558, -521, -275, -69, -48, 87, 340, 253, 149, 255, 275, 
-	99, -44, -92, -312, -462, -513, -495, -439, -324, -148, -15, 26, 75, 133, 82, 47, 
-	48, 20, -5, -38, -132, -219, -234, -215, -163, -73, -52, -20, 33, 27, 50, 105
-};
-
-static const short ugen_H_10e010a0c[] = { 
-	-4, 1, 0, -1, 7, -14, 19, -34, 45, -67, 73, -86, 108, 193, 4624, 3761, 
-	-7100, -1329, 404, -3316, 6120, 7139, 2689, 6772, 12265, -18, -7536, 1404, -2523, -9970, -3022, -413, 
-	-6094, -3716, 940, 919, -304, 1441, 3484, 2097, 2107, 3221, 704, -1127, -8, -494, -2260, -2539, 
-	-1801, -2451, -2521, -1014, -812, -1078, 87, 900, 950, 1103, 1280, 1222, 791, 376, 240, -225, 
-	-695, -682, -863, -1231, -1102, -789, -734, -522, -139, 115, 131, 338, 509, 435, 341, 305, 
-	225, -28, -303, -329, -372, -558, -479, -390, -418, -350, -195, -125, -126, 24, 195, 142, 
-	139, 211, 184, 51, -35, -142, -270, -286, -281, -272, -274, -228, -156, -102, -65, -25, 
-	-28, -73, -70, -40, -30, -15, -8, -32, -79, -72, -66, -72, -74, -111, -75, -37
-};
-
-static const short ugen_H_10e010a1c[] = { 
-	18, -24, 20, -26, 11, 5, -53, 91, -115, 105, 2174, 10413, -4117, -11902, 3413, -4507, 
-	3335, 13881, 3641, 4892, 18137, 7862, -15463, -2904, 2557, -14386, -8630, 2692, -6199, -8463, 1327, 3016, 
-	130, 363, 4633, 3534, 1445, 4517, 3166, -1346, -419, 800, -2289, -4481, -3727, -4002, -5100, -2724, 
-	-890, -1396, 425, 2398, 2367, 2395, 2471, 2249, 1535, 680, 151, -295, -1142, -1240, -1017, -1479, 
-	-1558, -1126, -1063, -981, -455, 48, 149, 349, 794, 824, 697, 556, 467, 161, -277, -382, 
-	-371, -697, -805, -548, -542, -502, -263, -90, -26, 58, 319, 336, 209, 313, 302, 122, 
-	-74, -135, -311, -485, -533, -563, -504, -376, -186, -21, 46, 106, 178, 132, 79, 74, 
-	38, 8, -10, -102, -204, -236, -252, -221, -123, -76, -11, 75, 78, 60, 95, 111
-};
-
-static const short ugen_H_10e015a0c[] = { 
-	0, -4, 1, -1, 0, 3, -9, 11, -23, 30, -51, 55, -66, 78, 302, 4366, 
-	2750, -6082, -873, 44, -2342, 5271, 6154, 2763, 6309, 10837, 64, -6061, 1158, -2354, -8432, -2805, 
-	-953, -5445, -3372, 465, 746, -305, 1257, 3162, 2057, 1993, 2638, 652, -804, -109, -459, -1922, 
-	-2204, -1537, -2000, -2164, -1017, -789, -904, -41, 507, 788, 1013, 933, 744, 522, 291, 140, 
-	-218, -553, -527, -702, -1004, -904, -692, -599, -443, -126, 121, 155, 302, 381, 338, 242, 
-	165, 92, -89, -299, -324, -361, -510, -431, -343, -376, -322, -169, -77, -56, 27, 128, 
-	110, 137, 187, 117, -7, -72, -143, -246, -279, -268, -256, -242, -213, -159, -107, -84, 
-	-62, -60, -66, -70, -42, -28, -13, -2, -38, -61, -60, -50, -59, -85, -132, -124
-};
-
-static const short ugen_H_10e015a1c[] = { 
-	0, -10, 12, -42, 73, -138, 177, -221, 237, 931, 10400, 1038, -15102, 948, -2480, 411, 
-	15687, 5358, 3131, 18306, 12354, -15406, -6784, 4387, -13691, -11182, 2982, -4776, -10212, 615, 3578, 54, 
-	301, 3738, 3618, 2086, 4659, 3956, -853, -810, 1110, -1711, -4699, -4663, -4566, -5213, -2880, -931, 
-	-1672, 107, 2761, 2628, 2392, 2560, 2434, 1820, 929, 212, -275, -1118, -1467, -1141, -1529, -1697, 
-	-1242, -1071, -1034, -410, 145, 165, 330, 885, 920, 694, 556, 439, 159, -286, -447, -403, 
-	-677, -834, -540, -537, -549, -276, -44, -2, 39, 297, 374, 224, 339, 351, 146, -93, 
-	-182, -326, -503, -523, -576, -541, -422, -237, -78, -16, 81, 215, 190, 101, 107, 77, 
-	1, -10, -94, -191, -232, -243, -230, -167, -110, -62, 80, 139, 127, 116, 72, 66
-};
-
-static const short ugen_H_10e020a0c[] = { 
-	0, -1, -4, 0, -1, 0, 1, -7, 8, -17, 20, -38, 42, -46, 49, 374, 
-	3951, 2144, -5150, -657, 56, -1823, 4378, 5480, 2646, 5709, 9725, 426, -4913, 1059, -1915, -7196, 
-	-2771, -1253, -4866, -3313, 181, 602, -426, 1213, 3011, 1834, 1588, 2316, 748, -495, -4, -315, 
-	-1664, -1914, -1232, -1815, -2084, -1080, -748, -712, 53, 401, 446, 554, 592, 541, 311, 189, 
-	161, -92, -378, -398, -563, -854, -760, -538, -504, -395, -85, 114, 102, 245, 314, 234, 
-	133, 69, -8, -195, -323, -263, -284, -441, -404, -307, -301, -258, -138, -47, -25, 38, 
-	114, 74, 104, 151, 89, -45, -134, -174, -234, -267, -270, -245, -214, -161, -97, -85, 
-	-103, -75, -45, -49, -65, -49, -31, -18, -26, -53, -43, -21, -24, -57, -104, -154
-};
-
-static const short ugen_H_10e020a1c[] = { 
-	-31, 43, -85, 113, -169, 187, -224, 258, 115, 8637, 6964, -15178, -4563, 159, -2238, 15070, 
-	8952, 2017, 16501, 17107, -12392, -12019, 4929, -10750, -14190, 1325, -1982, -10905, -1798, 4656, 707, -1219, 
-	2924, 4775, 2174, 4100, 5014, 147, -1549, 1177, -690, -4967, -5791, -4666, -4671, -3287, -1574, -1635, 
-	125, 2728, 2685, 2308, 2628, 2558, 2038, 1098, 242, -191, -885, -1543, -1334, -1512, -1881, -1498, 
-	-1109, -942, -405, 68, 259, 471, 897, 977, 740, 555, 428, 187, -318, -557, -423, -620, 
-	-886, -599, -468, -523, -352, -92, 30, 93, 296, 418, 240, 251, 362, 199, -82, -209, 
-	-337, -530, -539, -526, -524, -457, -293, -131, -50, 12, 157, 196, 111, 118, 125, 53, 
-	-6, -90, -179, -209, -227, -258, -201, -136, -96, 57, 162, 176, 160, 112, 37, 53
-};
-
-static const short ugen_H_10e025a0c[] = { 
-	-2, 0, -2, -4, 0, -3, 0, 0, -4, 7, -14, 14, -28, 31, -36, 31, 
-	392, 3473, 1803, -4307, -512, 158, -1605, 3603, 4925, 2406, 5072, 8862, 913, -3940, 1060, -1401, 
-	-6252, -2802, -1332, -4535, -3268, 39, 445, -389, 1106, 2598, 1572, 1482, 2132, 769, -225, 283, 
-	-128, -1474, -1722, -1252, -1791, -1984, -974, -618, -525, -27, 57, 133, 289, 410, 377, 259, 
-	159, 214, 58, -301, -397, -509, -638, -571, -442, -416, -351, -105, 60, 53, 147, 233, 
-	182, 30, -48, -91, -202, -304, -241, -242, -382, -339, -247, -245, -191, -93, -46, -38, 
-	34, 107, 51, 50, 89, 41, -100, -189, -206, -237, -239, -236, -208, -161, -108, -68, 
-	-76, -81, -68, -58, -57, -58, -53, -61, -59, -50, -23, -10, -9, -29, -74, -125
-};
-
-static const short ugen_H_10e025a1c[] = { 
-	39, -81, 101, -122, 110, -115, 142, -127, 5756, 11399, -10838, -11358, 802, -2704, 12173, 12086, 
-	2658, 14349, 19966, -6907, -15768, 2626, -6967, -14954, -2153, -875, -9374, -3871, 4087, 1584, -1926, 1776, 
-	5581, 2572, 3671, 5151, 1266, -1419, 664, -69, -5014, -6498, -4280, -3929, -4007, -2250, -1434, 236, 
-	2467, 2458, 2285, 2609, 2642, 2203, 1147, 350, -78, -691, -1465, -1431, -1514, -1914, -1721, -1177, 
-	-987, -519, 126, 374, 564, 928, 998, 722, 605, 430, 196, -286, -531, -441, -602, -897, 
-	-667, -444, -504, -353, -149, 3, 120, 315, 482, 272, 199, 324, 225, -33, -198, -294, 
-	-539, -576, -520, -493, -454, -323, -127, -35, -25, 72, 156, 93, 89, 117, 70, 43, 
-	-3, -133, -170, -200, -262, -254, -174, -95, 22, 146, 201, 216, 178, 85, 32, 50
-};
-
-static const short ugen_H_10e030a0c[] = { 
-	0, -1, 0, 0, -3, 0, 0, 1, 0, 0, 6, -11, 14, -21, 25, -24, 
-	24, 361, 2973, 1663, -3517, -428, 244, -1524, 2941, 4399, 2121, 4479, 8117, 1522, -3045, 1059, 
-	-915, -5518, -2740, -1429, -4306, -3040, -3, 250, -554, 921, 2383, 1465, 1362, 1967, 896, 174, 
-	522, -137, -1488, -1731, -1261, -1623, -1688, -826, -674, -777, -205, 45, 10, 125, 305, 354, 
-	236, 184, 208, 22, -247, -313, -380, -504, -425, -356, -404, -356, -143, 8, 10, 92, 
-	138, 79, -33, -77, -93, -187, -296, -253, -237, -296, -236, -179, -172, -151, -79, -62, 
-	-75, 0, 69, 35, 7, 25, -45, -147, -177, -195, -202, -191, -177, -172, -130, -69, 
-	-53, -66, -85, -72, -54, -55, -70, -82, -83, -54, -12, -3, -12, -17, -57, -104
-};
-
-static const short ugen_H_10e030a1c[] = { 
-	-37, 30, -29, -15, 35, -59, 20, 2702, 12846, -2960, -16121, -2328, -1690, 8667, 13745, 4137, 
-	12323, 21814, -351, -17308, -1188, -4023, -13966, -5133, -1494, -8294, -4938, 3583, 824, -1527, 2028, 4687, 
-	2930, 3913, 4913, 1851, -819, 184, -280, -4904, -6145, -3651, -3864, -4581, -2327, -1268, -168, 2191, 
-	2397, 2062, 2505, 2665, 2193, 1176, 577, 28, -614, -1281, -1425, -1567, -1887, -1762, -1257, -1033, 
-	-713, 85, 483, 646, 908, 950, 725, 582, 425, 251, -147, -491, -506, -570, -819, -689, 
-	-486, -521, -382, -178, -27, 105, 284, 429, 308, 197, 289, 242, 25, -150, -251, -490, 
-	-591, -583, -555, -469, -319, -122, -14, -1, 31, 96, 37, 16, 52, 40, 54, 57, 
-	-33, -116, -175, -244, -270, -207, -142, -24, 104, 164, 230, 240, 152, 48, 29, 37
-};
-
-static const short ugen_H_10e035a0c[] = { 
-	0, 0, -1, -1, 0, -5, 0, 0, 0, 0, -1, 3, -10, 10, -17, 17, 
-	-18, 18, 293, 2476, 1631, -2762, -412, 263, -1454, 2345, 3831, 1905, 3914, 7426, 2214, -2240, 
-	1005, -562, -4762, -2685, -1644, -3791, -2702, -458, -66, -396, 879, 2052, 1366, 1335, 1967, 1234, 
-	326, 229, -353, -1364, -1569, -1114, -1343, -1575, -1108, -894, -679, -233, -25, 24, 84, 242, 
-	317, 229, 109, 160, 37, -180, -197, -295, -437, -413, -329, -396, -378, -145, -11, -30, 
-	8, 43, 0, -56, -59, -92, -198, -285, -218, -183, -249, -174, -98, -143, -164, -121, 
-	-97, -96, -43, 17, -25, -36, -25, -76, -145, -147, -132, -159, -151, -148, -146, -122, 
-	-86, -63, -76, -79, -70, -58, -75, -93, -72, -59, -32, -7, -7, -25, -63, -95
-};
-
-static const short ugen_H_10e035a1c[] = { 
-	-40, 68, -134, 172, -230, 271, 469, 10876, 5911, -15981, -8419, -1287, 5704, 13849, 5895, 10543, 
-	22254, 6756, -15756, -5738, -2606, -11773, -6888, -3254, -7128, -6284, 1505, 927, -394, 1926, 3801, 3485, 
-	3853, 4613, 2508, 147, -944, -1092, -3946, -5343, -3436, -3733, -4824, -2540, -836, -554, 1375, 2435, 
-	2109, 2255, 2422, 2154, 1297, 678, 199, -480, -1111, -1405, -1576, -1885, -1707, -1184, -1088, -896, 
-	40, 514, 567, 844, 966, 672, 559, 479, 308, -23, -427, -519, -563, -709, -676, -458, 
-	-484, -443, -235, -78, 71, 232, 346, 301, 176, 261, 266, 118, -52, -191, -411, -589, 
-	-594, -612, -538, -354, -133, 8, 19, 20, 86, 50, -25, -40, -28, 29, 116, 44, 
-	-82, -137, -192, -239, -225, -157, -81, 39, 130, 203, 252, 208, 118, 50, 29, 27
-};
-
-static const short ugen_H_10e040a0c[] = { 
-	0, 0, 0, -1, 0, -2, -3, 0, 0, 1, 0, -1, 3, -6, 9, -17, 
-	20, -14, 14, 221, 1994, 1655, -2018, -468, 226, -1313, 1764, 3237, 1826, 3408, 6711, 2909, 
-	-1441, 784, -234, -3909, -2720, -1646, -3326, -2826, -754, 53, -232, 635, 1796, 1508, 1489, 1936, 
-	1106, -15, -62, -235, -992, -1307, -1138, -1458, -1668, -1107, -776, -657, -277, -15, 81, 78, 
-	164, 252, 199, 118, 128, 62, -108, -166, -265, -434, -439, -341, -346, -316, -158, -63, 
-	-91, -62, -6, -29, -76, -52, -48, -142, -231, -195, -180, -209, -153, -112, -144, -173, 
-	-136, -119, -118, -84, -52, -65, -59, -36, -61, -88, -86, -89, -118, -130, -150, -161, 
-	-129, -98, -86, -75, -77, -68, -56, -72, -71, -49, -31, -21, -16, -30, -74, -94
-};
-
-static const short ugen_H_10e040a1c[] = { 
-	77, -143, 170, -200, 249, -288, 6392, 12405, -9739, -14992, -2982, 3340, 12694, 7515, 8728, 22030, 
-	13143, -11872, -9064, -2282, -10244, -6904, -4605, -7025, -7076, -1687, 439, 484, 2565, 3352, 3343, 3992, 
-	4922, 2701, 822, -1290, -2350, -3315, -4117, -3293, -3815, -4571, -2651, -835, -779, 791, 2157, 2008, 
-	2238, 2191, 1958, 1353, 834, 288, -317, -867, -1415, -1616, -1760, -1588, -1222, -1020, -938, -157, 
-	478, 473, 679, 915, 738, 579, 472, 335, 96, -318, -522, -539, -610, -625, -430, -418, 
-	-438, -302, -168, 7, 157, 268, 291, 164, 198, 248, 197, 39, -97, -308, -547, -584, 
-	-637, -575, -413, -195, -25, 10, 2, 57, 105, 6, -63, -83, -48, 90, 90, -26, 
-	-112, -177, -205, -199, -176, -112, -15, 67, 154, 232, 235, 160, 101, 45, 22, 31
-};
-
-static const short ugen_H_10e045a0c[] = { 
-	0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, -2, 0, -3, 1, 
-	-10, 18, -16, 22, 137, 1544, 1675, -1283, -578, 144, -1076, 1125, 2694, 1899, 2899, 5940, 
-	3562, -700, 483, 226, -2946, -2929, -1961, -2843, -2609, -857, 124, -173, 504, 1856, 1710, 1178, 
-	1359, 791, -18, 89, -13, -840, -1470, -1337, -1350, -1455, -1060, -719, -581, -286, 1, 72, 
-	42, 111, 211, 216, 125, 113, 50, -116, -188, -280, -420, -454, -335, -271, -289, -216, 
-	-112, -119, -101, -37, 0, -45, -41, -21, -106, -207, -220, -186, -219, -170, -119, -150, 
-	-150, -148, -142, -152, -122, -78, -83, -60, -27, -3, -27, -58, -86, -110, -128, -171, 
-	-176, -154, -113, -97, -79, -64, -46, -30, -44, -53, -43, -21, -22, -53, -85, -101
-};
-
-static const short ugen_H_10e045a1c[] = { 
-	-9, -29, 62, -102, 79, 1734, 13249, 1631, -18240, -8090, 1587, 10219, 9176, 6478, 20369, 19514, 
-	-5718, -12210, -2011, -8322, -7449, -4436, -7111, -8008, -5081, 81, -214, 1960, 4256, 3849, 3204, 5317, 
-	4194, 519, -1500, -2643, -2742, -3987, -3286, -3047, -4434, -3010, -835, -889, 51, 1920, 1913, 2045, 
-	2059, 1871, 1456, 857, 488, -256, -807, -1171, -1537, -1741, -1553, -1199, -926, -906, -402, 317, 
-	388, 557, 867, 789, 543, 491, 372, 184, -225, -486, -467, -572, -546, -403, -353, -430, 
-	-333, -186, -101, 66, 185, 280, 193, 135, 217, 185, 86, -28, -174, -423, -566, -606, 
-	-594, -446, -263, -123, -36, -27, 36, 110, 41, -10, -59, -71, 17, 68, 0, -78, 
-	-145, -214, -186, -152, -124, -58, 3, 91, 191, 243, 204, 147, 87, 25, 21, 30
-};
-
-static const short ugen_H_10e050a0c[] = { 
-	0, 0, 0, 0, 0, -1, -1, -1, -3, -1, 0, 1, 0, -6, 4, -5, 
-	-2, 0, 9, -7, 19, 74, 1132, 1663, -573, -715, 49, -828, 535, 2248, 2007, 2421, 
-	5125, 4094, 46, 445, 653, -2610, -3290, -1761, -2131, -2394, -970, 158, 122, 647, 1571, 1133, 
-	618, 1123, 972, 228, -4, -261, -973, -1413, -1198, -1179, -1300, -932, -601, -568, -273, -24, 
-	-9, 42, 138, 189, 181, 116, 64, -4, -126, -224, -313, -399, -416, -329, -281, -284, 
-	-213, -111, -110, -87, -12, 0, -47, -57, -52, -97, -212, -232, -199, -203, -176, -149, 
-	-136, -160, -148, -143, -160, -137, -80, -60, -57, -2, 16, -14, -53, -80, -116, -167, 
-	-190, -185, -157, -127, -84, -52, -27, -18, -36, -50, -61, -35, -30, -54, -81, -101
-};
-
-static const short ugen_H_10e050a1c[] = { 
-	-125, 178, -246, 300, -307, 7912, 12369, -12595, -16576, -910, 7316, 10294, 4967, 15942, 24541, 3539, 
-	-13380, -4430, -4858, -8013, -3981, -6739, -8636, -7731, -1487, -657, 206, 3926, 4280, 3679, 5241, 5367, 
-	1313, -1328, -3092, -2341, -3224, -4026, -2944, -3407, -3211, -1641, -845, -403, 1376, 1877, 1788, 1940, 
-	1771, 1618, 980, 630, -63, -852, -1052, -1276, -1616, -1636, -1264, -915, -803, -655, 102, 380, 
-	431, 764, 796, 553, 457, 418, 225, -90, -393, -418, -526, -560, -393, -311, -383, -376, 
-	-232, -146, -21, 137, 230, 226, 111, 156, 181, 80, -22, -121, -277, -485, -549, -565, 
-	-496, -342, -200, -108, -89, -25, 85, 92, 15, -36, -52, -16, 69, 0, -102, -143, 
-	-209, -208, -161, -110, -77, -40, 12, 123, 227, 231, 174, 116, 58, 22, 21, 14
-};
-
-static const short ugen_H_10e055a0c[] = { 
-	0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 2, -2, -1, 3, 
-	-6, 2, 3, 7, -1, 23, 21, 772, 1603, 71, -802, -105, -534, 52, 1845, 2075, 
-	2015, 4360, 4572, 1039, 32, 369, -1947, -2958, -1520, -1611, -2098, -865, 411, 218, 72, 731, 
-	855, 775, 1139, 902, 22, -392, -414, -729, -1189, -1146, -947, -1027, -879, -549, -473, -341, 
-	-103, 25, 64, 98, 156, 133, 45, 19, -26, -170, -293, -308, -357, -400, -322, -240, 
-	-216, -174, -78, -79, -107, -53, -33, -70, -82, -84, -116, -179, -202, -202, -215, -201, 
-	-142, -119, -145, -135, -132, -142, -117, -70, -59, -57, 0, 19, -23, -74, -108, -129, 
-	-173, -186, -167, -127, -83, -57, -31, -40, -57, -56, -46, -38, -34, -30, -56, -82
-};
-
-static const short ugen_H_10e055a1c[] = { 
-	-51, 87, -133, 106, 1517, 13924, 2781, -21380, -8748, 5497, 9662, 5895, 9065, 25306, 14946, -9730, 
-	-9059, -2281, -6829, -4087, -5651, -9129, -8616, -4735, -641, -1303, 1824, 4385, 3610, 4779, 6774, 2847, 
-	-611, -2552, -2819, -2279, -3986, -3403, -2912, -3078, -2176, -1246, -930, 671, 1864, 1609, 1730, 1702, 
-	1726, 1200, 706, 393, -503, -1171, -1263, -1343, -1521, -1383, -1101, -845, -778, -134, 465, 321, 
-	531, 797, 662, 409, 369, 351, 86, -295, -388, -400, -575, -486, -313, -316, -356, -264, 
-	-178, -118, 97, 247, 251, 119, 68, 145, 106, 11, -95, -218, -399, -488, -488, -479, 
-	-388, -266, -186, -140, -85, 13, 102, 60, 9, -21, -39, 42, 63, -54, -164, -225, 
-	-240, -194, -124, -64, -37, -16, 47, 159, 233, 213, 148, 76, 31, 34, 31, 9
-};
-
-static const short ugen_H_10e060a0c[] = { 
-	0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, -1, 0, 
-	2, 0, 5, 4, 7, 11, 6, -4, 503, 1477, 599, -829, -266, -264, -258, 1432, 
-	2062, 1952, 3938, 4513, 1212, -166, 641, -1113, -2619, -1428, -901, -1401, -923, -106, -316, -315, 
-	639, 1000, 679, 645, 468, -164, -392, -290, -570, -1004, -939, -756, -849, -738, -544, -455, 
-	-303, -97, 0, 10, 56, 50, 55, 18, -41, -102, -230, -285, -281, -291, -311, -256, 
-	-179, -175, -140, -99, -116, -146, -105, -64, -81, -99, -102, -100, -162, -215, -210, -202, 
-	-174, -120, -100, -125, -122, -100, -112, -128, -85, -46, -55, -31, -23, -61, -108, -108, 
-	-108, -137, -140, -120, -85, -72, -80, -97, -81, -50, -30, -24, -28, -14, -20, -50
-};
-
-static const short ugen_H_10e060a1c[] = { 
-	83, -125, 177, -300, 5897, 15362, -10271, -21917, 770, 8922, 7677, 4418, 18601, 25053, 476, -12487, 
-	-3822, -3210, -4466, -3974, -9401, -8689, -7297, -2533, -832, -1339, 3381, 3897, 3332, 6303, 5488, 721, 
-	-1150, -2755, -2236, -2826, -3948, -2779, -2930, -2593, -1703, -1426, -415, 1415, 1669, 1553, 1599, 1609, 
-	1471, 914, 716, 131, -901, -1240, -1331, -1471, -1332, -1228, -1029, -865, -504, 349, 458, 295, 
-	660, 733, 490, 319, 386, 302, -64, -377, -366, -488, -574, -395, -308, -312, -299, -189, 
-	-123, -15, 201, 302, 227, 72, 38, 89, 19, -26, -124, -313, -488, -498, -423, -391, 
-	-280, -209, -203, -170, -69, 93, 96, 17, -2, -11, 32, 60, 1, -116, -196, -270, 
-	-254, -173, -84, -23, -21, 24, 104, 182, 203, 163, 112, 63, 37, 43, 28, 20
-};
-
-static const short ugen_H_10e065a0c[] = { 
-	0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-	0, 1, 3, 0, 10, 12, 1, -2, -3, 316, 1289, 949, -727, -427, -63, -385, 
-	1072, 2351, 2082, 2634, 3841, 2172, 273, 582, -533, -1934, -873, -303, -1480, -1715, -685, -75, 
-	-34, 286, 505, 205, 155, 305, 37, -303, -309, -357, -727, -783, -579, -663, -719, -472, 
-	-306, -319, -193, -86, -66, -59, -56, -14, -54, -120, -151, -199, -208, -190, -178, -238, 
-	-236, -166, -157, -173, -165, -139, -157, -133, -90, -102, -115, -109, -128, -174, -197, -169, 
-	-145, -142, -109, -87, -86, -105, -115, -119, -128, -91, -87, -90, -91, -67, -57, -93, 
-	-75, -61, -77, -112, -117, -112, -131, -120, -93, -48, -35, -18, -1, 0, 10, -13
-};
-
-static const short ugen_H_10e065a1c[] = { 
-	157, -248, 332, -66, 11204, 11203, -21504, -15707, 8278, 8750, 4592, 8374, 26057, 15954, -9523, -9063, 
-	-1276, -2431, -2622, -7804, -10218, -7536, -6068, -724, -1999, -294, 4176, 3065, 3795, 6340, 3259, -132, 
-	-1261, -2270, -1502, -3532, -3331, -2481, -2910, -2105, -1795, -1555, 240, 1572, 1431, 1410, 1322, 1681, 
-	1364, 765, 670, -172, -980, -1168, -1484, -1471, -1246, -1124, -909, -777, -284, 494, 387, 374, 
-	660, 629, 415, 318, 429, 226, -233, -370, -386, -619, -511, -323, -289, -319, -231, -124, 
-	-91, 84, 296, 317, 175, 44, 40, 1, -42, -51, -168, -387, -529, -482, -406, -301, 
-	-204, -197, -222, -141, -12, 115, 75, -18, -22, 10, 87, 58, -70, -184, -239, -244, 
-	-220, -156, -37, -11, -21, 42, 146, 186, 158, 110, 79, 67, 69, 64, 25, 19
-};
-
-static const short ugen_H_10e070a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-	0, 2, 0, 0, 4, 12, 0, 2, 7, -5, 186, 1109, 1097, -566, -509, 79, 
-	-82, 1078, 1789, 1449, 2167, 3832, 2879, 526, 563, 436, -856, -1003, -899, -1815, -1680, -299, 
-	8, -605, -513, 22, 22, 62, 321, 108, -195, -162, -176, -464, -606, -520, -503, -514, 
-	-406, -346, -380, -308, -215, -185, -195, -154, -87, -90, -141, -112, -77, -91, -113, -160, 
-	-216, -221, -190, -193, -198, -163, -147, -185, -174, -135, -117, -133, -142, -135, -137, -129, 
-	-109, -106, -120, -99, -65, -89, -126, -138, -146, -157, -151, -118, -111, -100, -55, -40, 
-	-56, -51, -45, -85, -128, -146, -146, -118, -82, -59, -56, -29, 14, 31, 30, 4
-};
-
-static const short ugen_H_10e070a1c[] = { 
-	141, -229, 252, 1106, 15435, 3490, -27670, -6976, 12116, 6600, 3134, 15217, 27472, 4426, -12928, -4677, 
-	384, -733, -4011, -10540, -9359, -7281, -3865, -636, -2932, 1414, 3978, 2327, 4379, 5483, 1281, -469, 
-	-1189, -1132, -1471, -3390, -2520, -2786, -2611, -1787, -2118, -1469, 652, 1367, 1129, 1008, 1349, 1867, 
-	1134, 754, 624, -387, -918, -1083, -1560, -1451, -1070, -985, -904, -802, -33, 468, 231, 438, 
-	655, 579, 358, 406, 448, 76, -344, -347, -449, -626, -447, -314, -280, -281, -167, -110, 
-	-69, 188, 370, 307, 123, -5, 11, -23, -45, -82, -242, -457, -528, -449, -381, -267, 
-	-179, -216, -196, -68, 52, 103, 25, -40, -36, 28, 71, 17, -111, -202, -247, -226, 
-	-174, -101, -5, -29, -55, 18, 136, 188, 146, 78, 59, 68, 105, 96, 46, 10
-};
-
-static const short ugen_H_10e075a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-	0, 0, 0, 0, 4, 1, 2, 2, 16, -5, -1, 146, 913, 1031, -326, -246, 
-	588, -176, -11, 1527, 1966, 2046, 3317, 3194, 1384, 1143, 801, -1062, -1683, -977, -1008, -1217, 
-	-909, -860, -1120, -790, -136, -20, 5, 311, 311, 21, -52, -32, -279, -469, -358, -316, 
-	-464, -482, -399, -465, -449, -369, -302, -268, -208, -107, -80, -68, -13, 20, -47, -107, 
-	-147, -219, -229, -191, -166, -191, -202, -199, -216, -195, -170, -147, -131, -114, -96, -69, 
-	-76, -88, -75, -88, -105, -95, -110, -174, -196, -185, -174, -158, -113, -83, -82, -49, 
-	-41, -67, -62, -55, -90, -137, -133, -98, -66, -58, -64, -49, 10, 60, 43, 1
-};
-
-static const short ugen_H_10e075a1c[] = { 
-	68, -111, 41, 2807, 17714, -4537, -29206, 631, 13209, 4265, 3601, 21508, 24145, -4861, -12285, -870, 
-	2086, -359, -5972, -11578, -9044, -6118, -2470, -1924, -2458, 2584, 3040, 1943, 4844, 4349, -12, -754, 
-	-874, -272, -1529, -2755, -1878, -2768, -2507, -1832, -2096, -1266, 545, 967, 729, 752, 1484, 1804, 
-	959, 878, 575, -488, -844, -1007, -1454, -1295, -953, -912, -980, -808, 80, 330, 109, 460, 
-	658, 492, 338, 492, 427, -82, -373, -315, -502, -594, -384, -304, -308, -252, -118, -110, 
-	-26, 262, 372, 261, 59, -51, -25, -1, -9, -125, -332, -518, -522, -425, -356, -257, 
-	-198, -233, -164, -21, 99, 108, -20, -82, -67, -6, 31, -7, -114, -197, -231, -204, 
-	-144, -55, -5, -95, -121, -19, 112, 174, 129, 72, 44, 85, 135, 106, 58, 7
-};
-
-static const short ugen_H_10e080a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-	0, -1, 1, 2, 0, 0, 0, 12, 3, 9, 6, -1, 128, 735, 961, 481, 
-	62, -451, -451, 492, 1673, 1984, 1880, 3102, 3992, 2254, 408, -186, -876, -885, -435, -1029, 
-	-1930, -1818, -1188, -1080, -886, -363, -14, 195, 432, 445, 185, 38, 21, -53, -268, -328, 
-	-332, -467, -534, -498, -565, -583, -458, -346, -288, -224, -94, -18, 15, 41, 22, -27, 
-	-115, -150, -174, -193, -184, -200, -221, -257, -242, -233, -213, -159, -129, -93, -73, -47, 
-	-46, -60, -54, -69, -100, -142, -148, -164, -210, -201, -179, -161, -142, -93, -76, -99, 
-	-77, -63, -55, -50, -62, -79, -81, -62, -57, -56, -57, -46, -16, 30, 32, -21
-};
-
-static const short ugen_H_10e080a1c[] = { 
-	-12, 15, -158, 4342, 18470, -10637, -28396, 5711, 13078, 2639, 4886, 25688, 19218, -10943, -10103, 2583, 
-	3143, -1033, -6795, -12539, -8641, -4398, -2560, -3038, -1716, 3429, 1965, 1433, 5296, 3498, -920, -773, 
-	-472, -256, -1275, -1907, -1610, -2376, -2122, -2173, -2169, -820, 336, 247, 392, 731, 1377, 1593, 
-	986, 934, 508, -430, -717, -903, -1225, -1060, -904, -901, -998, -756, 19, 137, 61, 489, 
-	606, 391, 321, 544, 400, -131, -326, -298, -512, -549, -314, -293, -334, -232, -85, -90, 
-	43, 304, 322, 184, 20, -50, -23, 16, 20, -127, -374, -549, -526, -412, -316, -219, 
-	-218, -255, -136, 26, 143, 123, -55, -137, -93, -20, 24, -22, -100, -160, -174, -150, 
-	-136, -61, -48, -135, -136, -24, 102, 144, 127, 82, 69, 116, 167, 134, 81, 21
-};
-
-static const short ugen_H_10e085a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-	0, -1, 3, 3, 0, -3, 8, 8, 3, 5, 24, -21, 9, 227, 981, 1285, 
-	-97, -674, 19, 341, 624, 1366, 2172, 2686, 3389, 3305, 1241, -391, 218, 529, -489, -1319, 
-	-1863, -2192, -1879, -1263, -1120, -956, -271, 212, 336, 468, 504, 271, 148, 161, 24, -265, 
-	-374, -346, -473, -607, -626, -611, -580, -480, -363, -298, -200, -57, 44, 34, 17, 62, 
-	-2, -77, -124, -149, -189, -221, -220, -281, -290, -234, -187, -172, -146, -88, -55, -40, 
-	-46, -40, -47, -83, -90, -124, -171, -184, -180, -186, -183, -169, -166, -151, -104, -78, 
-	-95, -83, -47, -32, -22, -13, -14, -18, -34, -45, -50, -50, -42, -34, -19, -43
-};
-
-static const short ugen_H_10e085a1c[] = { 
-	-55, 84, -259, 5072, 18615, -13707, -27473, 8240, 12789, 1927, 5830, 27506, 15296, -14454, -7849, 5651, 
-	3540, -1792, -6865, -13359, -8160, -3072, -3056, -3918, -1300, 3944, 1173, 1004, 5158, 3138, -1201, -822, 
-	-117, -391, -1219, -1253, -1061, -2191, -1737, -1965, -2406, -854, 421, -181, -259, 654, 1336, 1294, 
-	924, 1007, 501, -418, -477, -672, -1064, -875, -795, -866, -1033, -695, -52, -65, -49, 490, 
-	550, 270, 285, 552, 409, -102, -274, -255, -492, -510, -260, -285, -326, -217, -57, -90, 
-	62, 319, 271, 123, -8, -47, -26, 21, 53, -114, -364, -556, -531, -392, -310, -198, 
-	-228, -257, -122, 48, 150, 68, -83, -138, -86, -9, 15, -23, -88, -106, -129, -144, 
-	-157, -105, -76, -162, -122, -10, 82, 126, 113, 92, 77, 141, 201, 162, 111, 28
-};
-
-static const short ugen_H_10e090a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 
-	0, -2, 4, 5, -4, 1, 8, 14, -7, 18, -1, -4, 15, 376, 985, 323, 
-	-147, 242, 367, 394, 329, 778, 2007, 3206, 2735, 1664, 1450, 940, 721, 1138, 395, -1360, 
-	-2092, -1900, -1905, -1833, -1429, -1005, -603, -119, 242, 388, 454, 492, 378, 247, 101, -69, 
-	-262, -366, -395, -546, -660, -607, -562, -556, -493, -392, -271, -175, -57, 8, 69, 92, 
-	63, 9, -84, -110, -159, -221, -262, -267, -238, -245, -201, -174, -152, -105, -78, -53, 
-	-69, -70, -76, -69, -90, -118, -124, -180, -183, -168, -187, -210, -211, -162, -129, -91, 
-	-78, -91, -45, -5, 22, 32, 31, 12, -15, -39, -66, -81, -86, -86, -84, -75
-};
-
-static const short ugen_H_10e090a1c[] = { 
-	-34, 42, -209, 4645, 18784, -13362, -27808, 8583, 12849, 1879, 5901, 27386, 13813, -16256, -6564, 8328, 
-	3926, -2411, -6602, -13713, -8074, -2298, -3346, -4574, -1508, 4179, 828, 535, 4864, 2839, -1232, -506, 
-	-20, -495, -998, -1172, -611, -1736, -1590, -1709, -2129, -1070, 114, -223, -558, 158, 1100, 1251, 
-	745, 908, 579, -336, -326, -393, -838, -764, -692, -772, -1007, -713, -86, -194, -273, 386, 
-	523, 199, 205, 535, 421, -69, -207, -183, -453, -495, -214, -260, -312, -213, -46, -114, 
-	31, 301, 246, 87, -46, -74, -47, 27, 73, -90, -334, -517, -520, -391, -313, -217, 
-	-219, -244, -142, -6, 101, 44, -103, -119, -62, 12, 33, -9, -78, -125, -142, -168, 
-	-166, -122, -111, -172, -118, 20, 76, 97, 101, 82, 78, 142, 226, 182, 133, 45
-};
-
-static const short ugen_H_10e095a0c[] = { 
-	0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 
-	0, 0, 3, 3, -2, 0, 17, 7, 6, 0, -11, 0, 213, 863, 439, -565, 
-	-183, 818, 959, 449, 437, 1050, 2184, 2523, 2075, 1256, 110, 800, 1888, 1486, 581, -527, 
-	-1630, -1959, -1634, -1671, -1729, -1247, -662, -389, -139, 189, 357, 452, 456, 347, 212, -11, 
-	-148, -247, -376, -458, -523, -568, -564, -518, -520, -500, -415, -299, -161, -32, 81, 89, 
-	57, 50, 2, -53, -161, -198, -202, -206, -205, -223, -212, -187, -148, -123, -114, -116, 
-	-114, -103, -88, -63, -75, -105, -104, -125, -169, -207, -221, -223, -207, -158, -129, -120, 
-	-88, -46, -16, 14, 51, 68, 56, 24, -18, -60, -90, -106, -121, -126, -113, -100
-};
-
-static const short ugen_H_10e095a1c[] = { 
-	53, -108, 25, 3114, 18683, -9262, -29416, 6493, 13598, 2221, 5111, 25516, 15034, -16348, -7059, 10459, 
-	5101, -2789, -6318, -13506, -8418, -2105, -3382, -4739, -2532, 4016, 1194, -168, 4384, 2972, -1292, -406, 
-	455, -521, -847, -1103, -477, -1518, -1225, -1395, -2117, -903, 10, -595, -683, 13, 576, 1011, 
-	737, 800, 540, -254, -177, -194, -599, -560, -596, -730, -894, -694, -166, -250, -461, 205, 
-	462, 172, 132, 478, 459, -56, -147, -90, -373, -477, -169, -202, -297, -213, -79, -114, 
-	5, 252, 210, 63, -52, -100, -76, 19, 96, -26, -287, -480, -474, -365, -309, -231, 
-	-249, -291, -190, -35, 67, 30, -108, -110, -9, 60, 79, 3, -103, -179, -188, -164, 
-	-166, -122, -100, -169, -127, 26, 102, 80, 83, 78, 77, 138, 225, 205, 133, 53
-};
-
-static const short ugen_H_10e100a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 
-	0, 1, 0, 1, 0, 0, 13, 3, 22, -23, -20, 96, 802, 798, -644, -617, 
-	424, 682, 904, 923, 957, 1935, 2197, 1482, 1054, 1053, 183, -591, 1074, 2033, 1043, 39, 
-	-731, -1376, -1528, -1349, -1418, -1338, -984, -558, -411, -235, 185, 290, 297, 334, 279, 102, 
-	-116, -212, -217, -304, -414, -467, -499, -462, -498, -567, -542, -411, -223, -105, -35, 24, 
-	64, 50, 25, -32, -103, -99, -113, -150, -197, -206, -178, -196, -194, -169, -170, -176, 
-	-159, -121, -105, -82, -63, -70, -105, -144, -162, -221, -233, -203, -192, -169, -136, -87, 
-	-82, -47, 15, 35, 61, 68, 46, -11, -48, -80, -121, -136, -140, -142, -144, -111
-};
-
-static const short ugen_H_10e100a1c[] = { 
-	189, -329, 386, 1065, 17123, -1609, -30495, 1110, 14948, 2910, 3644, 22072, 18032, -13996, -9489, 11447, 
-	7465, -2561, -6257, -12776, -9058, -2419, -3279, -4475, -3915, 2902, 2304, -740, 3340, 3289, -818, -624, 
-	660, 27, -634, -1297, -237, -1311, -1404, -855, -1948, -1140, 216, -518, -1157, -188, 498, 660, 
-	451, 793, 635, -316, -190, 56, -419, -417, -400, -636, -842, -698, -175, -232, -574, -5, 
-	382, 127, 67, 378, 476, -7, -151, -20, -255, -435, -133, -117, -264, -221, -95, -123, 
-	-55, 195, 184, 21, -76, -103, -88, 14, 111, 42, -223, -430, -417, -303, -276, -297, 
-	-336, -358, -215, -30, 37, 14, -83, -75, 25, 85, 87, -5, -107, -195, -219, -185, 
-	-149, -108, -76, -143, -144, 5, 114, 114, 74, 66, 77, 133, 219, 203, 125, 42
-};
-
-static const short ugen_H_10e105a0c[] = { 
-	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 
-	0, 3, -1, 3, -6, 10, 0, 19, 0, -5, -6, 619, 1178, -357, -1064, 92, 
-	729, 695, 597, 1252, 2319, 2441, 1497, 684, 552, 598, 10, -832, -428, 892, 1478, 945, 
-	114, -517, -959, -1029, -997, -1060, -1080, -966, -704, -414, -188, -21, 85, 165, 210, 122, 
-	-6, -130, -125, -107, -258, -337, -354, -429, -521, -543, -514, -454, -350, -256, -166, -59, 
-	25, 24, -12, 14, 40, 0, -65, -104, -137, -173, -178, -189, -237, -269, -224, -177, 
-	-178, -157, -120, -92, -65, -69, -130, -194, -178, -154, -176, -198, -195, -153, -97, -54, 
-	-40, -44, -7, 49, 65, 36, -14, -52, -80, -90, -127, -157, -155, -146, -122, -98
-};
-
-static const short ugen_H_10e105a1c[] = { 
-	280, -458, 620, -439, 13193, 7832, -28248, -8303, 15886, 4873, 1587, 17541, 21462, -8727, -13227, 10254, 
-	11040, -1096, -6336, -12076, -9796, -3078, -3223, -4064, -4841, 746, 3531, -434, 1737, 3383, -67, -611, 
-	570, 265, -84, -1227, -391, -796, -1655, -904, -1429, -1181, 43, -180, -1116, -694, 178, 747, 
-	243, 311, 748, -102, -395, 94, -133, -281, -223, -458, -742, -762, -252, -92, -560, -304, 
-	269, 118, 11, 236, 474, 111, -173, 0, -104, -360, -154, -34, -202, -243, -141, -118, 
-	-136, 112, 183, 14, -105, -109, -55, 18, 105, 91, -122, -352, -384, -285, -301, -357, 
-	-372, -378, -271, -71, 58, 60, -29, -81, 8, 51, 65, 18, -86, -188, -230, -170, 
-	-146, -112, -51, -92, -146, -35, 113, 139, 95, 58, 66, 120, 195, 208, 112, 31
-};
-
-static const short ugen_H_10e110a0c[] = { 
-	0, 1, 0, 0, 2, 0, 1, 0, 0, 0, 0, 2, 0, 0, 3, -1, 
-	6, 0, 3, 0, 1, 1, 11, 11, 0, -11, 405, 1370, 157, -1354, -275, 650, 
-	677, 658, 997, 2130, 3025, 2044, 534, 343, 498, 4, -618, -884, -938, -421, 693, 1394, 
-	1177, 450, -160, -461, -555, -724, -974, -1159, -1025, -611, -502, -438, -179, -51, -28, 41, 
-	90, 59, -12, -26, -37, -132, -271, -378, -441, -456, -449, -480, -479, -416, -275, -154, 
-	-81, -5, 52, 68, 74, 66, 28, -27, -95, -131, -165, -235, -272, -277, -269, -213, 
-	-166, -155, -150, -102, -92, -135, -158, -164, -146, -128, -125, -151, -157, -105, -54, -26, 
-	-22, -17, -12, 7, 8, -18, -57, -92, -92, -98, -125, -154, -147, -109, -80, -65
-};
-
-static const short ugen_H_10e110a1c[] = { 
-	193, -285, 374, -583, 7073, 14971, -18949, -19452, 12867, 8986, -182, 11461, 23341, -257, -15716, 5779, 
-	14407, 2034, -5730, -11528, -10732, -3705, -3263, -4055, -4917, -1771, 3454, 1025, 336, 2770, 729, -386, 
-	670, 315, 103, -780, -421, -427, -1656, -1190, -1246, -1089, -58, -105, -887, -723, -301, 499, 
-	485, -5, 431, 153, -372, -95, -38, -177, -76, -288, -584, -748, -381, 2, -344, -510, 
-	33, 130, -24, 88, 372, 230, -167, -51, 29, -248, -191, 29, -124, -250, -205, -114, 
-	-187, -40, 147, 58, -80, -132, -64, 15, 119, 149, -26, -260, -414, -375, -299, -330, 
-	-361, -424, -344, -111, 100, 130, -5, -137, -78, 42, 50, 18, -57, -138, -203, -183, 
-	-144, -129, -45, -42, -132, -74, 82, 154, 117, 56, 31, 85, 176, 205, 115, 20
-};
-
-static const short ugen_H_10e115a0c[] = { 
-	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 
-	2, 1, 2, 1, 2, 0, 16, 2, 2, 187, 1436, 830, -1551, -788, 698, 668, 
-	521, 950, 2292, 3306, 2238, 667, 350, 275, 34, -612, -1113, -1072, -1063, -801, -129, 876, 
-	1578, 1418, 853, 326, -143, -459, -817, -1093, -1039, -1018, -860, -698, -556, -362, -246, -120, 
-	84, 205, 147, 97, 49, 9, -104, -243, -320, -395, -443, -507, -560, -509, -415, -256, 
-	-89, -24, 14, 69, 93, 114, 89, 11, -41, -102, -186, -255, -274, -287, -288, -248, 
-	-186, -160, -172, -178, -166, -153, -136, -140, -130, -110, -92, -80, -84, -56, -45, -31, 
-	-15, -22, -36, -67, -86, -101, -96, -105, -117, -118, -126, -110, -93, -73, -61, -53
-};
-
-static const short ugen_H_10e115a1c[] = { 
-	-49, 126, -217, 212, 1505, 15381, -3486, -25965, 2665, 13658, 858, 4083, 21520, 10237, -14263, -1585, 
-	15629, 6761, -3965, -10224, -12274, -4713, -2776, -4677, -4671, -3518, 1692, 2510, 198, 1585, 1205, -134, 
-	845, 607, 84, -501, -434, 123, -1401, -1591, -1122, -1220, -283, 126, -740, -755, -360, 92, 
-	479, 50, 194, 155, -320, -194, -13, -279, -71, -75, -387, -633, -480, -11, -140, -496, 
-	-201, 71, -51, -24, 211, 267, -102, -115, 93, -91, -216, 6, -64, -222, -240, -174, 
-	-210, -168, 65, 101, -13, -133, -113, 9, 145, 188, 28, -264, -452, -410, -281, -306, 
-	-382, -427, -357, -126, 63, 88, -26, -139, -119, -3, 19, -2, -15, -70, -177, -221, 
-	-163, -114, -62, -13, -99, -115, 26, 135, 123, 41, 5, 37, 144, 205, 133, 5
-};
-
-static const short ugen_H_10e120a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 
-	0, 5, -1, 10, -9, 22, -10, 31, 50, 1261, 1583, -1375, -1564, 609, 862, 461, 
-	739, 2303, 3888, 2849, 630, 11, 187, 152, -806, -1424, -1131, -1203, -1071, -728, -249, 413, 
-	1093, 1751, 1800, 1176, 377, -294, -679, -712, -1011, -1321, -1193, -952, -846, -696, -464, -226, 
-	37, 239, 250, 162, 216, 154, 29, -104, -208, -307, -466, -552, -595, -557, -418, -254, 
-	-166, -130, -24, 87, 123, 113, 88, 52, -27, -83, -131, -227, -292, -296, -280, -252, 
-	-237, -219, -233, -219, -165, -127, -126, -133, -93, -61, -37, -23, -21, -29, -27, -21, 
-	-38, -68, -101, -126, -147, -160, -140, -130, -133, -101, -61, -53, -54, -38, -25, -29
-};
-
-static const short ugen_H_10e120a1c[] = { 
-	-167, 283, -390, 471, -569, 8857, 10428, -20328, -12536, 13199, 6352, -1461, 13919, 19258, -6375, -9190, 
-	12290, 12436, -1126, -7821, -12521, -7786, -1800, -4736, -5212, -4140, -706, 2652, 1050, 906, 1283, -48, 
-	647, 1338, 216, -437, -562, 320, -445, -1833, -1300, -1178, -758, 127, -321, -853, -414, -59, 
-	360, 125, 60, 239, -229, -424, 0, -212, -342, -26, -133, -397, -513, -109, 25, -374, 
-	-358, 21, -46, -132, 25, 248, 44, -152, 70, 80, -189, -112, -12, -163, -249, -249, 
-	-212, -208, -24, 103, 47, -55, -89, -13, 116, 146, 10, -198, -373, -412, -323, -301, 
-	-352, -339, -311, -217, -72, 15, 5, -68, -130, -63, 8, 21, 4, -47, -135, -206, 
-	-172, -96, -54, -9, -39, -125, -42, 92, 118, 56, 13, 25, 102, 186, 168, 41
-};
-
-static const short ugen_H_10e125a0c[] = { 
-	2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, -1, 
-	10, -4, 12, -6, 18, -5, 32, 0, 961, 2205, -795, -2404, 272, 1128, 480, 573, 
-	2258, 4348, 3517, 913, -77, -48, -81, -799, -1636, -1666, -1365, -1024, -887, -534, 79, 319, 
-	666, 1533, 2034, 1644, 897, 54, -340, -573, -967, -1319, -1423, -1221, -1049, -949, -691, -202, 
-	-15, 56, 287, 394, 330, 185, 112, 40, -137, -256, -455, -573, -515, -448, -417, -398, 
-	-271, -117, -8, 22, 88, 124, 69, 24, -6, -20, -76, -191, -270, -309, -291, -277, 
-	-303, -297, -238, -181, -166, -136, -96, -62, -45, -27, 0, 19, 20, 1, -23, -49, 
-	-91, -128, -167, -187, -176, -184, -180, -141, -91, -47, -19, -11, -9, -2, -2, -14
-};
-
-static const short ugen_H_10e125a1c[] = { 
-	-3, -16, 69, -135, 114, 1680, 13437, -3466, -21893, 2474, 12450, -459, 2877, 20297, 7371, -11512, 
-	3494, 16141, 4238, -6135, -9740, -10808, -3661, -2878, -5955, -4800, -2603, 1386, 1754, 806, 1513, 382, 
-	-220, 1542, 1241, -408, -747, -17, 423, -1191, -1640, -1229, -1059, -286, -67, -680, -530, -129, 
-	189, 327, 0, 200, 70, -520, -315, -2, -366, -289, -71, -150, -373, -266, 83, -109, 
-	-438, -123, 47, -153, -162, 132, 226, -78, -32, 169, -63, -262, -57, -83, -234, -265, 
-	-201, -204, -117, 90, 128, 38, -31, -50, -37, 50, 87, -39, -281, -439, -381, -247, 
-	-238, -295, -340, -335, -181, 9, 42, -35, -120, -72, 34, 36, -4, -50, -88, -141, 
-	-135, -89, -65, -12, 5, -100, -115, 37, 122, 88, 50, 51, 69, 144, 192, 112
-};
-
-static const short ugen_H_10e130a0c[] = { 
-	0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 2, -1, 6, 
-	-4, 6, -4, 6, 7, 11, 8, 618, 2581, 151, -3125, -454, 1436, 626, 409, 2159, 
-	4861, 4231, 1100, -62, -126, -201, -833, -2085, -2104, -1532, -1378, -1064, -490, 48, 247, 416, 
-	884, 1247, 1423, 1585, 1098, 579, 133, -637, -996, -1149, -1370, -1452, -1317, -1021, -666, -413, 
-	-96, 106, 333, 413, 277, 238, 199, 72, -136, -260, -326, -363, -444, -492, -492, -441, 
-	-255, -132, -88, -4, 44, 42, 16, 56, 66, 7, -80, -167, -262, -322, -324, -347, 
-	-330, -289, -235, -191, -161, -110, -57, -11, -6, -8, 22, 42, 32, 9, -42, -121, 
-	-178, -212, -219, -214, -215, -195, -153, -96, -54, -34, -18, 12, 29, 10, -11, -11
-};
-
-static const short ugen_H_10e130a1c[] = { 
-	90, -153, 217, -265, 322, -429, 6314, 10554, -14377, -13483, 10348, 6752, -3304, 10450, 18476, -2968, 
-	-6327, 12925, 11987, -3467, -7728, -9404, -7818, -2609, -4739, -5798, -3984, -830, 1872, 939, 1274, 1558, 
-	-257, 232, 1952, 687, -811, -634, 422, -103, -1449, -1324, -1254, -907, -165, -416, -702, -144, 
-	87, 331, 247, 69, 213, -216, -600, -175, -116, -394, -239, -127, -239, -332, -61, 124, 
-	-243, -367, -25, -27, -169, -45, 225, 99, -79, 82, 45, -297, -240, -44, -190, -268, 
-	-208, -157, -143, 40, 169, 72, -44, -141, -124, 37, 136, 16, -221, -369, -367, -247, 
-	-221, -349, -402, -341, -216, -80, 0, -12, -54, -65, -4, 29, -8, -36, -62, -97, 
-	-111, -80, -82, -75, -22, -75, -147, -39, 108, 114, 70, 64, 62, 102, 152, 129
-};
-
-static const short ugen_H_10e135a0c[] = { 
-	2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, -1, 5, 3, 
-	-3, 8, -10, 26, -9, 44, 324, 2664, 1317, -3495, -1538, 1613, 906, 302, 2067, 5333, 
-	4999, 1373, -62, -233, -371, -731, -2251, -2676, -1989, -1551, -1175, -897, -6, 556, 351, 849, 
-	1276, 880, 833, 1000, 1053, 880, 220, -390, -919, -1090, -1199, -1469, -1476, -1013, -607, -428, 
-	-113, 166, 261, 249, 303, 298, 113, 6, -8, -124, -219, -312, -403, -459, -475, -392, 
-	-257, -197, -136, -61, -47, -24, 62, 131, 89, -10, -86, -192, -302, -318, -326, -339, 
-	-322, -266, -227, -175, -120, -80, -48, 9, 45, 30, 39, 47, 29, -32, -111, -194, 
-	-253, -272, -245, -206, -181, -149, -108, -64, -30, -18, -12, 5, 29, 26, 6, -15
-};
-
-static const short ugen_H_10e135a1c[] = { 
-	-44, 63, -107, 154, -234, 273, 280, 9774, 3337, -17782, -3604, 11408, 480, -1304, 15869, 12076, 
-	-6754, 2200, 15887, 4079, -7411, -6852, -8354, -5795, -3277, -5679, -5297, -2842, 435, 1519, 666, 1803, 
-	1274, -425, 942, 1665, 109, -833, -268, 333, -675, -1312, -1140, -1364, -845, -220, -661, -507, 
-	112, 311, 426, 183, 181, 98, -403, -463, -122, -275, -378, -183, -186, -371, -330, 58, 
-	72, -322, -280, 8, -35, -68, 121, 211, -53, -118, 57, -126, -389, -207, -131, -246, 
-	-199, -84, -82, -73, 87, 46, -94, -110, -75, -13, 45, 32, -94, -240, -334, -355, 
-	-302, -335, -373, -346, -299, -184, -46, 20, -15, -57, -43, 18, 22, -20, -45, -74, 
-	-99, -98, -96, -122, -112, -82, -113, -93, 51, 130, 108, 76, 60, 68, 94, 105
-};
-
-static const short ugen_H_10e140a0c[] = { 
-	3, 0, 0, 0, 0, 0, 1, 0, -1, 2, 1, 0, 2, -3, 13, -11, 
-	16, -21, 35, -28, 74, 129, 2493, 2492, -3404, -2841, 1538, 1278, 234, 1994, 5842, 5790, 
-	1609, 11, -186, -718, -799, -2246, -3087, -2339, -1858, -1506, -1066, -109, 490, 367, 968, 1463, 
-	1040, 721, 491, 413, 762, 553, 140, -166, -596, -987, -1291, -1388, -1122, -881, -610, -345, 
-	-144, 115, 170, 191, 210, 194, 166, 106, -80, -145, -149, -220, -322, -440, -372, -291, 
-	-322, -282, -190, -117, -74, -4, 99, 119, 47, -41, -133, -254, -282, -295, -319, -311, 
-	-269, -211, -198, -165, -109, -60, -8, 16, 52, 71, 61, 31, -45, -132, -215, -260, 
-	-273, -244, -206, -175, -147, -114, -64, -28, -22, -31, -21, 6, 26, 17, -7, -20
-};
-
-static const short ugen_H_10e140a1c[] = { 
-	-37, 28, -36, 23, -14, -13, -44, 2085, 10410, -3555, -15597, 3448, 8154, -3318, 3264, 17232, 
-	5999, -5189, 9264, 13027, -3007, -7371, -5592, -7706, -4759, -4076, -6128, -4618, -1601, 1145, 925, 761, 
-	2206, 806, 68, 1423, 992, -305, -550, 57, -44, -1087, -1143, -1108, -1473, -720, -400, -784, 
-	-163, 323, 388, 494, 315, 239, -4, -371, -287, -197, -438, -318, -159, -244, -445, -319, 
-	21, -96, -298, -66, 101, 2, 49, 183, 83, -178, -101, 5, -290, -408, -156, -136, 
-	-186, -85, -29, -127, -108, 58, 33, -47, -90, -92, -14, 75, 21, -177, -325, -362, 
-	-312, -282, -373, -398, -334, -223, -97, 0, 25, -18, -28, 7, 65, 18, -36, -52, 
-	-81, -115, -125, -114, -145, -123, -77, -96, -16, 133, 166, 97, 55, 60, 69, 91
-};
-
-static const short ugen_H_10e145a0c[] = { 
-	0, 0, -1, -1, -1, 0, 0, -3, -2, 3, -3, 1, -9, 12, -16, 17, 
-	-26, 34, -37, 77, 32, 2179, 3508, -2888, -4189, 1180, 1704, 184, 1913, 6436, 6606, 1774, 
-	84, 4, -1009, -1028, -2343, -3514, -2585, -1993, -1785, -1370, -400, 659, 415, 685, 1675, 1377, 
-	757, 598, 295, 207, 40, 27, 25, -175, -441, -904, -1188, -928, -692, -769, -601, -293, 
-	-36, -19, -6, 194, 262, 124, 50, -34, -94, -81, -142, -230, -266, -268, -286, -355, 
-	-357, -224, -164, -150, -87, 25, 67, -17, -52, -66, -190, -256, -260, -274, -279, -230, 
-	-212, -224, -185, -108, -58, -50, -1, 33, 60, 55, 5, -70, -169, -245, -271, -256, 
-	-215, -171, -150, -152, -132, -84, -36, -31, -44, -43, -33, 4, 9, -22, -40, -37
-};
-
-static const short ugen_H_10e145a1c[] = { 
-	35, -65, 68, -85, 96, -123, 141, -203, 3979, 8936, -7991, -11001, 6525, 3483, -3768, 7467, 
-	15811, 2428, -1025, 12591, 7167, -6755, -5382, -5074, -7454, -4175, -4822, -6197, -3624, -676, 1378, 357, 
-	1068, 2316, 640, 745, 1512, 347, -485, -137, 102, -490, -1400, -1032, -1185, -1530, -672, -581, 
-	-660, 78, 422, 495, 532, 464, 426, -12, -351, -231, -347, -469, -272, -241, -367, -441, 
-	-277, -140, -234, -153, 142, 118, -2, 83, 152, 9, -202, -139, -132, -331, -267, -104, 
-	-160, -187, -112, -78, -119, 1, 89, -29, -106, -81, -33, -9, -7, -99, -209, -281, 
-	-337, -334, -349, -398, -362, -265, -153, -64, 20, 41, 10, 3, 41, 52, -20, -53, 
-	-77, -121, -138, -123, -130, -161, -121, -75, -49, 69, 160, 118, 60, 65, 68, 59
-};
-
-static const short ugen_H_10e150a0c[] = { 
-	0, -2, -1, -2, 0, -1, -2, -3, 3, -3, 4, -11, 12, -16, 14, -25, 
-	30, -30, 55, 9, 1806, 4280, -1985, -5433, 481, 2178, 203, 1730, 7076, 7555, 1844, 105, 
-	370, -1232, -1334, -2399, -4022, -3005, -2006, -1950, -1604, -611, 645, 413, 616, 1763, 1465, 848, 
-	738, 404, 229, -127, -425, -381, -465, -385, -399, -711, -649, -505, -528, -490, -442, -188, 
-	-110, -57, 168, 140, -44, 9, 8, -108, -139, -139, -111, -213, -263, -191, -249, -289, 
-	-203, -155, -162, -146, -45, -34, -93, -103, -109, -200, -217, -183, -216, -218, -208, -207, 
-	-237, -176, -71, -50, -25, 5, 8, 7, -1, -33, -128, -202, -237, -265, -251, -193, 
-	-132, -110, -109, -115, -101, -55, -32, -61, -69, -55, -28, -2, -21, -63, -76, -54
-};
-
-static const short ugen_H_10e150a1c[] = { 
-	-16, 33, -63, 68, -95, 112, -159, 188, -110, 5349, 6605, -9794, -6389, 6173, -151, -1963, 
-	9851, 13445, 1609, 3323, 11977, 1323, -7094, -3367, -5354, -7108, -4244, -5198, -5655, -2772, 48, 973, 
-	0, 1646, 2322, 603, 1197, 1486, 22, -451, 69, -86, -956, -1446, -1016, -1424, -1536, -652, 
-	-669, -492, 306, 544, 570, 621, 683, 531, -2, -304, -238, -426, -476, -288, -365, -494, 
-	-478, -181, -84, -274, -200, 96, 128, 98, 92, 56, -65, -157, -85, -197, -330, -195, 
-	-114, -203, -151, -54, -72, -107, -13, 13, -53, -51, -72, -93, -38, -42, -133, -221, 
-	-276, -347, -363, -339, -350, -294, -218, -119, -22, 47, 64, 27, 16, 34, 13, -48, 
-	-65, -87, -121, -137, -142, -142, -151, -97, -49, -4, 99, 132, 100, 72, 66, 47
-};
-
-static const short ugen_H_10e155a0c[] = { 
-	0, 0, -1, 0, 0, -1, -2, 4, -2, 7, -10, 12, -13, 12, -18, 18, 
-	-6, 26, 22, 1482, 4758, -881, -6369, -536, 2591, 367, 1504, 7657, 8664, 1909, -71, 882, 
-	-1294, -1741, -2449, -4441, -3572, -2095, -2053, -1844, -768, 752, 559, 375, 1741, 1757, 864, 666, 
-	509, 273, -45, -375, -706, -861, -631, -626, -791, -368, 49, -197, -343, -262, -94, 36, 
-	23, -41, -47, -97, -58, -59, -228, -191, -130, -162, -262, -258, -119, -117, -184, -88, 
-	-23, -128, -188, -106, -48, -135, -216, -180, -221, -241, -161, -156, -186, -181, -177, -211, 
-	-168, -29, 35, 33, 18, 0, -29, -84, -128, -157, -185, -245, -268, -228, -179, -124, 
-	-89, -69, -65, -52, -42, -50, -63, -69, -74, -64, -24, -22, -65, -95, -91, -59
-};
-
-static const short ugen_H_10e155a1c[] = { 
-	3, -8, 19, -44, 54, -85, 106, -152, 181, 127, 6068, 4386, -9564, -3308, 3968, -1620, 
-	319, 10300, 11620, 2937, 5970, 8619, -2292, -5377, -2483, -5911, -6614, -4737, -5293, -4316, -2311, 69, 
-	614, 24, 2218, 2137, 745, 1350, 1400, 226, -421, -213, -247, -1194, -1485, -1115, -1725, -1426, 
-	-720, -706, -176, 506, 650, 682, 746, 831, 490, -59, -139, -181, -514, -524, -385, -436, 
-	-491, -423, -165, -159, -291, -191, -33, 30, 155, 150, 24, -121, -99, -24, -226, -324, 
-	-125, -55, -135, -141, -119, -151, -141, -15, -22, -67, -49, -50, -106, -104, -93, -153, 
-	-214, -276, -300, -313, -325, -319, -263, -171, -79, 5, 44, 40, 37, 19, 24, -19, 
-	-57, -74, -103, -120, -145, -135, -153, -141, -72, -21, 25, 88, 112, 85, 70, 51
-};
-
-static const short ugen_H_10e160a0c[] = { 
-	-3, -2, 0, 0, -1, -4, 3, -3, 5, -9, 7, -10, 4, -11, 2, 5, 
-	8, 27, 1251, 4987, 195, -6868, -1767, 2783, 686, 1291, 8150, 9792, 2123, -409, 1289, -1115, 
-	-2161, -2556, -4798, -4179, -2252, -2137, -2138, -976, 837, 798, 407, 1669, 1807, 932, 736, 514, 
-	192, -194, -445, -403, -798, -1003, -996, -1154, -649, 51, 158, 21, 0, 395, 443, -25, 
-	-124, -6, -124, -258, -266, -306, -288, -278, -283, -323, -285, -90, -80, -91, 70, 89, 
-	-48, -148, -71, -64, -208, -255, -228, -270, -282, -192, -209, -228, -162, -160, -191, -126, 
-	31, 86, 58, 70, 2, -101, -167, -169, -170, -221, -248, -266, -242, -177, -119, -101, 
-	-96, -56, -23, 0, -11, -60, -88, -91, -76, -56, -48, -84, -125, -128, -102, -55
-};
-
-static const short ugen_H_10e160a1c[] = { 
-	4, -3, 1, 4, -26, 33, -63, 83, -122, 144, 403, 6246, 2781, -8296, -2146, 1651, 
-	-1275, 1791, 9622, 11135, 5018, 6036, 4716, -3129, -3513, -2658, -6124, -6366, -5069, -4978, -3175, -1887, 
-	-485, 478, 549, 2234, 1970, 1081, 1336, 1227, 625, -263, -781, -537, -1024, -1571, -1476, -1852, 
-	-1407, -737, -507, 123, 550, 702, 864, 867, 799, 468, -15, -158, -153, -456, -541, -497, 
-	-383, -375, -448, -344, -360, -340, -126, -6, -24, 30, 99, 97, -67, -100, -21, -73, 
-	-129, -92, -161, -220, -164, -139, -184, -186, -81, -42, -41, -48, -117, -157, -120, -82, 
-	-114, -197, -242, -269, -282, -330, -305, -211, -134, -64, -26, 16, 50, 49, 18, -7, 
-	-48, -76, -87, -109, -125, -142, -142, -151, -123, -48, -17, 18, 65, 79, 83, 66
-};
-
-static const short ugen_H_10e165a0c[] = { 
-	-3, 0, 0, -2, -5, 2, -4, 4, -7, 5, -8, 0, -7, -6, 10, 0, 
-	26, 1105, 5071, 1092, -6939, -2941, 2601, 1097, 1188, 8502, 10902, 2468, -688, 1494, -872, -2438, 
-	-2716, -5044, -4827, -2515, -2143, -2391, -1303, 827, 1048, 498, 1725, 1955, 983, 691, 598, -31, 
-	-405, -209, -424, -919, -1028, -990, -1318, -1035, -293, -181, 109, 674, 828, 570, 341, 253, 
-	107, -215, -390, -388, -516, -510, -434, -398, -391, -353, -172, -42, 0, 125, 168, 41, 
-	-42, -12, -12, -157, -267, -257, -297, -323, -259, -275, -319, -239, -130, -92, -67, 13, 
-	81, 96, 77, -19, -123, -153, -152, -189, -248, -266, -268, -236, -191, -140, -110, -105, 
-	-82, -41, 1, 13, -18, -55, -65, -80, -86, -88, -98, -125, -158, -160, -111, -12
-};
-
-static const short ugen_H_10e165a1c[] = { 
-	-3, 8, -10, 10, -6, -8, 10, -33, 49, -79, 93, 659, 6076, 1944, -6941, -2442, 
-	294, -165, 2094, 8956, 11844, 6315, 4221, 2111, -2349, -2548, -3105, -6084, -6300, -5098, -4158, -2785, 
-	-1841, -318, 171, 956, 2285, 1765, 1306, 1450, 1210, 511, -165, -737, -945, -1236, -1369, -1748, 
-	-2012, -1319, -615, -210, 228, 561, 708, 943, 1045, 781, 320, 27, -67, -258, -423, -348, 
-	-336, -413, -542, -589, -509, -439, -380, -188, -9, 69, 58, -6, 41, 83, 133, 83, 
-	-75, -159, -158, -190, -221, -209, -195, -210, -199, -122, -63, -61, -93, -138, -112, -67, 
-	-64, -90, -163, -213, -272, -292, -289, -252, -178, -134, -81, -28, 38, 65, 31, 6, 
-	-31, -68, -89, -88, -90, -131, -138, -134, -128, -103, -56, -19, 3, 64, 93, 85
-};
-
-static const short ugen_H_10e170a0c[] = { 
-	-2, 0, -1, -5, 1, -3, 4, -8, 6, -8, 0, -7, -4, 4, 0, 22, 
-	1027, 5093, 1705, -6722, -3808, 2114, 1372, 1280, 8747, 11881, 2975, -891, 1627, -703, -2651, -2863, 
-	-5225, -5388, -2897, -2177, -2584, -1588, 732, 1156, 555, 1844, 2170, 1220, 708, 208, 49, -205, 
-	-413, -534, -1042, -1191, -1005, -1203, -1172, -681, -230, 217, 387, 735, 1078, 861, 555, 319, 
-	28, -304, -569, -708, -704, -621, -553, -538, -476, -210, -21, -16, 116, 233, 140, -7, 
-	22, 130, -17, -202, -241, -321, -379, -326, -312, -378, -290, -139, -100, -52, 51, 110, 
-	41, -7, -35, -81, -93, -131, -179, -230, -260, -267, -257, -203, -165, -132, -116, -91, 
-	-47, -17, 1, -18, -25, -24, -50, -86, -105, -113, -139, -162, -177, -153, -57, 41
-};
-
-static const short ugen_H_10e170a1c[] = { 
-	3, -4, 11, -12, 15, -13, 4, -8, -6, 15, -31, 41, 863, 5759, 1728, -6080, 
-	-3334, 71, 702, 1784, 8908, 12762, 6329, 2008, 1106, -1308, -2354, -3436, -5909, -6258, -4879, -3333, 
-	-2552, -2211, -158, 808, 821, 1950, 2003, 1435, 1477, 1122, 379, -364, -614, -801, -1602, -1646, 
-	-1502, -1835, -1394, -505, -16, 270, 457, 840, 1078, 904, 673, 367, 66, -14, -102, -290, 
-	-332, -399, -496, -699, -754, -592, -510, -425, -181, 30, 128, 119, 121, 173, 157, 124, 
-	63, -97, -254, -224, -154, -192, -287, -285, -233, -185, -119, -86, -92, -73, -63, -67, 
-	-60, -57, -85, -148, -200, -249, -288, -283, -225, -158, -118, -87, -32, 28, 56, 26, 
-	-18, -63, -79, -72, -80, -90, -118, -135, -140, -125, -93, -60, -34, 16, 90, 103
-};
-
-static const short ugen_H_10e175a0c[] = { 
-	0, 0, -5, 1, -3, 4, -8, 6, -11, 0, -12, 0, 0, 3, 12, 1005, 
-	5123, 2025, -6380, -4298, 1514, 1384, 1448, 8982, 12642, 3717, -930, 1579, -480, -2825, -3110, -5301, 
-	-5831, -3380, -2241, -2684, -1920, 607, 1302, 545, 1783, 2557, 1334, 522, 597, 159, -550, -530, 
-	-537, -1134, -1383, -1168, -1416, -1256, -346, -41, -85, 250, 748, 1028, 954, 829, 676, 241, 
-	-154, -417, -679, -807, -773, -748, -725, -587, -337, -129, -56, 119, 236, 165, 93, 115, 
-	176, 87, -67, -182, -325, -407, -355, -300, -339, -310, -213, -162, -78, 19, 60, 32, 
-	5, -25, -94, -104, -89, -129, -191, -232, -258, -271, -226, -176, -146, -130, -99, -56, 
-	-19, 12, -9, -34, -32, -37, -55, -93, -118, -131, -156, -172, -164, -95, 0, 53
-};
-
-static const short ugen_H_10e175a1c[] = { 
-	-5, 4, -5, 9, -13, 15, -15, 7, -17, 4, -5, 0, 3, 990, 5442, 1847, 
-	-5858, -4058, 482, 1060, 1560, 9140, 13176, 5526, 346, 1080, -644, -2519, -3510, -5694, -6196, -4393, 
-	-2764, -2598, -2257, -91, 1203, 1119, 1484, 1956, 1800, 1340, 884, 284, -501, -734, -659, -1334, 
-	-1841, -1658, -1431, -1170, -615, -92, 309, 572, 772, 932, 856, 607, 458, 312, 162, -33, 
-	-353, -537, -591, -634, -769, -803, -652, -489, -338, -101, 123, 194, 183, 236, 265, 183, 
-	25, -74, -202, -260, -202, -228, -294, -290, -215, -249, -243, -113, -41, -27, -37, -37, 
-	-56, -81, -54, -90, -134, -191, -256, -278, -271, -201, -147, -110, -90, -47, 8, 23, 
-	18, -28, -59, -73, -70, -62, -93, -112, -146, -141, -131, -112, -47, -7, 45, 87
-};
-
-static const short ugen_H_10e180a0c[] = { 
-	0, -5, 2, -3, 6, -9, 11, -14, 5, -15, 3, -5, 6, 0, 1025, 5226, 
-	2016, -6055, -4350, 1000, 1212, 1537, 9181, 13070, 4539, -572, 1367, -415, -2711, -3400, -5461, -6032, 
-	-3889, -2436, -2687, -2141, 251, 1290, 844, 1762, 2114, 1479, 1251, 690, 77, -526, -635, -682, 
-	-1181, -1451, -1611, -1620, -987, -328, -194, 86, 451, 748, 863, 823, 780, 675, 434, 122, 
-	-228, -554, -687, -735, -757, -826, -777, -520, -296, -178, 0, 189, 226, 186, 208, 233, 
-	126, -15, -112, -275, -369, -294, -248, -292, -313, -242, -205, -188, -73, 10, 21, -2, 
-	-35, -69, -90, -74, -107, -151, -205, -259, -272, -244, -182, -147, -123, -103, -63, -7, 
-	17, 2, -33, -47, -56, -58, -69, -104, -129, -142, -152, -158, -111, -27, 24, 54
-};
-
-static const short ugen_H_10e180a1c[] = { 
-	0, -5, 2, -3, 6, -9, 11, -14, 5, -15, 3, -5, 6, 0, 1025, 5226, 
-	2016, -6055, -4350, 1000, 1212, 1537, 9181, 13070, 4539, -572, 1367, -415, -2711, -3400, -5461, -6032, 
-	-3889, -2436, -2687, -2141, 251, 1290, 844, 1762, 2114, 1479, 1251, 690, 77, -526, -635, -682, 
-	-1181, -1451, -1611, -1620, -987, -328, -194, 86, 451, 748, 863, 823, 780, 675, 434, 122, 
-	-228, -554, -687, -735, -757, -826, -777, -520, -296, -178, 0, 189, 226, 186, 208, 233, 
-	126, -15, -112, -275, -369, -294, -248, -292, -313, -242, -205, -188, -73, 10, 21, -2, 
-	-35, -69, -90, -74, -107, -151, -205, -259, -272, -244, -182, -147, -123, -103, -63, -7, 
-	17, 2, -33, -47, -56, -58, -69, -104, -129, -142, -152, -158, -111, -27, 24, 54
-};
-
-static const short ugen_H_20e000a0c[] = { 
-	4, -7, 18, -21, 26, -45, 45, -50, 35, -43, 44, 12, 3687, 7157, -7480, -7204, 
-	1977, -4400, 4621, 10997, 4978, 3541, 13674, 9485, -8973, -3591, 146, -10859, -6416, 2106, -5740, -7290, 
-	88, 1779, -59, 737, 4374, 3485, 1544, 2410, 768, -2286, -1588, -1468, -3443, -3778, -2356, -1130, 
-	-1541, -769, 1177, 930, 936, 1780, 1528, 1018, 901, 744, 240, -550, -732, -633, -1192, -1164, 
-	-730, -969, -898, -303, -105, -34, 184, 518, 470, 360, 397, 239, 2, -180, -300, -415, 
-	-536, -485, -294, -375, -378, -169, -147, -189, -27, 97, 125, 119, 141, 67, -50, -132, 
-	-138, -96, -132, -97, -25, -56, -123, -54, -39, -131, -66, 8, -146, -225, -220, -218, 
-	-138, -20, -12, -99, -73, -9, 1, -57, -182, -256, -249, -278, -302, -255, -313, -426
-};
-
-static const short ugen_H_20e000a1c[] = { 
-	4, -7, 18, -21, 26, -45, 45, -50, 35, -43, 44, 12, 3687, 7157, -7480, -7204, 
-	1977, -4400, 4621, 10997, 4978, 3541, 13674, 9485, -8973, -3591, 146, -10859, -6416, 2106, -5740, -7290, 
-	88, 1779, -59, 737, 4374, 3485, 1544, 2410, 768, -2286, -1588, -1468, -3443, -3778, -2356, -1130, 
-	-1541, -769, 1177, 930, 936, 1780, 1528, 1018, 901, 744, 240, -550, -732, -633, -1192, -1164, 
-	-730, -969, -898, -303, -105, -34, 184, 518, 470, 360, 397, 239, 2, -180, -300, -415, 
-	-536, -485, -294, -375, -378, -169, -147, -189, -27, 97, 125, 119, 141, 67, -50, -132, 
-	-138, -96, -132, -97, -25, -56, -123, -54, -39, -131, -66, 8, -146, -225, -220, -218, 
-	-138, -20, -12, -99, -73, -9, 1, -57, -182, -256, -249, -278, -302, -255, -313, -426
-};
-
-static const short ugen_H_20e005a0c[] = { 
-	-5, 6, -7, 14, -11, 13, -22, 11, -5, -15, 17, -24, 32, 1956, 6823, -3052, 
-	-8512, 389, -3988, 842, 9883, 6716, 3679, 9990, 11649, -3374, -4688, 283, -8048, -7878, 901, -2930, 
-	-6846, -1906, 844, 300, 4, 2810, 3358, 1296, 1924, 1678, -995, -1385, -862, -2202, -3078, -2442, 
-	-1927, -1728, -827, 419, 504, 617, 1277, 1420, 1209, 834, 545, 439, -95, -586, -445, -744, 
-	-1060, -830, -732, -820, -466, -188, -190, 23, 334, 283, 220, 342, 258, 100, -18, -183, 
-	-308, -406, -446, -318, -346, -371, -277, -196, -166, -57, 48, 96, 138, 147, 61, -50, 
-	-112, -124, -65, -73, -90, -37, -21, -108, -87, -29, -82, -132, -141, -252, -275, -163, 
-	-84, -25, -6, -37, -62, 10, 34, -49, -191, -314, -324, -279, -340, -337, -352, -435
-};
-
-static const short ugen_H_20e005a1c[] = { 
-	-8, 19, -18, 16, -26, 13, 0, -33, 42, -61, 50, 2303, 8817, -4244, -11300, 1861, 
-	-3772, 2094, 12686, 6533, 2504, 12757, 14087, -8170, -7262, 1548, -9964, -9123, 2385, -4132, -9092, -1037, 
-	1853, 256, 645, 4234, 4300, 1988, 2786, 1584, -2510, -2430, -1404, -3589, -4528, -2790, -1096, -1497, 
-	-1099, 1180, 1355, 1083, 1974, 1771, 1079, 921, 806, 413, -384, -843, -765, -1337, -1409, -804, 
-	-885, -1061, -466, -67, 26, 243, 550, 611, 493, 514, 336, -41, -260, -344, -446, -607, 
-	-622, -338, -364, -366, -154, -96, -161, -43, 123, 142, 116, 86, 42, -23, -99, -152, 
-	-141, -176, -151, -28, -13, -112, -61, -28, -104, -70, 66, -30, -173, -183, -252, -239, 
-	-110, -30, -72, -76, -53, -38, -22, -99, -217, -234, -228, -245, -231, -243, -433, -463
-};
-
-static const short ugen_H_20e010a0c[] = { 
-	-3, -2, 4, -4, 12, -14, 15, -28, 24, -27, 11, -16, 25, 17, 2575, 5677, 
-	-4407, -6241, 294, -3877, 2154, 8654, 5692, 3831, 9912, 9297, -3208, -3014, -892, -7656, -5833, 410, 
-	-3545, -5596, -1397, 497, 89, 379, 2556, 2406, 961, 1566, 1256, -683, -955, -711, -1706, -2225, 
-	-1923, -1835, -1679, -749, 195, 76, 285, 956, 1143, 900, 620, 522, 493, 34, -332, -281, 
-	-632, -837, -649, -684, -749, -424, -312, -290, -33, 199, 130, 148, 303, 236, 121, 30, 
-	-123, -258, -335, -364, -344, -374, -370, -301, -236, -163, -8, 73, 111, 130, 156, 63, 
-	-55, -116, -141, -89, -110, -107, -48, -28, -73, -59, -39, -123, -190, -219, -284, -213, 
-	-83, -29, -30, -41, -38, -8, 54, -2, -149, -266, -341, -351, -349, -347, -310, -329
-};
-
-static const short ugen_H_20e010a1c[] = { 
-	9, -2, 0, 4, -31, 56, -94, 113, -142, 141, 1069, 8991, 640, -14209, -723, -1914, 
-	-789, 13519, 8935, 1964, 10777, 17993, -5021, -11258, 1633, -8267, -11260, 1801, -2203, -10306, -3016, 1743, 
-	1089, 687, 3593, 4924, 2338, 3106, 2667, -2247, -3647, -1979, -3033, -4372, -3463, -1701, -1308, -1127, 
-	1128, 1608, 901, 2085, 2213, 1253, 799, 736, 483, -262, -845, -738, -1233, -1680, -1021, -885, 
-	-1081, -486, -66, 3, 258, 641, 687, 514, 568, 381, 24, -198, -318, -479, -681, -737, 
-	-427, -338, -446, -200, -30, -120, -35, 146, 199, 152, 90, 28, -50, -90, -152, -140, 
-	-184, -187, -86, -36, -117, -100, 0, -80, -82, 93, 101, -31, -91, -203, -295, -218, 
-	-105, -84, -58, -62, -91, -55, -27, -136, -218, -219, -195, -179, -187, -312, -538, -464
-};
-
-static const short ugen_H_20e015a0c[] = { 
-	-2, -3, 0, 1, -3, 8, -11, 11, -27, 25, -37, 25, -30, 42, 60, 2927, 
-	4435, -4818, -4479, -41, -3381, 2807, 7476, 4830, 3946, 9475, 7678, -2625, -2417, -1475, -6600, -4573, 
-	-58, -3666, -4652, -1229, 151, -65, 525, 2376, 1607, 356, 1433, 1252, -481, -601, -357, -1207, 
-	-1617, -1413, -1556, -1724, -997, -92, -219, -129, 489, 804, 758, 674, 677, 550, 66, -108, 
-	-108, -548, -714, -520, -586, -697, -512, -393, -318, -106, 92, 46, 80, 232, 251, 133, 
-	6, -111, -188, -276, -328, -324, -428, -394, -255, -183, -123, -19, 93, 121, 129, 101, 
-	-7, -76, -158, -152, -119, -94, -68, -8, 23, -71, -77, -93, -188, -265, -269, -244, 
-	-144, -18, -11, -57, -51, -2, 54, 38, -90, -245, -325, -366, -372, -344, -296, -258
-};
-
-static const short ugen_H_20e015a1c[] = { 
-	16, -23, 32, -66, 86, -118, 122, -153, 171, 232, 7529, 6097, -14061, -5928, 39, -3098, 
-	12490, 12172, 2496, 7940, 20319, 628, -14664, -11, -5819, -12886, 420, 52, -11032, -5959, 2016, 2213, 
-	416, 2920, 5248, 2503, 3091, 3905, -1474, -5068, -2780, -1956, -3660, -4192, -2647, -1193, -748, 889, 
-	1607, 784, 1881, 2536, 1567, 735, 537, 491, -150, -874, -672, -977, -1770, -1325, -837, -1030, 
-	-647, -83, 41, 324, 650, 728, 501, 512, 425, 123, -143, -315, -447, -643, -781, -535, 
-	-387, -512, -279, -30, -98, -52, 164, 210, 203, 168, 70, -97, -151, -146, -110, -149, 
-	-230, -149, -74, -158, -162, -37, -63, -76, 105, 170, 56, 45, -76, -262, -269, -169, 
-	-165, -108, -34, -102, -117, -52, -69, -156, -212, -196, -146, -157, -193, -428, -600, -453
-};
-
-static const short ugen_H_20e020a0c[] = { 
-	0, 0, -4, 0, 0, -2, 5, -8, 8, -22, 23, -35, 31, -31, 39, 141, 
-	3039, 3327, -4673, -3173, -374, -2809, 3056, 6331, 4166, 4059, 8962, 6558, -2364, -1989, -1404, -5699, 
-	-3642, -427, -3638, -3965, -1218, -56, -120, 569, 1773, 856, 313, 1582, 1149, -364, -108, 116, 
-	-758, -1301, -1210, -1337, -1630, -1232, -654, -662, -325, 309, 663, 813, 766, 685, 539, 154, 
-	30, -89, -458, -541, -405, -555, -685, -525, -429, -334, -181, -20, -3, 109, 216, 168, 
-	97, -3, -82, -143, -265, -327, -325, -339, -309, -199, -132, -108, -8, 48, 82, 63, 
-	2, -61, -110, -133, -110, -53, -46, -12, 40, -13, -93, -106, -150, -277, -309, -248, 
-	-183, -48, 5, -36, -58, 0, 54, 53, -21, -183, -299, -347, -356, -346, -299, -231
-};
-
-static const short ugen_H_20e020a1c[] = { 
-	-27, 36, -68, 68, -82, 56, -73, 77, -53, 4944, 10185, -9785, -12098, 149, -3876, 9437, 
-	15061, 4623, 5387, 20159, 7921, -15795, -3815, -3227, -13297, -1836, 1844, -10942, -8689, 1767, 2901, 997, 
-	1893, 4982, 3023, 2785, 4522, -548, -5793, -3580, -654, -2919, -4928, -3318, -1161, -488, 626, 1468, 
-	693, 1662, 2617, 1772, 699, 355, 485, -13, -808, -757, -804, -1690, -1456, -720, -959, -864, 
-	-173, 69, 314, 664, 683, 464, 554, 527, 132, -144, -301, -410, -576, -793, -633, -386, 
-	-507, -420, -126, -71, -47, 145, 180, 194, 232, 150, -73, -194, -186, -119, -105, -218, 
-	-194, -135, -190, -259, -138, -66, -74, 101, 214, 126, 123, 43, -167, -258, -214, -222, 
-	-177, -52, -87, -161, -133, -74, -92, -167, -240, -168, -129, -121, -235, -604, -636, -350
-};
-
-static const short ugen_H_20e025a0c[] = { 
-	0, 1, 0, -3, 0, 0, 0, 2, -3, 4, -13, 19, -29, 32, -27, 26, 
-	224, 2951, 2458, -4198, -2265, -667, -2247, 2985, 5272, 3742, 4169, 8384, 5477, -2096, -1330, -1254, 
-	-4860, -2932, -817, -3501, -3482, -1174, -114, -289, 105, 1089, 746, 707, 1574, 967, 12, 476, 
-	368, -705, -1151, -1071, -1220, -1659, -1604, -1113, -763, -199, 355, 628, 667, 686, 665, 520, 
-	201, 69, -38, -351, -377, -347, -586, -673, -501, -412, -389, -227, -49, -18, 79, 164, 
-	108, 18, -13, -71, -149, -243, -268, -243, -252, -214, -180, -157, -106, -38, -8, -13, 
-	-24, -32, -71, -87, -80, -24, 9, -1, 1, 9, -43, -129, -157, -226, -316, -307, 
-	-206, -97, -10, -11, -50, -15, 54, 77, 17, -112, -256, -320, -304, -327, -345, -263
-};
-
-static const short ugen_H_20e025a1c[] = { 
-	15, -30, 17, -1, -41, 52, -76, 51, 2303, 11404, -2410, -16182, -2890, -3200, 5381, 16272, 
-	7764, 4261, 18043, 14755, -13369, -8813, -1913, -12194, -4046, 1911, -9772, -10058, 424, 2626, 2060, 1677, 
-	3896, 3495, 2782, 4113, -10, -5093, -3796, -458, -2133, -4834, -3763, -1377, -468, 227, 1444, 794, 
-	1241, 2521, 1869, 836, 182, 344, 171, -610, -898, -758, -1457, -1474, -674, -818, -932, -248, 
-	81, 170, 521, 694, 537, 541, 608, 230, -74, -292, -440, -528, -708, -674, -413, -481, 
-	-475, -211, -79, -38, 136, 171, 168, 264, 182, -41, -178, -154, -127, -91, -182, -202, 
-	-132, -186, -305, -251, -133, -82, 79, 270, 192, 148, 177, -26, -213, -232, -226, -229, 
-	-79, -39, -154, -176, -118, -69, -86, -224, -239, -131, -86, -55, -391, -728, -556, -165
-};
-
-static const short ugen_H_20e030a0c[] = { 
-	0, 0, 0, -1, -3, 0, -1, 0, 0, -1, 2, -10, 12, -21, 27, -25, 
-	16, 276, 2737, 1859, -3568, -1721, -884, -1733, 2657, 4418, 3557, 4206, 7541, 4502, -1484, -731, 
-	-1120, -4025, -2542, -1156, -3218, -2968, -1205, -535, -642, -183, 886, 948, 980, 1490, 1054, 496, 
-	608, 195, -676, -991, -1076, -1404, -1748, -1602, -1075, -561, -53, 237, 396, 508, 554, 602, 
-	553, 215, 53, 2, -213, -329, -371, -547, -605, -474, -408, -374, -256, -111, -52, 14, 
-	62, 70, 9, -56, -76, -96, -170, -223, -231, -235, -203, -147, -132, -150, -111, -59, 
-	-58, -63, -55, -66, -63, -22, 46, 50, -2, -47, -37, -62, -138, -222, -305, -339, 
-	-266, -121, -50, -43, -47, -5, 56, 75, 27, -73, -204, -282, -266, -279, -361, -371
-};
-
-static const short ugen_H_20e030a1c[] = { 
-	12, -50, 76, -126, 140, -192, 214, 438, 9466, 5815, -15613, -8761, -2581, 1564, 15208, 10932, 
-	4776, 14960, 19962, -7156, -13433, -2522, -10445, -5984, 822, -7389, -10773, -2076, 2349, 2438, 1785, 3307, 
-	3920, 2353, 3261, 371, -3565, -3246, -1385, -1798, -3815, -3621, -1941, -805, -124, 1163, 1071, 969, 
-	2139, 1821, 1073, 287, 126, 167, -455, -946, -728, -1120, -1490, -804, -641, -805, -329, 41, 
-	28, 376, 641, 503, 485, 625, 372, 39, -174, -443, -569, -648, -677, -402, -452, -549, 
-	-317, -98, -22, 80, 187, 156, 239, 201, 0, -179, -190, -153, -76, -74, -172, -174, 
-	-187, -281, -301, -226, -140, 10, 233, 276, 205, 232, 83, -143, -204, -212, -266, -161, 
-	-42, -90, -157, -157, -105, -63, -147, -261, -192, -118, -1, -91, -610, -733, -417, 31
-};
-
-static const short ugen_H_20e035a0c[] = { 
-	0, -1, -1, 0, -2, -4, 0, -3, 0, 0, -2, 0, -7, 7, -17, 19, 
-	-21, 2, 301, 2453, 1523, -2933, -1484, -940, -1366, 2213, 3858, 3473, 4040, 6496, 3933, -702, 
-	-369, -873, -3324, -2393, -1203, -2791, -2971, -1590, -612, -691, -340, 889, 1195, 1172, 1562, 1127, 
-	456, 477, 127, -629, -1056, -1259, -1364, -1508, -1274, -736, -508, -295, 16, 260, 383, 474, 
-	533, 485, 201, 74, 34, -159, -248, -341, -473, -493, -457, -432, -401, -277, -153, -107, 
-	-48, 24, 67, 10, -25, -66, -97, -164, -235, -237, -201, -134, -112, -138, -158, -141, 
-	-101, -74, -69, -77, -60, -6, 37, 73, 30, -29, -47, -26, -59, -193, -296, -330, 
-	-298, -183, -79, -63, -49, 0, 45, 73, 40, -63, -165, -217, -228, -241, -314, -405
-};
-
-static const short ugen_H_20e035a1c[] = { 
-	-59, 81, -115, 98, -123, 141, -155, 5414, 11482, -9105, -15082, -3795, -1108, 12055, 13265, 5933, 
-	12398, 22484, 1774, -15530, -4687, -8893, -8389, 65, -4733, -10794, -5072, 1407, 2647, 1968, 2547, 4623, 
-	2100, 1982, 952, -2128, -2440, -2081, -1911, -2938, -3102, -2135, -1263, -563, 569, 1165, 871, 1794, 
-	1677, 1277, 577, -41, 168, -286, -965, -958, -763, -1272, -1054, -612, -611, -350, -5, -22, 
-	227, 572, 460, 332, 572, 473, 174, -82, -339, -480, -632, -709, -494, -362, -524, -392, 
-	-193, -63, 51, 182, 167, 187, 200, 58, -152, -234, -212, -121, -34, -78, -120, -188, 
-	-288, -320, -244, -203, -100, 138, 293, 250, 257, 186, -17, -167, -223, -270, -230, -114, 
-	-96, -96, -126, -129, -83, -98, -215, -231, -172, -81, 76, -262, -774, -656, -283, 249
-};
-
-static const short ugen_H_20e040a0c[] = { 
-	0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -2, 6, -10, 
-	19, -18, 1, 293, 2174, 1401, -2433, -1388, -878, -1155, 1857, 3506, 3366, 3629, 5506, 3751, 
-	-34, -69, -561, -2783, -2165, -1379, -2890, -2842, -1392, -631, -845, -299, 1161, 1476, 1155, 1260, 
-	932, 485, 408, -48, -765, -1120, -1031, -974, -1140, -993, -725, -703, -493, -50, 154, 224, 
-	363, 460, 405, 164, 134, 75, -87, -152, -261, -428, -487, -454, -463, -401, -279, -196, 
-	-151, -66, 18, 32, 18, -27, -102, -157, -196, -192, -160, -130, -125, -119, -149, -167, 
-	-153, -134, -96, -71, -52, -42, 6, 45, 42, 13, -8, -13, -31, -109, -251, -330, 
-	-314, -239, -117, -72, -76, -35, 27, 56, 19, -47, -133, -177, -189, -211, -279, -363
-};
-
-static const short ugen_H_20e040a1c[] = { 
-	-2, 8, -56, 74, -116, 94, 1551, 11894, 1525, -17681, -8371, -2300, 7285, 14434, 7307, 9993, 
-	22683, 11712, -13886, -7988, -7057, -11201, -912, -2166, -9983, -7650, -377, 1978, 2120, 2445, 4372, 2129, 
-	1298, 1961, -1259, -2145, -1855, -1967, -2524, -2808, -2033, -1659, -909, 150, 819, 546, 1571, 1739, 
-	1130, 960, 229, 17, -199, -661, -1110, -927, -1088, -989, -661, -595, -368, 35, 5, 16, 
-	467, 476, 261, 464, 506, 216, 17, -191, -400, -533, -663, -629, -402, -432, -358, -243, 
-	-152, -6, 174, 164, 102, 186, 131, -94, -238, -236, -174, -90, -58, -45, -112, -209, 
-	-323, -293, -238, -153, 27, 219, 262, 248, 247, 105, -34, -169, -299, -294, -190, -157, 
-	-123, -59, -84, -109, -70, -133, -216, -206, -154, 21, 45, -496, -813, -532, -137, 453
-};
-
-static const short ugen_H_20e045a0c[] = { 
-	0, 0, 0, 0, -1, 0, -2, -3, 0, -1, 0, 0, -1, 0, -4, 6, 
-	-9, 15, -20, -1, 260, 1928, 1378, -2090, -1359, -752, -1025, 1626, 3256, 3115, 3088, 4728, 
-	3731, 531, 283, -205, -2568, -2477, -1476, -2416, -2474, -1360, -766, -780, 127, 1384, 1173, 754, 
-	1026, 912, 461, 146, -317, -630, -624, -628, -790, -1043, -1015, -802, -760, -585, -202, 21, 
-	142, 246, 375, 363, 179, 173, 150, 8, -132, -239, -409, -500, -436, -420, -411, -339, 
-	-216, -163, -115, 2, 22, -49, -89, -109, -126, -155, -120, -98, -126, -135, -152, -179, 
-	-187, -144, -116, -107, -77, -46, -22, -12, 14, 40, 37, 28, -3, -60, -189, -302, 
-	-304, -239, -168, -129, -102, -79, -8, 27, -4, -36, -89, -134, -172, -200, -238, -304
-};
-
-static const short ugen_H_20e045a1c[] = { 
-	69, -134, 155, -196, 239, -184, 7299, 10998, -12232, -15698, -3705, 2741, 13152, 9372, 7598, 20207, 
-	20539, -6616, -12112, -5939, -12133, -3098, -607, -8049, -9212, -3126, 972, 1844, 2335, 3312, 2669, 944, 
-	2731, 283, -2107, -1753, -1767, -1856, -2747, -2287, -1884, -1247, -271, 592, 263, 799, 1865, 1166, 
-	1064, 572, 284, -24, -582, -927, -1012, -1107, -1183, -646, -467, -465, -106, 105, -34, 221, 
-	467, 273, 375, 578, 278, 21, -93, -270, -454, -640, -636, -464, -431, -359, -193, -145, 
-	-100, 79, 154, 78, 126, 123, -22, -189, -210, -214, -138, -83, -68, -48, -107, -202, 
-	-320, -307, -196, -36, 129, 189, 229, 285, 188, 47, -48, -197, -323, -271, -229, -221, 
-	-96, -29, -64, -68, -72, -139, -193, -187, -95, 97, -98, -690, -745, -413, 28, 560
-};
-
-static const short ugen_H_20e050a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 3, -5, 
-	5, -6, 16, -25, 6, 217, 1730, 1394, -1886, -1313, -602, -896, 1527, 2971, 2724, 2588, 
-	4204, 3784, 1169, 597, -549, -2677, -2153, -1111, -1991, -2233, -1412, -674, -354, 281, 934, 737, 
-	565, 917, 795, 235, 72, -26, -132, -266, -613, -953, -1057, -937, -853, -829, -634, -317, 
-	-68, 94, 203, 289, 329, 241, 242, 222, 21, -144, -223, -356, -458, -459, -458, -428, 
-	-357, -243, -175, -110, -53, -43, -55, -65, -45, -66, -100, -97, -90, -130, -190, -183, 
-	-170, -162, -145, -118, -93, -78, -39, -22, -11, 22, 71, 80, 29, -40, -136, -236, 
-	-261, -227, -195, -184, -156, -96, -38, -9, -18, -28, -49, -98, -156, -194, -210, -251
-};
-
-static const short ugen_H_20e050a1c[] = { 
-	2, -50, 71, -115, 88, 1535, 12667, 1888, -19691, -9831, -110, 8796, 11916, 6187, 15066, 25393, 
-	6572, -13480, -7712, -10530, -6587, 221, -5438, -9437, -6559, -478, 1240, 2056, 1962, 2478, 1129, 2913, 
-	2398, -1589, -1512, -1537, -1358, -2406, -2596, -2168, -1947, -738, 219, 375, 86, 1402, 1419, 1079, 
-	904, 424, 363, -215, -704, -1093, -965, -1241, -1037, -548, -411, -242, -11, -25, 46, 437, 
-	275, 244, 577, 516, 155, -84, -229, -372, -554, -666, -563, -391, -380, -261, -126, -67, 
-	0, 85, 50, 87, 139, 13, -149, -215, -205, -183, -101, -78, -46, -75, -130, -223, 
-	-288, -269, -141, 38, 150, 176, 231, 250, 131, 37, -94, -252, -291, -258, -289, -221, 
-	-76, -38, -58, -56, -69, -123, -177, -163, -8, 102, -327, -798, -644, -264, 227, 558
-};
-
-static const short ugen_H_20e055a0c[] = { 
-	0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 0, 1, 1, 0, 3, 
-	-5, 8, -1, 8, -19, 15, 174, 1582, 1360, -1748, -1247, -414, -721, 1432, 2598, 2287, 
-	2294, 3917, 3945, 1331, 220, -580, -2170, -1716, -766, -1678, -2041, -1159, -502, -436, -48, 573, 
-	555, 320, 663, 749, 465, 430, 298, -11, -428, -772, -941, -987, -967, -847, -837, -706, 
-	-331, -101, 6, 130, 292, 379, 299, 288, 212, 9, -124, -202, -349, -505, -513, -475, 
-	-422, -341, -246, -198, -162, -68, 0, -21, -35, -23, -14, -58, -116, -141, -159, -160, 
-	-174, -204, -206, -147, -84, -68, -67, -44, -7, 34, 63, 74, 32, -29, -79, -157, 
-	-218, -231, -203, -181, -184, -130, -64, -46, -40, -26, -21, -83, -153, -186, -189, -214
-};
-
-static const short ugen_H_20e055a1c[] = { 
-	-101, 120, -163, 198, -282, 6007, 13316, -10622, -19658, -3326, 4111, 11703, 7646, 8757, 23835, 19616, 
-	-6815, -12348, -7914, -8608, -949, -2651, -8575, -8918, -3313, 607, 1555, 1134, 1275, 1390, 1782, 4192, 
-	646, -1643, -1071, -687, -1601, -3102, -2286, -2207, -1708, -527, 348, -61, 466, 1479, 1122, 1047, 
-	595, 569, 260, -206, -720, -958, -1045, -1231, -850, -605, -458, -151, 34, -133, 203, 397, 
-	181, 395, 636, 446, 95, -175, -322, -463, -621, -631, -467, -346, -310, -205, -84, -10, 
-	79, 66, -13, 93, 115, -58, -242, -247, -197, -123, -69, -28, -16, -98, -187, -241, 
-	-238, -208, -86, 67, 153, 181, 235, 175, 96, 47, -120, -280, -277, -272, -307, -186, 
-	-61, -54, -71, -74, -56, -81, -134, -121, 40, 21, -499, -787, -546, -104, 335, 470
-};
-
-static const short ugen_H_20e060a0c[] = { 
-	2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 1, 1, 
-	3, -3, 9, -5, 11, -13, 16, 164, 1440, 1249, -1621, -1132, -221, -520, 1308, 2180, 
-	2003, 2351, 3538, 3238, 1399, 562, -385, -1699, -1314, -434, -1208, -1746, -1377, -877, -477, -105, 
-	212, 106, 157, 909, 1182, 762, 439, 77, -185, -404, -786, -963, -961, -964, -858, -802, 
-	-663, -416, -186, 22, 210, 334, 366, 314, 276, 205, -14, -176, -242, -410, -526, -525, 
-	-457, -388, -348, -258, -190, -123, -40, 0, -19, 0, 11, -21, -78, -113, -129, -170, 
-	-210, -240, -229, -192, -117, -53, -45, -47, -11, 30, 41, 34, 15, -20, -43, -101, 
-	-183, -212, -185, -157, -160, -148, -110, -81, -63, -38, -38, -90, -147, -175, -186, -199
-};
-
-static const short ugen_H_20e060a1c[] = { 
-	-113, 165, -238, 276, 249, 11265, 7895, -20561, -14064, 1943, 7273, 10805, 5306, 16036, 26851, 7609, 
-	-13504, -9662, -7174, -3830, -126, -6454, -10025, -6800, -795, 606, 891, 642, 845, 748, 3077, 3620, 
-	-201, -921, -454, -248, -2298, -3109, -2444, -2114, -1510, -509, 59, -159, 957, 1192, 1012, 815, 
-	602, 631, 278, -106, -695, -790, -1050, -1114, -870, -741, -489, -161, -82, -68, 321, 205, 
-	189, 583, 642, 336, 16, -173, -357, -514, -643, -570, -400, -341, -306, -176, -43, 32, 
-	91, 7, 9, 114, 53, -155, -281, -227, -176, -99, -40, 18, 0, -122, -224, -273, 
-	-228, -162, -34, 104, 132, 157, 201, 134, 92, 29, -144, -269, -276, -304, -292, -147, 
-	-65, -74, -109, -96, -41, -50, -90, -81, 44, -137, -637, -716, -404, 57, 352, 385
-};
-
-static const short ugen_H_20e065a0c[] = { 
-	0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 2, 1, 0, 
-	4, 1, -2, 6, 2, 7, -11, 24, 185, 1297, 1054, -1452, -1001, -28, -255, 1119, 
-	2013, 1965, 1649, 2661, 3314, 1932, 804, -264, -1259, -573, 74, -1313, -2230, -1620, -722, -471, 
-	-593, -277, 197, 734, 1314, 1184, 513, 124, 23, -111, -444, -834, -968, -970, -927, -785, 
-	-777, -690, -411, -99, 124, 224, 300, 345, 306, 252, 120, -104, -245, -284, -428, -525, 
-	-478, -415, -354, -319, -230, -161, -97, -30, -1, 4, 9, 17, -8, -59, -131, -190, 
-	-233, -255, -219, -196, -151, -79, -36, -24, -14, 9, 5, 4, 1, -8, -25, -71, 
-	-139, -179, -143, -117, -134, -140, -136, -122, -91, -66, -77, -107, -132, -163, -189, -210
-};
-
-static const short ugen_H_20e065a1c[] = { 
-	-47, 67, -103, 49, 2198, 14889, -1380, -25125, -6221, 5185, 8527, 8365, 6982, 23442, 22583, -4212, 
-	-14159, -6901, -4837, -42, -2543, -9214, -9676, -4541, 244, 0, 290, 643, 441, 451, 3858, 2765, 
-	-330, -442, 493, -104, -2914, -2918, -2545, -2107, -1459, -591, -428, 73, 1061, 883, 850, 660, 
-	791, 717, 391, -54, -580, -665, -932, -1017, -958, -810, -562, -305, -248, 66, 304, 20, 
-	278, 663, 627, 238, -11, -114, -327, -550, -610, -482, -404, -387, -306, -142, -22, 54, 
-	38, -35, 50, 134, -48, -240, -259, -175, -139, -94, 1, 39, -3, -123, -277, -313, 
-	-234, -106, 9, 97, 107, 130, 163, 98, 95, -2, -154, -217, -266, -346, -295, -123, 
-	-64, -98, -125, -106, -42, -35, -69, -52, -6, -292, -708, -628, -246, 177, 331, 312
-};
-
-static const short ugen_H_20e070a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 2, 0, 
-	1, 3, 0, 0, 6, 4, -3, 3, 27, 249, 1122, 770, -1211, -860, 208, 122, 
-	1196, 1417, 911, 1506, 2854, 3445, 2157, 897, 170, -353, -217, -536, -1794, -2206, -1470, -911, 
-	-945, -753, 122, 784, 935, 1113, 827, 269, 102, 35, -158, -540, -905, -984, -898, -826, 
-	-771, -729, -597, -280, -12, 106, 200, 272, 317, 233, 137, 7, -192, -288, -344, -404, 
-	-429, -410, -371, -346, -291, -202, -124, -81, -28, 15, 10, 17, 0, -40, -104, -192, 
-	-249, -252, -195, -167, -172, -150, -83, -25, -13, -18, -18, -12, -5, -6, -10, -44, 
-	-104, -143, -123, -79, -98, -153, -165, -140, -111, -118, -123, -119, -136, -163, -200, -220
-};
-
-static const short ugen_H_20e070a1c[] = { 
-	51, -85, 116, -240, 5030, 15773, -10895, -24689, 724, 6498, 8245, 6589, 11562, 27310, 14052, -11398, 
-	-11769, -4863, -1304, 1174, -5933, -10217, -8593, -2892, -79, -531, 541, 381, -405, 1185, 4142, 1721, 
-	-244, 62, 1305, -183, -2907, -2891, -2562, -2023, -1538, -935, -706, 292, 803, 703, 696, 726, 
-	958, 762, 550, 19, -359, -620, -861, -873, -886, -848, -741, -517, -372, 157, 168, -85, 
-	362, 692, 573, 200, 65, -40, -282, -501, -524, -445, -422, -427, -305, -108, -36, 22, 
-	-10, -49, 92, 97, -115, -246, -185, -107, -110, -49, 46, 49, -33, -149, -318, -325, 
-	-180, -72, 4, 68, 105, 161, 127, 43, 60, 18, -87, -162, -281, -378, -264, -101, 
-	-62, -108, -127, -95, -39, -25, -64, -62, -60, -403, -713, -538, -114, 281, 319, 285
-};
-
-static const short ugen_H_20e075a0c[] = { 
-	0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 2, 
-	0, 2, 4, 3, -1, 4, 4, 0, 11, 51, 345, 854, 477, -869, -577, 794, 
-	285, -51, 792, 1282, 1852, 2896, 3335, 2371, 1491, 718, -479, -806, -881, -1803, -2262, -1740, 
-	-1130, -701, -132, 535, 778, 715, 795, 627, 207, 54, -3, -310, -700, -875, -856, -805, 
-	-779, -690, -605, -440, -192, -24, 95, 176, 231, 231, 121, -2, -115, -247, -297, -276, 
-	-323, -377, -366, -343, -298, -252, -164, -82, -35, -13, -30, -13, 0, -35, -107, -164, 
-	-189, -208, -194, -171, -168, -176, -153, -81, -19, 0, -12, -16, -3, 9, 4, -21, 
-	-73, -108, -101, -70, -88, -167, -185, -147, -115, -134, -153, -143, -148, -159, -188, -202
-};
-
-static const short ugen_H_20e075a1c[] = { 
-	136, -209, 306, -417, 7783, 14628, -18248, -21704, 5483, 6739, 7174, 6229, 16783, 26927, 5689, -14059, 
-	-9355, -2646, 1989, 368, -8644, -10196, -7267, -2341, -787, -491, 553, -223, -838, 2179, 4156, 773, 
-	-352, 789, 1921, -536, -2607, -2501, -2603, -2036, -1545, -1418, -961, 344, 534, 465, 717, 886, 
-	898, 802, 789, 200, -275, -501, -762, -774, -718, -868, -906, -768, -439, 112, -27, -122, 
-	395, 721, 498, 208, 176, 63, -209, -427, -442, -450, -395, -408, -315, -142, -59, -10, 
-	-81, -49, 105, 41, -153, -200, -98, -50, -67, 26, 96, 27, -83, -218, -320, -271, 
-	-144, -76, -4, 78, 101, 147, 70, 6, 51, 68, 3, -131, -298, -369, -202, -81, 
-	-91, -123, -112, -75, -39, -29, -85, -75, -105, -460, -679, -463, -4, 334, 301, 295
-};
-
-static const short ugen_H_20e080a0c[] = { 
-	0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 
-	0, -1, 5, 4, -2, -1, 2, 9, 0, 13, 108, 377, 553, 309, -67, -4, 
-	-120, -540, 158, 1260, 1625, 1937, 2869, 3673, 2883, 1283, 105, -689, -1009, -1257, -2115, -2489, 
-	-1540, -478, -99, 155, 453, 478, 517, 687, 486, 74, -68, -166, -441, -680, -752, -798, 
-	-744, -663, -553, -463, -345, -151, -31, 76, 146, 147, 69, -29, -102, -171, -218, -243, 
-	-262, -280, -312, -305, -286, -243, -182, -125, -68, -59, -63, -54, -47, -42, -87, -122, 
-	-140, -173, -187, -197, -196, -191, -164, -121, -57, 0, 14, 11, 11, 16, 6, -18, 
-	-48, -76, -82, -90, -133, -196, -193, -131, -108, -132, -164, -169, -157, -148, -155, -174
-};
-
-static const short ugen_H_20e080a1c[] = { 
-	189, -308, 436, -480, 9751, 12983, -22830, -18583, 8232, 6671, 5851, 6853, 20887, 24174, -224, -14524, 
-	-7225, -337, 4081, -858, -10666, -9521, -6127, -2643, -1435, -167, 275, -1214, -565, 2991, 3803, 351, 
-	-354, 1184, 2234, -604, -2478, -2144, -2153, -2059, -1874, -1685, -1112, 12, 322, 391, 674, 944, 
-	847, 827, 912, 385, -95, -390, -658, -685, -630, -839, -1006, -931, -565, -38, -242, -142, 
-	426, 653, 453, 240, 294, 146, -147, -360, -384, -376, -381, -423, -349, -198, -107, -73, 
-	-157, -75, 108, 6, -164, -172, -35, -9, -5, 88, 94, -22, -135, -233, -339, -256, 
-	-142, -73, 15, 62, 48, 48, 18, 24, 77, 76, 17, -94, -264, -312, -201, -117, 
-	-130, -140, -105, -92, -51, -49, -89, -99, -172, -511, -645, -372, 53, 324, 276, 293
-};
-
-static const short ugen_H_20e085a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 
-	0, 0, 3, 6, -1, 2, -1, 10, 2, 11, 10, 178, 386, 503, 946, -154, 
-	-1404, -269, 448, 628, 1441, 1831, 2311, 3489, 3602, 1831, 477, 113, -769, -1682, -1965, -2170, 
-	-1742, -614, 71, 57, 12, 141, 405, 581, 449, 209, -115, -187, -205, -463, -683, -740, 
-	-684, -602, -512, -438, -376, -267, -133, -12, 40, 26, -7, -40, -90, -182, -190, -197, 
-	-234, -211, -214, -224, -222, -213, -211, -190, -120, -96, -91, -91, -70, -56, -92, -104, 
-	-129, -153, -192, -232, -215, -184, -138, -105, -70, -26, 12, 56, 45, 7, -29, -31, 
-	-33, -59, -79, -135, -193, -231, -191, -112, -94, -123, -168, -179, -147, -121, -127, -154
-};
-
-static const short ugen_H_20e085a1c[] = { 
-	227, -360, 509, -542, 10533, 12175, -24799, -16876, 9507, 6624, 4763, 7505, 23215, 21346, -3634, -14075, 
-	-5313, 1492, 5120, -1634, -11871, -8896, -5278, -3221, -2124, 143, -159, -2064, -347, 3533, 3691, 0, 
-	-51, 1532, 2172, -640, -2189, -1902, -1810, -1709, -2125, -2066, -1220, -237, -62, 301, 751, 879, 
-	807, 853, 973, 492, 141, -144, -602, -631, -587, -759, -1028, -1020, -672, -247, -408, -199, 
-	431, 575, 432, 313, 367, 213, -102, -260, -301, -294, -335, -466, -388, -219, -128, -154, 
-	-222, -102, 98, 5, -163, -146, -12, 45, 53, 116, 98, -34, -136, -251, -347, -255, 
-	-119, -32, 3, -4, -29, 7, -4, 29, 106, 114, 65, -61, -219, -268, -191, -148, 
-	-167, -158, -115, -108, -62, -37, -74, -100, -205, -538, -617, -311, 96, 303, 239, 287
-};
-
-static const short ugen_H_20e090a0c[] = { 
-	0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 1, 1, 0, 2, 0, 0, 
-	0, 0, 7, 0, 2, 1, 8, 0, 1, 11, -9, 52, 394, 1002, 465, -588, 
-	-761, -538, 438, 1039, 929, 1716, 2806, 2851, 2488, 2162, 1212, 341, -203, -1424, -2581, -1968, 
-	-923, -597, -164, 81, -99, -170, 212, 480, 315, 98, -19, -149, -255, -320, -550, -691, 
-	-614, -512, -423, -418, -347, -266, -215, -97, -31, -54, -89, -94, -118, -183, -220, -206, 
-	-172, -150, -123, -118, -177, -194, -191, -199, -186, -147, -85, -76, -89, -103, -126, -112, 
-	-136, -181, -207, -215, -187, -150, -102, -64, -35, -14, 9, 49, 45, 8, -40, -62, 
-	-54, -56, -90, -159, -225, -250, -193, -107, -72, -95, -145, -163, -127, -81, -85, -138
-};
-
-static const short ugen_H_20e090a1c[] = { 
-	236, -369, 520, -625, 9985, 12886, -24513, -17356, 9897, 6678, 4110, 7411, 23926, 19945, -5240, -13509, 
-	-3731, 2888, 5453, -1675, -12437, -8657, -4718, -3666, -2799, -62, -341, -2725, -409, 3750, 3791, -85, 
-	189, 1936, 2226, -799, -2106, -1474, -1598, -1608, -1962, -2162, -1614, -496, -251, 35, 679, 923, 
-	751, 802, 1000, 600, 276, 93, -427, -609, -572, -705, -989, -1056, -762, -410, -572, -270, 
-	376, 541, 400, 313, 428, 260, -25, -188, -218, -246, -294, -460, -426, -244, -155, -199, 
-	-280, -134, 59, -14, -148, -114, -10, 29, 71, 163, 139, -39, -155, -247, -311, -223, 
-	-136, -81, -61, -34, -51, -30, -56, 8, 151, 192, 135, -51, -207, -245, -172, -186, 
-	-238, -181, -122, -120, -77, -14, -37, -87, -226, -565, -613, -287, 114, 279, 200, 261
-};
-
-static const short ugen_H_20e095a0c[] = { 
-	0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-	-1, 1, 2, -1, 4, 0, 17, -4, 3, -11, 7, 55, 720, 1130, -484, -1137, 
-	3, 288, 122, 784, 1559, 1925, 2734, 2437, 1257, 1367, 1669, 751, -289, -956, -2178, -2282, 
-	-659, 247, -126, -254, -32, -83, -39, 174, 227, 22, -104, -130, -320, -443, -431, -536, 
-	-603, -451, -318, -308, -327, -245, -193, -142, -75, -112, -159, -187, -181, -227, -248, -224, 
-	-149, -71, -96, -108, -119, -136, -165, -196, -185, -138, -84, -100, -128, -140, -168, -191, 
-	-195, -190, -194, -182, -144, -105, -56, -15, 4, 17, 13, 2, -2, -19, -49, -76, 
-	-96, -105, -106, -153, -232, -259, -200, -110, -57, -70, -112, -127, -98, -68, -67, -117
-};
-
-static const short ugen_H_20e095a1c[] = { 
-	196, -307, 426, -607, 8044, 14796, -21562, -20119, 9345, 6917, 3805, 6598, 22939, 20529, -5263, -13287, 
-	-2657, 3956, 5506, -1061, -12291, -8995, -4393, -3869, -3443, -877, -328, -3016, -941, 3686, 4069, -3, 
-	429, 2315, 2445, -644, -2215, -1304, -1313, -1512, -1987, -2019, -1667, -933, -536, -77, 457, 812, 
-	827, 774, 930, 675, 399, 254, -249, -479, -555, -693, -928, -1035, -849, -529, -643, -351, 
-	315, 456, 367, 298, 454, 315, 34, -123, -166, -209, -270, -420, -404, -262, -185, -210, 
-	-308, -186, 14, -40, -155, -102, -10, 13, 66, 191, 168, -21, -136, -179, -273, -234, 
-	-178, -161, -109, -50, -50, -63, -85, 7, 183, 251, 193, 4, -189, -255, -199, -227, 
-	-278, -208, -118, -120, -70, 18, 10, -68, -235, -566, -616, -280, 83, 246, 179, 235
-};
-
-static const short ugen_H_20e100a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 
-	-3, 2, -1, 2, -4, 4, 7, 6, -3, -18, 0, 428, 1146, 89, -1184, -605, 
-	213, 651, 687, 714, 1712, 3021, 2297, 1047, 968, 789, 838, 772, 12, -998, -1637, -1593, 
-	-907, 288, 672, -26, -282, 78, 19, -169, -30, 19, -137, -375, -467, -496, -476, -457, 
-	-512, -426, -247, -185, -229, -179, -107, -124, -141, -148, -166, -254, -306, -300, -257, -193, 
-	-175, -146, -107, -80, -74, -94, -130, -127, -94, -112, -140, -141, -143, -194, -255, -273, 
-	-238, -184, -158, -138, -104, -54, -5, 23, 25, 17, 16, -21, -62, -78, -89, -103, 
-	-115, -129, -149, -174, -220, -228, -188, -134, -70, -47, -64, -82, -80, -76, -87, -116
-};
-
-static const short ugen_H_20e100a1c[] = { 
-	99, -123, 160, -318, 4960, 16605, -15072, -24502, 7036, 7796, 3400, 5548, 20102, 22633, -3126, -13785, 
-	-2316, 4883, 5594, -30, -11400, -9820, -4401, -3718, -3872, -2326, -385, -2798, -1744, 3041, 4441, 559, 
-	310, 2550, 2938, -158, -2259, -1250, -1258, -1389, -1865, -2141, -1624, -962, -917, -414, 343, 687, 
-	745, 791, 928, 683, 425, 426, -78, -384, -445, -632, -892, -1047, -881, -606, -636, -455, 
-	222, 398, 315, 277, 415, 370, 83, -85, -122, -206, -234, -360, -364, -232, -197, -213, 
-	-321, -247, -46, -59, -206, -141, 13, 35, 36, 174, 206, 43, -84, -144, -269, -269, 
-	-186, -179, -169, -107, -63, -40, -47, -2, 152, 263, 267, 94, -167, -311, -261, -249, 
-	-281, -225, -120, -101, -51, 49, 26, -45, -206, -540, -623, -313, 32, 187, 152, 229
-};
-
-static const short ugen_H_20e105a0c[] = { 
-	2, 2, 2, 4, 2, 3, 3, 2, 3, 3, 4, 4, 5, 2, 5, 3, 
-	4, 3, 3, 8, 0, 8, 11, 14, 0, -9, 192, 1185, 618, -1375, -948, 251, 
-	500, 596, 939, 1627, 2551, 2728, 1572, 377, 271, 640, 141, -134, -23, -539, -1282, -1130, 
-	-366, 27, 683, 861, 190, -132, 26, -135, -315, -124, -229, -546, -741, -583, -469, -528, 
-	-465, -340, -197, -84, -2, -40, -76, -86, -88, -127, -211, -281, -364, -336, -268, -261, 
-	-261, -216, -125, -74, -59, -45, 0, -2, -57, -94, -129, -151, -205, -265, -302, -290, 
-	-240, -178, -109, -68, -33, -7, 14, 38, 37, 35, 18, -34, -96, -131, -119, -105, 
-	-124, -138, -160, -184, -186, -173, -161, -138, -70, -15, -12, -33, -62, -87, -110, -126
-};
-
-static const short ugen_H_20e105a1c[] = { 
-	-65, 141, -215, 216, 1667, 16150, -4890, -27886, 1334, 9583, 2776, 4515, 15880, 24390, 2085, -14539, 
-	-3294, 5846, 5805, 1225, -9751, -10774, -4892, -3454, -3829, -4050, -1120, -1968, -2540, 1801, 4552, 1592, 
-	287, 2277, 3412, 947, -2160, -1330, -1078, -1520, -1736, -2078, -1870, -1044, -881, -765, -97, 612, 
-	753, 647, 927, 820, 398, 428, 168, -264, -361, -534, -803, -1051, -945, -620, -614, -573, 
-	119, 397, 262, 192, 336, 403, 144, -63, -101, -181, -207, -258, -319, -217, -192, -205, 
-	-319, -320, -136, -84, -215, -187, -39, 37, 52, 157, 236, 99, -56, -140, -253, -281, 
-	-199, -190, -213, -147, -73, -15, -8, -13, 115, 231, 290, 168, -104, -337, -348, -280, 
-	-278, -218, -126, -76, -47, 46, 52, -27, -161, -492, -633, -368, -47, 119, 130, 205
-};
-
-static const short ugen_H_20e110a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, -1, -1, 0, -3, 
-	0, -6, 1, -1, -2, -3, 8, -10, 13, 43, 981, 1255, -1103, -1763, -80, 801, 
-	727, 702, 1292, 2721, 3409, 1718, 199, 171, 206, -180, -375, -604, -763, -416, -469, -770, 
-	-316, 382, 621, 1038, 1084, 238, -254, -218, -243, -399, -557, -742, -818, -779, -650, -539, 
-	-537, -347, -68, 97, 101, 21, 2, 16, -9, -128, -259, -298, -324, -394, -434, -395, 
-	-330, -261, -222, -144, -18, 40, 56, 43, -4, -80, -147, -202, -267, -304, -325, -305, 
-	-232, -167, -91, -34, 0, -15, -21, 15, 21, 29, -10, -95, -147, -153, -132, -134, 
-	-161, -171, -155, -164, -189, -177, -168, -133, -66, -23, -12, -26, -67, -134, -168, -153
-};
-
-static const short ugen_H_20e110a1c[] = { 
-	-188, 314, -442, 554, -373, 12032, 6545, -25988, -8678, 10937, 3117, 2981, 11488, 23695, 9985, -13382, 
-	-6573, 6579, 6456, 2538, -7383, -11437, -5884, -3450, -3314, -5127, -3094, -1134, -2576, -5, 4175, 2748, 
-	495, 1961, 3435, 2228, -1435, -1601, -795, -1435, -1857, -2014, -1980, -1370, -957, -798, -449, 141, 
-	780, 690, 768, 885, 541, 375, 309, -78, -279, -432, -688, -953, -1027, -708, -534, -648, 
-	-81, 381, 260, 92, 204, 415, 209, -35, -108, -116, -150, -194, -279, -211, -167, -220, 
-	-337, -376, -237, -115, -221, -257, -95, 24, 90, 141, 214, 121, -24, -86, -236, -323, 
-	-237, -167, -190, -186, -97, -40, 2, -3, 76, 192, 230, 197, -10, -293, -425, -340, 
-	-247, -200, -129, -86, -75, 20, 76, -11, -119, -411, -652, -454, -140, 63, 87, 145
-};
-
-static const short ugen_H_20e115a0c[] = { 
-	2, 1, 1, 3, 1, 2, 2, 1, 0, 2, 1, 2, 2, 4, 3, 4, 
-	0, 3, 2, 8, -3, 17, -6, 15, -1, 679, 1768, -418, -2344, -747, 705, 1026, 
-	887, 1149, 2470, 3721, 2595, 520, -302, -191, -66, -624, -1085, -1023, -895, -702, -100, 22, 
-	-252, 324, 1057, 1298, 1217, 831, 63, -362, -313, -557, -884, -964, -853, -842, -893, -715, 
-	-446, -236, -19, 175, 187, 152, 188, 152, 28, -102, -138, -273, -421, -478, -481, -441, 
-	-436, -362, -246, -107, -8, 64, 118, 105, 58, -73, -173, -201, -237, -279, -295, -249, 
-	-191, -125, -75, -39, -9, -5, -6, 7, 29, 5, -64, -123, -130, -128, -138, -133, 
-	-109, -111, -145, -168, -175, -152, -136, -121, -63, -18, 8, -9, -80, -154, -180, -139
-};
-
-static const short ugen_H_20e115a1c[] = { 
-	-139, 188, -227, 263, -438, 5533, 13932, -15513, -19785, 7961, 5917, 918, 7453, 20078, 17397, -7180, 
-	-11333, 5226, 8118, 3647, -4348, -11368, -7175, -3862, -2957, -4756, -5509, -1772, -1648, -1416, 2752, 3808, 
-	958, 1601, 3366, 3209, -232, -1701, -545, -1083, -1890, -2113, -2055, -1656, -1132, -1026, -574, -182, 
-	446, 774, 729, 827, 654, 483, 423, 60, -181, -281, -548, -848, -985, -828, -520, -603, 
-	-365, 271, 305, 109, 71, 329, 278, 28, -47, -35, -96, -142, -207, -227, -173, -223, 
-	-314, -390, -328, -178, -208, -271, -123, 26, 84, 94, 188, 191, 27, -66, -165, -321, 
-	-279, -131, -127, -174, -142, -72, 1, 25, 57, 146, 192, 194, 62, -192, -394, -379, 
-	-241, -151, -124, -112, -87, 0, 87, 32, -77, -314, -627, -513, -206, -27, 48, 132
-};
-
-static const short ugen_H_20e120a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 4, 0, 
-	0, -1, 3, 0, 0, 11, -5, 5, 319, 1937, 657, -2653, -1669, 522, 1140, 1013, 
-	1166, 2370, 4085, 3372, 631, -410, -251, -271, -834, -1235, -1370, -1432, -946, -457, -139, 229, 
-	336, 386, 1154, 1601, 1227, 863, 566, 39, -609, -897, -1025, -1036, -1030, -1060, -958, -739, 
-	-415, -211, -50, 158, 322, 353, 277, 198, 139, 32, -185, -384, -454, -457, -526, -577, 
-	-517, -390, -262, -150, -36, 82, 158, 83, -10, -49, -113, -206, -244, -212, -198, -189, 
-	-184, -168, -129, -67, -26, -19, -2, -6, -21, -67, -124, -149, -152, -133, -107, -68, 
-	-46, -75, -156, -222, -198, -141, -122, -129, -113, -40, 5, -31, -115, -173, -170, -129
-};
-
-static const short ugen_H_20e120a1c[] = { 
-	48, -124, 201, -287, 349, 569, 12894, 445, -23981, -2492, 9505, 620, 3084, 14972, 20617, 3350, 
-	-12601, -512, 9991, 5171, -1310, -9838, -8849, -4287, -3486, -3471, -6453, -4251, -1300, -1462, 785, 3924, 
-	1950, 1119, 3107, 3840, 1478, -1674, -589, -340, -1675, -2226, -2161, -1978, -1351, -1167, -956, -376, 
-	113, 638, 714, 798, 732, 534, 571, 296, -131, -205, -345, -687, -915, -859, -618, -562, 
-	-599, -3, 329, 160, 10, 180, 350, 146, 0, 8, -11, -93, -173, -253, -214, -214, 
-	-296, -418, -440, -281, -143, -209, -170, -35, 32, 64, 155, 223, 69, -61, -77, -207, 
-	-301, -194, -120, -139, -141, -119, -63, 13, 51, 118, 177, 169, 77, -110, -322, -372, 
-	-246, -132, -111, -141, -128, -60, 54, 57, -45, -216, -573, -584, -292, -115, -10, 90
-};
-
-static const short ugen_H_20e125a0c[] = { 
-	0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 2, 3, 4, 0, 
-	3, -1, 12, -13, 27, -21, 42, 78, 1715, 1820, -2388, -2777, 69, 1273, 1282, 1083, 
-	2173, 4386, 4414, 1231, -717, -739, -305, -557, -1456, -1830, -1803, -1316, -841, -216, 75, 132, 
-	655, 1103, 1205, 1226, 1237, 947, 768, 319, -567, -1117, -1150, -1137, -1205, -1111, -919, -697, 
-	-500, -212, 31, 200, 379, 427, 413, 334, 167, -61, -240, -305, -416, -534, -602, -581, 
-	-512, -414, -297, -177, 2, 69, 51, 44, 13, -37, -100, -136, -146, -127, -135, -179, 
-	-201, -196, -151, -96, -37, -3, -9, -41, -94, -126, -157, -180, -151, -83, -12, 21, 
-	11, -61, -177, -251, -223, -149, -117, -132, -134, -70, -34, -62, -102, -129, -124, -115
-};
-
-static const short ugen_H_20e125a1c[] = { 
-	88, -162, 205, -232, 286, -422, 5697, 11707, -14576, -16169, 7572, 4249, -754, 8790, 19361, 12769, 
-	-6432, -7109, 7813, 8116, 1097, -6536, -10250, -5099, -3898, -3453, -5020, -6474, -2998, -1120, -245, 2672, 
-	3067, 972, 2514, 3931, 3130, -402, -1344, 124, -779, -2163, -2353, -2151, -1797, -1258, -1159, -697, 
-	-239, 357, 688, 754, 840, 619, 538, 590, 131, -234, -252, -437, -733, -854, -744, -605, 
-	-679, -363, 192, 240, 56, 83, 328, 287, 101, 44, 43, -70, -140, -241, -255, -239, 
-	-338, -432, -454, -325, -155, -142, -193, -98, 4, 48, 71, 180, 163, 13, -27, -106, 
-	-249, -256, -152, -125, -139, -129, -108, -11, 47, 94, 170, 172, 97, -65, -248, -342, 
-	-226, -93, -100, -163, -175, -114, -12, 68, -13, -144, -470, -619, -360, -197, -89, 43
-};
-
-static const short ugen_H_20e130a0c[] = { 
-	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 4, -2, 9, 
-	-10, 18, -18, 25, -19, 37, -10, 1239, 2782, -1494, -3925, -682, 1274, 1572, 1269, 1968, 
-	4366, 5341, 2151, -683, -1032, -690, -711, -1408, -1780, -2200, -1986, -1231, -405, 8, 133, 455, 
-	901, 1567, 1281, 815, 871, 1068, 771, 141, -372, -1004, -1231, -1246, -1197, -1122, -925, -666, 
-	-430, -125, 94, 225, 368, 546, 488, 219, 52, -35, -169, -337, -465, -537, -606, -566, 
-	-476, -406, -284, -167, -76, -13, 20, 27, -15, -36, -30, -28, -79, -126, -152, -174, 
-	-191, -198, -152, -102, -43, -25, -61, -104, -156, -191, -182, -138, -88, -25, 50, 85, 
-	51, -71, -229, -289, -237, -165, -129, -144, -154, -118, -86, -64, -69, -75, -85, -108
-};
-
-static const short ugen_H_20e130a1c[] = { 
-	-48, 66, -131, 186, -264, 319, 261, 10509, 2721, -20047, -4256, 8285, -646, 2042, 14324, 17656, 
-	3666, -7880, 1604, 9452, 3824, -2770, -9223, -7578, -3424, -4189, -4160, -6056, -5360, -2250, -693, 1348, 
-	3216, 1641, 1591, 3672, 3927, 1678, -1178, -438, 51, -1417, -2439, -2357, -2106, -1641, -1308, -883, 
-	-470, -102, 452, 681, 918, 866, 480, 505, 524, 11, -252, -340, -526, -732, -806, -715, 
-	-692, -655, -126, 245, 156, 61, 247, 418, 249, 50, 27, -38, -142, -193, -316, -333, 
-	-369, -397, -409, -371, -253, -144, -149, -124, -46, -10, 15, 107, 221, 126, -27, -90, 
-	-176, -240, -193, -159, -172, -149, -93, -33, 14, 32, 130, 195, 126, -28, -202, -312, 
-	-243, -79, -64, -179, -238, -175, -88, 22, -4, -110, -348, -611, -437, -276, -198, -20
-};
-
-static const short ugen_H_20e135a0c[] = { 
-	0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 2, 0, 5, -5, 10, -6, 
-	5, -2, 0, 12, 1, 9, 688, 3278, 20, -4806, -1861, 1157, 1775, 1592, 1931, 4367, 
-	6014, 3070, -532, -1201, -880, -750, -1624, -2116, -2202, -2232, -1748, -976, -140, 225, 376, 866, 
-	1558, 1371, 1079, 750, 572, 793, 443, -117, -426, -566, -1034, -1371, -1298, -971, -742, -569, 
-	-255, -92, 122, 383, 430, 341, 284, 258, 79, -162, -251, -322, -456, -543, -548, -496, 
-	-383, -362, -334, -204, -78, -46, -57, -22, 35, 42, -10, -72, -109, -110, -135, -161, 
-	-184, -173, -128, -95, -76, -92, -146, -187, -179, -160, -148, -99, -34, 39, 96, 106, 
-	33, -125, -274, -317, -246, -181, -162, -157, -168, -160, -95, -36, -36, -50, -57, -84
-};
-
-static const short ugen_H_20e135a1c[] = { 
-	-49, 51, -77, 60, -54, 43, -128, 2913, 11174, -6993, -16762, 3677, 4136, -2004, 6741, 16478, 
-	12711, -1966, -3445, 7420, 6433, -370, -5282, -9006, -5112, -3253, -4730, -5094, -5967, -3944, -1808, -86, 
-	2579, 2772, 1120, 2667, 4217, 3227, 351, -968, 166, -452, -2068, -2526, -2340, -1952, -1496, -1241, 
-	-622, -250, 150, 528, 769, 969, 752, 429, 521, 353, -85, -239, -429, -625, -764, -747, 
-	-678, -751, -511, 64, 227, 176, 253, 433, 340, 102, -5, -26, -120, -221, -331, -379, 
-	-305, -329, -408, -422, -323, -170, -108, -141, -71, -26, 14, 73, 171, 177, 0, -77, 
-	-103, -176, -202, -172, -162, -162, -90, -45, -16, 18, 80, 199, 167, 39, -144, -288, 
-	-259, -114, -49, -143, -238, -213, -140, -52, -23, -90, -213, -523, -518, -329, -271, -86
-};
-
-static const short ugen_H_20e140a0c[] = { 
-	0, 0, 0, 0, 0, 0, 1, 0, -2, 2, 1, 2, 0, 1, 4, -5, 
-	15, -24, 39, -32, 72, 243, 3223, 1833, -5047, -3443, 876, 1842, 1925, 2088, 4412, 6632, 
-	4008, -287, -1430, -1146, -728, -1615, -2380, -2430, -2617, -2027, -1291, -416, 43, 276, 837, 1641, 
-	1713, 1120, 728, 663, 661, -6, -198, -186, -352, -591, -940, -1098, -1061, -795, -549, -344, 
-	-82, 146, 185, 227, 325, 307, 199, 52, -84, -178, -290, -384, -441, -449, -399, -393, 
-	-428, -335, -214, -158, -167, -108, 0, 45, 27, -59, -82, -67, -78, -123, -142, -134, 
-	-128, -118, -130, -143, -148, -154, -153, -160, -155, -129, -86, -23, 22, 68, 96, 83, 
-	-10, -177, -307, -321, -253, -203, -179, -157, -164, -126, -54, -16, -5, -24, -34, -69
-};
-
-static const short ugen_H_20e140a1c[] = { 
-	40, -78, 93, -129, 155, -196, 246, -244, 5946, 8019, -12894, -9886, 5796, -166, 11, 10170, 
-	15725, 7759, -3006, 2396, 8629, 1712, -3061, -6065, -7731, -3548, -4018, -5354, -5465, -5091, -2780, -1502, 
-	633, 3016, 2321, 1473, 3514, 3962, 2209, -213, -453, 174, -1232, -2437, -2541, -2213, -1712, -1451, 
-	-1033, -369, 5, 461, 765, 790, 741, 612, 539, 521, 43, -232, -274, -480, -686, -766, 
-	-702, -704, -700, -247, 246, 305, 287, 333, 368, 171, -29, -99, -112, -197, -279, -337, 
-	-321, -302, -379, -428, -387, -250, -99, -96, -93, -10, 32, 41, 49, 123, 68, -43, 
-	-64, -100, -173, -173, -131, -149, -127, -65, -38, 13, 82, 158, 185, 80, -80, -244, 
-	-282, -182, -90, -88, -189, -239, -172, -110, -69, -120, -134, -351, -564, -397, -311, -159
-};
-
-static const short ugen_H_20e145a0c[] = { 
-	0, 0, -1, 0, -1, 0, 0, -2, 0, 3, 0, 3, -8, 16, -20, 29, 
-	-37, 47, -50, 102, 13, 2709, 3540, -4450, -5259, 340, 1857, 2115, 2334, 4606, 7239, 4901, 
-	67, -1555, -1464, -917, -1547, -2673, -2468, -2767, -2581, -1743, -613, 96, 178, 551, 1553, 2083, 
-	1328, 939, 624, 495, 211, -359, -694, -657, -541, -654, -732, -642, -587, -695, -253, 185, 
-	99, 46, 188, 303, 218, 59, -23, -142, -226, -238, -310, -398, -365, -372, -386, -370, 
-	-286, -191, -201, -166, -96, -15, -7, -68, -135, -108, -55, -70, -122, -126, -102, -94, 
-	-124, -167, -180, -177, -137, -129, -131, -120, -96, -74, -48, 1, 53, 79, 61, 0, 
-	-92, -211, -314, -324, -276, -236, -184, -139, -111, -56, -21, -1, 7, -9, -46, -116
-};
-
-static const short ugen_H_20e145a1c[] = { 
-	-8, 19, -50, 59, -103, 136, -192, 222, 269, 7944, 3307, -14273, -3827, 3903, -1906, 2933, 
-	11456, 13813, 4575, -783, 6433, 6055, -2202, -3669, -6240, -6340, -3031, -5090, -5491, -5345, -4041, -2012, 
-	-1047, 1218, 3016, 2108, 2198, 3895, 3186, 1355, -290, -16, -423, -1992, -2434, -2369, -2117, -1647, 
-	-1258, -723, -57, 315, 713, 871, 784, 691, 461, 452, 354, -158, -383, -415, -473, -676, 
-	-823, -734, -585, -378, 83, 337, 289, 265, 252, 181, 15, -102, -155, -152, -194, -267, 
-	-367, -359, -363, -388, -357, -311, -186, -68, -38, -19, -17, -18, -6, 41, 88, 16, 
-	-54, -52, -87, -171, -150, -122, -136, -98, -35, 3, 59, 115, 164, 110, -56, -223, 
-	-290, -213, -128, -100, -152, -224, -194, -138, -118, -166, -168, -181, -475, -486, -333, -253
-};
-
-static const short ugen_H_20e150a0c[] = { 
-	0, 0, 0, -3, 0, -1, -1, -4, 4, -2, 7, -14, 16, -21, 25, -33, 
-	35, -40, 75, -23, 1975, 4778, -2986, -7024, -644, 1914, 2152, 2566, 4850, 7964, 5792, 473, 
-	-1582, -1718, -1181, -1546, -3043, -2674, -2671, -2872, -2211, -1114, 55, 292, 449, 1392, 2104, 1571, 
-	1154, 621, 730, 367, -579, -816, -1029, -958, -865, -664, -493, -320, -101, 16, 49, 167, 
-	297, 284, 235, 87, -55, -100, -252, -359, -309, -262, -311, -400, -430, -357, -276, -245, 
-	-174, -103, -54, -57, -35, -84, -156, -184, -147, -113, -116, -106, -106, -101, -119, -145, 
-	-202, -220, -140, -88, -101, -117, -81, -37, -54, -54, -22, 20, 42, 40, -8, -88, 
-	-160, -250, -323, -334, -282, -211, -161, -115, -34, 16, 17, -3, -12, -34, -101, -196
-};
-
-static const short ugen_H_20e150a1c[] = { 
-	-12, 16, -17, -2, 5, -36, 59, -101, 92, 1207, 8565, -972, -12623, -665, 1054, -1236, 
-	4827, 11496, 12046, 3552, 2506, 7238, 1938, -3712, -3435, -6313, -5289, -3419, -5649, -5269, -4928, -3199, 
-	-1493, -361, 1730, 2782, 2116, 2908, 3727, 2374, 817, -288, -106, -1063, -2288, -2418, -2266, -1900, 
-	-1494, -1047, -295, 267, 521, 874, 939, 804, 677, 384, 243, -6, -328, -400, -510, -632, 
-	-748, -659, -499, -378, -136, 251, 249, 154, 207, 191, 66, -75, -91, -109, -190, -288, 
-	-355, -384, -338, -354, -363, -314, -206, -77, -29, -62, -53, -40, -25, -6, 37, 69, 
-	2, -33, -34, -108, -173, -121, -86, -98, -63, -14, 33, 100, 114, 85, -33, -187, 
-	-260, -213, -140, -140, -152, -175, -189, -165, -165, -184, -219, -132, -264, -519, -374, -290
-};
-
-static const short ugen_H_20e155a0c[] = { 
-	0, 0, -1, 0, 0, -1, -4, 3, -2, 9, -12, 11, -13, 11, -13, 7, 
-	0, 10, 34, 1317, 5331, -979, -8276, -2147, 1991, 2119, 2728, 5064, 8786, 6766, 875, -1561, 
-	-1897, -1454, -1529, -3379, -3197, -2607, -2960, -2487, -1545, -204, 296, 453, 1311, 2259, 1659, 971, 
-	1043, 1020, 317, -644, -983, -1103, -1073, -1149, -1205, -813, 12, 251, 232, 385, 445, 425, 
-	388, 282, 70, -59, -169, -357, -460, -383, -359, -424, -433, -398, -362, -301, -231, -71, 
-	40, 61, -13, -51, -65, -148, -231, -220, -168, -137, -148, -158, -140, -161, -187, -226, 
-	-185, -96, -47, -63, -76, -44, -2, -12, -43, -32, -8, 5, 1, -37, -82, -128, 
-	-209, -300, -337, -314, -245, -167, -114, -37, 30, 45, 18, -18, -56, -110, -183, -241
-};
-
-static const short ugen_H_20e155a1c[] = { 
-	18, -27, 37, -44, 34, -45, 32, -29, 19, -44, 2263, 8048, -3763, -9952, -223, -682, 
-	245, 5418, 11307, 10938, 4138, 4785, 5547, -1499, -3326, -3228, -6476, -4562, -4212, -5568, -5014, -4410, 
-	-2341, -1105, 294, 2071, 2647, 2335, 3231, 3026, 1852, 517, -326, -515, -1673, -2198, -2329, -2216, 
-	-1733, -1139, -670, 0, 421, 721, 1015, 965, 815, 565, 312, 119, -268, -509, -513, -558, 
-	-669, -702, -479, -266, -238, -135, 152, 205, 235, 196, 126, 45, -44, -127, -208, -285, 
-	-316, -355, -402, -352, -338, -278, -233, -148, -48, -23, -49, -73, -73, -26, 7, 51, 
-	66, 9, -21, -29, -107, -145, -90, -83, -82, -50, 0, 54, 80, 63, -11, -145, 
-	-230, -212, -130, -127, -180, -186, -162, -157, -191, -209, -243, -191, -103, -369, -459, -293
-};
-
-static const short ugen_H_20e160a0c[] = { 
-	-2, -2, -1, 0, 0, -6, 2, -1, 5, -8, 3, -2, -1, 0, -16, 28, 
-	-30, 70, 877, 5306, 1057, -8637, -4097, 1920, 2128, 2808, 5221, 9491, 7928, 1359, -1471, -2093, 
-	-1740, -1489, -3556, -3822, -2841, -3063, -2645, -1778, -437, 237, 323, 1327, 2252, 1768, 1395, 1102, 
-	779, 483, -501, -1032, -1224, -1261, -1368, -1325, -920, -327, 36, 356, 760, 909, 760, 410, 
-	255, 229, 20, -185, -332, -510, -534, -510, -506, -535, -527, -377, -245, -217, -44, 140, 
-	143, 47, 8, -22, -105, -199, -226, -209, -219, -224, -251, -243, -234, -218, -204, -164, 
-	-63, 4, -13, -27, -6, 15, 13, -5, -32, -39, -26, -50, -96, -106, -86, -143, 
-	-260, -340, -338, -257, -164, -127, -67, 20, 66, 46, -5, -65, -143, -205, -230, -257
-};
-
-static const short ugen_H_20e160a1c[] = { 
-	-7, 20, -30, 39, -56, 56, -80, 84, -107, 121, -128, 3182, 6952, -4974, -7876, -1096, 
-	-945, 1227, 5514, 11375, 10417, 5276, 5277, 2929, -3189, -2597, -3026, -6630, -4531, -4406, -5442, -4846, 
-	-3637, -1560, -730, 744, 2375, 2648, 2432, 3095, 2374, 1419, 318, -445, -1002, -1997, -2142, -2167, 
-	-2032, -1499, -841, -331, 261, 517, 851, 1101, 905, 697, 468, 243, 75, -290, -580, -696, 
-	-638, -605, -607, -462, -320, -262, -73, 166, 237, 311, 234, 105, -11, -74, -149, -248, 
-	-367, -381, -396, -394, -345, -304, -228, -187, -98, -32, -36, -64, -81, -65, -19, 28, 
-	77, 58, 24, 18, -23, -138, -152, -97, -101, -100, -60, 10, 69, 58, -18, -124, 
-	-206, -186, -133, -128, -177, -199, -157, -138, -193, -243, -246, -255, -129, -160, -418, -358
-};
-
-static const short ugen_H_20e165a0c[] = { 
-	-2, -1, 0, 0, -6, 2, 0, 3, -2, 0, 2, -7, 9, -29, 39, -38, 
-	69, 631, 4981, 2664, -8036, -6065, 1363, 2293, 2797, 5394, 9943, 9091, 2075, -1249, -2207, -2137, 
-	-1499, -3584, -4360, -3199, -3272, -2961, -1916, -582, 266, 297, 959, 2355, 2324, 1433, 1033, 856, 
-	513, -495, -968, -1287, -1610, -1427, -1168, -1020, -613, -173, 259, 773, 1007, 984, 771, 506, 
-	280, 107, -56, -305, -576, -623, -549, -623, -706, -636, -441, -225, -138, -19, 69, 186, 
-	192, 93, 31, -43, -113, -195, -224, -286, -346, -377, -338, -274, -243, -204, -141, -38, 
-	49, 38, 21, 36, 49, 36, 18, 6, -39, -80, -101, -126, -144, -108, -92, -173, 
-	-274, -311, -273, -191, -131, -75, -22, 36, 70, 35, -47, -148, -219, -248, -260, -264
-};
-
-static const short ugen_H_20e165a1c[] = { 
-	3, -4, 13, -19, 30, -49, 56, -83, 99, -135, 169, -116, 3802, 5839, -5106, -6961, 
-	-1972, -504, 1559, 5938, 11312, 10342, 6177, 4347, 606, -3453, -1950, -3435, -6211, -4799, -4610, -4946, 
-	-4651, -2849, -991, -230, 977, 2635, 2717, 2165, 2701, 2114, 1086, -54, -631, -1362, -1982, -2071, 
-	-2045, -1810, -1203, -528, -132, 364, 679, 926, 898, 840, 684, 462, 297, 56, -370, -640, 
-	-647, -638, -678, -670, -576, -417, -293, 16, 299, 309, 278, 212, 179, 50, -94, -236, 
-	-363, -415, -394, -417, -395, -329, -250, -211, -167, -103, -63, -30, -43, -31, -26, 3, 
-	61, 98, 70, 16, 0, -58, -148, -170, -157, -132, -96, -18, 39, 34, -22, -95, 
-	-170, -194, -140, -131, -161, -168, -142, -142, -181, -242, -248, -264, -248, -106, -246, -386
-};
-
-static const short ugen_H_20e170a0c[] = { 
-	-3, 0, 0, -5, 0, 0, 2, -1, -3, 1, -13, 10, -29, 31, -36, 65, 
-	472, 4653, 3622, -6909, -7396, 169, 2453, 2825, 5553, 10263, 9991, 2983, -850, -2139, -2543, -1674, 
-	-3598, -4760, -3585, -3512, -3348, -2256, -612, 313, 47, 1035, 2628, 2343, 1505, 1136, 925, 570, 
-	-398, -1205, -1539, -1447, -1357, -1421, -1233, -525, -20, 173, 406, 770, 1082, 948, 767, 599, 
-	264, -24, -233, -523, -707, -706, -706, -750, -710, -531, -302, -192, 0, 178, 226, 183, 
-	153, 151, 59, -83, -209, -267, -352, -423, -454, -413, -339, -271, -204, -138, -39, 70, 
-	84, 46, 48, 74, 63, 37, 20, -35, -92, -133, -166, -197, -158, -89, -112, -194, 
-	-255, -245, -210, -167, -106, -68, -16, 43, 47, -31, -139, -212, -260, -281, -301, -230
-};
-
-static const short ugen_H_20e170a1c[] = { 
-	-2, 1, 0, 5, -11, 16, -34, 38, -66, 80, -119, 157, -11, 4114, 5050, -4934, 
-	-6904, -2342, -107, 2012, 6422, 10910, 10715, 6308, 2775, -812, -3102, -1616, -3999, -5992, -4420, -4800, 
-	-4819, -3845, -2297, -638, 248, 1233, 2531, 2655, 2280, 2099, 1581, 1128, -245, -1121, -1484, -1803, 
-	-1923, -1895, -1630, -955, -278, 92, 335, 575, 944, 984, 789, 682, 538, 211, -98, -351, 
-	-483, -552, -617, -832, -914, -695, -407, -222, 10, 260, 404, 399, 280, 171, 35, -134, 
-	-311, -392, -395, -385, -423, -407, -342, -250, -223, -203, -126, -17, 38, 21, 13, 20, 
-	55, 74, 74, 46, 0, -34, -95, -174, -197, -174, -123, -62, 0, 12, -25, -85, 
-	-148, -185, -165, -131, -141, -119, -92, -121, -178, -216, -237, -257, -317, -222, -111, -294
-};
-
-static const short ugen_H_20e175a0c[] = { 
-	0, 1, -4, 0, 0, 3, 0, -2, 1, -13, 12, -31, 32, -45, 75, 349, 
-	4419, 4116, -5842, -7789, -1249, 2167, 3026, 5677, 10509, 10641, 3891, -286, -1878, -2737, -1960, -3746, 
-	-5026, -3936, -3774, -3716, -2608, -976, 146, 531, 1045, 2356, 2533, 1803, 1261, 970, 634, -581, 
-	-1262, -1344, -1496, -1734, -1524, -1095, -494, -90, 64, 445, 704, 867, 890, 828, 722, 531, 
-	243, -148, -533, -741, -760, -763, -799, -736, -624, -442, -221, 28, 207, 280, 306, 263, 
-	189, 76, -79, -229, -345, -391, -426, -482, -462, -392, -276, -203, -135, -46, 61, 126, 
-	82, 41, 58, 89, 60, 31, -5, -86, -134, -169, -208, -205, -126, -61, -108, -174, 
-	-202, -193, -193, -156, -87, -48, 1, 21, -19, -116, -195, -227, -284, -328, -303, -133
-};
-
-static const short ugen_H_20e175a1c[] = { 
-	-2, 0, 0, 2, 0, -3, 9, -22, 23, -46, 54, -81, 117, 135, 4245, 4601, 
-	-4961, -7149, -2380, 428, 2756, 6340, 10621, 11079, 5652, 1353, -1444, -2661, -1822, -4200, -5703, -4321, 
-	-4285, -4649, -3549, -1599, -198, 461, 1262, 2407, 2483, 2356, 1940, 1018, 658, -151, -1092, -1669, 
-	-1737, -1754, -1722, -1425, -714, -184, 20, 360, 696, 928, 985, 816, 566, 387, 269, 97, 
-	-296, -485, -608, -809, -924, -866, -683, -488, -283, 30, 309, 421, 412, 315, 176, 16, 
-	-133, -277, -360, -398, -406, -457, -441, -359, -294, -247, -181, -79, 30, 85, 93, 51, 
-	29, 62, 63, 45, 30, 3, -82, -151, -191, -194, -163, -104, -39, -30, -52, -84, 
-	-139, -191, -180, -136, -121, -80, -28, -58, -163, -213, -212, -256, -319, -333, -138, -144
-};
-
-static const short ugen_H_20e180a0c[] = { 
-	0, -2, 0, 0, 2, 0, -2, 3, -16, 16, -38, 41, -60, 92, 236, 4260, 
-	4429, -5156, -7572, -2219, 1291, 3142, 5923, 10596, 11098, 4844, 383, -1627, -2650, -2089, -4012, -5326, 
-	-4188, -4084, -3938, -3267, -1492, 410, 598, 1009, 2293, 2608, 2115, 1592, 1030, 396, -555, -906, 
-	-1360, -1905, -1835, -1508, -1126, -588, -178, 39, 388, 799, 1013, 792, 617, 691, 574, 361, 
-	60, -379, -723, -803, -740, -830, -861, -693, -417, -278, -24, 281, 414, 387, 271, 223, 
-	93, -103, -292, -374, -394, -431, -480, -468, -394, -296, -214, -152, -49, 79, 127, 96, 
-	50, 51, 67, 60, 54, 20, -50, -121, -171, -207, -196, -151, -79, -49, -77, -130, 
-	-154, -181, -188, -144, -93, -39, -4, -15, -100, -185, -206, -245, -314, -355, -232, -76
-};
-
-static const short ugen_H_20e180a1c[] = { 
-	0, -2, 0, 0, 2, 0, -2, 3, -16, 16, -38, 41, -60, 92, 236, 4260, 
-	4429, -5156, -7572, -2219, 1291, 3142, 5923, 10596, 11098, 4844, 383, -1627, -2650, -2089, -4012, -5326, 
-	-4188, -4084, -3938, -3267, -1492, 410, 598, 1009, 2293, 2608, 2115, 1592, 1030, 396, -555, -906, 
-	-1360, -1905, -1835, -1508, -1126, -588, -178, 39, 388, 799, 1013, 792, 617, 691, 574, 361, 
-	60, -379, -723, -803, -740, -830, -861, -693, -417, -278, -24, 281, 414, 387, 271, 223, 
-	93, -103, -292, -374, -394, -431, -480, -468, -394, -296, -214, -152, -49, 79, 127, 96, 
-	50, 51, 67, 60, 54, 20, -50, -121, -171, -207, -196, -151, -79, -49, -77, -130, 
-	-154, -181, -188, -144, -93, -39, -4, -15, -100, -185, -206, -245, -314, -355, -232, -76
-};
-
-static const short ugen_H_30e000a0c[] = { 
-	-7, 5, -3, 4, 0, -3, 2, -27, 33, -58, 58, -82, 81, 654, 6312, 2092, 
-	-10147, -2456, -1372, -2538, 8573, 9340, 4578, 5325, 13775, 5452, -7483, -2712, -5025, -10467, -1680, 1056, 
-	-5969, -3754, 856, 988, -399, 340, 1378, -234, 132, 1818, -376, -1765, -94, 162, -1101, -1369, 
-	-684, -648, -651, 159, 250, -270, 203, 735, 698, 361, 123, 59, -44, -474, -475, -491, 
-	-690, -475, -196, -265, -273, 10, 30, -12, 119, 128, -6, -46, -108, -156, -177, -129, 
-	-85, -51, -160, -151, -74, -62, -40, -17, -57, -154, -117, -141, -176, -24, -69, -506, 
-	-620, -519, -272, 266, 499, 371, 268, -6, -325, -473, -650, -847, -676, -36, 295, 256, 
-	255, 169, 63, 8, -37, 5, 117, 141, 31, -82, -207, -254, -275, -328, -382, -471
-};
-
-static const short ugen_H_30e000a1c[] = { 
-	-7, 5, -3, 4, 0, -3, 2, -27, 33, -58, 58, -82, 81, 654, 6312, 2092, 
-	-10147, -2456, -1372, -2538, 8573, 9340, 4578, 5325, 13775, 5452, -7483, -2712, -5025, -10467, -1680, 1056, 
-	-5969, -3754, 856, 988, -399, 340, 1378, -234, 132, 1818, -376, -1765, -94, 162, -1101, -1369, 
-	-684, -648, -651, 159, 250, -270, 203, 735, 698, 361, 123, 59, -44, -474, -475, -491, 
-	-690, -475, -196, -265, -273, 10, 30, -12, 119, 128, -6, -46, -108, -156, -177, -129, 
-	-85, -51, -160, -151, -74, -62, -40, -17, -57, -154, -117, -141, -176, -24, -69, -506, 
-	-620, -519, -272, 266, 499, 371, 268, -6, -325, -473, -650, -847, -676, -36, 295, 256, 
-	255, 169, 63, 8, -37, 5, 117, 141, 31, -82, -207, -254, -275, -328, -382, -471
-};
-
-static const short ugen_H_30e006a0c[] = { 
-	0, -5, 0, 1, -2, 8, -10, 14, -32, 30, -46, 37, -53, 57, 158, 3964, 
-	4476, -6544, -5127, -1415, -4894, 3900, 9290, 6264, 5356, 10956, 8409, -3240, -3007, -2691, -8649, -4492, 
-	1612, -2766, -3973, -945, -474, -571, -752, 228, 548, -457, 1131, 1364, -321, -126, 190, -392, 
-	-1253, -1038, -702, -1404, -795, 280, -296, 104, 875, 517, 345, 270, -36, 61, -94, -150, 
-	-235, -503, -407, -292, -317, -360, -248, -176, -126, -31, 82, -61, -69, 90, -17, -96, 
-	50, 29, -3, -39, -61, -22, -95, -184, -238, -303, -394, -306, -35, -5, -469, -640, 
-	-506, -298, 292, 679, 548, 369, 153, -126, -408, -662, -953, -1011, -450, 7, 55, 67, 
-	134, 224, 286, 282, 215, 200, 208, 51, -104, -200, -327, -385, -389, -412, -510, -534
-};
-
-static const short ugen_H_30e006a1c[] = { 
-	2, 0, 2, 6, -11, 15, -42, 50, -75, 75, -103, 108, 389, 6357, 4015, -11082, 
-	-4315, -844, -3583, 9048, 10849, 5078, 4983, 14693, 7743, -8578, -3804, -5045, -11723, -2300, 1404, -6008, 
-	-3935, 881, 1424, -158, 196, 1675, -479, -691, 1749, -238, -1750, 245, 216, -1333, -1404, -405, 
-	-698, -1003, 160, 466, -245, 247, 659, 525, 442, 329, 160, -63, -461, -431, -526, -849, 
-	-632, -336, -354, -257, 117, 139, 28, 174, 220, 2, 26, -93, -280, -282, -211, -166, 
-	-110, -172, -158, -77, -78, -5, 42, 19, -32, -8, -100, -205, -83, 24, -393, -675, 
-	-619, -486, 51, 487, 403, 310, 145, -177, -369, -585, -859, -847, -230, 311, 317, 251, 
-	171, 54, 42, 47, 53, 110, 162, 85, -63, -216, -300, -331, -350, -324, -381, -459
-};
-
-static const short ugen_H_30e012a0c[] = { 
-	0, 0, -4, 1, 0, 0, 6, -5, 9, -24, 24, -39, 34, -44, 50, 223, 
-	3743, 3530, -5817, -4054, -1659, -4129, 3740, 7842, 5833, 5523, 9530, 6941, -2262, -2247, -2421, -7192, 
-	-3683, 779, -2705, -3249, -1284, -870, -851, -1096, 153, 577, -220, 1212, 1433, 258, 349, 279, 
-	-396, -1115, -898, -870, -1618, -1064, -153, -403, 92, 645, 333, 308, 335, 176, 347, 214, 
-	60, -99, -388, -422, -377, -408, -425, -352, -289, -265, -197, -13, -18, 53, 134, 37, 
-	22, 88, 55, 40, 46, 1, -46, -120, -226, -318, -415, -488, -331, -44, -156, -576, 
-	-555, -389, -52, 504, 682, 519, 266, 18, -231, -468, -688, -953, -840, -312, 0, 99, 
-	118, 131, 153, 166, 205, 211, 219, 165, 21, -80, -172, -276, -369, -453, -506, -559
-};
-
-static const short ugen_H_30e012a1c[] = { 
-	5, -2, 15, -20, 25, -53, 58, -78, 74, -100, 112, 117, 5725, 6521, -10649, -7466, 
-	-270, -4425, 8310, 12759, 5939, 4552, 15010, 10702, -8722, -5529, -4799, -12936, -3713, 2690, -5574, -4904, 
-	855, 1640, 3, 23, 1954, -744, -2166, 1580, 1034, -1373, -86, 380, -1009, -1433, -318, -607, 
-	-1391, -127, 537, -298, 101, 581, 407, 355, 313, 348, 193, -366, -381, -336, -725, -726, 
-	-481, -492, -498, -15, 213, 90, 210, 311, 27, 26, 1, -263, -365, -310, -268, -222, 
-	-192, -124, -49, -89, 29, 143, 72, -17, 27, -41, -205, -153, 55, -279, -711, -653, 
-	-536, -195, 340, 443, 346, 272, -13, -228, -456, -810, -990, -522, 198, 363, 284, 176, 
-	23, 36, 81, 115, 171, 235, 166, -17, -173, -296, -398, -445, -363, -316, -425, -382
-};
-
-static const short ugen_H_30e018a0c[] = { 
-	-2, 0, 0, -4, 0, 0, 0, 3, -4, 5, -18, 17, -32, 28, -35, 37, 
-	260, 3389, 2833, -4896, -3366, -1817, -3312, 3250, 6619, 5629, 5184, 8043, 6004, -1294, -1539, -2033, 
-	-5741, -3207, 27, -2433, -2949, -1410, -946, -1346, -1587, -63, 561, 167, 1493, 1582, 740, 867, 
-	644, -411, -1283, -1031, -1114, -1774, -1318, -494, -451, -10, 362, 249, 380, 556, 538, 575, 
-	347, 199, -20, -346, -367, -381, -519, -562, -504, -535, -481, -245, 11, 82, 149, 188, 
-	112, 99, 147, 89, 46, 12, -12, -57, -180, -299, -361, -425, -466, -280, -109, -344, 
-	-602, -466, -256, 166, 575, 601, 419, 151, -85, -293, -495, -738, -901, -613, -153, 63, 
-	129, 82, 72, 79, 78, 128, 208, 221, 114, 11, -68, -180, -279, -393, -507, -549
-};
-
-static const short ugen_H_30e018a1c[] = { 
-	-3, 20, -27, 29, -56, 51, -64, 48, -70, 77, -37, 4477, 8846, -8252, -11213, -727, 
-	-4444, 6554, 14122, 7521, 4460, 14484, 14061, -7486, -7698, -5382, -14022, -4470, 4071, -4879, -6057, 100, 
-	1710, 460, -47, 1803, -1266, -3685, 1792, 2960, -1110, -898, 559, 0, -1191, -747, -841, -1484, 
-	-310, 515, -569, -289, 558, 357, 272, 263, 428, 385, -225, -245, -21, -576, -729, -484, 
-	-493, -638, -243, 6, -11, 262, 400, 1, -54, 93, -176, -384, -335, -291, -233, -209, 
-	-176, -26, -66, 24, 135, 111, 6, 82, 25, -221, -258, -2, -93, -650, -745, -588, 
-	-369, 180, 458, 395, 369, 143, -89, -312, -658, -1033, -870, -36, 374, 262, 172, 27, 
-	25, 65, 120, 242, 307, 289, 116, -88, -244, -407, -519, -456, -357, -376, -432, -219
-};
-
-static const short ugen_H_30e024a0c[] = { 
-	0, 0, 0, 0, -2, 0, 0, 0, 2, -2, 5, -14, 13, -22, 23, -23, 
-	28, 246, 2930, 2512, -3934, -3085, -1742, -2701, 2535, 5867, 5320, 4457, 6838, 5511, -392, -950, 
-	-1425, -4630, -3123, -279, -2145, -2770, -1445, -1302, -1941, -1769, 3, 678, 592, 1723, 1804, 1151, 
-	1063, 663, -422, -1291, -1310, -1370, -1776, -1373, -634, -628, -238, 303, 437, 583, 688, 691, 
-	700, 444, 241, -4, -277, -330, -430, -626, -751, -719, -608, -479, -260, 26, 138, 201, 
-	259, 221, 149, 142, 90, 22, -47, -94, -103, -167, -268, -340, -409, -411, -237, -200, 
-	-482, -591, -386, -82, 329, 511, 454, 295, 63, -156, -355, -520, -703, -700, -343, -21, 
-	88, 88, 1, 9, 4, 12, 129, 218, 164, 36, -33, -97, -184, -269, -402, -506
-};
-
-static const short ugen_H_30e024a1c[] = { 
-	22, -24, 25, -41, 26, -25, 0, -4, -3, -25, 2858, 10180, -3916, -14274, -2719, -4153, 
-	4327, 14769, 9041, 5092, 13796, 16907, -4602, -9475, -7751, -14525, -3824, 4366, -3947, -6456, -1408, 979, 
-	1406, 118, 652, -1546, -4161, 1818, 4264, -702, -1311, 801, 821, -788, -1150, -1233, -1554, -404, 
-	314, -751, -566, 314, 217, 325, 310, 341, 447, 6, -46, 177, -417, -678, -357, -379, 
-	-645, -440, -175, -149, 94, 316, 20, -45, 92, -143, -335, -296, -219, -168, -158, -183, 
-	-53, -56, -3, 97, 84, -4, 42, 79, -99, -268, -135, 8, -461, -820, -655, -463, 
-	0, 444, 427, 451, 360, 64, -208, -547, -952, -1101, -406, 344, 290, 120, -6, 15, 
-	110, 91, 272, 416, 396, 259, 29, -133, -322, -539, -553, -464, -372, -402, -307, -114
-};
-
-static const short ugen_H_30e030a0c[] = { 
-	0, 0, 0, 0, 0, -2, 0, 0, 0, 2, 0, 3, -9, 11, -17, 21, 
-	-16, 19, 207, 2458, 2347, -3096, -2892, -1546, -2303, 2013, 5255, 4642, 3833, 5893, 5049, 420, 
-	-299, -887, -3874, -2950, -447, -1846, -2649, -1932, -1819, -1903, -1399, 66, 804, 941, 1909, 1887, 
-	1124, 945, 512, -369, -1113, -1345, -1556, -1817, -1374, -769, -662, -212, 373, 576, 703, 716, 
-	637, 668, 481, 244, -11, -250, -398, -548, -699, -774, -716, -620, -460, -248, 24, 129, 
-	177, 278, 251, 197, 128, 30, -20, -78, -65, -77, -177, -276, -326, -369, -375, -238, 
-	-316, -537, -487, -267, 43, 328, 388, 321, 171, -21, -223, -365, -479, -576, -431, -139, 
-	3, 38, 1, -75, -73, -28, 21, 93, 137, 55, -10, -29, -100, -179, -261, -375
-};
-
-static const short ugen_H_30e030a1c[] = { 
-	-4, 2, -13, -17, 26, -67, 73, -113, 93, 1214, 9830, 2034, -15365, -6428, -3525, 1357, 
-	14425, 10759, 5616, 12963, 19869, -418, -11476, -9312, -14730, -4431, 4880, -2674, -6987, -2809, -179, 1879, 
-	299, -962, -1140, -3108, 994, 4182, 408, -1032, 714, 1179, -337, -1081, -1596, -1992, -552, 273, 
-	-979, -829, 224, 62, 192, 275, 301, 526, 340, -39, 190, -70, -469, -402, -333, -569, 
-	-581, -265, -280, -113, 170, -39, -85, 118, -66, -276, -292, -182, -77, -80, -217, -68, 
-	0, -31, 26, 30, -13, -3, 48, -66, -231, -224, 21, -163, -745, -800, -547, -186, 
-	363, 451, 392, 465, 290, -32, -397, -825, -1200, -852, 140, 382, 100, -72, -91, 93, 
-	107, 259, 485, 505, 399, 156, -43, -185, -473, -603, -562, -483, -416, -349, -155, -79
-};
-
-static const short ugen_H_30e036a0c[] = { 
-	0, -1, -1, -1, 0, -1, -3, -1, -1, -2, 0, -3, 0, -11, 6, -15, 
-	18, -17, 11, 151, 2053, 2292, -2453, -2781, -1379, -1973, 1689, 4543, 3969, 3405, 5017, 4698, 
-	1169, 264, -532, -3329, -2713, -555, -1757, -2700, -2335, -1958, -1511, -983, 209, 1050, 1171, 1590, 
-	1529, 1092, 906, 419, -350, -1006, -1274, -1559, -1853, -1372, -661, -423, -40, 329, 475, 615, 
-	603, 507, 581, 457, 158, -81, -303, -406, -519, -639, -707, -687, -563, -482, -284, -32, 
-	52, 140, 231, 249, 154, 103, 54, -7, -22, -65, -113, -212, -292, -344, -383, -346, 
-	-301, -395, -462, -366, -189, 84, 282, 270, 188, 47, -119, -261, -331, -385, -411, -253, 
-	-97, -48, -32, -86, -147, -127, -75, -35, 50, 75, 8, -7, -43, -116, -170, -257
-};
-
-static const short ugen_H_30e036a1c[] = { 
-	-16, 20, -60, 69, -106, 106, -152, 167, 119, 7475, 7986, -12698, -11637, -3226, -1308, 12134, 
-	12460, 6396, 11658, 22276, 5165, -12806, -9258, -14847, -6858, 5181, -1149, -7244, -4145, -1000, 1042, 535, 
-	-1887, -978, -1378, 391, 3302, 1202, -243, 676, 1283, -189, -1012, -1365, -2348, -1289, 263, -728, 
-	-1240, 78, 77, 127, 153, 158, 590, 616, 118, 108, 152, -250, -328, -321, -563, -702, 
-	-427, -368, -242, 145, -51, -224, 97, 59, -125, -227, -245, -98, -13, -200, -151, 6, 
-	-11, 11, 6, -12, 6, 15, -99, -187, -238, -102, 27, -435, -822, -621, -366, 141, 
-	476, 377, 422, 408, 137, -213, -601, -1052, -1166, -329, 415, 190, -99, -197, -53, 81, 
-	231, 556, 614, 502, 315, 53, -51, -322, -611, -592, -592, -495, -364, -194, -97, -54
-};
-
-static const short ugen_H_30e042a0c[] = { 
-	0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 2, -4, 3, -9, 9, 
-	-8, 15, -11, 13, 96, 1717, 2215, -1939, -2619, -1200, -1574, 1383, 3749, 3451, 3031, 4231, 
-	4445, 1819, 632, -260, -2755, -2672, -731, -1542, -2667, -2468, -1696, -1045, -623, 480, 1032, 773, 
-	1163, 1475, 1110, 789, 372, -301, -938, -1207, -1455, -1600, -1079, -430, -312, -123, 190, 309, 
-	408, 483, 464, 450, 280, 78, -54, -218, -346, -457, -553, -629, -617, -573, -477, -267, 
-	-55, 29, 103, 174, 180, 166, 121, 60, 55, 17, -88, -165, -237, -289, -323, -363, 
-	-331, -319, -385, -336, -241, -87, 117, 198, 156, 76, -30, -181, -255, -239, -264, -270, 
-	-183, -123, -77, -62, -128, -197, -177, -99, -20, 60, 66, 24, 4, -43, -87, -154
-};
-
-static const short ugen_H_30e042a1c[] = { 
-	22, -60, 58, -72, 49, -67, 72, -133, 3993, 11386, -5700, -16335, -5000, -2374, 8133, 13397, 
-	7307, 10291, 22766, 11819, -11375, -9884, -13794, -9573, 4242, 201, -7151, -4956, -1633, -759, 100, -1250, 
-	-888, -941, 394, 3114, 1548, 213, 789, 1421, -120, -1353, -1056, -2179, -1939, -311, -410, -1278, 
-	-134, 49, 60, 279, 115, 398, 645, 481, 162, 133, -189, -241, -204, -527, -892, -586, 
-	-410, -410, 44, 71, -197, 61, 102, -77, -98, -174, -201, -105, -143, -175, -116, -105, 
-	19, 73, 24, -22, 37, -81, -172, -195, -185, 19, -125, -692, -729, -482, -136, 408, 
-	422, 340, 420, 239, -64, -402, -837, -1158, -763, 179, 310, -77, -260, -218, -21, 120, 
-	502, 745, 619, 451, 195, 8, -146, -511, -643, -628, -593, -418, -233, -119, -81, -15
-};
-
-static const short ugen_H_30e048a0c[] = { 
-	2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, -2, 7, -6, 
-	11, -5, 13, -6, 10, 64, 1445, 2079, -1512, -2435, -1027, -1171, 1032, 3019, 3085, 2700, 
-	3566, 4158, 2342, 1067, -290, -2635, -2504, -611, -1193, -2540, -2388, -1265, -474, -383, 181, 687, 
-	621, 978, 1370, 1112, 671, 220, -405, -881, -895, -1038, -1181, -864, -456, -402, -255, -3, 
-	153, 312, 327, 278, 297, 185, 67, 0, -161, -286, -386, -486, -554, -556, -528, -420, 
-	-229, -64, -9, 19, 77, 132, 155, 136, 56, 19, -1, -65, -140, -233, -268, -317, 
-	-352, -334, -330, -303, -217, -124, 13, 95, 65, 40, 7, -110, -228, -216, -160, -190, 
-	-226, -201, -130, -61, -97, -193, -235, -158, -69, -4, 68, 64, 28, -1, -40, -88
-};
-
-static const short ugen_H_30e048a1c[] = { 
-	-5, -23, 36, -82, 94, -140, 132, 802, 10292, 4573, -16784, -10502, -2380, 3576, 12614, 8695, 
-	8525, 20146, 19658, -5357, -11978, -11694, -11913, 1654, 1953, -6416, -6260, -2795, -2076, -408, -505, -979, 
-	-722, -83, 2856, 2734, 842, 452, 1100, 636, -1400, -1415, -2086, -2160, -845, -551, -1251, -285, 
-	244, -66, 323, 263, 409, 562, 626, 267, 156, -37, -366, -355, -330, -751, -842, -575, 
-	-508, -62, 168, -131, 17, 204, 28, -54, -116, -213, -159, -135, -265, -178, -132, -82, 
-	-31, 62, 74, 84, 8, -147, -130, -129, -56, 56, -417, -831, -599, -360, 198, 492, 
-	305, 342, 337, 94, -232, -652, -1034, -962, -170, 362, -10, -328, -311, -111, 43, 281, 
-	733, 782, 595, 387, 87, -73, -324, -582, -636, -646, -508, -278, -120, -100, -38, 0
-};
-
-static const short ugen_H_30e054a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 0, 3, 
-	-5, 8, -9, 14, -7, 8, 63, 1233, 1817, -1168, -2150, -880, -812, 690, 2413, 2779, 
-	2362, 3098, 4113, 2587, 734, -539, -2126, -1890, -355, -1007, -2334, -1889, -749, -508, -586, -29, 
-	519, 596, 892, 1196, 922, 381, -135, -284, -260, -429, -830, -1024, -834, -571, -483, -376, 
-	-156, 54, 155, 138, 104, 155, 134, 92, 37, -114, -230, -305, -381, -470, -481, -448, 
-	-357, -229, -138, -103, -46, 30, 69, 101, 81, 18, 36, 33, -24, -103, -206, -287, 
-	-361, -351, -315, -263, -189, -124, -46, 7, 2, -28, -41, -92, -186, -203, -141, -130, 
-	-206, -239, -189, -116, -95, -161, -197, -175, -129, -66, 17, 60, 33, 13, -14, -60
-};
-
-static const short ugen_H_30e054a1c[] = { 
-	-52, 68, -97, 77, -102, 113, -186, 4839, 12131, -8100, -17909, -4398, 429, 9454, 10296, 7195, 
-	15001, 24265, 6201, -12693, -10786, -12586, -2422, 3594, -4198, -7921, -4890, -2850, -1321, 468, -1084, -1153, 
-	-570, 2192, 3865, 1709, 468, 907, 1258, -940, -1829, -2090, -2636, -1527, -496, -1168, -901, 487, 
-	96, 202, 490, 592, 532, 573, 504, 191, 10, -352, -534, -505, -569, -851, -680, -587, 
-	-311, 183, 13, -48, 218, 150, 2, -25, -154, -210, -141, -282, -300, -212, -120, -101, 
-	-90, 37, 139, 189, 13, -112, -97, -62, 86, -63, -743, -792, -521, -164, 423, 386, 
-	244, 298, 224, 9, -404, -882, -1018, -536, 222, 182, -367, -468, -253, 4, 128, 532, 
-	847, 724, 549, 269, 15, -211, -493, -609, -623, -567, -383, -151, -91, -68, 3, 7
-};
-
-static const short ugen_H_30e060a0c[] = { 
-	0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 3, 3, 0, 
-	1, -1, 6, -2, 8, -1, 5, 98, 1081, 1432, -882, -1746, -762, -576, 431, 1893, 
-	2528, 2495, 2798, 3251, 2263, 656, -365, -1250, -1240, -298, -658, -1797, -1695, -813, -553, -636, 
-	-118, 463, 476, 685, 867, 438, 174, 255, 277, 44, -358, -787, -959, -832, -624, -520, 
-	-468, -272, -86, -73, -45, 7, 107, 130, 130, 88, -56, -124, -227, -311, -385, -394, 
-	-368, -368, -291, -225, -160, -82, -36, 27, 36, 60, 84, 89, 59, -22, -98, -224, 
-	-316, -354, -313, -223, -164, -104, -101, -76, -46, -62, -72, -112, -151, -191, -147, -94, 
-	-152, -246, -279, -176, -82, -99, -142, -162, -144, -100, -38, 16, 18, 9, -3, -35
-};
-
-static const short ugen_H_30e060a1c[] = { 
-	-43, 72, -124, 146, -205, 228, 340, 10267, 6791, -18414, -12406, -504, 4336, 11108, 7263, 9533, 
-	22678, 19133, -7374, -12545, -11159, -6700, 3718, -865, -8040, -7879, -3613, -2590, 136, 28, -1661, -964, 
-	925, 3650, 3019, 1374, 373, 1609, 574, -1979, -2490, -2864, -2251, -976, -673, -1347, -138, 433, 
-	287, 581, 682, 759, 600, 585, 238, 194, -193, -662, -664, -579, -796, -887, -562, -454, 
-	8, 126, -114, 103, 265, 147, 18, -9, -130, -124, -215, -399, -326, -247, -165, -169, 
-	-69, 81, 210, 212, 50, -21, -39, 10, 173, -279, -871, -705, -497, 65, 447, 244, 
-	235, 214, 156, -72, -593, -949, -761, -127, 312, -127, -628, -518, -131, 67, 287, 756, 
-	829, 680, 476, 203, -74, -401, -577, -591, -570, -437, -248, -96, -79, -12, 43, 35
-};
-
-static const short ugen_H_30e066a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 2, 
-	0, 0, 3, 3, -4, 5, 6, -2, 185, 934, 952, -624, -1244, -719, -512, 341, 
-	1815, 2523, 2014, 1885, 2564, 2327, 976, -88, -523, -424, 24, -701, -1749, -1500, -835, -642, 
-	-612, -181, 180, 199, 272, 502, 682, 639, 501, 344, 86, -379, -820, -900, -761, -614, 
-	-601, -592, -443, -288, -200, -121, -1, 136, 173, 172, 130, 5, -100, -166, -229, -313, 
-	-354, -409, -413, -340, -256, -184, -141, -48, 21, 62, 96, 92, 101, 60, -41, -172, 
-	-254, -280, -284, -213, -148, -128, -131, -131, -97, -78, -89, -117, -150, -180, -171, -115, 
-	-139, -237, -282, -236, -119, -47, -76, -123, -143, -128, -94, -34, 5, -7, -18, -36
-};
-
-static const short ugen_H_30e066a1c[] = { 
-	7, -7, -31, 47, -87, 30, 2376, 13632, -2601, -22110, -5476, 1693, 7154, 9865, 5724, 15480, 
-	25979, 7390, -13414, -11192, -8669, 483, 2988, -5176, -10034, -6608, -2589, -2033, 311, -790, -1217, -334, 
-	2311, 3512, 2373, 958, 1005, 2040, -763, -2414, -2992, -3132, -1865, -573, -1213, -1191, 338, 442, 
-	430, 707, 1071, 909, 743, 399, 23, 119, -346, -806, -815, -800, -993, -766, -528, -269, 
-	178, -20, -102, 192, 304, 143, 58, 23, -33, -119, -384, -465, -375, -281, -249, -189, 
-	-23, 162, 280, 198, 71, 37, 3, 96, 188, -485, -874, -654, -435, 197, 292, 158, 
-	213, 153, 160, -206, -770, -845, -401, 156, 187, -487, -769, -430, -63, 67, 470, 833, 
-	782, 652, 392, 162, -185, -535, -591, -557, -486, -314, -148, -85, -59, 37, 57, 44
-};
-
-static const short ugen_H_30e072a0c[] = { 
-	0, 1, 1, 1, 1, 2, 2, 2, 3, 2, 4, 4, 3, 4, 2, 4, 
-	2, 7, 0, 9, 1, 0, 11, 11, 9, 277, 783, 490, -378, -782, -780, -203, 
-	772, 1311, 1543, 1638, 1779, 2349, 2461, 1239, 242, 509, 363, -546, -1188, -1373, -1271, -973, 
-	-723, -643, -470, -293, -18, 485, 906, 945, 694, 455, 285, 8, -496, -789, -724, -684, 
-	-757, -793, -683, -521, -365, -238, -88, 101, 164, 183, 193, 137, 39, -50, -123, -233, 
-	-307, -390, -453, -407, -320, -247, -195, -113, -32, 26, 81, 108, 122, 87, 5, -110, 
-	-200, -220, -218, -182, -159, -168, -143, -122, -110, -112, -124, -121, -133, -177, -222, -205, 
-	-152, -165, -218, -234, -168, -57, -21, -67, -136, -153, -116, -62, -14, -27, -51, -53
-};
-
-static const short ugen_H_30e072a1c[] = { 
-	59, -98, 89, -101, 107, -203, 5147, 13995, -11410, -20952, -115, 2878, 8161, 7692, 7359, 21340, 
-	22757, -2334, -14837, -9373, -3625, 3696, 126, -7937, -10453, -4858, -2619, -2115, 547, -1030, -1069, 811, 
-	2853, 2887, 2165, 474, 1620, 1892, -1411, -2767, -3111, -2761, -1796, -852, -1358, -767, 381, 408, 
-	389, 974, 1389, 1026, 845, 232, -75, 58, -485, -904, -881, -1000, -1139, -709, -446, -114, 
-	124, -118, -9, 316, 353, 140, 133, 68, -7, -169, -469, -529, -393, -303, -320, -183, 
-	34, 229, 314, 197, 100, 97, 36, 182, 151, -602, -823, -638, -360, 198, 128, 134, 
-	175, 158, 180, -355, -839, -661, -111, 341, 23, -765, -825, -348, -54, 104, 596, 820, 
-	745, 604, 360, 147, -280, -580, -546, -522, -395, -194, -89, -87, -15, 32, 25, 53
-};
-
-static const short ugen_H_30e078a0c[] = { 
-	0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 0, 1, 0, 0, 0, 0, 
-	2, 1, 0, 1, 7, -1, 5, 3, 7, 32, 376, 565, 89, -132, -337, -276, 
-	-111, -91, 657, 1436, 1916, 2001, 2165, 2504, 1909, 918, 478, -53, -947, -1248, -1093, -1146, 
-	-1210, -968, -856, -811, -223, 581, 970, 948, 837, 617, 321, 100, -174, -495, -673, -732, 
-	-832, -922, -841, -678, -497, -335, -172, -1, 128, 165, 169, 186, 142, 69, -55, -200, 
-	-316, -376, -386, -382, -359, -312, -231, -155, -109, -42, 20, 95, 152, 113, 14, -75, 
-	-125, -185, -210, -179, -150, -152, -165, -131, -113, -135, -156, -170, -170, -206, -261, -276, 
-	-198, -105, -130, -178, -157, -82, -43, -74, -125, -141, -110, -85, -66, -67, -83, -69
-};
-
-static const short ugen_H_30e078a1c[] = { 
-	90, -161, 177, -221, 260, -326, 7335, 12835, -17024, -18451, 3112, 3402, 7343, 6676, 10570, 23733, 
-	18065, -7868, -14816, -6579, 644, 4072, -2405, -9339, -9743, -3867, -3343, -2107, 570, -1015, -842, 1471, 
-	3091, 2584, 1673, 210, 2098, 1432, -1675, -2670, -2949, -2519, -1706, -1278, -1450, -436, 326, 238, 
-	422, 1215, 1442, 1097, 965, 271, -120, -60, -595, -956, -903, -1137, -1250, -758, -382, -27, 
-	25, -143, 70, 452, 417, 193, 173, 52, -61, -239, -448, -550, -419, -338, -358, -170, 
-	87, 250, 266, 204, 193, 151, 66, 245, 82, -686, -777, -649, -297, 141, -6, 151, 
-	160, 216, 141, -523, -831, -453, 101, 373, -163, -897, -772, -322, -108, 178, 670, 798, 
-	687, 532, 361, 129, -333, -571, -520, -478, -306, -96, -73, -108, 7, 13, 0, 35
-};
-
-static const short ugen_H_30e084a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 0, 0, 0, 0, 0, 
-	2, 0, -1, 5, 1, 9, 3, -5, 3, 12, 90, 380, 312, 34, 521, 8, 
-	-1048, -747, -67, 994, 1856, 2124, 2219, 2601, 2882, 1671, 213, -66, -164, -884, -1286, -1114, 
-	-1179, -1405, -1338, -878, -263, 443, 1008, 1025, 826, 642, 402, 130, -75, -282, -555, -765, 
-	-889, -887, -873, -793, -597, -388, -206, -77, 33, 92, 147, 217, 214, 118, -33, -176, 
-	-293, -357, -353, -328, -310, -316, -293, -225, -140, -60, -8, 49, 118, 154, 91, -29, 
-	-115, -161, -183, -182, -170, -152, -135, -117, -132, -159, -185, -213, -238, -252, -280, -290, 
-	-207, -94, -50, -63, -90, -100, -99, -109, -131, -122, -98, -97, -108, -110, -96, -72
-};
-
-static const short ugen_H_30e084a1c[] = { 
-	109, -197, 236, -296, 362, -402, 8491, 11886, -19820, -16697, 5069, 3615, 5904, 6684, 13156, 23777, 
-	14434, -10959, -14083, -3475, 3410, 3733, -4414, -10032, -8758, -3622, -3950, -1904, 339, -1332, -567, 1967, 
-	3071, 2578, 1373, -20, 2348, 1291, -1977, -2739, -2342, -2134, -1761, -1444, -1574, -508, 268, 157, 
-	361, 1236, 1417, 1111, 1036, 388, 10, -142, -682, -930, -913, -1216, -1320, -798, -378, 5, 
-	-11, -193, 101, 524, 474, 255, 174, -2, -131, -254, -421, -515, -416, -339, -341, -177, 
-	68, 231, 272, 215, 213, 177, 101, 292, 59, -738, -799, -676, -274, 73, -91, 122, 
-	155, 282, 137, -569, -766, -304, 191, 332, -306, -956, -710, -338, -168, 169, 641, 774, 
-	643, 510, 366, 121, -291, -512, -521, -425, -229, -76, -101, -149, -27, -39, -28, 25
-};
-
-static const short ugen_H_30e090a0c[] = { 
-	0, 0, 0, 0, 0, 0, 1, 2, 2, 1, 2, 1, 0, 0, 0, 0, 
-	2, 0, 1, 4, 2, 6, 8, 1, -9, 14, 2, 131, 406, 677, 451, -426, 
-	-975, -945, -144, 724, 1437, 2193, 2670, 3084, 2482, 1372, 635, -42, -313, -332, -807, -1340, 
-	-1284, -1295, -1536, -1157, -110, 592, 805, 1055, 997, 578, 289, 143, -41, -297, -558, -733, 
-	-842, -895, -834, -726, -620, -399, -226, -134, -31, 58, 142, 160, 180, 121, -5, -151, 
-	-298, -342, -330, -285, -284, -307, -303, -245, -133, -72, -14, 51, 100, 127, 112, 40, 
-	-60, -127, -185, -233, -215, -137, -101, -126, -154, -197, -232, -255, -262, -286, -307, -264, 
-	-179, -75, 14, 40, -13, -96, -151, -173, -145, -122, -120, -113, -125, -117, -85, -66
-};
-
-static const short ugen_H_30e090a1c[] = { 
-	118, -213, 252, -312, 384, -477, 8162, 12297, -19793, -16990, 5943, 3693, 4461, 6798, 14321, 23016, 
-	12644, -11946, -13087, -1199, 4794, 3725, -5658, -10316, -8039, -3846, -4294, -1888, 102, -1712, -765, 2191, 
-	3372, 2423, 1432, 109, 2210, 1368, -2065, -2879, -2132, -1648, -1448, -1617, -1720, -548, -9, -51, 
-	433, 1163, 1283, 1056, 1053, 512, 134, -30, -661, -957, -878, -1178, -1395, -853, -356, -4, 
-	-53, -262, 98, 547, 504, 307, 168, -32, -161, -273, -402, -460, -360, -321, -353, -182, 
-	76, 227, 243, 205, 204, 188, 128, 279, 51, -729, -767, -675, -306, 0, -166, 108, 
-	182, 353, 140, -564, -673, -211, 206, 247, -392, -957, -653, -342, -191, 124, 565, 752, 
-	634, 541, 376, 111, -195, -438, -522, -395, -180, -67, -127, -193, -98, -99, -43, 43
-};
-
-static const short ugen_H_30e096a0c[] = { 
-	0, 0, 0, 0, 0, 1, 1, 3, 3, 3, 2, 1, 2, 0, 0, 2, 
-	1, 0, 5, 0, 5, 5, 10, 7, 5, -15, 6, 37, 690, 1105, -285, -1111, 
-	-754, -295, 249, 816, 1302, 1990, 3231, 2904, 1718, 1059, 344, 57, -151, -516, -645, -772, 
-	-1281, -1424, -1261, -1031, -245, 676, 1034, 959, 882, 621, 242, 18, -167, -378, -564, -765, 
-	-830, -797, -787, -647, -487, -396, -259, -106, -25, 34, 88, 91, 135, 114, -45, -199, 
-	-266, -290, -341, -343, -305, -264, -217, -185, -136, -43, 44, 72, 77, 77, 84, 85, 
-	2, -108, -207, -273, -260, -165, -86, -123, -188, -236, -258, -265, -279, -279, -277, -232, 
-	-159, -49, 71, 97, 22, -96, -179, -196, -168, -147, -149, -129, -106, -73, -56, -78
-};
-
-static const short ugen_H_30e096a1c[] = { 
-	104, -183, 199, -228, 270, -422, 6166, 13974, -16416, -19659, 5483, 4004, 3256, 6359, 13851, 22269, 
-	12925, -10931, -12669, 91, 5316, 4131, -5638, -10554, -8061, -4157, -4354, -2415, 45, -1990, -1302, 2014, 
-	3615, 2613, 1709, 237, 2103, 1741, -2033, -3005, -2064, -1582, -1218, -1277, -1822, -885, -190, -249, 
-	251, 1131, 1240, 874, 971, 672, 242, 84, -495, -883, -839, -1084, -1372, -928, -448, -74, 
-	-63, -313, 43, 521, 508, 297, 189, -23, -169, -273, -374, -400, -350, -299, -309, -145, 
-	99, 199, 178, 133, 176, 167, 72, 244, 126, -622, -728, -656, -391, -85, -204, 95, 
-	216, 386, 165, -543, -616, -187, 161, 184, -399, -938, -647, -347, -194, 88, 480, 697, 
-	627, 590, 410, 103, -108, -365, -517, -385, -185, -82, -158, -243, -164, -138, -72, 49
-};
-
-static const short ugen_H_30e102a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 
-	0, 1, 0, 3, 0, 7, 0, 12, 4, -3, -20, 395, 1157, 163, -1083, -961, 
-	-501, 321, 945, 1083, 1518, 2646, 2673, 1825, 1162, 629, 338, -220, -361, -477, -772, -767, 
-	-608, -800, -1310, -885, -18, 595, 1106, 1128, 692, 441, 346, -93, -452, -527, -631, -775, 
-	-849, -745, -659, -612, -442, -240, -124, -89, -53, 11, 82, 96, 32, -52, -93, -173, 
-	-300, -392, -395, -351, -310, -237, -163, -73, -11, 21, 63, 72, 60, 45, 52, 54, 
-	7, -103, -252, -313, -278, -212, -157, -142, -208, -297, -302, -257, -225, -228, -236, -195, 
-	-106, -9, 54, 62, -8, -129, -196, -201, -199, -200, -164, -122, -78, -37, -46, -88
-};
-
-static const short ugen_H_30e102a1c[] = { 
-	48, -75, 40, -19, -10, -65, 3134, 14949, -9111, -23271, 2718, 5065, 2019, 5577, 11875, 21384, 
-	14898, -8295, -12776, 483, 5607, 4548, -4382, -10593, -8739, -4616, -4100, -3561, -156, -1595, -2090, 1282, 
-	3870, 2898, 2055, 639, 1804, 2349, -1512, -3100, -2229, -1594, -1303, -1139, -1589, -1079, -526, -409, 
-	93, 868, 1219, 857, 814, 739, 332, 224, -247, -742, -710, -926, -1321, -1044, -577, -218, 
-	-73, -301, -32, 460, 485, 265, 177, 29, -112, -248, -370, -381, -281, -209, -262, -142, 
-	95, 189, 110, 37, 42, 97, 60, 246, 265, -493, -713, -624, -421, -114, -258, 48, 
-	259, 408, 178, -542, -607, -191, 118, 142, -344, -894, -658, -318, -188, 44, 417, 648, 
-	605, 615, 457, 114, -55, -287, -486, -385, -231, -135, -193, -259, -204, -149, -96, 34
-};
-
-static const short ugen_H_30e108a0c[] = { 
-	0, 0, 0, 1, 0, 2, 0, 0, 2, 3, 1, 1, 0, 0, 2, 0, 
-	1, 0, 0, 0, 5, 0, 4, 9, 4, 4, 229, 1278, 473, -1425, -1123, -450, 
-	273, 966, 1190, 1582, 2631, 2990, 1572, 347, 368, 422, 5, -142, -741, -1004, -676, -589, 
-	-295, -146, -466, -776, -100, 848, 1122, 950, 694, 442, 120, -206, -613, -776, -722, -756, 
-	-801, -805, -601, -403, -316, -176, -27, 39, 35, 59, 7, -30, -31, -89, -186, -324, 
-	-390, -413, -420, -382, -301, -146, -43, 27, 100, 116, 106, 62, 23, -12, 27, 58, 
-	-20, -136, -285, -348, -325, -245, -178, -214, -285, -316, -246, -178, -154, -156, -163, -111, 
-	-58, -20, -18, -30, -69, -161, -190, -209, -212, -181, -141, -90, -59, -12, -24, -77
-};
-
-static const short ugen_H_30e108a1c[] = { 
-	-49, 81, -171, 225, -326, 391, 346, 12727, 1902, -24342, -4394, 6940, 862, 4536, 9114, 18919, 
-	18290, -3341, -13088, -609, 6067, 4907, -2321, -9817, -9686, -5839, -3698, -4537, -1371, -704, -2438, 0, 
-	3699, 3429, 2330, 1277, 1508, 2957, -507, -2943, -2333, -1838, -1576, -1241, -1575, -1212, -569, -660, 
-	-228, 656, 1157, 845, 744, 834, 379, 297, 141, -548, -669, -723, -1178, -1205, -758, -390, 
-	-135, -247, -123, 342, 441, 244, 175, 64, -93, -189, -266, -309, -279, -129, -188, -179, 
-	8, 129, 42, -62, -57, 22, 61, 200, 372, -263, -670, -600, -469, -127, -235, -28, 
-	255, 374, 176, -526, -613, -223, 31, 100, -239, -773, -670, -305, -174, -14, 354, 608, 
-	555, 602, 502, 137, -22, -201, -451, -406, -299, -200, -214, -270, -221, -159, -107, 8
-};
-
-static const short ugen_H_30e114a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-	1, -3, -1, 0, 4, -10, 16, -8, 26, 107, 1309, 1098, -1590, -1776, -641, 325, 
-	1222, 1376, 1533, 2597, 3680, 2064, 127, -175, -432, -420, -80, -545, -1028, -1103, -994, -184, 
-	191, 89, 224, 117, 86, 597, 1007, 874, 609, 428, -20, -542, -723, -808, -915, -876, 
-	-751, -625, -501, -363, -163, -36, 54, 194, 138, -22, -27, -32, -168, -292, -319, -354, 
-	-450, -502, -452, -329, -186, -69, 30, 135, 187, 156, 98, 23, 2, 3, -10, -2, 
-	-51, -181, -332, -392, -372, -311, -240, -262, -311, -281, -165, -68, -57, -75, -88, -59, 
-	-61, -121, -141, -131, -145, -197, -230, -200, -153, -121, -107, -70, -26, -5, -20, -51
-};
-
-static const short ugen_H_30e114a1c[] = { 
-	-91, 129, -202, 211, -266, 324, -467, 6732, 11390, -16985, -15189, 6701, 1470, 2274, 7360, 14053, 
-	20407, 4657, -11995, -3481, 6343, 5550, -277, -7862, -10036, -7714, -4179, -4409, -3390, -534, -1929, -1325, 
-	2806, 3950, 2590, 2036, 1380, 3211, 1256, -2651, -2430, -1752, -1962, -1710, -1643, -1552, -777, -631, 
-	-515, 166, 1096, 1042, 624, 867, 690, 323, 362, -183, -607, -630, -1006, -1240, -957, -609, 
-	-266, -209, -227, 186, 417, 263, 106, 92, -13, -84, -132, -187, -265, -166, -126, -230, 
-	-159, 4, 29, -81, -122, -55, 37, 142, 422, -16, -586, -563, -487, -166, -189, -103, 
-	200, 333, 182, -482, -662, -269, -54, 19, -124, -613, -655, -293, -155, -73, 261, 554, 
-	495, 541, 532, 195, -2, -132, -415, -439, -361, -268, -225, -304, -247, -154, -83, -16
-};
-
-static const short ugen_H_30e120a0c[] = { 
-	0, 0, 0, 0, 2, 0, 0, 1, 0, 1, 1, 0, 2, 2, 0, 3, 
-	-1, 3, -8, 13, -15, 17, -18, 35, 28, 1190, 1834, -1437, -2547, -918, 139, 1342, 
-	1706, 1735, 2714, 4179, 2676, 131, -382, -589, -836, -946, -1035, -1056, -1121, -1127, -590, -68, 
-	306, 678, 700, 818, 813, 473, 353, 727, 797, 126, -328, -513, -874, -1085, -969, -772, 
-	-629, -487, -397, -234, 23, 170, 120, 55, 167, 170, -73, -309, -340, -303, -396, -491, 
-	-486, -427, -347, -259, -139, 5, 155, 198, 127, 99, 114, 82, 20, -9, -24, -69, 
-	-142, -233, -349, -441, -403, -312, -307, -314, -259, -146, -45, 6, 13, 11, 18, -42, 
-	-159, -250, -256, -222, -207, -228, -241, -163, -66, -22, -23, -25, 0, 19, 9, -17
-};
-
-static const short ugen_H_30e120a1c[] = { 
-	-9, -11, 21, -85, 124, -194, 202, 1075, 12284, -1481, -21536, -907, 5039, -971, 5939, 10073, 
-	17360, 13457, -6603, -7202, 5178, 6870, 1478, -5529, -9082, -8893, -6242, -4192, -4489, -1805, -1030, -2231, 
-	1045, 4303, 3097, 2470, 1847, 2636, 3184, -1021, -2874, -1850, -1813, -2143, -2019, -2007, -1256, -775, 
-	-601, -188, 632, 1286, 875, 760, 953, 614, 440, 169, -453, -598, -819, -1208, -1096, -790, 
-	-518, -273, -284, 19, 345, 302, 130, 141, 144, 20, -45, -104, -166, -228, -213, -296, 
-	-250, -60, 2, -91, -137, -100, 22, 91, 380, 216, -484, -526, -445, -208, -144, -178, 
-	115, 337, 259, -415, -742, -338, -79, -67, -79, -425, -607, -293, -112, -96, 140, 473, 
-	451, 464, 538, 279, 57, -73, -360, -478, -396, -323, -224, -306, -301, -153, -44, -1
-};
-
-static const short ugen_H_30e126a0c[] = { 
-	0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 4, 0, 6, -3, 
-	8, -10, 12, -9, 11, -12, 16, -1, 921, 2509, -854, -3449, -1338, 92, 1321, 1861, 
-	1931, 2889, 4810, 3667, 96, -908, -695, -843, -1167, -1399, -1843, -1777, -1206, -704, -104, 120, 
-	379, 892, 1367, 1430, 1028, 474, 238, 387, 411, 58, -555, -864, -869, -936, -941, -808, 
-	-545, -299, -66, 71, -13, 25, 232, 273, 76, -108, -196, -279, -400, -507, -533, -482, 
-	-377, -299, -247, -164, -42, 47, 73, 94, 132, 130, 100, 80, 48, -8, -95, -179, 
-	-255, -324, -366, -373, -331, -353, -403, -331, -158, 4, 56, 36, 38, 83, 62, -95, 
-	-283, -377, -365, -298, -254, -272, -228, -91, 6, 60, 65, 52, 50, 25, 11, -24
-};
-
-static const short ugen_H_30e126a1c[] = { 
-	52, -92, 108, -145, 153, -189, 230, -346, 5244, 10728, -12980, -14469, 5436, 47, 860, 9124, 
-	12011, 16285, 4177, -8441, 1259, 8179, 3810, -3283, -7846, -8275, -7868, -5861, -4739, -3592, -897, -1623, 
-	-1360, 3013, 4212, 2842, 2649, 2115, 3490, 1770, -1987, -2252, -1847, -2371, -2289, -2295, -2043, -1222, 
-	-944, -337, 274, 1051, 1216, 907, 1052, 990, 594, 415, -138, -588, -650, -1048, -1229, -952, 
-	-762, -524, -349, -229, 230, 447, 295, 136, 210, 196, 52, -96, -202, -277, -242, -247, 
-	-326, -209, -39, -58, -109, -105, -40, 39, 239, 388, -277, -582, -423, -255, -61, -139, 
-	-14, 238, 375, -206, -791, -465, -87, -165, -134, -245, -541, -370, -114, -64, 56, 369, 
-	392, 335, 534, 389, 135, -7, -281, -517, -446, -343, -266, -284, -366, -204, -26, 20
-};
-
-static const short ugen_H_30e132a0c[] = { 
-	0, 1, 1, 1, 0, 1, 0, 0, 1, 0, 0, 5, 0, 6, -1, 7, 
-	-4, 5, 0, -1, 13, -7, 11, 596, 2981, 153, -4369, -2124, 148, 1381, 2105, 2011, 
-	2927, 5413, 4919, 405, -1425, -1093, -1056, -1252, -1507, -2129, -2263, -1830, -1293, -101, 222, 293, 
-	777, 1162, 1611, 1639, 989, 500, 588, 188, -515, -619, -484, -639, -878, -928, -859, -558, 
-	-209, -70, -7, 49, 175, 269, 151, -12, -30, -145, -316, -402, -514, -586, -539, -397, 
-	-276, -148, -58, -72, -72, -7, 36, 60, 118, 128, 94, 53, -7, -76, -192, -301, 
-	-327, -312, -297, -258, -272, -400, -445, -292, -63, 98, 113, 57, 86, 116, 4, -225, 
-	-392, -428, -404, -354, -336, -272, -131, -21, 52, 114, 171, 182, 115, 22, -35, -84
-};
-
-static const short ugen_H_30e132a1c[] = { 
-	-12, 30, -63, 84, -138, 181, -249, 306, 19, 8753, 4578, -17196, -5783, 4748, -2699, 4426, 
-	10699, 12652, 12121, -1522, -3950, 6880, 6840, -292, -6287, -7967, -7266, -7367, -6005, -4959, -2580, -579, 
-	-1576, 168, 3763, 3601, 3121, 2908, 2775, 3368, 232, -2085, -1559, -2060, -3011, -2651, -2404, -1779, 
-	-1339, -974, 16, 812, 1250, 1134, 1151, 1263, 917, 555, 296, -358, -622, -795, -1177, -1160, 
-	-956, -849, -509, -271, 9, 397, 457, 336, 293, 244, 52, -87, -156, -198, -270, -262, 
-	-307, -283, -121, -22, -85, -104, -71, 5, 93, 341, 42, -563, -452, -270, -47, -2, 
-	-38, 84, 381, 143, -652, -634, -117, -144, -290, -217, -434, -430, -173, -56, 44, 288, 
-	409, 245, 438, 539, 272, 48, -187, -438, -476, -358, -323, -287, -380, -289, -44, 50
-};
-
-static const short ugen_H_30e138a0c[] = { 
-	0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 2, 1, 4, 0, 2, 3, 
-	-3, 15, -22, 34, -31, 54, 305, 3191, 1447, -5042, -3327, 168, 1489, 2425, 2246, 3002, 
-	5792, 6066, 998, -1823, -1528, -1244, -1422, -1797, -2293, -2601, -2220, -1616, -446, -12, 331, 841, 
-	1139, 1621, 1509, 1163, 996, 958, 286, -591, -898, -879, -698, -621, -686, -624, -302, -252, 
-	-292, 19, 240, 287, 207, 125, 71, -60, -221, -376, -446, -492, -538, -574, -486, -275, 
-	-112, -71, -70, 4, 49, -1, 14, 68, 72, 68, 1, -82, -122, -167, -238, -304, 
-	-301, -253, -182, -148, -285, -451, -421, -207, 19, 123, 102, 94, 144, 73, -142, -361, 
-	-450, -448, -393, -356, -357, -208, -38, 10, 86, 205, 288, 237, 104, 19, -54, -137
-};
-
-static const short ugen_H_30e138a1c[] = { 
-	-11, 20, -19, 0, 3, -41, 69, -114, 96, 1279, 9928, -1584, -15926, -451, 1373, -2194, 
-	7217, 10650, 12294, 7771, -2533, 1760, 8452, 3130, -3296, -7126, -7513, -6653, -7134, -6214, -4787, -1604, 
-	-631, -1233, 1632, 3972, 3145, 3220, 3132, 3343, 2677, -853, -1861, -1295, -2335, -3136, -3058, -2627, 
-	-1508, -1162, -802, 207, 1131, 1398, 1208, 1203, 1248, 843, 554, 158, -505, -696, -995, -1287, 
-	-1119, -900, -761, -476, -253, 203, 557, 450, 256, 231, 177, 44, -115, -207, -258, -275, 
-	-248, -303, -251, -84, -28, -114, -135, -74, -8, 158, 247, -330, -536, -300, -128, 30, 
-	30, 30, 240, 408, -290, -750, -296, -59, -383, -413, -416, -477, -229, -135, -11, 188, 
-	398, 325, 318, 538, 381, 134, -86, -318, -478, -436, -387, -357, -373, -408, -186, 20
-};
-
-static const short ugen_H_30e144a0c[] = { 
-	2, 0, 0, 0, 0, 0, 0, 0, -2, 1, 1, 1, 3, -6, 11, -17, 
-	28, -35, 47, -52, 95, 93, 3128, 2878, -5278, -4896, 10, 1640, 2755, 2537, 3175, 6242, 
-	7140, 1593, -2201, -1996, -1482, -1453, -1979, -2600, -3088, -2530, -1857, -641, 28, 23, 624, 1311, 
-	1768, 1756, 1306, 650, 830, 693, -311, -1002, -1146, -1061, -942, -497, -161, -160, -138, -4, 
-	162, 202, 206, 284, 274, 93, -87, -292, -520, -518, -500, -564, -544, -433, -350, -282, 
-	-140, -16, 81, 141, 108, 50, 50, 46, -18, -128, -212, -191, -147, -202, -269, -260, 
-	-210, -149, -67, -155, -408, -463, -303, -91, 52, 81, 79, 148, 163, -37, -344, -482, 
-	-473, -396, -331, -372, -301, -97, 23, 67, 151, 269, 284, 179, 85, 20, -77, -192
-};
-
-static const short ugen_H_30e144a1c[] = { 
-	21, -28, 40, -50, 44, -53, 39, -37, 29, -80, 2623, 9306, -5467, -12606, 1008, -1362, 
-	-29, 8184, 9920, 11333, 5575, -837, 5609, 7002, -535, -4548, -7231, -6791, -6378, -7066, -6168, -4309, 
-	-982, -575, -627, 2225, 3988, 3389, 3337, 2814, 3161, 2016, -1014, -1458, -1684, -2780, -2885, -2812, 
-	-2593, -1664, -1120, -338, 625, 1191, 1283, 1192, 1275, 1241, 796, 460, -98, -611, -710, -1016, 
-	-1219, -1065, -921, -676, -362, -169, 250, 470, 365, 285, 279, 153, -8, -143, -207, -257, 
-	-273, -255, -283, -219, -78, -66, -145, -168, -97, 18, 253, 51, -501, -421, -209, -23, 
-	107, 68, 99, 426, 193, -584, -570, -121, -276, -580, -483, -528, -351, -175, -128, 129, 
-	372, 430, 303, 440, 481, 275, 20, -217, -390, -482, -439, -434, -398, -450, -367, -83
-};
-
-static const short ugen_H_30e150a0c[] = { 
-	2, 1, 0, 0, 0, 0, 0, -1, 0, 4, 0, 7, -10, 17, -24, 34, 
-	-44, 58, -63, 111, -4, 2887, 4216, -5054, -6596, -413, 1794, 3164, 2913, 3388, 6697, 8095, 
-	2347, -2420, -2572, -1938, -1553, -2057, -2735, -3484, -3020, -2169, -783, 134, -21, 418, 1203, 2009, 
-	2056, 1431, 585, 801, 646, -471, -964, -1200, -1204, -938, -753, -643, -105, 433, 413, 356, 
-	463, 384, 240, 289, 209, -110, -386, -603, -628, -555, -549, -588, -561, -406, -237, -163, 
-	-106, 80, 243, 232, 145, 99, 2, -102, -165, -224, -244, -206, -212, -245, -238, -194, 
-	-122, -15, -33, -314, -488, -397, -154, 40, 50, 6, 92, 219, 94, -257, -496, -497, 
-	-426, -316, -318, -337, -172, -9, 92, 171, 237, 261, 169, 113, 96, -1, -127, -245
-};
-
-static const short ugen_H_30e150a1c[] = { 
-	-9, 24, -33, 43, -62, 63, -86, 87, -106, 118, -153, 3539, 8082, -6943, -9804, 197, 
-	-2317, 1827, 7917, 9253, 10514, 5341, 1670, 6818, 3854, -2549, -4639, -7323, -6367, -6081, -6802, -5840, 
-	-3696, -910, -382, 250, 2565, 3625, 3293, 3542, 2794, 2545, 1158, -895, -1128, -1944, -2942, -2781, 
-	-2623, -2223, -1392, -1050, -180, 827, 1236, 1226, 1164, 1214, 1062, 668, 401, -181, -648, -727, 
-	-992, -1110, -1000, -929, -655, -306, -54, 280, 357, 302, 332, 286, 102, -29, -145, -222, 
-	-275, -271, -245, -260, -190, -114, -115, -146, -127, -100, 74, 287, -172, -548, -326, -134, 
-	74, 159, 53, 194, 427, -87, -597, -363, -196, -538, -619, -534, -539, -255, -162, 0, 
-	337, 454, 375, 342, 466, 410, 165, -119, -293, -427, -477, -468, -486, -486, -448, -217
-};
-
-static const short ugen_H_30e156a0c[] = { 
-	2, 0, 1, -2, 0, 0, -2, -2, 4, -2, 10, -15, 17, -26, 32, -44, 
-	48, -53, 90, -14, 2616, 5240, -4447, -8186, -1106, 1827, 3557, 3544, 3700, 7153, 8765, 3051, 
-	-2359, -2979, -2488, -1962, -2199, -2750, -3779, -3483, -2487, -1024, 246, -82, 412, 1367, 2029, 2077, 
-	1561, 806, 771, 603, -496, -1214, -1290, -1119, -1148, -1087, -723, -225, 145, 498, 917, 971, 
-	685, 502, 379, 109, -158, -343, -602, -663, -647, -752, -780, -617, -408, -280, -127, -23, 
-	86, 214, 263, 174, 76, -2, -63, -117, -214, -259, -217, -206, -251, -264, -214, -133, 
-	-26, 37, -212, -473, -440, -245, -11, 68, 5, 8, 147, 172, -118, -424, -477, -472, 
-	-381, -289, -307, -225, -77, 68, 185, 235, 268, 188, 97, 104, 51, -63, -192, -334
-};
-
-static const short ugen_H_30e156a1c[] = { 
-	4, -7, 19, -26, 40, -57, 65, -92, 107, -136, 163, -150, 4027, 6815, -6867, -8083, 
-	-1230, -2120, 2732, 7251, 8935, 10045, 5966, 3885, 6090, 686, -3287, -4441, -7245, -5892, -5762, -6488, 
-	-5306, -3119, -790, -256, 683, 2837, 3415, 2938, 3257, 2660, 2394, 777, -1080, -1265, -1997, -2636, 
-	-2609, -2630, -1912, -909, -631, 36, 682, 995, 1181, 1161, 1137, 936, 511, 267, -221, -600, 
-	-724, -1005, -1089, -924, -753, -501, -304, -88, 254, 326, 302, 301, 210, 50, -52, -179, 
-	-252, -268, -224, -182, -206, -181, -149, -123, -115, -102, -59, 183, 167, -375, -518, -284, 
-	-95, 153, 147, 7, 280, 329, -220, -475, -276, -383, -695, -581, -579, -489, -161, -74, 
-	211, 456, 401, 288, 355, 452, 311, 29, -168, -271, -426, -497, -547, -560, -492, -335
-};
-
-static const short ugen_H_30e162a0c[] = { 
-	0, 0, -1, -1, -1, -4, -5, 2, -5, 8, -18, 15, -28, 27, -41, 33, 
-	-38, 59, 4, 2427, 5877, -3627, -9414, -2044, 1772, 3689, 4336, 4366, 7626, 9117, 3564, -2058, 
-	-3214, -2891, -2512, -2701, -2796, -3798, -3954, -2861, -1391, 300, 249, 253, 1323, 2169, 2267, 1807, 
-	723, 707, 730, -482, -1177, -1430, -1608, -1422, -971, -671, -451, -42, 439, 781, 1144, 1197, 
-	841, 526, 281, -34, -274, -595, -787, -786, -849, -873, -800, -589, -285, -41, 46, 128, 
-	207, 189, 92, 76, 60, -13, -92, -161, -226, -239, -213, -238, -250, -225, -169, -97, 
-	38, -83, -456, -529, -334, -39, 115, 0, -58, 74, 185, -6, -343, -448, -470, -443, 
-	-302, -315, -296, -127, 36, 176, 212, 245, 216, 120, 127, 101, -10, -139, -323, -481
-};
-
-static const short ugen_H_30e162a1c[] = { 
-	-4, 5, -5, 15, -19, 29, -49, 57, -85, 100, -135, 163, -116, 4018, 6155, -5973, 
-	-7727, -2355, -1647, 2948, 6851, 8700, 9986, 6919, 5062, 4362, -1412, -3334, -4730, -6979, -5015, -5260, 
-	-6178, -4967, -2728, -514, 10, 765, 2593, 3205, 2986, 3026, 2174, 1994, 777, -780, -1472, -2372, 
-	-2553, -2296, -2215, -1521, -796, -458, 380, 852, 926, 983, 950, 992, 816, 405, 131, -345, 
-	-605, -668, -863, -897, -783, -722, -528, -270, -42, 208, 241, 262, 238, 114, -4, -96, 
-	-202, -222, -200, -144, -134, -182, -169, -110, -75, -78, -98, -48, 183, -25, -522, -536, 
-	-314, -8, 244, 89, 38, 349, 220, -266, -392, -311, -565, -689, -572, -636, -325, -23, 
-	66, 351, 407, 271, 219, 349, 385, 206, 0, -133, -284, -432, -541, -653, -606, -424
-};
-
-static const short ugen_H_30e168a0c[] = { 
-	0, -2, 0, 0, -2, -3, 3, -3, 11, -15, 15, -26, 24, -33, 24, -32, 
-	51, 11, 2447, 6099, -2974, -9907, -3118, 1557, 3732, 4910, 5335, 8329, 9214, 3847, -1620, -3339, 
-	-3151, -2979, -3285, -3076, -3854, -4249, -3339, -1518, 350, 271, 228, 1341, 2401, 2396, 1933, 896, 
-	771, 846, -392, -1394, -1789, -1751, -1515, -1210, -770, -249, 39, 354, 728, 979, 996, 940, 
-	903, 641, 190, -172, -615, -825, -732, -862, -1012, -896, -623, -356, -129, 10, 112, 192, 
-	222, 159, 86, 47, 22, -39, -108, -168, -200, -216, -229, -220, -223, -202, -157, 19, 
-	47, -372, -621, -431, -99, 156, 74, -74, 28, 194, 78, -272, -435, -451, -471, -344, 
-	-321, -333, -154, 16, 161, 191, 193, 225, 197, 186, 157, 65, -72, -282, -467, -530
-};
-
-static const short ugen_H_30e168a1c[] = { 
-	-2, -2, 2, -2, 11, -15, 22, -39, 43, -70, 80, -114, 140, -61, 3803, 5791, 
-	-4988, -7834, -3178, -1223, 3239, 6626, 8213, 9944, 7946, 5241, 2509, -2499, -3638, -4768, -6191, -4400, 
-	-4753, -5585, -4637, -2632, -322, 245, 755, 2318, 2878, 2815, 2992, 2088, 1579, 476, -800, -1457, 
-	-2177, -2396, -2343, -2060, -1163, -404, -116, 445, 802, 986, 1020, 793, 679, 491, 244, 98, 
-	-301, -497, -486, -640, -824, -860, -739, -491, -272, -84, 131, 195, 219, 161, 45, -26, 
-	-71, -173, -203, -166, -75, -59, -120, -111, -45, -29, -109, -205, -94, 108, -262, -635, 
-	-498, -233, 105, 262, 64, 139, 350, 89, -287, -368, -421, -682, -633, -546, -517, -142, 
-	44, 174, 360, 284, 172, 200, 314, 304, 172, 28, -107, -310, -508, -644, -680, -539
-};
-
-static const short ugen_H_30e174a0c[] = { 
-	-2, 0, 0, -2, -5, 3, -3, 9, -12, 13, -26, 23, -37, 31, -47, 67, 
-	-4, 2648, 6075, -2795, -9687, -3981, 992, 3811, 5337, 6215, 9121, 9321, 4103, -1120, -3439, -3371, 
-	-3385, -3898, -3382, -4140, -4424, -3398, -2023, 34, 414, 509, 1523, 2334, 2438, 2133, 1310, 1125, 
-	672, -714, -1479, -1803, -1899, -1834, -1432, -707, -169, 77, 430, 701, 897, 950, 788, 752, 
-	704, 415, 32, -456, -741, -765, -842, -910, -821, -675, -470, -273, -142, 38, 186, 252, 
-	179, 136, 89, 3, -61, -97, -102, -118, -165, -199, -195, -210, -259, -242, -68, 107, 
-	-212, -629, -537, -222, 145, 199, -15, 18, 196, 109, -208, -414, -467, -539, -426, -323, 
-	-359, -183, 21, 135, 170, 159, 187, 213, 253, 242, 133, -8, -199, -411, -529, -580
-};
-
-static const short ugen_H_30e174a1c[] = { 
-	0, -2, -3, 1, -2, 8, -13, 17, -35, 35, -57, 59, -89, 114, -34, 3408, 
-	5828, -4027, -8354, -3854, -633, 3643, 6256, 7581, 9835, 8773, 5057, 800, -3186, -3649, -4598, -5262, 
-	-3748, -4593, -5256, -4130, -2273, -278, 188, 631, 1984, 2767, 2924, 2720, 1656, 1424, 576, -885, 
-	-1690, -2093, -2084, -2029, -1832, -1104, -321, 122, 605, 755, 872, 959, 810, 604, 318, 84, 
-	34, -140, -264, -416, -722, -879, -851, -754, -551, -308, -108, 94, 169, 177, 94, 32, 
-	21, -47, -137, -136, -106, -26, -28, -90, -72, -51, -124, -248, -281, -79, 18, -423, 
-	-655, -440, -111, 232, 220, 36, 203, 277, -18, -328, -414, -553, -693, -496, -456, -371, 
-	-46, 98, 201, 259, 189, 135, 195, 293, 260, 156, 35, -156, -422, -605, -671, -618
-};
-
-static const short ugen_H_30e180a0c[] = { 
-	0, 0, -2, -2, 2, -1, 11, -12, 16, -28, 30, -46, 46, -64, 92, -16, 
-	3019, 5956, -3257, -9052, -4185, 258, 3911, 5778, 6877, 9598, 9234, 4532, -428, -3515, -3587, -3813, 
-	-4528, -3765, -4183, -4783, -3868, -2035, -89, 222, 519, 1808, 2512, 2731, 2646, 1444, 935, 542, 
-	-560, -1482, -2046, -2155, -1917, -1463, -773, -231, -56, 399, 864, 1046, 910, 666, 556, 443, 
-	314, 204, -192, -542, -637, -731, -844, -847, -738, -529, -309, -127, 43, 100, 160, 156, 
-	132, 74, -10, -92, -103, -58, -28, -71, -135, -128, -132, -214, -294, -235, 15, -54, 
-	-522, -605, -355, -2, 260, 139, 30, 201, 183, -110, -368, -450, -591, -578, -361, -375, 
-	-257, -2, 122, 182, 165, 142, 159, 237, 292, 230, 108, -61, -292, -497, -593, -637
-};
-
-static const short ugen_H_30e180a1c[] = { 
-	0, 0, -2, -2, 2, -1, 11, -12, 16, -28, 30, -46, 46, -64, 92, -16, 
-	3019, 5956, -3257, -9052, -4185, 258, 3911, 5778, 6877, 9598, 9234, 4532, -428, -3515, -3587, -3813, 
-	-4528, -3765, -4183, -4783, -3868, -2035, -89, 222, 519, 1808, 2512, 2731, 2646, 1444, 935, 542, 
-	-560, -1482, -2046, -2155, -1917, -1463, -773, -231, -56, 399, 864, 1046, 910, 666, 556, 443, 
-	314, 204, -192, -542, -637, -731, -844, -847, -738, -529, -309, -127, 43, 100, 160, 156, 
-	132, 74, -10, -92, -103, -58, -28, -71, -135, -128, -132, -214, -294, -235, 15, -54, 
-	-522, -605, -355, -2, 260, 139, 30, 201, 183, -110, -368, -450, -591, -578, -361, -375, 
-	-257, -2, 122, 182, 165, 142, 159, 237, 292, 230, 108, -61, -292, -497, -593, -637
-};
-
-static const short ugen_H_40e000a0c[] = { 
-	-7, 7, -5, 13, -11, 17, -26, 19, -19, 9, -16, 19, -38, 2137, 6622, -2554, 
-	-8070, 180, -1296, 1447, 8829, 7884, 3326, 4822, 10353, 2974, -4885, -3539, -6389, -7409, -430, -2189, 
-	-6704, -3864, -1267, -715, -436, 1001, 1573, 882, 1710, 3055, 941, 45, 534, 300, -299, -1128, 
-	-1018, -1167, -1323, -676, -707, -995, -197, 228, 87, 291, 509, 661, 448, -65, -50, -455, 
-	-516, 135, 237, 176, 279, 179, -9, -368, -562, -779, -1232, -1003, -475, -174, 174, 348, 
-	471, 512, 291, 267, 31, -319, -547, -634, -471, -202, -29, 74, 48, 30, 51, -75, 
-	-117, -89, -58, -144, -251, -207, -117, -102, -95, -190, -280, -245, -183, -177, -118, 1, 
-	44, 57, 93, 102, 56, -29, -81, -108, -151, -186, -225, -213, -265, -248, -148, -43
-};
-
-static const short ugen_H_40e000a1c[] = { 
-	-7, 7, -5, 13, -11, 17, -26, 19, -19, 9, -16, 19, -38, 2137, 6622, -2554, 
-	-8070, 180, -1296, 1447, 8829, 7884, 3326, 4822, 10353, 2974, -4885, -3539, -6389, -7409, -430, -2189, 
-	-6704, -3864, -1267, -715, -436, 1001, 1573, 882, 1710, 3055, 941, 45, 534, 300, -299, -1128, 
-	-1018, -1167, -1323, -676, -707, -995, -197, 228, 87, 291, 509, 661, 448, -65, -50, -455, 
-	-516, 135, 237, 176, 279, 179, -9, -368, -562, -779, -1232, -1003, -475, -174, 174, 348, 
-	471, 512, 291, 267, 31, -319, -547, -634, -471, -202, -29, 74, 48, 30, 51, -75, 
-	-117, -89, -58, -144, -251, -207, -117, -102, -95, -190, -280, -245, -183, -177, -118, 1, 
-	44, 57, 93, 102, 56, -29, -81, -108, -151, -186, -225, -213, -265, -248, -148, -43
-};
-
-static const short ugen_H_40e006a0c[] = { 
-	0, -4, 5, -1, 8, 0, 3, -1, -6, 10, -21, 26, -32, 26, 772, 5185, 
-	1510, -7265, -3092, -1910, -1126, 6837, 8154, 5110, 4291, 8060, 6268, -1040, -2355, -4348, -7784, -3071, 
-	-362, -4267, -4976, -3158, -1304, -515, 307, 1125, 758, 985, 2654, 2070, 598, 666, 595, -122, 
-	-771, -997, -1303, -1461, -1015, -734, -870, -563, -160, 158, 435, 459, 292, 259, -84, 184, 
-	672, 408, 375, 352, -3, -259, -328, -358, -758, -1119, -955, -803, -482, 2, 149, 265, 
-	498, 499, 414, 73, -203, -450, -675, -516, -249, -113, -41, 38, 143, 114, -46, -66, 
-	-96, -65, -78, -247, -358, -286, -213, -204, -171, -134, -115, -50, -27, -51, -65, -71, 
-	-27, 46, 53, -23, -53, -87, -116, -91, -42, -85, -71, -82, -229, -250, -195, -145
-};
-
-static const short ugen_H_40e006a1c[] = { 
-	2, -2, 11, -6, 7, -9, -9, 14, -33, 33, -55, 37, 1077, 6964, 702, -9833, 
-	-1649, -664, -345, 8621, 9656, 4711, 3506, 11022, 6149, -5438, -4621, -5771, -8483, -1100, -572, -7160, 
-	-5118, -1558, -1084, -1239, 484, 1737, 1295, 1680, 3419, 1837, 265, 694, 239, -219, -1199, -1493, 
-	-1420, -1475, -846, -570, -1010, -293, 428, 271, 284, 482, 592, 506, -135, -208, -366, -697, 
-	-31, 304, 161, 226, 133, 12, -251, -572, -789, -1276, -1108, -423, -61, 178, 374, 459, 
-	620, 454, 305, 45, -384, -592, -716, -578, -306, -134, -16, 23, 16, 100, 17, -19, 
-	28, 55, -22, -171, -208, -145, -146, -153, -244, -365, -341, -252, -193, -152, -41, 7, 
-	30, 93, 123, 98, 57, 1, -31, -127, -187, -274, -331, -322, -302, -188, -93, 55
-};
-
-static const short ugen_H_40e013a0c[] = { 
-	0, -1, -4, 3, -2, 8, -3, 8, -12, 3, -3, -3, 5, -2, -6, 1233, 
-	4978, -187, -6509, -2071, -2009, 293, 6580, 6613, 4599, 4570, 7668, 4761, -1083, -1913, -4447, -6838, 
-	-2683, -963, -4252, -4737, -2446, -599, -391, 231, 1102, 1044, 1458, 2272, 1265, 588, 899, 387, 
-	-512, -945, -1096, -1276, -1295, -958, -741, -681, -393, -30, 301, 421, 298, 308, 323, 72, 
-	503, 666, 391, 381, 112, -242, -412, -439, -493, -878, -1041, -819, -644, -252, 83, 173, 
-	302, 341, 316, 229, -42, -233, -480, -590, -372, -155, -63, 3, 87, 144, 10, -89, 
-	-115, -183, -131, -187, -328, -345, -232, -186, -170, -131, -139, -95, 2, -6, -50, -43, 
-	-16, 16, 47, 0, -75, -118, -173, -174, -96, -53, -70, -43, -100, -184, -159, -141
-};
-
-static const short ugen_H_40e013a1c[] = { 
-	0, 4, 4, -7, 13, -36, 45, -65, 73, -108, 113, 315, 6213, 4416, -10038, -4794, 
-	300, -1811, 7496, 11055, 6615, 2862, 10366, 9592, -5040, -5919, -5090, -9295, -2216, 915, -7109, -6564, 
-	-1851, -1499, -2521, -72, 2717, 1896, 1176, 3414, 2966, 752, 1035, 180, -574, -1133, -1535, -1848, 
-	-1975, -1095, -494, -937, -350, 626, 475, 343, 492, 634, 661, -2, -384, -330, -764, -325, 
-	307, 100, 91, 55, -19, -108, -482, -714, -1243, -1263, -488, 46, 288, 453, 491, 580, 
-	523, 409, 169, -353, -646, -816, -742, -365, -142, -113, -23, 22, 161, 141, 31, 79, 
-	144, 121, -38, -172, -151, -128, -156, -273, -440, -431, -350, -229, -152, -50, 16, 21, 
-	72, 134, 141, 103, 47, 35, -50, -161, -243, -371, -400, -351, -228, -99, 5, 153
-};
-
-static const short ugen_H_40e019a0c[] = { 
-	0, 0, -1, -3, 3, -1, 9, -4, 8, -9, 2, -2, 0, 7, 0, -2, 
-	1145, 4360, -151, -5564, -1942, -1517, 555, 5160, 5652, 4533, 4313, 6780, 4366, -393, -1564, -3962, 
-	-6074, -2690, -1091, -4079, -4392, -2011, -343, -397, 121, 1122, 1366, 1654, 1896, 1060, 666, 709, 
-	17, -806, -1124, -1042, -1078, -1269, -963, -533, -446, -259, 67, 372, 454, 373, 452, 371, 
-	187, 512, 434, 284, 265, -22, -349, -536, -501, -660, -1040, -1015, -663, -393, 3, 234, 
-	282, 324, 240, 188, 68, -146, -334, -579, -547, -267, -70, -19, 1, 79, 84, -32, 
-	-90, -147, -204, -165, -216, -315, -289, -189, -183, -172, -134, -127, -49, 14, -18, -49, 
-	-13, 24, 39, 9, -59, -101, -161, -219, -190, -103, -78, -36, 15, -36, -91, -122
-};
-
-static const short ugen_H_40e019a1c[] = { 
-	0, 13, -18, 28, -51, 56, -71, 76, -109, 121, 30, 5386, 6873, -9242, -7891, 472, 
-	-2124, 6564, 11844, 8197, 3470, 9514, 11244, -3525, -6666, -6126, -9311, -2232, 1025, -7118, -7279, -2613, 
-	-2541, -3414, -135, 3979, 2666, 849, 3212, 3862, 1428, 1016, 226, -768, -1553, -1664, -1904, -2402, 
-	-1526, -579, -944, -375, 822, 652, 382, 627, 832, 831, 226, -360, -405, -892, -713, 91, 
-	88, -4, 35, -74, -137, -396, -617, -1185, -1323, -580, 119, 473, 594, 516, 475, 471, 
-	434, 269, -291, -652, -841, -835, -504, -219, -172, -59, 67, 248, 287, 119, 97, 161, 
-	181, 87, -70, -143, -150, -149, -260, -497, -499, -446, -327, -166, 7, 84, 28, 54, 
-	107, 131, 125, 83, 55, -2, -125, -204, -364, -467, -390, -249, -108, 0, 123, 207
-};
-
-static const short ugen_H_40e026a0c[] = { 
-	-2, 0, 0, -2, -1, 3, 0, 8, -3, 8, -11, 11, -11, 14, -7, 18, 
-	-1, 1461, 3901, -1130, -4774, -1377, -1084, 991, 4360, 5144, 4194, 4262, 6126, 3478, -204, -1506, 
-	-4121, -5418, -1889, -1361, -4251, -3777, -1309, -197, -370, 294, 1173, 1489, 1707, 1699, 865, 470, 
-	366, -286, -982, -1071, -892, -1109, -1251, -702, -320, -324, -137, 209, 490, 573, 568, 460, 
-	144, 146, 392, 225, 164, 89, -135, -415, -573, -635, -895, -1085, -817, -417, -98, 253, 
-	375, 383, 327, 182, 29, -166, -323, -477, -625, -486, -171, 23, 7, -27, 41, 54, 
-	-34, -111, -170, -176, -149, -213, -266, -216, -185, -229, -183, -128, -92, -27, -10, -21, 
-	-11, 7, 22, 12, -41, -98, -148, -193, -227, -164, -78, -20, 60, 48, -37, -110
-};
-
-static const short ugen_H_40e026a1c[] = { 
-	20, -21, 28, -38, 32, -30, 19, -30, 22, -70, 2928, 9257, -4106, -12309, -866, -1650, 
-	3580, 11832, 10014, 4991, 6547, 13717, 1524, -7691, -6547, -9954, -3718, 1910, -6043, -8741, -3877, -3093, 
-	-3831, -760, 3896, 3524, 1408, 2897, 4129, 2054, 1171, 279, -577, -1437, -2132, -2083, -2354, -1794, 
-	-840, -1066, -694, 692, 763, 520, 793, 976, 937, 588, -155, -466, -846, -1131, -388, 31, 
-	-29, 108, 1, -106, -342, -483, -966, -1372, -805, -69, 441, 657, 589, 448, 385, 349, 
-	355, -55, -516, -804, -902, -636, -269, -182, -159, -1, 200, 368, 258, 139, 137, 167, 
-	163, 69, -61, -128, -154, -236, -487, -562, -493, -413, -231, -22, 132, 106, 62, 58, 
-	57, 109, 102, 37, 26, -73, -146, -271, -444, -467, -326, -160, -24, 103, 185, 158
-};
-
-static const short ugen_H_40e032a0c[] = { 
-	0, 0, 0, 0, 0, 0, 2, 0, 7, -3, 8, -7, 10, -8, 14, -5, 
-	19, -5, 1286, 3392, -892, -4101, -1068, -740, 430, 3541, 4757, 3881, 3882, 5343, 3325, 257, 
-	-1320, -3853, -4656, -1543, -1516, -3937, -3167, -892, -104, -395, 309, 1216, 1458, 1362, 1345, 885, 
-	418, 88, -463, -832, -816, -853, -1138, -1062, -462, -239, -340, -135, 401, 737, 630, 501, 
-	292, 32, 52, 106, 40, 18, -112, -266, -472, -542, -632, -849, -881, -596, -215, 101, 
-	360, 439, 398, 214, 26, -120, -308, -487, -605, -589, -347, -51, 42, -66, -66, 36, 
-	36, -41, -108, -154, -171, -148, -173, -200, -182, -212, -254, -172, -99, -72, -53, -26, 
-	2, -23, -35, -8, -18, -85, -132, -180, -231, -193, -56, 12, 43, 79, 15, -73
-};
-
-static const short ugen_H_40e032a1c[] = { 
-	-8, 8, -16, -5, 15, -41, 41, -79, 33, 1410, 9355, 874, -14133, -4052, -517, 1879, 
-	11432, 10947, 5369, 5552, 15639, 5274, -7721, -7391, -10961, -4458, 2307, -4958, -9898, -5843, -3401, -2973, 
-	-960, 2860, 3748, 2333, 3448, 4306, 2161, 1092, 200, -467, -1182, -2493, -2682, -2358, -1718, -1005, 
-	-1055, -930, 533, 810, 725, 861, 969, 1064, 826, 59, -506, -848, -1389, -873, -52, -15, 
-	77, 140, 5, -266, -451, -796, -1300, -902, -232, 299, 516, 548, 470, 353, 312, 382, 
-	151, -322, -745, -978, -753, -362, -162, -139, -20, 121, 315, 301, 154, 137, 178, 168, 
-	173, 79, -49, -114, -217, -483, -629, -581, -483, -236, -43, 135, 156, 85, 50, 13, 
-	44, 44, -5, 19, -12, -94, -204, -369, -470, -405, -207, -70, 52, 142, 153, 143
-};
-
-static const short ugen_H_40e039a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 1, 1, 5, 0, 8, -7, 13, -8, 16, 
-	-14, 28, 23, 1542, 2819, -1588, -3225, -528, -850, 556, 3487, 4309, 3449, 3799, 4655, 2613, 
-	256, -1432, -3773, -3710, -1248, -1999, -3363, -2097, -520, -265, -289, 561, 1201, 1147, 924, 1087, 
-	874, 447, -46, -549, -644, -629, -874, -1089, -886, -462, -268, -205, 109, 583, 736, 526, 
-	274, 38, -88, -62, -61, -80, -137, -218, -302, -421, -429, -556, -702, -655, -396, -77, 
-	190, 338, 354, 246, 34, -100, -214, -379, -528, -559, -424, -159, -8, -61, -122, -51, 
-	1, -15, -44, -114, -189, -166, -137, -146, -155, -165, -208, -199, -107, -81, -70, -72, 
-	-66, -52, -66, -42, -14, -61, -125, -161, -197, -188, -86, 16, 31, 69, 70, -11
-};
-
-static const short ugen_H_40e039a1c[] = { 
-	-15, 27, -55, 68, -91, 94, -140, 148, 12, 6464, 8012, -11068, -10778, -73, -25, 8976, 
-	12124, 6267, 4231, 15381, 12110, -5483, -7999, -11555, -7433, 2428, -2196, -10247, -8309, -4185, -2097, -1142, 
-	827, 3275, 2910, 3766, 4987, 2672, 1034, 474, -304, -943, -2268, -3042, -2924, -1846, -1036, -968, 
-	-1062, 268, 799, 768, 904, 858, 966, 1000, 498, -336, -812, -1358, -1307, -394, 0, -28, 
-	241, 211, -105, -411, -621, -1074, -1027, -520, 48, 356, 412, 446, 392, 282, 419, 398, 
-	-45, -463, -932, -935, -580, -228, -138, -61, 44, 184, 326, 213, 113, 194, 199, 212, 
-	195, 50, -42, -111, -351, -631, -646, -571, -343, -104, 86, 202, 137, 52, -6, -19, 
-	26, 4, -17, 23, -34, -135, -273, -398, -465, -322, -105, 8, 119, 151, 114, 161
-};
-
-static const short ugen_H_40e045a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 1, 1, 3, 6, 3, 6, -3, 11, -9, 
-	17, -9, 21, 102, 1742, 2037, -1956, -2179, -430, -971, 929, 3367, 3802, 3105, 3563, 3889, 
-	2211, 366, -1736, -3657, -2839, -1131, -1958, -2487, -1424, -417, -207, -6, 545, 845, 707, 760, 
-	1152, 864, 364, -135, -493, -518, -556, -879, -1163, -848, -235, -31, -18, 223, 474, 422, 
-	305, 126, -145, -210, -149, -77, -107, -171, -198, -289, -319, -320, -476, -585, -501, -259, 
-	-15, 153, 222, 193, 33, -99, -108, -196, -354, -433, -386, -251, -102, -86, -175, -166, 
-	-66, -30, -30, -100, -184, -173, -127, -110, -119, -122, -127, -128, -97, -85, -102, -115, 
-	-134, -121, -91, -72, -46, -34, -82, -122, -150, -163, -129, -40, 32, 60, 101, 52
-};
-
-static const short ugen_H_40e045a1c[] = { 
-	24, -43, 43, -40, 22, -39, 28, -106, 3087, 10754, -3795, -15678, -2836, 394, 6439, 11675, 
-	6780, 4438, 13724, 17553, -1547, -8940, -11800, -9339, 2189, -867, -9948, -9979, -4753, -1879, -692, -380, 
-	1752, 3183, 3721, 5179, 3631, 1510, 459, -206, -594, -2126, -3129, -3490, -2332, -1032, -696, -1187, 
-	-7, 1047, 751, 825, 752, 940, 937, 745, -26, -722, -1215, -1504, -941, -104, 4, 110, 
-	287, 151, -168, -544, -911, -975, -693, -229, 146, 254, 312, 385, 378, 386, 487, 222, 
-	-176, -712, -930, -686, -378, -243, -176, -25, 77, 196, 217, 142, 205, 309, 262, 248, 
-	168, 42, -55, -242, -521, -664, -621, -434, -196, -3, 170, 182, 93, 18, -66, -52, 
-	14, -5, 19, 44, -76, -254, -336, -426, -411, -194, -26, 104, 184, 143, 97, 97
-};
-
-static const short ugen_H_40e051a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 1, 0, 0, -1, 8, 
-	-8, 9, -8, 0, 151, 1557, 1433, -1521, -1487, -670, -819, 1005, 2809, 3216, 2801, 3199, 
-	3360, 2121, 286, -1873, -3060, -2012, -925, -1577, -1728, -942, -225, -135, -129, 196, 530, 611, 
-	754, 1000, 657, 181, -124, -291, -426, -689, -964, -871, -405, -34, -69, -128, 3, 195, 
-	205, 88, -63, -177, -202, -199, -73, -24, -101, -160, -200, -245, -345, -465, -488, -402, 
-	-227, -64, 30, 41, 1, -74, -86, -53, -129, -222, -258, -232, -211, -211, -230, -240, 
-	-171, -115, -116, -139, -174, -157, -120, -97, -99, -75, -55, -64, -72, -96, -116, -148, 
-	-171, -186, -168, -126, -86, -30, -44, -84, -100, -122, -146, -138, -45, 26, 75, 87
-};
-
-static const short ugen_H_40e051a1c[] = { 
-	16, -47, 66, -98, 102, -155, 158, 161, 7893, 7455, -13793, -11148, 368, 3107, 10186, 8291, 
-	5158, 8679, 20275, 8500, -8287, -10894, -12369, -582, 1931, -7568, -11470, -6561, -2701, -1102, -202, 465, 
-	2116, 2897, 4998, 4519, 2341, 1398, -63, -401, -1354, -2721, -3745, -3098, -1641, -800, -963, -649, 
-	914, 897, 890, 746, 827, 923, 901, 379, -475, -1063, -1410, -1315, -671, -50, -66, 181, 
-	340, 152, -238, -737, -960, -833, -444, -59, 57, 131, 267, 500, 462, 427, 356, 130, 
-	-382, -860, -770, -458, -303, -353, -180, -10, 74, 153, 141, 126, 285, 353, 344, 296, 
-	171, 31, -184, -394, -578, -669, -548, -303, -131, 56, 186, 147, 51, -26, -96, -36, 
-	8, 7, 45, 19, -176, -332, -360, -426, -309, -134, 0, 164, 215, 133, 63, 0
-};
-
-static const short ugen_H_40e058a0c[] = { 
-	2, 1, 0, 1, 0, 0, 3, 2, 0, 3, 2, 5, 2, 6, 1, 6, 
-	2, 0, 0, 0, -5, 372, 1497, 595, -1244, -945, -839, -340, 1208, 2426, 2796, 2754, 
-	3010, 2574, 1554, -72, -1886, -2282, -1204, -779, -1144, -922, -440, -249, -317, -91, 152, 308, 
-	426, 631, 674, 401, 156, -84, -281, -476, -632, -658, -434, -166, -153, -241, -220, -81, 
-	9, 18, -1, -120, -208, -236, -118, 54, 51, -32, -112, -191, -302, -410, -446, -391, 
-	-318, -227, -111, -34, 4, -37, -79, -37, -20, -66, -133, -166, -209, -241, -248, -252, 
-	-227, -198, -183, -177, -164, -151, -117, -67, -52, -52, -49, -44, -44, -54, -81, -129, 
-	-169, -191, -178, -138, -104, -61, -21, -29, -51, -84, -128, -152, -114, -30, 19, 69
-};
-
-static const short ugen_H_40e058a1c[] = { 
-	-27, 23, -19, -17, 10, -45, -26, 2141, 11391, -1217, -17869, -4759, 2084, 6595, 9560, 6400, 
-	5544, 15566, 19307, -2182, -10745, -12946, -5688, 3605, -3628, -11046, -9535, -4026, -1967, -187, 88, 1184, 
-	1695, 3303, 5428, 3295, 1821, 660, 259, -479, -2201, -3290, -3656, -2301, -1471, -1015, -1103, 379, 
-	1058, 859, 994, 841, 898, 860, 791, -49, -837, -1390, -1378, -1075, -454, -191, -168, 330, 
-	450, 118, -415, -830, -823, -690, -248, -36, -14, 65, 359, 598, 455, 395, 271, -23, 
-	-618, -806, -549, -332, -362, -341, -141, -33, 39, 113, 115, 165, 304, 369, 425, 352, 
-	214, -39, -333, -489, -606, -640, -436, -231, -83, 87, 184, 120, 33, -52, -78, -2, 
-	-32, 27, 50, -49, -250, -333, -348, -378, -228, -112, 26, 188, 209, 132, 28, -44
-};
-
-static const short ugen_H_40e064a0c[] = { 
-	3, 0, 0, 1, 2, 1, 2, 2, 2, 1, 2, 0, 5, 2, 3, 1, 
-	7, -5, 0, 0, 10, 0, 486, 1140, 172, -745, -714, -800, -49, 1087, 2042, 2579, 
-	2477, 2182, 1900, 1426, 35, -1507, -1447, -526, -263, -269, -445, -550, -410, -304, -277, -233, 
-	-9, 146, 333, 505, 401, 50, -207, -206, -156, -266, -337, -267, -235, -287, -341, -354, 
-	-280, -127, -60, -116, -245, -257, -158, 4, 149, 117, 3, -126, -245, -339, -405, -402, 
-	-369, -318, -238, -91, 6, -16, -67, -101, -61, -38, -59, -88, -139, -189, -223, -237, 
-	-252, -248, -229, -226, -203, -175, -143, -85, -45, -69, -99, -56, -15, -8, -30, -80, 
-	-139, -178, -156, -134, -134, -112, -49, -12, -25, -60, -127, -169, -169, -115, -59, -21
-};
-
-static const short ugen_H_40e064a1c[] = { 
-	-55, 76, -108, 94, -139, 148, -183, 5901, 10953, -11570, -15683, 804, 3348, 8645, 7875, 5017, 
-	9106, 21663, 10634, -9622, -12567, -9682, 2343, 1084, -8685, -11993, -6476, -2333, -1316, 155, 55, 1318, 
-	1767, 4211, 4143, 2340, 1425, 426, 835, -802, -2715, -3919, -2789, -1744, -1605, -1621, -676, 1059, 
-	918, 1050, 1020, 1044, 858, 852, 445, -430, -1167, -1531, -1292, -930, -297, -376, -203, 448, 
-	510, 94, -606, -756, -661, -520, -152, -105, -84, 125, 541, 598, 390, 261, 134, -290, 
-	-715, -611, -333, -265, -392, -328, -156, -61, -6, 63, 102, 248, 348, 403, 423, 343, 
-	209, -144, -416, -534, -622, -586, -354, -168, -57, 88, 158, 126, 40, -69, -37, -32, 
-	-52, 40, -20, -140, -233, -268, -346, -328, -208, -93, 89, 182, 150, 86, -14, -47
-};
-
-static const short ugen_H_40e071a0c[] = { 
-	2, 1, 0, 1, 2, 1, 2, 2, 2, 1, 0, 0, 1, 3, 2, 0, 
-	1, 2, -1, 6, -1, 0, 66, 651, 737, -162, -471, -627, -544, 319, 1330, 1841, 
-	1870, 1918, 1764, 1727, 1317, -41, -978, -388, 249, 87, -220, -583, -626, -544, -505, -550, 
-	-433, -219, -4, 331, 406, 154, -114, -8, 227, 175, -109, -271, -307, -364, -415, -451, 
-	-429, -338, -230, -189, -228, -259, -208, -90, 94, 228, 159, -27, -189, -285, -339, -380, 
-	-383, -350, -281, -144, -29, -34, -87, -134, -142, -106, -92, -69, -41, -78, -159, -204, 
-	-216, -235, -256, -263, -247, -216, -185, -149, -104, -92, -107, -80, -12, 23, 12, -26, 
-	-85, -125, -140, -148, -145, -125, -86, -37, -34, -64, -120, -175, -193, -182, -125, -84
-};
-
-static const short ugen_H_40e071a1c[] = { 
-	-57, 87, -135, 142, -204, 222, 36, 8755, 8072, -17442, -11494, 3084, 4003, 9157, 6216, 5278, 
-	13483, 22296, 3076, -13044, -12049, -4044, 4689, -2369, -10771, -11423, -4250, -1934, -1067, -171, 0, 1446, 
-	2067, 4184, 3215, 1990, 809, 1046, 1002, -1119, -2885, -3838, -2304, -1603, -1672, -1950, -267, 1116, 
-	898, 1054, 1120, 1191, 785, 750, 201, -600, -1337, -1501, -1256, -821, -284, -491, -89, 462, 
-	500, 44, -662, -651, -585, -373, -138, -171, -60, 286, 675, 547, 269, 121, -72, -482, 
-	-660, -386, -186, -248, -402, -342, -205, -76, 2, 37, 138, 329, 432, 412, 343, 293, 
-	127, -191, -412, -537, -602, -552, -319, -144, -17, 110, 159, 126, 28, -65, 0, -54, 
-	-53, 36, -90, -173, -191, -230, -328, -291, -209, -69, 131, 183, 119, 19, -81, -33
-};
-
-static const short ugen_H_40e077a0c[] = { 
-	0, 0, 0, 0, 0, 2, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-	0, 0, 2, 1, -1, -2, 0, 131, 569, 413, -199, -310, -362, -11, 598, 816, 
-	865, 1237, 1814, 1908, 1869, 1489, 554, 119, 377, 154, -323, -448, -604, -790, -832, -739, 
-	-743, -596, -325, -4, 230, 129, 108, 342, 569, 546, 213, -181, -369, -433, -548, -565, 
-	-481, -491, -473, -357, -244, -238, -234, -147, 0, 187, 228, 116, -32, -168, -282, -324, 
-	-317, -334, -299, -239, -159, -88, -110, -176, -221, -225, -187, -81, 31, 64, -16, -119, 
-	-182, -231, -262, -285, -290, -275, -251, -208, -167, -143, -115, -76, -9, 28, 33, 19, 
-	-13, -54, -124, -162, -149, -125, -111, -96, -82, -91, -113, -159, -198, -212, -196, -151
-};
-
-static const short ugen_H_40e077a1c[] = { 
-	-39, 75, -137, 165, -234, 253, 581, 11285, 3328, -20976, -6134, 4220, 4643, 8286, 4968, 7019, 
-	17600, 19653, -4366, -14924, -8812, 1990, 3979, -5655, -12009, -9701, -2365, -2374, -974, -606, -201, 1365, 
-	2758, 3932, 2439, 1444, 377, 1713, 955, -1155, -3180, -3249, -1617, -1661, -1934, -1878, 25, 794, 
-	774, 965, 1181, 1153, 785, 599, -27, -550, -1312, -1421, -1192, -783, -457, -587, 73, 513, 
-	447, -93, -547, -423, -464, -348, -239, -229, -32, 419, 676, 368, 116, 65, -167, -518, 
-	-526, -192, -102, -267, -391, -393, -287, -66, 17, 18, 150, 375, 483, 399, 319, 281, 
-	33, -242, -426, -482, -526, -556, -326, -131, 27, 139, 148, 108, 20, -40, -9, -55, 
-	-43, -15, -132, -169, -117, -226, -337, -269, -180, -4, 155, 166, 56, -66, -113, -22
-};
-
-static const short ugen_H_40e084a0c[] = { 
-	0, 0, 0, 2, 1, 3, 1, 0, 0, 0, -1, 0, 0, 0, 0, 2, 
-	2, 0, 5, 4, 2, -4, 0, 1, 207, 492, 173, -194, 49, 221, -98, -168, 
-	350, 886, 1527, 2158, 2179, 2085, 1949, 1030, 93, -120, -343, -617, -586, -670, -1047, -1059, 
-	-758, -643, -498, -229, -4, 82, 275, 664, 823, 649, 389, -10, -396, -503, -576, -701, 
-	-641, -513, -511, -476, -337, -226, -183, -137, -37, 77, 160, 161, 109, 6, -165, -279, 
-	-295, -282, -284, -271, -255, -224, -167, -179, -264, -313, -238, -74, 73, 151, 90, -54, 
-	-167, -223, -260, -297, -306, -289, -258, -239, -208, -162, -120, -67, -12, 39, 43, 40, 
-	22, -42, -110, -145, -141, -128, -117, -124, -120, -100, -108, -139, -188, -207, -197, -173
-};
-
-static const short ugen_H_40e084a1c[] = { 
-	-31, 67, -132, 171, -247, 273, 788, 12156, 1165, -21916, -3767, 4801, 4395, 7245, 4906, 8329, 
-	19236, 17370, -8145, -15353, -5482, 5001, 2773, -7244, -12191, -8191, -1930, -2891, -1102, -1256, -258, 1512, 
-	2893, 3663, 2222, 1037, 400, 2006, 781, -1142, -2952, -2658, -1430, -1562, -2090, -1878, 114, 575, 
-	459, 735, 1180, 1069, 836, 555, -81, -466, -1147, -1269, -1193, -835, -621, -607, 167, 536, 
-	456, -180, -520, -279, -318, -331, -321, -306, -37, 480, 602, 226, 47, 61, -152, -440, 
-	-403, -153, -153, -296, -337, -394, -369, -83, 39, 21, 114, 354, 509, 404, 355, 258, 
-	-23, -267, -454, -435, -473, -542, -355, -146, 32, 162, 170, 84, 2, -23, 2, -44, 
-	-77, -76, -145, -145, -64, -229, -391, -261, -110, 53, 156, 114, -2, -101, -113, -59
-};
-
-static const short ugen_H_40e090a0c[] = { 
-	0, 0, 0, 2, 2, 2, 1, 1, 0, 0, 0, -1, 0, 1, 1, 3, 
-	2, 1, 2, 5, 2, -1, -10, -3, 28, 248, 372, 308, 407, -46, -689, -596, 
-	65, 973, 1488, 1782, 2401, 2867, 2591, 1498, 73, -549, -433, -536, -867, -906, -865, -1083, 
-	-906, -455, -378, -364, -188, 22, 407, 818, 898, 717, 447, 97, -321, -630, -678, -678, 
-	-743, -670, -501, -405, -378, -266, -137, -116, -85, -12, 96, 187, 195, 69, -87, -169, 
-	-227, -235, -286, -326, -310, -303, -272, -254, -268, -303, -230, -69, 75, 156, 99, -36, 
-	-152, -192, -242, -285, -281, -271, -247, -256, -232, -167, -118, -74, -17, 35, 51, 51, 
-	15, -60, -119, -131, -135, -140, -127, -123, -113, -100, -110, -134, -158, -173, -188, -189
-};
-
-static const short ugen_H_40e090a1c[] = { 
-	-38, 79, -143, 191, -276, 324, 598, 12148, 1121, -22137, -3022, 5546, 3380, 6098, 5189, 9239, 
-	19622, 15690, -10251, -14974, -2056, 6662, 1516, -8327, -11606, -6938, -2054, -3317, -1540, -1872, -529, 1684, 
-	2879, 3215, 2253, 1041, 517, 2029, 764, -1236, -2658, -1776, -1240, -1737, -2071, -1740, -142, 293, 
-	146, 422, 1011, 1016, 897, 552, 43, -289, -967, -1089, -1109, -942, -793, -618, 201, 543, 
-	443, -142, -476, -231, -180, -316, -395, -432, -79, 521, 525, 109, 23, 110, -95, -320, 
-	-287, -150, -229, -325, -309, -376, -374, -113, -21, -23, 130, 384, 514, 408, 402, 273, 
-	-31, -281, -467, -425, -435, -479, -365, -178, 25, 159, 174, 74, 23, 0, 27, -18, 
-	-124, -106, -156, -157, -43, -190, -397, -236, -48, 71, 164, 101, -50, -140, -126, -52
-};
-
-static const short ugen_H_40e096a0c[] = { 
-	0, 0, 0, 0, 1, 1, 1, 0, 0, 0, -1, -2, -1, 0, 0, 0, 
-	2, 3, 2, -2, 0, -4, -3, -10, 5, 30, 489, 1039, 185, -896, -879, -309, 
-	444, 955, 1348, 1832, 2577, 3144, 2476, 1068, 216, -303, -699, -773, -990, -1253, -1043, -584, 
-	-587, -572, -122, 37, -178, -164, 312, 785, 881, 727, 449, 8, -346, -558, -761, -782, 
-	-700, -657, -578, -401, -264, -239, -194, -141, -100, -25, 109, 164, 115, 55, -23, -65, 
-	-110, -194, -307, -402, -398, -341, -320, -315, -275, -232, -165, -77, -2, 14, -29, -54, 
-	-67, -119, -207, -237, -214, -215, -245, -272, -249, -190, -115, -68, -40, 10, 41, 30, 
-	-30, -99, -143, -162, -151, -140, -125, -104, -89, -88, -96, -102, -121, -152, -199, -222
-};
-
-static const short ugen_H_40e096a1c[] = { 
-	-61, 117, -190, 241, -326, 410, -13, 10814, 4366, -21656, -5321, 6371, 2274, 5382, 5246, 9134, 
-	18835, 16275, -9342, -15066, -901, 7033, 1662, -8377, -11004, -6725, -2336, -3519, -1976, -2167, -1040, 1518, 
-	2589, 3199, 2341, 1224, 714, 2037, 881, -1206, -2452, -1561, -907, -1650, -2232, -1752, -278, 2, 
-	-146, 291, 799, 904, 931, 675, 191, -139, -742, -1033, -1062, -928, -901, -761, 179, 626, 
-	472, -108, -450, -234, -196, -362, -438, -438, -80, 494, 515, 118, 0, 87, -59, -229, 
-	-208, -158, -304, -355, -291, -377, -407, -158, -51, -59, 157, 434, 501, 390, 405, 304, 
-	18, -273, -488, -475, -437, -413, -327, -199, -19, 110, 159, 96, 72, 22, 10, -37, 
-	-136, -109, -178, -192, -51, -132, -346, -231, -62, 48, 160, 91, -58, -130, -110, -36
-};
-
-static const short ugen_H_40e103a0c[] = { 
-	2, 1, 1, 1, 3, 2, 2, 2, 1, 1, 0, 0, 0, 1, 0, 2, 
-	2, 6, 3, 1, -1, 0, -2, 2, 1, 238, 927, 547, -655, -939, -458, 321, 
-	832, 1032, 1302, 2266, 3096, 2305, 1171, 772, 357, -99, -547, -1164, -1299, -1065, -939, -657, 
-	-215, -78, -48, 290, 266, -145, -27, 521, 861, 685, 269, -120, -419, -536, -630, -728, 
-	-735, -612, -494, -396, -253, -183, -199, -158, -7, 76, 62, 28, 36, 63, 50, -13, 
-	-135, -230, -324, -369, -391, -374, -306, -263, -228, -189, -126, -119, -145, -142, -89, -25, 
-	-23, -74, -128, -130, -129, -170, -240, -278, -239, -167, -119, -83, -43, 9, 41, 6, 
-	-67, -138, -172, -171, -157, -136, -101, -60, -45, -48, -59, -66, -91, -140, -192, -234
-};
-
-static const short ugen_H_40e103a1c[] = { 
-	-87, 144, -207, 235, -303, 380, -414, 8012, 8954, -18915, -10141, 7020, 1628, 4312, 5098, 8446, 
-	17262, 17712, -5938, -15625, -1153, 7023, 2591, -7768, -10690, -6896, -2598, -3605, -2534, -2051, -1883, 1100, 
-	2243, 3135, 2648, 1451, 798, 2180, 1326, -1185, -2343, -1545, -802, -1482, -2132, -1957, -594, -24, 
-	-380, 9, 642, 825, 889, 817, 435, -22, -549, -932, -1017, -933, -896, -893, 6, 701, 
-	593, -38, -505, -291, -222, -399, -508, -437, -47, 462, 517, 154, 3, 77, -36, -139, 
-	-150, -166, -368, -408, -279, -382, -454, -215, -28, -56, 135, 449, 491, 380, 379, 344, 
-	110, -230, -489, -543, -429, -362, -295, -224, -68, 68, 120, 109, 88, 70, 7, -58, 
-	-149, -138, -189, -202, -50, -82, -264, -248, -110, 20, 122, 94, -11, -61, -84, -50
-};
-
-static const short ugen_H_40e109a0c[] = { 
-	2, 1, 1, 1, 3, 2, 2, 2, 1, 2, 1, 0, 3, 0, 0, 0, 
-	2, 1, 5, 2, 0, 2, -1, 7, 224, 1128, 612, -1181, -1185, -232, 606, 1066, 
-	1119, 1196, 2104, 3130, 2252, 647, -37, 19, 228, -7, -691, -1143, -1245, -973, -529, -404, 
-	-203, 332, 599, 515, 452, 116, -163, 78, 481, 460, 17, -295, -401, -487, -585, -625, 
-	-602, -556, -449, -306, -266, -191, -54, -34, 13, 74, 16, -78, -53, 41, 22, -100, 
-	-223, -277, -308, -311, -332, -320, -260, -237, -192, -173, -174, -208, -234, -200, -130, -66, 
-	-31, -28, -29, -25, -67, -140, -211, -262, -251, -175, -104, -91, -69, -10, 15, -19, 
-	-98, -174, -214, -202, -178, -120, -48, -12, -9, -26, -27, -37, -76, -133, -198, -236
-};
-
-static const short ugen_H_40e109a1c[] = { 
-	-62, 78, -96, 61, -57, 42, -141, 3497, 12637, -10491, -17475, 5570, 2568, 2099, 5153, 7035, 
-	14788, 18810, 888, -15480, -3586, 6803, 3855, -6272, -10511, -7449, -3182, -3226, -3526, -1632, -2254, 13, 
-	1821, 3068, 2998, 1856, 943, 1924, 2117, -674, -2398, -1943, -861, -1367, -2063, -1923, -1004, -207, 
-	-377, -184, 394, 756, 915, 871, 673, 199, -366, -857, -967, -917, -939, -968, -218, 563, 
-	622, 176, -422, -331, -231, -436, -583, -514, -61, 444, 507, 184, 27, 136, 21, -126, 
-	-176, -212, -382, -462, -326, -357, -437, -281, -24, -23, 64, 375, 491, 398, 351, 352, 
-	184, -153, -441, -576, -458, -372, -299, -245, -130, 33, 62, 110, 85, 115, 41, -76, 
-	-175, -212, -201, -195, -56, -38, -172, -267, -210, -43, 87, 117, 38, -18, -50, -72
-};
-
-static const short ugen_H_40e116a0c[] = { 
-	3, 2, 1, 3, 1, 2, 2, 2, 3, 2, 2, 2, 2, 0, 0, 0, 
-	1, 0, 7, -7, 9, -5, 15, 102, 1127, 1218, -1142, -1817, -683, 529, 1423, 1504, 
-	1377, 1951, 3361, 2799, 469, -648, -479, -411, -461, -493, -820, -985, -790, -498, -358, -104, 
-	216, 460, 829, 944, 572, 108, -135, -140, -80, -14, -28, -214, -458, -572, -541, -528, 
-	-476, -441, -385, -227, -126, -112, -63, 56, 105, 8, -98, -123, -87, -60, -116, -228, 
-	-275, -258, -224, -261, -333, -270, -213, -238, -226, -165, -133, -197, -259, -244, -169, -94, 
-	-51, -23, 15, 16, -37, -99, -185, -244, -241, -189, -116, -66, -48, -55, -54, -55, 
-	-105, -178, -227, -217, -171, -103, -35, 7, 10, -2, -6, -34, -73, -117, -189, -230
-};
-
-static const short ugen_H_40e116a1c[] = { 
-	17, -49, 83, -154, 205, -280, 337, 372, 11068, 1152, -20588, -1052, 5519, -365, 4688, 6185, 
-	11916, 18280, 8058, -12375, -7419, 5977, 5073, -4249, -10265, -7990, -4116, -2818, -4291, -1948, -1652, -840, 
-	1245, 2535, 3422, 2386, 1256, 1477, 2520, 275, -2152, -2387, -1353, -1222, -2031, -1991, -1237, -317, 
-	-347, -318, 341, 694, 883, 880, 794, 407, -159, -662, -1012, -891, -858, -1046, -509, 379, 
-	622, 332, -259, -339, -214, -437, -606, -590, -152, 431, 547, 292, 69, 142, 92, -132, 
-	-203, -290, -402, -437, -358, -340, -378, -287, -53, 15, 26, 271, 477, 440, 364, 327, 
-	221, -49, -346, -550, -513, -401, -339, -239, -146, 22, 28, 85, 124, 138, 103, -83, 
-	-199, -242, -207, -168, -74, -10, -82, -237, -274, -109, 59, 109, 64, 23, 13, -55
-};
-
-static const short ugen_H_40e122a0c[] = { 
-	2, 2, 2, 2, 1, 1, 2, 2, 2, 3, 2, 5, 3, 0, -4, 4, 
-	-5, 9, -13, 8, -15, 23, 50, 1170, 1773, -1146, -2417, -971, 408, 1553, 1797, 1737, 
-	2210, 3960, 3529, 366, -1208, -1036, -975, -1045, -1218, -1525, -1131, -556, -196, 58, 134, 400, 
-	738, 881, 999, 897, 605, 206, -227, -418, -534, -440, -214, -227, -474, -590, -534, -464, 
-	-381, -186, -31, -98, -118, -45, 54, 136, 34, -161, -229, -167, -103, -166, -316, -338, 
-	-263, -199, -217, -339, -355, -271, -193, -147, -123, -79, -78, -170, -273, -321, -249, -121, 
-	-54, -18, 12, 2, -18, -66, -164, -219, -225, -180, -96, -20, -31, -123, -153, -120, 
-	-116, -153, -201, -205, -151, -92, -47, -8, 13, 17, 8, -37, -74, -115, -178, -219
-};
-
-static const short ugen_H_40e122a1c[] = { 
-	52, -83, 98, -121, 106, -117, 144, -243, 4372, 10994, -11840, -13938, 6145, 550, 1065, 6111, 
-	8825, 15292, 14353, -3439, -11194, 2254, 6970, -1169, -9617, -9121, -5161, -2924, -4202, -3592, -988, -1051, 
-	744, 1980, 3108, 3030, 2050, 1385, 2136, 1480, -1425, -2517, -2054, -1427, -1937, -2235, -1619, -544, 
-	-57, -346, 102, 741, 872, 832, 849, 685, 27, -355, -796, -1035, -875, -1064, -796, 53, 
-	569, 489, -84, -386, -199, -343, -571, -650, -310, 379, 573, 417, 198, 85, 106, -123, 
-	-269, -319, -448, -461, -385, -316, -272, -261, -128, 23, 27, 190, 437, 452, 352, 296, 
-	221, 52, -234, -522, -591, -455, -369, -258, -156, -12, 65, 51, 135, 145, 133, -14, 
-	-214, -275, -234, -157, -101, -33, -22, -163, -272, -189, -37, 69, 73, 42, 75, 14
-};
-
-static const short ugen_H_40e129a0c[] = { 
-	2, 1, 1, 1, 1, 2, 2, 2, 2, 1, 6, 3, 5, -3, 6, -6, 
-	10, -7, 1, -10, 12, 0, 838, 2411, -412, -3107, -1474, 156, 1554, 1999, 1944, 2208, 
-	4123, 4751, 1080, -1597, -1432, -1180, -1406, -1657, -2072, -1867, -1218, -389, 197, 301, 746, 1096, 
-	1167, 1268, 1163, 563, 273, 346, -1, -690, -961, -700, -489, -363, -371, -569, -576, -257, 
-	2, 51, 17, -18, -7, 47, 137, 32, -267, -309, -156, -104, -170, -271, -363, -344, 
-	-261, -275, -452, -499, -291, -135, -60, -5, 24, 28, -53, -203, -331, -395, -316, -169, 
-	-43, 24, -2, -36, -25, -42, -128, -212, -221, -128, -9, 8, -85, -178, -189, -158, 
-	-132, -128, -177, -185, -129, -67, -44, -39, -8, 24, 25, -18, -78, -143, -173, -203
-};
-
-static const short ugen_H_40e129a1c[] = { 
-	-7, 26, -56, 79, -141, 180, -245, 297, 188, 9365, 2974, -17826, -2879, 5076, -1671, 3988, 
-	7421, 11640, 15859, 6061, -9032, -3552, 6561, 2718, -7031, -10830, -6798, -3390, -3403, -4729, -1931, -506, 
-	69, 1821, 2929, 3318, 2335, 1773, 1836, 2088, -339, -2460, -2373, -1783, -1821, -2404, -2094, -1032, 
-	-13, -32, -114, 576, 925, 898, 850, 875, 343, -279, -546, -1027, -904, -987, -1006, -262, 
-	367, 526, 118, -371, -328, -301, -453, -517, -403, 206, 544, 473, 333, 110, 60, -89, 
-	-327, -386, -484, -484, -358, -330, -248, -197, -163, 6, 77, 162, 352, 450, 355, 217, 
-	159, 87, -125, -464, -623, -513, -382, -288, -159, -60, 76, 81, 101, 174, 127, 38, 
-	-169, -304, -277, -166, -111, -104, -42, -93, -214, -213, -133, -10, 68, 45, 66, 61
-};
-
-static const short ugen_H_40e135a0c[] = { 
-	2, 1, 0, 0, 1, 0, 0, 2, 0, 5, 3, 7, 0, 3, 0, 0, 
-	7, -8, 5, -17, 22, 426, 2727, 800, -3694, -2278, -49, 1510, 2264, 2123, 2250, 4010, 
-	5864, 2263, -1815, -1888, -1349, -1710, -1884, -2357, -2480, -1758, -1039, -237, 200, 734, 1337, 1559, 
-	1652, 1470, 812, 470, 431, 289, -198, -878, -1116, -971, -786, -644, -459, -260, -87, -16, 
-	141, 217, 125, 61, 17, 38, -15, -246, -364, -286, -113, -32, -168, -356, -397, -372, 
-	-427, -581, -639, -418, -152, 36, 150, 170, 137, 40, -104, -258, -423, -485, -362, -181, 
-	-32, 5, -32, -18, 0, -39, -131, -206, -162, -49, 11, -32, -138, -189, -180, -184, 
-	-178, -159, -147, -138, -131, -93, -45, -23, 9, 37, 3, -45, -108, -158, -171, -204
-};
-
-static const short ugen_H_40e135a1c[] = { 
-	-18, 33, -37, 24, -23, -10, 27, -56, 14, 1859, 10263, -3825, -15379, 1507, 1996, -625, 
-	5645, 8147, 12541, 13570, 914, -6989, 1746, 5201, -2001, -9411, -9456, -5645, -3659, -3929, -3609, -976, 
-	-121, 1124, 2489, 3597, 3333, 2052, 1499, 1909, 1510, -1387, -2732, -2227, -1837, -2178, -2508, -1858, 
-	-664, 103, 2, 273, 868, 1029, 1025, 912, 727, -39, -372, -712, -966, -810, -1094, -704, 
-	-21, 390, 289, -183, -377, -295, -343, -398, -396, -61, 484, 471, 400, 285, 63, -33, 
-	-342, -489, -507, -537, -351, -269, -260, -154, -138, -53, 112, 207, 284, 344, 350, 206, 
-	34, -6, -19, -248, -546, -581, -446, -328, -173, -69, 10, 124, 117, 183, 177, 58, 
-	-92, -283, -314, -197, -107, -145, -130, -90, -137, -165, -186, -121, 36, 67, 40, 89
-};
-
-static const short ugen_H_40e141a0c[] = { 
-	2, 0, 0, 0, 0, 1, 0, 0, 4, 3, 9, 1, 1, 5, -6, 18, 
-	-21, 35, -44, 61, 250, 3061, 1695, -4550, -3042, -7, 1595, 2755, 2460, 2477, 4127, 6831, 
-	3079, -2237, -2399, -1517, -2036, -2275, -2644, -2963, -2255, -1401, -379, -12, 399, 1251, 1780, 1845, 
-	1813, 1241, 638, 634, 452, -140, -757, -841, -1015, -1359, -1167, -629, -211, 130, 306, 386, 
-	396, 260, 123, -28, -77, -26, -304, -536, -323, -51, 22, -98, -290, -445, -550, -583, 
-	-615, -710, -542, -165, 109, 277, 296, 229, 127, -53, -227, -404, -522, -450, -321, -217, 
-	-107, -16, 42, 41, -2, -43, -94, -102, -70, -76, -97, -82, -81, -133, -220, -246, 
-	-198, -140, -133, -179, -184, -96, 5, 60, 81, 30, -39, -93, -150, -190, -216, -224
-};
-
-static const short ugen_H_40e141a1c[] = { 
-	21, -32, 51, -71, 81, -112, 119, -146, 182, -240, 4506, 8547, -9587, -10485, 2740, -187, 
-	1783, 6635, 8938, 12843, 9971, -1985, -2886, 3831, 1559, -5598, -10051, -7784, -4715, -4143, -4329, -2104, 
-	33, 359, 1688, 3089, 3909, 2920, 2015, 1551, 1608, 328, -1917, -2333, -2119, -2182, -2478, -2317, 
-	-1455, -416, 7, 102, 707, 1025, 1109, 1056, 911, 376, -246, -386, -869, -831, -948, -959, 
-	-366, 92, 271, 45, -220, -336, -343, -393, -364, -242, 274, 524, 383, 411, 189, -10, 
-	-251, -531, -550, -570, -410, -227, -246, -147, -83, -132, 5, 195, 298, 294, 271, 185, 
-	15, -53, -17, -115, -401, -569, -502, -353, -226, -105, -39, 90, 161, 145, 189, 108, 
-	-31, -197, -319, -246, -133, -143, -185, -139, -142, -143, -158, -194, -52, 81, 76, 76
-};
-
-static const short ugen_H_40e148a0c[] = { 
-	2, 0, 0, 0, 0, 1, 0, 2, 7, 5, 12, -3, 19, -18, 34, -37, 
-	56, -54, 90, 14, 2705, 3454, -4507, -4672, -35, 1344, 3071, 2844, 2755, 3951, 7323, 4662, 
-	-2103, -3074, -1643, -2138, -2655, -2762, -3418, -2685, -1801, -703, 13, 271, 999, 1544, 1969, 2108, 
-	1569, 840, 737, 509, 3, -745, -1065, -880, -921, -1096, -1064, -615, 13, 464, 648, 637, 
-	386, 104, 28, -16, -24, -247, -581, -492, -169, 52, -17, -303, -515, -549, -530, -586, 
-	-752, -620, -182, 150, 306, 332, 282, 169, -17, -222, -370, -486, -496, -388, -295, -188, 
-	-84, 7, 79, 59, 24, -14, -22, 0, -62, -171, -159, -75, -54, -135, -227, -226, 
-	-169, -141, -189, -239, -182, -57, 63, 159, 139, 24, -77, -140, -178, -206, -231, -246
-};
-
-static const short ugen_H_40e148a1c[] = { 
-	3, 7, -13, 28, -53, 69, -112, 141, -193, 241, -8, 6698, 4934, -11799, -6074, 1637, 
-	-431, 3896, 6951, 9427, 12427, 6632, -2240, 660, 2983, -2048, -7670, -9354, -6421, -4356, -4176, -3932, 
-	-1314, 436, 1099, 2092, 3349, 3809, 2651, 1897, 1666, 1377, -595, -2136, -2004, -2019, -2392, -2596, 
-	-2119, -1129, -257, -49, 250, 889, 1143, 1227, 1031, 681, 22, -247, -503, -789, -767, -1009, 
-	-663, -131, 183, 111, -89, -251, -362, -393, -407, -365, -68, 452, 437, 392, 361, 102, 
-	-86, -391, -541, -563, -499, -297, -245, -215, -79, -100, -112, 39, 207, 326, 263, 145, 
-	63, -1, -36, -81, -249, -467, -523, -397, -255, -144, -84, -27, 104, 141, 153, 161, 
-	43, -94, -215, -258, -193, -163, -205, -190, -163, -160, -143, -191, -137, 21, 105, 92
-};
-
-static const short ugen_H_40e154a0c[] = { 
-	0, 0, -2, 0, 0, -2, 0, 7, 0, 13, -11, 22, -24, 41, -43, 59, 
-	-52, 95, -35, 2665, 4618, -4762, -6248, 141, 1482, 3341, 3323, 3112, 4355, 7959, 5585, -2262, 
-	-3864, -1966, -2172, -3136, -3111, -3686, -3179, -2065, -794, -8, 73, 938, 1775, 2119, 2137, 1785, 
-	951, 785, 646, -151, -1068, -1249, -887, -925, -941, -702, -471, -219, 217, 625, 742, 601, 
-	273, 77, -1, 88, -47, -605, -658, -294, -61, -153, -385, -511, -515, -522, -538, -613, 
-	-598, -208, 179, 401, 467, 316, 115, -90, -258, -397, -541, -575, -473, -313, -187, -76, 
-	8, 64, 81, 82, 59, 28, 55, 13, -117, -197, -183, -132, -126, -152, -180, -191, 
-	-176, -192, -247, -239, -118, 21, 146, 200, 115, -17, -119, -177, -209, -225, -231, -241
-};
-
-static const short ugen_H_40e154a1c[] = { 
-	0, 8, 0, -1, 12, -31, 47, -83, 110, -156, 192, 234, 6825, 3636, -10927, -5334, 
-	626, -29, 4483, 7161, 9023, 11259, 6137, -468, 1293, 937, -3631, -8178, -8646, -5222, -4139, -4444, 
-	-3396, -919, 339, 1203, 2339, 3446, 3491, 2610, 2171, 1631, 1080, -571, -1912, -2077, -2168, -2308, 
-	-2432, -1997, -1091, -244, 73, 497, 916, 1029, 1097, 864, 391, -121, -180, -399, -538, -724, 
-	-852, -393, -44, 138, 23, -145, -361, -463, -429, -415, -343, 14, 385, 365, 455, 354, 
-	125, -61, -333, -466, -582, -543, -399, -328, -178, -70, -118, -79, 42, 232, 296, 171, 
-	129, 111, 23, -56, -163, -331, -458, -429, -280, -189, -150, -129, -63, 74, 132, 126, 
-	127, 44, -47, -150, -204, -192, -208, -215, -211, -184, -162, -157, -163, -98, 56, 122
-};
-
-static const short ugen_H_40e161a0c[] = { 
-	0, -1, 0, 0, -1, -1, 9, -2, 16, -14, 24, -26, 33, -29, 28, -19, 
-	49, -25, 1954, 5823, -3221, -8349, -652, 1727, 3392, 3801, 3332, 4457, 8070, 7039, -1344, -4490, 
-	-2560, -2247, -3424, -3371, -3977, -3600, -2363, -1281, -162, 158, 1023, 1771, 2292, 2356, 1915, 978, 
-	727, 611, -123, -874, -1396, -1206, -1075, -954, -684, -328, 9, 104, 275, 596, 732, 447, 
-	265, 151, 72, 103, -409, -777, -565, -239, -126, -266, -473, -576, -541, -493, -528, -614, 
-	-317, 134, 409, 551, 425, 148, -91, -248, -384, -573, -689, -620, -414, -193, -57, -30, 
-	35, 108, 143, 132, 61, 61, 69, -36, -174, -223, -218, -202, -164, -146, -167, -183, 
-	-206, -266, -260, -139, -16, 97, 178, 146, 39, -57, -148, -226, -238, -210, -202, -223
-};
-
-static const short ugen_H_40e161a1c[] = { 
-	3, -3, 15, -9, 12, -10, 0, 7, -33, 46, -81, 84, 853, 7309, 1242, -10676, 
-	-4152, 216, 865, 5225, 7298, 8874, 10069, 5302, 952, 888, -1415, -4956, -8146, -7162, -4267, -4286, 
-	-4475, -2855, -459, 581, 1205, 2245, 3444, 3363, 2635, 2146, 1483, 788, -786, -1678, -1953, -2381, 
-	-2492, -2275, -1536, -612, -96, 33, 550, 913, 873, 746, 558, 200, -31, -103, -303, -451, 
-	-748, -609, -203, 47, 108, -74, -295, -493, -527, -490, -414, -298, 76, 303, 393, 523, 
-	346, 141, -112, -311, -530, -699, -634, -513, -335, -142, -90, -126, -33, 106, 251, 229, 
-	147, 172, 113, -13, -154, -299, -392, -410, -320, -221, -202, -185, -161, -94, 27, 68, 
-	88, 122, 56, -36, -120, -179, -208, -227, -258, -245, -216, -192, -160, -149, -78, 39
-};
-
-static const short ugen_H_40e167a0c[] = { 
-	-3, 0, 0, -2, -4, 9, -4, 16, -16, 22, -25, 27, -27, 19, -13, 36, 
-	-14, 1968, 6448, -2913, -9528, -1295, 1880, 3915, 4449, 3615, 5013, 8374, 7352, -732, -4620, -3425, 
-	-2730, -3661, -3481, -4267, -4405, -2769, -1278, -5, 205, 1123, 2082, 2621, 2577, 2047, 910, 486, 
-	555, -180, -937, -1501, -1378, -1230, -1087, -713, -348, -16, 228, 461, 546, 604, 384, 197, 
-	299, 274, 190, -404, -920, -619, -142, -2, -165, -414, -538, -527, -563, -581, -620, -382, 
-	88, 383, 560, 561, 306, -52, -304, -421, -552, -697, -690, -502, -280, -99, -43, 14, 
-	92, 157, 197, 183, 180, 101, -51, -163, -220, -256, -263, -222, -137, -125, -189, -233, 
-	-262, -252, -151, -23, 92, 176, 163, 67, -43, -140, -209, -226, -215, -193, -198, -204
-};
-
-static const short ugen_H_40e167a1c[] = { 
-	-8, 6, -3, 12, -6, 7, -7, -2, 5, -31, 39, -67, 75, 822, 6825, 1714, 
-	-10121, -4889, 181, 1540, 5594, 6686, 7825, 9247, 6117, 1881, -201, -2544, -5156, -7236, -6042, -4004, 
-	-4477, -4322, -2694, -488, 632, 1144, 2187, 3218, 3157, 2576, 2116, 1390, 811, -543, -1545, -1955, 
-	-2221, -2163, -2007, -1407, -619, -75, 194, 504, 678, 703, 735, 530, 102, -78, -147, -196, 
-	-408, -637, -380, -54, 87, 50, -98, -364, -570, -576, -483, -396, -301, -1, 237, 480, 
-	597, 387, 112, -143, -335, -596, -724, -696, -566, -333, -133, -106, -84, 63, 182, 274, 
-	275, 221, 153, 39, -95, -261, -362, -329, -262, -209, -186, -200, -204, -211, -151, -27, 
-	12, 85, 180, 130, 40, -55, -175, -204, -228, -271, -257, -230, -177, -127, -132, -78
-};
-
-static const short ugen_H_40e174a0c[] = { 
-	-2, 0, 0, -4, 8, -3, 15, -10, 17, -15, 13, -7, -6, 12, -7, 30, 
-	1430, 6695, -872, -10283, -2896, 1530, 3711, 5395, 4164, 5152, 8022, 7761, 864, -3868, -4082, -3613, 
-	-3947, -3685, -4266, -4911, -3382, -1692, 9, 531, 1098, 2041, 2764, 2696, 2179, 1342, 659, 490, 
-	-330, -1007, -1509, -1551, -1387, -1258, -964, -577, -28, 286, 567, 742, 729, 403, 10, 110, 
-	131, 96, -218, -694, -602, -171, 90, 11, -172, -419, -533, -614, -648, -644, -550, -110, 
-	275, 518, 628, 472, 113, -224, -379, -568, -718, -705, -536, -332, -165, -92, -56, 62, 
-	135, 210, 253, 227, 143, -1, -127, -208, -263, -284, -240, -150, -133, -196, -247, -250, 
-	-233, -175, -73, 51, 192, 200, 102, -14, -126, -191, -229, -229, -205, -188, -184, -189
-};
-
-static const short ugen_H_40e174a1c[] = { 
-	-2, -7, 7, -4, 15, -9, 12, -14, 7, -8, -11, 12, -25, 29, 1252, 6948, 
-	320, -10292, -4168, 490, 2575, 6112, 6118, 6890, 8522, 6420, 1742, -1367, -3475, -5185, -6249, -4895, 
-	-3982, -4917, -4033, -2189, -270, 730, 1379, 2179, 2975, 2931, 2432, 1902, 1151, 629, -558, -1305, 
-	-1758, -2063, -1991, -1780, -1221, -597, -124, 207, 587, 814, 842, 706, 259, -41, -158, -253, 
-	-193, -413, -508, -226, 38, 91, 11, -164, -404, -521, -572, -545, -535, -356, 26, 334, 
-	577, 562, 331, 26, -193, -415, -705, -778, -695, -475, -259, -145, -128, 0, 167, 242, 
-	301, 267, 180, 75, -67, -212, -314, -296, -211, -179, -172, -204, -242, -253, -231, -153, 
-	-57, 6, 125, 212, 148, 74, -79, -209, -215, -254, -256, -235, -225, -172, -122, -106
-};
-
-static const short ugen_H_40e180a0c[] = { 
-	0, 0, -7, 6, -1, 13, -6, 9, -6, 0, 6, -25, 31, -41, 64, 990, 
-	6578, 1020, -10229, -4485, 951, 2996, 5917, 5229, 5640, 7787, 7513, 2232, -2629, -4059, -4302, -4973, 
-	-4205, -3913, -5101, -4162, -2061, 98, 720, 987, 1970, 2837, 2821, 2411, 1692, 816, 590, -209, 
-	-1049, -1712, -1783, -1568, -1584, -1219, -626, -98, 228, 587, 819, 874, 716, 128, -195, -205, 
-	-62, -60, -517, -579, -179, 144, 111, -49, -262, -427, -541, -646, -656, -639, -340, 112, 
-	462, 666, 563, 234, -96, -264, -480, -736, -791, -630, -375, -207, -119, -83, 27, 143, 
-	233, 270, 242, 167, 35, -105, -219, -264, -241, -207, -173, -174, -227, -251, -233, -226, 
-	-177, -83, 16, 154, 215, 149, 41, -104, -187, -212, -258, -244, -206, -182, -149, -149
-};
-
-static const short ugen_H_40e180a1c[] = { 
-	0, 0, -7, 6, -1, 13, -6, 9, -6, 0, 6, -25, 31, -41, 64, 990, 
-	6578, 1020, -10229, -4485, 951, 2996, 5917, 5229, 5640, 7787, 7513, 2232, -2629, -4059, -4302, -4973, 
-	-4205, -3913, -5101, -4162, -2061, 98, 720, 987, 1970, 2837, 2821, 2411, 1692, 816, 590, -209, 
-	-1049, -1712, -1783, -1568, -1584, -1219, -626, -98, 228, 587, 819, 874, 716, 128, -195, -205, 
-	-62, -60, -517, -579, -179, 144, 111, -49, -262, -427, -541, -646, -656, -639, -340, 112, 
-	462, 666, 563, 234, -96, -264, -480, -736, -791, -630, -375, -207, -119, -83, 27, 143, 
-	233, 270, 242, 167, 35, -105, -219, -264, -241, -207, -173, -174, -227, -251, -233, -226, 
-	-177, -83, 16, 154, 215, 149, 41, -104, -187, -212, -258, -244, -206, -182, -149, -149
-};
-
-static const short ugen_H0e000a0c[] = { 
-	4, -5, 18, -23, 38, -55, 73, -100, 119, -136, 160, 29, 5320, 6065, -6761, -252, 
-	194, -5128, 7284, 5985, 2331, 11784, 11068, -6535, -5108, 4538, -8166, -13538, -2025, -1364, -7335, -1276, 
-	3011, 79, 1083, 4211, 3285, 1358, 2466, 1542, -904, -190, 1214, -586, -1696, -1096, -1234, -2134, 
-	-2710, -2421, -2045, -1330, -252, 113, 193, 680, 1309, 1374, 928, 695, 552, 150, -243, -224, 
-	-473, -818, -698, -735, -920, -735, -541, -604, -446, -72, 75, 156, 351, 548, 418, 111, 
-	-33, -5, -103, -305, -272, -310, -394, -291, -164, -174, -146, -4, -59, -245, -135, 58, 
-	56, 15, 35, -36, -144, -118, -152, -194, -178, -215, -239, -127, 24, 73, 11, -43, 
-	-32, -94, -201, -184, -157, -191, -161, -82, -50, -26, -20, -52, -57, -37, -55, -57
-};
-
-static const short ugen_H0e000a1c[] = { 
-	4, -5, 18, -23, 38, -55, 73, -100, 119, -136, 160, 29, 5320, 6065, -6761, -252, 
-	194, -5128, 7284, 5985, 2331, 11784, 11068, -6535, -5108, 4538, -8166, -13538, -2025, -1364, -7335, -1276, 
-	3011, 79, 1083, 4211, 3285, 1358, 2466, 1542, -904, -190, 1214, -586, -1696, -1096, -1234, -2134, 
-	-2710, -2421, -2045, -1330, -252, 113, 193, 680, 1309, 1374, 928, 695, 552, 150, -243, -224, 
-	-473, -818, -698, -735, -920, -735, -541, -604, -446, -72, 75, 156, 351, 548, 418, 111, 
-	-33, -5, -103, -305, -272, -310, -394, -291, -164, -174, -146, -4, -59, -245, -135, 58, 
-	56, 15, 35, -36, -144, -118, -152, -194, -178, -215, -239, -127, 24, 73, 11, -43, 
-	-32, -94, -201, -184, -157, -191, -161, -82, -50, -26, -20, -52, -57, -37, -55, -57
-};
-
-static const short ugen_H0e005a0c[] = { 
-	0, 3, 0, 8, -16, 30, -47, 58, -81, 99, -119, 143, 123, 5028, 4986, -5783, 
-	202, -164, -4326, 6300, 5303, 2583, 10534, 9883, -5042, -4164, 3341, -7204, -11683, -2270, -1534, -6310, 
-	-1338, 2339, 227, 890, 3387, 2859, 1252, 2101, 1664, -450, -166, 1227, -109, -1536, -1188, -1188, 
-	-2284, -2651, -1954, -1616, -1235, -237, 344, 376, 409, 785, 1061, 740, 423, 341, 103, -202, 
-	-241, -468, -758, -661, -637, -837, -689, -431, -430, -323, -4, 166, 208, 307, 380, 276, 
-	39, -123, -102, -182, -293, -199, -213, -304, -226, -112, -175, -158, -39, -95, -218, -114, 
-	41, 4, -33, -13, -87, -151, -119, -119, -144, -151, -184, -185, -88, 9, 70, 36, 
-	-19, -41, -112, -199, -189, -171, -204, -173, -106, -83, -74, -49, -50, -53, -42, -27
-};
-
-static const short ugen_H0e005a1c[] = { 
-	-8, 27, -32, 49, -67, 75, -94, 96, -102, 116, -76, 4474, 8318, -6511, -2470, 1693, 
-	-6345, 6854, 7571, 1716, 11668, 13631, -6062, -7854, 5528, -6588, -15650, -3316, -261, -7886, -2623, 3605, 
-	260, 480, 4498, 4181, 1485, 2646, 2100, -1006, -711, 1127, -438, -1752, -1113, -1139, -2032, -2691, 
-	-2746, -2571, -1743, -610, -247, 159, 1122, 1600, 1605, 1175, 900, 741, 342, -143, -240, -428, 
-	-820, -734, -737, -991, -841, -633, -687, -585, -195, -11, 68, 323, 551, 530, 253, 69, 
-	53, -34, -277, -230, -245, -478, -429, -217, -217, -205, -33, -39, -243, -147, 120, 102, 
-	40, 65, 14, -108, -85, -143, -235, -209, -253, -290, -199, -31, 57, 16, -42, -48, 
-	-68, -174, -165, -131, -193, -159, -90, -45, -15, 19, -12, -55, -34, -55, -78, -53
-};
-
-static const short ugen_H0e010a0c[] = { 
-	-4, 3, 0, 0, 9, -13, 22, -32, 44, -64, 81, -99, 124, 240, 4832, 3890, 
-	-4976, 549, -573, -3423, 5603, 4721, 2825, 9637, 8662, -4176, -3421, 2432, -6437, -10179, -2217, -1610, 
-	-5552, -1206, 1917, 216, 616, 2910, 2498, 1047, 2058, 1741, -260, -85, 1060, -57, -1213, -1102, 
-	-1374, -2286, -2277, -1603, -1465, -1061, -161, 407, 516, 386, 405, 558, 470, 300, 181, -87, 
-	-224, -190, -487, -758, -603, -590, -725, -525, -252, -234, -158, 76, 171, 195, 197, 228, 
-	135, -40, -157, -178, -236, -296, -144, -136, -244, -217, -119, -121, -146, -72, -113, -200, 
-	-100, 27, 6, -59, -49, -95, -155, -126, -129, -150, -138, -141, -156, -93, 21, 85, 
-	38, -36, -66, -114, -172, -165, -190, -227, -190, -131, -100, -81, -55, -67, -54, -24
-};
-
-static const short ugen_H0e010a1c[] = { 
-	29, -34, 46, -50, 56, -63, 41, -12, 0, -18, 3351, 10247, -5106, -5416, 2919, -7064, 
-	5976, 9293, 1283, 11547, 15886, -4950, -10579, 5573, -4913, -16852, -4780, 270, -7836, -3813, 3713, 528, 
-	49, 4281, 4958, 1898, 2761, 2695, -789, -1626, 783, 415, -1761, -1377, -1041, -2019, -2776, -2908, 
-	-2986, -2389, -1197, -281, 466, 1280, 1725, 1920, 1514, 1066, 797, 406, -39, -142, -376, -879, 
-	-781, -705, -1031, -937, -657, -782, -743, -278, -41, 43, 272, 533, 608, 380, 133, 48, 
-	-5, -215, -201, -225, -447, -449, -309, -309, -317, -103, -42, -200, -127, 146, 189, 114, 
-	115, 42, -107, -105, -119, -218, -236, -277, -350, -273, -99, 17, 3, -68, -56, -58, 
-	-132, -129, -102, -172, -171, -95, -59, -16, 43, 9, -45, -39, -63, -85, -54, -82
-};
-
-static const short ugen_H0e015a0c[] = { 
-	0, -3, 2, 0, 0, 3, -5, 14, -27, 36, -52, 60, -76, 102, 295, 4435, 
-	3254, -4256, 614, -605, -2883, 4960, 4284, 2776, 8718, 7844, -3381, -2994, 2062, -5556, -8959, -2126, 
-	-1589, -4953, -1250, 1530, -22, 385, 2553, 2110, 1100, 2128, 1719, -152, 0, 885, -122, -906, 
-	-916, -1406, -2025, -1988, -1602, -1330, -842, -98, 317, 380, 265, 246, 276, 194, 118, 13, 
-	-126, -233, -225, -408, -685, -579, -489, -515, -302, -125, -134, -97, 52, 121, 94, 105, 
-	144, 67, -109, -203, -177, -245, -268, -155, -138, -210, -161, -87, -141, -138, -90, -120, 
-	-192, -85, 36, 4, -29, -61, -125, -178, -153, -159, -157, -108, -120, -120, -67, 13, 
-	48, 0, -53, -79, -93, -139, -164, -199, -239, -186, -132, -114, -92, -64, -59, -59
-};
-
-static const short ugen_H0e015a1c[] = { 
-	-8, 23, -27, 8, 14, -67, 113, -158, 156, 1905, 11330, -1595, -9066, 3307, -6515, 3498, 
-	11411, 1367, 10569, 18209, -2315, -13402, 4332, -2414, -17789, -6711, 949, -7502, -5273, 3877, 867, -534, 
-	3843, 5523, 2371, 2761, 3567, -816, -2582, 926, 1212, -1737, -1317, -1048, -2273, -2833, -2871, -3654, 
-	-3382, -1394, 133, 667, 1144, 1742, 2269, 1892, 1211, 845, 472, -18, -143, -287, -840, -835, 
-	-739, -1064, -969, -625, -833, -860, -362, -44, 18, 229, 543, 682, 425, 129, 83, 70, 
-	-182, -210, -178, -445, -481, -349, -392, -406, -129, -10, -176, -165, 166, 281, 206, 156, 
-	60, -83, -88, -102, -250, -258, -291, -390, -342, -149, 8, 7, -84, -98, -45, -108, 
-	-125, -51, -129, -162, -107, -62, -25, 34, 24, -43, -51, -57, -82, -57, -59, -55
-};
-
-static const short ugen_H0e020a0c[] = { 
-	0, -2, -2, 4, -1, 0, 3, -3, 12, -21, 32, -43, 49, -58, 84, 295, 
-	3965, 2876, -3621, 603, -553, -2446, 4343, 3826, 2659, 7780, 7256, -2614, -2612, 1903, -4637, -7874, 
-	-2070, -1515, -4535, -1343, 1055, -249, 280, 2155, 1990, 1252, 2002, 1655, -3, 34, 758, -61, 
-	-703, -717, -1232, -1857, -1889, -1505, -1125, -737, -243, -5, 140, 287, 230, 34, -68, -31, 
-	1, -89, -226, -235, -325, -477, -438, -420, -375, -204, -115, -129, -117, 10, 79, 68, 
-	64, 70, -11, -141, -205, -164, -198, -261, -179, -137, -180, -158, -100, -138, -146, -69, 
-	-73, -152, -82, 36, 8, -62, -68, -134, -194, -170, -154, -132, -103, -95, -103, -73, 
-	-24, -2, -22, -60, -49, -76, -134, -150, -169, -188, -183, -134, -119, -100, -73, -74
-};
-
-static const short ugen_H0e020a1c[] = { 
-	-12, 29, -52, 83, -157, 219, -276, 309, 641, 10738, 3683, -11621, 1256, -4218, 329, 12240, 
-	2625, 9367, 19369, 1872, -14619, 1030, 169, -17050, -9849, 649, -5505, -7084, 3038, 2131, -953, 2822, 
-	5675, 3407, 2478, 3580, -426, -2622, 624, 1730, -1078, -1517, -1024, -2174, -3055, -3209, -4327, -4291, 
-	-1290, 844, 416, 856, 2000, 2549, 2080, 1234, 930, 627, 59, -204, -323, -824, -838, -738, 
-	-1121, -1055, -628, -748, -902, -421, -17, -39, 187, 560, 703, 452, 167, 39, 67, -69, 
-	-173, -162, -471, -586, -458, -399, -382, -155, -2, -150, -188, 124, 334, 278, 198, 97, 
-	-56, -86, -106, -243, -290, -316, -444, -432, -199, 7, 51, -64, -106, -81, -116, -124, 
-	-60, -101, -153, -85, -60, -43, 14, 6, -59, -90, -73, -63, -14, -11, -46, 11
-};
-
-static const short ugen_H0e025a0c[] = { 
-	-2, 0, 0, -2, 1, 0, 1, 4, -2, 11, -18, 29, -37, 41, -40, 74, 
-	248, 3434, 2692, -2994, 443, -341, -2077, 3598, 3486, 2442, 6817, 6851, -1796, -2262, 1811, -3642, 
-	-6897, -2101, -1488, -4127, -1545, 530, -284, 193, 1902, 1903, 1228, 1913, 1597, 123, 101, 788, 
-	85, -640, -748, -1045, -1586, -1701, -1337, -1185, -948, -509, -178, 43, 146, 109, -46, -127, 
-	-42, 108, -16, -198, -123, -179, -354, -358, -404, -436, -245, -93, -140, -127, 27, 64, 
-	0, 0, 36, -24, -133, -166, -143, -196, -240, -174, -160, -204, -160, -114, -134, -110, 
-	-23, -29, -114, -78, -8, -39, -76, -68, -120, -172, -164, -147, -127, -104, -114, -135, 
-	-92, -30, -14, -46, -63, -41, -60, -108, -111, -115, -152, -164, -152, -145, -123, -80
-};
-
-static const short ugen_H0e025a1c[] = { 
-	48, -89, 125, -184, 219, -249, 299, -79, 8245, 9400, -10741, -3749, -1442, -2111, 11412, 4194, 
-	8006, 20167, 6209, -13328, -2848, 1280, -14733, -12248, -1933, -3678, -6859, 915, 2798, -354, 2144, 4912, 
-	4204, 2801, 2450, 6, -1225, -124, 1587, 88, -1473, -1336, -1769, -2869, -4331, -5135, -4117, -1216, 
-	619, 416, 887, 2024, 2677, 2269, 1304, 909, 732, 253, -247, -365, -742, -933, -794, -1080, 
-	-1150, -719, -666, -804, -435, 4, -38, 103, 518, 758, 548, 140, -21, 19, 16, -129, 
-	-163, -449, -671, -525, -388, -348, -178, -12, -87, -189, 47, 329, 341, 251, 111, -31, 
-	-92, -112, -230, -289, -335, -488, -494, -257, -23, 82, 1, -90, -94, -108, -133, -94, 
-	-98, -147, -97, -59, -39, -7, -7, -75, -136, -112, -50, 22, 61, 24, 8, -21
-};
-
-static const short ugen_H0e030a0c[] = { 
-	0, -1, 0, 0, -1, 0, 0, 0, 2, -3, 9, -15, 24, -34, 33, -25, 
-	58, 173, 2874, 2627, -2395, 211, -19, -1837, 2841, 3192, 2168, 5875, 6520, -873, -1971, 1756, 
-	-2634, -6050, -2258, -1398, -3720, -1933, 202, -142, 50, 1543, 1838, 1284, 1753, 1559, 353, 306, 
-	744, -14, -686, -654, -755, -1266, -1621, -1570, -1375, -1066, -671, -380, -161, -9, 66, 95, 
-	49, 80, 185, 87, -54, -52, -176, -400, -421, -422, -477, -323, -118, -92, -107, -40, 
-	-7, -29, 7, 69, 8, -115, -182, -154, -181, -231, -183, -177, -221, -198, -128, -108, 
-	-75, -1, -14, -94, -88, -46, -67, -90, -76, -108, -146, -151, -159, -147, -126, -137, 
-	-148, -96, -48, -39, -53, -57, -37, -39, -62, -74, -96, -138, -167, -165, -154, -124
-};
-
-static const short ugen_H0e030a1c[] = { 
-	-64, 84, -116, 99, -99, 106, -156, 4676, 12933, -5140, -9585, -971, -2569, 8976, 6063, 6249, 
-	19975, 11078, -10304, -6180, 1511, -11965, -13687, -4952, -3550, -6195, -817, 3197, -65, 1849, 5050, 4265, 
-	1808, 2269, 1210, -1100, -286, 1685, 562, -1165, -1148, -1490, -3099, -5225, -5549, -3396, -1383, -318, 
-	475, 1294, 1981, 2403, 2349, 1608, 1048, 669, 250, -213, -310, -610, -994, -931, -1024, -1242, 
-	-861, -598, -622, -442, -104, 30, 173, 512, 739, 571, 156, 4, -43, -69, -160, -171, 
-	-389, -627, -520, -367, -346, -201, -20, -55, -182, -1, 317, 352, 278, 156, -29, -151, 
-	-120, -198, -291, -324, -480, -537, -325, -59, 93, 61, -44, -102, -118, -141, -85, -72, 
-	-162, -149, -89, -45, -17, -4, -71, -151, -158, -76, 41, 116, 86, 34, -5, -43
-};
-
-static const short ugen_H0e035a0c[] = { 
-	-2, 0, 0, 0, 0, -1, 0, 1, 0, 2, -4, 11, -16, 21, -27, 27, 
-	-12, 35, 120, 2282, 2614, -1774, -72, 331, -1609, 2065, 2897, 1940, 4911, 6213, 163, -1666, 
-	1610, -1673, -5233, -2465, -1243, -3386, -2202, 38, -194, -123, 1322, 1810, 1316, 1634, 1664, 602, 
-	219, 511, 29, -479, -463, -716, -1347, -1715, -1645, -1439, -1276, -909, -510, -247, -12, 230, 
-	382, 283, 221, 268, 189, -21, -142, -275, -487, -487, -470, -473, -344, -169, -102, -146, 
-	-64, 23, 35, 29, 70, 42, -111, -184, -158, -167, -214, -199, -196, -243, -203, -116, 
-	-103, -73, 9, 13, -89, -103, -53, -77, -97, -89, -104, -138, -139, -132, -152, -157, 
-	-164, -144, -96, -77, -46, -40, -40, -16, -9, -43, -72, -81, -118, -147, -159, -158
-};
-
-static const short ugen_H0e035a1c[] = { 
-	-5, 12, -57, 95, -143, 147, 1527, 12620, 3198, -12131, -4198, -1914, 6429, 6975, 5099, 18831, 
-	14720, -5819, -7356, 342, -9072, -13236, -8201, -5107, -5011, -2835, 2362, 1289, 1596, 4906, 4716, 598, 
-	1873, 2886, -833, -869, 1473, 1073, -708, -800, -1331, -3624, -5796, -5223, -2844, -1718, -1025, 266, 
-	1510, 2035, 2059, 2230, 1904, 1349, 685, 110, -243, -225, -522, -938, -981, -1110, -1262, -1003, 
-	-551, -487, -447, -235, 89, 346, 566, 711, 543, 203, 36, -103, -232, -253, -146, -317, 
-	-577, -485, -338, -281, -195, -47, -63, -134, -27, 238, 363, 309, 181, -28, -191, -168, 
-	-213, -283, -297, -405, -529, -423, -120, 111, 141, -10, -107, -124, -140, -91, -67, -148, 
-	-178, -143, -86, -18, 1, -67, -147, -164, -85, 25, 108, 118, 61, 13, -27, 15
-};
-
-static const short ugen_H0e040a0c[] = { 
-	0, 0, 0, 0, 0, 0, -1, 0, 2, 0, 2, -2, 8, -14, 18, -22, 
-	22, -10, 31, 63, 1703, 2605, -1158, -367, 673, -1356, 1266, 2617, 1757, 3951, 5905, 1265, 
-	-1384, 1317, -718, -4407, -2658, -1034, -3007, -2533, -257, -107, -177, 1084, 1848, 1422, 1518, 1553, 
-	661, 199, 474, 251, -419, -769, -967, -1288, -1648, -1783, -1647, -1397, -936, -462, -146, 158, 
-	460, 578, 494, 321, 263, 162, -106, -293, -413, -525, -547, -507, -471, -378, -230, -129, 
-	-87, -5, 72, 55, 34, 67, 39, -79, -175, -159, -168, -242, -236, -209, -226, -195, 
-	-122, -89, -73, -13, -7, -77, -98, -76, -74, -106, -86, -86, -116, -125, -150, -163, 
-	-170, -153, -155, -129, -80, -40, -19, -25, -5, -4, -36, -67, -81, -109, -141, -148
-};
-
-static const short ugen_H0e040a1c[] = { 
-	74, -152, 215, -271, 344, -134, 8949, 10714, -9301, -9241, -2444, 4536, 7485, 3611, 17325, 18209, 
-	-2090, -7363, 185, -7003, -12301, -8903, -8212, -5347, -3180, 491, 1038, 2288, 5604, 3803, 257, 2442, 
-	3346, -212, -631, 576, 960, -26, -290, -1473, -4250, -5739, -4600, -2842, -2034, -1025, 145, 1134, 
-	1917, 1954, 2033, 1984, 1632, 842, 27, -249, -212, -525, -888, -910, -1169, -1381, -1083, -500, 
-	-477, -457, -188, 158, 367, 635, 773, 571, 215, -25, -179, -324, -254, -176, -313, -521, 
-	-448, -287, -266, -184, 0, -7, -82, -88, 138, 312, 348, 257, -23, -241, -250, -230, 
-	-297, -271, -316, -493, -467, -189, 100, 195, 54, -74, -140, -140, -98, -74, -152, -210, 
-	-180, -129, -36, 7, -33, -129, -172, -75, 22, 82, 112, 67, 18, -28, 3, 76
-};
-
-static const short ugen_H0e045a0c[] = { 
-	2, 0, 0, 0, 0, 0, 0, -1, 0, 2, -2, 6, -1, 6, -7, 15, 
-	-10, 13, 2, 22, 25, 1189, 2491, -523, -604, 931, -1058, 513, 2318, 1623, 3099, 5519, 
-	2293, -1071, 996, 162, -3475, -2672, -1058, -2832, -2647, -384, -53, -164, 996, 1837, 1303, 1267, 
-	1555, 900, 305, 276, -19, -653, -960, -1015, -1281, -1728, -1871, -1615, -1256, -757, -275, 20, 
-	344, 621, 695, 539, 328, 205, 3, -256, -416, -459, -564, -588, -532, -490, -363, -193, 
-	-63, -42, 23, 75, 67, 61, 54, 30, -54, -145, -191, -221, -255, -231, -187, -199, 
-	-185, -122, -101, -100, -54, -29, -69, -92, -48, -49, -81, -79, -69, -103, -147, -152, 
-	-158, -159, -175, -159, -122, -79, -25, -5, 0, -8, -10, -50, -81, -85, -108, -116
-};
-
-static const short ugen_H0e045a1c[] = { 
-	-79, 97, -103, 108, -197, 3826, 14043, -1103, -13285, -4943, 2535, 7774, 2650, 13545, 22170, 2591, 
-	-7663, -93, -4165, -11387, -8442, -9889, -7348, -3718, -1139, 552, 1451, 5619, 3897, 669, 2461, 3900, 
-	932, -409, 60, 578, 407, -348, -1608, -4458, -5357, -4161, -3137, -2238, -1007, 446, 918, 1298, 
-	1771, 1999, 1890, 1683, 1121, 165, -219, -316, -464, -850, -955, -1092, -1501, -1269, -561, -354, 
-	-425, -170, 229, 405, 619, 770, 656, 232, -110, -220, -342, -261, -200, -288, -480, -456, 
-	-286, -279, -192, 45, 96, -10, -91, 4, 204, 357, 311, 30, -248, -330, -295, -318, 
-	-261, -255, -428, -488, -283, 46, 223, 130, -21, -132, -158, -107, -66, -137, -241, -252, 
-	-203, -76, 9, -10, -89, -151, -94, 17, 86, 97, 57, 0, -45, -29, 52, 91
-};
-
-static const short ugen_H0e050a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 2, -2, 2, -5, 
-	6, 0, 0, 11, 9, 8, 746, 2259, 102, -743, 1050, -713, -143, 1971, 1544, 2382, 
-	5003, 3124, -615, 737, 1028, -2557, -2944, -1182, -2354, -2605, -595, 103, -56, 715, 1560, 1331, 
-	1352, 1628, 844, -214, -201, -103, -756, -1180, -1158, -1233, -1599, -1706, -1371, -958, -503, -115, 
-	174, 447, 626, 661, 470, 214, 31, -144, -366, -493, -487, -585, -617, -513, -411, -291, 
-	-130, -28, -52, 0, 99, 94, 33, 34, 28, -74, -182, -211, -213, -243, -229, -180, 
-	-192, -194, -147, -129, -129, -76, -24, -50, -73, -26, -26, -75, -68, -64, -125, -160, 
-	-152, -166, -182, -166, -147, -115, -72, -22, -4, -27, -37, -47, -66, -85, -72, -69
-};
-
-static const short ugen_H0e050a1c[] = { 
-	-95, 167, -245, 289, 243, 10998, 9627, -12127, -10350, 546, 6971, 3445, 7596, 23879, 10152, -7426, 
-	-1537, -864, -9969, -8328, -8903, -10120, -4761, -2396, -494, 571, 3953, 3745, 1494, 2712, 4448, 2306, 
-	7, 438, 103, 408, -229, -2170, -4596, -4792, -3753, -3649, -2554, -808, 538, 943, 1059, 1386, 
-	1742, 1782, 1673, 1320, 446, -117, -325, -433, -753, -994, -1133, -1528, -1486, -761, -234, -319, 
-	-155, 238, 495, 581, 708, 700, 284, -70, -178, -338, -391, -227, -162, -381, -525, -370, 
-	-265, -181, 6, 163, 77, -27, -40, 88, 296, 348, 140, -220, -370, -347, -348, -290, 
-	-215, -325, -488, -383, -41, 203, 209, 44, -104, -159, -114, -35, -89, -214, -295, -292, 
-	-184, -42, 27, -21, -102, -123, -11, 108, 127, 93, -6, -95, -94, 34, 109, 56
-};
-
-static const short ugen_H0e055a0c[] = { 
-	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, 
-	0, 4, 3, -4, 20, 0, 10, 398, 1908, 684, -721, 1000, -339, -639, 1558, 1502, 
-	1853, 4344, 3740, 222, 595, 1291, -1734, -2799, -1277, -1915, -2419, -720, 102, -164, 561, 1624, 
-	1562, 1161, 897, 294, -402, -370, -384, -995, -1210, -1013, -981, -1279, -1352, -1046, -632, -283, 
-	-54, 189, 412, 522, 474, 300, 86, -137, -265, -397, -510, -522, -550, -516, -411, -302, 
-	-226, -124, -44, -46, 12, 66, 67, 24, -1, -18, -100, -160, -192, -201, -244, -248, 
-	-191, -194, -200, -164, -126, -111, -67, -34, -43, -44, -13, -18, -62, -65, -90, -124, 
-	-148, -164, -173, -171, -144, -134, -110, -86, -65, -50, -51, -45, -39, -45, -55, -53
-};
-
-static const short ugen_H0e055a1c[] = { 
-	62, -69, 89, -185, 4016, 15163, -1499, -16414, -3670, 5698, 5242, 2442, 19748, 19863, -4109, -4648, 
-	1666, -6430, -9199, -7347, -10923, -6854, -3353, -1779, 137, 1054, 3013, 2355, 2049, 4272, 4803, 1148, 
-	291, 688, 557, -410, -2445, -4388, -4980, -3721, -3744, -3059, -939, 566, 1030, 1070, 1176, 1419, 
-	1683, 1535, 1322, 855, 74, -275, -394, -623, -925, -1198, -1630, -1655, -965, -353, -226, -93, 
-	205, 538, 611, 568, 672, 520, 40, -209, -256, -460, -343, -132, -244, -501, -457, -274, 
-	-230, -54, 186, 180, 24, -72, 13, 244, 339, 238, -101, -391, -420, -376, -310, -212, 
-	-244, -430, -461, -194, 131, 254, 110, -54, -140, -139, -43, -26, -135, -270, -339, -313, 
-	-168, -15, 23, -40, -119, -59, 95, 164, 142, 45, -97, -152, -82, 73, 113, 36
-};
-
-static const short ugen_H0e060a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 
-	-2, 4, 0, 1, -9, 27, -4, 4, 172, 1466, 1148, -503, 778, 0, -912, 1111, 
-	1458, 1524, 3748, 4210, 900, 288, 1576, -694, -2589, -1449, -1406, -2204, -1030, 73, 212, 694, 
-	1285, 1001, 364, 371, 98, -660, -747, -525, -834, -982, -674, -569, -862, -1006, -715, -417, 
-	-263, -108, 91, 250, 304, 268, 113, -78, -224, -301, -418, -486, -427, -401, -397, -312, 
-	-231, -209, -139, -59, -36, -32, 2, 35, -11, -40, -45, -85, -135, -196, -218, -251, 
-	-254, -195, -180, -173, -138, -110, -103, -73, -31, -40, -39, -16, -25, -56, -75, -72, 
-	-108, -148, -160, -174, -156, -146, -152, -147, -129, -85, -52, -26, -19, -15, -32, -56
-};
-
-static const short ugen_H0e060a1c[] = { 
-	152, -243, 323, -130, 9823, 12989, -12925, -13588, 3454, 6824, 1522, 9741, 25760, 6265, -8314, 1160, 
-	-940, -8697, -7134, -9484, -9864, -3943, -2897, -757, -668, 849, 2562, 1672, 3088, 5303, 3868, 1064, 
-	1086, 1003, 171, -2392, -4210, -4830, -4395, -3895, -3666, -1569, 496, 1112, 1026, 1144, 1252, 1506, 
-	1484, 1293, 1093, 427, -165, -265, -460, -929, -1130, -1508, -1825, -1397, -593, -161, -66, 179, 
-	404, 585, 570, 605, 685, 335, -103, -268, -372, -462, -235, -169, -397, -475, -344, -259, 
-	-172, 121, 255, 114, -31, -59, 122, 340, 343, 72, -309, -490, -436, -326, -222, -179, 
-	-320, -482, -394, -35, 240, 199, 22, -108, -156, -87, 20, -33, -190, -317, -377, -289, 
-	-116, -7, -10, -84, -99, 44, 180, 173, 113, -16, -137, -140, -24, 87, 61, 11
-};
-
-static const short ugen_H0e065a0c[] = { 
-	2, 2, 2, 4, 3, 4, 4, 3, 3, 2, 4, 5, 5, 4, 7, 2, 
-	8, 3, 14, 6, 5, 12, 32, -6, 13, 67, 1005, 1433, -90, 447, 261, -879, 
-	644, 1491, 1626, 2899, 3887, 1909, 609, 1587, 92, -2077, -1604, -1213, -1795, -812, 329, 168, 
-	-19, 335, 509, 35, -233, -389, -688, -600, -422, -515, -447, -198, -202, -508, -703, -561, 
-	-367, -348, -281, -75, 48, 78, 44, -22, -135, -262, -291, -289, -307, -293, -280, -274, 
-	-227, -182, -196, -157, -77, -67, -82, -41, -7, -17, -37, -52, -72, -126, -187, -219, 
-	-223, -201, -158, -126, -128, -118, -102, -80, -64, -47, -30, -35, -15, -10, -26, -41, 
-	-55, -87, -137, -157, -171, -179, -169, -160, -145, -111, -59, -21, 0, 2, -16, -36
-};
-
-static const short ugen_H0e065a1c[] = { 
-	115, -196, 198, 1377, 14949, 5371, -19966, -6417, 7990, 4280, 1580, 19624, 21033, -5280, -4669, 3556, 
-	-4223, -8156, -7257, -10747, -7079, -2873, -1887, -1373, -1996, 1923, 1987, 1333, 4081, 5608, 2771, 1276, 
-	2141, 1181, -1425, -4061, -4261, -4626, -4505, -4235, -2752, -286, 1133, 1250, 921, 1092, 1423, 1530, 
-	1259, 1236, 869, 59, -241, -185, -692, -1261, -1333, -1573, -1762, -1185, -338, -4, 69, 282, 
-	477, 503, 599, 812, 606, 91, -158, -209, -485, -444, -151, -239, -486, -461, -267, -240, 
-	-57, 229, 231, 34, -54, 6, 211, 365, 283, -91, -442, -482, -405, -267, -157, -178, 
-	-393, -515, -290, 82, 257, 130, -43, -162, -138, 4, 40, -66, -255, -368, -351, -221, 
-	-69, -17, -54, -128, -40, 140, 185, 145, 86, -34, -148, -92, 44, 50, 11, -16
-};
-
-static const short ugen_H0e070a0c[] = { 
-	0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 2, 0, 
-	0, 5, -5, 13, 0, 4, 12, 12, -3, 1, 26, 581, 1471, 411, 135, 367, 
-	-564, 543, 1365, 1103, 2197, 3874, 2901, 999, 1346, 692, -1520, -1673, -637, -900, -979, -565, 
-	-617, -596, -192, -80, -619, -729, -344, -284, -367, -152, 32, 75, 142, 6, -339, -561, 
-	-555, -505, -562, -479, -297, -217, -136, -104, -109, -175, -199, -140, -128, -187, -213, -179, 
-	-193, -206, -207, -222, -197, -172, -142, -132, -95, -42, -52, -66, -79, -81, -127, -192, 
-	-188, -168, -148, -134, -128, -124, -125, -100, -112, -105, -72, -42, -16, -21, -14, -30, 
-	-35, -64, -123, -162, -197, -197, -196, -178, -163, -131, -85, -68, -35, -14, -18, -42
-};
-
-static const short ugen_H0e070a1c[] = { 
-	-20, 19, -132, 4194, 17380, -4117, -21437, 1072, 9222, 1059, 6070, 25498, 10797, -10025, 460, 3362, 
-	-6038, -7570, -8291, -10270, -4769, -2197, -1739, -3302, -1735, 2918, 1339, 1521, 4908, 4984, 1920, 2060, 
-	2340, 609, -2607, -4304, -4036, -4557, -4690, -4141, -1768, 391, 1285, 1096, 800, 1102, 1552, 1467, 
-	1218, 1206, 535, -102, -155, -299, -991, -1355, -1397, -1682, -1612, -885, -189, -59, 66, 354, 
-	513, 465, 681, 920, 485, -55, -118, -258, -544, -332, -115, -363, -572, -434, -275, -206, 
-	76, 295, 151, -16, -27, 74, 249, 334, 156, -247, -481, -437, -329, -212, -146, -245, 
-	-482, -517, -170, 186, 208, 30, -112, -178, -102, 40, 26, -128, -302, -395, -325, -165, 
-	-31, -25, -106, -144, -9, 155, 157, 134, 53, -83, -128, -21, 75, 27, -42, -96
-};
-
-static const short ugen_H0e075a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-	0, 0, 2, -5, 14, 2, -5, 18, 12, -4, -2, 12, 280, 1329, 918, -9, 
-	607, 123, -171, 805, 1365, 1920, 3495, 3617, 1506, 1018, 1165, -321, -1080, -598, -1160, -1950, 
-	-1449, -951, -1067, -995, -736, -761, -570, -27, 154, 107, 248, 463, 487, 306, 6, -308, 
-	-534, -691, -729, -752, -701, -535, -379, -252, -177, -101, -53, -23, -4, -20, -84, -131, 
-	-124, -159, -222, -248, -275, -278, -233, -179, -157, -136, -91, -70, -82, -86, -87, -90, 
-	-106, -127, -119, -129, -134, -120, -126, -138, -147, -135, -99, -54, -24, -23, -24, -26, 
-	-34, -71, -103, -133, -172, -193, -202, -182, -165, -133, -113, -113, -82, -52, -26, -39
-};
-
-static const short ugen_H0e075a1c[] = { 
-	-175, 269, -430, 7423, 17045, -12259, -19325, 6705, 8447, -859, 12084, 26118, 905, -9925, 4560, 2536, 
-	-7125, -7331, -8827, -9326, -3010, -1681, -3032, -4860, -362, 3198, 663, 2395, 5347, 3855, 1556, 2656, 
-	1951, -508, -2915, -3469, -3704, -4903, -4685, -3370, -1262, 459, 1242, 829, 602, 1199, 1646, 1336, 
-	1256, 1214, 277, -238, -23, -349, -1198, -1357, -1419, -1719, -1465, -624, -135, -174, -43, 434, 
-	541, 462, 774, 919, 410, -81, -84, -354, -517, -167, -124, -500, -627, -384, -279, -167, 
-	197, 294, 82, -47, 12, 113, 271, 319, 28, -356, -478, -343, -220, -159, -169, -342, 
-	-545, -442, -42, 231, 123, -50, -160, -179, -52, 53, 8, -173, -337, -389, -272, -101, 
-	11, -8, -159, -182, 25, 177, 154, 102, 16, -105, -83, 68, 87, -17, -93, -128
-};
-
-static const short ugen_H0e080a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-	0, 0, 0, 0, 0, 10, 0, -1, 29, 8, -13, -10, 0, 159, 1112, 1464, 
-	445, 193, 26, -12, 823, 1277, 1674, 3089, 3837, 2250, 1514, 1956, 402, -1509, -1615, -1694, 
-	-2314, -2117, -1637, -1551, -1346, -849, -463, -164, 367, 667, 558, 571, 731, 643, 260, -117, 
-	-384, -652, -873, -962, -943, -851, -652, -458, -287, -82, 34, 100, 100, 77, 52, -28, 
-	-71, -120, -187, -295, -319, -294, -306, -263, -231, -195, -164, -114, -86, -92, -52, -13, 
-	-13, -67, -102, -104, -120, -136, -147, -157, -168, -149, -112, -90, -61, -37, -27, -48, 
-	-62, -68, -90, -109, -142, -171, -187, -173, -155, -160, -147, -130, -123, -106, -68, -32
-};
-
-static const short ugen_H0e080a1c[] = { 
-	-279, 435, -553, 10003, 15366, -17573, -16313, 10086, 7181, -1279, 16882, 23783, -6107, -7994, 7632, 1712, 
-	-8022, -6815, -8943, -8649, -1613, -1580, -5003, -5626, 1339, 2905, -125, 3602, 5661, 2694, 1428, 2904, 
-	1020, -1462, -2471, -2526, -3574, -4843, -4277, -3045, -879, 538, 748, 486, 638, 1192, 1490, 1300, 
-	1399, 1070, 63, -198, 98, -413, -1177, -1324, -1500, -1685, -1314, -483, -173, -270, -104, 405, 
-	518, 488, 840, 914, 315, -57, -79, -401, -446, -69, -152, -601, -635, -350, -257, -116, 
-	230, 249, 18, -59, 22, 121, 299, 282, -48, -425, -453, -269, -160, -105, -186, -413, 
-	-593, -377, 52, 221, 53, -124, -219, -190, -17, 69, -35, -214, -357, -353, -206, -56, 
-	22, -51, -196, -174, 60, 177, 121, 73, -20, -115, -58, 92, 74, -44, -108, -164
-};
-
-static const short ugen_H0e085a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 
-	-1, 0, 0, 2, 2, -3, 13, 7, 6, 22, 1, -29, -8, 53, 292, 1400, 
-	1472, -86, 211, 797, 225, 513, 1105, 1444, 2690, 4503, 3837, 1830, 1137, -113, -2027, -2185, 
-	-2021, -2868, -2805, -1940, -1482, -1232, -653, -22, 359, 742, 1021, 904, 726, 743, 553, 113, 
-	-337, -595, -785, -1047, -1111, -1024, -907, -686, -389, -119, 43, 147, 190, 167, 110, 81, 
-	20, -109, -190, -248, -304, -324, -317, -319, -315, -266, -210, -172, -113, -42, -16, 3, 
-	34, 6, -48, -86, -115, -129, -148, -162, -169, -156, -129, -112, -103, -89, -50, -36, 
-	-61, -73, -87, -100, -112, -124, -151, -164, -144, -156, -166, -162, -153, -129, -77, -24
-};
-
-static const short ugen_H0e085a1c[] = { 
-	-328, 515, -588, 11257, 14118, -20134, -14311, 11777, 6383, -1030, 19297, 21205, -10199, -6272, 10221, 1277, 
-	-8866, -5914, -8808, -8479, -557, -1789, -7024, -5649, 2666, 2097, -276, 4353, 5521, 2450, 1295, 2618, 
-	89, -1920, -1852, -1919, -3505, -4398, -3569, -2942, -841, 599, 486, -8, 557, 1255, 1224, 1214, 
-	1498, 962, -87, -100, 267, -423, -1120, -1200, -1502, -1739, -1184, -357, -255, -344, -124, 335, 
-	463, 513, 864, 888, 280, -52, -83, -378, -392, -21, -169, -632, -598, -302, -231, -90, 
-	253, 178, -55, -68, 21, 143, 299, 250, -90, -420, -419, -252, -109, -44, -166, -454, 
-	-613, -332, 97, 219, 1, -178, -260, -197, -3, 64, -50, -233, -336, -306, -183, -30, 
-	25, -71, -191, -141, 65, 172, 134, 55, -57, -149, -55, 92, 76, -37, -124, -182
-};
-
-static const short ugen_H0e090a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-	-2, -1, -1, 2, 0, -2, 4, 16, 7, 0, 13, -16, -16, 141, 651, 556, 
-	355, 1076, 803, 508, 931, 638, 378, 580, 1413, 3572, 5325, 3671, 747, -98, -452, -1910, 
-	-2744, -2774, -3068, -2713, -1803, -1236, -862, -251, 403, 725, 1006, 1191, 1024, 677, 533, 360, 
-	-177, -597, -773, -891, -1079, -1174, -1029, -820, -495, -221, -29, 126, 196, 219, 166, 117, 
-	29, -49, -128, -219, -250, -322, -345, -340, -343, -351, -297, -174, -98, -44, -13, 14, 
-	40, 36, -15, -72, -88, -102, -129, -167, -192, -163, -146, -162, -150, -115, -73, -53, 
-	-50, -72, -97, -92, -103, -113, -125, -132, -137, -154, -169, -194, -171, -111, -55, -25
-};
-
-static const short ugen_H0e090a1c[] = { 
-	-334, 530, -665, 11015, 14273, -20449, -14262, 12367, 6400, -800, 19446, 19851, -12003, -5755, 12467, 1732, 
-	-9638, -5130, -8236, -8809, 84, -2065, -8667, -5493, 3116, 1711, -259, 4569, 5300, 2337, 1626, 2188, 
-	-841, -1991, -1337, -1701, -3318, -3867, -3062, -2584, -811, 341, 376, -214, 264, 1102, 1113, 1064, 
-	1392, 928, -45, -94, 321, -261, -1019, -1129, -1408, -1716, -1221, -279, -225, -396, -210, 272, 
-	409, 476, 841, 836, 271, -35, -69, -359, -377, 2, -130, -615, -559, -250, -218, -102, 
-	253, 127, -150, -99, 39, 130, 283, 245, -104, -428, -381, -194, -59, -29, -173, -449, 
-	-619, -323, 99, 207, -36, -212, -288, -227, -12, 72, -30, -229, -346, -325, -173, 1, 
-	45, -71, -202, -151, 83, 192, 129, 17, -103, -175, -71, 81, 64, -51, -126, -155
-};
-
-static const short ugen_H0e095a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-	-2, -1, -1, 1, -2, 0, 5, 10, 8, 11, -9, -1, 48, 553, 764, -71, 
-	-137, 775, 1293, 1026, 824, 1466, 1418, -466, 25, 2825, 4047, 3904, 2226, 54, -617, -624, 
-	-1993, -3243, -3003, -2551, -2269, -1625, -745, -350, -6, 596, 983, 1136, 1102, 861, 492, 289, 
-	-8, -453, -773, -828, -852, -1083, -1086, -840, -555, -362, -161, 36, 145, 196, 149, 85, 
-	46, 18, -44, -154, -242, -299, -310, -350, -395, -372, -293, -182, -110, -57, -23, 6, 
-	17, 5, -20, -51, -37, -55, -127, -170, -186, -199, -198, -174, -153, -143, -108, -86, 
-	-75, -60, -70, -99, -123, -124, -107, -109, -131, -154, -163, -163, -150, -99, -45, -27
-};
-
-static const short ugen_H0e095a1c[] = { 
-	-301, 462, -691, 9275, 15696, -18345, -16299, 11922, 7259, -852, 17709, 19990, -11664, -6849, 14079, 3567, 
-	-10172, -4956, -7111, -9371, 90, -2033, -9687, -5797, 2743, 2047, -208, 4126, 5275, 2408, 1690, 2228, 
-	-1290, -2355, -867, -1538, -3132, -3528, -2643, -2284, -686, 296, 78, -389, 275, 861, 796, 990, 
-	1298, 835, 15, -50, 309, -143, -876, -984, -1339, -1651, -1220, -307, -178, -378, -299, 196, 
-	372, 430, 766, 757, 273, -17, -45, -328, -389, 7, -53, -537, -530, -231, -173, -131, 
-	203, 112, -171, -176, 0, 116, 256, 251, -87, -393, -343, -156, -35, -7, -171, -445, 
-	-594, -320, 66, 181, -37, -239, -326, -230, -5, 95, -30, -261, -367, -324, -157, 26, 
-	67, -78, -202, -128, 93, 181, 101, -6, -104, -186, -107, 34, 39, -36, -101, -135
-};
-
-static const short ugen_H0e100a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 
-	0, 0, 0, 0, 0, 3, 9, 4, 13, 10, 5, -1, 442, 964, 147, -378, 
-	297, 586, 542, 1100, 1861, 2205, 1973, 23, -1027, 1319, 2928, 2419, 2027, 1454, -36, -818, 
-	-903, -2088, -2977, -2559, -2037, -1747, -1054, -439, -236, 177, 789, 1022, 922, 827, 642, 266, 
-	-75, -341, -601, -693, -746, -826, -890, -802, -607, -451, -275, -105, 32, 65, 47, 80, 
-	94, 73, 0, -109, -203, -239, -266, -353, -389, -309, -220, -198, -145, -68, -29, -34, 
-	-41, -24, -13, -20, -28, -45, -85, -152, -206, -214, -191, -160, -147, -161, -156, -108, 
-	-69, -64, -74, -87, -113, -122, -113, -117, -123, -109, -103, -110, -96, -80, -51, -29
-};
-
-static const short ugen_H0e100a1c[] = { 
-	-179, 257, -490, 6235, 17320, -13107, -19956, 9775, 9140, -1046, 14314, 21125, -8940, -9432, 14287, 7076, 
-	-9973, -5755, -5586, -9781, -718, -1487, -10053, -6716, 1743, 2685, 43, 3279, 5204, 2693, 1793, 2171, 
-	-1097, -2598, -884, -1304, -2715, -3506, -2488, -1873, -714, 307, 107, -539, 37, 839, 682, 704, 
-	1132, 915, 47, -140, 293, -8, -776, -852, -1189, -1571, -1226, -299, -153, -364, -299, 122, 
-	293, 361, 695, 715, 263, -40, -8, -246, -403, -32, 46, -446, -502, -232, -144, -153, 
-	164, 129, -172, -201, -65, 62, 217, 283, -6, -337, -330, -148, -10, 26, -147, -419, 
-	-595, -338, 44, 182, -39, -258, -306, -223, -1, 88, -43, -270, -357, -289, -165, -5, 
-	77, -24, -145, -128, 46, 142, 116, 20, -109, -207, -146, 24, 50, -21, -82, -110
-};
-
-static const short ugen_H0e105a0c[] = { 
-	0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-	0, 0, 0, 0, -1, 12, 0, 8, 13, 12, 0, 295, 1078, 477, -493, 96, 
-	561, 320, 322, 1017, 2637, 3234, 1500, 193, -117, -59, 772, 1231, 1122, 1204, 1072, 91, 
-	-863, -1082, -1577, -2312, -2069, -1363, -1181, -931, -484, 4, 369, 585, 727, 691, 561, 285, 
-	-45, -315, -419, -468, -567, -629, -631, -623, -609, -511, -343, -261, -205, -104, 2, 51, 
-	82, 83, -7, -84, -132, -177, -258, -278, -250, -245, -218, -173, -127, -110, -105, -85, 
-	-78, -41, -9, -40, -66, -58, -75, -141, -173, -173, -164, -158, -174, -184, -165, -118, 
-	-82, -85, -92, -84, -90, -123, -139, -123, -89, -52, -45, -47, -60, -60, -56, -54
-};
-
-static const short ugen_H0e105a1c[] = { 
-	31, -97, 32, 2622, 17172, -4232, -23232, 4500, 11817, -563, 9168, 22075, -3298, -12544, 11943, 11844, 
-	-7955, -7703, -4055, -9511, -2547, -525, -9554, -8194, 190, 3085, 574, 2251, 5005, 3125, 1857, 2323, 
-	-580, -2891, -935, -1072, -2338, -3312, -2693, -1698, -708, 263, 137, -423, -172, 597, 741, 683, 
-	826, 862, 255, -227, 76, 115, -646, -817, -1048, -1379, -1227, -396, -57, -311, -339, 46, 
-	259, 262, 571, 707, 308, -97, -17, -143, -372, -125, 119, -326, -516, -266, -132, -151, 
-	101, 165, -153, -239, -99, 0, 156, 303, 81, -261, -342, -155, -12, 44, -120, -380, 
-	-562, -412, -17, 170, 8, -239, -286, -226, -92, 50, 5, -191, -343, -345, -208, -40, 
-	108, 36, -134, -177, -9, 155, 127, 5, -126, -198, -145, 6, 58, -8, -74, -82
-};
-
-static const short ugen_H0e110a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-	0, 1, 2, -3, 3, 10, -1, 9, 13, 9, 169, 1105, 888, -543, -175, 635, 
-	334, 78, 726, 2239, 2954, 2064, 1331, 714, 113, -277, -903, -438, 457, 639, 895, 922, 
-	245, -564, -821, -1031, -1410, -1496, -1242, -1052, -811, -309, -29, 124, 332, 478, 371, 126, 
-	13, -92, -250, -316, -316, -377, -474, -471, -459, -468, -504, -454, -318, -225, -84, -18, 
-	-4, 2, -11, -54, -125, -120, -106, -145, -185, -189, -166, -151, -129, -164, -170, -129, 
-	-77, -59, -87, -78, -105, -119, -94, -81, -97, -120, -140, -186, -205, -179, -147, -134, 
-	-118, -99, -98, -97, -119, -131, -113, -81, -59, -33, -9, -3, -17, -47, -72, -96
-};
-
-static const short ugen_H0e110a1c[] = { 
-	222, -393, 519, -22, 13467, 6428, -22275, -4647, 13465, 2210, 2992, 20575, 5182, -14014, 6316, 16062, 
-	-2922, -10017, -3655, -7876, -5136, -51, -7699, -9749, -2073, 2986, 1309, 1263, 4504, 3729, 1958, 2358, 
-	550, -3013, -1639, -484, -1836, -3209, -2919, -1693, -872, 162, 203, -305, -255, 453, 681, 695, 
-	800, 763, 332, -165, -131, 62, -529, -809, -896, -1184, -1188, -536, 0, -166, -349, -119, 
-	257, 226, 416, 662, 431, -90, -99, -41, -291, -224, 100, -176, -531, -347, -124, -128, 
-	22, 181, -84, -258, -127, 19, 100, 259, 166, -151, -318, -189, -33, 24, -79, -303, 
-	-510, -477, -129, 152, 91, -163, -298, -303, -143, 69, 97, -123, -351, -398, -237, -27, 
-	79, 18, -126, -159, -26, 126, 94, -6, -75, -138, -149, -21, 74, 28, -45, -68
-};
-
-static const short ugen_H0e115a0c[] = { 
-	0, 0, 0, 2, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 2, 0, 
-	1, 2, 4, -3, 8, 1, 10, 4, 26, 71, 1031, 1343, -433, -553, 635, 447, 
-	-29, 518, 2286, 3258, 1958, 886, 938, 873, 117, -941, -1296, -1180, -673, 193, 580, 826, 
-	1120, 556, -246, -186, -356, -1169, -1491, -1102, -769, -779, -538, -214, -60, 34, 66, 10, 
-	40, 121, 24, -117, -147, -159, -275, -352, -379, -464, -529, -509, -389, -282, -232, -160, 
-	-110, -86, -91, -67, -12, 23, 6, -69, -135, -115, -93, -138, -171, -171, -168, -157, 
-	-129, -117, -147, -174, -156, -110, -80, -61, -42, -73, -139, -195, -194, -164, -149, -129, 
-	-126, -124, -121, -131, -134, -108, -65, -41, -33, -24, 4, 22, -2, -48, -97, -123
-};
-
-static const short ugen_H0e115a1c[] = { 
-	189, -299, 389, -557, 6870, 13992, -13692, -14944, 10423, 7613, -1318, 14159, 14285, -10704, -1800, 16938, 
-	4936, -10369, -5563, -5168, -7055, -1349, -4799, -10103, -5200, 1956, 2246, 512, 3458, 4361, 2351, 2091, 
-	1743, -2037, -2831, -560, -863, -2809, -3357, -1832, -992, -210, 182, -89, -314, 267, 766, 671, 
-	704, 873, 495, -186, -267, -24, -456, -897, -791, -944, -1128, -733, -15, -19, -268, -247, 
-	152, 255, 277, 573, 542, 24, -181, 0, -177, -304, -16, -65, -504, -447, -159, -116, 
-	-74, 154, 32, -216, -154, 28, 94, 176, 207, -20, -266, -242, -91, -7, -58, -228, 
-	-429, -521, -245, 95, 139, -148, -309, -270, -137, 55, 88, -77, -296, -346, -267, -133, 
-	-17, 9, -60, -132, -95, 36, 83, 39, -16, -91, -142, -54, 86, 76, -12, -65
-};
-
-static const short ugen_H0e120a0c[] = { 
-	0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 
-	0, 7, -2, 8, -4, 15, -3, 38, 22, 868, 1750, -114, -973, 490, 640, -128, 
-	312, 2482, 3670, 2095, 885, 828, 353, 32, -470, -1273, -1338, -1104, -1064, -583, 302, 926, 
-	1070, 1130, 1054, 428, -152, -516, -1040, -1183, -981, -927, -913, -683, -476, -404, -327, -67, 
-	154, 209, 226, 148, 47, -25, -129, -310, -389, -394, -413, -450, -466, -401, -331, -279, 
-	-278, -245, -83, 50, 70, 58, 39, 2, -43, -70, -73, -95, -142, -174, -182, -187, 
-	-187, -214, -242, -216, -150, -94, -83, -47, -38, -86, -133, -163, -161, -149, -136, -125, 
-	-125, -153, -166, -141, -107, -68, -46, -41, -19, 6, 9, -3, -29, -68, -109, -133
-};
-
-static const short ugen_H0e120a1c[] = { 
-	-49, 112, -205, 215, 1170, 13675, 554, -19513, 562, 12150, 147, 3982, 18231, -525, -8835, 12128, 
-	12969, -6086, -9156, -3436, -6533, -4267, -2878, -8151, -8000, -819, 2972, 592, 1768, 4477, 3302, 1817, 
-	2119, -28, -3105, -1673, -414, -1758, -3342, -2449, -1182, -510, -63, -44, -133, 28, 697, 818, 
-	645, 805, 806, 33, -442, -219, -261, -903, -920, -784, -953, -898, -237, 101, -143, -240, 
-	6, 264, 175, 408, 612, 256, -174, -41, -54, -326, -213, -45, -388, -554, -270, -122, 
-	-146, 52, 141, -90, -156, 4, 106, 138, 206, 79, -177, -293, -166, -62, -52, -171, 
-	-344, -483, -366, -70, 51, -54, -199, -194, -169, -56, 53, 19, -155, -328, -355, -241, 
-	-84, 10, -48, -163, -169, -6, 109, 67, 10, -46, -96, -68, 69, 103, 11, -46
-};
-
-static const short ugen_H0e125a0c[] = { 
-	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -3, 
-	7, -5, 5, -4, 9, -2, 25, 15, 673, 2052, 374, -1358, 204, 825, -129, 78, 
-	2607, 4259, 2341, 782, 933, 327, -297, -960, -1664, -1262, -953, -1098, -906, -599, 94, 720, 
-	983, 1416, 1576, 956, 119, -266, -375, -851, -1214, -1098, -1053, -1103, -1000, -817, -499, -99, 
-	144, 252, 328, 378, 253, 3, -128, -196, -286, -327, -372, -425, -464, -458, -439, -467, 
-	-377, -157, -27, 11, 32, 71, 67, 10, 11, 25, -19, -94, -123, -176, -197, -204, 
-	-267, -307, -280, -181, -148, -125, -70, -55, -83, -131, -130, -127, -111, -99, -118, -142, 
-	-163, -153, -156, -133, -84, -53, -44, -41, -5, 0, -22, -45, -73, -96, -118, -128
-};
-
-static const short ugen_H0e125a1c[] = { 
-	-132, 218, -309, 362, -483, 6636, 11529, -12095, -11946, 9745, 6943, -2742, 11675, 12331, -8031, 1949, 
-	16446, 3165, -10722, -5211, -3656, -6463, -3677, -5238, -8364, -4690, 1951, 1750, 199, 3496, 4287, 2293, 
-	1656, 1540, -1549, -2672, -1015, -1003, -2504, -2863, -1674, -961, -296, -171, -74, 0, 464, 891, 
-	743, 702, 913, 459, -356, -455, -185, -610, -1059, -886, -828, -880, -568, 4, 11, -135, 
-	-71, 228, 192, 153, 498, 546, 41, -133, -6, -255, -401, -165, -223, -584, -476, -173, 
-	-143, -90, 144, 85, -78, -16, 107, 119, 181, 145, -74, -276, -266, -123, -61, -113, 
-	-274, -426, -504, -294, 10, 79, -88, -203, -205, -117, 56, 101, -93, -328, -371, -261, 
-	-157, -99, -91, -158, -166, -55, 89, 98, 34, -6, -38, -50, 20, 99, 54, -38
-};
-
-static const short ugen_H0e130a0c[] = { 
-	0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 3, -2, 3, 
-	0, 1, 0, 5, 5, 12, 24, 490, 2247, 997, -1645, -246, 979, -53, -139, 2736, 
-	4889, 2624, 727, 1082, 309, -509, -1068, -2131, -1996, -1178, -945, -920, -563, 129, 196, 282, 
-	1145, 1549, 1161, 942, 641, 134, -222, -495, -868, -1275, -1326, -1331, -1394, -1039, -469, -171, 
-	4, 283, 472, 341, 233, 170, 12, -129, -214, -287, -399, -412, -410, -505, -557, -391, 
-	-206, -164, -138, -59, 34, 25, 11, 80, 114, 76, -17, -102, -143, -159, -165, -235, 
-	-309, -305, -254, -186, -149, -123, -94, -98, -128, -159, -125, -75, -51, -64, -118, -158, 
-	-165, -136, -110, -86, -72, -65, -41, -30, -29, -44, -71, -91, -108, -105, -103, -111
-};
-
-static const short ugen_H0e130a1c[] = { 
-	40, -80, 129, -210, 248, 577, 10868, 3221, -15833, -1744, 11506, 323, -318, 15662, 4009, -6361, 
-	10894, 12915, -5578, -9572, -2102, -5074, -6441, -3961, -6441, -7068, -1400, 2458, 229, 1219, 4571, 3460, 
-	1485, 1664, 645, -2147, -1920, -1012, -1696, -2637, -2081, -1338, -950, -313, -92, -35, 216, 792, 
-	911, 701, 812, 802, 54, -499, -283, -269, -891, -1018, -862, -848, -791, -289, 74, -7, 
-	-68, 121, 299, 114, 221, 542, 407, -48, -54, -123, -442, -395, -177, -411, -627, -360, 
-	-143, -156, 46, 220, 64, -21, 92, 155, 140, 168, 40, -183, -307, -185, -61, -91, 
-	-260, -429, -469, -363, -94, 48, -51, -171, -144, -53, 5, 33, -33, -198, -314, -328, 
-	-237, -189, -143, -102, -129, -109, 26, 134, 80, 30, 26, -9, -17, 71, 86, -29
-};
-
-static const short ugen_H0e135a0c[] = { 
-	2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 1, 1, 
-	-2, 1, -4, 16, -6, 43, 336, 2313, 1681, -1769, -815, 1053, 48, -332, 2887, 5559, 
-	2931, 610, 1245, 435, -770, -1211, -2377, -2557, -1501, -1220, -1252, -634, 353, 520, 339, 795, 
-	1072, 910, 795, 723, 681, 480, 4, -339, -624, -1127, -1553, -1587, -1317, -922, -610, -281, 
-	-2, 156, 308, 356, 324, 247, 65, -86, -188, -306, -389, -431, -424, -397, -363, -282, 
-	-218, -228, -177, -127, -94, -24, 85, 147, 94, 16, -46, -119, -147, -117, -159, -249, 
-	-287, -249, -201, -200, -175, -139, -149, -167, -170, -148, -97, -41, -38, -95, -146, -146, 
-	-118, -99, -64, -46, -67, -85, -72, -55, -80, -111, -128, -130, -115, -101, -92, -97
-};
-
-static const short ugen_H0e135a1c[] = { 
-	52, -78, 96, -110, 112, -198, 3241, 11059, -4613, -12919, 5620, 8286, -4176, 4945, 15134, -1388, 
-	-651, 14742, 5604, -9947, -5476, -1439, -7133, -5994, -4085, -6972, -4890, 756, 1512, -236, 2631, 4730, 
-	2395, 1120, 1574, -214, -2088, -1374, -1317, -2095, -2298, -1617, -1312, -956, -283, -75, 20, 482, 
-	954, 854, 716, 839, 548, -153, -395, -190, -500, -987, -891, -835, -869, -641, -134, 36, 
-	-6, 27, 255, 287, 152, 330, 462, 159, -92, -20, -274, -540, -355, -267, -571, -568, 
-	-238, -133, -82, 187, 223, 46, 57, 166, 141, 116, 115, -58, -218, -217, -151, -186, 
-	-237, -288, -357, -403, -308, -120, -20, -49, -64, -52, -48, -5, 0, -97, -266, -347, 
-	-312, -220, -154, -105, -105, -120, -31, 97, 124, 71, 51, 36, -15, -10, 47, 19
-};
-
-static const short ugen_H0e140a0c[] = { 
-	0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 4, -4, 
-	7, -12, 21, -16, 57, 224, 2313, 2351, -1736, -1446, 1054, 204, -545, 3038, 6298, 3274, 
-	486, 1380, 553, -970, -1322, -2606, -3084, -1805, -1345, -1489, -1000, 175, 740, 571, 1080, 1324, 
-	627, 277, 510, 496, 363, 408, 344, -198, -750, -1024, -1379, -1435, -1037, -778, -646, -486, 
-	-132, 125, 196, 335, 307, 158, 49, -40, -237, -362, -300, -239, -316, -335, -212, -190, 
-	-250, -264, -224, -179, -125, -11, 89, 84, 29, -31, -115, -122, -75, -104, -198, -222, 
-	-167, -162, -186, -189, -173, -190, -209, -192, -168, -112, -52, -54, -118, -145, -125, -92, 
-	-38, -5, -23, -75, -101, -89, -83, -109, -141, -141, -143, -137, -105, -85, -84, -98
-};
-
-static const short ugen_H0e140a1c[] = { 
-	-52, 79, -114, 140, -195, 238, -231, 5808, 8408, -9082, -7460, 8811, 2866, -4881, 9928, 12147, 
-	-3025, 5151, 13617, -1473, -9505, -1811, -3272, -8476, -4733, -4573, -6766, -2596, 1476, 433, 260, 3837, 
-	3983, 1567, 1184, 1197, -805, -1768, -1141, -1528, -2024, -2032, -1513, -1324, -829, -349, -179, 165, 
-	725, 948, 738, 784, 833, 374, -197, -284, -247, -687, -956, -753, -733, -799, -575, -105, 
-	-22, -15, 137, 346, 266, 196, 372, 281, -86, -129, -33, -362, -557, -351, -376, -603, 
-	-416, -123, -119, -39, 233, 202, 82, 119, 134, 65, 101, 104, -91, -261, -250, -160, 
-	-163, -228, -336, -429, -441, -265, -46, 5, -58, -47, -13, -24, -52, -96, -197, -294, 
-	-302, -237, -171, -153, -111, -92, -59, 22, 106, 106, 63, 42, -7, -49, -8, 28
-};
-
-static const short ugen_H0e145a0c[] = { 
-	0, -2, -2, -1, -2, 0, -1, -1, -2, 0, 0, 0, -2, 5, -10, 13, 
-	-20, 26, -29, 62, 147, 2272, 2985, -1602, -2109, 968, 403, -746, 3203, 7096, 3559, 352, 
-	1606, 643, -1293, -1415, -2701, -3619, -2175, -1400, -1713, -1266, 125, 705, 475, 1262, 1650, 882, 
-	360, 252, 90, 65, 132, 215, 164, -214, -752, -1056, -934, -751, -782, -841, -661, -374, 
-	-174, -19, 96, 154, 112, 40, -51, -184, -154, -77, -164, -271, -237, -137, -133, -217, 
-	-260, -237, -211, -193, -131, -38, -1, -22, -60, -101, -116, -78, -90, -152, -163, -113, 
-	-104, -146, -154, -142, -180, -227, -213, -191, -145, -104, -115, -153, -170, -146, -74, 12, 
-	41, 0, -82, -128, -119, -101, -115, -144, -156, -163, -158, -121, -89, -85, -102, -115
-};
-
-static const short ugen_H0e145a1c[] = { 
-	8, -33, 47, -75, 100, -151, 178, 256, 7359, 4905, -10276, -2065, 8085, -1865, -2475, 12846, 
-	8768, -1896, 8774, 9429, -5508, -6457, -595, -6035, -8040, -3688, -5398, -5573, -1077, 1225, -24, 1253, 
-	4378, 2896, 1092, 1281, 868, -1210, -1480, -985, -1440, -1845, -1873, -1502, -1416, -728, -452, -263, 
-	269, 836, 903, 694, 840, 862, 324, -210, -236, -342, -795, -799, -611, -674, -717, -458, 
-	-163, -94, 56, 222, 322, 167, 186, 330, 166, -215, -209, -146, -399, -446, -299, -421, 
-	-534, -263, -75, -122, 6, 231, 167, 101, 127, 90, 19, 60, 11, -108, -145, -125, 
-	-173, -272, -341, -389, -409, -359, -190, -38, -2, -30, -27, -52, -89, -117, -142, -193, 
-	-226, -227, -205, -180, -135, -67, -45, -24, 43, 93, 63, 27, 3, -25, -43, -11
-};
-
-static const short ugen_H0e150a0c[] = { 
-	0, -2, 0, -1, -2, 0, -2, -2, 0, -1, 3, -5, 8, -14, 14, -23, 
-	32, -34, 61, 90, 2209, 3573, -1357, -2762, 769, 649, -922, 3329, 7986, 3845, 132, 1869, 
-	868, -1696, -1633, -2692, -4094, -2570, -1446, -1895, -1505, 41, 779, 485, 1226, 1796, 1046, 405, 
-	462, 211, -272, -256, -44, -113, -361, -434, -637, -702, -428, -400, -513, -559, -422, -292, 
-	-274, -154, -66, -117, -245, -187, -49, 9, -13, -57, -140, -189, -83, -61, -130, -181, 
-	-172, -208, -258, -166, -67, -115, -164, -116, -134, -162, -93, -64, -120, -137, -86, -89, 
-	-121, -77, -70, -129, -160, -182, -195, -175, -152, -169, -216, -211, -148, -65, 12, 53, 
-	4, -93, -149, -132, -92, -89, -122, -158, -168, -156, -123, -96, -100, -110, -113, -96
-};
-
-static const short ugen_H0e150a1c[] = { 
-	11, -9, -3, 12, -36, 49, -84, 73, 949, 7866, 1848, -9157, 1425, 5056, -4048, 886, 
-	13528, 6461, 369, 9441, 4967, -6181, -3564, -1721, -7773, -6502, -3669, -5691, -4084, -497, 732, 168, 
-	2293, 4137, 1967, 913, 1339, 437, -1327, -1181, -997, -1138, -1580, -1763, -1640, -1507, -710, -548, 
-	-324, 299, 857, 878, 728, 871, 879, 319, -208, -227, -372, -754, -688, -574, -608, -620, 
-	-333, -131, -100, 48, 139, 156, 62, 159, 217, 23, -209, -161, -218, -449, -351, -199, 
-	-379, -411, -175, -95, -147, 29, 190, 118, 109, 86, -35, -36, 119, 105, -31, -146, 
-	-194, -256, -304, -343, -391, -384, -285, -127, -56, -59, -57, -54, -96, -128, -112, -105, 
-	-148, -189, -210, -186, -150, -85, -31, -23, -15, 22, 45, 15, 7, -7, -55, -59
-};
-
-static const short ugen_H0e155a0c[] = { 
-	-2, -1, -1, 0, 0, -2, -1, 2, 0, 3, -5, 10, -16, 17, -24, 31, 
-	-29, 58, 52, 2132, 4094, -1032, -3362, 485, 881, -1042, 3411, 8901, 4174, -137, 2126, 1153, 
-	-2056, -1997, -2645, -4466, -3079, -1445, -2012, -1778, 10, 866, 430, 1268, 1999, 1119, 359, 459, 
-	324, -161, -292, -332, -457, -598, -677, -721, -584, -207, 10, -81, -163, -154, -210, -298, 
-	-243, -259, -476, -530, -263, -118, -151, -23, 36, -65, -130, -28, 56, -37, -117, -115, 
-	-152, -199, -148, -98, -146, -185, -215, -287, -282, -105, -14, -120, -156, -106, -74, -74, 
-	-45, -9, -40, -83, -124, -180, -193, -161, -171, -225, -239, -189, -99, -9, 22, -45, 
-	-150, -174, -118, -57, -54, -92, -139, -163, -143, -115, -100, -105, -129, -132, -100, -47
-};
-
-static const short ugen_H0e155a1c[] = { 
-	-11, 24, -26, 17, -16, 2, 2, -19, 0, 1591, 7637, -110, -7012, 2432, 1928, -3858, 
-	3437, 12906, 5686, 2212, 8023, 2062, -4939, -2264, -3676, -7767, -5242, -4240, -5199, -2975, -452, 441, 
-	707, 2915, 3462, 1453, 1059, 1125, -51, -1063, -951, -1024, -904, -1248, -1583, -1891, -1573, -778, 
-	-670, -288, 361, 792, 790, 823, 982, 825, 244, -85, -111, -443, -712, -568, -528, -534, 
-	-488, -240, -102, -78, -77, -51, -22, -65, 49, 137, 30, -107, -35, -216, -468, -326, 
-	-139, -236, -257, -173, -171, -153, 42, 117, 4, 16, 68, 71, 83, 107, 29, -74, 
-	-137, -194, -264, -308, -320, -297, -311, -288, -209, -122, -73, -58, -49, -98, -114, -95, 
-	-86, -120, -153, -168, -149, -102, -53, -22, -17, -11, 6, -3, -17, -18, -17, -38
-};
-
-static const short ugen_H0e160a0c[] = { 
-	-2, -1, 0, -1, -2, -3, 1, 0, 5, -6, 12, -17, 17, -25, 32, -30, 
-	61, 30, 2075, 4537, -693, -3862, 124, 1085, -1107, 3464, 9850, 4532, -441, 2385, 1454, -2364, 
-	-2424, -2707, -4693, -3585, -1557, -2066, -2043, 20, 991, 404, 1255, 2132, 1325, 388, 371, 311, 
-	-252, -297, -202, -588, -883, -852, -1097, -947, -138, 312, 224, 92, 221, 195, -70, -217, 
-	-355, -490, -516, -525, -472, -284, -82, -67, -213, -160, 102, 154, 20, -37, -28, -82, 
-	-149, -118, -20, -70, -206, -279, -368, -369, -209, -89, -142, -188, -107, -62, -79, -10, 
-	53, 36, -43, -118, -169, -145, -96, -119, -189, -251, -221, -141, -64, -52, -127, -221, 
-	-231, -130, -30, -9, -45, -107, -142, -126, -91, -86, -118, -147, -153, -120, -53, 12
-};
-
-static const short ugen_H0e160a1c[] = { 
-	13, -18, 29, -35, 31, -40, 33, -39, 38, -55, 2068, 7033, -870, -5113, 1661, 77, 
-	-2585, 4576, 12064, 6020, 2866, 5912, 1003, -3389, -2566, -4943, -6778, -4926, -4608, -4277, -2403, -699, 
-	669, 1175, 2734, 2953, 1494, 1041, 712, -135, -891, -842, -838, -828, -1108, -1353, -1941, -1761, 
-	-964, -611, -153, 317, 601, 745, 916, 1034, 807, 238, -20, -100, -405, -606, -460, -416, 
-	-462, -430, -270, -195, -154, -172, -226, -214, -157, -19, 146, 109, 1, 7, -163, -360, 
-	-291, -158, -192, -152, -144, -238, -275, -82, 68, 65, 89, 67, 35, 51, 55, 0, 
-	-71, -126, -173, -224, -237, -255, -287, -360, -359, -272, -159, -65, -20, -40, -107, -117, 
-	-90, -69, -65, -99, -144, -137, -93, -33, 0, -4, -43, -50, -44, -44, -18, -22
-};
-
-static const short ugen_H0e165a0c[] = { 
-	-2, 0, -1, -1, -2, 1, -2, 5, -7, 12, -20, 15, -25, 28, -30, 58, 
-	19, 2031, 4907, -345, -4251, -262, 1213, -1102, 3448, 10730, 5021, -761, 2601, 1786, -2634, -2835, 
-	-2828, -4930, -4037, -1694, -2085, -2343, -53, 1239, 407, 1221, 2281, 1423, 469, 407, 270, -358, 
-	-409, -246, -528, -935, -1203, -1253, -929, -419, 5, 274, 406, 473, 409, 214, 73, 27, 
-	-217, -636, -713, -553, -426, -334, -328, -332, -241, -25, 94, 95, 48, 76, 37, -91, 
-	-20, 77, -25, -203, -257, -348, -420, -285, -177, -259, -265, -126, -69, -50, 41, 83, 
-	26, -45, -102, -128, -95, -22, -18, -126, -220, -239, -201, -151, -133, -164, -269, -302, 
-	-195, -46, 12, -12, -58, -103, -92, -67, -72, -107, -143, -163, -144, -77, -2, 20
-};
-
-static const short ugen_H0e165a1c[] = { 
-	-3, 12, -18, 28, -37, 34, -51, 53, -64, 73, -80, 2339, 6388, -771, -4100, 325, 
-	-367, -1381, 4632, 11635, 6712, 2407, 4126, 1227, -2520, -3485, -5083, -5899, -5110, -4470, -3389, -2253, 
-	-881, 1067, 1430, 2226, 2513, 1789, 1058, 338, -85, -755, -846, -602, -665, -1185, -1433, -1699, 
-	-1668, -1230, -604, 51, 213, 382, 749, 976, 1026, 722, 296, 55, -113, -321, -414, -332, 
-	-316, -460, -586, -408, -288, -277, -328, -257, -210, -213, -32, 207, 205, 85, 33, -174, 
-	-281, -155, -108, -238, -291, -234, -227, -243, -84, 54, 93, 64, -15, -60, -17, 68, 
-	74, -2, -92, -149, -195, -228, -266, -315, -388, -394, -308, -158, -61, -31, -49, -98, 
-	-102, -63, -20, -35, -95, -133, -126, -74, -10, 3, -32, -87, -92, -76, -52, -31
-};
-
-static const short ugen_H0e170a0c[] = { 
-	0, 0, -2, -3, 2, -3, 5, -6, 14, -21, 16, -26, 28, -33, 54, 15, 
-	2039, 5197, -73, -4510, -617, 1243, -1041, 3454, 11470, 5593, -985, 2738, 2101, -2852, -3278, -2951, 
-	-5119, -4544, -1891, -2033, -2545, -206, 1405, 518, 1202, 2420, 1589, 451, 375, 310, -358, -509, 
-	-270, -725, -1294, -1054, -1106, -1129, -623, -135, 144, 255, 489, 493, 414, 612, 534, -50, 
-	-484, -522, -553, -638, -568, -452, -522, -516, -193, 29, 47, 38, 55, 72, 71, 128, 
-	178, 57, -120, -239, -369, -441, -305, -175, -284, -362, -231, -102, -61, 45, 89, -5, 
-	-68, -67, -48, -25, 22, 31, -45, -142, -225, -266, -241, -191, -213, -317, -347, -228, 
-	-67, -6, -17, -41, -63, -57, -29, -34, -91, -136, -145, -138, -104, -35, -2, -38
-};
-
-static const short ugen_H0e170a1c[] = { 
-	2, -4, 10, -11, 24, -33, 32, -46, 52, -66, 81, -69, 2398, 5920, -319, -3941, 
-	-719, 8, -753, 4208, 11698, 7208, 1324, 3100, 1894, -2432, -4149, -4607, -5428, -5329, -4029, -2674, 
-	-2382, -852, 1412, 1385, 1794, 2263, 1838, 1127, 445, -292, -659, -683, -590, -559, -1226, -1540, 
-	-1601, -1375, -1104, -718, -67, 268, 404, 671, 848, 869, 751, 403, 144, -15, -224, -316, 
-	-296, -355, -566, -740, -573, -368, -359, -400, -273, -126, -62, 76, 241, 228, 116, 41, 
-	-134, -302, -218, -115, -172, -299, -315, -256, -209, -49, 36, 13, -72, -76, -20, 33, 
-	106, 120, 67, -58, -161, -228, -265, -267, -302, -383, -430, -336, -158, -45, -29, -66, 
-	-81, -63, -23, -1, -30, -82, -111, -102, -72, -25, -10, -58, -119, -116, -87, -60
-};
-
-static const short ugen_H0e175a0c[] = { 
-	0, -2, -3, 3, -2, 4, -6, 15, -22, 18, -25, 28, -36, 53, 9, 2093, 
-	5397, 130, -4602, -925, 1185, -946, 3481, 11947, 6224, -961, 2780, 2347, -2956, -3703, -3187, -5174, 
-	-4990, -2280, -2000, -2616, -342, 1501, 663, 1161, 2479, 1846, 498, 261, 318, -308, -525, -558, 
-	-856, -1126, -1225, -1315, -1105, -596, -246, 23, 99, 185, 429, 795, 926, 589, 249, -35, 
-	-241, -504, -661, -557, -595, -771, -748, -390, -101, -24, -41, 7, 74, 88, 189, 304, 
-	189, -34, -174, -349, -429, -289, -161, -279, -360, -260, -187, -158, -31, 63, -5, -63, 
-	-35, -3, 31, 84, 95, 5, -127, -216, -264, -262, -240, -275, -363, -384, -255, -90, 
-	-14, -22, -49, -54, -42, -3, 1, -45, -108, -151, -137, -101, -51, -26, -59, -100
-};
-
-static const short ugen_H0e175a1c[] = { 
-	-4, 1, -1, 8, -9, 18, -27, 24, -39, 43, -56, 72, -37, 2328, 5660, 39, 
-	-4200, -1158, 573, -642, 3806, 11969, 7199, 190, 2771, 2359, -2717, -4295, -4005, -5256, -5406, -3395, 
-	-2262, -2563, -637, 1576, 1099, 1503, 2278, 1819, 964, 494, 40, -752, -783, -387, -635, -1253, 
-	-1470, -1556, -1318, -798, -490, -246, 90, 524, 621, 558, 799, 845, 552, 192, 26, -181, 
-	-421, -383, -434, -703, -860, -650, -439, -352, -276, -166, -71, 34, 255, 363, 200, 24, 
-	-55, -206, -328, -216, -87, -152, -277, -315, -317, -279, -96, 21, 5, -58, -58, -16, 
-	47, 139, 161, 77, -70, -194, -263, -264, -257, -317, -410, -425, -311, -143, -48, -30, 
-	-60, -76, -51, -8, 21, -5, -69, -120, -125, -88, -45, -30, -75, -126, -116, -87
-};
-
-static const short ugen_H0e180a0c[] = { 
-	-2, -3, 2, -3, 5, -8, 15, -24, 18, -30, 33, -45, 59, -7, 2199, 5529, 
-	191, -4500, -1158, 993, -790, 3571, 12124, 6810, -603, 2757, 2476, -2945, -4063, -3529, -5219, -5272, 
-	-2799, -2069, -2630, -453, 1569, 846, 1283, 2370, 1897, 743, 290, 265, -400, -868, -518, -606, 
-	-1258, -1357, -1432, -1301, -661, -167, -83, -172, 222, 717, 667, 708, 833, 592, 148, -153, 
-	-297, -431, -520, -622, -814, -875, -559, -306, -257, -148, 8, 39, 61, 234, 375, 222, 
-	-46, -140, -248, -332, -246, -135, -207, -340, -300, -265, -264, -123, 52, 47, -52, -67, 
-	-31, 60, 154, 166, 36, -123, -208, -253, -265, -275, -307, -388, -406, -288, -119, -32, 
-	-34, -50, -65, -40, 2, 25, -13, -86, -133, -142, -107, -49, -24, -75, -123, -109
-};
-
-static const short ugen_H0e180a1c[] = { 
-	-2, -3, 2, -3, 5, -8, 15, -24, 18, -30, 33, -45, 59, -7, 2199, 5529, 
-	191, -4500, -1158, 993, -790, 3571, 12124, 6810, -603, 2757, 2476, -2945, -4063, -3529, -5219, -5272, 
-	-2799, -2069, -2630, -453, 1569, 846, 1283, 2370, 1897, 743, 290, 265, -400, -868, -518, -606, 
-	-1258, -1357, -1432, -1301, -661, -167, -83, -172, 222, 717, 667, 708, 833, 592, 148, -153, 
-	-297, -431, -520, -622, -814, -875, -559, -306, -257, -148, 8, 39, 61, 234, 375, 222, 
-	-46, -140, -248, -332, -246, -135, -207, -340, -300, -265, -264, -123, 52, 47, -52, -67, 
-	-31, 60, 154, 166, 36, -123, -208, -253, -265, -275, -307, -388, -406, -288, -119, -32, 
-	-34, -50, -65, -40, 2, 25, -13, -86, -133, -142, -107, -49, -24, -75, -123, -109
-};
-
-static const short ugen_H10e000a0c[] = { 
-	7, -9, 20, -17, 25, -26, 17, -8, -9, 26, -40, 37, 1897, 8087, -527, -4302, 
-	776, -5854, 2707, 7237, 3221, 11157, 10654, -3430, -4558, 3600, -4771, -13165, -5592, -949, -5731, -3427, 
-	2125, 266, 869, 3636, 2541, 1093, 2452, 2422, 425, -146, 658, -19, -1272, -693, -571, -1971, 
-	-2856, -1623, -423, -256, -300, -389, -501, -84, 303, 160, -127, 16, 258, 130, -197, -165, 
-	-68, -453, -597, -580, -650, -368, 24, -104, -223, -19, 5, -115, 35, 145, -73, -266, 
-	-266, -208, -168, -182, -148, -146, -224, -186, -60, 0, -14, 3, -48, -134, -100, 29, 
-	-13, -85, -85, -195, -296, -259, -227, -191, -117, -137, -151, -17, 125, 176, 135, -8, 
-	-106, -122, -138, -141, -114, -185, -241, -150, -79, -39, -17, -92, -159, -112, -66, -52
-};
-
-static const short ugen_H10e000a1c[] = { 
-	7, -9, 20, -17, 25, -26, 17, -8, -9, 26, -40, 37, 1897, 8087, -527, -4302, 
-	776, -5854, 2707, 7237, 3221, 11157, 10654, -3430, -4558, 3600, -4771, -13165, -5592, -949, -5731, -3427, 
-	2125, 266, 869, 3636, 2541, 1093, 2452, 2422, 425, -146, 658, -19, -1272, -693, -571, -1971, 
-	-2856, -1623, -423, -256, -300, -389, -501, -84, 303, 160, -127, 16, 258, 130, -197, -165, 
-	-68, -453, -597, -580, -650, -368, 24, -104, -223, -19, 5, -115, 35, 145, -73, -266, 
-	-266, -208, -168, -182, -148, -146, -224, -186, -60, 0, -14, 3, -48, -134, -100, 29, 
-	-13, -85, -85, -195, -296, -259, -227, -191, -117, -137, -151, -17, 125, 176, 135, -8, 
-	-106, -122, -138, -141, -114, -185, -241, -150, -79, -39, -17, -92, -159, -112, -66, -52
-};
-
-static const short ugen_H10e005a0c[] = { 
-	-4, 6, -9, 16, -13, 21, -24, 18, -15, -4, 14, -21, 22, 1888, 7148, -517, 
-	-3413, 594, -5274, 2422, 6184, 3199, 10324, 9506, -2415, -3416, 2855, -4645, -11379, -5061, -1569, -5184, 
-	-2854, 1568, 35, 907, 3052, 2059, 1303, 2376, 1942, 286, 66, 773, 121, -890, -618, -636, 
-	-1598, -2411, -1596, -646, -691, -461, -48, -199, -41, 279, 336, 71, -148, -256, -226, -253, 
-	-285, -268, -509, -483, -442, -518, -263, 21, -89, -199, -15, 47, -61, -5, 73, -19, 
-	-191, -230, -262, -242, -193, -170, -158, -210, -150, -35, 9, 7, 31, -35, -166, -114, 
-	13, -42, -112, -116, -186, -262, -209, -205, -239, -185, -154, -129, -31, 98, 181, 157, 
-	23, -81, -103, -120, -134, -123, -184, -213, -143, -100, -65, -26, -88, -162, -123, -75
-};
-
-static const short ugen_H10e005a1c[] = { 
-	-4, 12, -6, 5, 4, -26, 41, -80, 120, -162, 177, 893, 8460, 2318, -6243, 873, 
-	-5713, 637, 8685, 3188, 10648, 13055, -1957, -6853, 3246, -2533, -13772, -8039, -897, -4841, -4903, 1646, 
-	831, 517, 3588, 3250, 1251, 2033, 2898, 1128, -7, 461, 215, -1323, -1042, -792, -2130, -2875, 
-	-1975, -682, 56, 94, -416, -958, -408, 163, -106, -364, 307, 747, 379, 63, 27, 122, 
-	-281, -590, -643, -770, -556, -76, -102, -244, -95, -94, -193, -9, 152, -3, -249, -256, 
-	-186, -122, -97, -104, -112, -236, -258, -129, -39, -45, 0, -31, -177, -172, 34, 48, 
-	-30, -68, -204, -322, -239, -160, -171, -108, -113, -144, -42, 106, 179, 131, -16, -137, 
-	-149, -148, -156, -121, -193, -264, -186, -97, -34, 41, -28, -165, -135, -70, -46, 9
-};
-
-static const short ugen_H10e010a0c[] = { 
-	-2, -1, 5, -8, 16, -13, 21, -25, 28, -30, 17, -10, 19, -1, 2131, 6295, 
-	-934, -2467, 33, -4444, 2570, 5022, 3835, 9626, 7873, -1765, -2305, 1751, -4667, -9527, -4722, -1982, 
-	-4398, -2248, 972, 91, 1066, 2370, 1791, 1588, 2007, 1343, 420, 338, 785, 169, -695, -584, 
-	-745, -1487, -1898, -1383, -923, -770, -274, 127, -96, -102, 140, 268, 109, -256, -535, -439, 
-	-358, -343, -377, -512, -365, -300, -424, -267, 6, -58, -132, -18, 11, -35, 23, 89, 
-	0, -140, -236, -300, -263, -230, -177, -158, -199, -138, -16, 18, 4, 17, -30, -147, 
-	-146, -37, -57, -92, -116, -203, -246, -181, -193, -247, -201, -162, -115, -4, 100, 154, 
-	131, 31, -55, -105, -144, -139, -106, -161, -193, -141, -99, -62, -32, -103, -168, -122
-};
-
-static const short ugen_H10e010a1c[] = { 
-	5, 10, -15, 35, -61, 84, -130, 180, -224, 264, 279, 8084, 5262, -7289, -9, -5095, 
-	-1351, 9816, 3334, 10347, 15231, -847, -8411, 2575, -1267, -13964, -9233, -1448, -4555, -5321, 1215, 729, 
-	242, 3764, 3451, 1559, 1924, 2880, 1579, 510, 587, 290, -1126, -1390, -1409, -2073, -2763, -2337, 
-	-895, 79, 274, -119, -1012, -942, -399, -271, -117, 462, 798, 604, 398, 241, 333, -114, 
-	-538, -597, -791, -683, -191, -127, -315, -175, -137, -279, -163, 106, 63, -171, -193, -157, 
-	-89, 10, 3, -65, -258, -322, -241, -111, -31, 15, -44, -220, -219, 4, 93, -15, 
-	-94, -189, -278, -189, -94, -119, -74, -84, -154, -66, 89, 150, 133, -6, -154, -177, 
-	-166, -169, -124, -185, -298, -234, -130, -43, 76, 46, -102, -121, -77, -66, -3, 36
-};
-
-static const short ugen_H10e015a0c[] = { 
-	0, -2, -1, 3, -6, 14, -12, 19, -22, 25, -33, 27, -21, 38, -10, 2145, 
-	5539, -907, -2047, -174, -3641, 2119, 4529, 4138, 8495, 6941, -928, -1972, 1000, -3844, -8266, -4705, 
-	-1836, -3657, -2242, 598, 294, 787, 1753, 1894, 1559, 1391, 1312, 778, 367, 712, 300, -538, 
-	-577, -834, -1473, -1428, -1035, -1100, -721, 15, -3, -380, -231, 24, 81, -28, -245, -476, 
-	-474, -427, -380, -383, -427, -304, -298, -398, -232, 7, -60, -100, 11, -15, -46, 56, 
-	92, -11, -139, -228, -281, -238, -205, -168, -162, -193, -139, -45, -5, -18, 0, -44, 
-	-147, -137, -56, -47, -73, -117, -202, -242, -195, -188, -180, -149, -150, -116, -12, 86, 
-	118, 89, 7, -59, -90, -134, -121, -97, -153, -176, -126, -95, -85, -55, -94, -137
-};
-
-static const short ugen_H10e015a1c[] = { 
-	26, -38, 61, -89, 110, -153, 189, -219, 262, -125, 6618, 8831, -6915, -2421, -3614, -3801, 
-	9858, 4671, 9059, 17340, 2051, -10202, 812, 696, -13706, -11325, -1751, -3687, -6397, 701, 1418, -701, 
-	3591, 4025, 1620, 1858, 2995, 1706, 877, 1000, 697, -1008, -2110, -1579, -1636, -2922, -2756, -1171, 
-	-112, 229, 242, -812, -1655, -1079, -80, 435, 438, 627, 660, 685, 439, 413, 68, -407, 
-	-491, -777, -771, -248, -148, -425, -291, -165, -375, -312, 39, 99, -90, -173, -120, -55, 
-	92, 102, 19, -231, -425, -340, -140, -42, -10, -73, -244, -291, -70, 65, -35, -58, 
-	-131, -241, -158, -28, -59, -59, -63, -144, -109, 46, 137, 134, -15, -185, -217, -182, 
-	-174, -137, -173, -313, -287, -167, -64, 67, 88, -55, -109, -69, -60, -22, 21, -35
-};
-
-static const short ugen_H10e020a0c[] = { 
-	0, 0, -1, 0, 2, -3, 12, -10, 17, -19, 21, -26, 24, -19, 38, -5, 
-	1984, 4942, -718, -1855, -84, -3157, 1633, 4337, 3973, 7422, 6508, -300, -1950, 830, -2917, -7490, 
-	-4496, -1446, -3323, -2345, 522, 256, 273, 1559, 1960, 1137, 1245, 1546, 783, 341, 869, 396, 
-	-570, -607, -812, -1124, -1026, -993, -1044, -584, -125, -361, -669, -421, -110, -49, -125, -109, 
-	-195, -388, -496, -363, -301, -422, -366, -330, -313, -143, -31, -83, -65, 1, -51, -92, 
-	5, 81, 10, -100, -174, -207, -182, -192, -177, -166, -197, -185, -108, -46, -28, -15, 
-	-50, -133, -140, -49, -44, -82, -105, -170, -228, -193, -150, -124, -108, -132, -132, -52, 
-	52, 93, 51, -24, -67, -75, -108, -119, -97, -133, -157, -120, -107, -93, -52, -77
-};
-
-static const short ugen_H10e020a1c[] = { 
-	-31, 59, -81, 84, -106, 103, -93, 94, -115, 4247, 11486, -3826, -5757, -2464, -5190, 8181, 
-	5849, 8243, 18248, 5789, -9549, -2281, 1560, -11583, -13349, -4050, -2089, -6052, -1396, 2180, -537, 2550, 
-	4185, 2130, 1601, 2973, 2102, 954, 1389, 1246, -998, -2546, -1311, -1283, -2871, -3080, -1913, -422, 
-	245, 231, -734, -2117, -1490, 409, 962, 253, 517, 793, 794, 466, 281, 240, -184, -399, 
-	-642, -809, -355, -21, -444, -476, -254, -390, -411, -81, 172, 0, -202, -132, -8, 135, 
-	179, 82, -208, -396, -311, -173, -107, -54, -46, -267, -410, -223, -9, 13, 3, -56, 
-	-177, -134, 27, -4, -51, -46, -112, -146, -10, 124, 142, 0, -195, -232, -217, -203, 
-	-154, -136, -272, -321, -210, -91, 71, 126, -23, -135, -92, -39, -4, 21, -30, -79
-};
-
-static const short ugen_H10e025a0c[] = { 
-	-3, 0, 0, -1, 0, 3, -2, 10, -8, 13, -16, 18, -21, 20, -11, 34, 
-	1, 1707, 4476, -470, -1713, 107, -2886, 1268, 4122, 3552, 6586, 6239, 117, -1862, 971, -2209, 
-	-6777, -4074, -1279, -3130, -2302, 405, -55, -10, 1591, 1703, 923, 1264, 1509, 890, 541, 833, 
-	207, -455, -389, -584, -750, -880, -1201, -1079, -520, -469, -803, -937, -533, -151, -83, -29, 
-	63, 11, -218, -459, -423, -291, -385, -414, -304, -236, -130, -70, -131, -122, -95, -114, 
-	-126, -15, 117, 95, -35, -114, -151, -170, -169, -164, -200, -257, -240, -143, -73, -46, 
-	-18, -63, -138, -132, -55, -41, -72, -83, -139, -181, -152, -141, -124, -106, -113, -133, 
-	-63, 21, 42, 16, -60, -84, -90, -91, -91, -89, -108, -142, -118, -117, -94, -56
-};
-
-static const short ugen_H10e025a1c[] = { 
-	21, -27, 9, -1, -45, 96, -146, 151, 1823, 12026, 1895, -8653, -3212, -5420, 5791, 6845, 
-	6986, 19050, 9770, -7727, -4311, 889, -9468, -13534, -7280, -2764, -4252, -2618, 1460, -102, 2250, 4203, 
-	2193, 1737, 2766, 2315, 1202, 1492, 1287, -1237, -2066, -800, -1368, -2316, -3098, -2854, -995, 430, 
-	-62, -1414, -2190, -1056, 615, 887, 471, 606, 859, 777, 411, 190, 244, 0, -263, -619, 
-	-771, -391, -66, -399, -528, -434, -460, -412, -85, 249, 92, -173, -157, 10, 112, 120, 
-	15, -146, -276, -279, -247, -135, -19, -39, -275, -488, -390, -84, 56, 43, -22, -113, 
-	-95, 10, 5, -2, -6, -128, -173, -49, 107, 118, 19, -156, -254, -254, -236, -175, 
-	-138, -239, -323, -245, -106, 65, 144, 4, -127, -124, -83, -29, 23, -10, -99, -119
-};
-
-static const short ugen_H10e030a0c[] = { 
-	-4, -1, 0, 0, -1, 0, 2, -3, 8, -8, 11, -12, 10, -11, 9, -5, 
-	28, -11, 1389, 4040, -154, -1558, 228, -2631, 920, 3785, 3140, 5872, 5965, 496, -1619, 1084, 
-	-1588, -5911, -3770, -1239, -2868, -2261, 130, -305, 53, 1439, 1291, 875, 1280, 1620, 1014, 435, 
-	680, 416, -84, -257, -310, -591, -1275, -1469, -945, -698, -969, -1088, -954, -503, -117, 23, 
-	93, 192, 167, -89, -406, -405, -267, -339, -362, -299, -259, -202, -159, -202, -260, -185, 
-	-121, -77, 49, 153, 124, 8, -46, -107, -143, -185, -200, -235, -292, -254, -189, -106, 
-	-59, -39, -56, -137, -140, -52, -29, -46, -65, -111, -136, -120, -137, -136, -97, -112, 
-	-124, -86, -45, -27, -25, -61, -109, -94, -70, -53, -53, -106, -143, -136, -123, -103
-};
-
-static const short ugen_H10e030a1c[] = { 
-	29, -65, 91, -149, 210, -270, 330, 228, 9770, 8315, -8074, -6151, -5121, 3289, 7183, 5695, 
-	18390, 13573, -4503, -5089, 209, -7891, -13009, -9481, -4939, -3425, -3155, 1014, 294, 1262, 4546, 2848, 
-	1405, 2553, 2647, 1483, 1397, 456, -740, -1123, -804, -960, -1781, -3051, -3357, -1604, 68, -596, 
-	-2203, -1942, -128, 533, 512, 829, 1112, 903, 503, 373, 210, 187, 0, -194, -596, -726, 
-	-373, -127, -223, -490, -537, -593, -425, 16, 272, 164, -96, -68, -9, -5, 18, 25, 
-	-48, -235, -246, -201, -135, -48, -58, -248, -472, -441, -146, 34, 85, 52, -70, -117, 
-	-26, 64, 58, 19, -105, -181, -86, 52, 131, 62, -101, -249, -285, -233, -161, -110, 
-	-200, -306, -275, -130, 52, 167, 81, -88, -142, -114, -46, 16, -6, -94, -121, -75
-};
-
-static const short ugen_H10e035a0c[] = { 
-	-3, 0, -1, 0, 0, -1, 0, 1, -3, 5, -7, 8, -10, 9, -5, -2, 
-	8, 10, -4, 1054, 3597, 254, -1434, 303, -2311, 531, 3400, 2792, 5175, 5653, 941, -1316, 
-	1127, -948, -5041, -3577, -1239, -2581, -2238, -112, -276, -20, 929, 1177, 1041, 1207, 1511, 1022, 
-	588, 855, 732, 94, -292, -402, -839, -1539, -1573, -1097, -996, -1138, -1130, -853, -367, -45, 
-	119, 201, 276, 253, 52, -291, -344, -220, -296, -388, -392, -359, -317, -261, -289, -317, 
-	-199, -65, -12, 80, 186, 152, 55, -15, -73, -142, -241, -246, -230, -285, -291, -206, 
-	-128, -78, -42, -67, -138, -129, -41, -35, -46, -34, -56, -98, -100, -101, -123, -132, 
-	-145, -153, -121, -95, -58, -39, -63, -93, -82, -38, -38, -53, -111, -148, -128, -115
-};
-
-static const short ugen_H10e035a1c[] = { 
-	-74, 102, -155, 170, -205, 244, -268, 5824, 12517, -3084, -9443, -6177, 1339, 7066, 4303, 16771, 
-	17046, -1391, -4587, 353, -6743, -11888, -10449, -8200, -3566, -3064, -803, 858, 1315, 3883, 3372, 2138, 
-	2297, 2709, 1898, 927, -895, -31, 224, -1168, -597, -1162, -2780, -3524, -2047, -668, -1647, -2588, 
-	-1367, 273, 311, 431, 1030, 1503, 1157, 281, 159, 274, 221, -104, -346, -520, -713, -549, 
-	-177, -61, -399, -586, -654, -416, 9, 218, 250, 104, -8, -96, -125, -72, 5, -20, 
-	-223, -289, -230, -149, -104, -108, -175, -362, -441, -265, 18, 140, 76, -87, -177, -89, 
-	27, 91, 41, -102, -203, -160, -29, 115, 121, -62, -257, -322, -257, -158, -118, -174, 
-	-267, -301, -225, -30, 160, 127, -39, -152, -168, -94, -7, -27, -119, -158, -107, 0
-};
-
-static const short ugen_H10e040a0c[] = { 
-	0, -1, -1, -1, 0, 0, -1, 0, 1, -2, 4, -6, 5, -5, 6, 0, 
-	-8, 14, 3, 0, 736, 3140, 700, -1309, 319, -1912, 77, 3009, 2499, 4482, 5348, 1425, 
-	-943, 1095, -343, -4191, -3436, -1276, -2175, -2091, -404, -392, -216, 754, 1210, 815, 1037, 1734, 
-	1357, 834, 995, 693, -215, -493, -509, -1148, -1782, -1641, -1220, -1055, -1085, -1054, -709, -232, 
-	51, 197, 265, 386, 367, 113, -169, -242, -255, -394, -472, -460, -478, -441, -316, -300, 
-	-305, -177, -22, 61, 115, 196, 181, 60, -26, -90, -169, -259, -243, -227, -277, -277, 
-	-217, -149, -103, -71, -85, -126, -106, -48, -32, -20, 8, -6, -66, -91, -116, -154, 
-	-171, -175, -171, -153, -108, -64, -39, -54, -71, -54, -55, -62, -55, -89, -130, -117
-};
-
-static const short ugen_H10e040a1c[] = { 
-	13, -31, 9, 19, -54, 34, 1972, 12630, 4691, -9938, -9005, -1142, 7187, 3238, 13406, 20447, 
-	2422, -4588, 1086, -4461, -11188, -9998, -10413, -6078, -2652, -2047, -86, 734, 4224, 3985, 2252, 2632, 
-	3666, 2119, -489, -1261, 184, 796, -737, -300, -952, -2437, -2961, -2465, -1809, -2604, -2483, -839, 
-	75, 157, 618, 1210, 1624, 1408, 381, 63, 204, 169, -52, -486, -561, -744, -702, -223, 
-	-97, -333, -463, -540, -412, -63, 210, 359, 273, 67, -55, -182, -182, -28, 6, -176, 
-	-358, -310, -269, -185, -28, -33, -254, -392, -270, -33, 162, 168, -35, -223, -174, -26, 
-	52, 60, -41, -205, -234, -110, 96, 191, 21, -208, -318, -288, -165, -87, -122, -226, 
-	-296, -277, -114, 123, 169, 25, -135, -174, -117, -34, -23, -92, -152, -162, -56, 72
-};
-
-static const short ugen_H10e045a0c[] = { 
-	0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 3, -3, 3, 1, 2, 
-	2, -10, 22, -6, 10, 468, 2627, 1142, -1129, 287, -1472, -356, 2580, 2232, 3809, 5022, 
-	1958, -542, 999, 190, -3337, -3237, -1182, -1754, -2195, -695, -305, -335, 400, 939, 945, 1398, 
-	2039, 1611, 721, 561, 379, -399, -716, -805, -1385, -1778, -1535, -1168, -981, -1008, -935, -522, 
-	-73, 127, 249, 370, 472, 397, 151, -119, -290, -334, -452, -569, -561, -540, -447, -320, 
-	-297, -251, -108, 46, 109, 121, 161, 141, 35, -55, -95, -160, -228, -234, -218, -236, 
-	-275, -237, -181, -137, -93, -86, -94, -79, -13, 4, 4, 28, 0, -61, -114, -137, 
-	-159, -166, -169, -186, -167, -115, -48, -21, -36, -58, -71, -70, -56, -36, -66, -104
-};
-
-static const short ugen_H10e045a1c[] = { 
-	62, -129, 190, -250, 314, -106, 8489, 11888, -5575, -11993, -4998, 6173, 4241, 7963, 22254, 8173, 
-	-4815, 1333, -1568, -9933, -9171, -10587, -9432, -3098, -2951, -1374, -215, 2869, 4780, 3296, 2912, 4078, 
-	3396, -1429, -1646, 161, 616, -32, -123, -630, -2149, -2494, -2677, -2798, -3450, -2324, -329, -234, 
-	-257, 809, 1629, 1581, 1371, 734, 184, 122, 62, -167, -424, -558, -873, -893, -346, -115, 
-	-327, -467, -363, -285, -112, 122, 440, 429, 187, 31, -179, -258, -80, 26, -169, -393, 
-	-437, -402, -263, -19, 70, -82, -286, -272, -96, 138, 238, 106, -179, -270, -136, -6, 
-	49, -32, -184, -285, -192, 34, 222, 131, -133, -284, -296, -193, -64, -82, -177, -275, 
-	-311, -205, 50, 184, 74, -71, -176, -152, -49, -16, -60, -117, -172, -137, 4, 90
-};
-
-static const short ugen_H10e050a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 7, 
-	-6, 8, -13, 16, -5, 22, 254, 2072, 1527, -866, 166, -989, -712, 2071, 1987, 3226, 
-	4656, 2422, -62, 868, 636, -2318, -2920, -1377, -1497, -1981, -856, -603, -692, 417, 1255, 1318, 
-	1691, 1867, 1088, 379, 309, -26, -751, -882, -944, -1368, -1507, -1330, -1107, -894, -861, -735, 
-	-361, 21, 219, 279, 401, 481, 318, 59, -137, -313, -458, -560, -595, -557, -520, -441, 
-	-316, -246, -137, -31, 32, 75, 65, 83, 80, 29, -41, -101, -140, -195, -212, -230, 
-	-259, -270, -252, -204, -162, -107, -62, -46, -39, -9, -1, -2, 8, -19, -86, -114, 
-	-121, -150, -163, -188, -207, -174, -98, -43, -28, -40, -72, -69, -60, -51, -37, -58
-};
-
-static const short ugen_H10e050a1c[] = { 
-	-46, 48, -42, 26, -88, 2808, 13752, 3975, -12682, -9678, 2568, 6517, 3522, 19245, 16326, -3701, 
-	-320, 2053, -7524, -9357, -8825, -11541, -5587, -2743, -2899, -1511, 680, 4696, 3692, 3416, 5254, 4247, 
-	-1472, -1396, 427, -320, 324, 210, -223, -2023, -2096, -2720, -4002, -3922, -2064, -308, -449, -269, 
-	612, 1748, 1839, 1424, 909, 263, 180, 154, -320, -556, -471, -833, -1148, -594, -240, -296, 
-	-466, -333, -206, -92, 136, 399, 575, 394, 114, -152, -284, -128, 18, -192, -451, -509, 
-	-468, -402, -68, 105, 24, -138, -221, -172, 32, 305, 251, -90, -279, -221, -120, -16, 
-	-21, -180, -338, -271, -54, 193, 208, -9, -219, -302, -245, -76, -26, -136, -249, -325, 
-	-293, -66, 153, 114, -21, -144, -171, -90, -18, -32, -84, -164, -188, -78, 34, 44
-};
-
-static const short ugen_H10e055a0c[] = { 
-	0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 
-	9, -5, 14, -15, 13, 6, 30, 101, 1535, 1771, -495, 28, -537, -930, 1475, 1793, 
-	2707, 4222, 2840, 487, 912, 1090, -1563, -2701, -1316, -1111, -2040, -1441, -644, -186, 832, 1434, 
-	1208, 1102, 1271, 849, 96, -259, -438, -768, -825, -867, -1105, -1235, -1187, -892, -694, -770, 
-	-589, -168, 88, 179, 291, 320, 298, 242, 32, -236, -431, -488, -522, -532, -512, -481, 
-	-389, -238, -138, -101, -78, -23, 13, 0, 27, 71, 29, -29, -74, -133, -190, -224, 
-	-225, -258, -261, -237, -207, -160, -95, -23, -27, -45, -19, -1, -23, -27, -15, -58, 
-	-93, -119, -162, -185, -178, -178, -167, -103, -52, -29, -42, -61, -51, -48, -58, -59
-};
-
-static const short ugen_H10e055a1c[] = { 
-	-101, 165, -231, 273, -121, 8366, 13476, -6382, -14607, -3072, 7043, 3148, 11283, 22682, 2513, -4024, 
-	4092, -2869, -9176, -7728, -10954, -9285, -2855, -3599, -2569, -1488, 2295, 4477, 3358, 5198, 5323, 548, 
-	-1446, 382, -77, 506, -73, -61, -1036, -2303, -2745, -4747, -4764, -2061, -209, -721, -282, 660, 
-	1559, 1968, 1667, 1221, 384, 36, 206, -119, -558, -633, -807, -1162, -900, -486, -385, -480, 
-	-284, -169, -204, 102, 477, 747, 569, 208, -57, -209, -241, -69, -128, -429, -562, -541, 
-	-481, -198, 105, 122, -66, -201, -166, -13, 246, 342, 86, -228, -274, -197, -83, -31, 
-	-157, -351, -362, -178, 103, 252, 125, -111, -258, -289, -155, 2, -50, -180, -317, -366, 
-	-208, 72, 162, 32, -110, -189, -129, -8, 0, -54, -134, -210, -165, -19, 39, 7
-};
-
-static const short ugen_H10e060a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 
-	1, 8, -7, 14, -18, 12, 18, 16, 25, 1036, 1825, -10, -126, -187, -951, 845, 
-	1551, 2284, 3811, 3257, 1270, 834, 1047, -639, -2034, -1616, -1380, -1818, -1088, -100, 327, 586, 
-	537, 660, 820, 742, 295, -266, -507, -517, -531, -564, -761, -921, -873, -804, -736, -664, 
-	-620, -422, -137, 51, 86, 75, 179, 229, 102, -106, -280, -407, -430, -412, -450, -458, 
-	-389, -280, -202, -163, -147, -144, -68, -38, -41, 6, 43, 28, -19, -85, -156, -180, 
-	-200, -219, -238, -240, -219, -195, -150, -87, -45, -28, -33, -37, -34, -27, 2, -11, 
-	-64, -109, -139, -161, -156, -157, -183, -162, -101, -53, -39, -37, -37, -55, -73, -92
-};
-
-static const short ugen_H10e060a1c[] = { 
-	-40, 87, -140, 123, 1520, 13665, 7501, -14635, -11125, 3846, 6233, 3787, 20362, 14666, -5616, 1569, 
-	2942, -6782, -8009, -8192, -11560, -5894, -2873, -3670, -2425, -809, 3518, 3405, 4634, 5525, 1884, 123, 
-	933, -88, 457, 1037, -477, -576, -1668, -2822, -5209, -5893, -2645, -354, -725, -510, 685, 1473, 
-	1959, 1877, 1626, 816, -26, 24, -33, -308, -507, -870, -1181, -1148, -771, -543, -549, -362, 
-	-167, -228, -38, 464, 831, 838, 455, 49, -144, -287, -209, -111, -274, -508, -635, -560, 
-	-335, 28, 209, 21, -201, -206, -46, 179, 365, 248, -92, -265, -266, -163, -29, -73, 
-	-306, -440, -314, -56, 209, 255, 41, -174, -295, -240, -24, 26, -101, -256, -375, -318, 
-	-69, 142, 101, -40, -170, -191, -51, 42, 15, -76, -191, -240, -109, 32, 36, 17
-};
-
-static const short ugen_H10e065a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 
-	0, 3, 3, -2, 9, -16, 19, 18, 0, -6, 651, 1699, 475, -191, 42, -804, 
-	203, 1260, 2079, 3711, 3476, 1526, 991, 1370, -120, -1984, -1750, -681, -707, -638, -356, -450, 
-	-211, 103, 188, 141, 182, 41, -280, -443, -289, -225, -503, -541, -429, -519, -644, -623, 
-	-563, -579, -389, -198, -178, -131, -35, 56, 52, 13, -103, -229, -290, -311, -313, -370, 
-	-356, -287, -275, -245, -228, -199, -166, -112, -77, -73, -22, 11, 25, -28, -96, -131, 
-	-157, -177, -213, -217, -209, -198, -176, -158, -105, -50, -28, -44, -38, -21, -16, -19, 
-	-39, -69, -107, -121, -143, -152, -155, -163, -140, -101, -67, -43, -36, -68, -97, -105
-};
-
-static const short ugen_H10e065a1c[] = { 
-	71, -96, 111, -179, 4882, 16173, -1472, -18219, -4662, 7732, 3591, 9531, 22846, 3175, -5197, 5407, 
-	-363, -8153, -7190, -9177, -10006, -3952, -3730, -3487, -2458, 796, 3579, 3581, 4855, 2728, 1405, 1296, 
-	867, 885, 1490, 159, -327, -524, -2853, -5031, -6752, -4268, -1041, -671, -718, 286, 1479, 1987, 
-	1962, 1807, 1600, 449, -308, -156, -110, -274, -711, -1039, -1281, -1252, -772, -610, -515, -332, 
-	-209, -128, 280, 787, 993, 783, 294, 24, -278, -391, -167, -84, -364, -650, -633, -460, 
-	-148, 186, 173, -115, -263, -140, 50, 294, 378, 132, -204, -306, -226, -105, 0, -160, 
-	-401, -445, -258, 54, 286, 207, -48, -239, -299, -133, 58, 0, -186, -334, -369, -209, 
-	43, 124, 24, -106, -207, -156, 11, 67, 8, -94, -242, -225, -39, 65, 36, 5
-};
-
-static const short ugen_H10e070a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 
-	0, 0, 4, -1, 4, 1, -5, 17, 5, -6, 0, 373, 1424, 911, -138, 145, 
-	-556, -304, 1189, 2059, 3180, 3466, 2278, 1086, 767, 225, -742, -527, 110, -700, -1685, -1267, 
-	-687, -854, -810, -381, -95, 10, 50, 24, -192, -171, -63, -99, -114, -222, -348, -437, 
-	-544, -636, -629, -527, -428, -364, -301, -190, -49, 33, 49, -25, -99, -157, -222, -241, 
-	-263, -280, -297, -323, -321, -276, -211, -197, -158, -116, -97, -44, 3, 22, -22, -83, 
-	-119, -144, -173, -191, -178, -174, -186, -180, -160, -112, -65, -28, -18, -38, -45, -45, 
-	-31, -34, -59, -91, -123, -139, -137, -142, -143, -128, -106, -93, -89, -85, -95, -97
-};
-
-static const short ugen_H10e070a1c[] = { 
-	157, -252, 330, -236, 8926, 15235, -9940, -17618, 1839, 8322, 2487, 16313, 18435, -4606, -1060, 6357, 
-	-2942, -8650, -6932, -9393, -7978, -3450, -4146, -3787, -2307, 2392, 3900, 3731, 2593, 1526, 2468, 1141, 
-	1207, 1940, 1681, 124, 7, -1176, -4482, -7122, -6200, -2265, -1175, -1165, -143, 1138, 1865, 2100, 
-	1969, 1881, 1415, 213, -469, -281, -43, -401, -846, -1095, -1431, -1320, -832, -611, -477, -413, 
-	-194, 130, 532, 949, 1094, 639, 148, -32, -329, -402, -88, -91, -493, -724, -557, -324, 
-	-10, 259, 82, -210, -264, -78, 106, 330, 332, 26, -253, -313, -187, -30, -6, -260, 
-	-452, -395, -179, 159, 306, 117, -135, -273, -245, -50, 71, -59, -230, -356, -344, -120, 
-	102, 86, -44, -169, -229, -103, 55, 77, -6, -129, -251, -165, 24, 68, 31, -28
-};
-
-static const short ugen_H10e075a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 
-	1, 0, 0, 3, -1, 12, 2, 0, 10, 3, -1, 17, 211, 1094, 1147, 95, 
-	257, -66, -418, 574, 1733, 3307, 3529, 1852, 920, 1587, 1990, 1001, -445, -1256, -1571, -1883, 
-	-1863, -1700, -1587, -1110, -497, -79, 188, 313, 223, -5, 100, 391, 242, -40, -95, -141, 
-	-350, -671, -845, -786, -684, -642, -574, -403, -181, 17, 103, 122, 90, 28, -67, -152, 
-	-159, -209, -308, -370, -377, -338, -281, -263, -242, -172, -120, -85, -42, 8, 21, -25, 
-	-83, -119, -128, -128, -136, -157, -164, -164, -167, -159, -123, -57, -23, -25, -50, -48, 
-	-28, -30, -25, -46, -83, -110, -128, -127, -127, -124, -140, -155, -140, -108, -82, -83
-};
-
-static const short ugen_H10e075a1c[] = { 
-	172, -295, 387, 129, 12337, 12210, -15902, -14930, 6813, 7129, 3425, 20737, 11392, -7702, 2981, 6284, 
-	-4683, -8984, -6543, -9194, -6523, -3325, -4368, -4405, -1737, 3421, 4310, 2790, 444, 2401, 2474, 780, 
-	2270, 2107, 1453, 856, 554, -2734, -6409, -7251, -4502, -1998, -1797, -922, 228, 1605, 1996, 2051, 
-	2084, 1913, 1252, 43, -460, -127, -152, -626, -788, -1179, -1654, -1314, -849, -586, -524, -484, 
-	-103, 315, 735, 1043, 1032, 491, 91, -83, -324, -285, -26, -175, -628, -680, -462, -246, 
-	88, 266, 21, -288, -255, -38, 142, 320, 267, -53, -294, -270, -132, 32, -56, -336, 
-	-452, -351, -66, 225, 279, 26, -192, -282, -216, 12, 73, -88, -271, -355, -313, -65, 
-	123, 45, -97, -231, -220, -49, 86, 69, -11, -143, -241, -96, 70, 74, 6, -61
-};
-
-static const short ugen_H10e080a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-	-3, 2, 0, 0, 3, -2, 19, -1, 0, 2, -5, 30, 36, 81, 730, 1282, 
-	714, 795, -22, -1136, 390, 1802, 2518, 2883, 2669, 2948, 3276, 2227, 110, -1410, -1757, -2058, 
-	-2867, -2741, -2032, -1707, -1099, -302, 190, 408, 474, 452, 400, 514, 555, 228, 35, 48, 
-	-142, -537, -892, -1020, -984, -908, -801, -571, -293, -60, 93, 168, 219, 196, 105, -5, 
-	-108, -179, -286, -386, -395, -366, -373, -363, -291, -213, -149, -110, -79, -42, -17, -8, 
-	-59, -88, -66, -72, -104, -146, -149, -133, -150, -175, -178, -125, -71, -38, -20, -34, 
-	-37, -43, -39, -22, -40, -80, -122, -131, -136, -141, -157, -177, -169, -147, -121, -93
-};
-
-static const short ugen_H10e080a1c[] = { 
-	141, -261, 329, 676, 14470, 9047, -19302, -12046, 9958, 5712, 5109, 22361, 5231, -8214, 6034, 6293, 
-	-6053, -9012, -5892, -9138, -5731, -3057, -4761, -4955, -933, 4130, 3851, 1094, 453, 3289, 1570, 1190, 
-	2789, 1930, 1415, 1439, 759, -4183, -7696, -6203, -3034, -2580, -2190, -598, 485, 1546, 1884, 2155, 
-	2135, 1902, 1156, -13, -334, 108, -295, -804, -779, -1305, -1759, -1346, -772, -580, -634, -510, 
-	-47, 415, 864, 1075, 868, 395, 117, -77, -307, -178, 37, -283, -717, -630, -377, -191, 
-	136, 244, -56, -335, -254, -23, 145, 330, 202, -153, -322, -223, -50, 48, -110, -379, 
-	-435, -313, -4, 278, 238, -48, -255, -302, -179, 71, 80, -147, -306, -361, -271, -33, 
-	98, -4, -150, -263, -218, -8, 108, 70, -39, -176, -217, -37, 93, 53, -20, -111
-};
-
-static const short ugen_H10e085a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 
-	-1, -2, 1, 0, 0, 2, 0, 26, -4, -18, 7, 29, 42, -19, 2, 646, 
-	1850, 1306, 488, -44, -1185, -681, 749, 3218, 5151, 4670, 3150, 1969, 1164, -21, -1742, -3146, 
-	-3203, -2930, -2717, -2170, -1502, -686, -54, 392, 665, 756, 773, 702, 602, 475, 254, 36, 
-	-56, -299, -740, -1158, -1273, -1126, -902, -695, -415, -140, 24, 175, 250, 298, 255, 137, 
-	-27, -196, -279, -345, -377, -397, -427, -419, -339, -227, -176, -135, -105, -86, -78, -72, 
-	-42, -24, -3, -30, -87, -122, -131, -121, -129, -157, -187, -182, -129, -68, -19, -5, 
-	-30, -56, -57, -38, -22, -56, -108, -132, -151, -165, -167, -161, -173, -181, -160, -129
-};
-
-static const short ugen_H10e085a1c[] = { 
-	123, -236, 288, 957, 15343, 7268, -20866, -10225, 11634, 5011, 6133, 22313, 1404, -8198, 8270, 6803, 
-	-7060, -8868, -5031, -9256, -5511, -2690, -5141, -5420, -201, 4702, 2533, -365, 1545, 3734, 799, 1765, 
-	2931, 1537, 1551, 1921, 355, -5390, -7540, -4785, -2745, -2976, -1909, -687, 274, 1498, 1671, 2107, 
-	2187, 2012, 1086, -91, -13, 307, -416, -842, -797, -1461, -1820, -1273, -694, -616, -727, -494, 
-	-47, 416, 945, 1030, 757, 352, 190, -31, -271, -88, 72, -337, -742, -569, -332, -135, 
-	169, 196, -141, -358, -216, -22, 135, 353, 166, -231, -330, -175, 2, 77, -115, -386, 
-	-438, -271, 51, 303, 205, -112, -269, -283, -117, 100, 61, -179, -316, -349, -251, 0, 
-	87, -40, -190, -274, -190, 35, 144, 67, -62, -187, -178, 7, 102, 37, -43, -119
-};
-
-static const short ugen_H10e090a0c[] = { 
-	0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 3, 1, 1, 0, 0, 0, 
-	0, 0, 1, 3, 0, 2, 3, 14, 22, -23, 0, 51, 14, -7, 59, 524, 
-	951, 1399, 1548, 1196, -1029, -3248, -710, 3911, 6433, 5056, 2564, 1942, 1914, 802, -1338, -3090, 
-	-3629, -3006, -2676, -2615, -1838, -1007, -364, 179, 769, 985, 866, 871, 763, 609, 323, 52, 
-	-54, -132, -575, -1163, -1338, -1202, -977, -746, -515, -233, -16, 127, 240, 311, 333, 214, 
-	37, -151, -265, -310, -361, -399, -422, -408, -338, -256, -194, -156, -122, -131, -146, -96, 
-	-39, 15, 33, 5, -55, -107, -110, -120, -112, -115, -151, -180, -169, -91, -32, -7, 
-	-12, -40, -56, -57, -53, -63, -76, -107, -146, -177, -175, -154, -153, -170, -184, -153
-};
-
-static const short ugen_H10e090a1c[] = { 
-	136, -262, 328, 762, 15143, 7385, -21122, -9928, 12165, 5180, 6018, 21555, 49, -8576, 9725, 7946, 
-	-7464, -8893, -4090, -9211, -5905, -2421, -5332, -5848, 137, 5128, 1164, -1331, 2623, 3547, 764, 2348, 
-	2633, 1284, 1656, 2113, -143, -6209, -6852, -3432, -2863, -3132, -1535, -799, -134, 1174, 1579, 1922, 
-	2113, 2205, 1048, -130, 286, 461, -468, -745, -854, -1560, -1888, -1220, -586, -698, -799, -494, 
-	-63, 338, 931, 981, 686, 345, 261, 18, -240, -10, 76, -387, -697, -517, -317, -132, 
-	159, 148, -220, -387, -189, -9, 108, 345, 146, -246, -348, -161, 22, 89, -86, -387, 
-	-453, -263, 76, 283, 166, -123, -255, -248, -108, 91, 36, -199, -322, -360, -234, 1, 
-	80, -72, -234, -276, -164, 54, 125, 66, -55, -194, -188, 0, 99, 22, -51, -128
-};
-
-static const short ugen_H10e095a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 
-	0, 0, 1, -2, 3, 0, 5, 6, 3, 13, -2, 19, 14, 33, 444, 778, 
-	129, 483, 2018, 1901, -604, -3391, -598, 4568, 5196, 3697, 2790, 2257, 1705, 886, -1002, -2375, 
-	-2837, -3140, -2829, -2410, -1928, -1391, -726, 47, 655, 879, 871, 921, 878, 663, 342, 69, 
-	-67, -165, -505, -1016, -1197, -1101, -988, -808, -542, -311, -97, 67, 170, 267, 286, 201, 
-	47, -80, -206, -318, -350, -375, -385, -349, -308, -285, -224, -172, -181, -192, -148, -81, 
-	-45, -20, 18, 20, -36, -90, -121, -118, -96, -79, -114, -158, -149, -117, -74, -50, 
-	-33, -20, -64, -94, -93, -77, -64, -98, -146, -189, -180, -153, -159, -168, -165, -131
-};
-
-static const short ugen_H10e095a1c[] = { 
-	179, -326, 431, 187, 13796, 9387, -20040, -11337, 11738, 6188, 4875, 20283, 1088, -9531, 10041, 9930, 
-	-6921, -9378, -3251, -8657, -6762, -2411, -5267, -6233, -83, 5263, 468, -1856, 2991, 3281, 1037, 2695, 
-	2604, 1000, 1645, 2171, -530, -6328, -6344, -2713, -2684, -2892, -1539, -929, -284, 742, 1278, 1782, 
-	2024, 2234, 1127, -54, 430, 566, -336, -620, -884, -1566, -1907, -1232, -557, -718, -825, -535, 
-	-95, 261, 836, 934, 687, 337, 311, 96, -189, 14, 99, -364, -655, -474, -312, -149, 
-	100, 128, -247, -414, -198, -2, 111, 320, 156, -213, -331, -155, 22, 89, -58, -351, 
-	-460, -286, 45, 271, 191, -99, -230, -234, -106, 76, 32, -204, -333, -348, -223, 4, 
-	70, -70, -225, -278, -175, 44, 145, 83, -53, -197, -216, -23, 112, 37, -60, -128
-};
-
-static const short ugen_H10e100a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-	-1, 0, 3, -2, 0, 2, 7, 7, -7, 23, 25, -4, 8, 405, 908, 352, 
-	-142, 614, 1152, 1030, -11, -765, 1425, 3275, 2868, 2523, 2573, 2245, 1183, 214, -531, -1382, 
-	-1983, -2406, -2689, -2294, -1695, -1496, -943, -175, 330, 593, 754, 917, 799, 572, 400, 148, 
-	-172, -300, -495, -755, -897, -946, -865, -758, -549, -343, -181, -14, 93, 154, 157, 125, 
-	43, -65, -173, -249, -307, -350, -311, -286, -269, -251, -241, -232, -236, -174, -94, -68, 
-	-71, -63, -29, -6, -31, -86, -115, -98, -66, -53, -82, -103, -101, -110, -112, -99, 
-	-63, -57, -78, -91, -89, -76, -86, -115, -161, -173, -162, -170, -159, -142, -108, -94
-};
-
-static const short ugen_H10e100a1c[] = { 
-	207, -364, 493, -385, 11116, 12528, -17014, -14319, 10165, 7925, 3282, 18147, 4221, -10472, 8596, 12563, 
-	-4959, -10363, -2936, -7399, -7860, -2786, -4983, -6514, -906, 4990, 686, -2089, 2675, 3155, 1380, 2622, 
-	2740, 1086, 1342, 2074, -477, -5987, -6233, -2573, -2353, -2522, -1582, -1038, -418, 460, 1005, 1495, 
-	1902, 2178, 1231, 69, 422, 661, -134, -526, -866, -1488, -1872, -1322, -607, -738, -799, -580, 
-	-142, 180, 717, 887, 700, 334, 295, 198, -130, -11, 115, -262, -633, -503, -325, -193, 
-	25, 109, -226, -441, -240, -23, 100, 309, 196, -159, -311, -151, 5, 68, -47, -331, 
-	-474, -331, 11, 252, 219, -67, -216, -229, -117, 60, 26, -190, -333, -349, -241, -12, 
-	86, -55, -232, -317, -198, 41, 159, 80, -95, -218, -221, -28, 93, 24, -68, -113
-};
-
-static const short ugen_H10e105a0c[] = { 
-	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 
-	0, 0, 1, 0, 0, -1, 10, 0, 0, 11, 29, 4, 279, 1044, 630, -261, 
-	245, 726, 239, -140, 1000, 2720, 2489, 1510, 1516, 1677, 1580, 1171, 543, -26, -428, -593, 
-	-1060, -1658, -1745, -1820, -1748, -1222, -831, -543, -137, 258, 583, 664, 588, 439, 340, 126, 
-	-219, -427, -462, -485, -620, -687, -688, -593, -467, -389, -236, -116, -42, -8, 5, 28, 
-	-46, -103, -123, -170, -235, -277, -266, -254, -209, -216, -276, -270, -189, -104, -94, -89, 
-	-99, -110, -83, -86, -74, -95, -83, -51, -58, -41, -43, -50, -76, -99, -119, -153, 
-	-141, -106, -71, -69, -79, -87, -130, -156, -171, -174, -168, -160, -124, -103, -88, -77
-};
-
-static const short ugen_H10e105a1c[] = { 
-	169, -277, 368, -523, 7035, 15353, -10689, -18098, 6449, 10206, 2022, 14361, 8957, -9983, 4782, 14916, 
-	-872, -11182, -3845, -5211, -8753, -3848, -4378, -6612, -2297, 4039, 1642, -1939, 1759, 3164, 1765, 2252, 
-	2846, 1440, 1071, 1853, -32, -5013, -6422, -2940, -1999, -2299, -1617, -1013, -552, 158, 853, 1265, 
-	1635, 2044, 1407, 249, 335, 734, 138, -474, -755, -1332, -1763, -1455, -724, -725, -796, -611, 
-	-203, 128, 555, 854, 716, 354, 254, 286, -5, -42, 126, -123, -567, -575, -377, -238, 
-	-65, 97, -164, -439, -313, -54, 76, 288, 287, -69, -281, -164, 17, 48, -52, -320, 
-	-480, -344, -16, 216, 205, -17, -186, -217, -128, 33, 49, -144, -315, -354, -259, -18, 
-	100, -54, -254, -290, -186, 6, 129, 53, -111, -197, -203, -63, 61, 33, -49, -99
-};
-
-static const short ugen_H10e110a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-	0, 0, -1, 2, 1, 0, 5, 4, 3, 11, 14, 205, 1105, 947, -289, -19, 
-	577, 127, -334, 851, 2901, 2958, 1928, 1572, 1104, 569, 279, -173, -327, -66, -87, -410, 
-	-518, -483, -825, -1190, -1169, -955, -863, -718, -425, -113, 182, 316, 339, 223, 98, -15, 
-	-245, -363, -352, -320, -374, -416, -411, -403, -349, -333, -286, -263, -215, -155, -140, -152, 
-	-137, -84, -115, -115, -147, -210, -210, -198, -210, -249, -216, -148, -116, -96, -105, -121, 
-	-132, -146, -143, -156, -135, -85, -45, -26, -35, -13, -7, -17, -55, -108, -145, -183, 
-	-161, -118, -77, -61, -78, -115, -163, -177, -190, -186, -151, -112, -88, -85, -62, -56
-};
-
-static const short ugen_H10e110a1c[] = { 
-	30, -30, 0, -75, 2702, 15302, -1184, -19959, -219, 11943, 2547, 8651, 13199, -6271, -728, 15124, 
-	5114, -10213, -6440, -2917, -8357, -5862, -3813, -6151, -3953, 2220, 2618, -1020, 543, 2884, 2354, 1844, 
-	2631, 2013, 883, 1509, 582, -3520, -6320, -3867, -1852, -2094, -1808, -996, -599, -99, 694, 1104, 
-	1404, 1782, 1556, 528, 243, 675, 441, -393, -685, -1069, -1617, -1555, -909, -694, -806, -667, 
-	-289, 93, 413, 741, 743, 406, 211, 317, 156, -16, 77, 0, -464, -636, -461, -310, 
-	-173, 38, -75, -394, -383, -113, 68, 236, 339, 65, -217, -190, 0, 34, -61, -291, 
-	-449, -359, -91, 146, 177, 18, -154, -192, -134, 6, 65, -89, -276, -326, -261, -86, 
-	32, -29, -178, -250, -215, -76, 51, 34, -62, -160, -225, -131, 55, 69, -47, -112
-};
-
-static const short ugen_H10e115a0c[] = { 
-	0, 0, 1, 1, 1, 2, 0, 1, 0, 0, 0, 0, 0, 0, 3, 2, 
-	2, 2, 2, 5, 0, 6, 2, 15, 0, 24, 125, 1091, 1344, -234, -335, 501, 
-	111, -451, 935, 3292, 2860, 1408, 1664, 1618, 734, -106, -1046, -1253, -682, -385, -165, -100, 
-	16, 227, -49, -288, -348, -635, -867, -773, -553, -428, -309, -80, 11, -120, -197, -250, 
-	-242, -171, -206, -199, -154, -137, -156, -201, -214, -247, -322, -403, -372, -345, -330, -218, 
-	-164, -134, -112, -96, -101, -131, -156, -217, -230, -154, -68, -50, -71, -109, -133, -151, 
-	-185, -192, -196, -183, -134, -86, -52, -25, 0, 25, 10, -24, -75, -148, -157, -130, 
-	-125, -135, -111, -77, -96, -145, -188, -193, -189, -156, -118, -99, -72, -56, -36, -42
-};
-
-static const short ugen_H10e115a1c[] = { 
-	-112, 198, -314, 385, -34, 11007, 8648, -16308, -9088, 10733, 5906, 2571, 13628, 1384, -5347, 11534, 
-	11174, -5799, -9697, -2382, -5960, -7955, -4320, -4960, -5160, -366, 2734, 510, -128, 1938, 2877, 1918, 
-	2013, 2469, 1065, 989, 906, -1732, -5375, -4888, -2340, -1852, -1960, -1249, -577, -295, 527, 984, 
-	1225, 1531, 1589, 895, 256, 462, 615, -121, -699, -860, -1341, -1599, -1107, -698, -789, -729, 
-	-406, 24, 296, 594, 707, 513, 233, 302, 290, 69, 17, 28, -310, -663, -559, -391, 
-	-277, -86, -28, -292, -402, -172, 49, 176, 311, 198, -85, -202, -71, 6, -38, -212, 
-	-394, -383, -209, 32, 133, 58, -115, -163, -122, -30, 61, -14, -194, -298, -302, -198, 
-	-8, 40, -112, -253, -274, -168, -3, 41, -43, -149, -206, -163, 0, 63, -39, -120
-};
-
-static const short ugen_H10e120a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-	0, 0, 5, -3, 0, 0, 20, -5, 20, 76, 1037, 1668, -53, -638, 364, 121, 
-	-532, 1035, 3663, 3101, 1297, 1454, 1254, 434, 190, -719, -1658, -1452, -970, -736, -489, 185, 
-	644, 428, 543, 686, 199, -300, -524, -680, -769, -706, -574, -521, -505, -480, -501, -424, 
-	-203, -69, -68, -30, 58, 93, 32, -32, -86, -219, -348, -479, -598, -507, -333, -250, 
-	-238, -212, -147, -81, -65, -138, -195, -168, -87, -40, 0, -2, -62, -119, -175, -207, 
-	-226, -224, -209, -172, -120, -103, -81, -34, 30, 45, -21, -96, -131, -118, -101, -101, 
-	-119, -150, -133, -120, -155, -183, -184, -176, -158, -128, -117, -95, -55, -43, -46, -31
-};
-
-static const short ugen_H10e120a1c[] = { 
-	-87, 133, -180, 194, -323, 4464, 13428, -5728, -15825, 4107, 10263, 191, 7912, 10011, -4805, 4285, 
-	14192, 1922, -10515, -5053, -2648, -8287, -6301, -3972, -5106, -3164, 1491, 1865, 77, 1013, 2637, 2564, 
-	1493, 2389, 1710, 571, 759, -415, -3465, -5134, -3344, -2046, -1911, -1605, -742, -405, 206, 958, 
-	1107, 1330, 1516, 1246, 487, 250, 555, 211, -564, -829, -1070, -1441, -1272, -771, -751, -740, 
-	-533, -99, 172, 404, 650, 607, 375, 275, 381, 183, -9, -7, -184, -587, -669, -465, 
-	-355, -243, -72, -169, -331, -219, 27, 137, 231, 267, 60, -143, -136, -28, -8, -101, 
-	-310, -413, -320, -104, 66, 86, -42, -134, -107, -45, 53, 52, -116, -303, -310, -185, 
-	-47, 11, -96, -253, -293, -197, -53, 0, -29, -94, -148, -183, -101, 13, -14, -91
-};
-
-static const short ugen_H10e125a0c[] = { 
-	0, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-	0, 5, 0, 5, -8, 20, 0, 27, 38, 965, 1985, 190, -949, 190, 192, -640, 
-	1117, 4128, 3333, 1225, 1537, 1337, -9, -433, -924, -1538, -1260, -1030, -1279, -1051, -202, 320, 
-	479, 935, 1183, 875, 540, 257, -141, -556, -808, -863, -860, -914, -928, -869, -731, -434, 
-	-202, -87, 60, 211, 242, 210, 219, 117, -50, -227, -455, -581, -554, -465, -367, -334, 
-	-329, -245, -134, -114, -163, -133, -41, -38, -19, 38, 47, 0, -83, -153, -211, -229, 
-	-209, -205, -199, -157, -113, -110, -65, 5, 21, -37, -104, -125, -93, -52, -55, -104, 
-	-132, -130, -142, -180, -197, -161, -141, -141, -128, -107, -91, -71, -45, -44, -30, 12
-};
-
-static const short ugen_H10e125a1c[] = { 
-	53, -103, 157, -238, 291, 208, 10042, 6724, -14030, -6465, 10360, 4013, -189, 12127, 3338, -2521, 
-	11364, 9774, -6018, -9192, -1641, -5554, -8561, -4465, -3999, -4923, -1163, 2414, 702, 502, 2156, 2735, 
-	1833, 1687, 2367, 738, 301, 85, -1591, -4007, -4075, -2706, -2131, -1712, -1138, -527, -192, 721, 
-	1157, 1174, 1388, 1414, 860, 284, 363, 402, -298, -793, -934, -1168, -1303, -933, -691, -723, 
-	-588, -290, 57, 182, 478, 681, 560, 319, 367, 330, 22, -96, -119, -437, -713, -586, 
-	-387, -365, -195, -76, -225, -249, -34, 148, 155, 232, 154, -45, -126, -52, 5, -42, 
-	-204, -397, -394, -220, -33, 54, 14, -72, -66, -32, 4, 5, -68, -171, -219, -202, 
-	-154, -96, -104, -200, -253, -232, -131, -12, 16, -52, -146, -196, -172, -51, -6, -49
-};
-
-static const short ugen_H10e130a0c[] = { 
-	0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -2, 0, -3, 
-	4, -6, 4, -9, 12, 0, 21, 30, 879, 2253, 505, -1234, -67, 252, -687, 1152, 
-	4611, 3614, 1147, 1648, 1526, -234, -838, -1198, -2103, -1692, -772, -967, -1184, -520, 72, 87, 
-	500, 1261, 1310, 872, 758, 615, 97, -372, -629, -935, -1213, -1247, -1197, -1096, -809, -475, 
-	-281, -58, 198, 320, 318, 327, 341, 175, -182, -394, -438, -466, -398, -413, -507, -462, 
-	-295, -239, -275, -219, -62, -2, -15, 22, 47, 67, 14, -60, -128, -204, -199, -176, 
-	-187, -200, -187, -168, -128, -47, -12, -28, -84, -141, -137, -99, -49, -37, -70, -118, 
-	-150, -144, -169, -189, -171, -139, -132, -135, -99, -81, -74, -58, -53, -33, 2, 37
-};
-
-static const short ugen_H10e130a1c[] = { 
-	46, -69, 81, -91, 87, -166, 3061, 11558, -2487, -13468, 2784, 9269, -2065, 4316, 12346, -1065, 
-	3158, 13105, 2665, -9655, -5005, -1763, -8290, -6917, -3144, -4803, -4174, 1198, 1840, -115, 1807, 2682, 
-	2203, 1494, 2180, 1548, 23, 67, -619, -2268, -3716, -3245, -2682, -1975, -1378, -872, -486, 201, 
-	1118, 1143, 1200, 1441, 1177, 535, 310, 425, -20, -677, -838, -948, -1150, -1120, -712, -639, 
-	-610, -419, -103, 78, 224, 559, 678, 466, 338, 374, 153, -130, -154, -270, -632, -695, 
-	-485, -366, -333, -109, -97, -235, -130, 103, 161, 154, 170, 35, -72, -37, 7, -43, 
-	-139, -293, -380, -314, -155, -20, 51, 14, -36, -55, -73, -20, 33, -35, -167, -249, 
-	-260, -201, -127, -146, -219, -217, -141, -27, 2, -56, -144, -194, -185, -102, -7, -14
-};
-
-static const short ugen_H10e135a0c[] = { 
-	0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 2, -2, 3, 
-	-4, 4, -10, 11, 0, 23, 16, 807, 2501, 859, -1465, -379, 311, -721, 1186, 5128, 
-	3896, 1031, 1786, 1836, -354, -1248, -1464, -2368, -2084, -1146, -1155, -1134, -239, 325, -50, 172, 
-	900, 997, 890, 1049, 921, 472, 219, -48, -497, -1011, -1350, -1466, -1348, -1022, -792, -590, 
-	-270, 40, 226, 272, 375, 444, 228, -77, -215, -319, -328, -277, -362, -502, -533, -417, 
-	-362, -344, -212, -82, -41, -17, 14, 78, 48, -7, -38, -133, -194, -179, -122, -147, 
-	-188, -189, -187, -151, -72, 4, -47, -135, -157, -143, -120, -98, -55, -68, -122, -149, 
-	-158, -150, -153, -136, -139, -157, -145, -107, -70, -70, -58, -43, -35, -20, 0, 0
-};
-
-static const short ugen_H10e135a1c[] = { 
-	-49, 74, -112, 139, -199, 241, -170, 6391, 8741, -8586, -7988, 7713, 3715, -3733, 10027, 9292, 
-	-1879, 8214, 10438, -3618, -8735, -1865, -4296, -9029, -4489, -3312, -5700, -1942, 2350, 277, 450, 2823, 
-	2521, 1723, 1664, 2162, 461, -300, -148, -1064, -2576, -3212, -2898, -2542, -1702, -1179, -782, -355, 
-	702, 1210, 975, 1230, 1430, 895, 400, 404, 222, -432, -771, -782, -950, -1113, -896, -625, 
-	-582, -439, -250, 8, 107, 276, 540, 579, 380, 321, 256, -36, -216, -202, -418, -674, 
-	-614, -428, -368, -252, -52, -131, -182, -25, 133, 119, 122, 102, -21, -43, 11, -23, 
-	-114, -207, -301, -331, -240, -99, 2, 17, -48, -51, -19, 13, 27, -26, -158, -267, 
-	-300, -273, -209, -149, -130, -142, -137, -105, -69, -81, -126, -162, -163, -123, -39, 0
-};
-
-static const short ugen_H10e140a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 4, -6, 
-	5, -8, 2, 2, 20, 19, 720, 2732, 1251, -1686, -720, 345, -709, 1176, 5673, 4277, 
-	836, 1859, 2187, -336, -1593, -1758, -2695, -2454, -1249, -1260, -1561, -534, 646, 443, 330, 764, 
-	772, 562, 704, 899, 670, 404, 262, 23, -512, -995, -1312, -1433, -1235, -925, -709, -528, 
-	-216, 47, 180, 292, 260, 153, 50, -113, -182, -168, -175, -276, -416, -500, -497, -428, 
-	-286, -178, -133, -79, -64, -10, 34, 14, -12, -69, -130, -189, -163, -99, -106, -169, 
-	-181, -153, -146, -75, -22, -59, -136, -158, -142, -136, -106, -95, -115, -141, -168, -167, 
-	-137, -108, -100, -118, -159, -166, -104, -52, -52, -61, -51, -31, -11, -22, -61, -104
-};
-
-static const short ugen_H10e140a1c[] = { 
-	-2, -15, 25, -54, 75, -125, 131, 650, 8413, 4203, -10271, -1851, 7483, -1791, -821, 13450, 
-	5400, 53, 10548, 5565, -6626, -5811, -1366, -6883, -7704, -2930, -4752, -5027, 439, 1593, -479, 1625, 
-	3085, 2228, 1540, 1809, 1588, -228, -428, -272, -1313, -2710, -2829, -2588, -2268, -1621, -1004, -587, 
-	-128, 931, 1081, 863, 1256, 1284, 742, 416, 302, -51, -592, -718, -698, -940, -1062, -739, 
-	-531, -478, -268, -47, 58, 73, 291, 492, 408, 261, 257, 99, -151, -219, -222, -463, 
-	-622, -512, -422, -374, -150, -13, -134, -102, 47, 64, 36, 105, 85, -19, -11, 0, 
-	-89, -153, -193, -240, -248, -191, -127, -47, 28, 47, 45, 10, -30, -77, -171, -264, 
-	-299, -288, -231, -144, -79, -96, -130, -141, -134, -114, -109, -95, -91, -94, -82, -38
-};
-
-static const short ugen_H10e145a0c[] = { 
-	0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 1, -5, 4, -5, 0, 
-	-3, 0, 1, 12, 29, 652, 2943, 1660, -1890, -1101, 371, -662, 1212, 6198, 4666, 665, 
-	1888, 2491, -314, -1832, -1992, -3030, -2875, -1399, -1279, -1730, -756, 454, 479, 641, 1138, 913, 
-	453, 499, 596, 296, 255, 422, 203, -274, -594, -885, -1126, -1101, -914, -761, -609, -355, 
-	-127, 22, 53, 78, 70, -94, -123, -65, -87, -116, -166, -327, -498, -432, -252, -202, 
-	-218, -128, -75, -76, -73, -44, -18, -58, -86, -153, -218, -173, -72, -83, -148, -153, 
-	-147, -115, -37, 0, -83, -144, -133, -134, -140, -121, -106, -125, -175, -202, -185, -139, 
-	-75, -52, -111, -175, -146, -66, -19, -25, -55, -59, -40, -25, -39, -89, -139, -176
-};
-
-static const short ugen_H10e145a1c[] = { 
-	18, -30, 23, -23, 9, -7, -9, -22, 1869, 8798, 184, -8732, 1992, 4156, -4216, 3732, 
-	13862, 2741, 2775, 9824, 1320, -6592, -3502, -2657, -8019, -5591, -3138, -5683, -2981, 1224, 388, -108, 
-	2465, 2926, 1946, 1534, 1692, 868, -467, -301, -502, -1595, -2557, -2516, -2400, -2069, -1451, -753, 
-	-406, 51, 857, 916, 876, 1153, 1112, 710, 393, 120, -249, -569, -565, -670, -963, -947, 
-	-568, -445, -323, -116, 19, 20, 24, 277, 386, 226, 116, 149, 16, -167, -203, -239, 
-	-442, -503, -425, -422, -374, -107, 8, -82, -54, 1, -32, -11, 113, 101, -6, -34, 
-	-58, -106, -106, -157, -236, -258, -172, -52, 44, 99, 83, 20, -91, -189, -220, -238, 
-	-237, -231, -225, -190, -120, -85, -113, -136, -162, -140, -91, -47, -29, -57, -92, -85
-};
-
-static const short ugen_H10e150a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 3, -2, 3, -3, 0, -2, 
-	0, 4, 1, 35, 594, 3155, 2074, -2073, -1499, 369, -605, 1274, 6778, 5055, 436, 1942, 
-	2819, -342, -2083, -2160, -3308, -3317, -1597, -1260, -1903, -924, 438, 503, 639, 1161, 1134, 732, 
-	606, 548, 69, -143, 64, 77, -201, -496, -706, -779, -712, -563, -522, -581, -399, -118, 
-	-203, -193, 11, -62, -235, -278, -183, -116, -79, -143, -366, -428, -198, -87, -145, -127, 
-	-61, -67, -150, -117, -30, -61, -128, -128, -186, -257, -198, -110, -98, -127, -128, -121, 
-	-104, -16, 16, -58, -119, -120, -131, -156, -132, -99, -124, -186, -235, -234, -142, -39, 
-	-54, -148, -176, -99, -13, 1, -18, -44, -58, -50, -60, -90, -112, -145, -194, -215
-};
-
-static const short ugen_H10e150a1c[] = { 
-	-13, 30, -47, 48, -62, 63, -80, 85, -107, 3045, 8044, -2242, -6034, 2795, 736, -3714, 
-	7389, 12624, 1814, 4468, 7505, -829, -5356, -2642, -4286, -7555, -4244, -4261, -5038, -1354, 763, -86, 
-	632, 2765, 2610, 1777, 1497, 1425, 205, -250, -80, -981, -1733, -2249, -2307, -2337, -1880, -1128, 
-	-567, -300, 259, 660, 667, 878, 1096, 986, 609, 287, 40, -309, -493, -451, -655, -882, 
-	-763, -450, -334, -220, -106, -13, -51, -4, 183, 257, 138, 46, 80, -54, -206, -171, 
-	-181, -373, -416, -356, -392, -338, -123, -24, -41, -43, -53, -92, 0, 113, 80, 9, 
-	-40, -105, -132, -102, -131, -189, -177, -83, 27, 103, 89, 0, -131, -244, -262, -202, 
-	-155, -169, -220, -238, -195, -126, -102, -121, -136, -118, -74, -44, -28, -26, -40, -63
-};
-
-static const short ugen_H10e155a0c[] = { 
-	0, 0, 0, 0, 0, 0, -2, 0, 0, 2, -2, 5, -5, 0, 1, -4, 
-	12, -7, 40, 537, 3364, 2506, -2253, -1910, 349, -549, 1332, 7398, 5502, 193, 1949, 3138, 
-	-339, -2348, -2340, -3563, -3731, -1865, -1204, -1990, -1102, 431, 466, 786, 1336, 1050, 633, 801, 
-	854, 129, -320, -160, -232, -657, -653, -667, -743, -479, -149, -81, -241, -168, -216, -267, 
-	-82, -82, -276, -405, -352, -313, -299, -247, -273, -315, -256, -111, -38, -1, 29, 16, 
-	-48, -118, -94, -63, -97, -138, -167, -216, -287, -262, -139, -125, -156, -137, -96, -65, 
-	-12, 24, -22, -82, -98, -117, -148, -118, -83, -116, -187, -251, -247, -161, -77, -63, 
-	-133, -154, -50, 45, 33, -19, -46, -72, -83, -91, -110, -127, -152, -200, -227, -187
-};
-
-static const short ugen_H10e155a1c[] = { 
-	11, -13, 28, -46, 53, -75, 89, -119, 144, -92, 3899, 6836, -2979, -3981, 1681, -1079, 
-	-1994, 9361, 11216, 1870, 4574, 5357, -1226, -4273, -2889, -5180, -6395, -4205, -4787, -3679, -844, 216, 
-	28, 1211, 2613, 2355, 1797, 1257, 964, 99, 90, -211, -1182, -1757, -2083, -2120, -2255, -1717, 
-	-919, -346, -95, 325, 425, 400, 842, 1105, 884, 388, 163, 64, -282, -391, -353, -580, 
-	-757, -591, -396, -312, -207, -178, -113, -134, -40, 101, 170, 130, 53, 10, -136, -206, 
-	-127, -151, -302, -341, -334, -366, -287, -125, -69, -63, -70, -100, -90, 35, 99, 25, 
-	-36, -74, -117, -106, -71, -79, -100, -102, -55, 11, 57, 0, -114, -207, -248, -212, 
-	-163, -155, -186, -229, -263, -232, -141, -95, -83, -82, -83, -69, -40, -1, 6, -14
-};
-
-static const short ugen_H10e160a0c[] = { 
-	-2, -1, 0, 0, 0, -3, 0, -1, 2, -3, 2, -4, -5, 1, -11, 17, 
-	-17, 49, 478, 3575, 2937, -2431, -2323, 305, -502, 1386, 8032, 5987, -48, 1961, 3426, -395, 
-	-2592, -2457, -3837, -4170, -2151, -1243, -2011, -1212, 484, 405, 758, 1581, 1192, 586, 643, 847, 
-	329, -161, -184, -371, -959, -1122, -1026, -866, -438, -46, 245, 204, 4, 46, 70, -40, 
-	-93, -291, -567, -572, -413, -443, -517, -388, -260, -298, -158, 54, 107, 80, 36, 29, 
-	-29, -48, -26, -71, -176, -202, -240, -342, -295, -180, -173, -208, -166, -96, -80, -25, 
-	27, -9, -66, -92, -105, -116, -75, -57, -120, -208, -262, -243, -189, -142, -130, -139, 
-	-99, -5, 70, 78, 16, -68, -138, -164, -141, -121, -143, -178, -207, -219, -183, -127
-};
-
-static const short ugen_H10e160a1c[] = { 
-	0, 6, -5, 17, -34, 42, -65, 86, -119, 150, 10, 4354, 5780, -2752, -3230, 316, 
-	-1404, -434, 10156, 10293, 1921, 3715, 4226, -858, -3856, -3447, -5104, -5638, -4724, -4349, -2608, -959, 
-	-31, 378, 1419, 2353, 2286, 1739, 877, 638, 459, 92, -478, -1022, -1671, -2009, -2148, -2104, 
-	-1468, -777, -200, 151, 312, 185, 306, 786, 1043, 709, 262, 59, 39, -88, -238, -286, 
-	-477, -649, -578, -385, -325, -297, -246, -186, -171, -86, 82, 195, 103, 69, 32, -141, 
-	-229, -130, -126, -277, -308, -316, -322, -230, -75, -65, -151, -144, -83, -42, 8, 56, 
-	35, -48, -93, -91, -55, -21, -28, -63, -111, -96, -36, 22, -9, -107, -201, -234, 
-	-183, -159, -180, -213, -260, -275, -215, -118, -62, -41, -46, -67, -47, -2, 39, 38
-};
-
-static const short ugen_H10e165a0c[] = { 
-	-2, 0, 0, 0, -3, 0, -1, 2, -1, 1, -2, -7, 5, -15, 22, -30, 
-	62, 422, 3755, 3410, -2586, -2747, 265, -472, 1416, 8646, 6552, -271, 1942, 3726, -453, -2861, 
-	-2558, -3988, -4622, -2491, -1298, -2074, -1336, 602, 518, 638, 1693, 1400, 585, 650, 865, 207, 
-	-194, -24, -248, -1083, -1421, -1339, -1190, -651, -67, 224, 206, 417, 512, 306, 247, 142, 
-	-251, -619, -617, -627, -720, -490, -296, -460, -522, -181, 107, 108, 47, 74, 95, 16, 
-	22, 73, -12, -134, -180, -258, -360, -336, -223, -219, -229, -176, -135, -116, -54, 29, 
-	-10, -70, -70, -67, -69, -45, -22, -87, -180, -259, -287, -200, -127, -134, -164, -131, 
-	-10, 129, 170, 62, -77, -180, -213, -193, -163, -164, -195, -214, -204, -156, -100, -80
-};
-
-static const short ugen_H10e165a1c[] = { 
-	0, 2, 2, 0, 5, -22, 24, -46, 62, -92, 114, 156, 4457, 5154, -2356, -3414, 
-	-417, -1059, 517, 10408, 9763, 1547, 2743, 3986, -486, -3954, -3672, -4613, -5586, -4911, -3474, -2126, 
-	-1222, -27, 685, 1345, 2201, 2230, 1466, 659, 680, 543, -52, -564, -805, -1419, -2115, -2228, 
-	-1874, -1239, -683, -123, 238, 274, 195, 288, 640, 864, 555, 199, 79, 60, -17, -74, 
-	-202, -474, -704, -639, -422, -357, -343, -314, -218, -161, -70, 110, 204, 108, 70, 31, 
-	-130, -224, -167, -171, -264, -295, -288, -296, -205, -51, -68, -176, -203, -138, -35, 63, 
-	79, 0, -82, -101, -83, -26, -1, -45, -106, -138, -116, -45, 16, -7, -84, -163, 
-	-214, -219, -212, -208, -239, -283, -275, -201, -92, -23, -12, -50, -72, -30, 25, 66
-};
-
-static const short ugen_H10e170a0c[] = { 
-	-2, 0, 0, -4, 0, -1, 2, -1, 1, -2, -11, 8, -21, 27, -41, 69, 
-	390, 3920, 3859, -2701, -3178, 231, -466, 1445, 9251, 7127, -412, 1914, 3997, -569, -3133, -2650, 
-	-4124, -5001, -2881, -1369, -2094, -1526, 617, 737, 704, 1722, 1545, 625, 591, 938, 278, -311, 
-	-188, -215, -988, -1517, -1569, -1359, -768, -416, -105, 323, 558, 634, 631, 592, 397, -47, 
-	-487, -666, -667, -651, -529, -496, -535, -526, -318, -85, 2, 85, 78, 33, 45, 113, 
-	155, 71, -83, -131, -201, -348, -377, -253, -203, -251, -234, -182, -156, -106, -17, -7, 
-	-48, -46, -45, -48, -24, -4, -60, -176, -244, -241, -174, -124, -152, -190, -152, -20, 
-	120, 178, 100, -45, -169, -244, -254, -213, -186, -203, -235, -219, -160, -81, -37, -58
-};
-
-static const short ugen_H10e170a1c[] = { 
-	0, 0, 4, 0, 3, 0, -14, 14, -30, 43, -64, 80, 280, 4374, 4903, -2219, 
-	-3826, -499, -696, 993, 10462, 9345, 924, 2102, 4160, -381, -4143, -3445, -4316, -5740, -4603, -2760, 
-	-1972, -1432, 131, 845, 1141, 2158, 2168, 1117, 612, 890, 349, -175, -458, -667, -1216, -2070, 
-	-2175, -1794, -1137, -509, -61, 168, 246, 312, 395, 497, 582, 577, 247, 28, 103, 5, 
-	-99, -258, -500, -761, -726, -468, -360, -359, -268, -128, -145, -46, 178, 234, 98, 56, 
-	0, -156, -210, -131, -179, -308, -302, -285, -289, -201, -72, -61, -128, -145, -108, -65, 
-	28, 76, 8, -92, -123, -86, -29, -10, -55, -137, -175, -128, -17, 54, 40, -44, 
-	-164, -237, -243, -222, -234, -264, -279, -256, -170, -59, 4, -15, -61, -52, -3, 47
-};
-
-static const short ugen_H10e175a0c[] = { 
-	0, 0, -4, 0, 0, 2, 0, 1, 0, -12, 12, -23, 32, -44, 69, 371, 
-	4040, 4264, -2687, -3584, 147, -446, 1405, 9752, 7738, -400, 1860, 4243, -660, -3450, -2720, -4208, 
-	-5308, -3335, -1536, -2000, -1640, 461, 843, 905, 1816, 1653, 739, 488, 947, 395, -355, -295, 
-	-292, -1038, -1617, -1638, -1425, -944, -574, -171, 152, 429, 673, 725, 743, 644, 184, -304, 
-	-486, -422, -500, -599, -550, -598, -647, -472, -209, -75, -40, -10, 23, 32, 108, 226, 
-	164, -20, -54, -127, -318, -378, -244, -206, -268, -241, -227, -247, -158, -18, -15, -64, 
-	-37, -19, -37, -5, 17, -72, -191, -197, -157, -127, -110, -134, -194, -187, -44, 102, 
-	147, 91, -15, -150, -251, -268, -243, -218, -223, -242, -224, -153, -66, -28, -33, -55
-};
-
-static const short ugen_H10e175a1c[] = { 
-	-3, 0, 0, 4, 0, 2, 0, -13, 10, -23, 33, -50, 65, 346, 4252, 4768, 
-	-2350, -4012, -275, -506, 1234, 10354, 8879, 307, 1826, 4362, -505, -4102, -3104, -4261, -5713, -4170, 
-	-2257, -1941, -1526, 300, 791, 1024, 2180, 1971, 878, 648, 900, 341, -297, -449, -420, -1182, 
-	-1849, -2021, -1856, -1050, -339, -39, -9, 242, 442, 497, 563, 580, 437, 197, 79, -23, 
-	-166, -241, -329, -613, -818, -669, -485, -362, -237, -122, -85, -119, 14, 225, 228, 71, 
-	23, -19, -176, -240, -143, -170, -321, -353, -318, -300, -165, -23, -36, -104, -91, -61, 
-	-75, -30, 28, 9, -72, -124, -125, -75, -41, -77, -158, -194, -117, 30, 116, 61, 
-	-57, -175, -239, -246, -234, -237, -267, -285, -245, -140, -37, -8, -24, -45, -37, -7
-};
-
-static const short ugen_H10e180a0c[] = { 
-	0, -4, 0, 0, 2, 0, 0, 0, -14, 9, -24, 30, -47, 63, 362, 4138, 
-	4581, -2555, -3910, -29, -445, 1338, 10118, 8356, -161, 1779, 4401, -638, -3828, -2847, -4264, -5543, 
-	-3768, -1870, -1929, -1584, 347, 781, 1032, 2040, 1744, 825, 571, 857, 417, -347, -416, -304, 
-	-1096, -1779, -1768, -1668, -1062, -362, -110, -22, 231, 581, 691, 684, 657, 335, -69, -105, 
-	-141, -420, -469, -452, -606, -811, -638, -301, -238, -174, -38, -1, -70, 57, 233, 208, 
-	68, -3, -73, -255, -297, -196, -229, -305, -305, -287, -269, -162, -26, -23, -79, -79, 
-	-49, -42, 3, 14, -55, -127, -157, -149, -100, -75, -122, -179, -179, -76, 53, 112, 
-	72, -29, -158, -246, -262, -246, -238, -256, -272, -236, -143, -42, -10, -39, -58, -42
-};
-
-static const short ugen_H10e180a1c[] = { 
-	0, -4, 0, 0, 2, 0, 0, 0, -14, 9, -24, 30, -47, 63, 362, 4138, 
-	4581, -2555, -3910, -29, -445, 1338, 10118, 8356, -161, 1779, 4401, -638, -3828, -2847, -4264, -5543, 
-	-3768, -1870, -1929, -1584, 347, 781, 1032, 2040, 1744, 825, 571, 857, 417, -347, -416, -304, 
-	-1096, -1779, -1768, -1668, -1062, -362, -110, -22, 231, 581, 691, 684, 657, 335, -69, -105, 
-	-141, -420, -469, -452, -606, -811, -638, -301, -238, -174, -38, -1, -70, 57, 233, 208, 
-	68, -3, -73, -255, -297, -196, -229, -305, -305, -287, -269, -162, -26, -23, -79, -79, 
-	-49, -42, 3, 14, -55, -127, -157, -149, -100, -75, -122, -179, -179, -76, 53, 112, 
-	72, -29, -158, -246, -262, -246, -238, -256, -272, -236, -143, -42, -10, -39, -58, -42
-};
-
-static const short ugen_H20e000a0c[] = { 
-	-4, 1, -5, 9, 0, 2, 10, -25, 41, -71, 105, -138, 166, 542, 6670, 4275, 
-	-2691, -1646, -5871, 791, 4987, 5034, 11772, 7685, -2233, -1218, 1988, -5034, -9991, -7085, -2923, -3515, 
-	-3121, 222, 16, 1362, 2936, 2063, 2241, 2439, 1078, 36, 53, 201, 612, 188, 64, -588, 
-	-1894, -2556, -1976, -996, -966, -508, 799, 977, 807, 1008, 555, -209, -529, -709, -1032, -1192, 
-	-998, -459, -424, -574, -590, -453, -86, 167, 87, -32, 74, 111, 83, 132, 238, 118, 
-	-163, -302, -355, -425, -397, -314, -235, -275, -259, -159, -7, 152, 184, 33, -143, -143, 
-	-65, -15, -6, -63, -202, -269, -193, -136, -116, -101, -171, -210, -119, 19, 86, 28, 
-	-115, -190, -155, -107, -44, -44, -125, -137, -95, -8, 108, 101, -39, -125, -135, -182
-};
-
-static const short ugen_H20e000a1c[] = { 
-	-4, 1, -5, 9, 0, 2, 10, -25, 41, -71, 105, -138, 166, 542, 6670, 4275, 
-	-2691, -1646, -5871, 791, 4987, 5034, 11772, 7685, -2233, -1218, 1988, -5034, -9991, -7085, -2923, -3515, 
-	-3121, 222, 16, 1362, 2936, 2063, 2241, 2439, 1078, 36, 53, 201, 612, 188, 64, -588, 
-	-1894, -2556, -1976, -996, -966, -508, 799, 977, 807, 1008, 555, -209, -529, -709, -1032, -1192, 
-	-998, -459, -424, -574, -590, -453, -86, 167, 87, -32, 74, 111, 83, 132, 238, 118, 
-	-163, -302, -355, -425, -397, -314, -235, -275, -259, -159, -7, 152, 184, 33, -143, -143, 
-	-65, -15, -6, -63, -202, -269, -193, -136, -116, -101, -171, -210, -119, 19, 86, 28, 
-	-115, -190, -155, -107, -44, -44, -125, -137, -95, -8, 108, 101, -39, -125, -135, -182
-};
-
-static const short ugen_H20e005a0c[] = { 
-	-2, -3, 2, -6, 12, -4, 9, -2, -6, 16, -40, 66, -81, 97, 813, 6266, 
-	3192, -2166, -1442, -5136, 724, 4585, 5165, 10332, 6872, -1690, -641, 1876, -4805, -9422, -6221, -2411, 
-	-3836, -2981, 476, -84, 1103, 2758, 1992, 1992, 2013, 856, 301, 173, 267, 631, 113, 82, 
-	-522, -1741, -2315, -1837, -1095, -715, -6, 725, 724, 631, 721, 370, -217, -568, -754, -808, 
-	-920, -974, -675, -514, -553, -618, -484, -102, 187, 68, -23, 109, 106, 49, 104, 203, 
-	54, -198, -310, -334, -343, -319, -247, -204, -249, -217, -127, -22, 98, 153, 23, -147, 
-	-174, -89, 14, 24, -50, -199, -283, -203, -128, -117, -125, -165, -169, -78, 42, 77, 
-	-8, -134, -185, -154, -129, -83, -62, -112, -96, -48, 18, 106, 95, -21, -126, -154
-};
-
-static const short ugen_H20e005a1c[] = { 
-	-3, 0, 0, 14, -18, 37, -59, 77, -110, 146, -177, 213, 27, 5753, 6931, -2634, 
-	-1900, -6199, -1356, 6377, 3999, 11872, 10856, -2035, -2860, 2675, -4068, -10600, -7902, -3793, -3587, -3310, 
-	22, -294, 891, 3441, 2067, 2119, 2913, 1722, 114, -208, 65, 737, 309, 147, -287, -1932, 
-	-2815, -2204, -1287, -1268, -653, 646, 977, 1014, 1098, 630, 41, -428, -791, -1253, -1333, -869, 
-	-209, -320, -563, -505, -471, -97, 195, 46, -128, -7, 50, 93, 167, 250, 140, -72, 
-	-228, -374, -465, -423, -312, -215, -279, -297, -167, -32, 102, 156, 40, -128, -149, -76, 
-	-30, -35, -53, -153, -252, -216, -126, -90, -95, -163, -231, -169, 0, 126, 83, -89, 
-	-196, -173, -133, -64, -5, -88, -167, -126, -48, 76, 103, -30, -132, -144, -162, -141
-};
-
-static const short ugen_H20e010a0c[] = { 
-	0, -2, -3, 2, -6, 13, -7, 15, -13, 11, -8, -2, 23, -24, 27, 1254, 
-	5871, 2022, -1596, -1605, -4673, 1427, 4204, 5131, 9694, 5484, -1551, 412, 1271, -5336, -8446, -4924, 
-	-2556, -4035, -2084, 409, -350, 1361, 2529, 1733, 1784, 1608, 772, 451, 227, 448, 472, 13, 
-	182, -618, -1726, -2053, -1625, -1097, -360, 620, 619, 205, 436, 472, 132, -324, -661, -716, 
-	-710, -740, -765, -715, -640, -494, -593, -496, -80, 150, 29, -39, 90, 61, 0, 100, 
-	133, -34, -205, -287, -297, -265, -199, -141, -175, -240, -182, -106, -48, 41, 67, -42, 
-	-140, -155, -68, -2, 2, -55, -198, -259, -209, -128, -104, -116, -146, -139, -51, 50, 
-	69, -34, -162, -203, -186, -150, -83, -51, -85, -82, -25, 38, 107, 80, -40, -126
-};
-
-static const short ugen_H20e010a1c[] = { 
-	3, -8, 29, -31, 51, -67, 78, -98, 114, -117, 139, -115, 4094, 9256, -1069, -2940, 
-	-5717, -4274, 6761, 4618, 10541, 13884, 204, -5287, 2435, -2107, -11299, -9325, -4040, -3528, -4185, 42, 
-	177, -291, 3497, 2723, 1672, 3028, 2499, 469, -243, -285, 711, 656, 149, 92, -1612, -3094, 
-	-2685, -1840, -1547, -530, 469, 990, 1152, 1101, 746, 208, -366, -1019, -1538, -1297, -553, -111, 
-	-191, -455, -430, -395, -153, 206, 165, -223, -165, -16, 23, 135, 270, 217, -33, -234, 
-	-383, -453, -408, -268, -189, -251, -261, -118, -42, 37, 101, 31, -142, -193, -155, -70, 
-	-17, -25, -116, -230, -203, -102, -64, -102, -171, -248, -170, 15, 154, 145, -17, -197, 
-	-221, -158, -80, -14, -68, -154, -154, -68, 68, 121, -9, -148, -179, -179, -136, -28
-};
-
-static const short ugen_H20e015a0c[] = { 
-	-2, 0, -2, -3, 1, -4, 11, -8, 15, -18, 17, -21, 15, -2, 6, 0, 
-	1513, 5287, 1426, -1129, -1990, -3960, 1931, 3521, 5293, 8934, 4200, -888, 1057, 423, -5321, -7059, 
-	-4271, -2953, -3551, -1517, -28, -292, 1495, 2103, 1523, 1593, 1302, 832, 636, 374, 364, 250, 
-	214, 130, -773, -1523, -1691, -1419, -952, 6, 666, 253, -127, 195, 276, -56, -496, -641, 
-	-607, -624, -574, -572, -593, -598, -548, -552, -441, -157, 30, -27, -21, -12, -68, -12, 
-	89, 88, -44, -186, -224, -201, -163, -114, -93, -139, -211, -191, -132, -68, -35, -35, 
-	-87, -131, -120, -82, -43, -26, -63, -171, -229, -171, -120, -85, -84, -127, -126, -61, 
-	29, 37, -38, -172, -227, -185, -156, -85, -58, -86, -66, -12, 57, 100, 70, -43
-};
-
-static const short ugen_H20e015a1c[] = { 
-	-9, 28, -25, 38, -40, 32, -32, 15, 13, -32, 33, 2210, 10260, 2206, -4134, -5290, 
-	-6476, 5436, 5492, 9698, 15695, 3400, -6017, 419, -290, -10447, -11255, -5558, -2527, -4253, -1561, 1170, 
-	-422, 2446, 3191, 1825, 2685, 2975, 1142, -153, -436, 392, 989, 215, 426, -1069, -3025, -3414, 
-	-2786, -1441, -442, 142, 1030, 1253, 983, 888, 552, -436, -1545, -1764, -888, -264, -244, -93, 
-	-269, -290, -340, -219, 163, 276, -104, -266, -189, -110, 70, 227, 287, 26, -312, -405, 
-	-402, -352, -238, -188, -172, -194, -84, -53, 16, 89, 28, -179, -313, -251, -128, -35, 
-	-22, -73, -186, -197, -111, -61, -91, -166, -242, -185, 2, 195, 229, 43, -204, -272, 
-	-196, -96, -21, -82, -173, -167, -104, 37, 139, 31, -138, -203, -214, -165, -28, 5
-};
-
-static const short ugen_H20e020a0c[] = { 
-	-3, 0, 0, 0, -1, 1, -3, 11, -7, 13, -15, 18, -22, 25, -16, 27, 
-	-4, 1602, 4711, 1227, -970, -2257, -3028, 1885, 3034, 5486, 7860, 3465, -101, 1178, -264, -4666, 
-	-5873, -4201, -2942, -2904, -1436, -351, -100, 1337, 1704, 1456, 1319, 1207, 1083, 734, 230, 222, 
-	349, 236, 54, -646, -1159, -1314, -1324, -874, 36, 371, -105, -345, -6, 231, -249, -697, 
-	-487, -441, -508, -471, -331, -386, -565, -565, -543, -450, -264, -101, -122, -83, -92, -165, 
-	-40, 114, 134, -11, -147, -135, -113, -88, -57, -74, -134, -184, -189, -173, -136, -102, 
-	-81, -105, -160, -147, -87, -39, -26, -82, -150, -160, -112, -97, -83, -72, -113, -130, 
-	-77, 1, 17, -57, -164, -212, -206, -167, -93, -62, -78, -39, 14, 49, 93, 58
-};
-
-static const short ugen_H20e020a1c[] = { 
-	13, -2, 6, 6, -30, 47, -87, 142, -196, 243, 656, 9341, 6567, -4007, -5682, -7755, 
-	3022, 5953, 8422, 17175, 7262, -5606, -1209, 107, -8908, -11748, -8184, -3293, -2709, -2417, 335, 138, 
-	2166, 2992, 1675, 2675, 3106, 1693, 206, -402, -26, 1151, 418, 573, -196, -2860, -4285, -3392, 
-	-1378, -548, -44, 812, 1156, 1018, 1020, 749, -482, -1921, -1759, -459, -184, -445, -61, 15, 
-	-130, -419, -335, 191, 391, 71, -233, -320, -246, -4, 77, 271, 78, -310, -447, -379, 
-	-283, -188, -140, -122, -138, -71, -18, -4, 90, 60, -190, -382, -359, -226, -75, -46, 
-	-47, -132, -195, -163, -85, -59, -113, -180, -182, -31, 195, 307, 117, -195, -305, -222, 
-	-135, -44, -62, -162, -207, -154, 1, 145, 80, -109, -217, -233, -176, -35, 28, -45
-};
-
-static const short ugen_H20e025a0c[] = { 
-	-3, -2, -1, 0, -1, -2, 0, -2, 9, -8, 12, -15, 15, -19, 22, -18, 
-	33, -7, 1549, 4224, 1187, -1021, -2166, -2302, 1526, 2857, 5359, 6822, 3215, 484, 988, -473, 
-	-3780, -5198, -4143, -2614, -2473, -1563, -461, -47, 1048, 1544, 1311, 1181, 1314, 1135, 620, 60, 
-	229, 468, 326, 198, -325, -812, -1339, -1507, -764, -35, -208, -483, -270, 35, 8, -472, 
-	-623, -305, -259, -385, -349, -182, -190, -464, -666, -617, -471, -331, -274, -237, -149, -161, 
-	-166, -17, 153, 153, 27, -54, -62, -51, -49, -53, -69, -130, -187, -221, -221, -176, 
-	-131, -125, -165, -189, -150, -74, -26, -37, -66, -110, -106, -82, -82, -69, -78, -112, 
-	-125, -84, -36, -25, -85, -162, -191, -209, -180, -87, -33, -44, -39, -6, 33, 68
-};
-
-static const short ugen_H20e025a1c[] = { 
-	21, -26, 49, -76, 97, -143, 193, -242, 308, -155, 6698, 10363, -1364, -6446, -8826, 316, 
-	5663, 6999, 17118, 11535, -3071, -2925, 350, -7510, -11521, -9969, -5632, -2340, -2216, 160, -117, 1429, 
-	3759, 1680, 1864, 3228, 2459, 410, -261, -185, 1022, 666, 682, 691, -2692, -5004, -3495, -1490, 
-	-866, -42, 409, 849, 1063, 1086, 702, -665, -1715, -1242, -406, -305, -498, -111, 248, -43, 
-	-525, -508, 150, 539, 287, -196, -288, -283, -151, -28, 125, 57, -217, -470, -386, -249, 
-	-137, -66, -55, -73, -88, -38, -38, 94, 101, -126, -399, -423, -333, -164, -31, -33, 
-	-165, -245, -184, -103, -39, -46, -124, -156, -35, 180, 309, 172, -124, -310, -279, -200, 
-	-55, -26, -143, -228, -210, -60, 130, 132, -67, -222, -259, -194, -48, 46, -2, -66
-};
-
-static const short ugen_H20e030a0c[] = { 
-	-2, -1, -1, 0, 0, 0, -1, 1, 0, 7, -6, 13, -12, 17, -16, 19, 
-	-8, 22, 0, 1404, 3830, 1172, -1054, -1865, -1920, 1195, 2772, 4965, 6060, 3170, 763, 870, 
-	-327, -3071, -4719, -3907, -2259, -2265, -1665, -536, -114, 910, 1496, 1157, 1057, 1362, 1058, 353, 
-	58, 493, 649, 634, 452, -319, -952, -1497, -1471, -804, -434, -648, -535, -103, 23, -258, 
-	-543, -347, -71, -163, -326, -204, -5, -127, -492, -709, -666, -497, -419, -395, -329, -206, 
-	-157, -106, 20, 143, 181, 93, 38, 19, -20, -79, -88, -64, -121, -206, -242, -240, 
-	-208, -172, -164, -187, -174, -126, -69, -30, -7, -15, -75, -93, -64, -41, -43, -73, 
-	-124, -150, -115, -55, -42, -95, -155, -179, -169, -127, -57, -35, -63, -46, -12, 10
-};
-
-static const short ugen_H20e030a1c[] = { 
-	-25, 50, -74, 74, -101, 105, -109, 116, -154, 3333, 11759, 3612, -6134, -10127, -2709, 5265, 
-	4930, 16137, 15141, 44, -2553, 196, -6581, -10383, -10750, -8761, -2916, -2160, -844, 913, 865, 2978, 
-	2642, 2025, 2304, 2706, 1422, -253, -563, 980, 1057, 523, 1293, -2416, -5031, -3510, -1887, -911, 
-	-226, 29, 557, 1029, 863, 248, -842, -956, -348, -648, -634, -208, 15, 112, -153, -496, 
-	-630, -55, 526, 477, -26, -146, -294, -291, -71, 19, 1, -251, -419, -329, -263, -202, 
-	24, 88, -11, -117, -126, -82, 60, 124, -23, -340, -466, -390, -227, -45, -33, -194, 
-	-333, -258, -98, -2, -1, -63, -128, -51, 135, 294, 228, -45, -294, -333, -259, -108, 
-	4, -96, -233, -254, -127, 89, 165, 3, -195, -291, -236, -84, 52, 42, -39, -88
-};
-
-static const short ugen_H20e035a0c[] = { 
-	-2, -2, -2, -2, -1, -1, -1, -2, 0, -2, 2, -8, 9, -10, 11, -16, 
-	16, -11, 12, 9, 1196, 3478, 1175, -991, -1563, -1753, 959, 2609, 4507, 5518, 3105, 948, 
-	866, -102, -2505, -4257, -3608, -2019, -2142, -1748, -587, -64, 932, 1255, 882, 1044, 1245, 833, 
-	377, 379, 834, 1014, 648, 89, -444, -1006, -1707, -1608, -859, -732, -858, -411, -6, -81, 
-	-403, -347, -55, 4, -152, -219, -96, -41, -157, -490, -705, -677, -565, -514, -467, -358, 
-	-246, -146, -41, 44, 136, 201, 172, 100, 16, -81, -132, -97, -68, -120, -232, -289, 
-	-277, -245, -193, -170, -181, -171, -123, -65, -22, 5, -8, -46, -68, -52, -47, -64, 
-	-99, -173, -179, -129, -72, -60, -97, -137, -154, -134, -118, -85, -62, -70, -58, -53
-};
-
-static const short ugen_H20e035a1c[] = { 
-	13, -12, -7, 13, -49, 96, -151, 186, 720, 9883, 9109, -3280, -10979, -6556, 4712, 3458, 
-	12704, 18595, 3941, -2640, 1539, -4730, -10800, -9479, -10799, -6086, -1621, -1789, 82, 1270, 3270, 2376, 
-	2019, 2902, 2430, 1551, 442, -442, 98, 1561, 815, 934, -2111, -4153, -3278, -2741, -924, -219, 
-	-311, 199, 1043, 497, -615, -957, -47, 504, -624, -897, -131, 378, 159, -458, -637, -639, 
-	-279, 287, 504, 237, 68, -249, -384, -55, -15, -51, -257, -343, -319, -305, -238, 67, 
-	236, 71, -140, -242, -138, 49, 137, -1, -259, -410, -400, -260, -75, -42, -181, -359, 
-	-347, -185, 21, 96, 18, -129, -97, 92, 259, 288, 45, -263, -392, -291, -136, 5, 
-	-46, -207, -275, -180, 36, 166, 78, -124, -277, -287, -149, 30, 89, 17, -80, -121
-};
-
-static const short ugen_H20e040a0c[] = { 
-	0, 0, -1, 0, -2, 0, 0, 0, 0, 3, 0, 4, -2, 10, -3, 9, 
-	-8, 13, -5, 18, 6, 984, 3155, 1205, -841, -1307, -1659, 764, 2393, 4078, 5074, 3088, 
-	1094, 914, 168, -2021, -3803, -3307, -1838, -2043, -1693, -455, -27, 727, 895, 665, 1047, 1170, 
-	864, 785, 888, 922, 706, 332, -18, -588, -1365, -1855, -1429, -903, -954, -802, -255, 10, 
-	-112, -312, -162, 91, 33, -155, -184, -93, -34, -169, -486, -663, -685, -639, -570, -452, 
-	-350, -234, -97, 7, 91, 157, 223, 189, 71, -30, -99, -116, -102, -85, -133, -260, 
-	-326, -284, -214, -191, -158, -143, -142, -111, -52, -3, 15, 28, -14, -62, -76, -72, 
-	-77, -127, -167, -175, -138, -66, -29, -57, -119, -147, -130, -106, -74, -62, -74, -71
-};
-
-static const short ugen_H20e040a1c[] = { 
-	34, -71, 88, -130, 170, -216, 277, -276, 5687, 12347, 2421, -9962, -10890, 2470, 3994, 7708, 
-	19467, 9405, -1884, 1464, -1439, -9816, -9693, -10610, -8900, -3202, -2396, -653, 490, 2579, 3892, 2142, 
-	2264, 2862, 2640, 318, -394, 88, 1279, 1015, 299, -1598, -3351, -2873, -2957, -1451, -396, -275, 
-	77, 689, 30, -1309, -1014, 474, 999, -188, -804, -177, 472, 325, -392, -719, -868, -655, 
-	26, 375, 396, 179, -109, -299, -90, -18, -31, -169, -268, -310, -395, -287, 104, 344, 
-	128, -189, -295, -186, -12, 122, 20, -181, -357, -387, -303, -104, -16, -105, -336, -428, 
-	-272, -31, 143, 86, -86, -137, 18, 205, 307, 146, -204, -417, -362, -187, 2, 23, 
-	-140, -285, -240, -37, 147, 136, -34, -224, -328, -215, -11, 98, 70, -36, -146, -104
-};
-
-static const short ugen_H20e045a0c[] = { 
-	0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 1, -2, 1, -2, 10, -5, 
-	4, -6, 6, 0, 10, -1, 785, 2819, 1248, -633, -1113, -1617, 592, 2142, 3652, 4752, 
-	3073, 1156, 1026, 433, -1660, -3344, -2974, -1675, -1801, -1549, -497, -167, 334, 583, 796, 1115, 
-	1266, 1376, 1013, 528, 588, 597, 52, -377, -854, -1522, -1637, -1213, -1046, -995, -587, -98, 
-	-9, -121, -201, -41, 64, -59, -125, -138, -77, -47, -215, -495, -636, -707, -700, -531, 
-	-388, -326, -191, -44, 28, 87, 148, 185, 131, 31, -42, -96, -126, -133, -121, -182, 
-	-285, -298, -264, -216, -162, -111, -112, -127, -93, -44, -3, 24, 20, -30, -81, -85, 
-	-98, -110, -129, -161, -164, -127, -48, -18, -46, -108, -151, -126, -95, -59, -63, -90
-};
-
-static const short ugen_H20e045a1c[] = { 
-	-33, 28, -43, 28, -13, -11, -13, 1558, 11177, 9196, -5559, -13894, -2847, 5593, 3863, 16487, 
-	14893, 540, 833, 1582, -7326, -9891, -9518, -11120, -5169, -2775, -2724, 8, 1482, 3515, 3027, 3201, 
-	2382, 2649, 2152, -176, -519, 1099, 1425, -941, -1228, -2051, -2959, -2846, -1737, -729, -426, 150, 
-	479, -535, -1996, -953, 864, 1028, 215, -380, -55, 409, 335, -118, -593, -899, -1058, -530, 
-	142, 437, 189, -48, -109, -80, -43, 12, 66, -152, -370, -375, -286, -9, 347, 243, 
-	-169, -367, -238, -80, 38, 43, -66, -311, -437, -334, -124, 10, -14, -230, -442, -349, 
-	-99, 128, 96, -55, -132, -51, 120, 273, 234, -104, -413, -419, -249, -58, 45, -35, 
-	-213, -286, -139, 88, 161, 46, -146, -317, -273, -70, 69, 84, 23, -110, -184, -60
-};
-
-static const short ugen_H20e050a0c[] = { 
-	0, 1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2, 2, -1, 10, 
-	-4, 2, -2, 5, 4, 0, 2, 609, 2474, 1319, -399, -975, -1578, 426, 1858, 3305, 
-	4520, 3035, 1208, 1155, 633, -1336, -2792, -2503, -1492, -1698, -1572, -731, -330, 202, 633, 1106, 
-	1437, 1441, 1047, 559, 378, 395, 181, -328, -507, -930, -1374, -1304, -1156, -1069, -762, -357, 
-	-107, -33, -95, -204, -119, 2, -14, -73, -104, -80, -132, -262, -481, -657, -682, -596, 
-	-449, -348, -267, -136, -57, 4, 73, 101, 118, 108, 13, -75, -111, -159, -163, -165, 
-	-201, -247, -273, -236, -177, -114, -83, -90, -91, -98, -65, -17, 11, 5, -46, -86, 
-	-109, -123, -121, -126, -143, -151, -110, -40, -9, -41, -102, -128, -112, -87, -73, -77
-};
-
-static const short ugen_H20e050a1c[] = { 
-	-49, 66, -109, 141, -196, 246, -233, 6085, 13285, 2405, -12960, -10323, 4751, 3795, 10222, 18571, 
-	4939, -92, 3417, -2983, -9410, -8972, -11141, -8255, -3114, -3775, -1657, -79, 2658, 3421, 2901, 3500, 
-	2917, 2724, 794, 295, 713, 885, -1318, -1363, -1100, -2905, -2614, -2083, -1152, -418, 140, 277, 
-	-948, -2401, -1184, 1009, 1123, 521, -46, 86, 522, 334, 71, -342, -800, -1162, -1043, -348, 
-	216, 141, -36, -32, -59, 9, 27, 221, 147, -268, -428, -266, -59, 211, 259, -46, 
-	-326, -352, -224, -48, 81, 9, -261, -478, -375, -163, 23, 46, -109, -334, -381, -182, 
-	31, 114, -11, -146, -139, -4, 213, 285, 29, -347, -469, -330, -143, 44, 31, -138, 
-	-271, -221, 5, 148, 93, -78, -263, -292, -133, 23, 69, 43, -64, -197, -143, 9
-};
-
-static const short ugen_H20e055a0c[] = { 
-	0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 
-	8, -5, 0, 0, 2, 2, -5, 9, 446, 2129, 1398, -152, -843, -1550, 213, 1587, 
-	3020, 4345, 2986, 1210, 1285, 863, -833, -2099, -2211, -1633, -1840, -1573, -614, -297, 316, 1201, 
-	1254, 902, 985, 776, 245, 8, 66, -71, -369, -450, -870, -1110, -1001, -1018, -936, -587, 
-	-289, -131, -114, -240, -275, -123, 24, 52, -57, -160, -134, -183, -328, -464, -522, -575, 
-	-523, -372, -295, -252, -149, -73, -42, 24, 65, 83, 50, -29, -104, -159, -177, -172, 
-	-173, -197, -208, -212, -196, -147, -88, -54, -76, -102, -123, -85, -23, 0, -15, -76, 
-	-103, -118, -134, -134, -120, -120, -127, -96, -44, -13, -25, -73, -111, -116, -112, -93
-};
-
-static const short ugen_H20e055a1c[] = { 
-	0, -4, -9, 33, -74, 67, 1028, 10913, 11327, -6020, -15763, -2159, 6599, 4429, 17023, 12252, 
-	-435, 3082, 1728, -6635, -8792, -9551, -11266, -4949, -3267, -3720, -1091, 374, 2867, 3085, 3560, 2897, 
-	3715, 2646, 282, 1341, 1279, -1841, -2253, -75, -2455, -3015, -2101, -1703, -660, 112, 403, -1274, 
-	-2844, -1397, 973, 1079, 784, 480, 161, 452, 500, 340, -158, -654, -977, -1326, -916, -129, 
-	-3, -154, -72, -103, 20, 83, 275, 446, 35, -314, -289, -132, 106, 252, 27, -244, 
-	-394, -343, -184, 36, 89, -177, -474, -442, -208, -17, 84, 22, -158, -336, -266, -61, 
-	81, 81, -101, -231, -148, 65, 269, 193, -175, -451, -410, -244, -33, 103, -18, -237, 
-	-287, -100, 114, 150, 12, -197, -309, -187, -14, 67, 58, -24, -166, -209, -47, 73
-};
-
-static const short ugen_H20e060a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 
-	3, 3, 0, 0, 4, 2, 0, -3, 22, 315, 1797, 1460, 90, -698, -1558, -5, 
-	1366, 2816, 4207, 2874, 1260, 1562, 1320, -383, -1869, -2344, -1769, -1495, -1260, -369, 237, 580, 
-	661, 543, 659, 582, 194, -128, -166, 44, 5, -280, -447, -637, -652, -762, -971, -806, 
-	-504, -344, -257, -267, -342, -282, -46, 78, -24, -140, -143, -197, -239, -213, -337, -448, 
-	-479, -411, -345, -308, -237, -186, -114, -57, -4, 10, 12, 9, -81, -140, -150, -163, 
-	-175, -175, -134, -154, -177, -160, -118, -65, -66, -77, -115, -120, -81, -46, -19, -45, 
-	-81, -120, -136, -131, -112, -90, -104, -108, -95, -37, 8, -4, -55, -107, -132, -133
-};
-
-static const short ugen_H20e060a1c[] = { 
-	40, -75, 101, -116, 132, -202, 3840, 14155, 5957, -13364, -12781, 4919, 5161, 8811, 18379, 4188, 
-	102, 4444, -1405, -7969, -8224, -10279, -9396, -3719, -4010, -2521, -1306, 1079, 2683, 2891, 3652, 2982, 
-	3927, 2132, 1831, 1633, -1372, -2297, -463, -1558, -3039, -2343, -2484, -1187, 86, 395, -1166, -3117, 
-	-1902, 584, 1232, 903, 878, 609, 384, 423, 559, 252, -452, -811, -1270, -1327, -617, -227, 
-	-219, -209, -280, -168, 75, 334, 616, 401, -48, -173, -130, -13, 185, 133, -156, -388, 
-	-443, -305, -62, 77, -77, -364, -464, -325, -101, 72, 138, 23, -211, -296, -162, 18, 
-	133, 25, -229, -300, -122, 135, 259, 57, -296, -443, -345, -140, 68, 99, -122, -299, 
-	-229, 7, 158, 121, -52, -267, -295, -105, 60, 95, 43, -94, -230, -158, 35, 111
-};
-
-static const short ugen_H20e065a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, -1, 
-	1, 1, 1, 1, -6, 13, -8, -1, 2, 28, 202, 1501, 1492, 327, -537, -1613, 
-	-240, 1197, 2702, 4060, 2880, 1632, 1876, 1349, -584, -1769, -1875, -1459, -1068, -387, 48, -406, 
-	-130, 263, 53, 47, 35, -149, -211, 137, 223, -31, -146, -143, -280, -429, -663, -924, 
-	-825, -575, -417, -391, -403, -331, -198, -76, -55, -88, -123, -167, -143, -108, -156, -265, 
-	-338, -390, -403, -356, -315, -288, -201, -117, -101, -76, -51, -41, -56, -86, -119, -146, 
-	-168, -157, -120, -104, -122, -143, -138, -110, -77, -71, -86, -113, -117, -94, -72, -54, 
-	-65, -104, -127, -115, -106, -96, -90, -95, -102, -72, -7, 13, -7, -67, -117, -145
-};
-
-static const short ugen_H20e065a1c[] = { 
-	51, -95, 146, -192, 239, -120, 7442, 14899, -1128, -17423, -6410, 8379, 4103, 13780, 14465, -463, 
-	2645, 3579, -3729, -8389, -8008, -10053, -7293, -4024, -4165, -1910, -1070, 1495, 2351, 3139, 2952, 3659, 
-	3683, 2192, 3224, -195, -2714, -592, -226, -2646, -3068, -2574, -2326, -602, 504, -717, -3286, -2613, 
-	86, 989, 1068, 1112, 1190, 778, 239, 431, 635, 18, -603, -1099, -1497, -1068, -505, -386, 
-	-279, -399, -490, -241, 237, 690, 700, 310, 21, -1, 16, 82, 118, -13, -294, -483, 
-	-474, -230, 15, 5, -229, -412, -427, -248, -7, 154, 188, -19, -255, -231, -61, 88, 
-	138, -98, -346, -325, -68, 173, 201, -66, -363, -402, -254, -34, 121, 30, -230, -315, 
-	-140, 81, 166, 82, -130, -311, -258, -38, 92, 116, 21, -164, -240, -89, 79, 98
-};
-
-static const short ugen_H20e070a0c[] = { 
-	0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 2, 0, 1, 
-	1, 1, 3, 5, 1, -1, 22, -19, 5, 11, 34, 132, 1259, 1484, 563, -380, 
-	-1737, -490, 1171, 2798, 4222, 3110, 1564, 1332, 1150, -36, -1140, -1377, -512, -305, -858, -817, 
-	-743, -644, -600, -461, -327, -265, -6, 213, 314, 263, 303, 116, -14, -40, -285, -769, 
-	-1040, -830, -609, -518, -479, -379, -350, -311, -148, -82, -83, -54, -27, -52, -63, -57, 
-	-181, -305, -382, -404, -390, -361, -266, -203, -164, -150, -132, -107, -61, -38, -81, -114, 
-	-130, -130, -122, -93, -67, -94, -128, -135, -103, -85, -78, -75, -98, -117, -125, -103, 
-	-77, -61, -80, -103, -102, -99, -91, -80, -65, -61, -37, -12, -4, -22, -66, -112
-};
-
-static const short ugen_H20e070a1c[] = { 
-	29, -62, 107, -162, 188, 493, 10857, 13336, -7964, -17942, 399, 8748, 4725, 16593, 8743, -1372, 
-	4509, 2258, -5335, -8618, -7571, -9211, -6058, -4522, -3868, -2196, -580, 1851, 2138, 3144, 2674, 3950, 
-	3428, 3241, 1965, -1875, -951, 63, -828, -2697, -3237, -3014, -1858, 1, -374, -2690, -3540, -804, 
-	616, 915, 1265, 1451, 1562, 677, 136, 488, 598, -119, -832, -1417, -1413, -849, -560, -381, 
-	-439, -688, -635, -186, 486, 811, 680, 335, 187, 152, 144, 77, 33, -111, -392, -551, 
-	-483, -158, 31, -85, -281, -426, -425, -163, 105, 235, 166, -77, -242, -147, 14, 160, 
-	59, -252, -409, -274, -2, 167, 140, -165, -388, -338, -142, 48, 118, -46, -297, -293, 
-	-49, 156, 167, 14, -211, -324, -181, 26, 105, 112, 0, -184, -202, -30, 79, 76
-};
-
-static const short ugen_H20e075a0c[] = { 
-	0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0, -1, 
-	2, -1, 1, 4, 3, 0, 4, 14, -30, 18, 20, 37, 72, 1076, 1484, 780, 
-	-326, -1948, -603, 1624, 3429, 3951, 2155, 1146, 1714, 1732, 471, -20, -382, -1004, -1071, -1144, 
-	-1417, -1563, -1313, -1061, -738, -275, 28, 209, 461, 721, 563, 347, 229, 157, -34, -453, 
-	-943, -1054, -837, -630, -549, -549, -508, -470, -289, -129, -51, 31, 73, 42, 14, 30, 
-	-38, -194, -327, -420, -443, -425, -342, -267, -240, -212, -209, -155, -97, -53, -58, -78, 
-	-84, -106, -105, -96, -73, -68, -95, -115, -142, -113, -76, -66, -78, -123, -150, -150, 
-	-101, -54, -45, -84, -109, -103, -94, -64, -44, -39, -57, -54, -31, -16, -34, -77
-};
-
-static const short ugen_H20e075a1c[] = { 
-	-7, -2, 23, -64, 39, 1474, 13305, 10594, -13166, -16056, 5726, 7642, 6309, 16802, 4007, -431, 
-	5531, 1365, -6682, -8575, -6895, -8375, -5607, -4633, -3724, -2644, -202, 1785, 2429, 2893, 2689, 4097, 
-	3494, 3336, -177, -1596, 548, 374, -946, -3159, -3125, -2877, -1521, -336, -1924, -3899, -2319, 215, 
-	299, 1061, 1621, 1926, 1527, 556, 269, 529, 454, -270, -1089, -1515, -1231, -806, -548, -453, 
-	-696, -909, -739, -17, 604, 772, 661, 436, 351, 265, 170, 57, 0, -194, -475, -627, 
-	-471, -108, -10, -158, -312, -468, -397, -108, 168, 272, 113, -124, -214, -73, 64, 149, 
-	-49, -386, -428, -214, 28, 134, 64, -244, -414, -279, -69, 85, 80, -131, -344, -258, 
-	33, 177, 114, -73, -278, -318, -125, 55, 95, 75, -54, -197, -171, -23, 56, 38
-};
-
-static const short ugen_H20e080a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-	-1, 0, -2, 2, 2, 3, 5, 2, 0, -24, 46, 14, 10, 51, 997, 1502, 
-	966, -442, -1948, 28, 2090, 2718, 2834, 2328, 1958, 2127, 2656, 1643, -413, -1405, -1120, -1523, 
-	-2255, -2039, -1852, -1763, -1089, -291, -79, 124, 729, 1027, 801, 560, 471, 187, 62, -162, 
-	-677, -1045, -994, -778, -705, -707, -677, -554, -375, -196, -58, 58, 136, 153, 120, 88, 
-	12, -94, -272, -395, -450, -464, -404, -330, -291, -286, -254, -194, -126, -90, -62, -53, 
-	-57, -61, -61, -91, -123, -97, -55, -78, -136, -132, -88, -84, -97, -109, -141, -152, 
-	-108, -77, -70, -69, -86, -97, -83, -49, -46, -51, -54, -60, -59, -46, -41, -56
-};
-
-static const short ugen_H20e080a1c[] = { 
-	-38, 52, -52, 33, -100, 2413, 14690, 7922, -16469, -13409, 9111, 6436, 7721, 15551, 1064, 802, 
-	6268, 908, -7774, -8193, -6256, -7853, -5487, -4453, -3842, -2930, 45, 1440, 2596, 2977, 2759, 4172, 
-	3846, 1955, -1305, -234, 821, 667, -665, -3347, -3218, -2345, -1140, -1624, -3446, -3703, -1129, 74, 
-	204, 1373, 1949, 2190, 1357, 587, 480, 620, 327, -507, -1183, -1378, -1189, -803, -467, -614, 
-	-942, -1033, -706, 63, 593, 763, 671, 544, 485, 345, 188, 97, 14, -245, -539, -648, 
-	-409, -100, -70, -176, -342, -482, -339, -43, 193, 275, 113, -132, -181, -14, 114, 121, 
-	-128, -427, -413, -173, 42, 159, 17, -312, -407, -220, 0, 104, 65, -181, -341, -176, 
-	91, 164, 71, -94, -305, -292, -70, 82, 109, 48, -97, -204, -122, 21, 57, 14
-};
-
-static const short ugen_H20e085a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-	-1, 0, 1, -1, 2, 2, 12, 0, -8, 3, 11, 34, -3, -4, 111, 1019, 
-	1607, 1276, -265, -1846, -646, 1604, 3240, 3193, 2694, 3094, 3269, 2071, 478, -659, -1927, -2181, 
-	-2246, -2612, -2265, -1874, -1450, -718, -109, 303, 720, 1053, 1116, 834, 459, 290, 125, -63, 
-	-451, -789, -972, -1020, -910, -806, -766, -609, -373, -251, -105, 63, 166, 198, 224, 173, 
-	23, -100, -198, -333, -438, -457, -414, -396, -356, -313, -283, -220, -141, -102, -95, -60, 
-	-28, -5, -22, -102, -165, -117, -43, -47, -83, -112, -121, -115, -113, -108, -105, -107, 
-	-109, -110, -110, -74, -42, -48, -57, -63, -65, -62, -43, -49, -68, -70, -65, -58
-};
-
-static const short ugen_H20e085a1c[] = { 
-	-47, 69, -84, 78, -171, 2849, 15189, 6320, -17987, -11410, 10803, 5742, 8179, 14095, -343, 1684, 
-	6987, 915, -8433, -7693, -5702, -7706, -5521, -4219, -4027, -3200, 151, 1164, 2427, 3054, 2971, 4363, 
-	3707, 563, -1339, 668, 748, 859, -468, -3062, -3085, -2012, -1117, -2785, -4379, -3143, -657, -302, 
-	271, 1620, 2163, 2208, 1224, 694, 699, 727, 248, -648, -1160, -1253, -1236, -780, -436, -794, 
-	-1124, -1111, -641, 34, 506, 746, 701, 593, 565, 395, 221, 165, 41, -275, -570, -629, 
-	-372, -147, -138, -202, -382, -491, -303, 1, 195, 255, 108, -125, -168, 11, 145, 108, 
-	-173, -446, -409, -168, 43, 164, -14, -371, -405, -182, 31, 107, 46, -200, -331, -137, 
-	113, 154, 58, -116, -325, -284, -39, 97, 84, 7, -135, -210, -95, 59, 55, -20
-};
-
-static const short ugen_H20e090a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, -1, 0, 
-	1, -1, 1, 0, 0, 4, 6, 11, -17, 6, 26, 13, -5, 3, -16, 322, 
-	1336, 2586, 1516, -2582, -3104, 732, 3502, 3674, 3577, 3936, 2766, 1946, 1513, -203, -2185, -2743, 
-	-2312, -2578, -2537, -1805, -1517, -1188, -205, 477, 617, 928, 1218, 985, 538, 325, 183, -59, 
-	-268, -552, -928, -1155, -1085, -888, -755, -574, -383, -290, -142, 62, 147, 197, 258, 208, 
-	21, -121, -173, -274, -393, -418, -424, -441, -410, -339, -272, -231, -164, -110, -117, -92, 
-	-2, 22, -49, -133, -151, -115, -64, -34, -45, -90, -139, -152, -128, -101, -75, -80, 
-	-127, -136, -120, -80, -24, 1, -43, -95, -88, -67, -45, -54, -67, -84, -102, -86
-};
-
-static const short ugen_H20e090a1c[] = { 
-	-40, 61, -68, 55, -139, 2582, 14996, 6312, -18047, -10885, 11270, 5832, 7493, 13087, -650, 2013, 
-	7695, 1477, -8536, -7417, -5055, -7779, -5804, -4051, -4074, -3541, 66, 1085, 2160, 2964, 3024, 4650, 
-	3261, -227, -743, 824, 558, 1149, -333, -2839, -2594, -1707, -1578, -3497, -4453, -2804, -920, -452, 
-	405, 1608, 2277, 2153, 1090, 800, 928, 888, 253, -642, -1064, -1216, -1272, -744, -500, -915, 
-	-1212, -1160, -603, -34, 390, 697, 723, 609, 605, 439, 273, 244, 105, -255, -574, -599, 
-	-350, -200, -184, -243, -422, -481, -285, 10, 187, 260, 95, -125, -148, 30, 161, 117, 
-	-175, -459, -405, -153, 37, 136, -43, -374, -398, -167, 43, 100, 44, -205, -326, -117, 
-	140, 163, 57, -130, -331, -265, -25, 79, 49, -18, -146, -205, -80, 67, 50, -40
-};
-
-static const short ugen_H20e095a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, -1, 0, 
-	1, 0, -1, 0, 0, 6, 0, 9, -4, -6, 29, 25, -23, -7, -6, 243, 
-	1578, 2616, 1399, -2602, -3421, 649, 3266, 4360, 4190, 2887, 2500, 2709, 1261, -907, -1703, -2318, 
-	-2746, -2422, -2006, -1909, -1590, -951, -367, 223, 590, 867, 951, 905, 718, 393, 105, 0, 
-	-111, -522, -972, -1149, -1087, -917, -683, -484, -365, -300, -134, 36, 132, 175, 196, 132, 
-	0, -103, -175, -246, -330, -382, -426, -464, -415, -327, -256, -207, -178, -130, -123, -77, 
-	-9, -21, -103, -137, -104, -99, -70, -35, -41, -89, -142, -150, -124, -73, -62, -99, 
-	-141, -135, -88, -61, -10, 0, -44, -96, -101, -73, -53, -53, -84, -111, -110, -86
-};
-
-static const short ugen_H20e095a1c[] = { 
-	-15, 13, -2, -34, -12, 1710, 14029, 7875, -16765, -11817, 10595, 6688, 5884, 12483, 21, 1652, 
-	8327, 2655, -8006, -7584, -4285, -7740, -6409, -4096, -3963, -3891, -297, 1139, 1945, 2791, 2830, 4627, 
-	3003, -292, -204, 658, 395, 1276, -52, -2624, -2290, -1447, -1881, -3801, -4266, -2652, -1359, -610, 
-	423, 1515, 2185, 2076, 1062, 790, 1063, 1164, 362, -594, -895, -1178, -1294, -774, -574, -966, 
-	-1238, -1184, -632, -134, 263, 605, 699, 609, 616, 480, 338, 298, 202, -176, -556, -570, 
-	-369, -239, -225, -289, -464, -503, -285, 4, 169, 246, 101, -122, -152, 57, 178, 119, 
-	-160, -434, -397, -180, 20, 99, -63, -356, -384, -173, 36, 89, 30, -208, -316, -103, 
-	157, 175, 51, -117, -309, -267, -50, 46, 8, -32, -131, -207, -98, 52, 41, -26
-};
-
-static const short ugen_H20e100a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 
-	0, 0, 0, -1, 0, 5, 0, 3, 0, 9, 3, 39, -15, -11, 48, 906, 
-	2102, 1437, -104, -2129, -2186, 1233, 4128, 4243, 2854, 2392, 2772, 2338, 483, -1279, -1768, -1820, 
-	-2104, -2291, -1831, -1443, -1266, -867, -282, 56, 314, 637, 720, 734, 629, 441, 190, 27, 
-	-174, -582, -979, -1123, -973, -768, -594, -428, -286, -207, -138, 8, 143, 119, 49, 0, 
-	-49, -101, -163, -220, -302, -370, -411, -434, -373, -287, -225, -195, -169, -143, -105, -71, 
-	-76, -91, -118, -114, -88, -74, -62, -49, -60, -114, -143, -117, -78, -62, -87, -124, 
-	-141, -107, -48, -20, -17, -36, -56, -82, -99, -79, -60, -79, -125, -124, -81, -58
-};
-
-static const short ugen_H20e100a1c[] = { 
-	25, -53, 92, -152, 171, 618, 11978, 10565, -13868, -13815, 8550, 8223, 3917, 11651, 1908, 645, 
-	8519, 4512, -6658, -8239, -3608, -7198, -7272, -4463, -3781, -4117, -972, 1207, 1851, 2606, 2527, 4243, 
-	2956, 154, 134, 444, 347, 1190, 268, -2220, -2230, -1482, -1923, -3528, -4076, -2784, -1641, -689, 
-	237, 1319, 1993, 1962, 1128, 724, 1095, 1412, 609, -473, -743, -1036, -1272, -887, -644, -965, 
-	-1208, -1181, -696, -248, 147, 498, 631, 601, 614, 518, 399, 367, 298, -65, -488, -552, 
-	-396, -260, -244, -317, -485, -520, -318, -14, 140, 224, 136, -81, -145, 55, 193, 133, 
-	-115, -380, -384, -219, -12, 72, -47, -319, -370, -170, 17, 71, 14, -174, -286, -101, 
-	157, 177, 77, -62, -261, -285, -105, 29, 0, -35, -123, -202, -120, 38, 70, 6
-};
-
-static const short ugen_H20e105a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 
-	2, 0, 0, 0, 3, 2, 5, 1, 0, 13, 16, 1, 27, 28, 678, 1812, 
-	1249, 66, -860, -1942, -351, 3221, 4478, 2766, 1704, 2643, 2462, 848, -334, -1196, -1807, -1689, 
-	-1395, -1573, -1640, -1023, -560, -620, -330, 78, 73, 161, 498, 549, 391, 352, 314, 23, 
-	-425, -707, -874, -988, -844, -587, -448, -353, -183, -78, -82, 1, 100, 25, -105, -127, 
-	-140, -150, -148, -213, -306, -379, -373, -321, -293, -239, -189, -184, -154, -104, -98, -140, 
-	-144, -98, -102, -113, -85, -60, -57, -70, -94, -132, -112, -68, -49, -73, -111, -120, 
-	-113, -71, -25, -2, -21, -62, -75, -77, -78, -83, -99, -124, -131, -98, -56, -37
-};
-
-static const short ugen_H20e105a1c[] = { 
-	59, -104, 156, -222, 280, -171, 8654, 13246, -8806, -15956, 4775, 9953, 2439, 9695, 5004, -307, 
-	7593, 6788, -4137, -9102, -3543, -5827, -8187, -5226, -3617, -4219, -1915, 1113, 1872, 2412, 2171, 3695, 
-	3017, 720, 451, 282, 318, 1025, 615, -1690, -2297, -1670, -2002, -2960, -3650, -3069, -2011, -670, 
-	98, 930, 1678, 1823, 1245, 700, 1015, 1466, 925, -214, -608, -862, -1172, -1026, -738, -913, 
-	-1156, -1171, -786, -365, 17, 373, 543, 542, 582, 567, 441, 408, 378, 57, -387, -523, 
-	-439, -303, -267, -316, -483, -540, -380, -82, 88, 182, 163, -20, -116, 15, 174, 144, 
-	-46, -319, -393, -263, -67, 44, -19, -255, -364, -210, -14, 38, 13, -131, -261, -136, 
-	113, 187, 106, 0, -218, -297, -161, -5, -10, -55, -133, -211, -128, 33, 92, 18
-};
-
-static const short ugen_H20e110a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 
-	0, 0, -1, 3, 0, 2, -1, 8, -1, 11, 11, 5, 34, 638, 1750, 1146, 
-	-138, -457, -1198, -974, 2167, 4575, 2973, 1525, 2379, 2056, 763, -24, -1029, -1614, -1286, -1245, 
-	-1446, -1019, -551, -558, -408, 42, -90, -274, -20, 19, 17, 180, 288, 245, 89, -142, 
-	-536, -830, -793, -694, -663, -522, -312, -183, -54, 9, 24, 24, -40, -110, -201, -253, 
-	-260, -231, -195, -268, -361, -326, -262, -237, -190, -187, -190, -158, -111, -107, -167, -173, 
-	-139, -121, -112, -110, -99, -84, -81, -110, -130, -107, -64, -49, -76, -92, -100, -107, 
-	-74, -47, -35, -25, -31, -64, -100, -82, -76, -118, -142, -137, -107, -72, -58, -54
-};
-
-static const short ugen_H20e110a1c[] = { 
-	53, -87, 118, -147, 176, -289, 4608, 14136, -1529, -16639, -864, 10881, 2519, 6177, 8334, 140, 
-	5225, 8618, -261, -9248, -4763, -3800, -8489, -6568, -3536, -4080, -3072, 674, 2011, 2238, 1826, 3083, 
-	3169, 1184, 797, 326, 158, 848, 935, -977, -2384, -1944, -2044, -2553, -3050, -3094, -2466, -862, 
-	126, 597, 1230, 1568, 1400, 798, 864, 1332, 1167, 180, -420, -688, -1026, -1100, -835, -857, 
-	-1076, -1152, -867, -466, -109, 243, 454, 474, 506, 616, 500, 410, 409, 202, -242, -473, 
-	-464, -363, -300, -292, -422, -545, -449, -174, 20, 123, 180, 58, -70, -13, 140, 151, 
-	26, -241, -400, -305, -105, 14, 8, -167, -325, -270, -71, 28, 12, -68, -225, -185, 
-	41, 205, 147, 31, -145, -271, -187, -57, -46, -92, -122, -169, -121, 26, 85, 19
-};
-
-static const short ugen_H20e115a0c[] = { 
-	0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 
-	0, 0, 1, 0, 4, -3, 7, 0, 10, 0, 14, 24, 568, 1830, 1240, -341, 
-	-504, -788, -885, 1739, 4217, 2907, 1592, 2318, 2063, 623, -343, -1005, -1621, -1523, -1003, -1051, 
-	-1123, -507, 87, 149, 103, 197, 139, -181, -199, -96, -290, -207, 117, 24, -306, -460, 
-	-604, -744, -664, -475, -437, -430, -231, -3, 102, 133, 102, -10, -144, -229, -292, -341, 
-	-359, -318, -356, -401, -294, -208, -153, -149, -134, -134, -147, -113, -122, -160, -162, -124, 
-	-144, -158, -119, -97, -119, -145, -130, -133, -111, -52, -40, -57, -87, -96, -80, -64, 
-	-45, -41, -53, -50, -50, -68, -89, -107, -117, -132, -140, -115, -78, -65, -74, -87
-};
-
-static const short ugen_H20e115a1c[] = { 
-	0, 4, -23, 44, -88, 72, 1178, 11668, 6567, -13603, -7635, 9348, 4714, 1814, 9810, 3246, 
-	2151, 8677, 4419, -7234, -7198, -2298, -7223, -8336, -4060, -3502, -4146, -504, 2150, 2172, 1481, 2407, 
-	3350, 1575, 1020, 730, -2, 513, 1125, -115, -2181, -2346, -2069, -2322, -2650, -2780, -2661, -1401, 
-	27, 468, 824, 1194, 1417, 995, 742, 1074, 1249, 573, -142, -512, -849, -1089, -918, -828, 
-	-1017, -1095, -937, -557, -259, 101, 349, 423, 428, 561, 562, 394, 376, 309, -52, -397, 
-	-481, -400, -350, -297, -345, -495, -509, -306, -57, 37, 146, 121, -15, -35, 94, 147, 
-	59, -162, -372, -349, -150, -18, 7, -86, -272, -300, -152, 0, 5, -28, -165, -236, 
-	-46, 166, 172, 54, -66, -207, -224, -132, -108, -119, -92, -107, -125, -34, 52, -2
-};
-
-static const short ugen_H20e120a0c[] = { 
-	0, 0, 0, 0, 1, 1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 
-	-1, 1, -1, 3, -4, 1, 5, 8, -4, 13, 11, 522, 1917, 1386, -455, -636, 
-	-615, -800, 1586, 4241, 2983, 1339, 2103, 2170, 547, -378, -969, -2009, -1809, -952, -1144, -1160, 
-	-248, 143, 133, 658, 835, 269, 36, 224, -87, -483, -383, -276, -353, -486, -621, -738, 
-	-702, -552, -430, -347, -300, -228, -107, 80, 265, 250, 76, -80, -180, -297, -394, -400, 
-	-426, -549, -517, -352, -225, -99, -87, -100, -82, -76, -94, -144, -136, -98, -110, -147, 
-	-178, -156, -109, -129, -187, -202, -165, -116, -61, -36, -48, -63, -80, -69, -62, -43, 
-	-35, -52, -61, -74, -78, -88, -107, -129, -140, -127, -107, -85, -76, -78, -101, -148
-};
-
-static const short ugen_H20e120a1c[] = { 
-	-47, 75, -108, 137, -190, 236, -229, 6406, 11723, -5727, -12601, 4011, 7819, -801, 7194, 8311, 
-	811, 6130, 8105, -2420, -8989, -3034, -4427, -9273, -5742, -2858, -4403, -2376, 1784, 2386, 1215, 1672, 
-	3354, 2133, 929, 1303, 275, -2, 1001, 688, -1522, -2591, -2193, -2191, -2512, -2449, -2373, -1939, 
-	-428, 392, 600, 884, 1248, 1137, 733, 832, 1182, 869, 128, -273, -632, -960, -967, -834, 
-	-941, -1024, -938, -636, -387, -79, 264, 401, 388, 462, 545, 407, 315, 346, 132, -274, 
-	-452, -401, -364, -330, -289, -400, -496, -407, -155, -35, 62, 148, 50, -34, 52, 137, 
-	65, -85, -280, -344, -219, -53, 3, -25, -181, -288, -192, -38, 12, -25, -105, -210, 
-	-131, 95, 156, 87, 14, -119, -241, -212, -110, -104, -70, -66, -127, -98, -9, -10
-};
-
-static const short ugen_H20e125a0c[] = { 
-	0, 0, 1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 
-	1, 0, 2, -1, 0, -1, 13, 3, 1, 12, 474, 2001, 1610, -542, -834, -523, 
-	-686, 1541, 4323, 3087, 1292, 2080, 2091, 270, -517, -850, -2028, -2124, -1218, -1103, -1249, -542, 
-	234, 403, 609, 885, 795, 500, 378, 273, -65, -391, -394, -477, -862, -1008, -940, -868, 
-	-671, -410, -282, -235, -140, -36, 47, 212, 325, 214, 9, -93, -187, -345, -399, -527, 
-	-665, -604, -474, -283, -169, -103, -58, -41, -36, -78, -86, -78, -47, -65, -123, -190, 
-	-179, -123, -152, -200, -237, -213, -145, -81, -44, -47, -57, -53, -53, -47, -33, -34, 
-	-44, -63, -77, -93, -110, -129, -131, -130, -128, -97, -73, -68, -84, -111, -154, -173
-};
-
-static const short ugen_H20e125a1c[] = { 
-	-21, 15, -18, 4, 3, -35, -1, 1568, 10763, 4292, -11782, -3939, 8363, 721, 1256, 11324, 
-	3834, 2195, 8718, 3650, -7451, -5959, -2159, -7875, -8082, -3221, -3616, -4065, 325, 2620, 1185, 997, 
-	2900, 2840, 948, 1317, 1162, -201, 399, 1100, -516, -2399, -2377, -2116, -2500, -2427, -1920, -1966, 
-	-1164, 103, 473, 683, 1034, 1133, 757, 664, 1007, 1022, 360, -93, -347, -735, -943, -887, 
-	-862, -940, -917, -698, -478, -257, 107, 375, 379, 366, 466, 375, 252, 289, 245, -121, 
-	-378, -375, -348, -343, -296, -323, -433, -426, -263, -135, -49, 103, 97, -18, -2, 96, 
-	62, -41, -176, -286, -265, -135, -31, -13, -92, -215, -200, -73, -18, -46, -84, -151, 
-	-161, -24, 99, 84, 41, -55, -192, -230, -136, -79, -91, -81, -122, -159, -104, -27
-};
-
-static const short ugen_H20e130a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 3, 
-	0, 2, -2, 0, 0, 5, 10, 3, 9, 430, 2081, 1852, -580, -1035, -541, -635, 
-	1586, 4530, 3230, 1223, 2083, 2160, 202, -828, -1081, -2060, -2311, -1393, -1087, -1318, -700, 163, 
-	283, 607, 1101, 833, 460, 686, 775, 240, -99, -50, -360, -959, -1257, -1312, -1181, -882, 
-	-554, -371, -261, -107, 40, 162, 253, 309, 205, 53, -3, -85, -204, -350, -574, -672, 
-	-655, -530, -347, -274, -209, -104, -39, -66, -72, 1, 52, 5, -33, -98, -181, -160, 
-	-145, -193, -238, -237, -222, -187, -113, -50, -56, -79, -52, -39, -43, -26, -4, -23, 
-	-60, -88, -111, -131, -132, -142, -158, -131, -88, -57, -48, -72, -123, -168, -168, -114
-};
-
-static const short ugen_H20e130a1c[] = { 
-	24, -51, 64, -89, 110, -151, 187, -181, 5179, 10310, -3816, -9820, 3574, 4763, -2855, 7846, 
-	10132, 814, 5516, 8007, -1942, -7994, -2929, -4519, -9115, -5278, -2699, -4467, -2026, 2200, 1501, 484, 
-	2156, 3112, 1655, 861, 1681, 571, -203, 762, 461, -1592, -2474, -2112, -2360, -2622, -1934, -1486, 
-	-1522, -553, 294, 542, 851, 1072, 830, 547, 770, 1000, 595, 63, -130, -443, -807, -893, 
-	-798, -846, -874, -733, -508, -373, -100, 256, 401, 329, 371, 356, 172, 173, 257, 43, 
-	-271, -311, -303, -336, -295, -255, -352, -404, -314, -206, -162, -18, 100, 29, -40, 28, 
-	56, -22, -89, -182, -246, -203, -108, -45, -14, -70, -146, -116, -59, -70, -72, -88, 
-	-149, -132, 3, 62, 19, 2, -79, -178, -164, -107, -122, -119, -119, -173, -158, -35
-};
-
-static const short ugen_H20e135a0c[] = { 
-	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 
-	3, -1, 0, 0, 3, 9, 5, 13, 382, 2170, 2109, -584, -1246, -570, -607, 1566, 
-	4780, 3483, 1214, 2083, 2240, 110, -1042, -1103, -2211, -2773, -1658, -1033, -1286, -728, 155, 267, 
-	484, 959, 955, 559, 534, 746, 606, 363, 212, -26, -602, -1187, -1487, -1449, -1153, -800, 
-	-571, -416, -193, -6, 200, 409, 432, 204, -3, -25, -15, -96, -354, -511, -576, -621, 
-	-500, -411, -344, -270, -190, -171, -174, -58, 101, 124, 74, 49, -70, -163, -175, -148, 
-	-182, -271, -265, -224, -200, -133, -55, -57, -82, -78, -77, -54, -2, 18, -11, -45, 
-	-76, -121, -146, -142, -151, -167, -158, -108, -52, -26, -49, -115, -166, -165, -112, -54
-};
-
-static const short ugen_H20e135a1c[] = { 
-	4, -2, -12, 21, -42, 64, -105, 112, 615, 8124, 6205, -7860, -4349, 5429, -849, -53, 
-	12400, 5903, 1099, 7825, 4659, -5430, -6024, -2495, -7089, -7849, -3334, -3471, -3944, 388, 1986, 231, 
-	1357, 2814, 2459, 1059, 1232, 1478, 131, 16, 672, -366, -2151, -2177, -2146, -2642, -2360, -1395, 
-	-1223, -1051, -138, 370, 670, 998, 956, 526, 526, 791, 679, 267, 32, -206, -589, -822, 
-	-743, -747, -818, -719, -521, -392, -280, 31, 336, 376, 292, 310, 171, 56, 132, 131, 
-	-117, -278, -250, -292, -306, -219, -238, -351, -338, -231, -214, -164, -3, 68, -14, -52, 
-	6, -15, -45, -91, -182, -228, -184, -94, 0, 43, -37, -117, -95, -82, -95, -70, 
-	-102, -177, -122, 13, 26, 13, 10, -89, -183, -174, -159, -176, -141, -111, -120, -58
-};
-
-static const short ugen_H20e140a0c[] = { 
-	0, 0, 0, 0, -1, -1, -2, -1, 0, -1, -3, -1, -3, 0, -1, 0, 
-	-3, -4, -1, -5, 11, 0, 20, 335, 2239, 2417, -584, -1489, -623, -577, 1583, 5013, 
-	3731, 1211, 2177, 2373, 15, -1321, -1246, -2158, -2981, -2110, -1365, -1278, -664, 175, 454, 500, 
-	807, 927, 540, 421, 668, 549, 397, 506, 360, -283, -904, -1249, -1413, -1307, -982, -782, 
-	-683, -416, -101, 150, 369, 497, 372, 59, -87, -55, -188, -349, -408, -523, -501, -419, 
-	-409, -355, -279, -263, -333, -297, -56, 122, 141, 116, 66, 6, -117, -191, -166, -208, 
-	-257, -265, -260, -223, -134, -65, -58, -69, -101, -115, -96, -28, 33, 9, -52, -96, 
-	-117, -131, -138, -162, -187, -176, -132, -65, -29, -51, -107, -148, -144, -118, -74, -56
-};
-
-static const short ugen_H20e140a1c[] = { 
-	-12, 25, -37, 31, -39, 38, -47, 41, -83, 2288, 9044, 1453, -7649, 0, 2860, -3340, 
-	5606, 12519, 2290, 3250, 7771, 1002, -6307, -4179, -3797, -7966, -5732, -2889, -4027, -2246, 1448, 562, 
-	377, 2269, 2630, 1862, 957, 1440, 1036, 6, 143, 422, -1138, -2128, -1865, -2438, -2693, -1907, 
-	-1027, -1059, -636, 105, 443, 791, 1061, 705, 328, 524, 605, 378, 151, 23, -277, -683, 
-	-753, -600, -681, -718, -541, -381, -353, -227, 108, 343, 285, 222, 196, 39, 13, 87, 
-	-10, -180, -217, -209, -277, -262, -172, -217, -302, -281, -242, -233, -136, -3, -1, -70, 
-	-61, -39, -54, -41, -82, -184, -214, -136, -28, 69, 61, -41, -100, -101, -115, -113, 
-	-74, -137, -181, -88, 15, 26, 20, -29, -166, -225, -215, -197, -135, -58, -47, -64
-};
-
-static const short ugen_H20e145a0c[] = { 
-	2, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 1, 0, 1, 0, 
-	-2, 1, -6, 12, 0, 29, 301, 2338, 2723, -580, -1728, -685, -564, 1636, 5332, 3985, 
-	1153, 2255, 2595, -45, -1594, -1431, -2211, -3085, -2362, -1589, -1490, -842, 240, 652, 673, 878, 
-	894, 555, 344, 462, 419, 356, 478, 415, -38, -559, -966, -1183, -1079, -896, -851, -868, 
-	-680, -279, 59, 306, 429, 349, 168, 65, -127, -346, -339, -379, -432, -438, -392, -306, 
-	-263, -255, -346, -374, -243, -86, 34, 131, 125, 75, 6, -93, -128, -145, -197, -246, 
-	-274, -271, -223, -133, -45, -30, -83, -110, -114, -92, -38, 10, 1, -53, -99, -126, 
-	-116, -110, -138, -172, -173, -128, -67, -26, -62, -109, -120, -120, -110, -73, -33, -60
-};
-
-static const short ugen_H20e145a1c[] = { 
-	9, -13, 26, -42, 49, -66, 85, -114, 141, -96, 4089, 8107, -1690, -5476, 1211, -396, 
-	-1948, 10009, 9916, 950, 5031, 6186, -1391, -5891, -3515, -5163, -7308, -4277, -3182, -3595, -706, 892, 
-	-116, 1273, 2438, 2321, 1496, 1040, 1356, 687, -40, 213, 0, -1523, -1769, -1936, -2609, -2507, 
-	-1528, -806, -874, -332, 321, 600, 814, 956, 583, 230, 309, 377, 254, 95, 13, -354, 
-	-698, -608, -485, -606, -564, -388, -344, -352, -178, 151, 271, 199, 173, 108, -20, -12, 
-	17, -80, -165, -172, -225, -276, -194, -124, -181, -239, -259, -262, -226, -111, -25, -68, 
-	-109, -92, -82, -42, 1, -72, -199, -190, -59, 61, 109, 29, -71, -96, -96, -129, 
-	-116, -77, -139, -149, -63, 7, -6, -33, -102, -220, -238, -183, -123, -58, -13, -32
-};
-
-static const short ugen_H20e150a0c[] = { 
-	0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 1, 0, -3, 
-	4, -10, 15, -8, 38, 259, 2435, 3082, -602, -2018, -721, -560, 1674, 5688, 4286, 1069, 
-	2306, 2839, -122, -1848, -1610, -2288, -3207, -2584, -1809, -1635, -914, 95, 634, 895, 1061, 922, 
-	644, 402, 309, 240, 205, 352, 361, -83, -540, -759, -892, -828, -653, -607, -790, -808, 
-	-449, -82, 179, 337, 301, 131, -58, -160, -195, -362, -453, -395, -422, -407, -257, -168, 
-	-258, -342, -263, -178, -114, 41, 95, 40, 24, -27, -106, -137, -105, -135, -223, -279, 
-	-276, -237, -141, -22, -13, -75, -123, -122, -92, -24, 17, -26, -96, -136, -138, -119, 
-	-99, -110, -156, -173, -121, -39, -16, -69, -121, -132, -118, -99, -68, -40, -36, -66
-};
-
-static const short ugen_H20e150a1c[] = { 
-	2, 3, 0, 8, -23, 34, -51, 73, -107, 132, 182, 5399, 6398, -2909, -3762, 398, 
-	-1977, 1082, 11854, 7079, 1086, 5603, 4497, -2627, -5348, -3591, -5753, -6209, -3685, -3279, -2645, -305, 
-	123, 225, 1748, 2346, 2104, 1252, 1101, 1153, 376, 9, 167, -446, -1352, -1656, -2175, -2517, 
-	-2219, -1298, -751, -590, -32, 466, 661, 763, 886, 572, 57, -54, 238, 275, 76, -90, 
-	-402, -564, -482, -466, -507, -426, -345, -351, -377, -147, 176, 215, 118, 133, 84, -54, 
-	-78, -31, -78, -166, -201, -245, -244, -139, -81, -142, -212, -266, -275, -218, -97, -41, 
-	-114, -165, -121, -62, -8, -4, -103, -175, -121, -6, 79, 87, 4, -74, -91, -101, 
-	-138, -99, -65, -124, -143, -97, -68, -62, -53, -129, -208, -189, -138, -93, -33, -11
-};
-
-static const short ugen_H20e155a0c[] = { 
-	0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 1, -7, 7, 
-	-11, 16, -16, 48, 207, 2516, 3506, -586, -2391, -774, -521, 1678, 6076, 4637, 990, 2326, 
-	3135, -161, -2208, -1781, -2372, -3312, -2732, -2042, -1839, -977, 95, 617, 898, 1198, 1068, 696, 
-	510, 359, 124, 45, 242, 211, -258, -657, -786, -840, -672, -374, -346, -539, -569, -384, 
-	-192, 36, 261, 266, -39, -255, -191, -239, -287, -312, -465, -553, -384, -202, -225, -272, 
-	-159, -107, -199, -92, 102, 121, 1, -80, -100, -163, -173, -92, -113, -203, -233, -263, 
-	-245, -131, -17, -14, -78, -115, -120, -88, -24, 15, -31, -109, -176, -196, -142, -84, 
-	-89, -146, -166, -107, -24, 9, -39, -119, -149, -126, -90, -56, -43, -46, -56, -58
-};
-
-static const short ugen_H20e155a1c[] = { 
-	-2, 6, -4, 8, -10, 0, 3, -16, 26, -52, 52, 660, 6004, 4923, -3102, -3275, 
-	-597, -1896, 3769, 11909, 5104, 1455, 5417, 3324, -3267, -4976, -3794, -5650, -5355, -3498, -2909, -2080, 
-	-573, 1, 616, 1887, 2302, 1846, 1125, 1066, 890, 211, 102, -61, -559, -1099, -1772, -2333, 
-	-2359, -1831, -1172, -752, -286, 220, 482, 596, 820, 882, 431, -158, -218, 115, 233, 147, 
-	-172, -458, -462, -375, -456, -464, -365, -348, -385, -359, -78, 162, 171, 96, 131, 54, 
-	-133, -131, -52, -86, -183, -236, -246, -198, -85, -67, -137, -229, -270, -257, -203, -84, 
-	-49, -112, -172, -156, -86, -6, -13, -111, -144, -85, -3, 66, 85, 13, -74, -106, 
-	-126, -124, -44, -49, -159, -210, -154, -87, -53, -45, -114, -165, -164, -145, -103, -43
-};
-
-static const short ugen_H20e160a0c[] = { 
-	-2, -1, 0, -1, 0, 0, -2, -1, -1, 0, 1, -1, 0, -10, 9, -18, 
-	21, -29, 56, 157, 2555, 3978, -502, -2822, -869, -492, 1659, 6508, 5048, 896, 2317, 3440, 
-	-130, -2571, -2034, -2484, -3439, -2825, -2173, -2104, -1116, 115, 661, 900, 1289, 1212, 682, 612, 
-	469, 61, -11, 210, 89, -453, -874, -971, -889, -685, -365, -206, -208, -234, -184, -44, 
-	121, 235, 45, -234, -242, -260, -388, -337, -298, -441, -541, -466, -343, -243, -74, -35, 
-	-146, -142, 7, 132, 101, 1, -66, -161, -269, -208, -112, -158, -208, -214, -223, -213, 
-	-129, -23, -9, -65, -117, -137, -97, -11, 15, -49, -127, -193, -234, -173, -82, -89, 
-	-166, -177, -91, 1, 39, -28, -122, -141, -103, -81, -72, -49, -55, -71, -59, -43
-};
-
-static const short ugen_H20e160a1c[] = { 
-	0, -2, 9, -6, 14, -20, 14, -16, 13, -13, 7, -18, 1159, 6153, 3974, -3272, 
-	-3434, -926, -1164, 5554, 11297, 3839, 1573, 5107, 2575, -3682, -4732, -3781, -5265, -4906, -3222, -2446, 
-	-2086, -690, 151, 805, 2036, 2169, 1644, 997, 931, 749, 202, -47, -112, -442, -1118, -1799, 
-	-2452, -2158, -1411, -1025, -760, -92, 417, 390, 573, 929, 792, 198, -183, -195, -22, 184, 
-	150, -202, -490, -473, -379, -409, -435, -396, -332, -357, -285, -37, 189, 200, 98, 86, 
-	-37, -176, -155, -78, -93, -179, -234, -259, -177, -57, -59, -150, -256, -255, -208, -146, 
-	-64, -33, -88, -181, -184, -120, -40, -47, -100, -95, -52, -6, 43, 80, 27, -64, 
-	-135, -145, -75, -10, -78, -214, -234, -145, -73, -26, -15, -82, -162, -186, -171, -128
-};
-
-static const short ugen_H20e165a0c[] = { 
-	-2, 0, 0, 0, 0, -1, -3, 0, 0, 3, -1, 4, -14, 14, -20, 26, 
-	-34, 61, 106, 2533, 4490, -278, -3305, -1019, -446, 1544, 6941, 5586, 810, 2257, 3763, -20, 
-	-2916, -2308, -2615, -3617, -2937, -2218, -2297, -1324, 68, 757, 962, 1231, 1419, 829, 543, 578, 
-	98, -130, 205, 185, -589, -1142, -1141, -1059, -837, -419, -209, -145, 34, 129, 171, 382, 
-	328, -55, -236, -281, -351, -445, -423, -392, -505, -582, -545, -407, -136, 43, -52, -117, 
-	-58, 49, 146, 117, 19, -67, -151, -245, -288, -196, -152, -224, -236, -227, -194, -90, 
-	16, 16, -76, -130, -120, -90, -28, 16, -48, -144, -205, -220, -174, -103, -92, -156, 
-	-190, -123, 1, 83, 31, -94, -144, -103, -60, -41, -41, -77, -97, -63, -21, -49
-};
-
-static const short ugen_H20e165a1c[] = { 
-	-7, 2, -3, 8, -6, 14, -22, 18, -26, 24, -34, 37, -49, 1562, 6133, 3306, 
-	-3717, -3502, -732, -466, 6654, 10540, 2849, 1522, 4954, 1998, -4015, -4425, -3544, -4985, -4622, -2730, 
-	-2315, -2249, -530, 210, 1025, 2094, 1972, 1486, 790, 848, 795, 75, -263, 62, -379, -1244, 
-	-1896, -2299, -1893, -1288, -790, -562, -62, 381, 366, 586, 943, 666, 45, -103, -29, -60, 
-	-42, 21, -174, -549, -621, -449, -388, -386, -340, -313, -298, -185, 58, 216, 173, 94, 
-	9, -139, -224, -137, -62, -120, -199, -259, -279, -196, -53, -45, -159, -221, -209, -185, 
-	-124, -22, 0, -105, -193, -211, -170, -98, -54, -59, -92, -73, -16, 54, 76, 7, 
-	-80, -142, -136, -83, -23, -73, -205, -226, -143, -46, 7, -6, -105, -211, -233, -206
-};
-
-static const short ugen_H20e170a0c[] = { 
-	0, 0, 0, 0, -2, -2, 0, 0, 4, -3, 6, -17, 13, -22, 29, -39, 
-	60, 65, 2463, 4995, 81, -3814, -1266, -384, 1359, 7349, 6256, 759, 2144, 4078, 116, -3226, 
-	-2617, -2775, -3794, -3101, -2258, -2432, -1523, -22, 792, 1155, 1208, 1367, 1083, 638, 594, 143, 
-	-264, 140, 274, -540, -1292, -1426, -1230, -967, -611, -277, -89, 65, 197, 460, 562, 393, 
-	240, -49, -347, -403, -459, -531, -470, -576, -780, -698, -267, 9, -45, -65, -33, -38, 
-	19, 146, 169, 36, -60, -116, -247, -308, -209, -194, -265, -251, -243, -224, -97, 57, 
-	58, -67, -130, -136, -111, -32, 4, -51, -153, -212, -222, -167, -97, -100, -166, -204, 
-	-135, -19, 59, 52, -29, -103, -113, -76, -29, -14, -68, -136, -124, -49, -22, -67
-};
-
-static const short ugen_H20e170a1c[] = { 
-	0, -5, 0, -1, 6, -5, 11, -19, 14, -28, 29, -39, 46, -37, 1847, 6082, 
-	2664, -4234, -3209, -427, 35, 7358, 9697, 2006, 1546, 4897, 1428, -4175, -3962, -3317, -4867, -4192, 
-	-2328, -2511, -2182, -381, 268, 1267, 1991, 1843, 1258, 601, 968, 790, -186, -265, 152, -365, 
-	-1300, -1991, -1964, -1721, -1273, -506, -247, -117, 173, 405, 633, 838, 596, 142, -38, 42, 
-	0, -250, -253, -304, -610, -729, -564, -346, -247, -234, -213, -210, -120, 118, 250, 125, 
-	26, -22, -183, -231, -117, -58, -162, -257, -297, -312, -192, -28, 9, -92, -181, -205, 
-	-180, -81, 20, 2, -133, -212, -212, -177, -104, -75, -91, -106, -80, -10, 80, 92, 
-	-19, -132, -163, -116, -43, 4, -68, -182, -190, -116, -32, 2, -44, -167, -245, -236
-};
-
-static const short ugen_H20e175a0c[] = { 
-	-2, 0, 0, -2, -4, 0, 0, 5, -4, 6, -17, 13, -24, 29, -41, 59, 
-	31, 2366, 5427, 569, -4245, -1602, -313, 1117, 7660, 7002, 798, 1978, 4383, 291, -3546, -2869, 
-	-2973, -4013, -3220, -2300, -2534, -1697, -155, 738, 1339, 1396, 1233, 1081, 885, 688, 211, -312, 
-	-58, 320, -393, -1381, -1622, -1457, -1157, -673, -358, -197, 62, 322, 361, 493, 727, 522, 
-	79, -152, -299, -514, -521, -501, -768, -955, -628, -204, -128, -52, 16, -17, -89, -32, 
-	157, 176, 74, 5, -96, -267, -305, -183, -170, -272, -319, -296, -226, -79, 66, 40, 
-	-70, -112, -118, -116, -71, -23, -50, -126, -203, -233, -184, -89, -73, -157, -210, -152, 
-	-23, 72, 55, -43, -115, -100, -39, 0, -7, -73, -156, -163, -83, -34, -52, -121
-};
-
-static const short ugen_H20e175a1c[] = { 
-	0, 0, -4, 1, 0, 6, -4, 10, -19, 14, -25, 30, -38, 51, -12, 2065, 
-	5982, 1933, -4544, -2654, -271, 445, 7755, 8757, 1392, 1676, 4770, 918, -4079, -3497, -3243, -4646, 
-	-3691, -2261, -2637, -1979, -334, 420, 1392, 1864, 1672, 951, 664, 1130, 544, -325, -211, 161, 
-	-308, -1329, -1938, -1794, -1541, -1068, -400, -114, -44, 43, 350, 667, 779, 619, 264, -25, 
-	-10, -30, -349, -540, -630, -723, -685, -504, -312, -168, -67, -62, -140, -115, 105, 243, 
-	116, 9, -44, -188, -254, -138, -76, -212, -324, -336, -298, -138, 35, 32, -73, -149, 
-	-172, -156, -74, 25, -11, -124, -214, -230, -174, -102, -70, -128, -147, -92, 14, 109, 
-	60, -68, -163, -139, -63, 9, 24, -75, -148, -158, -104, -64, -42, -70, -177, -235
-};
-
-static const short ugen_H20e180a0c[] = { 
-	0, 0, -3, -4, 1, -2, 5, -6, 7, -19, 14, -25, 27, -41, 53, 8, 
-	2233, 5764, 1202, -4527, -2080, -257, 808, 7825, 7841, 1016, 1809, 4591, 567, -3839, -3166, -3139, 
-	-4304, -3400, -2292, -2611, -1835, -270, 596, 1420, 1686, 1376, 869, 927, 982, 263, -299, -165, 
-	206, -293, -1347, -1818, -1661, -1334, -816, -393, -179, 54, 156, 288, 622, 784, 594, 268, 
-	-22, -160, -278, -425, -623, -882, -821, -570, -401, -256, -80, 53, 0, -138, -96, 115, 
-	216, 128, 22, -91, -222, -271, -183, -125, -243, -340, -344, -265, -79, 52, 48, -70, 
-	-141, -131, -124, -65, -14, -38, -126, -197, -234, -196, -87, -65, -134, -196, -132, 9, 
-	89, 40, -71, -134, -113, -44, 23, 31, -60, -164, -182, -109, -45, -43, -98, -186
-};
-
-static const short ugen_H20e180a1c[] = { 
-	0, 0, -3, -4, 1, -2, 5, -6, 7, -19, 14, -25, 27, -41, 53, 8, 
-	2233, 5764, 1202, -4527, -2080, -257, 808, 7825, 7841, 1016, 1809, 4591, 567, -3839, -3166, -3139, 
-	-4304, -3400, -2292, -2611, -1835, -270, 596, 1420, 1686, 1376, 869, 927, 982, 263, -299, -165, 
-	206, -293, -1347, -1818, -1661, -1334, -816, -393, -179, 54, 156, 288, 622, 784, 594, 268, 
-	-22, -160, -278, -425, -623, -882, -821, -570, -401, -256, -80, 53, 0, -138, -96, 115, 
-	216, 128, 22, -91, -222, -271, -183, -125, -243, -340, -344, -265, -79, 52, 48, -70, 
-	-141, -131, -124, -65, -14, -38, -126, -197, -234, -196, -87, -65, -134, -196, -132, 9, 
-	89, 40, -71, -134, -113, -44, 23, 31, -60, -164, -182, -109, -45, -43, -98, -186
-};
-
-static const short ugen_H30e000a0c[] = { 
-	4, 5, -6, 19, -38, 54, -85, 126, -162, 206, 92, 5124, 5682, -324, -3556, -7832, 
-	1642, 5326, 6139, 12243, 5367, -2341, 1541, 1863, -6290, -7850, -6562, -4756, -3264, -2424, -782, -731, 
-	1417, 2825, 1585, 2087, 2400, 1555, 1073, 483, -602, -32, -309, -475, -274, -1015, -1579, -1680, 
-	-1243, -799, -211, -102, 23, 682, 1267, 1232, 1058, 906, 36, -1097, -1611, -1561, -1191, -1251, 
-	-1444, -1204, -573, 31, 173, 119, 111, 196, 119, 186, 364, 399, 167, -140, -317, -401, 
-	-498, -482, -341, -298, -344, -311, -156, 46, 211, 175, -1, -146, -139, -81, 1, 58, 
-	-22, -242, -340, -248, -150, -93, -138, -234, -256, -137, 28, 145, 112, -43, -163, -172, 
-	-121, -65, -63, -137, -202, -179, -98, 18, 90, 46, -48, -101, -61, 2, 32, -8
-};
-
-static const short ugen_H30e000a1c[] = { 
-	4, 5, -6, 19, -38, 54, -85, 126, -162, 206, 92, 5124, 5682, -324, -3556, -7832, 
-	1642, 5326, 6139, 12243, 5367, -2341, 1541, 1863, -6290, -7850, -6562, -4756, -3264, -2424, -782, -731, 
-	1417, 2825, 1585, 2087, 2400, 1555, 1073, 483, -602, -32, -309, -475, -274, -1015, -1579, -1680, 
-	-1243, -799, -211, -102, 23, 682, 1267, 1232, 1058, 906, 36, -1097, -1611, -1561, -1191, -1251, 
-	-1444, -1204, -573, 31, 173, 119, 111, 196, 119, 186, 364, 399, 167, -140, -317, -401, 
-	-498, -482, -341, -298, -344, -311, -156, 46, 211, 175, -1, -146, -139, -81, 1, 58, 
-	-22, -242, -340, -248, -150, -93, -138, -234, -256, -137, 28, 145, 112, -43, -163, -172, 
-	-121, -65, -63, -137, -202, -179, -98, 18, 90, 46, -48, -101, -61, 2, 32, -8
-};
-
-static const short ugen_H30e006a0c[] = { 
-	-2, 14, -4, 15, -7, 3, 6, -14, 50, -58, 92, 774, 5640, 3563, -725, -4459, 
-	-5477, 3074, 3839, 7761, 10371, 2663, -1022, 2483, 30, -5908, -6851, -6341, -3683, -2835, -2403, -876, 
-	-190, 1626, 2069, 1732, 2115, 1955, 1460, 985, -116, -327, 324, -367, -203, -322, -1121, -1615, 
-	-1548, -1076, -513, -124, -84, 527, 1122, 801, 690, 882, 397, -448, -1154, -1372, -1176, -938, 
-	-1065, -1144, -1017, -470, 1, -49, -49, 94, 153, 44, 134, 317, 342, 119, -146, -342, 
-	-437, -435, -368, -278, -238, -243, -165, -59, 69, 153, 75, -68, -147, -102, -60, -9, 
-	31, -39, -203, -265, -228, -134, -76, -124, -217, -209, -99, 29, 125, 73, -42, -132, 
-	-142, -92, -47, -72, -159, -210, -177, -64, 62, 88, 18, -52, -69, -34, 23, 47
-};
-
-static const short ugen_H30e006a1c[] = { 
-	16, -20, 35, -62, 79, -115, 153, -193, 240, -89, 4962, 7196, -50, -3756, -9275, 472, 
-	6607, 6569, 13170, 6855, -2865, 204, 2694, -6365, -9255, -7054, -4540, -3531, -3038, -280, -576, 759, 
-	3238, 2050, 1858, 2438, 1883, 1063, 728, -396, -296, -414, -521, -311, -1203, -1709, -1611, -1094, 
-	-873, -272, 47, -518, -104, 1479, 1708, 1243, 1190, 327, -863, -1533, -1799, -1610, -1548, -1382, 
-	-1022, -709, -114, 375, 327, 115, 220, 131, 187, 374, 472, 237, -138, -311, -425, -502, 
-	-450, -326, -349, -435, -389, -204, 21, 226, 276, 104, -174, -199, -91, 14, 63, -18, 
-	-257, -395, -284, -169, -102, -121, -231, -276, -149, 75, 217, 144, -44, -195, -206, -163, 
-	-55, -10, -108, -200, -205, -103, 20, 102, 52, -47, -99, -80, 3, 41, -3, -70
-};
-
-static const short ugen_H30e012a0c[] = { 
-	0, -3, 12, -5, 14, -11, 5, -4, -2, 20, -23, 38, 825, 4903, 3139, -520, 
-	-3878, -4486, 2051, 3646, 7298, 8870, 2937, -260, 2209, 175, -4912, -6570, -5741, -3169, -2970, -2455, 
-	-753, -202, 1177, 1930, 1667, 1806, 1832, 1499, 746, -199, 104, 401, -393, -212, -320, -1056, 
-	-1498, -1369, -878, -252, -159, -262, 543, 1110, 520, 178, 531, 307, -547, -1064, -1076, -980, 
-	-847, -795, -781, -909, -652, -196, -82, -153, -54, 48, -38, 48, 207, 245, 63, -143, 
-	-306, -401, -394, -287, -178, -164, -167, -103, -55, 13, 88, 26, -108, -168, -144, -101, 
-	-32, 4, -46, -175, -239, -232, -165, -89, -101, -173, -195, -113, 24, 104, 46, -62, 
-	-145, -164, -112, -53, -81, -163, -197, -154, -75, 17, 52, -4, -73, -84, -32, 29
-};
-
-static const short ugen_H30e012a1c[] = { 
-	-20, 45, -75, 84, -115, 145, -173, 203, -168, 4243, 8730, 1049, -4021, -10398, -1259, 7247, 
-	6786, 14634, 8372, -2968, -697, 2576, -6046, -9910, -8280, -5140, -2525, -3473, -1014, 188, 707, 2746, 
-	2244, 2282, 2253, 1874, 1311, 965, -152, -325, -519, -644, -204, -1353, -1941, -1790, -1039, -616, 
-	-238, -247, -786, -248, 1107, 1814, 1624, 1156, 538, -429, -1359, -2118, -2069, -1613, -1130, -919, 
-	-869, -125, 419, 498, 205, 190, 156, 152, 284, 458, 393, -80, -411, -480, -470, -420, 
-	-328, -356, -465, -426, -228, -3, 269, 354, 161, -160, -231, -129, -10, 45, -18, -262, 
-	-446, -386, -237, -104, -102, -207, -274, -119, 101, 245, 192, -17, -214, -283, -191, -28, 
-	39, -64, -209, -256, -165, 26, 132, 57, -58, -114, -85, -6, 51, 14, -55, -141
-};
-
-static const short ugen_H30e018a0c[] = { 
-	-2, 0, -3, 9, -3, 9, -9, 2, -3, -4, 17, -14, 15, 740, 4164, 2944, 
-	-216, -3248, -4130, 1446, 3493, 6362, 7951, 3176, 174, 2162, 484, -4285, -5875, -4924, -3122, -3013, 
-	-2271, -794, -427, 896, 1701, 1455, 1629, 1765, 1481, 654, 24, 298, 210, -358, -51, -291, 
-	-933, -1139, -1051, -712, -381, -487, -326, 513, 676, 149, 118, 360, 216, -433, -927, -879, 
-	-731, -633, -665, -634, -747, -693, -398, -187, -158, -186, -163, -113, 17, 56, 79, 68, 
-	-67, -236, -284, -282, -208, -79, -58, -124, -129, -84, -13, 26, -14, -111, -193, -203, 
-	-129, -27, 0, -77, -177, -222, -204, -131, -74, -91, -143, -138, -88, 3, 66, 18, 
-	-97, -176, -160, -114, -71, -64, -106, -152, -154, -110, -35, 4, -21, -66, -68, -20
-};
-
-static const short ugen_H30e018a1c[] = { 
-	37, -65, 71, -90, 107, -103, 114, -131, 3003, 9677, 3451, -3921, -11352, -3739, 7248, 6867, 
-	14939, 11457, -2128, -2213, 2833, -5682, -10420, -8953, -6824, -2485, -2320, -1673, -318, 1078, 3047, 1828, 
-	2081, 2740, 1837, 1172, 1306, 235, -310, -494, -755, -76, -1314, -2204, -1936, -1085, -586, -333, 
-	-607, -583, -127, 534, 1826, 1802, 1034, 560, -14, -1063, -2531, -2529, -1161, -653, -1087, -1081, 
-	-187, 575, 652, 177, 172, 165, 136, 282, 373, 388, 53, -416, -571, -459, -429, -338, 
-	-327, -391, -419, -291, -9, 331, 409, 231, -114, -279, -186, -30, 66, -26, -268, -488, 
-	-474, -326, -134, -89, -171, -227, -142, 74, 306, 305, 23, -253, -308, -181, 0, 81, 
-	-45, -224, -285, -205, -12, 142, 97, -45, -144, -116, -17, 77, 59, -19, -122, -202
-};
-
-static const short ugen_H30e024a0c[] = { 
-	0, -2, -1, -1, 7, -2, 6, -5, 0, 1, -8, 24, -22, 19, 572, 3474, 
-	2859, 181, -2817, -3912, 1139, 3027, 5530, 7313, 3249, 579, 2221, 658, -3641, -4863, -4369, -3229, 
-	-2821, -2092, -997, -632, 668, 1409, 1305, 1530, 1764, 1537, 529, 51, 339, 218, -173, 30, 
-	-103, -547, -869, -1066, -874, -582, -700, -446, 260, 276, 36, 214, 282, 178, -234, -761, 
-	-721, -527, -526, -599, -587, -643, -636, -514, -324, -219, -268, -334, -250, -60, -20, 31, 
-	78, 8, -112, -156, -174, -125, -39, -47, -99, -146, -150, -66, 0, -33, -132, -216, 
-	-219, -135, -59, -47, -83, -160, -194, -156, -79, -54, -81, -113, -122, -89, -28, 6, 
-	-23, -96, -149, -156, -128, -70, -46, -88, -140, -155, -126, -65, -23, -24, -49, -62
-};
-
-static const short ugen_H30e024a1c[] = { 
-	-38, 33, -50, 35, -9, -12, 7, 1571, 9453, 6532, -2450, -12224, -6634, 6352, 6700, 14881, 
-	13450, 691, -2576, 1657, -4327, -10415, -9974, -8387, -3336, -2046, -1424, -58, 274, 2991, 2755, 1713, 
-	2100, 2335, 1417, 974, 716, -29, -444, -924, 124, -1104, -2395, -2153, -1079, -547, -1230, -618, 
-	136, -300, 211, 1681, 1743, 1063, 654, 7, -1208, -2568, -2411, -833, -430, -1041, -1205, -302, 
-	534, 680, 277, 125, 164, 172, 253, 311, 390, 98, -397, -625, -545, -445, -328, -287, 
-	-300, -383, -297, -53, 317, 461, 333, -59, -331, -241, -66, 57, -9, -246, -536, -565, 
-	-408, -176, -49, -132, -271, -222, 31, 329, 388, 113, -203, -288, -176, -6, 80, -31, 
-	-228, -322, -253, -55, 133, 110, -22, -148, -163, -50, 84, 104, 15, -100, -198, -166
-};
-
-static const short ugen_H30e030a0c[] = { 
-	0, 0, -1, -1, 0, 4, -1, 3, -3, -1, 3, -13, 28, -30, 25, 378, 
-	2827, 2825, 553, -2440, -3659, 755, 2511, 4848, 6675, 3334, 979, 2171, 823, -2828, -3929, -4000, 
-	-3228, -2571, -2013, -1231, -751, 408, 1175, 1283, 1485, 1712, 1261, 395, 340, 398, 254, 140, 
-	289, 19, -511, -922, -1184, -975, -866, -997, -501, 188, 79, -52, 264, 398, 254, -179, 
-	-605, -581, -432, -473, -591, -571, -552, -581, -573, -470, -359, -351, -391, -306, -136, -11, 
-	67, 97, 77, -13, -96, -106, -53, -38, -79, -120, -155, -179, -126, -53, -75, -125, 
-	-192, -220, -187, -108, -41, -56, -118, -157, -113, -61, -38, -67, -129, -151, -118, -43, 
-	-7, -32, -81, -130, -153, -141, -82, -55, -84, -120, -134, -115, -74, -37, -42, -60
-};
-
-static const short ugen_H30e030a1c[] = { 
-	-18, 21, -55, 106, -166, 226, 320, 7938, 9300, 722, -11887, -10516, 5091, 5776, 13936, 15929, 
-	2957, -1781, 1981, -3870, -10190, -9436, -10803, -5156, -1487, -2151, -83, 1026, 2383, 2481, 2631, 2248, 
-	1395, 1715, 1464, 572, 43, 115, -1099, 30, -537, -2389, -2301, -1301, -1009, -1719, -374, 410, 
-	-193, 32, 1198, 1769, 1233, 710, -216, -1673, -2347, -1520, -783, -794, -666, -936, -516, 224, 
-	539, 395, 216, 203, 130, 196, 317, 483, 117, -364, -654, -681, -524, -317, -161, -210, 
-	-340, -292, -69, 291, 499, 360, -11, -293, -279, -126, 33, 30, -188, -557, -649, -447, 
-	-168, -16, -115, -309, -308, -46, 277, 409, 211, -52, -200, -188, -48, 93, 14, -217, 
-	-356, -309, -110, 96, 140, 12, -134, -184, -79, 70, 128, 59, -73, -183, -168, -92
-};
-
-static const short ugen_H30e036a0c[] = { 
-	-2, 0, 0, -2, 0, 0, 1, 0, 0, 2, -3, 5, -15, 30, -33, 29, 
-	219, 2235, 2743, 889, -2008, -3434, 335, 2067, 4189, 6076, 3474, 1253, 2041, 1132, -2030, -3150, 
-	-3611, -3150, -2386, -1974, -1351, -866, 272, 1108, 1052, 1213, 1598, 1193, 510, 535, 603, 586, 
-	242, 118, -68, -580, -1017, -1278, -1179, -1131, -1011, -334, 104, -101, 17, 360, 489, 273, 
-	-196, -473, -479, -415, -470, -566, -526, -519, -627, -649, -555, -447, -354, -332, -271, -135, 
-	-28, 104, 119, 59, 45, -45, -95, -37, -18, -92, -180, -179, -181, -173, -120, -86, 
-	-102, -190, -222, -186, -97, -14, -13, -69, -139, -116, -65, -59, -83, -127, -150, -124, 
-	-67, -7, -27, -90, -129, -148, -134, -87, -52, -71, -104, -117, -103, -70, -61, -64
-};
-
-static const short ugen_H30e036a1c[] = { 
-	56, -115, 180, -235, 308, -287, 5322, 10888, 4701, -9251, -14560, 2493, 5773, 10762, 18073, 6255, 
-	-1118, 1935, -1356, -9951, -9762, -10618, -8290, -2531, -1946, -791, 526, 2783, 3183, 2103, 2605, 2050, 
-	1301, 1003, 1259, 133, -52, -703, -106, -173, -2141, -2092, -1676, -2303, -1640, 442, 34, -150, 
-	230, 591, 1507, 1586, 832, -819, -2093, -1643, -696, -883, -1095, -514, -450, -571, -258, 233, 
-	450, 339, 262, 15, 146, 424, 484, 177, -246, -635, -792, -672, -350, -50, -141, -296, 
-	-248, -39, 235, 455, 352, 47, -241, -317, -215, 4, 89, -154, -540, -631, -454, -208, 
-	-47, -103, -283, -343, -161, 122, 374, 330, 93, -147, -223, -83, 95, 72, -158, -352, 
-	-376, -216, 36, 154, 64, -111, -209, -105, 58, 131, 71, -46, -166, -176, -104, -63
-};
-
-static const short ugen_H30e042a0c[] = { 
-	-2, -1, 0, 0, -2, 0, 0, 0, 0, 1, 5, -7, 7, -17, 31, -36, 
-	34, 103, 1678, 2612, 1181, -1508, -3192, -164, 1667, 3573, 5563, 3582, 1434, 1963, 1444, -1288, 
-	-2481, -3203, -3056, -2239, -1836, -1354, -795, 13, 575, 857, 1360, 1548, 1048, 842, 989, 609, 
-	339, 104, -64, -266, -677, -1110, -1336, -1213, -1145, -848, -244, 14, -62, 76, 344, 482, 
-	248, -217, -431, -388, -411, -461, -543, -582, -593, -667, -633, -532, -373, -295, -277, -206, 
-	-115, -59, 33, 111, 74, 38, -30, -96, -61, -46, -97, -176, -227, -221, -189, -143, 
-	-105, -111, -152, -171, -135, -61, -10, -14, -80, -129, -123, -97, -74, -79, -109, -146, 
-	-142, -96, -33, -24, -77, -115, -136, -122, -78, -51, -66, -99, -108, -103, -83, -66
-};
-
-static const short ugen_H30e042a1c[] = { 
-	-79, 115, -137, 151, -219, 2360, 10424, 8836, -4461, -16884, -2721, 6825, 7264, 17409, 10596, 441, 
-	1598, 946, -8103, -9949, -10223, -10372, -4147, -2982, -1677, 432, 1711, 3348, 3320, 2953, 1523, 2012, 
-	1500, 657, 177, 398, -607, -607, 483, -1705, -2106, -2137, -3237, -1750, 820, 325, -250, 76, 
-	348, 1280, 1569, 764, -1101, -2142, -1105, -329, -683, -982, -641, -277, -502, -495, -67, 295, 
-	292, 274, 18, 110, 430, 451, 331, -70, -588, -796, -752, -421, -80, -102, -238, -185, 
-	-7, 185, 373, 314, 113, -218, -326, -271, -94, 65, -77, -404, -585, -474, -269, -71, 
-	-79, -260, -368, -276, 10, 316, 387, 168, -103, -229, -157, 60, 121, -69, -303, -390, 
-	-312, -64, 147, 112, -59, -208, -162, 13, 130, 97, -16, -151, -199, -115, -50, -51
-};
-
-static const short ugen_H30e048a0c[] = { 
-	0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 2, 8, -7, 10, -16, 28, 
-	-31, 36, 27, 1207, 2398, 1417, -943, -2971, -709, 1339, 3076, 5074, 3633, 1616, 1865, 1729, 
-	-621, -1916, -2780, -2887, -1942, -1532, -1470, -1222, -293, 589, 939, 1356, 1549, 1313, 967, 711, 
-	376, 118, -161, -331, -393, -679, -1019, -1162, -1151, -1104, -604, -93, -73, -106, 95, 302, 
-	378, 142, -224, -357, -353, -398, -527, -633, -610, -590, -587, -506, -392, -311, -260, -182, 
-	-178, -167, -124, 3, 90, 63, -1, -84, -98, -83, -45, -95, -206, -259, -242, -183, 
-	-150, -105, -77, -82, -90, -109, -71, -40, -37, -73, -127, -132, -120, -86, -80, -118, 
-	-149, -145, -111, -43, -14, -54, -109, -127, -99, -68, -56, -82, -95, -104, -103, -70
-};
-
-static const short ugen_H30e048a1c[] = { 
-	-30, 71, -126, 172, 166, 7471, 11767, 2424, -15579, -10530, 6903, 5702, 13913, 14082, 3334, 1591, 
-	2374, -4143, -10210, -9907, -10699, -6633, -3746, -3001, -804, 868, 3016, 3060, 3919, 2686, 1723, 1749, 
-	1413, 541, -403, -81, -523, 233, -987, -1888, -2906, -3892, -1634, 403, 636, 178, -104, 6, 
-	1021, 1506, 503, -1131, -1768, -764, -377, -464, -503, -561, -406, -639, -545, -154, 127, 68, 
-	66, 20, 177, 380, 367, 482, 186, -435, -761, -684, -476, -238, -63, -102, -178, -66, 
-	132, 326, 315, 153, -155, -359, -335, -182, 3, -8, -209, -445, -502, -334, -90, -8, 
-	-202, -410, -367, -75, 274, 403, 210, -69, -223, -196, -15, 120, 19, -216, -375, -355, 
-	-121, 113, 145, 4, -160, -194, -59, 91, 116, 39, -92, -197, -147, -44, -23, -70
-};
-
-static const short ugen_H30e054a0c[] = { 
-	0, 0, -1, -1, 0, -1, 0, -1, 0, -2, 0, 2, 7, -7, 9, -12, 
-	17, -17, 21, 0, 825, 2105, 1614, -413, -2721, -1236, 1037, 2685, 4631, 3629, 1759, 1816, 
-	1926, -41, -1406, -2206, -2436, -1889, -1847, -1614, -998, -278, 496, 1176, 1570, 1269, 916, 783, 
-	443, 15, -182, -387, -417, -254, -499, -798, -1021, -1074, -833, -366, -171, -242, -126, 73, 
-	192, 214, 48, -207, -323, -378, -501, -588, -618, -536, -431, -434, -383, -326, -254, -187, 
-	-183, -231, -216, -112, -40, 0, 0, -58, -88, -83, -82, -95, -138, -197, -246, -230, 
-	-185, -120, -63, -31, -30, -75, -112, -99, -63, -49, -81, -124, -155, -133, -96, -99, 
-	-119, -141, -121, -108, -66, -31, -46, -78, -105, -93, -80, -70, -79, -85, -87, -89
-};
-
-static const short ugen_H30e054a1c[] = { 
-	104, -163, 222, -317, 3027, 11446, 9392, -8318, -18062, 1933, 7643, 8548, 15919, 6652, 2251, 3088, 
-	-190, -7666, -9931, -10887, -8923, -4092, -4500, -2194, -388, 1510, 2948, 3800, 3652, 2013, 2815, 1746, 
-	868, 237, -76, -777, 60, 14, -2085, -3460, -4114, -2015, -298, 678, 779, -118, -142, 708, 
-	1211, 194, -903, -1165, -624, -472, -413, -75, -318, -317, -710, -867, -250, 79, -19, -206, 
-	-190, 32, 318, 421, 534, 371, -153, -577, -639, -485, -305, -129, 2, -97, -151, -9, 
-	184, 333, 240, -37, -370, -468, -290, -75, 60, -44, -324, -487, -363, -101, 11, -116, 
-	-376, -424, -195, 132, 384, 300, -9, -228, -265, -108, 78, 81, -139, -335, -354, -191, 
-	62, 173, 74, -103, -209, -132, 35, 112, 62, -44, -158, -166, -69, -27, -43, -101
-};
-
-static const short ugen_H30e060a0c[] = { 
-	2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 3, 4, 5, -4, 9, 
-	-9, 11, -6, 8, 2, 548, 1791, 1731, 56, -2463, -1701, 758, 2459, 4268, 3518, 1878, 
-	1828, 2070, 572, -677, -1871, -2763, -1865, -1355, -1425, -934, -24, 735, 976, 956, 788, 638, 
-	335, 29, -148, -295, -323, -219, -40, -290, -601, -812, -895, -631, -342, -399, -351, -108, 
-	-13, 45, 66, -52, -231, -349, -460, -527, -505, -447, -345, -291, -344, -325, -245, -202, 
-	-223, -234, -246, -222, -164, -131, -74, -41, -64, -87, -92, -129, -133, -128, -162, -202, 
-	-207, -158, -71, -17, -15, -39, -81, -120, -117, -75, -70, -101, -126, -144, -139, -111, 
-	-88, -101, -122, -127, -119, -68, -26, -33, -66, -83, -92, -93, -69, -61, -62, -72
-};
-
-static const short ugen_H30e060a1c[] = { 
-	81, -149, 215, -67, 6846, 13113, 3176, -17408, -10851, 9386, 6160, 12663, 12123, 2805, 3281, 2619, 
-	-2924, -9206, -9657, -10556, -6820, -4408, -3565, -1748, -535, 2276, 2650, 4238, 2841, 2365, 3083, 2038, 
-	789, -228, 92, -160, 55, -1365, -3688, -4595, -2741, -934, 131, 999, 249, -71, 410, 839, 
-	79, -926, -567, -207, -516, -520, 42, 78, -203, -476, -915, -709, -186, 71, -177, -438, 
-	-315, -19, 386, 656, 541, 99, -340, -484, -439, -332, -163, 25, 7, -129, -138, -30, 
-	216, 306, 130, -276, -543, -447, -190, 43, 100, -148, -442, -392, -143, 30, 2, -255, 
-	-413, -324, -48, 247, 354, 145, -169, -309, -252, -42, 102, 7, -257, -368, -252, -15, 
-	167, 154, -16, -192, -194, -29, 102, 99, 8, -124, -180, -113, -33, -29, -62, -105
-};
-
-static const short ugen_H30e066a0c[] = { 
-	0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -2, 0, 2, 0, 1, -3, 
-	5, -10, 6, 0, 0, 8, 371, 1490, 1770, 441, -2251, -2068, 535, 2364, 3984, 3346, 
-	1995, 2083, 2481, 749, -987, -1569, -2033, -1529, -1162, -976, -577, -244, 159, 448, 426, 245, 
-	108, -60, 77, 78, -267, -183, 128, 181, -132, -379, -699, -829, -607, -503, -511, -362, 
-	-186, -169, -102, -70, -162, -293, -393, -388, -346, -340, -272, -205, -242, -302, -233, -233, 
-	-286, -249, -247, -294, -285, -205, -172, -133, -72, -73, -108, -132, -132, -115, -114, -123, 
-	-150, -154, -115, -55, -31, -47, -62, -93, -124, -134, -107, -93, -93, -117, -140, -123, 
-	-105, -98, -118, -131, -116, -101, -69, -42, -34, -46, -80, -100, -82, -54, -60, -64
-};
-
-static const short ugen_H30e066a1c[] = { 
-	-27, 28, -67, 1192, 10263, 12283, -5172, -20349, -591, 10708, 6113, 14207, 7450, 2407, 3539, 1676, 
-	-5135, -9757, -9078, -9159, -6083, -5057, -2533, -1718, -138, 2109, 3143, 3746, 2079, 3302, 2970, 1944, 
-	892, 195, 93, 414, -262, -3628, -4858, -3481, -2037, -735, 706, 579, -122, 444, 677, -138, 
-	-946, -313, 324, -293, -562, -84, 379, 26, -336, -557, -916, -682, -141, -98, -378, -511, 
-	-439, -39, 538, 727, 396, -115, -306, -288, -302, -185, 8, 116, -23, -197, -204, 19, 
-	239, 212, -107, -477, -572, -358, -77, 124, 47, -270, -417, -243, -2, 72, -44, -294, 
-	-400, -243, 59, 282, 255, -28, -267, -352, -226, 8, 97, -82, -308, -323, -150, 100, 
-	193, 92, -114, -233, -133, 60, 139, 75, -57, -177, -189, -92, -29, -23, -61, -84
-};
-
-static const short ugen_H30e072a0c[] = { 
-	0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 3, 0, 4, 
-	0, 5, -10, 8, 8, -2, 15, 300, 1257, 1763, 731, -2206, -2354, 470, 2494, 3871, 
-	3294, 2433, 2008, 1689, 867, -123, -980, -1632, -1004, -752, -1119, -1030, -681, -425, -152, -202, 
-	-330, 26, 281, 321, 97, -21, 173, 323, 371, 5, -441, -778, -799, -630, -572, -540, 
-	-460, -383, -288, -160, -222, -280, -254, -197, -188, -221, -179, -138, -171, -208, -242, -276, 
-	-299, -297, -279, -313, -328, -274, -243, -213, -137, -92, -108, -119, -105, -107, -90, -76, 
-	-65, -79, -114, -122, -91, -60, -65, -74, -99, -135, -137, -113, -89, -74, -83, -117, 
-	-136, -123, -111, -104, -102, -98, -96, -71, -37, -34, -38, -57, -73, -81, -69, -50
-};
-
-static const short ugen_H30e072a1c[] = { 
-	-109, 170, -300, 2905, 12629, 9544, -12590, -17888, 7293, 9124, 7088, 13328, 4691, 2937, 3375, 823, 
-	-7079, -9478, -8092, -7978, -6263, -4867, -2228, -2116, 585, 1993, 3312, 3061, 1990, 3630, 2968, 1791, 
-	707, 1025, 735, 214, -1684, -4491, -4496, -3192, -1648, -385, 401, 138, 97, 625, -47, -941, 
-	-551, 638, 378, -427, -377, 429, 571, -209, -447, -646, -872, -602, -258, -295, -487, -619, 
-	-454, 62, 520, 588, 255, -137, -165, -180, -153, 0, 170, 143, -130, -288, -191, 74, 
-	193, 29, -319, -574, -515, -279, -3, 158, -25, -306, -371, -121, 81, 106, -80, -333, 
-	-363, -163, 126, 256, 129, -183, -360, -352, -170, 63, 71, -159, -312, -260, -52, 133, 
-	171, 27, -178, -225, -63, 119, 144, 49, -116, -226, -191, -76, -8, -22, -68, -74
-};
-
-static const short ugen_H30e078a0c[] = { 
-	0, 0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 
-	4, 0, 3, -14, 17, 2, 5, 0, 310, 1154, 1769, 807, -2495, -2463, 822, 3127, 
-	4161, 2604, 1471, 2191, 2469, 1163, 180, -281, -1151, -1261, -1185, -1426, -1597, -1222, -922, -918, 
-	-403, 154, 247, 368, 653, 407, 61, 376, 640, 236, -274, -517, -797, -791, -595, -651, 
-	-725, -622, -436, -326, -284, -257, -159, -71, -45, -52, -98, -83, -105, -168, -247, -311, 
-	-296, -342, -347, -322, -323, -331, -311, -241, -194, -164, -148, -99, -74, -80, -68, -67, 
-	-28, -21, -78, -155, -163, -99, -80, -80, -100, -118, -128, -134, -100, -69, -62, -94, 
-	-136, -147, -131, -86, -81, -103, -104, -96, -68, -36, -17, -30, -59, -78, -84, -60
-};
-
-static const short ugen_H30e078a1c[] = { 
-	-135, 222, -365, 4418, 13834, 6172, -17245, -13166, 11522, 7071, 7786, 11628, 3713, 3391, 3506, 26, 
-	-8551, -8659, -7016, -7477, -6519, -4316, -2509, -2386, 751, 2127, 3413, 2205, 2424, 3748, 2688, 1542, 
-	970, 1530, 1005, 31, -2804, -4442, -3798, -2980, -1729, -495, 177, -232, 245, 226, -917, -852, 
-	369, 987, 160, -345, 41, 857, 476, -384, -525, -722, -818, -585, -394, -417, -578, -676, 
-	-419, 85, 410, 401, 144, -39, -58, -109, 24, 196, 303, 86, -253, -306, -138, 70, 
-	73, -139, -437, -585, -482, -245, 37, 166, -52, -324, -313, -30, 140, 113, -120, -349, 
-	-308, -77, 132, 197, -2, -304, -426, -330, -80, 93, 37, -204, -305, -207, 0, 145, 
-	129, -23, -200, -190, -6, 143, 130, 0, -149, -234, -173, -52, -4, -40, -89, -63
-};
-
-static const short ugen_H30e084a0c[] = { 
-	0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 1, 0, 0, -2, 1, 3, 
-	0, 6, 3, 0, -8, 31, 0, -5, -9, 495, 1195, 1783, 356, -3081, -1661, 2241, 
-	3140, 2517, 2338, 2584, 2600, 2625, 1604, 231, -747, -1307, -1613, -1957, -1827, -1862, -1940, -1241, 
-	-269, 9, 113, 629, 962, 625, 343, 457, 383, 273, 59, -323, -703, -781, -679, -753, 
-	-861, -771, -616, -494, -294, -174, -122, -44, 58, 106, 27, -46, -78, -170, -255, -302, 
-	-320, -354, -375, -349, -331, -337, -321, -256, -241, -241, -181, -99, -46, -37, -43, -56, 
-	-29, -5, -69, -139, -152, -122, -117, -106, -96, -104, -106, -106, -100, -103, -77, -71, 
-	-99, -135, -128, -91, -78, -90, -101, -88, -74, -47, -24, -32, -36, -48, -72, -81
-};
-
-static const short ugen_H30e084a1c[] = { 
-	-131, 222, -345, 5201, 14225, 3725, -19161, -9353, 13142, 5666, 7645, 10323, 3674, 3668, 3928, -399, 
-	-9374, -7867, -6132, -7414, -6624, -3784, -2931, -2632, 752, 2014, 3283, 1923, 2665, 3884, 2470, 1095, 
-	1413, 1831, 640, -77, -2578, -4201, -3587, -2483, -1814, -1021, -121, -305, -57, -473, -1111, -392, 
-	801, 1067, 182, -161, 476, 1107, 357, -472, -572, -751, -828, -580, -414, -502, -652, -684, 
-	-437, 28, 292, 245, 114, 5, 5, 32, 189, 335, 376, 58, -298, -290, -118, 23, 
-	-28, -234, -487, -589, -457, -223, 59, 158, -67, -296, -230, 28, 161, 110, -141, -318, 
-	-250, -35, 122, 139, -100, -380, -441, -296, -18, 119, 19, -223, -293, -167, 29, 153, 
-	112, -51, -194, -142, 30, 128, 105, -22, -152, -202, -137, -36, -25, -57, -88, -60
-};
-
-static const short ugen_H30e090a0c[] = { 
-	0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -2, 3, 
-	0, 2, 2, 1, -3, 22, 12, -17, -33, 142, 834, 1423, 1602, -858, -2769, -536, 
-	2056, 3457, 3025, 2432, 2966, 3332, 2325, 559, -491, -1276, -1847, -2148, -2269, -2376, -2095, -1237, 
-	-538, -87, 333, 781, 880, 843, 722, 319, 49, 205, 264, -144, -546, -773, -817, -819, 
-	-833, -855, -777, -535, -284, -141, -75, -8, 89, 180, 144, -7, -133, -180, -244, -325, 
-	-344, -349, -387, -384, -332, -303, -292, -286, -298, -267, -191, -98, -36, -21, -41, -48, 
-	-43, -63, -77, -86, -104, -143, -146, -128, -105, -86, -94, -95, -105, -124, -103, -73, 
-	-71, -94, -118, -118, -90, -66, -75, -85, -74, -67, -46, -26, -28, -43, -63, -72
-};
-
-static const short ugen_H30e090a1c[] = { 
-	-126, 212, -351, 4973, 14121, 3256, -19044, -8048, 13395, 5005, 6622, 9762, 4055, 3890, 4372, -5, 
-	-9523, -7467, -5463, -7503, -6772, -3474, -3146, -3066, 632, 1905, 2812, 1780, 2994, 3942, 2250, 965, 
-	1630, 1601, 444, 163, -2268, -3654, -3237, -2409, -1821, -1277, -608, -607, -428, -893, -1079, -157, 
-	940, 1077, 319, 186, 713, 1151, 401, -449, -619, -807, -837, -508, -390, -585, -707, -710, 
-	-476, -83, 158, 156, 68, 22, 66, 150, 312, 410, 397, 88, -249, -289, -153, -37, 
-	-73, -273, -537, -591, -444, -208, 40, 131, -75, -262, -157, 63, 154, 92, -125, -288, 
-	-225, -22, 102, 88, -156, -409, -435, -264, -1, 106, 10, -220, -277, -146, 40, 141, 
-	103, -44, -178, -128, 25, 118, 88, -22, -142, -180, -111, -34, -48, -84, -94, -56
-};
-
-static const short ugen_H30e096a0c[] = { 
-	0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 
-	1, 5, 0, 0, 9, 14, 14, -26, 1, 11, 658, 1410, 2149, 188, -3832, -1987, 
-	2712, 3833, 2870, 2873, 3110, 2928, 2523, 945, -768, -1593, -1616, -2094, -2778, -2503, -1628, -1141, 
-	-796, 78, 622, 672, 817, 1076, 669, 17, -49, 138, 229, -29, -422, -786, -936, -814, 
-	-775, -844, -757, -516, -289, -133, -14, 50, 120, 188, 128, -28, -162, -188, -259, -357, 
-	-357, -367, -384, -367, -296, -241, -298, -322, -293, -260, -185, -74, -28, -64, -58, -67, 
-	-104, -102, -38, -25, -111, -146, -130, -110, -103, -95, -88, -115, -122, -122, -105, -70, 
-	-59, -85, -118, -114, -72, -44, -62, -89, -83, -70, -49, -26, -33, -42, -57, -72
-};
-
-static const short ugen_H30e096a1c[] = { 
-	-110, 175, -331, 3766, 13514, 4876, -17340, -9338, 12716, 5249, 4793, 9834, 4605, 4053, 4728, 1237, 
-	-8906, -7620, -4831, -7553, -7150, -3497, -2986, -3640, 268, 1800, 2441, 1517, 2970, 4235, 2041, 960, 
-	1779, 1167, 287, 705, -1856, -3361, -2745, -2218, -1966, -1527, -867, -1005, -902, -957, -1032, -282, 
-	914, 1131, 456, 455, 852, 1141, 459, -318, -554, -865, -853, -407, -351, -626, -772, -761, 
-	-520, -244, 49, 93, 2, 3, 135, 222, 331, 449, 418, 133, -180, -256, -192, -104, 
-	-91, -279, -553, -594, -450, -220, -10, 94, -66, -246, -143, 79, 155, 82, -117, -267, 
-	-226, -46, 75, 57, -165, -404, -415, -257, -19, 67, -12, -206, -258, -141, 25, 117, 
-	97, -31, -174, -141, 10, 115, 80, -28, -136, -169, -104, -43, -69, -105, -104, -63
-};
-
-static const short ugen_H30e102a0c[] = { 
-	0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, -2, 3, 
-	-1, 3, 0, 0, 9, 15, 7, -13, -7, 57, 772, 2127, 2398, -1885, -4622, 118, 
-	3747, 3287, 2962, 3060, 2572, 2559, 2332, 225, -1237, -1291, -1647, -2520, -2529, -1783, -1534, -1086, 
-	-238, 394, 439, 671, 1073, 851, 234, -104, -81, 8, 161, -81, -556, -768, -814, -834, 
-	-798, -673, -552, -476, -317, -99, 66, 136, 165, 122, -8, -104, -149, -218, -317, -372, 
-	-402, -401, -337, -287, -241, -251, -308, -283, -252, -227, -153, -54, -60, -113, -121, -158, 
-	-145, -36, 17, -63, -133, -116, -94, -79, -81, -104, -129, -134, -126, -123, -81, -59, 
-	-83, -112, -113, -62, -36, -48, -78, -92, -76, -61, -42, -34, -27, -41, -85, -120
-};
-
-static const short ugen_H30e102a1c[] = { 
-	-48, 62, -157, 1942, 11892, 8055, -13700, -12355, 10353, 6723, 2346, 10006, 5662, 3855, 5047, 3057, 
-	-7255, -8331, -4195, -7284, -7772, -4069, -2515, -4093, -506, 1730, 2135, 1434, 2553, 4361, 2118, 962, 
-	1775, 1019, 169, 998, -1111, -3030, -2636, -1960, -1810, -1878, -1204, -1120, -1191, -1064, -1017, -436, 
-	639, 1150, 679, 553, 849, 1158, 580, -204, -380, -768, -874, -394, -277, -580, -802, -840, 
-	-592, -353, -60, 32, -23, -20, 168, 269, 309, 412, 432, 214, -122, -222, -189, -124, 
-	-116, -256, -487, -581, -477, -257, -74, 49, -44, -204, -171, 51, 167, 91, -92, -253, 
-	-225, -90, 39, 53, -116, -339, -385, -275, -67, 35, -10, -187, -243, -140, 0, 110, 
-	97, -26, -165, -130, 5, 98, 77, -21, -119, -146, -103, -60, -79, -99, -107, -87
-};
-
-static const short ugen_H30e108a0c[] = { 
-	0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 4, 
-	0, 0, -1, 7, 5, 10, 1, 1, -13, 328, 1859, 2650, -319, -3910, -2013, 2271, 
-	3689, 3590, 2851, 2144, 2528, 2498, 610, -915, -966, -1301, -2108, -2356, -1846, -1478, -1069, -428, 
-	151, 511, 606, 795, 909, 466, -76, -219, -152, -2, -100, -414, -671, -706, -685, -769, 
-	-740, -493, -340, -364, -282, -73, 160, 251, 132, -29, -130, -165, -186, -286, -389, -425, 
-	-436, -382, -254, -200, -247, -290, -234, -206, -205, -150, -112, -97, -114, -179, -260, -205, 
-	-56, 12, -29, -106, -114, -77, -65, -57, -73, -110, -158, -160, -120, -95, -72, -79, 
-	-125, -125, -71, -27, -28, -64, -88, -89, -64, -46, -29, -22, -35, -87, -143, -136
-};
-
-static const short ugen_H30e108a1c[] = { 
-	39, -86, 104, 344, 8688, 11258, -7603, -15037, 5323, 8936, 271, 8916, 7899, 3288, 4991, 5028, 
-	-4215, -9237, -3964, -6313, -8442, -5142, -2270, -4022, -1770, 1580, 1881, 1472, 2040, 4217, 2289, 966, 
-	1756, 1064, 187, 1015, -223, -2504, -2613, -1965, -1632, -1971, -1602, -1182, -1277, -1096, -1044, -576, 
-	270, 978, 923, 619, 726, 1053, 755, -16, -230, -549, -802, -474, -206, -462, -782, -888, 
-	-677, -450, -192, -17, -6, -28, 156, 291, 264, 330, 393, 297, -37, -192, -188, -108, 
-	-101, -205, -381, -527, -497, -304, -146, -25, -16, -132, -182, -20, 141, 101, -42, -210, 
-	-235, -145, -8, 48, -19, -217, -337, -301, -137, 8, 11, -135, -243, -156, -14, 93, 
-	91, 0, -117, -120, -8, 73, 58, 0, -64, -115, -116, -70, -69, -98, -108, -91
-};
-
-static const short ugen_H30e114a0c[] = { 
-	0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 2, 0, 1, 0, 1, 3, 
-	2, 0, 0, 8, 7, 9, -5, 15, 194, 1703, 2633, -2, -3042, -2225, 1137, 3276, 
-	3782, 3016, 2130, 2476, 2393, 656, -870, -1061, -1358, -1807, -1936, -1799, -1506, -1076, -278, 328, 
-	467, 567, 873, 976, 486, -22, -155, -184, -198, -241, -528, -785, -724, -631, -625, -624, 
-	-510, -339, -237, -193, -133, 23, 245, 231, 26, -116, -205, -229, -274, -375, -495, -496, 
-	-387, -282, -238, -213, -201, -218, -166, -118, -93, -86, -111, -159, -237, -298, -252, -108, 
-	-19, -40, -96, -99, -62, -52, -45, -59, -74, -106, -150, -152, -109, -62, -76, -123, 
-	-134, -95, -38, -26, -46, -69, -85, -71, -43, -12, -7, -43, -101, -137, -121, -86
-};
-
-static const short ugen_H30e114a1c[] = { 
-	69, -122, 169, -242, 4363, 12156, 586, -14673, -2222, 9858, 356, 5389, 10829, 3654, 3853, 6422, 
-	174, -9023, -5125, -4457, -8685, -6582, -2643, -3455, -3167, 947, 1795, 1504, 1631, 3742, 2655, 843, 
-	1697, 1271, 296, 759, 658, -1639, -2615, -1996, -1645, -2057, -1851, -1170, -1339, -1197, -874, -643, 
-	-132, 619, 1027, 725, 598, 812, 828, 220, -84, -296, -649, -541, -213, -327, -710, -852, 
-	-730, -568, -348, -64, 25, -5, 106, 270, 212, 218, 304, 309, 61, -161, -189, -119, 
-	-61, -113, -253, -437, -481, -369, -233, -122, -20, -66, -163, -88, 51, 61, 0, -148, 
-	-247, -204, -58, 34, 45, -73, -251, -300, -212, -48, 7, -77, -206, -177, -60, 30, 
-	72, 53, -41, -119, -66, 28, 51, 22, -16, -83, -118, -85, -65, -102, -107, -75
-};
-
-static const short ugen_H30e120a0c[] = { 
-	2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 3, 1, 1, 
-	0, 0, 6, 0, 11, 0, 15, 198, 1741, 2564, -90, -2640, -1963, 657, 3051, 3999, 
-	2904, 1814, 2535, 2635, 601, -1047, -1183, -1485, -1983, -1934, -1625, -1420, -1045, -237, 412, 611, 
-	837, 942, 881, 736, 230, -244, -251, -54, -240, -776, -1010, -903, -799, -663, -539, -388, 
-	-275, -230, -135, -34, 92, 197, 184, 63, -39, -144, -271, -328, -394, -510, -575, -467, 
-	-317, -301, -249, -173, -125, -114, -95, -16, -10, -74, -180, -295, -343, -257, -130, -85, 
-	-95, -110, -111, -97, -44, -14, -51, -81, -82, -105, -127, -113, -89, -80, -104, -132, 
-	-121, -73, -44, -51, -75, -83, -69, -35, -2, -4, -53, -122, -139, -103, -65, -67
-};
-
-static const short ugen_H30e120a1c[] = { 
-	-2, 13, -36, 19, 856, 9010, 8189, -8913, -9510, 6586, 3189, 621, 11550, 6846, 2035, 6084, 
-	4747, -5820, -7473, -3159, -7286, -8205, -3832, -2725, -4094, -567, 1769, 1457, 1456, 2936, 3056, 917, 
-	1453, 1477, 630, 393, 986, -272, -2267, -2161, -1657, -2161, -2224, -1177, -1161, -1413, -872, -450, 
-	-302, 109, 866, 888, 513, 561, 721, 440, 39, -103, -373, -522, -331, -230, -550, -760, 
-	-719, -636, -500, -188, 54, 48, 42, 195, 194, 87, 162, 259, 151, -102, -175, -145, 
-	-76, -30, -85, -295, -445, -411, -311, -204, -75, -28, -126, -142, -46, -4, -24, -102, 
-	-224, -234, -117, 8, 64, 25, -130, -230, -236, -144, -51, -34, -120, -175, -125, -53, 
-	36, 81, 37, -98, -123, -34, 34, 43, 10, -47, -103, -96, -66, -88, -98, -67
-};
-
-static const short ugen_H30e126a0c[] = { 
-	2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, -2, 
-	-3, 6, 0, 7, -10, 14, 252, 1896, 2518, -342, -2525, -1697, 609, 3043, 4139, 2835, 
-	1716, 2529, 2451, 413, -1001, -1146, -1748, -2203, -1817, -1813, -1746, -887, -51, 405, 683, 989, 
-	1072, 1015, 873, 372, -101, -130, -40, -225, -638, -1075, -1191, -1085, -858, -632, -463, -221, 
-	-80, -108, -36, 188, 304, 215, 49, -49, -108, -198, -325, -457, -561, -579, -509, -464, 
-	-374, -267, -191, -114, -95, -9, 43, 36, -38, -178, -277, -315, -271, -174, -126, -152, 
-	-142, -150, -139, -76, -27, -30, -64, -87, -99, -98, -89, -70, -89, -116, -131, -124, 
-	-91, -70, -71, -105, -109, -74, -21, 6, -20, -86, -135, -124, -94, -69, -65, -97
-};
-
-static const short ugen_H30e126a1c[] = { 
-	-42, 69, -103, 127, -188, 3560, 10448, 1104, -11167, -1328, 5557, -1391, 7258, 11615, 2550, 3428, 
-	7148, 276, -7924, -4538, -4531, -8519, -6008, -2607, -3811, -2744, 1144, 1483, 1387, 2176, 2975, 1463, 
-	1089, 1591, 966, 404, 622, 712, -1053, -2089, -1899, -2051, -2568, -1610, -882, -1357, -1130, -431, 
-	-153, -109, 393, 907, 606, 340, 496, 527, 183, -42, -144, -330, -427, -290, -362, -634, 
-	-636, -576, -569, -401, -14, 114, 45, 68, 150, 28, -17, 142, 192, -7, -146, -146, 
-	-125, -46, 23, -89, -349, -417, -346, -266, -163, -33, -78, -173, -145, -92, -92, -100, 
-	-153, -234, -194, -46, 54, 69, -21, -128, -188, -202, -135, -53, -32, -135, -177, -131, 
-	-20, 54, 57, -32, -134, -89, -13, 20, 11, -8, -53, -92, -79, -70, -82, -73
-};
-
-static const short ugen_H30e132a0c[] = { 
-	2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 1, 0, -1, 
-	1, 7, 10, -5, 12, 331, 2151, 2483, -673, -2526, -1485, 701, 3293, 4347, 2685, 1637, 
-	2646, 2402, 106, -1303, -1300, -1779, -2225, -1792, -1845, -1967, -1086, -156, 561, 834, 978, 1191, 
-	1097, 931, 543, 91, -46, 58, -60, -556, -1014, -1106, -1150, -1166, -896, -564, -347, -178, 
-	-12, 100, 202, 329, 329, 164, 0, -134, -232, -254, -391, -620, -631, -556, -485, -406, 
-	-338, -190, -143, -109, 3, 103, 92, -37, -137, -189, -229, -243, -195, -180, -174, -183, 
-	-212, -166, -90, -22, -34, -82, -85, -74, -79, -62, -41, -64, -106, -130, -118, -104, 
-	-71, -73, -119, -136, -83, -9, 14, -27, -113, -142, -108, -64, -43, -69, -98, -111
-};
-
-static const short ugen_H30e132a1c[] = { 
-	12, -29, 50, -78, 93, 207, 6169, 8672, -4160, -8255, 2443, 854, 724, 12100, 7740, 1054, 
-	5535, 5850, -3469, -7016, -3554, -6279, -7802, -4143, -2828, -3959, -921, 1480, 1250, 1805, 2326, 2066, 
-	1100, 1369, 1323, 706, 307, 721, 193, -1136, -1940, -2191, -2465, -2242, -1055, -1033, -1305, -637, 
-	-124, -41, 141, 632, 727, 341, 258, 423, 292, 14, -46, -176, -335, -396, -306, -436, 
-	-526, -454, -472, -524, -260, 87, 129, 33, 9, 11, -98, -30, 135, 96, -74, -120, 
-	-136, -125, -18, 40, -122, -323, -346, -288, -239, -89, -21, -139, -228, -211, -139, -108, 
-	-102, -189, -229, -145, -2, 89, 67, -29, -110, -164, -156, -86, -28, -87, -167, -153, 
-	-87, -8, 22, 19, -60, -97, -66, -31, 0, 31, 20, -54, -89, -67, -61, -81
-};
-
-static const short ugen_H30e138a0c[] = { 
-	0, -1, -1, 0, -1, 0, 0, -2, 0, -1, 2, 0, 1, -4, -2, -1, 
-	1, 7, 0, 5, 452, 2465, 2408, -1085, -2574, -1286, 865, 3665, 4601, 2490, 1609, 2827, 
-	2256, -217, -1498, -1526, -2105, -2418, -1671, -1613, -2072, -1292, -185, 467, 800, 1083, 1285, 1074, 
-	935, 693, 101, -39, 255, 56, -537, -879, -937, -1052, -1145, -982, -778, -580, -322, -145, 
-	33, 305, 436, 324, 199, 119, -39, -248, -339, -387, -519, -720, -701, -430, -348, -323, 
-	-278, -200, -103, -6, 67, 16, -22, -22, -78, -179, -187, -189, -201, -218, -255, -253, 
-	-221, -105, -20, -32, -82, -111, -108, -78, -23, -22, -63, -103, -118, -119, -104, -84, 
-	-112, -138, -130, -88, -21, 0, -67, -138, -134, -102, -69, -48, -54, -85, -111, -111
-};
-
-static const short ugen_H30e138a1c[] = { 
-	0, -8, 7, -6, -2, -25, 1082, 7566, 5787, -6151, -4876, 1656, -1321, 5536, 12616, 4086, 
-	1623, 6579, 3624, -5211, -5741, -3926, -6883, -6479, -3276, -3270, -3218, 208, 1254, 1471, 1841, 1899, 
-	1692, 1081, 1382, 1216, 444, 239, 640, 33, -1131, -2158, -2549, -2395, -1606, -993, -1197, -899, 
-	-299, -58, 135, 421, 623, 520, 282, 203, 225, 83, -9, -75, -238, -427, -391, -245, 
-	-312, -387, -386, -412, -442, -153, 128, 118, -34, -69, -89, -143, -2, 114, 34, -71, 
-	-115, -172, -128, 12, 39, -123, -269, -282, -246, -181, -48, -56, -194, -282, -238, -154, 
-	-96, -104, -191, -211, -124, 18, 105, 88, 2, -79, -126, -104, -64, -63, -111, -134, 
-	-121, -87, -33, 23, 26, -43, -83, -66, -13, 37, 64, 18, -55, -83, -79, -88
-};
-
-static const short ugen_H30e144a0c[] = { 
-	0, 0, 0, 0, 0, 0, -1, 0, 0, 3, 0, 3, -4, 1, -3, 4, 
-	4, 8, 8, 609, 2851, 2307, -1580, -2633, -1063, 1095, 4117, 4863, 2301, 1613, 3065, 2098, 
-	-621, -1681, -1751, -2398, -2593, -1790, -1544, -1965, -1246, -157, 386, 796, 1083, 1236, 1118, 940, 
-	665, 189, -16, 143, 92, -402, -805, -873, -848, -929, -907, -700, -620, -539, -376, -99, 
-	222, 431, 423, 260, 118, 0, -122, -271, -429, -683, -794, -546, -400, -335, -285, -272, 
-	-193, -141, -40, -18, -38, 27, 51, -22, -104, -135, -128, -185, -269, -298, -299, -235, 
-	-107, -29, -46, -64, -97, -106, -71, -33, -14, -56, -89, -106, -104, -81, -97, -123, 
-	-145, -142, -68, -1, -18, -98, -143, -128, -86, -46, -41, -54, -73, -87, -107, -110
-};
-
-static const short ugen_H30e144a1c[] = { 
-	-18, 17, -28, 29, -41, 46, -86, 1984, 7839, 3462, -6156, -3422, -210, -324, 9013, 10816, 
-	2093, 2583, 6637, 1762, -5724, -5033, -4367, -6593, -5477, -2993, -3372, -2322, 588, 1176, 1562, 1416, 
-	1798, 1500, 1032, 1513, 1048, 104, 182, 802, -107, -1440, -2412, -2589, -1952, -1301, -1109, -1081, 
-	-559, -183, 10, 332, 523, 537, 494, 282, -10, 10, 20, -10, -191, -410, -423, -320, 
-	-176, -186, -314, -406, -420, -350, -72, 131, 58, -98, -109, -135, -152, -13, 86, -18, 
-	-122, -155, -191, -122, 6, 13, -125, -236, -247, -227, -155, -43, -79, -221, -328, -285, 
-	-172, -81, -96, -206, -246, -140, 25, 121, 120, 29, -85, -143, -126, -82, -65, -99, 
-	-141, -157, -120, -44, 30, 30, -43, -94, -69, -10, 50, 59, -27, -126, -139, -101
-};
-
-static const short ugen_H30e150a0c[] = { 
-	-2, -1, 0, 0, -1, -3, 0, 0, 3, -2, 3, -6, 2, -6, 4, 0, 
-	13, 7, 805, 3284, 2171, -2157, -2713, -806, 1387, 4633, 5096, 2084, 1681, 3301, 1875, -1070, 
-	-1851, -1940, -2775, -2763, -1857, -1555, -1865, -1315, -79, 568, 800, 1056, 1212, 1127, 830, 618, 
-	250, -53, 85, 18, -501, -881, -751, -654, -808, -748, -496, -442, -510, -484, -302, 63, 
-	365, 325, 212, 149, 62, -95, -210, -475, -816, -782, -564, -307, -228, -307, -263, -152, 
-	-129, -166, -102, 32, 44, 25, -11, -104, -91, -81, -193, -289, -311, -309, -253, -133, 
-	-41, -48, -98, -103, -77, -49, -18, -29, -76, -123, -126, -101, -82, -100, -138, -162, 
-	-143, -63, 0, -44, -127, -141, -114, -89, -55, -26, -44, -75, -95, -124, -113, -61
-};
-
-static const short ugen_H30e150a1c[] = { 
-	9, -22, 20, -27, 36, -49, 61, -64, 2614, 7565, 2172, -5834, -3480, -1021, 1743, 10329, 
-	8849, 1301, 3206, 6317, 510, -5779, -4686, -4363, -6110, -4866, -2803, -3225, -1688, 688, 1210, 1187, 
-	1230, 1907, 1189, 1199, 1617, 669, -201, 524, 898, -565, -1728, -2442, -2270, -1631, -1228, -1072, 
-	-893, -388, -68, 125, 333, 613, 643, 424, 113, -105, -58, -44, -30, -283, -508, -420, 
-	-222, -150, -171, -281, -430, -431, -265, 53, 154, -6, -93, -69, -147, -169, -33, 21, 
-	-56, -136, -203, -208, -113, 25, 1, -145, -217, -214, -187, -107, -7, -81, -256, -342, 
-	-270, -155, -83, -111, -217, -228, -105, 42, 127, 118, 33, -83, -175, -158, -66, -9, 
-	-57, -158, -208, -133, 9, 94, 38, -66, -99, -44, 15, 38, 0, -90, -142, -124
-};
-
-static const short ugen_H30e156a0c[] = { 
-	0, 0, 0, 0, -3, 0, 0, 5, -1, 3, -6, 7, -8, 8, -5, 20, 
-	8, 1044, 3778, 1984, -2808, -2792, -514, 1755, 5226, 5278, 1826, 1832, 3587, 1568, -1619, -2026, 
-	-2076, -3123, -2971, -1932, -1622, -1685, -1230, -177, 694, 929, 1136, 1248, 1077, 827, 551, 163, 
-	-41, 11, -118, -584, -979, -914, -661, -507, -537, -458, -270, -255, -389, -272, 88, 212, 
-	142, 78, 75, 63, -35, -296, -602, -727, -701, -491, -347, -296, -179, -137, -183, -231, 
-	-123, 39, 29, -16, 15, -35, -103, -111, -110, -177, -269, -305, -297, -224, -125, -57, 
-	-73, -95, -103, -90, -23, 32, 2, -81, -148, -155, -131, -110, -106, -141, -169, -141, 
-	-52, 0, -42, -110, -137, -119, -73, -35, -25, -41, -72, -104, -113, -76, -35, -30
-};
-
-static const short ugen_H30e156a1c[] = { 
-	0, 7, -20, 16, -26, 33, -49, 57, -11, 2885, 7205, 1613, -5843, -3878, -756, 3297, 
-	10299, 7508, 967, 3470, 5933, -204, -5640, -4379, -4103, -5723, -4387, -2674, -3020, -1335, 754, 968, 
-	736, 1467, 1734, 1023, 1535, 1413, 229, -46, 867, 551, -889, -1900, -2262, -1871, -1555, -1157, 
-	-969, -735, -286, 26, 189, 282, 714, 747, 244, -49, -68, -103, -41, -20, -356, -611, 
-	-500, -215, -163, -262, -355, -398, -332, -147, 111, 182, 22, -69, -68, -163, -188, -85, 
-	-39, -90, -177, -256, -233, -114, 9, -13, -134, -219, -214, -141, -39, 5, -99, -262, 
-	-317, -251, -169, -99, -111, -190, -198, -102, 11, 93, 95, 1, -134, -200, -126, -6, 
-	20, -80, -191, -193, -82, 54, 96, 14, -80, -90, -61, -34, 0, -22, -88, -132
-};
-
-static const short ugen_H30e162a0c[] = { 
-	0, 0, -1, -4, 0, 0, 5, -3, 4, -10, 7, -10, 10, -13, 28, 7, 
-	1313, 4300, 1769, -3510, -2870, -198, 2141, 5862, 5427, 1543, 2047, 3879, 1222, -2218, -2242, -2228, 
-	-3436, -3144, -2023, -1735, -1560, -1023, -242, 738, 1074, 1136, 1303, 1140, 840, 503, 138, -34, 
-	-149, -325, -687, -1039, -1074, -813, -495, -348, -283, -196, -204, -235, 44, 276, 206, 25, 
-	-50, -26, -42, -240, -434, -583, -688, -567, -442, -394, -276, -149, -156, -239, -171, 60, 
-	115, 26, -18, -50, -93, -158, -149, -135, -212, -268, -294, -278, -197, -88, -59, -92, 
-	-110, -118, -91, -31, 44, 42, -58, -162, -193, -151, -123, -143, -191, -212, -148, -41, 
-	0, -44, -96, -114, -101, -62, -34, -26, -50, -88, -116, -109, -51, 6, -4, -64
-};
-
-static const short ugen_H30e162a1c[] = { 
-	8, -2, 7, -17, 16, -23, 28, -41, 49, 33, 2915, 6901, 1306, -6034, -3966, -123, 
-	4007, 9806, 6704, 771, 3517, 5573, -514, -5385, -4021, -3790, -5344, -4016, -2606, -2814, -1102, 707, 
-	471, 695, 1606, 1385, 1249, 1636, 989, 175, 318, 733, 245, -1003, -1967, -1969, -1613, -1474, 
-	-1134, -833, -534, -173, 29, 109, 389, 797, 659, 111, -104, 21, -3, -37, -113, -413, 
-	-640, -666, -408, -219, -311, -379, -324, -183, 24, 164, 154, 74, 19, -90, -231, -219, 
-	-97, -65, -153, -251, -292, -233, -116, -8, -14, -130, -209, -185, -111, 0, 29, -90, 
-	-232, -277, -240, -166, -78, -96, -185, -199, -118, -18, 53, 47, -62, -168, -155, -52, 
-	28, 4, -90, -155, -129, -28, 55, 66, -10, -93, -114, -92, -36, 7, -3, -70
-};
-
-static const short ugen_H30e168a0c[] = { 
-	0, -2, -5, 0, 0, 5, -4, 5, -13, 9, -15, 15, -21, 32, 10, 1610, 
-	4839, 1547, -4228, -2977, 104, 2574, 6539, 5546, 1252, 2312, 4181, 834, -2834, -2479, -2402, -3756, 
-	-3307, -2112, -1825, -1450, -802, -227, 693, 1271, 1194, 1244, 1214, 841, 534, 175, 5, -212, 
-	-603, -956, -1117, -1090, -961, -583, -303, -210, -217, -168, -29, 260, 462, 352, 127, -9, 
-	-94, -303, -431, -493, -650, -692, -585, -418, -304, -224, -205, -251, -176, -3, 135, 135, 
-	86, 18, -69, -190, -244, -181, -159, -218, -297, -329, -272, -156, -54, -28, -89, -138, 
-	-125, -81, -14, 41, 34, -51, -166, -188, -155, -120, -152, -249, -270, -174, -45, -1, 
-	-43, -91, -90, -62, -40, -23, -18, -43, -94, -147, -127, -41, 29, 17, -38, -78
-};
-
-static const short ugen_H30e168a1c[] = { 
-	2, 7, -3, 5, -16, 16, -21, 26, -37, 47, 45, 2776, 6624, 1131, -6107, -3788, 
-	363, 4093, 9219, 6235, 649, 3415, 5292, -539, -5048, -3646, -3456, -4977, -3801, -2548, -2598, -945, 
-	409, 122, 821, 1435, 1327, 1488, 1380, 783, 426, 359, 481, 125, -1092, -1816, -1771, -1524, 
-	-1359, -1069, -655, -310, -144, -111, 36, 531, 857, 466, 83, 22, 63, 73, -85, -286, 
-	-499, -694, -804, -655, -362, -235, -284, -276, -67, 130, 242, 196, 71, 1, -119, -235, 
-	-248, -140, -99, -220, -299, -294, -256, -154, -31, -19, -114, -178, -165, -101, -2, 54, 
-	-37, -197, -265, -225, -137, -72, -109, -212, -236, -155, -45, 20, -9, -114, -178, -124, 
-	-12, 56, 23, -79, -134, -87, -7, 16, -5, -57, -99, -110, -86, -23, 18, 0
-};
-
-static const short ugen_H30e174a0c[] = { 
-	0, -4, 1, 0, 6, -3, 5, -13, 11, -18, 21, -27, 40, 15, 1931, 5373, 
-	1328, -4914, -3106, 379, 3024, 7246, 5646, 981, 2627, 4464, 415, -3431, -2744, -2607, -4045, -3452, 
-	-2225, -1955, -1272, -565, -147, 641, 1329, 1412, 1171, 1225, 926, 442, 238, 174, -192, -820, 
-	-1258, -1314, -1156, -1024, -611, -288, -275, -298, -152, 110, 421, 582, 493, 314, 69, -178, 
-	-294, -393, -561, -768, -802, -635, -420, -294, -274, -242, -106, 11, -6, 112, 228, 138, 
-	0, -102, -211, -254, -197, -168, -251, -322, -325, -288, -163, -13, 5, -77, -135, -128, 
-	-76, 0, 75, 40, -107, -196, -158, -104, -108, -190, -274, -271, -173, -58, -24, -65, 
-	-90, -61, -44, -23, 11, 31, -19, -98, -141, -137, -70, 25, 44, -17, -72, -73
-};
-
-static const short ugen_H30e174a1c[] = { 
-	0, 0, 8, -3, 7, -16, 14, -20, 27, -35, 46, 37, 2541, 6292, 1082, -5934, 
-	-3523, 578, 3856, 8608, 5952, 635, 3221, 5034, -369, -4574, -3282, -3154, -4655, -3663, -2463, -2354, 
-	-938, 0, 4, 836, 1260, 1468, 1466, 1143, 876, 567, 212, 347, 37, -1030, -1625, -1720, 
-	-1419, -1224, -887, -439, -246, -243, -156, 44, 501, 844, 543, 136, 45, 87, 16, -150, 
-	-434, -705, -813, -763, -636, -515, -288, -131, -104, -19, 119, 275, 263, 71, -71, -110, 
-	-227, -263, -166, -130, -228, -317, -333, -302, -159, -12, -6, -110, -142, -129, -94, 11, 
-	75, -7, -168, -224, -183, -126, -85, -138, -237, -262, -178, -68, 1, -24, -130, -176, 
-	-100, 25, 86, 50, -51, -113, -87, -40, -31, -35, -49, -83, -82, -39, -6, 4
-};
-
-static const short ugen_H30e180a0c[] = { 
-	-4, 1, 0, 6, -4, 6, -15, 12, -19, 23, -32, 44, 24, 2248, 5868, 1154, 
-	-5507, -3289, 557, 3467, 7942, 5771, 755, 2947, 4744, -18, -4003, -3005, -2877, -4335, -3565, -2354, 
-	-2119, -1107, -317, -29, 691, 1249, 1544, 1279, 1113, 1004, 479, 139, 334, -83, -946, -1476, 
-	-1586, -1269, -1100, -722, -309, -254, -350, -189, 149, 471, 662, 634, 332, -30, -49, -61, 
-	-321, -568, -774, -861, -730, -510, -414, -369, -165, 47, 20, 2, 209, 287, 99, -79, 
-	-124, -202, -255, -180, -159, -269, -332, -344, -307, -165, -10, -1, -90, -125, -122, -85, 
-	-8, 84, 23, -135, -215, -176, -104, -93, -168, -283, -284, -173, -62, -23, -67, -114, 
-	-117, -66, 8, 63, 52, -33, -99, -114, -111, -75, -10, -11, -50, -49, -41, -40
-};
-
-static const short ugen_H30e180a1c[] = { 
-	-4, 1, 0, 6, -4, 6, -15, 12, -19, 23, -32, 44, 24, 2248, 5868, 1154, 
-	-5507, -3289, 557, 3467, 7942, 5771, 755, 2947, 4744, -18, -4003, -3005, -2877, -4335, -3565, -2354, 
-	-2119, -1107, -317, -29, 691, 1249, 1544, 1279, 1113, 1004, 479, 139, 334, -83, -946, -1476, 
-	-1586, -1269, -1100, -722, -309, -254, -350, -189, 149, 471, 662, 634, 332, -30, -49, -61, 
-	-321, -568, -774, -861, -730, -510, -414, -369, -165, 47, 20, 2, 209, 287, 99, -79, 
-	-124, -202, -255, -180, -159, -269, -332, -344, -307, -165, -10, -1, -90, -125, -122, -85, 
-	-8, 84, 23, -135, -215, -176, -104, -93, -168, -283, -284, -173, -62, -23, -67, -114, 
-	-117, -66, 8, 63, 52, -33, -99, -114, -111, -75, -10, -11, -50, -49, -41, -40
-};
-
-static const short ugen_H40e000a0c[] = { 
-	2, -4, -2, 3, 7, -4, 13, -39, 44, -85, 115, -156, 212, -43, 3990, 5091, 
-	320, -8033, -13664, 2198, 10875, 13926, 13642, 1536, -4032, 846, 2378, -3449, -5202, -6534, -4785, -3082, 
-	-3495, -1932, -1841, -357, 1669, 1891, 2484, 2445, 2289, 1970, 950, 405, 126, -1597, -1088, -573, 
-	-2111, -1789, -947, -642, -354, 63, 389, 450, 304, 412, 836, 1225, 964, 454, 95, -365, 
-	-799, -1141, -1479, -1505, -1380, -1304, -1172, -787, -37, 322, 240, 254, 416, 247, 113, 123, 
-	-7, -160, -216, -319, -427, -306, -212, -321, -412, -358, -309, -181, 10, 140, 85, 51, 
-	56, 35, 54, 47, -47, -224, -274, -241, -202, -174, -172, -162, -163, -134, -55, -41, 
-	-61, -57, -72, -95, -68, -59, -71, -76, -69, -66, -100, -131, -123, -70, -43, -28
-};
-
-static const short ugen_H40e000a1c[] = { 
-	2, -4, -2, 3, 7, -4, 13, -39, 44, -85, 115, -156, 212, -43, 3990, 5091, 
-	320, -8033, -13664, 2198, 10875, 13926, 13642, 1536, -4032, 846, 2378, -3449, -5202, -6534, -4785, -3082, 
-	-3495, -1932, -1841, -357, 1669, 1891, 2484, 2445, 2289, 1970, 950, 405, 126, -1597, -1088, -573, 
-	-2111, -1789, -947, -642, -354, 63, 389, 450, 304, 412, 836, 1225, 964, 454, 95, -365, 
-	-799, -1141, -1479, -1505, -1380, -1304, -1172, -787, -37, 322, 240, 254, 416, 247, 113, 123, 
-	-7, -160, -216, -319, -427, -306, -212, -321, -412, -358, -309, -181, 10, 140, 85, 51, 
-	56, 35, 54, 47, -47, -224, -274, -241, -202, -174, -172, -162, -163, -134, -55, -41, 
-	-61, -57, -72, -95, -68, -59, -71, -76, -69, -66, -100, -131, -123, -70, -43, -28
-};
-
-static const short ugen_H40e006a0c[] = { 
-	0, 1, -2, -1, 0, 9, -6, 18, -36, 36, -72, 92, -113, 155, -67, 2939, 
-	4646, 948, -5928, -12729, -1351, 8446, 12208, 14283, 4584, -2967, -37, 1901, -2104, -3529, -5409, -5174, 
-	-3325, -3047, -2155, -2225, -851, 1166, 1282, 1991, 2421, 2090, 2059, 1653, 848, 277, -1501, -1230, 
-	-594, -1921, -1643, -935, -606, -265, 8, 138, 332, 289, 288, 977, 1406, 714, 61, 114, 
-	-214, -822, -1105, -1332, -1306, -1084, -950, -917, -915, -407, 208, 239, 92, 196, 165, 0, 
-	-1, 20, -122, -201, -246, -381, -376, -259, -187, -296, -381, -313, -178, -61, 59, 125, 
-	97, 42, 28, 45, 18, -42, -148, -221, -234, -183, -176, -193, -168, -150, -133, -101, 
-	-82, -74, -51, -31, -30, -65, -99, -87, -66, -67, -42, -70, -130, -150, -120, -80
-};
-
-static const short ugen_H40e006a1c[] = { 
-	-5, -2, -3, 17, -19, 34, -66, 68, -105, 123, -155, 184, -172, 2890, 6498, 1692, 
-	-6251, -16401, -2197, 12139, 14263, 17037, 4112, -5401, -1080, 2976, -2477, -5483, -7012, -5998, -2621, -3630, 
-	-2804, -1635, -688, 1367, 1999, 2790, 2605, 2338, 2289, 1273, 224, 180, -1103, -1656, -726, -1800, 
-	-2051, -1210, -671, -380, -85, 325, 586, 273, 403, 619, 835, 1494, 1073, 50, -303, -535, 
-	-1015, -1521, -1729, -1704, -1723, -1304, -736, -246, 202, 524, 473, 459, 385, 259, 202, 35, 
-	-137, -274, -389, -430, -309, -295, -322, -400, -430, -360, -182, 8, 171, 161, 86, 50, 
-	8, 58, 69, -23, -241, -348, -309, -234, -174, -179, -185, -155, -116, -53, -27, -35, 
-	-37, -63, -88, -79, -95, -104, -75, -83, -102, -123, -118, -93, -60, -36, -11, -5
-};
-
-static const short ugen_H40e013a0c[] = { 
-	0, 2, 1, -2, -3, 4, 1, 1, 5, -19, 17, -44, 66, -82, 110, 98, 
-	3099, 3799, 509, -6399, -10673, 149, 7062, 11500, 12662, 3370, -1789, 895, 1062, -1995, -3106, -5207, 
-	-4682, -2906, -2700, -2281, -2032, -452, 839, 1081, 1928, 2146, 1971, 1992, 1592, 965, -60, -1552, 
-	-796, -747, -1741, -1310, -775, -387, -218, -120, 0, 235, 121, 296, 1055, 1214, 461, -115, 
-	-86, -184, -692, -1119, -1188, -1001, -915, -831, -746, -762, -430, 21, 197, 47, -10, -23, 
-	-44, -37, -78, -110, -164, -270, -312, -262, -254, -233, -236, -319, -334, -177, -8, 86, 
-	100, 68, 19, 15, 39, 16, -61, -152, -195, -186, -172, -190, -200, -199, -165, -132, 
-	-93, -99, -65, -11, -1, -22, -79, -119, -99, -46, -46, -51, -71, -109, -133, -143
-};
-
-static const short ugen_H40e013a1c[] = { 
-	-3, -8, 24, -21, 37, -56, 41, -61, 57, -47, 31, -29, 1566, 7117, 3705, -4168, 
-	-17427, -8251, 12468, 14880, 18935, 8671, -5632, -3853, 3074, -1374, -5703, -6942, -7548, -2934, -2805, -3332, 
-	-2219, -928, 1408, 1806, 2723, 3086, 2415, 2346, 1652, 387, 78, -757, -1706, -1049, -1763, -2114, 
-	-1431, -860, -397, 22, 222, 642, 453, 188, 239, 475, 1822, 1560, 206, -268, -440, -754, 
-	-1305, -1808, -2165, -2174, -1298, -606, -536, -39, 697, 776, 619, 460, 256, 270, 147, -88, 
-	-310, -440, -471, -373, -297, -266, -395, -526, -439, -186, 28, 158, 238, 175, 103, -4, 
-	15, 85, 21, -207, -417, -415, -305, -191, -179, -214, -154, -106, -66, -17, -2, 1, 
-	-16, -56, -103, -120, -123, -94, -113, -135, -119, -90, -77, -70, -35, 0, 12, 1
-};
-
-static const short ugen_H40e019a0c[] = { 
-	-3, 0, 0, 1, -1, -2, 4, 0, 0, 3, -17, 12, -33, 49, -63, 81, 
-	88, 2533, 3354, 838, -5143, -9156, -962, 5150, 10133, 11507, 3981, -450, 822, 924, -1316, -2584, 
-	-4661, -4201, -2580, -2666, -2299, -1798, -672, 364, 893, 1651, 1945, 1930, 1899, 1586, 920, -128, 
-	-1144, -517, -620, -1339, -1051, -694, -535, -431, -234, -188, 0, 15, 279, 958, 958, 322, 
-	-43, -78, -85, -553, -1030, -997, -822, -790, -772, -662, -622, -477, -211, 47, 49, -91, 
-	-217, -176, -25, -83, -196, -155, -200, -242, -190, -212, -255, -261, -245, -246, -154, -23, 
-	49, 72, 61, 17, -11, -5, -2, -44, -110, -168, -183, -196, -219, -204, -194, -175, 
-	-138, -77, -69, -44, 0, -8, -36, -81, -122, -116, -59, -22, -31, -78, -122, -135
-};
-
-static const short ugen_H40e019a1c[] = { 
-	-11, 22, -15, 27, -38, 13, -28, 6, 27, -63, 85, 854, 7102, 5577, -2631, -18277, 
-	-12814, 12114, 16650, 20206, 11253, -4371, -5426, 1674, -320, -6189, -7341, -8419, -3834, -2262, -3016, -2260, 
-	-1689, 1292, 2359, 2611, 2934, 2803, 2564, 1659, 470, 47, -464, -1678, -1290, -1918, -2166, -1546, 
-	-1051, -548, 112, 487, 726, 659, -60, -175, 386, 1730, 1737, 439, -348, -404, -505, -1059, 
-	-1897, -2578, -2310, -1131, -648, -767, -140, 800, 1045, 770, 484, 276, 302, 184, -63, -325, 
-	-451, -532, -449, -265, -222, -402, -557, -490, -236, 24, 208, 301, 226, 155, 55, 32, 
-	64, 31, -189, -422, -478, -397, -273, -228, -215, -172, -143, -79, 20, 45, 43, 31, 
-	-30, -93, -113, -129, -150, -176, -129, -74, -65, -94, -84, -38, 1, 17, 4, 17
-};
-
-static const short ugen_H40e026a0c[] = { 
-	-2, -2, 0, 0, 1, -1, -1, 5, -2, 4, -2, -6, 2, -15, 30, -38, 
-	45, 192, 2398, 2885, 693, -4992, -7814, -910, 4486, 9657, 10011, 3712, 201, 935, 801, -1080, 
-	-2416, -4208, -3513, -2415, -2622, -2117, -1623, -774, 170, 854, 1571, 1864, 1688, 1628, 1557, 961, 
-	-154, -759, -187, -540, -1134, -1020, -842, -701, -451, -422, -374, 25, -43, 266, 959, 750, 
-	160, 132, 136, -174, -613, -905, -884, -751, -729, -706, -681, -576, -377, -250, -87, -31, 
-	-114, -286, -230, -35, -107, -230, -157, -127, -204, -186, -191, -255, -244, -197, -139, -124, 
-	-77, 49, 80, 48, -16, -47, -12, 8, -31, -133, -185, -179, -194, -223, -211, -168, 
-	-149, -99, -50, -54, -33, -27, -18, -31, -77, -120, -109, -61, -38, -27, -84, -140
-};
-
-static const short ugen_H40e026a1c[] = { 
-	7, 4, 0, 5, -43, 45, -93, 147, -205, 280, -102, 5487, 7682, 1309, -15046, -20191, 
-	6636, 17637, 20792, 16251, -1249, -6151, -118, 592, -5348, -7368, -9578, -5676, -2038, -2956, -2056, -1757, 
-	141, 2078, 3132, 3056, 2397, 2894, 2190, 699, -142, -188, -1214, -1413, -2068, -2275, -1585, -1397, 
-	-764, -34, 490, 929, 1008, -347, -241, 597, 949, 1652, 965, -372, -593, -214, -717, -2011, 
-	-2616, -2136, -1134, -823, -997, -355, 806, 1198, 767, 491, 356, 355, 288, -13, -353, -487, 
-	-523, -456, -306, -250, -344, -517, -511, -310, -56, 155, 330, 295, 195, 81, 32, 110, 
-	66, -143, -397, -479, -449, -359, -276, -278, -253, -187, -99, 8, 74, 79, 53, -4, 
-	-68, -82, -130, -182, -185, -138, -66, -71, -100, -92, -57, -30, -1, 6, 6, 28
-};
-
-static const short ugen_H40e032a0c[] = { 
-	0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 4, -15, 24, 
-	-35, 38, 114, 1842, 2627, 1123, -3624, -7082, -2111, 3268, 8197, 9233, 4411, 857, 938, 938, 
-	-654, -1862, -3450, -3130, -2301, -2530, -1990, -1578, -1056, -10, 805, 1223, 1368, 1501, 1733, 1769, 
-	1123, 125, -305, -95, -575, -1147, -1114, -983, -917, -647, -484, -321, -92, -196, 319, 926, 
-	616, 231, 358, 230, -252, -606, -796, -840, -759, -707, -731, -681, -459, -320, -313, -239, 
-	-109, -110, -240, -198, -141, -151, -172, -132, -144, -215, -228, -196, -161, -183, -196, -148, 
-	-64, -21, 5, 21, -2, -16, -30, -29, -24, -74, -138, -174, -166, -187, -216, -201, 
-	-147, -96, -69, -55, -68, -52, -34, -22, -30, -73, -113, -111, -88, -73, -56, -81
-};
-
-static const short ugen_H40e032a1c[] = { 
-	21, -18, 34, -73, 79, -132, 179, -230, 302, -339, 3805, 8514, 4429, -11156, -24455, 438, 
-	17830, 20969, 19797, 2016, -5968, -1455, 1628, -4783, -7721, -9805, -8093, -2630, -2680, -2071, -1687, 107, 
-	1776, 2698, 3691, 2640, 2558, 2305, 1307, -111, -378, -971, -1140, -2065, -2763, -1513, -1437, -1162, 
-	-118, 597, 964, 1041, -262, -8, 710, 540, 1388, 1006, -371, -824, -232, -591, -2123, -2458, 
-	-1551, -1083, -1110, -842, -304, 560, 1072, 861, 528, 272, 360, 426, 56, -347, -483, -599, 
-	-518, -282, -218, -307, -512, -462, -296, -106, 111, 330, 333, 197, 93, 28, 108, 119, 
-	-48, -336, -486, -468, -370, -295, -331, -349, -254, -124, 19, 74, 70, 87, 28, -53, 
-	-86, -127, -143, -113, -102, -108, -107, -90, -87, -71, -60, -27, 1, 14, 38, 49
-};
-
-static const short ugen_H40e039a0c[] = { 
-	2, 0, 0, -1, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 2, -7, 
-	12, -17, 22, 158, 1694, 2357, 1063, -3389, -6418, -2079, 3009, 7631, 8302, 4149, 1114, 1063, 
-	875, -486, -1601, -2970, -2683, -2210, -2385, -1781, -1504, -994, -94, 442, 987, 1436, 1635, 1849, 
-	1900, 1108, 82, -225, -258, -753, -1092, -1240, -1297, -854, -465, -515, -335, -132, -154, 457, 
-	990, 546, 234, 368, 185, -317, -672, -780, -862, -786, -700, -645, -581, -417, -320, -338, 
-	-236, -112, -97, -192, -148, -148, -199, -151, -159, -232, -242, -211, -167, -145, -141, -142, 
-	-99, -20, -12, -32, -15, 0, -14, -48, -69, -70, -80, -135, -153, -151, -182, -190, 
-	-175, -106, -64, -59, -61, -68, -53, -38, -30, -42, -74, -117, -115, -99, -92, -79
-};
-
-static const short ugen_H40e039a1c[] = { 
-	-12, 38, -67, 48, -75, 66, -53, 36, -42, 1142, 7774, 7585, -2977, -24236, -12508, 15270, 
-	19489, 22774, 9314, -4367, -3297, 1444, -1738, -7264, -9569, -10258, -4733, -3234, -2309, -1434, -940, 1695, 
-	2715, 3592, 2835, 2870, 2589, 1405, 384, -147, -881, -1165, -1492, -2956, -2049, -1392, -1431, -526, 
-	463, 1010, 844, 176, 365, 489, 295, 1183, 1214, -182, -1025, -606, -617, -1806, -2176, -1258, 
-	-1115, -1319, -662, -56, 235, 572, 778, 756, 376, 214, 353, 178, -112, -314, -634, -709, 
-	-375, -161, -213, -424, -436, -342, -191, 71, 334, 338, 169, 93, 33, 71, 115, 41, 
-	-196, -417, -454, -402, -305, -338, -385, -311, -183, -38, 42, 61, 78, 62, -42, -107, 
-	-120, -105, -51, -57, -106, -130, -103, -79, -98, -99, -55, -1, 27, 31, 45, 42
-};
-
-static const short ugen_H40e045a0c[] = { 
-	0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, -1, 
-	-7, 8, -9, 5, 189, 1551, 2121, 1052, -3160, -5947, -2048, 2791, 7128, 7526, 3892, 1317, 
-	1140, 833, -333, -1334, -2526, -2329, -2113, -2160, -1525, -1571, -1281, -235, 587, 1123, 1510, 1773, 
-	1959, 1728, 703, -40, -242, -371, -818, -1395, -1391, -1035, -687, -515, -459, -230, -250, -19, 
-	810, 878, 293, 232, 347, 47, -405, -707, -882, -909, -692, -571, -614, -569, -395, -312, 
-	-264, -202, -120, -65, -123, -119, -170, -264, -232, -224, -272, -250, -208, -165, -129, -69, 
-	-59, -82, -60, -21, -18, -34, -26, -57, -91, -105, -85, -85, -127, -144, -154, -159, 
-	-161, -130, -89, -77, -59, -63, -64, -75, -67, -49, -55, -79, -118, -129, -133, -110
-};
-
-static const short ugen_H40e045a1c[] = { 
-	9, -10, -27, 25, -74, 124, -189, 263, -166, 5521, 9204, 3117, -18822, -22425, 9177, 19346, 
-	21552, 15347, -655, -3696, 541, 809, -6291, -9056, -10629, -7343, -4049, -3703, -1622, -1192, 865, 2611, 
-	4192, 3424, 2548, 2948, 2075, 534, -273, -399, -1195, -1323, -2759, -2594, -1526, -1632, -844, 311, 
-	813, 538, 735, 930, 209, 165, 1055, 1163, 84, -946, -1240, -1206, -1476, -1558, -1160, -1162, 
-	-1107, -616, 103, 406, 266, 286, 618, 617, 243, 87, 125, 94, -136, -480, -708, -576, 
-	-249, -145, -271, -367, -382, -223, 35, 295, 357, 176, 13, -19, 18, 103, 61, -121, 
-	-334, -403, -377, -309, -309, -376, -324, -226, -124, -5, 52, 52, 26, -67, -126, -114, 
-	-63, -44, -56, -91, -101, -75, -87, -125, -136, -93, -25, 35, 45, 30, 36, 18
-};
-
-static const short ugen_H40e051a0c[] = { 
-	0, 1, 0, 0, 0, -1, 0, 1, 0, 0, -2, 0, -2, 0, 4, -3, 
-	0, -8, 10, -14, 8, 121, 1206, 1899, 1377, -2222, -5599, -2710, 1940, 6197, 7059, 4103, 
-	1675, 1166, 916, -14, -838, -1942, -2012, -1825, -2092, -1873, -1622, -1029, -80, 664, 1183, 1561, 
-	1583, 1559, 1309, 456, 26, -215, -723, -1018, -1082, -1204, -1026, -552, -335, -432, -354, -47, 
-	270, 665, 596, 216, 162, 206, -47, -469, -793, -879, -754, -579, -555, -633, -508, -301, 
-	-245, -224, -159, -83, -32, -69, -158, -240, -336, -336, -268, -267, -266, -236, -134, -32, 
-	-13, -53, -86, -52, -12, -23, -63, -76, -101, -119, -110, -106, -105, -107, -111, -119, 
-	-126, -122, -118, -101, -72, -56, -65, -91, -98, -74, -60, -65, -91, -127, -152, -144
-};
-
-static const short ugen_H40e051a1c[] = { 
-	33, -75, 75, -115, 133, -150, 174, -246, 1817, 8482, 8395, -6721, -27584, -6239, 18715, 19356, 
-	19567, 6177, -2451, -1325, 2473, -2022, -8978, -10534, -9020, -5134, -5191, -2888, -1875, -591, 1968, 3826, 
-	4453, 2975, 3327, 2494, 1278, 168, -254, -1136, -1113, -2008, -3177, -2044, -1749, -1244, -167, 499, 
-	334, 967, 1362, 410, 154, 700, 1099, 486, -491, -1449, -1869, -1411, -1122, -1072, -1194, -954, 
-	-557, -81, 406, 430, 147, 215, 506, 367, 84, 52, 115, -50, -258, -485, -605, -444, 
-	-170, -125, -314, -377, -238, -30, 194, 337, 259, 20, -67, -58, 23, 91, -5, -235, 
-	-397, -361, -282, -237, -298, -317, -263, -198, -70, 50, 36, -1, -75, -143, -114, -59, 
-	-37, -70, -92, -89, -53, -56, -99, -122, -119, -65, 7, 50, 50, 38, 29, -15
-};
-
-static const short ugen_H40e058a0c[] = { 
-	0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -2, 6, 4, 
-	-2, -1, -4, 6, -10, 6, 167, 1153, 1757, 1316, -2358, -5338, -2408, 2072, 6056, 6404, 
-	3678, 1708, 1196, 887, 130, -590, -1517, -1859, -2087, -2064, -1431, -1131, -729, 89, 764, 1061, 
-	1169, 1202, 1219, 892, 363, -179, -605, -532, -679, -1103, -1162, -639, -356, -448, -341, -142, 
-	10, 293, 538, 293, 100, 122, 18, -273, -542, -682, -756, -670, -563, -548, -509, -360, 
-	-251, -213, -157, -106, -55, -54, -129, -226, -325, -380, -332, -286, -315, -271, -135, -47, 
-	-35, -35, -30, -31, -40, -38, -56, -97, -101, -128, -150, -141, -110, -72, -64, -81, 
-	-111, -109, -107, -104, -92, -84, -71, -68, -84, -105, -101, -85, -83, -99, -147, -159
-};
-
-static const short ugen_H40e058a1c[] = { 
-	2, -39, 38, -90, 142, -209, 290, -347, 4718, 9928, 4822, -18953, -24086, 9852, 20063, 18975, 
-	13742, 1017, -1574, 974, 2766, -5382, -10532, -10724, -6903, -4958, -4899, -2682, -2297, 246, 2559, 4986, 
-	3797, 3281, 3797, 2152, 590, 53, -325, -1521, -1450, -2651, -2810, -2228, -1700, -579, -1, 2, 
-	802, 1759, 664, 298, 753, 761, 658, 52, -1042, -2251, -1843, -988, -898, -1062, -938, -561, 
-	-165, 223, 403, 393, 137, 160, 182, 130, 118, 103, -72, -185, -255, -434, -498, -299, 
-	-61, -183, -371, -316, -94, 112, 290, 313, 71, -99, -112, -78, 34, 55, -95, -347, 
-	-397, -304, -175, -182, -261, -258, -240, -151, -1, 60, -22, -84, -152, -151, -83, -43, 
-	-70, -108, -99, -71, -60, -70, -78, -79, -77, -37, 18, 44, 50, 37, -4, -54
-};
-
-static const short ugen_H40e064a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -2, 0, -1, 8, 
-	1, -1, -1, -2, 6, -8, 14, 145, 1010, 1604, 1413, -2043, -5142, -2487, 1854, 5635, 
-	5902, 3487, 1859, 1297, 1027, 433, -429, -1569, -1708, -1495, -1470, -1051, -841, -657, -205, 380, 
-	643, 755, 874, 887, 504, -34, -4, -146, -386, -599, -904, -831, -560, -319, -281, -375, 
-	-230, 75, 266, 183, 80, 69, -61, -227, -262, -333, -599, -721, -614, -458, -403, -395, 
-	-290, -225, -168, -82, -116, -138, -113, -184, -307, -334, -332, -385, -362, -263, -154, -107, 
-	-73, -19, 7, 11, -13, -50, -72, -95, -109, -135, -179, -168, -106, -58, -49, -50, 
-	-70, -88, -79, -92, -110, -103, -70, -45, -70, -109, -130, -115, -101, -96, -112, -138
-};
-
-static const short ugen_H40e064a1c[] = { 
-	-49, 47, -77, 67, -61, 36, -50, 696, 7554, 10137, -3402, -27925, -10261, 19675, 18094, 16860, 
-	7244, -485, -508, 3662, 1052, -8568, -10841, -9407, -5954, -5743, -3337, -3072, -2466, 803, 3509, 4827, 
-	3212, 4313, 3618, 1808, 609, 167, -1044, -1439, -1865, -3070, -2700, -2360, -1236, -505, -405, 373, 
-	1586, 1259, 310, 819, 911, 605, 244, -519, -1857, -2295, -1316, -908, -765, -841, -606, -189, 
-	78, 207, 422, 361, 58, -29, -139, 34, 203, 28, -256, -207, -218, -373, -360, -98, 
-	-32, -249, -353, -245, -19, 238, 330, 176, -98, -204, -190, -66, 68, -18, -252, -410, 
-	-328, -197, -89, -162, -221, -214, -186, -85, 20, -8, -86, -146, -182, -141, -102, -81, 
-	-101, -125, -125, -95, -76, -63, -43, -20, -30, -16, 11, 29, 24, 0, -55, -74
-};
-
-static const short ugen_H40e071a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 
-	11, -3, 2, -5, 3, -2, 8, 0, 256, 1091, 1609, 1076, -2899, -4907, -1511, 2672, 
-	5694, 5103, 2940, 1798, 1424, 874, 42, -461, -960, -1084, -1142, -1144, -946, -1004, -943, -418, 
-	203, 378, 538, 575, 316, 340, 487, 149, -186, -143, -435, -928, -673, -266, -431, -502, 
-	-335, -143, 78, 127, -59, -49, -51, -169, -198, -193, -337, -607, -607, -444, -362, -358, 
-	-313, -251, -190, -111, -146, -195, -177, -177, -240, -311, -324, -387, -381, -279, -211, -155, 
-	-97, -17, 11, 17, 4, -34, -75, -118, -129, -150, -164, -162, -129, -73, -60, -44, 
-	-48, -64, -66, -88, -107, -97, -73, -67, -73, -94, -134, -147, -138, -117, -95, -93
-};
-
-static const short ugen_H40e071a1c[] = { 
-	-60, 72, -122, 150, -191, 229, -351, 2107, 9241, 8877, -11719, -28529, 2101, 21374, 16085, 14202, 
-	4140, -511, 410, 5309, -1478, -10006, -9973, -8076, -6380, -5814, -2593, -3471, -1948, 925, 4136, 3962, 
-	3068, 4968, 3367, 1591, 975, 403, -1545, -1536, -1905, -3093, -3135, -2081, -931, -993, -365, 977, 
-	1496, 737, 502, 1123, 824, 420, -23, -1062, -2121, -1829, -1061, -932, -678, -562, -325, -72, 
-	143, 257, 367, 195, 32, -202, -298, 25, 220, -40, -281, -181, -225, -315, -199, 31, 
-	-60, -254, -296, -181, 29, 252, 297, 77, -205, -258, -208, -36, 47, -79, -346, -406, 
-	-215, -94, -80, -163, -152, -172, -143, -36, 13, -73, -123, -143, -166, -158, -137, -106, 
-	-109, -143, -140, -105, -76, -38, 2, 15, -4, 12, 23, 14, -5, -34, -66, -60
-};
-
-static const short ugen_H40e077a0c[] = { 
-	0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, -2, 2, 
-	2, 8, -4, 6, -8, 13, 0, 17, -24, 377, 1171, 1642, 547, -3653, -4389, -407, 
-	3322, 5307, 4374, 2581, 1573, 1228, 973, 617, 72, -444, -790, -1146, -1240, -1373, -1379, -1124, 
-	-562, -56, 97, 87, 215, 784, 796, 437, 253, 279, -92, -629, -574, -579, -696, -599, 
-	-378, -340, -176, 73, -98, -280, -68, 10, -192, -217, -166, -275, -442, -465, -395, -319, 
-	-282, -258, -225, -200, -176, -226, -239, -209, -201, -251, -331, -338, -310, -311, -294, -206, 
-	-105, -27, 12, 15, -5, -32, -59, -113, -157, -154, -130, -131, -136, -108, -71, -50, 
-	-45, -37, -49, -69, -78, -88, -85, -82, -76, -86, -126, -156, -155, -124, -92, -56
-};
-
-static const short ugen_H40e077a1c[] = { 
-	-44, 53, -102, 147, -209, 281, -438, 3391, 10350, 6477, -18605, -24450, 11016, 19795, 14069, 11853, 
-	3060, -383, 1676, 5819, -4029, -10224, -8505, -7116, -7192, -5436, -2573, -3966, -1386, 1473, 4090, 2851, 
-	3385, 4948, 3036, 1784, 1475, 346, -1522, -1251, -2155, -3170, -3150, -1956, -1143, -1195, -133, 1040, 
-	1139, 451, 721, 1272, 631, 285, -296, -1361, -1946, -1330, -940, -950, -552, -319, -158, -48, 
-	217, 289, 206, 20, -24, -327, -407, 19, 239, -94, -273, -149, -192, -235, -53, 94, 
-	-89, -232, -207, -134, 36, 245, 205, -56, -258, -257, -216, -30, 18, -170, -392, -317, 
-	-137, -44, -69, -140, -114, -124, -93, -20, -21, -116, -126, -141, -156, -180, -157, -142, 
-	-151, -152, -140, -104, -66, -16, 31, 27, 10, 36, 47, 4, -36, -55, -63, -45
-};
-
-static const short ugen_H40e084a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, -1, 
-	0, 3, 2, -2, -1, 0, 20, 0, -15, 42, 759, 1423, 1538, -1349, -4778, -2460, 
-	1728, 4202, 4579, 3210, 1843, 1686, 1937, 1259, 517, -28, -484, -1164, -1517, -1468, -1654, -1498, 
-	-1113, -454, -250, -314, 449, 995, 813, 680, 684, 392, 62, -102, -578, -987, -898, -599, 
-	-500, -440, -277, -126, -85, -210, -101, -5, -155, -241, -127, -87, -248, -430, -461, -333, 
-	-250, -259, -274, -238, -234, -264, -267, -220, -204, -252, -299, -299, -274, -306, -315, -256, 
-	-147, -42, -1, -10, -39, -48, -76, -110, -131, -144, -136, -128, -120, -115, -103, -74, 
-	-51, -46, -47, -53, -69, -97, -99, -87, -91, -105, -123, -143, -155, -131, -94, -58
-};
-
-static const short ugen_H40e084a1c[] = { 
-	-31, 33, -74, 117, -182, 256, -399, 3957, 10783, 4618, -21523, -20512, 14444, 17758, 12637, 10866, 
-	3106, -204, 2710, 5547, -5507, -9736, -7327, -6704, -7492, -5169, -2935, -4252, -1314, 1845, 4056, 2061, 
-	3537, 4813, 2614, 1935, 1942, 208, -1376, -629, -2147, -3477, -2949, -1696, -1630, -1318, 83, 791, 
-	684, 339, 928, 1121, 493, 298, -414, -1418, -1641, -952, -958, -921, -417, -209, -173, -29, 
-	259, 244, 109, -91, -115, -415, -418, 5, 225, -114, -280, -104, -142, -166, 20, 98, 
-	-106, -197, -161, -127, 43, 226, 113, -169, -271, -235, -215, -23, -13, -231, -394, -247, 
-	-110, -46, -44, -112, -113, -105, -54, -25, -64, -122, -110, -154, -174, -174, -164, -181, 
-	-191, -167, -138, -95, -55, -18, 18, 20, 21, 41, 47, 14, -38, -70, -64, -36
-};
-
-static const short ugen_H40e090a0c[] = { 
-	0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-	0, 0, 7, -1, 2, -2, 33, -4, 0, -47, 458, 1238, 1717, 61, -4153, -3681, 
-	669, 3390, 4132, 3403, 2557, 2261, 2340, 1749, 765, -11, -438, -979, -1721, -1655, -1617, -1829, 
-	-1512, -636, -561, -378, 700, 1029, 899, 958, 896, 337, 327, 224, -751, -1287, -953, -597, 
-	-634, -510, -362, -257, -91, 30, -9, -116, -169, -187, -80, -38, -132, -366, -465, -351, 
-	-250, -261, -284, -234, -283, -311, -266, -208, -186, -244, -273, -262, -259, -263, -273, -262, 
-	-187, -77, -30, -45, -55, -73, -97, -90, -69, -108, -148, -126, -89, -89, -105, -88, 
-	-54, -54, -51, -47, -61, -86, -102, -91, -91, -103, -104, -118, -130, -113, -76, -53
-};
-
-static const short ugen_H40e090a1c[] = { 
-	-25, 28, -62, 101, -160, 230, -371, 3808, 10794, 4047, -21673, -18316, 14725, 15868, 11337, 10812, 
-	3693, 165, 3415, 5385, -6134, -9254, -6246, -6405, -7438, -4985, -3396, -4631, -1433, 1733, 3814, 1834, 
-	3436, 4581, 2415, 1929, 2038, 260, -995, -76, -1856, -3323, -2848, -1620, -1828, -1531, -9, 428, 
-	197, 241, 972, 891, 396, 378, -333, -1265, -1340, -680, -877, -873, -310, -140, -214, -91, 
-	271, 208, 35, -148, -216, -466, -400, -19, 150, -100, -214, -82, -101, -85, 68, 98, 
-	-89, -181, -159, -101, 44, 175, 55, -208, -305, -220, -171, -32, -36, -231, -367, -243, 
-	-99, -31, -34, -82, -99, -98, -38, -17, -71, -125, -96, -154, -184, -163, -156, -194, 
-	-210, -186, -137, -76, -43, -28, 0, 7, 22, 60, 59, 31, -11, -47, -59, -40
-};
-
-static const short ugen_H40e096a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, -1, 
-	0, -2, 2, -5, 4, -5, 29, -3, -7, -46, 328, 1168, 1785, 608, -3751, -4427, 
-	-1, 3244, 4182, 3760, 3020, 2460, 2408, 1774, 648, -9, -622, -1122, -1652, -1783, -1777, -1896, 
-	-1472, -1053, -605, 265, 635, 837, 1298, 1241, 657, 469, 552, -75, -1011, -1284, -904, -732, 
-	-693, -604, -514, -281, 43, 218, 69, -115, -143, -122, -119, -68, -113, -338, -463, -376, 
-	-287, -269, -260, -263, -321, -340, -259, -197, -180, -197, -264, -304, -226, -187, -231, -249, 
-	-207, -149, -119, -87, -104, -131, -85, -38, -55, -109, -132, -107, -81, -79, -81, -80, 
-	-84, -80, -73, -70, -72, -91, -110, -109, -92, -87, -98, -100, -95, -78, -71, -77
-};
-
-static const short ugen_H40e096a1c[] = { 
-	-33, 35, -71, 105, -155, 210, -359, 2991, 10319, 5260, -19410, -19018, 12463, 14962, 10484, 11481, 
-	4491, 537, 3428, 5759, -5509, -9212, -5715, -6082, -7263, -5013, -3458, -5055, -1842, 1412, 3407, 1737, 
-	3311, 4544, 2343, 1993, 1858, 225, -643, 341, -1564, -2921, -2535, -1760, -1910, -1543, -288, -46, 
-	-119, 202, 846, 663, 375, 450, -158, -985, -1166, -627, -742, -792, -288, -124, -240, -132, 
-	228, 152, 21, -155, -245, -467, -399, -84, 71, -60, -167, -64, -88, -50, 70, 112, 
-	-60, -184, -177, -100, 31, 126, 39, -185, -296, -232, -164, -35, -36, -198, -341, -266, 
-	-131, -30, -24, -90, -84, -92, -39, -10, -58, -121, -106, -140, -173, -167, -154, -184, 
-	-207, -188, -158, -94, -45, -30, -18, -7, 14, 66, 80, 41, 0, -30, -39, -33
-};
-
-static const short ugen_H40e103a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 
-	2, 0, 0, -8, 6, 3, 25, -7, -2, -42, 433, 1315, 1985, 197, -4542, -4385, 
-	567, 3790, 4653, 4192, 2962, 2082, 2185, 1464, 294, -224, -735, -1380, -1798, -1677, -1850, -1738, 
-	-1403, -1160, -73, 584, 602, 993, 1441, 1141, 656, 685, 220, -632, -1079, -1034, -931, -835, 
-	-693, -719, -513, -159, 148, 242, 134, 16, -27, -80, -187, -181, -155, -287, -497, -456, 
-	-279, -230, -271, -300, -331, -306, -218, -182, -162, -184, -280, -269, -179, -151, -194, -233, 
-	-222, -198, -159, -166, -177, -107, -13, -30, -94, -104, -83, -66, -74, -70, -61, -60, 
-	-87, -104, -91, -91, -93, -106, -107, -97, -84, -74, -81, -74, -64, -58, -71, -75
-};
-
-static const short ugen_H40e103a1c[] = { 
-	-35, 37, -70, 91, -122, 150, -258, 1733, 9104, 7499, -14808, -20992, 7665, 14449, 9676, 12562, 
-	5763, 910, 3014, 6306, -3587, -9309, -5633, -5735, -7000, -5331, -3247, -5223, -2656, 834, 2987, 1714, 
-	2729, 4738, 2563, 1978, 1750, 237, -600, 619, -1029, -2496, -2251, -1737, -1819, -1710, -525, -479, 
-	-517, 114, 714, 466, 279, 546, 81, -643, -1030, -661, -624, -724, -276, -163, -251, -163, 
-	184, 82, -11, -129, -212, -414, -439, -143, 2, -25, -146, -59, -64, -64, 41, 119, 
-	-28, -171, -188, -134, -20, 99, 45, -146, -246, -220, -196, -57, -11, -157, -314, -285, 
-	-162, -76, -28, -101, -95, -86, -37, -3, -54, -114, -110, -128, -163, -164, -153, -168, 
-	-188, -185, -178, -125, -63, -40, -38, -26, 9, 67, 87, 50, 0, -18, -10, -12
-};
-
-static const short ugen_H40e109a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-	0, 4, -3, -4, 0, 13, 18, -9, -12, 45, 816, 1940, 1846, -2307, -5816, -2235, 
-	2678, 4639, 4946, 3860, 2380, 2018, 1691, 516, -132, -621, -1241, -1666, -1784, -1756, -1602, -1385, 
-	-1558, -455, 668, 512, 851, 1463, 1222, 788, 967, 533, -565, -1104, -929, -852, -1005, -873, 
-	-802, -679, -327, 12, 117, 173, 286, 225, 75, -53, -191, -328, -290, -322, -502, -528, 
-	-324, -220, -303, -335, -305, -213, -160, -138, -185, -251, -205, -171, -144, -160, -198, -234, 
-	-252, -222, -244, -256, -156, -26, -31, -93, -100, -61, -37, -55, -60, -53, -46, -64, 
-	-84, -115, -118, -120, -127, -124, -113, -72, -66, -69, -58, -51, -56, -64, -49, -51
-};
-
-static const short ugen_H40e109a1c[] = { 
-	-24, 14, -35, 29, -27, 5, -15, 356, 6495, 9781, -6838, -21910, -1104, 13222, 8813, 13481, 
-	8472, 1198, 2281, 6413, 6, -8742, -6141, -5288, -6659, -5894, -3154, -4738, -3837, -136, 2228, 1983, 
-	1760, 4447, 3283, 2085, 1623, 518, -621, 417, -256, -1889, -2011, -1774, -1344, -1759, -1064, -738, 
-	-906, -208, 501, 375, 130, 534, 439, -227, -844, -766, -481, -700, -354, -189, -260, -152, 
-	78, 33, -60, -87, -152, -285, -444, -231, -33, -7, -137, -102, -69, -71, -40, 93, 
-	26, -156, -184, -162, -96, 27, 75, -68, -193, -177, -189, -123, -16, -100, -251, -298, 
-	-203, -143, -79, -113, -115, -91, -54, 0, -33, -100, -103, -123, -165, -151, -139, -143, 
-	-162, -174, -195, -159, -106, -72, -65, -40, 1, 60, 86, 45, 0, 8, 21, 0
-};
-
-static const short ugen_H40e116a0c[] = { 
-	0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 
-	0, 2, -5, -2, -1, 16, 1, 4, -29, 376, 1626, 2435, -427, -5363, -4333, 1173, 
-	4427, 5236, 4285, 2638, 2157, 2135, 971, -205, -671, -1210, -1729, -1941, -1657, -1590, -1384, -1352, 
-	-940, 402, 699, 749, 1355, 1378, 943, 937, 762, -152, -948, -1107, -888, -887, -949, -984, 
-	-834, -392, -131, -3, 80, 227, 363, 318, 104, -8, -148, -394, -447, -441, -491, -499, 
-	-412, -329, -330, -300, -208, -143, -113, -160, -211, -178, -135, -128, -150, -166, -228, -261, 
-	-267, -306, -276, -168, -84, -91, -115, -96, -55, -26, -39, -58, -50, -26, -37, -80, 
-	-106, -112, -126, -131, -142, -144, -114, -63, -37, -51, -62, -67, -50, -39, -40, -52
-};
-
-static const short ugen_H40e116a1c[] = { 
-	0, -15, 7, -27, 46, -82, 118, -189, 3543, 9849, 1017, -18696, -10015, 9624, 8474, 12882, 
-	12067, 2127, 1286, 5737, 3359, -6640, -7005, -4959, -6276, -6316, -3649, -3841, -4628, -1200, 1306, 2126, 
-	1281, 3545, 3824, 2416, 1666, 764, -300, -79, 226, -1282, -1795, -1818, -1121, -1388, -1485, -1018, 
-	-1057, -568, 219, 313, 79, 421, 661, 166, -592, -825, -455, -612, -534, -243, -235, -131, 
-	-23, -23, -84, -37, -109, -165, -366, -290, -58, 15, -118, -161, -114, -102, -88, 31, 
-	73, -131, -189, -153, -137, -59, 67, 6, -132, -145, -135, -165, -79, -47, -159, -274, 
-	-247, -197, -132, -121, -138, -116, -83, -8, 0, -59, -108, -122, -165, -134, -112, -121, 
-	-134, -156, -188, -178, -138, -109, -86, -50, -4, 49, 75, 34, 20, 35, 37, 6
-};
-
-static const short ugen_H40e122a0c[] = { 
-	0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 
-	1, -3, -1, -2, 10, 1, 1, -10, 235, 1562, 2645, -65, -5072, -4817, 542, 4482, 
-	5628, 4456, 2459, 1958, 2206, 1312, 47, -584, -1417, -2103, -2188, -1851, -1684, -1286, -1110, -1073, 
-	304, 952, 753, 1294, 1457, 1078, 982, 829, 5, -880, -1059, -861, -894, -980, -1018, -959, 
-	-517, -158, -79, -31, 152, 347, 352, 208, 156, 92, -155, -403, -569, -570, -487, -479, 
-	-529, -500, -350, -158, -78, -128, -169, -97, -65, -114, -132, -116, -166, -215, -232, -328, 
-	-357, -256, -142, -119, -144, -161, -124, -68, -25, -14, -56, -53, -25, -13, -47, -102, 
-	-126, -116, -99, -126, -159, -142, -83, -41, -35, -51, -82, -66, -25, -16, -49, -92
-};
-
-static const short ugen_H40e122a1c[] = { 
-	9, -23, 11, -27, 29, -39, 37, -78, 743, 6772, 7870, -8977, -16904, 453, 7591, 10332, 
-	15688, 6142, -16, 3818, 5907, -1831, -7352, -5164, -5562, -6418, -4822, -3138, -4578, -2770, 153, 1684, 
-	1373, 2091, 3901, 2910, 1886, 1088, 347, -451, 279, -410, -1567, -1754, -1195, -962, -1469, -1358, 
-	-1255, -872, -204, 172, 48, 266, 708, 586, -123, -727, -564, -497, -669, -410, -271, -149, 
-	-86, -87, -156, -19, 10, -77, -221, -296, -89, 21, -61, -210, -202, -179, -123, -42, 
-	59, -70, -177, -146, -142, -132, -15, 43, -33, -86, -113, -163, -128, -33, -62, -195, 
-	-273, -247, -186, -130, -186, -170, -111, -31, 13, -20, -93, -124, -139, -126, -99, -92, 
-	-95, -133, -171, -182, -153, -148, -124, -75, -16, 19, 29, 44, 60, 56, 40, 18
-};
-
-static const short ugen_H40e129a0c[] = { 
-	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 1, 0, 
-	0, -3, -2, 2, 8, -2, -4, 118, 1361, 2810, 526, -4636, -5338, -311, 4279, 5950, 
-	4847, 2527, 1823, 2197, 1424, 98, -387, -1107, -2063, -2452, -2215, -1913, -1555, -1021, -960, -134, 
-	1036, 1091, 1259, 1395, 1094, 1104, 921, 210, -658, -1082, -971, -755, -853, -1110, -1056, -592, 
-	-223, -199, -107, 85, 262, 342, 209, 159, 203, 39, -151, -394, -607, -606, -531, -551, 
-	-626, -544, -285, -83, -116, -124, -36, -2, -33, -91, -108, -163, -203, -264, -339, -310, 
-	-238, -190, -178, -164, -151, -139, -120, -67, -25, -24, -45, -37, -22, -41, -74, -118, 
-	-119, -109, -108, -142, -141, -87, -55, -50, -79, -80, -60, -41, -26, -43, -78, -108
-};
-
-static const short ugen_H40e129a1c[] = { 
-	2, -1, -14, 2, -15, 20, -45, 62, -106, 2881, 8742, 1428, -14923, -9436, 3777, 7589, 
-	15515, 12067, 983, 1200, 5775, 2945, -5260, -6059, -4888, -6026, -5679, -3579, -3755, -3911, -1050, 851, 
-	1541, 1245, 3066, 3423, 2094, 1334, 971, -235, -120, 298, -1156, -1675, -1380, -875, -1224, -1380, 
-	-1482, -1142, -426, -88, -8, 129, 606, 789, 335, -389, -642, -511, -624, -557, -411, -261, 
-	-128, -119, -182, -112, 71, 8, -79, -238, -145, 3, 11, -195, -284, -228, -176, -101, 
-	-6, -27, -145, -142, -144, -171, -114, 15, 18, -32, -96, -143, -152, -58, -19, -111, 
-	-243, -264, -229, -179, -191, -217, -151, -77, -14, -26, -72, -106, -114, -119, -100, -81, 
-	-72, -113, -152, -170, -157, -157, -161, -112, -51, -17, -8, 39, 77, 76, 54, 22
-};
-
-static const short ugen_H40e135a0c[] = { 
-	0, 0, 0, 0, 0, -1, -1, 0, 1, 0, -1, -1, 0, 2, 0, -1, 
-	-5, -2, -4, 9, -4, 2, 63, 1234, 2958, 879, -4463, -5675, -840, 4222, 6326, 5193, 
-	2558, 1734, 2203, 1541, 18, -552, -1044, -1942, -2337, -2284, -2137, -1919, -1202, -840, -498, 832, 
-	1450, 1448, 1469, 1075, 1071, 904, 357, -369, -1087, -1135, -734, -653, -1015, -1142, -674, -200, 
-	-222, -201, -22, 187, 294, 181, 138, 190, 116, -40, -206, -409, -545, -592, -631, -680, 
-	-642, -416, -267, -176, -46, 3, 31, 4, 0, -48, -139, -225, -322, -322, -247, -193, 
-	-222, -243, -197, -163, -152, -133, -93, -60, -44, -31, -31, -25, -41, -84, -114, -109, 
-	-101, -131, -149, -125, -79, -35, -45, -97, -123, -80, -30, -21, -50, -97, -109, -92
-};
-
-static const short ugen_H40e135a1c[] = { 
-	5, 5, -6, -6, -7, 2, -1, -3, -1, 217, 4492, 8146, -3448, -14465, -5787, 3294, 
-	11051, 16797, 7436, -461, 2628, 5811, 491, -5784, -5175, -4955, -5831, -4843, -3287, -3972, -2778, -338, 
-	1026, 1216, 1547, 3331, 2648, 1489, 1444, 658, -423, 431, -200, -1408, -1479, -1159, -955, -1307, 
-	-1411, -1500, -766, -184, -220, -78, 439, 819, 669, 201, -351, -600, -597, -562, -508, -509, 
-	-265, -170, -144, -143, -66, 30, 66, -28, -188, -74, 23, -45, -256, -278, -226, -158, 
-	-88, -30, -68, -119, -147, -178, -187, -87, 20, 15, -42, -102, -139, -109, -16, -17, 
-	-119, -241, -250, -208, -174, -211, -200, -148, -92, -43, -46, -77, -86, -66, -72, -81, 
-	-76, -69, -108, -140, -142, -145, -161, -140, -95, -69, -40, 31, 86, 96, 88, 61
-};
-
-static const short ugen_H40e141a0c[] = { 
-	0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -6, 
-	0, -6, 10, -7, 8, 98, 1531, 3239, 296, -5247, -5577, -194, 5000, 6938, 5101, 2162, 
-	1718, 2311, 1363, -270, -803, -1310, -2168, -2389, -2177, -2067, -1952, -1301, -762, -683, 469, 1607, 
-	1809, 1670, 1067, 1052, 840, 262, -339, -1047, -1249, -872, -524, -801, -1066, -709, -131, -89, 
-	-195, -61, 98, 183, 107, 103, 159, 128, -11, -219, -355, -362, -433, -644, -754, -698, 
-	-541, -319, -171, -115, -40, 26, 90, 70, -4, -96, -258, -314, -247, -193, -222, -252, 
-	-220, -187, -217, -215, -140, -83, -50, -42, -49, -40, -13, -20, -64, -118, -127, -121, 
-	-136, -147, -128, -72, -26, -24, -68, -106, -101, -60, -28, -45, -88, -112, -101, -104
-};
-
-static const short ugen_H40e141a1c[] = { 
-	8, 2, 1, -9, -3, -2, 2, -9, 13, -48, 938, 6205, 5941, -7884, -12810, -3577, 
-	5414, 15057, 14417, 3191, -418, 4070, 4938, -1936, -5747, -4570, -4982, -5486, -4048, -3353, -3685, -1685, 
-	65, 1077, 993, 2196, 3077, 1723, 1558, 1360, 75, 39, 415, -735, -1356, -1436, -1016, -1154, 
-	-1438, -1410, -1158, -476, -180, -219, 75, 728, 804, 475, 138, -315, -660, -667, -455, -509, 
-	-538, -289, -170, -135, -156, -82, -1, 79, -47, -135, -52, 3, -90, -235, -242, -208, 
-	-148, -86, -27, -79, -154, -201, -218, -183, -54, 4, -29, -72, -91, -123, -78, -7, 
-	-33, -133, -222, -235, -198, -174, -201, -199, -180, -118, -63, -60, -72, -48, -51, -64, 
-	-70, -76, -89, -120, -134, -140, -144, -143, -131, -123, -74, 3, 75, 96, 89, 79
-};
-
-static const short ugen_H40e148a0c[] = { 
-	2, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 2, 0, 0, -6, 0, 
-	-10, 8, -6, 11, 66, 1503, 3505, 520, -5485, -5984, -389, 5235, 7517, 5452, 2031, 1650, 
-	2473, 1459, -419, -1039, -1459, -2297, -2517, -2270, -2094, -1904, -1320, -610, -592, -86, 1257, 1998, 
-	1906, 1167, 1074, 866, 246, -169, -949, -1493, -1113, -505, -669, -942, -664, -176, -35, -20, 
-	31, 0, 70, 82, 43, 100, 117, -4, -226, -386, -337, -347, -543, -687, -786, -597, 
-	-257, -169, -194, -160, 5, 105, 74, 18, -98, -208, -191, -183, -243, -262, -233, -209, 
-	-222, -247, -233, -177, -108, -51, -38, -42, -34, -24, -19, -41, -88, -124, -156, -168, 
-	-169, -135, -80, -42, -47, -60, -64, -61, -55, -71, -82, -84, -81, -90, -134, -167
-};
-
-static const short ugen_H40e148a1c[] = { 
-	0, 9, 0, 0, -11, -2, -3, 0, -9, 13, -27, 1862, 7098, 3032, -10291, -11227, 
-	-1826, 8857, 16388, 10778, 915, 267, 4992, 3479, -3491, -5218, -4115, -4939, -5056, -3515, -3418, -3036, 
-	-1075, 241, 926, 1181, 2597, 2184, 1494, 1759, 855, 116, 345, 60, -879, -1415, -1318, -1058, 
-	-1400, -1469, -1199, -797, -420, -170, -80, 329, 751, 668, 420, 153, -352, -736, -625, -398, 
-	-451, -496, -371, -228, -155, -179, -136, -60, 20, -53, -54, -3, -18, -105, -159, -169, 
-	-191, -161, -66, -40, -136, -213, -236, -246, -186, -63, -41, -45, -49, -100, -130, -47, 
-	14, -29, -138, -216, -226, -170, -159, -206, -231, -203, -115, -67, -68, -65, -40, -38, 
-	-38, -60, -105, -132, -123, -121, -136, -129, -137, -151, -101, -27, 41, 79, 77, 76
-};
-
-static const short ugen_H40e154a0c[] = { 
-	0, -1, -1, -1, 1, 1, 0, -1, 0, 1, 1, 0, 0, -6, 2, -9, 
-	9, -8, 18, 120, 1951, 3860, -328, -6611, -5847, 652, 6345, 8227, 5213, 1470, 1716, 2724, 
-	1230, -823, -1342, -1850, -2587, -2627, -2330, -2218, -1868, -1151, -379, -285, -109, 1074, 1912, 1957, 
-	1254, 994, 780, 262, -112, -914, -1577, -1410, -759, -635, -764, -557, -157, 103, 164, 177, 
-	103, 28, -10, 59, 137, 28, -157, -312, -358, -330, -384, -612, -819, -684, -305, -147, 
-	-218, -255, -132, 27, 55, -2, -78, -67, -32, -98, -208, -248, -239, -226, -245, -268, 
-	-274, -234, -169, -118, -63, -30, -24, -25, 1, 6, -32, -91, -132, -138, -168, -200, 
-	-171, -102, -65, -69, -66, -60, -29, -8, -49, -91, -102, -94, -89, -114, -150, -135
-};
-
-static const short ugen_H40e154a1c[] = { 
-	-2, 1, 9, 0, 0, -12, 0, -7, 3, -8, 8, 7, 2094, 6952, 2087, -10420, 
-	-10991, -1040, 10392, 15613, 9104, 403, 466, 5110, 2758, -3611, -4607, -3690, -4737, -4698, -3248, -3252, 
-	-2664, -1021, 109, 844, 1478, 2158, 1568, 1737, 1638, 789, 386, 265, -4, -892, -1396, -1299, 
-	-1221, -1497, -1475, -926, -543, -443, -204, 176, 436, 522, 638, 524, 128, -373, -600, -520, 
-	-353, -344, -475, -539, -395, -249, -239, -221, -206, -62, 27, 51, 45, -3, -69, -44, 
-	-50, -160, -199, -113, -73, -164, -243, -298, -349, -232, -58, -36, -67, -77, -92, -79, 
-	8, 25, -56, -150, -174, -171, -161, -178, -209, -217, -186, -124, -111, -110, -56, -2, 
-	-10, -44, -85, -135, -160, -134, -108, -94, -109, -141, -122, -57, 1, 32, 38, 46
-};
-
-static const short ugen_H40e161a0c[] = { 
-	-2, -1, 0, 0, 1, 0, -2, 0, 0, 3, -1, 1, -9, 3, -11, 10, 
-	-12, 24, 91, 1969, 4251, -141, -7146, -6400, 692, 6833, 8914, 5604, 1251, 1580, 2952, 1340, 
-	-1042, -1564, -2065, -2841, -2747, -2433, -2331, -1945, -1151, -268, -18, -80, 859, 1860, 2048, 1303, 
-	887, 739, 216, -21, -617, -1548, -1638, -1012, -798, -797, -501, -134, 73, 270, 405, 207, 
-	38, 64, 161, 101, -46, -175, -376, -407, -351, -411, -778, -930, -586, -200, -91, -190, 
-	-151, -44, 12, -18, -97, -86, 32, 16, -140, -194, -165, -204, -291, -310, -275, -268, 
-	-250, -177, -113, -77, -36, -6, 0, 9, 27, -9, -86, -117, -138, -166, -181, -174, 
-	-156, -127, -81, -64, -69, -48, -7, 0, -41, -86, -109, -104, -111, -119, -104, -116
-};
-
-static const short ugen_H40e161a1c[] = { 
-	-4, 0, 1, 6, 0, 0, -15, 3, -12, 8, -17, 16, 79, 2756, 6877, 69, 
-	-11303, -9764, 1241, 11833, 14306, 7081, -299, 1243, 5156, 1484, -3800, -3920, -3474, -4662, -4204, -2993, 
-	-3121, -2327, -908, 140, 1013, 1530, 1541, 1479, 1912, 1435, 860, 384, 252, -139, -1006, -1370, 
-	-1360, -1298, -1588, -1310, -667, -431, -392, -90, 304, 383, 505, 660, 458, -40, -281, -306, 
-	-417, -367, -374, -489, -629, -583, -422, -296, -264, -243, -76, 82, 156, 72, 7, 22, 
-	64, -26, -165, -191, -141, -130, -215, -312, -383, -364, -218, -86, -53, -50, -60, -68, 
-	-44, 16, 19, -62, -142, -157, -154, -155, -165, -177, -200, -183, -146, -135, -113, -47, 
-	5, -16, -68, -124, -153, -147, -120, -82, -67, -94, -109, -87, -38, 0, 12, 15
-};
-
-static const short ugen_H40e167a0c[] = { 
-	-3, -2, 0, 1, -2, -2, -1, 0, 2, -3, -1, -11, 2, -14, 10, -19, 
-	25, 164, 2557, 4641, -1282, -8487, -6152, 2068, 8240, 9579, 5089, 635, 1846, 3225, 936, -1595, 
-	-1861, -2449, -3227, -2829, -2500, -2491, -1935, -977, -53, 225, 110, 873, 1853, 2066, 1413, 812, 
-	417, 122, -125, -624, -1363, -1640, -1271, -969, -833, -558, -163, 119, 323, 433, 364, 153, 
-	229, 320, 78, -127, -248, -356, -401, -460, -723, -960, -794, -455, -288, -250, -71, 96, 
-	108, 10, -126, -109, 51, 78, -103, -206, -148, -119, -226, -335, -364, -337, -303, -226, 
-	-150, -98, -85, -67, -17, 17, 46, 29, -26, -90, -120, -131, -156, -180, -182, -180, 
-	-173, -134, -102, -101, -67, -24, -13, -24, -58, -92, -102, -113, -129, -115, -108, -129
-};
-
-static const short ugen_H40e167a1c[] = { 
-	0, -3, 0, 1, 7, -2, 2, -16, 3, -14, 11, -18, 18, 69, 2545, 6496, 
-	189, -10772, -9476, 1430, 11141, 13212, 6878, -175, 1233, 4770, 1424, -3217, -3411, -3137, -4344, -3923, 
-	-2872, -2950, -2268, -1022, 54, 1024, 1159, 1118, 1565, 1883, 1498, 968, 462, 252, -236, -926, 
-	-1378, -1359, -1386, -1546, -1111, -632, -421, -251, 55, 152, 316, 618, 646, 302, -11, 3, 
-	-43, -337, -454, -436, -583, -745, -758, -631, -412, -233, -164, -118, 82, 238, 114, 25, 
-	131, 180, -18, -192, -211, -150, -200, -301, -366, -404, -362, -260, -124, -30, -8, -54, 
-	-86, -37, 44, 30, -50, -127, -152, -141, -117, -128, -167, -198, -187, -150, -143, -125, 
-	-79, -39, -39, -66, -113, -151, -139, -73, -42, -71, -92, -85, -78, -50, -19, -5
-};
-
-static const short ugen_H40e174a0c[] = { 
-	-2, 1, 2, 0, -2, 0, 0, 5, -1, 0, -12, 4, -15, 14, -21, 29, 
-	120, 2509, 5155, -865, -9102, -6998, 1996, 8860, 10379, 5586, 382, 1689, 3585, 1063, -1906, -2142, 
-	-2592, -3554, -3029, -2523, -2632, -2073, -1029, 47, 469, 261, 809, 1706, 2087, 1520, 974, 390, 
-	9, -207, -692, -1175, -1547, -1359, -1168, -939, -604, -239, 34, 246, 402, 351, 393, 451, 
-	343, 68, -51, -128, -317, -424, -621, -873, -919, -698, -564, -441, -260, -48, 157, 159, 
-	29, -52, 86, 130, -19, -138, -159, -152, -174, -234, -306, -369, -389, -339, -238, -128, 
-	-72, -61, -61, -48, 9, 58, 43, -17, -76, -111, -133, -130, -150, -170, -189, -179, 
-	-156, -155, -129, -68, -33, -31, -35, -45, -64, -68, -78, -119, -128, -109, -104, -100
-};
-
-static const short ugen_H40e174a1c[] = { 
-	4, 0, -2, 0, 4, 7, 0, 1, -13, 8, -14, 16, -22, 27, 128, 2870, 
-	6100, -1001, -10755, -8143, 2595, 10898, 12063, 5857, -256, 1729, 4365, 887, -2917, -2900, -2982, -4155, 
-	-3590, -2709, -2785, -2135, -998, 135, 974, 808, 996, 1617, 1892, 1541, 961, 513, 78, -314, 
-	-918, -1355, -1368, -1451, -1331, -1007, -645, -397, -51, 167, 78, 282, 698, 670, 221, 27, 
-	81, 50, -254, -523, -630, -697, -820, -809, -664, -459, -223, -75, -1, 49, 155, 178, 
-	136, 162, 133, -36, -199, -244, -182, -231, -334, -395, -405, -353, -253, -113, -26, -26, 
-	-67, -68, -4, 48, 26, -52, -113, -128, -117, -112, -146, -163, -174, -175, -166, -167, 
-	-150, -93, -53, -49, -65, -96, -121, -100, -38, -56, -102, -95, -79, -81, -70, -40
-};
-
-static const short ugen_H40e180a0c[] = { 
-	0, 2, 0, -4, 0, 0, 6, -3, 1, -15, 4, -16, 12, -21, 25, 77, 
-	2373, 5630, -186, -9568, -8061, 1631, 9439, 11265, 6236, 242, 1427, 3933, 1296, -2228, -2498, -2673, 
-	-3847, -3365, -2562, -2705, -2213, -1121, 30, 734, 474, 819, 1566, 2016, 1617, 1020, 508, -4, 
-	-218, -821, -1219, -1406, -1414, -1236, -1040, -694, -325, 20, 165, 202, 272, 605, 650, 276, 
-	56, 32, 16, -212, -490, -735, -850, -848, -755, -652, -503, -275, -65, 115, 106, 35, 
-	105, 200, 142, 19, -72, -180, -242, -211, -198, -301, -419, -417, -346, -244, -141, -73, 
-	-47, -55, -51, -7, 40, 19, -22, -69, -113, -132, -136, -141, -155, -174, -184, -188, 
-	-184, -151, -87, -52, -59, -55, -56, -73, -76, -61, -91, -114, -101, -108, -103, -72
-};
-
-static const short ugen_H40e180a1c[] = { 
-	0, 2, 0, -4, 0, 0, 6, -3, 1, -15, 4, -16, 12, -21, 25, 77, 
-	2373, 5630, -186, -9568, -8061, 1631, 9439, 11265, 6236, 242, 1427, 3933, 1296, -2228, -2498, -2673, 
-	-3847, -3365, -2562, -2705, -2213, -1121, 30, 734, 474, 819, 1566, 2016, 1617, 1020, 508, -4, 
-	-218, -821, -1219, -1406, -1414, -1236, -1040, -694, -325, 20, 165, 202, 272, 605, 650, 276, 
-	56, 32, 16, -212, -490, -735, -850, -848, -755, -652, -503, -275, -65, 115, 106, 35, 
-	105, 200, 142, 19, -72, -180, -242, -211, -198, -301, -419, -417, -346, -244, -141, -73, 
-	-47, -55, -51, -7, 40, 19, -22, -69, -113, -132, -136, -141, -155, -174, -184, -188, 
-	-184, -151, -87, -52, -59, -55, -56, -73, -76, -61, -91, -114, -101, -108, -103, -72
-};
-
-static const short ugen_H50e000a0c[] = { 
-	5, 2, -27, 35, -71, 105, -152, 206, -54, 3560, 4740, 2369, -8235, -16172, 2341, 12508, 
-	15336, 11783, -650, -2614, 1848, 1808, -3283, -4372, -6524, -4664, -2273, -3452, -2738, -1820, -131, 713, 
-	1932, 2743, 1923, 2096, 2158, 1086, 119, -80, -367, -230, -1665, -2488, -1565, -1429, -789, 167, 
-	277, 64, 672, 810, 621, 169, -178, 378, 626, 157, -161, 88, -133, -576, -689, -906, 
-	-1242, -1496, -1324, -859, -514, -318, -24, 161, 83, 202, 232, 182, 203, 106, -183, -297, 
-	-208, -218, -280, -321, -356, -450, -373, -247, -177, -186, -157, -76, 32, 172, 221, 141, 
-	-12, -64, -89, -106, -140, -239, -279, -228, -170, -131, -132, -122, -109, -123, -98, -63, 
-	-84, -83, -62, -59, -24, -23, -56, -64, -72, -83, -102, -131, -109, -62, -30, -44
-};
-
-static const short ugen_H50e000a1c[] = { 
-	5, 2, -27, 35, -71, 105, -152, 206, -54, 3560, 4740, 2369, -8235, -16172, 2341, 12508, 
-	15336, 11783, -650, -2614, 1848, 1808, -3283, -4372, -6524, -4664, -2273, -3452, -2738, -1820, -131, 713, 
-	1932, 2743, 1923, 2096, 2158, 1086, 119, -80, -367, -230, -1665, -2488, -1565, -1429, -789, 167, 
-	277, 64, 672, 810, 621, 169, -178, 378, 626, 157, -161, 88, -133, -576, -689, -906, 
-	-1242, -1496, -1324, -859, -514, -318, -24, 161, 83, 202, 232, 182, 203, 106, -183, -297, 
-	-208, -218, -280, -321, -356, -450, -373, -247, -177, -186, -157, -76, 32, 172, 221, 141, 
-	-12, -64, -89, -106, -140, -239, -279, -228, -170, -131, -132, -122, -109, -123, -98, -63, 
-	-84, -83, -62, -59, -24, -23, -56, -64, -72, -83, -102, -131, -109, -62, -30, -44
-};
-
-static const short ugen_H50e008a0c[] = { 
-	15, -7, 26, -38, 40, -66, 72, -87, 114, -108, 1574, 4327, 3098, -2291, -14386, -7617, 
-	6913, 13229, 16224, 5950, -1931, -960, 1455, -532, -2124, -4188, -5301, -3055, -3496, -2928, -2164, -1676, 
-	-50, 1242, 1941, 1751, 1893, 1992, 2300, 1309, 342, -215, -667, -1300, -2247, -1688, -1357, -792, 
-	-68, 140, -60, 254, 614, 498, 368, -156, 79, 802, 752, 70, -176, -164, -585, -646, 
-	-663, -1090, -1380, -1246, -765, -512, -465, -178, 223, 98, -157, -81, 72, 123, 150, 15, 
-	-245, -242, -179, -259, -356, -340, -355, -393, -373, -258, -155, -112, -25, 32, 106, 167, 
-	171, 104, -22, -75, -121, -187, -223, -217, -194, -171, -126, -169, -206, -140, -64, -12, 
-	-14, -84, -153, -140, -65, 34, 45, -44, -120, -120, -73, -44, -66, -135, -151, -89
-};
-
-static const short ugen_H50e008a1c[] = { 
-	20, -55, 67, -107, 144, -197, 249, -211, 3353, 5667, 3266, -7422, -19752, 471, 14967, 16582, 
-	13879, -12, -3704, 881, 2444, -3655, -5155, -6819, -5698, -2081, -3139, -2900, -2189, -154, 1025, 1779, 
-	2955, 2351, 2155, 2208, 1287, -7, -302, -472, -74, -1381, -2847, -1972, -1507, -923, 125, 410, 
-	94, 693, 914, 873, 384, -339, 177, 502, 270, 102, 0, -144, -360, -647, -972, -1293, 
-	-1593, -1731, -1211, -356, -146, -288, 65, 393, 428, 356, 343, 266, 144, -100, -352, -391, 
-	-321, -207, -326, -452, -422, -302, -264, -196, -145, -115, -64, 21, 163, 212, 150, 4, 
-	-105, -134, -124, -162, -262, -297, -224, -180, -132, -103, -107, -91, -110, -112, -102, -88, 
-	-39, -55, -85, -42, -19, -52, -83, -92, -110, -123, -99, -49, -33, -27, -29, -30
-};
-
-static const short ugen_H50e016a0c[] = { 
-	-2, 12, -6, 20, -29, 30, -55, 58, -72, 100, -93, 1494, 3677, 2781, -2100, -12221, 
-	-6641, 5239, 11429, 14009, 5813, -669, -226, 1547, -371, -1843, -3559, -4610, -3179, -3250, -2572, -2138, 
-	-1708, -104, 1014, 1468, 1554, 1722, 1881, 2238, 1290, 378, -15, -416, -1200, -1884, -1424, -1222, 
-	-782, -288, -104, -99, 185, 351, 293, 229, -56, 235, 830, 739, 125, -240, -343, -435, 
-	-591, -828, -1070, -1164, -1021, -643, -360, -384, -320, 12, 93, -93, -219, -130, 54, 91, 
-	-5, -163, -232, -247, -258, -313, -412, -407, -310, -280, -238, -156, -61, -2, 35, 99, 
-	120, 129, 85, 8, -81, -120, -151, -226, -234, -215, -186, -152, -147, -162, -131, -66, 
-	-38, -28, -79, -121, -116, -74, 14, 12, -50, -95, -109, -102, -74, -61, -101, -141
-};
-
-static const short ugen_H50e016a1c[] = { 
-	-61, 75, -126, 153, -189, 219, -259, 2630, 6458, 4458, -5160, -22650, -4106, 17042, 17979, 16109, 
-	1250, -4080, -101, 2540, -3138, -6218, -7352, -6658, -2300, -2918, -2637, -2274, -656, 1127, 2042, 2955, 
-	2336, 2528, 2325, 1345, 99, -382, -645, -99, -1055, -2945, -2353, -1705, -1032, -36, 433, 225, 
-	705, 932, 1000, 793, -265, -331, 165, 606, 376, -140, -172, -294, -506, -849, -1259, -1777, 
-	-2219, -1445, -169, -55, -463, 32, 486, 615, 617, 398, 259, 216, -11, -412, -480, -324, 
-	-271, -441, -432, -360, -343, -288, -181, -94, -71, -29, 27, 141, 235, 214, 8, -151, 
-	-190, -180, -180, -272, -314, -273, -227, -124, -70, -92, -95, -100, -103, -101, -74, -41, 
-	-65, -92, -42, -12, -47, -113, -154, -146, -107, -55, -29, -41, -6, 9, -17, -16
-};
-
-static const short ugen_H50e024a0c[] = { 
-	-2, -1, 7, -5, 14, -24, 20, -45, 47, -57, 76, -71, 1300, 3117, 2568, -1604, 
-	-10302, -6234, 3685, 9579, 12277, 5974, 366, 379, 1524, -244, -1450, -2934, -4104, -3072, -2906, -2376, 
-	-2125, -1659, -235, 690, 1147, 1378, 1587, 1649, 1993, 1413, 649, 255, -202, -987, -1632, -1360, 
-	-1226, -922, -502, -205, -124, -107, 91, 351, 253, 32, 363, 817, 666, 182, -161, -437, 
-	-535, -630, -859, -994, -947, -840, -619, -370, -293, -292, -130, 30, -48, -191, -216, -103, 
-	24, -48, -179, -245, -335, -334, -290, -332, -371, -291, -179, -126, -110, -58, -6, 24, 
-	63, 91, 108, 73, -12, -99, -124, -170, -231, -256, -222, -166, -128, -108, -129, -114, 
-	-79, -50, -34, -77, -122, -102, -54, -8, -11, -77, -113, -111, -107, -82, -66, -72
-};
-
-static const short ugen_H50e024a1c[] = { 
-	43, -93, 111, -103, 101, -118, 1518, 6775, 5783, -1653, -23328, -11608, 17403, 19727, 18363, 3842, 
-	-4539, -849, 2762, -2160, -6970, -7904, -8204, -2823, -2688, -2730, -1804, -950, 808, 1987, 3469, 2358, 
-	2286, 2688, 1642, 65, -361, -688, -215, -625, -2972, -2796, -1917, -1068, -149, 271, 217, 877, 
-	1040, 947, 1211, -71, -942, 33, 925, 234, -269, -57, -190, -468, -638, -1230, -1990, -2278, 
-	-1520, -317, -126, -398, 17, 591, 747, 629, 452, 366, 292, 9, -409, -510, -370, -289, 
-	-425, -464, -422, -352, -271, -147, -43, -65, -15, 34, 153, 286, 264, 48, -151, -215, 
-	-234, -224, -250, -336, -328, -264, -142, -57, -79, -81, -116, -107, -50, -10, -47, -110, 
-	-90, -40, 0, -30, -141, -192, -134, -66, -53, -54, -39, 28, 37, -13, -23, -39
-};
-
-static const short ugen_H50e032a0c[] = { 
-	0, -1, 0, 5, -3, 11, -19, 16, -35, 36, -42, 53, -46, 1100, 2647, 2408, 
-	-1073, -8729, -6002, 2400, 8018, 10883, 5995, 1177, 852, 1425, -64, -1072, -2394, -3587, -2826, -2592, 
-	-2250, -2026, -1587, -399, 444, 888, 1066, 1321, 1567, 2004, 1605, 895, 489, 13, -956, -1668, 
-	-1351, -1261, -1010, -591, -401, -369, -156, 193, 335, 333, 183, 329, 792, 723, 111, -287, 
-	-431, -536, -730, -899, -818, -745, -816, -651, -336, -213, -241, -169, -17, -10, -121, -229, 
-	-278, -122, -81, -253, -329, -354, -328, -270, -258, -266, -212, -126, -71, -56, -65, -31, 
-	13, 62, 90, 61, 10, -68, -118, -137, -198, -238, -224, -172, -123, -87, -86, -109, 
-	-92, -89, -67, -44, -66, -106, -106, -59, -31, -36, -101, -140, -109, -90, -74, -54
-};
-
-static const short ugen_H50e032a1c[] = { 
-	-16, -12, 59, -116, 173, 304, 6124, 6990, 2432, -19881, -20993, 13610, 21692, 20204, 8300, -3932, 
-	-2131, 2297, 279, -7113, -8488, -9426, -4707, -2658, -2859, -1688, -1012, 848, 1580, 3568, 2893, 2266, 
-	2558, 1928, 481, -482, -672, -443, -212, -2552, -3297, -2428, -1200, -144, 186, 108, 739, 1335, 
-	1003, 1401, 197, -1243, -120, 1025, 233, -530, -280, -75, -221, -480, -1307, -2228, -2015, -1234, 
-	-623, -367, -361, 66, 669, 758, 560, 474, 422, 330, 129, -357, -606, -490, -246, -286, 
-	-495, -542, -411, -237, -92, -7, -55, -53, 28, 161, 264, 287, 119, -105, -219, -276, 
-	-239, -253, -342, -370, -303, -177, -83, -80, -126, -108, -86, -42, -5, -40, -82, -88, 
-	-67, -47, -42, -141, -169, -93, -75, -69, -57, -27, 8, 6, -18, -12, -5, 0
-};
-
-static const short ugen_H50e040a0c[] = { 
-	0, -1, -1, 0, 3, -2, 9, -16, 14, -29, 28, -37, 42, -32, 920, 2266, 
-	2267, -611, -7510, -5817, 1442, 6793, 9676, 5856, 1794, 1163, 1363, 141, -766, -1949, -3072, -2509, 
-	-2371, -2087, -1857, -1496, -565, 44, 576, 993, 1344, 1570, 1995, 1734, 1024, 512, -23, -1059, 
-	-1696, -1311, -1221, -1175, -860, -372, -290, -171, 262, 511, 407, 97, 381, 799, 479, -80, 
-	-224, -365, -661, -803, -764, -704, -754, -758, -575, -339, -202, -160, -104, -8, -22, -161, 
-	-272, -311, -283, -265, -290, -305, -334, -344, -258, -159, -136, -137, -134, -81, -22, -20, 
-	-18, -2, 30, 39, -14, -75, -125, -158, -166, -167, -184, -189, -140, -77, -47, -80, 
-	-115, -106, -89, -55, -43, -85, -144, -135, -80, -48, -61, -113, -147, -127, -75, -39
-};
-
-static const short ugen_H50e040a1c[] = { 
-	-105, 186, -261, 341, -362, 4206, 7839, 5731, -12114, -28001, 3816, 23100, 20769, 13574, -1333, -2859, 
-	933, 2389, -5236, -8928, -9929, -7015, -3429, -3732, -1568, -1332, 581, 1743, 3404, 3399, 2281, 2879, 
-	2048, 716, -294, -598, -745, -2, -1803, -3497, -2939, -1724, -305, 133, 140, 554, 1359, 1280, 
-	1391, 317, -905, -129, 536, 458, -476, -785, -232, -33, -338, -1293, -2200, -1915, -850, -648, 
-	-681, -303, 205, 531, 497, 573, 600, 407, 317, 239, -260, -643, -503, -281, -264, -404, 
-	-535, -488, -277, -36, 32, -64, -45, 56, 92, 190, 264, 197, -43, -210, -260, -230, 
-	-222, -333, -375, -332, -214, -106, -107, -159, -98, -58, -74, -36, -39, -68, -47, -67, 
-	-97, -96, -118, -112, -75, -67, -72, -39, -11, -10, -38, -49, -8, 9, 16, -2
-};
-
-static const short ugen_H50e048a0c[] = { 
-	0, 1, 0, -1, 0, 3, 0, 8, -10, 14, -23, 25, -33, 41, -24, 807, 
-	1984, 2147, -345, -6677, -5558, 912, 5968, 8629, 5567, 2175, 1374, 1329, 293, -548, -1587, -2525, 
-	-2192, -2158, -1835, -1693, -1628, -838, 16, 653, 1010, 1320, 1526, 1881, 1595, 900, 429, -96, 
-	-1139, -1613, -1306, -1424, -1170, -583, -367, -392, 104, 497, 453, 393, 101, 191, 585, 419, 
-	-135, -318, -341, -627, -776, -696, -682, -698, -672, -518, -321, -157, -46, -33, -50, -89, 
-	-184, -323, -379, -373, -335, -300, -321, -311, -261, -173, -116, -109, -88, -89, -57, 0, 
-	25, 0, -44, -40, -39, -86, -143, -162, -148, -118, -109, -147, -153, -86, -32, -28, 
-	-75, -113, -89, -65, -61, -77, -121, -161, -148, -97, -57, -59, -100, -118, -108, -70
-};
-
-static const short ugen_H50e048a1c[] = { 
-	95, -123, 151, -182, 1533, 7457, 7892, -2339, -27640, -11845, 21198, 21568, 17156, 4124, -2564, -652, 
-	3285, -1407, -9217, -9754, -8607, -4705, -4848, -2787, -1498, -335, 1570, 3222, 4328, 2419, 2985, 2714, 
-	1124, -181, -462, -871, -271, -839, -3185, -3589, -2320, -611, -169, 26, 518, 1247, 1619, 1406, 
-	350, -516, 73, 257, 319, -127, -1011, -691, -130, -241, -1260, -2063, -1687, -719, -580, -667, 
-	-279, 208, 519, 275, 254, 582, 626, 366, 152, -161, -470, -548, -364, -222, -349, -475, 
-	-484, -318, -78, 43, 17, -44, 34, 61, 119, 210, 196, 10, -209, -242, -222, -164, 
-	-259, -351, -331, -257, -137, -111, -153, -102, -63, -88, -74, -71, -75, -53, -64, -119, 
-	-114, -91, -88, -77, -65, -49, -23, 1, 0, -51, -67, -47, -6, 8, 17, -3
-};
-
-static const short ugen_H50e056a0c[] = { 
-	-2, 0, 0, 0, 0, 0, 2, 0, 4, -7, 12, -22, 21, -29, 38, -14, 
-	777, 1795, 2039, -407, -6272, -5107, 895, 5566, 7692, 5080, 2328, 1475, 1272, 425, -380, -1312, 
-	-2012, -1856, -2005, -1777, -1622, -1474, -706, 137, 684, 894, 1154, 1283, 1528, 1373, 803, 316, 
-	-204, -1139, -1706, -1299, -1073, -944, -614, -423, -62, 341, 451, 426, 137, -145, 181, 553, 
-	204, -263, -251, -286, -626, -718, -622, -686, -676, -553, -414, -278, -118, -5, -20, -114, 
-	-158, -247, -390, -380, -364, -402, -375, -264, -190, -204, -174, -114, -77, -42, -23, -16, 
-	-7, 4, -37, -94, -122, -130, -142, -155, -130, -98, -84, -96, -111, -108, -55, -5, 
-	-9, -69, -113, -95, -86, -93, -109, -143, -173, -160, -115, -64, -38, -59, -96, -116
-};
-
-static const short ugen_H50e056a1c[] = { 
-	118, -208, 313, -298, 4807, 8678, 5612, -17049, -26752, 9743, 23820, 18412, 10403, 0, -1283, 1649, 
-	3456, -6411, -10774, -9525, -6008, -5057, -4739, -2265, -1865, 726, 2325, 4743, 3611, 2780, 3484, 2090, 
-	250, -388, -673, -790, -372, -2213, -3704, -3331, -1281, -268, -321, 214, 1010, 1773, 1688, 570, 
-	-237, 56, 291, 339, 28, -894, -991, -460, -398, -1096, -1859, -1650, -819, -443, -388, -243, 
-	35, 503, 357, 14, 205, 637, 534, 167, -84, -324, -507, -464, -234, -256, -410, -466, 
-	-359, -148, 30, 92, 4, -35, 42, 68, 159, 192, 53, -206, -299, -241, -144, -142, 
-	-272, -311, -258, -184, -131, -105, -98, -69, -96, -95, -114, -109, -74, -104, -148, -121, 
-	-59, -61, -87, -70, -38, -24, -5, 21, -6, -53, -74, -57, -9, 13, 1, -50
-};
-
-static const short ugen_H50e064a0c[] = { 
-	-3, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 8, -20, 15, -22, 38, 
-	5, 857, 1707, 1944, -995, -6306, -4247, 1492, 5593, 6819, 4405, 2209, 1465, 1255, 532, -264, 
-	-1137, -1626, -1765, -1867, -1389, -1296, -1245, -645, 187, 547, 547, 822, 1046, 1298, 1143, 703, 
-	221, -544, -1131, -1177, -1043, -1044, -836, -487, -291, 173, 445, 175, -7, 34, 0, 106, 
-	311, 68, -198, -183, -296, -582, -661, -645, -677, -557, -403, -340, -261, -106, -19, -70, 
-	-180, -242, -299, -373, -400, -398, -380, -314, -216, -170, -173, -155, -98, -34, 10, 9, 
-	-31, -58, -62, -97, -153, -187, -167, -128, -114, -92, -74, -71, -84, -89, -65, -19, 
-	10, -17, -85, -137, -129, -107, -105, -124, -170, -185, -159, -105, -50, -24, -49, -96
-};
-
-static const short ugen_H50e064a1c[] = { 
-	-60, 76, -108, 929, 7103, 9084, -1267, -27409, -13328, 21109, 20755, 14960, 5242, -506, -390, 4271, 
-	926, -9705, -10640, -8249, -5231, -5728, -3338, -2788, -1807, 1111, 3440, 4795, 3022, 3864, 3456, 1403, 
-	25, -265, -1021, -525, -1133, -3199, -3887, -2500, -682, -661, -171, 647, 1371, 1858, 1174, 146, 
-	1, 250, 465, 254, -619, -1066, -671, -652, -1090, -1630, -1589, -1092, -560, -199, -36, 31, 
-	247, 447, 125, -41, 295, 563, 268, 12, -200, -442, -495, -273, -162, -334, -462, -390, 
-	-228, -40, 112, 101, -34, -40, 27, 88, 179, 112, -130, -351, -342, -224, -97, -164, 
-	-242, -234, -207, -155, -79, -80, -75, -69, -116, -147, -157, -104, -143, -196, -165, -80, 
-	-49, -84, -77, -32, -30, -29, 11, 21, -17, -49, -69, -49, -19, -10, -53, -75
-};
-
-static const short ugen_H50e072a0c[] = { 
-	-2, -1, 0, 0, 0, 0, -2, 1, -2, 1, -2, 3, -3, -11, 5, 0, 
-	11, 96, 1050, 1748, 1706, -2391, -6434, -2683, 2730, 5837, 5808, 3560, 1897, 1487, 1278, 545, 
-	-315, -1195, -1282, -1418, -1490, -1110, -1149, -1171, -724, 87, 246, 222, 655, 960, 1064, 1053, 
-	438, -165, -189, -576, -1097, -1143, -825, -625, -470, -52, 139, -47, -60, 75, 32, -16, 
-	59, 122, 23, -42, -101, -420, -636, -618, -598, -578, -428, -305, -312, -265, -149, -58, 
-	-136, -234, -282, -353, -403, -350, -283, -342, -327, -202, -136, -134, -109, -53, -13, 6, 
-	-20, -88, -132, -142, -150, -169, -171, -143, -99, -79, -64, -62, -72, -76, -58, -26, 
-	-3, -9, -59, -122, -155, -135, -118, -125, -140, -167, -174, -147, -97, -38, -20, -43
-};
-
-static const short ugen_H50e072a1c[] = { 
-	-162, 266, -414, 2422, 8322, 8439, -9456, -29068, -535, 23265, 18001, 12322, 3084, -770, 634, 5870, 
-	-2141, -10684, -9622, -7193, -5945, -5554, -2507, -3333, -1447, 1138, 4030, 4037, 3059, 4529, 3435, 1124, 
-	167, -35, -1071, -746, -1915, -3620, -3867, -1714, -684, -998, 95, 993, 1529, 1486, 794, 201, 
-	136, 534, 546, -123, -961, -877, -579, -1198, -1547, -1559, -1255, -839, -312, 0, 119, 207, 
-	388, 338, -29, -50, 332, 436, 92, -97, -321, -527, -367, -99, -171, -404, -451, -298, 
-	-152, 36, 142, 96, -47, -35, 7, 114, 169, -11, -272, -413, -338, -217, -127, -160, 
-	-168, -170, -170, -102, -44, -44, -39, -90, -141, -190, -157, -146, -223, -222, -140, -65, 
-	-86, -102, -48, -2, -26, -10, 24, -2, -32, -31, -33, -31, -40, -47, -92, -66
-};
-
-static const short ugen_H50e080a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 3, -2, 5, -4, 11, -18, 11, 0, 
-	28, -41, 401, 1349, 1936, 635, -4739, -5563, -17, 4272, 5764, 4588, 2688, 1587, 1606, 1126, 
-	279, -337, -905, -1006, -1371, -1246, -1067, -1250, -1268, -756, 31, 45, 106, 630, 1073, 824, 
-	577, 668, 310, -198, -644, -1030, -1080, -698, -377, -497, -463, -123, 70, -4, 1, 53, 
-	56, 18, 27, 163, 51, -319, -593, -579, -522, -515, -464, -327, -292, -328, -286, -179, 
-	-85, -171, -297, -384, -335, -256, -242, -301, -369, -276, -150, -85, -73, -67, -52, -46, 
-	-33, -98, -173, -186, -149, -127, -144, -126, -99, -62, -56, -58, -49, -56, -54, -39, 
-	-21, -21, -43, -86, -141, -159, -139, -115, -103, -130, -165, -157, -121, -69, -23, -9
-};
-
-static const short ugen_H50e080a1c[] = { 
-	-158, 275, -429, 3338, 8998, 7070, -14974, -26202, 6650, 21867, 16151, 10935, 2377, -1023, 1821, 6163, 
-	-4150, -10482, -8359, -6624, -6706, -5198, -2490, -3606, -1156, 1391, 3908, 3090, 3332, 4652, 3234, 1335, 
-	629, 31, -790, -866, -2566, -3756, -3429, -1429, -1150, -924, 309, 934, 1408, 1207, 575, 120, 
-	417, 807, 424, -366, -905, -660, -774, -1482, -1648, -1392, -1116, -653, -96, 21, 173, 293, 
-	466, 240, -85, -65, 295, 374, 37, -193, -406, -479, -261, -19, -183, -407, -409, -273, 
-	-111, 71, 145, 75, -46, -21, 22, 125, 102, -92, -329, -423, -338, -212, -144, -151, 
-	-124, -133, -118, -64, -7, -9, -25, -105, -158, -190, -154, -192, -261, -215, -134, -90, 
-	-119, -98, -29, -2, -13, 21, 26, -22, -38, -19, -9, -12, -27, -61, -109, -59
-};
-
-static const short ugen_H50e088a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, -2, 2, -1, 1, -4, 2, -2, -2, 13, 
-	9, -17, 97, 1020, 1760, 1620, -2664, -6265, -2079, 3056, 5223, 4993, 3356, 1905, 1493, 1530, 
-	781, 161, -372, -922, -1313, -1385, -1139, -1301, -1519, -1136, -345, -72, -86, 439, 787, 542, 
-	1005, 1236, 557, 12, -288, -806, -1159, -706, -532, -946, -861, -174, 69, -22, 36, 55, 
-	90, 163, 114, 31, 32, -128, -470, -654, -514, -387, -430, -405, -306, -325, -380, -251, 
-	-140, -181, -282, -324, -280, -226, -202, -287, -351, -281, -155, -88, -69, -69, -95, -104, 
-	-105, -140, -190, -184, -135, -120, -124, -95, -64, -63, -75, -50, -29, -43, -62, -69, 
-	-40, -34, -48, -80, -136, -159, -146, -101, -87, -103, -129, -155, -138, -100, -33, -13
-};
-
-static const short ugen_H50e088a1c[] = { 
-	-132, 232, -371, 3416, 9175, 6282, -16454, -23515, 8095, 19864, 15279, 10899, 2381, -1026, 2562, 5815, 
-	-4643, -9815, -7346, -6289, -6950, -5193, -2884, -3773, -1217, 1465, 3734, 2437, 3164, 4640, 3007, 1470, 
-	1239, 350, -701, -807, -2507, -3865, -3108, -1339, -1600, -882, 316, 763, 1112, 963, 430, 70, 
-	614, 909, 362, -378, -685, -551, -909, -1525, -1610, -1320, -1068, -576, -25, -12, 167, 337, 
-	464, 196, -96, -100, 235, 344, 58, -243, -426, -411, -227, -39, -179, -349, -394, -279, 
-	-120, 77, 122, 42, -25, -1, 37, 107, 53, -132, -336, -415, -363, -221, -133, -155, 
-	-138, -119, -77, -40, 9, 9, -28, -99, -144, -185, -174, -220, -257, -215, -156, -130, 
-	-135, -100, -37, -8, -11, 29, 27, -25, -44, -22, 3, 7, -2, -56, -105, -50
-};
-
-static const short ugen_H50e096a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 2, -2, 0, 0, 0, 21, 
-	0, -1, 25, 888, 1736, 1814, -1975, -6212, -2812, 2551, 4891, 5078, 3782, 2185, 1613, 1595, 
-	880, 282, -265, -776, -1364, -1579, -1324, -1414, -1532, -1261, -371, -124, -114, 343, 337, 813, 
-	1499, 1175, 669, 324, -311, -851, -751, -768, -1104, -1174, -745, -287, -119, 17, 76, 156, 
-	175, 258, 270, 5, -179, -79, -291, -668, -561, -369, -338, -384, -374, -374, -362, -264, 
-	-217, -244, -255, -206, -217, -230, -226, -269, -277, -214, -118, -96, -121, -114, -122, -151, 
-	-175, -190, -169, -136, -127, -121, -97, -57, -41, -49, -69, -48, -24, -44, -67, -74, 
-	-55, -51, -61, -80, -125, -147, -126, -88, -66, -64, -95, -148, -150, -101, -43, -21
-};
-
-static const short ugen_H50e096a1c[] = { 
-	-115, 205, -344, 2757, 8789, 6817, -14557, -22663, 5369, 18015, 15238, 11790, 2946, -890, 2738, 5632, 
-	-3955, -9228, -6661, -5936, -6765, -5335, -3385, -3999, -1563, 1110, 3435, 2362, 2805, 4328, 2994, 1564, 
-	1441, 828, -456, -746, -2123, -3430, -3027, -1589, -1613, -978, -60, 601, 975, 587, 233, 165, 
-	625, 870, 453, -180, -532, -443, -808, -1435, -1553, -1323, -1028, -659, -81, -15, 147, 303, 
-	461, 252, -124, -144, 176, 350, 123, -200, -432, -384, -198, -61, -182, -324, -361, -275, 
-	-160, 38, 110, 39, -12, 20, 39, 85, 44, -107, -323, -408, -359, -243, -134, -147, 
-	-150, -137, -60, -19, 10, 14, -8, -70, -112, -162, -181, -223, -242, -221, -173, -144, 
-	-147, -103, -50, -21, -15, 28, 28, -19, -30, -12, 14, 29, 16, -26, -70, -41
-};
-
-static const short ugen_H50e104a0c[] = { 
-	0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 4, -5, -1, -7, 6, 18, 
-	0, -18, 85, 1020, 1920, 1669, -2858, -6367, -2022, 3101, 5021, 4965, 3764, 2369, 1811, 1593, 
-	511, -145, -383, -919, -1489, -1627, -1566, -1649, -1492, -889, -250, -32, 79, -123, 526, 1548, 
-	1358, 938, 780, 239, -548, -592, -647, -1172, -1418, -991, -528, -457, -222, -59, 151, 342, 
-	302, 223, 227, 110, -126, -233, -390, -536, -568, -421, -308, -355, -426, -414, -326, -285, 
-	-256, -238, -221, -200, -163, -224, -292, -221, -164, -125, -104, -131, -179, -199, -187, -215, 
-	-217, -164, -124, -141, -137, -107, -62, -37, -48, -50, -43, -40, -56, -58, -72, -85, 
-	-81, -69, -63, -86, -120, -143, -119, -67, -30, -42, -98, -148, -150, -93, -41, -39
-};
-
-static const short ugen_H50e104a1c[] = { 
-	-90, 151, -258, 1507, 7477, 8441, -9297, -22742, -1193, 15522, 15679, 13495, 4417, -721, 2262, 5785, 
-	-1890, -8683, -6584, -5408, -6400, -5571, -3646, -4304, -2290, 377, 2851, 2495, 2412, 4071, 3012, 1731, 
-	1512, 1049, -255, -391, -1581, -2904, -2714, -1847, -1662, -1155, -464, 235, 844, 355, -17, 190, 
-	479, 801, 654, 64, -385, -356, -505, -1236, -1464, -1346, -1105, -793, -237, -69, 88, 270, 
-	438, 330, -87, -196, 61, 339, 233, -90, -417, -405, -196, -57, -176, -335, -361, -263, 
-	-201, -34, 74, 59, -1, 12, 35, 52, 62, -53, -259, -388, -355, -266, -172, -150, 
-	-147, -158, -97, -36, 1, 5, 9, -34, -84, -134, -161, -213, -249, -226, -189, -149, 
-	-154, -127, -71, -40, -37, 1, 16, -13, -22, 3, 23, 32, 26, 2, -46, -48
-};
-
-static const short ugen_H50e112a0c[] = { 
-	0, -2, -1, 0, 0, 0, 0, 0, 3, -1, 4, -6, 3, -15, 21, 0, 
-	20, -47, 356, 1472, 2293, 425, -5266, -5637, 473, 4477, 5295, 4614, 3222, 2121, 2103, 1308, 
-	-29, -540, -967, -1338, -1728, -1667, -1644, -1798, -1309, -355, 153, 145, -198, 133, 1403, 1526, 
-	1108, 879, 433, -191, -368, -486, -1101, -1508, -1239, -576, -474, -483, -328, -35, 373, 427, 
-	267, 157, 171, 183, -2, -336, -494, -552, -520, -363, -373, -439, -430, -370, -321, -281, 
-	-214, -172, -216, -222, -213, -216, -182, -144, -80, -90, -130, -176, -224, -269, -284, -239, 
-	-157, -104, -134, -150, -119, -59, -34, -44, -53, -49, -32, -37, -59, -73, -87, -111, 
-	-90, -56, -52, -76, -115, -122, -92, -32, -15, -55, -113, -143, -116, -57, -28, -80
-};
-
-static const short ugen_H50e112a1c[] = { 
-	-26, 31, -43, 319, 5058, 9412, -1701, -20323, -10062, 10389, 15655, 15624, 7197, -273, 1269, 5623, 
-	1256, -7257, -7144, -5052, -5730, -5836, -3848, -4213, -3300, -654, 1875, 2659, 1924, 3644, 3329, 1910, 
-	1562, 1268, -197, -284, -703, -2262, -2423, -1828, -1596, -1474, -877, -129, 574, 192, -200, 133, 
-	252, 612, 886, 369, -232, -277, -150, -872, -1354, -1321, -1177, -966, -481, -183, 11, 219, 
-	355, 379, 6, -183, -41, 269, 296, 68, -306, -439, -233, -43, -151, -330, -354, -299, 
-	-241, -96, 13, 38, 25, 5, 5, 18, 74, 16, -158, -320, -339, -291, -208, -171, 
-	-155, -169, -130, -72, -34, -13, 16, -3, -55, -78, -130, -181, -244, -242, -201, -146, 
-	-136, -146, -110, -61, -53, -26, 1, -6, -19, 11, 38, 35, 38, 19, -41, -36
-};
-
-static const short ugen_H50e120a0c[] = { 
-	-2, 0, 0, 0, 0, 0, -2, 2, 0, 2, -3, 0, -7, 0, 10, 2, 
-	-2, 66, 1043, 2298, 1821, -3384, -6969, -1981, 3827, 5572, 5228, 3719, 2160, 2112, 1924, 491, 
-	-353, -938, -1605, -2095, -1951, -1689, -1825, -1504, -666, 96, 434, 116, -129, 1233, 1769, 1102, 
-	961, 507, -148, -240, -340, -994, -1489, -1371, -723, -427, -423, -454, -303, 288, 500, 266, 
-	124, 119, 162, 163, -71, -316, -507, -576, -424, -423, -496, -476, -443, -378, -264, -174, 
-	-167, -181, -230, -288, -217, -109, -56, -72, -110, -124, -179, -223, -309, -345, -245, -156, 
-	-147, -165, -142, -97, -61, -47, -43, -49, -57, -57, -55, -56, -57, -99, -130, -107, 
-	-72, -51, -57, -70, -92, -81, -46, -39, -57, -103, -138, -112, -57, -36, -70, -132
-};
-
-static const short ugen_H50e120a1c[] = { 
-	29, -54, 89, -154, 2143, 8003, 5633, -12613, -17424, 886, 13439, 17194, 11603, 1413, -1, 4376, 
-	4343, -3791, -7643, -5347, -5000, -5758, -4425, -3750, -3966, -1933, 460, 2468, 1829, 2626, 3561, 2406, 
-	1734, 1435, 102, -536, -135, -1378, -1931, -1775, -1544, -1462, -1338, -602, 251, 107, -399, -47, 
-	204, 337, 820, 722, 63, -252, 52, -315, -1179, -1314, -1117, -1028, -818, -435, -101, 152, 
-	276, 377, 114, -154, -102, 140, 278, 187, -107, -343, -292, -98, -102, -294, -343, -322, 
-	-284, -183, -54, -2, 9, 0, -4, -26, 52, 83, -35, -227, -299, -286, -241, -188, 
-	-193, -179, -144, -97, -79, -68, -9, 12, -28, -36, -85, -150, -208, -236, -211, -149, 
-	-120, -150, -146, -88, -60, -53, -17, -6, -22, -2, 41, 53, 39, 6, -5, -6
-};
-
-static const short ugen_H50e128a0c[] = { 
-	-2, -1, 0, 0, -1, -1, 0, 1, 0, 0, -3, -1, -10, 11, -6, 14, 
-	-9, 764, 2303, 2411, -2363, -7308, -3505, 3348, 5971, 5762, 4052, 2128, 1963, 2049, 707, -222, 
-	-683, -1521, -2259, -2363, -2129, -2047, -1636, -757, 85, 480, 385, -40, 1147, 2004, 1181, 977, 
-	514, -193, -245, -285, -923, -1515, -1452, -795, -334, -411, -446, -341, 173, 528, 290, 100, 
-	40, 80, 97, -38, -124, -307, -462, -385, -453, -612, -564, -482, -466, -357, -150, -44, 
-	-155, -333, -259, -151, -116, -30, -31, -99, -174, -171, -243, -362, -320, -199, -171, -209, 
-	-194, -172, -101, -46, -42, -42, -61, -47, -62, -93, -87, -82, -107, -134, -115, -75, 
-	-60, -65, -70, -64, -34, -18, -43, -81, -125, -154, -126, -64, -34, -59, -123, -157
-};
-
-static const short ugen_H50e128a1c[] = { 
-	11, -15, 15, -22, 252, 4261, 8668, -1118, -16856, -11036, 6189, 16272, 16261, 5983, -514, 2085, 
-	5300, 1313, -6112, -6394, -4575, -5224, -5064, -3703, -3814, -3112, -1054, 1327, 2108, 1671, 2985, 2898, 
-	2216, 1735, 554, -625, -140, -605, -1316, -1303, -1685, -1416, -1412, -1088, -223, -62, -476, -276, 
-	76, 281, 588, 747, 439, -38, 69, 63, -712, -1242, -1071, -930, -964, -771, -395, 31, 
-	186, 279, 187, -107, -135, 4, 218, 243, 70, -175, -241, -162, -106, -219, -331, -309, 
-	-293, -265, -175, -86, -32, -23, -31, -31, 0, 89, 61, -87, -232, -263, -251, -219, 
-	-210, -194, -152, -109, -109, -133, -88, -5, 0, -23, -45, -124, -162, -188, -204, -175, 
-	-132, -129, -146, -122, -90, -77, -41, -16, -24, -26, 17, 51, 22, 3, 34, 39
-};
-
-static const short ugen_H50e136a0c[] = { 
-	0, 0, 0, 0, -1, 0, 1, 0, 1, -3, 0, -10, 8, -7, 18, -19, 
-	659, 2415, 2745, -2161, -7649, -4149, 3330, 6496, 6291, 4212, 1987, 1887, 2100, 663, -366, -701, 
-	-1514, -2237, -2380, -2291, -2361, -2048, -964, 138, 479, 657, 231, 892, 2215, 1569, 926, 443, 
-	-172, -295, -476, -878, -1390, -1587, -1038, -250, -170, -421, -392, 192, 593, 310, 120, 46, 
-	-19, -22, -73, -201, -262, -249, -263, -411, -584, -593, -611, -563, -388, -177, -63, -145, 
-	-238, -208, -152, -61, 8, -52, -136, -155, -211, -314, -324, -234, -197, -228, -210, -180, 
-	-165, -138, -86, -47, -26, -8, -46, -86, -91, -89, -108, -151, -158, -124, -75, -50, 
-	-56, -77, -69, -12, 14, -4, -60, -134, -166, -142, -96, -67, -59, -84, -134, -160
-};
-
-static const short ugen_H50e136a1c[] = { 
-	-9, 12, -17, 22, -59, 892, 5924, 7169, -6408, -16841, -6489, 9973, 17887, 12897, 2385, -146, 
-	3447, 4791, -1104, -6533, -5152, -4407, -5117, -4386, -3404, -3541, -2444, -354, 1616, 1583, 1785, 2784, 
-	2623, 2353, 1174, -298, -454, -199, -732, -648, -1397, -1700, -1291, -1280, -680, -404, -694, -402, 
-	17, 94, 495, 675, 495, 234, 211, 202, -337, -861, -904, -868, -900, -882, -713, -380, 
-	34, 159, 136, -36, -153, -106, 75, 294, 211, -7, -136, -104, -121, -174, -262, -294, 
-	-294, -301, -287, -230, -140, -54, -40, -46, -37, 29, 97, 41, -90, -216, -269, -234, 
-	-179, -190, -183, -150, -119, -141, -145, -89, -20, -12, -35, -78, -128, -138, -175, -184, 
-	-140, -104, -120, -145, -135, -110, -76, -26, -26, -33, -10, 17, 6, 14, 62, 62
-};
-
-static const short ugen_H50e144a0c[] = { 
-	0, 2, -1, -1, 0, 2, 2, 1, -4, 0, -11, 7, -6, 17, -14, 721, 
-	2763, 2896, -2812, -8281, -3909, 4185, 7282, 6608, 3971, 1712, 1957, 2116, 432, -694, -933, -1690, 
-	-2431, -2378, -2228, -2442, -2110, -1085, -30, 364, 830, 593, 810, 2229, 1839, 931, 477, -128, 
-	-386, -642, -966, -1373, -1558, -1188, -392, -45, -266, -298, 186, 630, 412, 178, 37, -76, 
-	-72, -93, -272, -342, -248, -238, -336, -509, -525, -593, -659, -469, -168, -99, -206, -175, 
-	-102, -54, -16, -6, -64, -144, -186, -280, -309, -230, -191, -238, -270, -205, -138, -148, 
-	-146, -105, -85, -38, 5, -17, -75, -92, -90, -105, -142, -178, -167, -106, -42, -48, 
-	-78, -48, 0, 13, 5, -32, -98, -145, -144, -121, -90, -78, -98, -118, -123, -101
-};
-
-static const short ugen_H50e144a1c[] = { 
-	-7, -5, 9, -13, 18, -42, 1528, 6745, 5083, -9287, -15825, -3225, 12753, 17384, 9632, 1025, 
-	496, 3994, 4014, -2576, -6049, -4281, -4326, -4849, -3890, -3123, -3269, -1965, 97, 1454, 1225, 1778, 
-	2567, 2744, 2117, 393, -405, -330, -286, -87, -629, -1784, -1453, -1195, -1002, -699, -963, -779, 
-	-84, 156, 309, 551, 524, 333, 294, 344, -18, -575, -624, -513, -722, -925, -869, -633, 
-	-411, -132, 6, -21, -141, -132, -60, 163, 300, 203, 36, -41, -56, -118, -162, -239, 
-	-298, -342, -352, -331, -256, -158, -92, -63, -27, -23, 42, 99, 50, -91, -215, -231, 
-	-181, -155, -189, -190, -158, -121, -131, -141, -100, -37, -31, -42, -81, -128, -148, -144, 
-	-111, -90, -104, -133, -157, -151, -101, -50, -26, -23, -9, -11, -15, 20, 60, 59
-};
-
-static const short ugen_H50e152a0c[] = { 
-	0, -2, -2, 0, 1, 0, 0, -4, 0, -10, 4, -11, 17, -12, 816, 3167, 
-	3007, -3634, -9012, -3612, 5144, 8181, 6925, 3675, 1468, 2125, 2175, 108, -1073, -1232, -1935, -2614, 
-	-2442, -2251, -2500, -2052, -1000, 26, 251, 683, 923, 788, 1828, 2114, 1195, 406, -70, -294, 
-	-852, -1182, -1268, -1583, -1432, -536, 51, -186, -222, 237, 645, 541, 339, 79, -205, -118, 
-	-35, -235, -385, -359, -392, -456, -444, -443, -610, -670, -440, -218, -125, -97, -166, -143, 
-	22, 120, 24, -136, -210, -251, -271, -229, -235, -287, -283, -227, -176, -186, -169, -119, 
-	-93, -82, -38, -24, -64, -71, -57, -69, -119, -164, -186, -184, -135, -94, -86, -75, 
-	-52, -17, 13, 11, -38, -96, -124, -125, -117, -100, -104, -128, -142, -125, -76, -41
-};
-
-static const short ugen_H50e152a1c[] = { 
-	-15, 2, -11, 12, -19, 23, -15, 1967, 6870, 3515, -10554, -14794, -870, 13979, 15868, 7697, 
-	748, 775, 4197, 3312, -3218, -5259, -3705, -4201, -4566, -3462, -2915, -3097, -1601, 226, 1144, 1004, 
-	1702, 2561, 2740, 1526, 109, -292, -389, 265, 251, -1176, -1758, -1219, -1098, -926, -1088, -1161, 
-	-537, 31, 420, 550, 315, 301, 416, 415, 162, -233, -427, -292, -238, -598, -1008, -933, 
-	-591, -490, -399, -225, -123, -93, -72, 12, 167, 245, 273, 166, 25, -70, -84, -128, 
-	-261, -365, -400, -385, -359, -277, -196, -118, -60, -25, -15, 43, 112, 68, -84, -187, 
-	-194, -160, -169, -193, -186, -155, -110, -115, -136, -109, -45, -44, -68, -92, -130, -136, 
-	-86, -62, -89, -125, -144, -159, -138, -84, -45, -22, 3, -4, -40, -16, 30, 51
-};
-
-static const short ugen_H50e160a0c[] = { 
-	0, -2, 0, 3, 1, 0, -6, 0, -8, 5, -11, 17, -3, 1006, 3704, 2969, 
-	-4862, -9803, -2883, 6473, 9154, 7101, 3201, 1212, 2389, 2245, -311, -1504, -1585, -2299, -2842, -2502, 
-	-2254, -2545, -2044, -857, 222, 396, 722, 1121, 870, 1314, 1944, 1415, 535, 78, -358, -978, 
-	-1241, -1263, -1569, -1539, -810, -43, 17, -97, 220, 587, 660, 535, 157, -183, -153, -16, 
-	-149, -338, -427, -548, -568, -512, -542, -688, -657, -428, -88, 53, -143, -206, -15, 149, 
-	128, 11, -113, -246, -255, -188, -231, -331, -332, -276, -237, -196, -183, -151, -119, -77, 
-	-29, -13, -32, -71, -86, -61, -54, -88, -154, -202, -182, -131, -100, -103, -102, -85, 
-	-36, 16, 16, -35, -91, -118, -109, -79, -68, -97, -134, -142, -129, -84, -36, -63
-};
-
-static const short ugen_H50e160a1c[] = { 
-	0, -13, 2, -11, 12, -21, 25, 5, 2157, 6625, 2573, -10860, -13720, 515, 13828, 14286, 
-	6835, 796, 870, 4200, 2720, -3239, -4421, -3282, -4005, -4258, -3109, -2814, -2924, -1412, 99, 874, 
-	843, 1663, 2534, 2409, 1138, 131, -360, 26, 858, -103, -1442, -1545, -1130, -1018, -1121, -1399, 
-	-1021, -356, 157, 641, 548, 114, 153, 530, 456, -6, -247, -173, -61, -143, -515, -1010, 
-	-1054, -759, -567, -525, -458, -196, -8, 28, 68, 142, 182, 319, 315, 94, -106, -143, 
-	-155, -267, -382, -451, -469, -389, -251, -201, -166, -110, -30, 37, 85, 88, 26, -73, 
-	-144, -169, -182, -199, -197, -161, -130, -125, -121, -118, -98, -62, -84, -97, -83, -112, 
-	-132, -95, -74, -84, -108, -138, -150, -130, -81, -39, -2, -4, -62, -53, 0, 19
-};
-
-static const short ugen_H50e168a0c[] = { 
-	-3, 0, 4, 0, 0, -7, 0, -8, 6, -13, 18, 3, 1259, 4318, 2797, -6313, 
-	-10575, -1886, 8029, 10132, 7104, 2592, 1025, 2749, 2271, -845, -1975, -1925, -2691, -3105, -2590, -2326, 
-	-2551, -1920, -757, 304, 615, 931, 1377, 1192, 839, 1325, 1526, 635, 152, -224, -1098, -1372, 
-	-1175, -1497, -1645, -976, -225, 5, 45, 289, 512, 650, 621, 190, -96, 26, 97, -192, 
-	-387, -429, -518, -616, -694, -750, -847, -737, -323, 73, 36, -123, -57, 112, 180, 144, 
-	35, -146, -199, -130, -211, -365, -355, -308, -334, -304, -220, -178, -166, -85, -16, -42, 
-	-13, 7, -38, -92, -90, -73, -106, -154, -181, -174, -138, -92, -91, -127, -124, -65, 
-	-4, -14, -61, -86, -113, -101, -62, -46, -73, -105, -133, -151, -100, -49, -73, -98
-};
-
-static const short ugen_H50e168a1c[] = { 
-	2, -1, -11, 1, -9, 11, -21, 24, 18, 2107, 6176, 2194, -10381, -12747, 840, 12812, 
-	12991, 6619, 1029, 901, 3987, 2366, -2810, -3669, -2928, -3768, -3943, -2855, -2744, -2765, -1417, -107, 
-	647, 749, 1636, 2319, 2033, 1020, 73, -120, 759, 778, -484, -1316, -1426, -1070, -1063, -1407, 
-	-1479, -786, -184, 286, 584, 418, 150, 222, 492, 406, 10, -115, -40, -2, -172, -538, 
-	-875, -1117, -1030, -669, -489, -508, -299, -13, 161, 162, 123, 156, 298, 353, 134, -144, 
-	-190, -182, -296, -410, -453, -450, -399, -297, -222, -160, -86, -3, 31, 68, 78, 21, 
-	-76, -133, -160, -172, -187, -182, -166, -145, -115, -87, -90, -118, -98, -89, -82, -76, 
-	-115, -153, -126, -75, -43, -67, -120, -149, -118, -64, -38, -28, -66, -85, -33, 5
-};
-
-static const short ugen_H50e176a0c[] = { 
-	0, 6, 0, 0, -7, 0, -8, 8, -14, 21, 12, 1562, 4975, 2548, -7844, -11308, 
-	-783, 9710, 11097, 6973, 1960, 895, 3179, 2285, -1469, -2514, -2274, -3061, -3354, -2688, -2464, -2564, 
-	-1759, -558, 367, 704, 1241, 1628, 1546, 791, 568, 1231, 898, 165, -276, -1090, -1384, -1118, 
-	-1408, -1692, -1141, -351, 0, 96, 281, 469, 605, 619, 168, -45, 243, 247, -160, -397, 
-	-460, -438, -604, -876, -992, -1008, -651, -185, -76, -91, 21, 151, 208, 183, 145, 44, 
-	-16, -40, -160, -328, -358, -334, -361, -383, -358, -271, -208, -135, -41, -22, -24, 14, 
-	28, -2, -70, -112, -105, -115, -172, -194, -166, -108, -74, -91, -129, -139, -71, -35, 
-	-61, -79, -100, -129, -100, -49, -34, -43, -71, -128, -153, -98, -42, -77, -114, -63
-};
-
-static const short ugen_H50e176a1c[] = { 
-	7, 0, 0, -9, 0, -9, 9, -19, 21, 19, 1871, 5605, 2270, -9278, -11977, 247, 
-	11337, 11997, 6761, 1429, 880, 3602, 2263, -2141, -3037, -2624, -3452, -3607, -2749, -2641, -2627, -1561, 
-	-349, 477, 735, 1495, 1960, 1771, 924, 135, 569, 1053, 362, -441, -1154, -1401, -1051, -1212, 
-	-1650, -1363, -528, -36, 250, 365, 360, 382, 518, 299, 123, 194, 132, -42, -195, -339, 
-	-513, -710, -987, -1166, -901, -465, -356, -295, -57, 177, 208, 163, 167, 224, 213, 103, 
-	-86, -218, -258, -319, -388, -420, -423, -390, -314, -214, -121, -61, -21, 5, 60, 59, 
-	-4, -84, -112, -125, -143, -181, -204, -178, -114, -74, -83, -109, -130, -99, -73, -68, 
-	-78, -122, -159, -120, -51, -24, -43, -88, -135, -133, -74, -36, -73, -110, -70, -18
-};
-
-static const short ugen_H60e000a0c[] = { 
-	15, -27, 23, -10, -16, 30, 548, 3877, 4379, 3364, -10239, -11244, 7884, 11167, 8700, 3346, 
-	1359, 2912, 2768, -1089, -5607, -5507, -5369, -2926, -2679, -2735, -1295, -655, 377, 1080, 2017, 1685, 
-	1671, 1402, 1228, 572, -183, 209, 147, 12, -1030, -1846, -2063, -1498, -977, -425, 220, 578, 
-	547, 261, 529, 724, 548, 265, -195, -527, -379, -198, -208, -156, -202, -410, -549, -657, 
-	-543, -683, -1158, -1318, -738, -19, 193, 212, 108, -44, -78, -30, 24, 51, 79, -27, 
-	-258, -428, -407, -184, -82, -138, -280, -422, -402, -310, -137, 80, 87, -33, -134, -113, 
-	32, 125, 10, -113, -134, -115, -54, -32, -67, -146, -234, -260, -208, -99, -51, -119, 
-	-154, -145, -97, -33, 0, -5, -39, -90, -63, 11, 25, -13, -85, -176, -190, -83
-};
-
-static const short ugen_H60e000a1c[] = { 
-	15, -27, 23, -10, -16, 30, 548, 3877, 4379, 3364, -10239, -11244, 7884, 11167, 8700, 3346, 
-	1359, 2912, 2768, -1089, -5607, -5507, -5369, -2926, -2679, -2735, -1295, -655, 377, 1080, 2017, 1685, 
-	1671, 1402, 1228, 572, -183, 209, 147, 12, -1030, -1846, -2063, -1498, -977, -425, 220, 578, 
-	547, 261, 529, 724, 548, 265, -195, -527, -379, -198, -208, -156, -202, -410, -549, -657, 
-	-543, -683, -1158, -1318, -738, -19, 193, 212, 108, -44, -78, -30, 24, 51, 79, -27, 
-	-258, -428, -407, -184, -82, -138, -280, -422, -402, -310, -137, 80, 87, -33, -134, -113, 
-	32, 125, 10, -113, -134, -115, -54, -32, -67, -146, -234, -260, -208, -99, -51, -119, 
-	-154, -145, -97, -33, 0, -5, -39, -90, -63, 11, 25, -13, -85, -176, -190, -83
-};
-
-static const short ugen_H60e010a0c[] = { 
-	-30, 34, -51, 51, -58, 52, -56, 918, 3621, 3984, 1890, -10712, -8088, 7795, 10128, 8093, 
-	2746, 1331, 2650, 2630, -1330, -4629, -4780, -4694, -2544, -2690, -2603, -1515, -678, 160, 927, 1886, 
-	1638, 1680, 1366, 1214, 470, -132, 182, 238, -23, -1031, -1658, -1833, -1329, -852, -435, 38, 
-	477, 412, 143, 382, 619, 573, 246, -179, -420, -285, -111, -212, -141, -186, -617, -646, 
-	-466, -502, -816, -1064, -953, -559, -130, 142, 230, 14, -228, -194, -58, -19, -7, 20, 
-	-51, -222, -355, -363, -244, -114, -114, -267, -375, -359, -265, -125, 64, 89, -35, -103, 
-	-103, -13, 61, -11, -110, -107, -88, -46, -7, -60, -140, -212, -242, -189, -110, -79, 
-	-125, -173, -159, -73, -8, -19, -36, -37, -51, -40, -4, 1, -33, -73, -129, -164
-};
-
-static const short ugen_H60e010a1c[] = { 
-	8, -33, 73, -122, 165, 99, 3891, 4888, 4914, -8418, -15511, 6607, 12986, 9310, 4342, 1189, 
-	3130, 3052, -422, -6228, -6456, -6094, -3539, -2660, -2970, -1116, -543, 475, 1200, 2277, 1798, 1474, 
-	1449, 1255, 653, -344, 325, 234, 68, -866, -1985, -2352, -1743, -1078, -545, 291, 723, 613, 
-	347, 602, 839, 677, 384, -206, -692, -581, -304, -46, -107, -270, -362, -474, -563, -496, 
-	-705, -1345, -1594, -895, 46, 209, 110, 208, 158, 104, 93, 27, 45, 154, 39, -335, 
-	-545, -423, -147, -72, -121, -248, -433, -440, -336, -105, 90, 91, -40, -206, -147, 81, 
-	175, 37, -119, -201, -144, -24, 18, -39, -179, -278, -279, -219, -92, -33, -108, -131, 
-	-144, -129, -23, 34, 9, -38, -104, -84, 4, 49, 4, -104, -185, -159, -68, -17
-};
-
-static const short ugen_H60e020a0c[] = { 
-	13, -30, 33, -48, 57, -72, 85, -82, 1150, 3249, 3615, 689, -10307, -5844, 7241, 9347, 
-	7367, 2374, 1376, 2587, 2395, -1233, -3774, -4322, -4054, -2305, -2670, -2535, -1571, -701, -23, 885, 
-	1780, 1565, 1625, 1339, 1102, 411, 4, 212, 264, -92, -964, -1554, -1716, -1175, -825, -548, 
-	-41, 422, 200, 14, 560, 736, 457, 153, -175, -336, -235, -47, -187, -373, -386, -508, 
-	-479, -443, -605, -795, -828, -667, -419, -239, -22, 161, 36, -225, -306, -201, -102, -44, 
-	-3, -95, -253, -324, -296, -220, -143, -123, -201, -280, -287, -220, -105, 37, 62, -54, 
-	-110, -89, -36, -8, -52, -104, -83, -39, 0, 0, -77, -148, -191, -211, -185, -118, 
-	-92, -128, -169, -154, -64, -4, -17, -39, -37, -48, -40, -15, -20, -38, -65, -113
-};
-
-static const short ugen_H60e020a1c[] = { 
-	-79, 147, -215, 271, -253, 3353, 5436, 6050, -4663, -19134, 2658, 15050, 9833, 5571, 1441, 3129, 
-	3224, 820, -6343, -7482, -6804, -4544, -2769, -3360, -1002, -398, 660, 1294, 2359, 2236, 1316, 1300, 
-	1256, 878, -523, 205, 389, 193, -640, -1894, -2612, -2153, -1253, -692, 221, 759, 745, 421, 
-	678, 986, 813, 518, -46, -740, -931, -476, -28, -141, -214, -304, -479, -558, -403, -547, 
-	-1409, -1886, -1095, 89, 178, 36, 327, 306, 197, 170, 100, 86, 168, 44, -362, -563, 
-	-462, -211, -101, -69, -189, -448, -507, -315, -28, 74, 73, -45, -231, -151, 78, 159, 
-	89, -121, -284, -191, -47, 47, 25, -162, -313, -349, -262, -87, 2, -65, -153, -200, 
-	-136, 16, 64, 26, -55, -125, -97, -16, 38, -12, -120, -157, -121, -63, -30, -19
-};
-
-static const short ugen_H60e030a0c[] = { 
-	0, 8, -23, 27, -41, 51, -69, 92, -68, 1317, 2917, 3298, -436, -9819, -4040, 6896, 
-	8742, 6510, 2036, 1507, 2532, 2142, -1058, -3180, -3904, -3373, -2140, -2689, -2379, -1511, -731, -138, 
-	915, 1646, 1391, 1518, 1319, 1038, 407, 131, 227, 240, -185, -994, -1499, -1528, -1093, -904, 
-	-537, -137, 136, 272, 364, 592, 574, 336, 73, -114, -209, -251, -257, -341, -305, -294, 
-	-485, -487, -433, -568, -662, -626, -532, -458, -321, -46, 130, 11, -239, -379, -335, -160, 
-	-98, -89, -137, -236, -295, -253, -148, -130, -118, -127, -174, -222, -214, -106, -2, -1, 
-	-87, -131, -99, -60, -44, -73, -82, -46, 0, 12, -18, -79, -139, -182, -194, -170, 
-	-132, -113, -128, -156, -151, -64, 0, -9, -44, -65, -56, -37, -21, -34, -54, -75
-};
-
-static const short ugen_H60e030a1c[] = { 
-	121, -178, 228, -273, 2049, 5899, 6549, 803, -19914, -5446, 16459, 11037, 6753, 2209, 3215, 3098, 
-	2176, -4752, -8880, -7208, -5744, -3268, -3907, -1362, -241, 557, 1695, 2238, 2672, 1483, 1324, 1040, 
-	1072, -392, -121, 416, 296, -174, -1680, -2663, -2545, -1582, -915, 82, 704, 734, 539, 702, 
-	1100, 987, 691, 190, -703, -1180, -599, -76, -367, -211, -151, -445, -507, -391, -506, -1251, 
-	-1828, -1372, -224, 253, 139, 259, 453, 336, 122, 120, 192, 206, 65, -316, -527, -513, 
-	-309, -118, -57, -155, -398, -525, -317, -14, 93, 115, -74, -237, -118, 54, 149, 133, 
-	-134, -306, -224, -90, 44, 63, -121, -290, -361, -318, -137, 43, 9, -172, -254, -149, 
-	22, 104, 87, -41, -137, -125, -32, 28, -23, -105, -112, -105, -76, -14, 7, -19
-};
-
-static const short ugen_H60e040a0c[] = { 
-	7, 0, 2, -13, 17, -31, 41, -54, 82, -18, 1453, 2669, 3005, -1589, -9334, -2455, 
-	6828, 8213, 5542, 1808, 1695, 2454, 1879, -944, -2766, -3466, -2774, -2090, -2622, -2135, -1426, -742, 
-	-163, 922, 1427, 1239, 1475, 1325, 938, 402, 228, 163, 114, -331, -965, -1379, -1427, -1064, 
-	-926, -766, -112, 531, 353, 328, 522, 412, 286, 148, -79, -465, -530, -164, -67, -346, 
-	-467, -402, -336, -397, -531, -529, -571, -551, -406, -277, -90, 52, -62, -259, -364, -416, 
-	-316, -164, -63, -129, -242, -249, -176, -84, -62, -77, -110, -128, -169, -206, -145, -52, 
-	-52, -121, -158, -128, -56, -21, -43, -56, -29, 0, 12, -9, -64, -121, -173, -187, 
-	-166, -135, -126, -131, -138, -113, -50, -18, -23, -46, -61, -57, -41, -31, -38, -52
-};
-
-static const short ugen_H60e040a1c[] = { 
-	34, -81, 125, 341, 5405, 6691, 5863, -14222, -16736, 13268, 14308, 7417, 3865, 3163, 3415, 2683, 
-	-1481, -9192, -8240, -6586, -4084, -4560, -2619, -84, -67, 1901, 2372, 3024, 1839, 1506, 1171, 1054, 
-	-119, -488, 379, 176, 185, -1044, -2465, -3003, -1965, -1175, -284, 646, 664, 527, 694, 1138, 
-	1192, 850, 459, -496, -1251, -801, -201, -455, -426, -156, -301, -435, -440, -464, -1049, -1610, 
-	-1432, -649, 54, 258, 347, 455, 330, 155, 151, 185, 162, 174, -144, -518, -579, -402, 
-	-168, -66, -131, -348, -499, -319, -59, 31, 167, -19, -228, -153, 0, 142, 144, -98, 
-	-300, -269, -147, 16, 67, -82, -258, -370, -346, -189, 18, 40, -171, -254, -185, -38, 
-	96, 122, 6, -106, -146, -103, -18, -12, -54, -81, -125, -118, -21, 31, -2, -58
-};
-
-static const short ugen_H60e050a0c[] = { 
-	3, 2, 5, -3, -1, 3, -15, 23, -27, 52, 102, 1641, 2526, 2607, -3237, -8690, 
-	-386, 7060, 7516, 4401, 1711, 1867, 2364, 1553, -993, -2514, -3063, -2241, -2078, -2455, -1860, -1300, 
-	-734, -125, 997, 1222, 1114, 1448, 1283, 757, 345, 169, 28, 9, -391, -950, -1298, -1280, 
-	-1329, -1002, -201, 229, 366, 302, 302, 359, 464, 352, -136, -523, -490, -178, -15, -265, 
-	-488, -323, -181, -309, -472, -488, -468, -512, -495, -395, -279, -151, -37, -107, -286, -438, 
-	-491, -342, -138, -49, -128, -200, -178, -97, -27, -31, -70, -114, -134, -172, -212, -169, 
-	-98, -101, -163, -173, -117, -25, 16, -21, -48, -29, 0, 12, -11, -55, -113, -176, 
-	-190, -171, -138, -133, -124, -113, -93, -61, -45, -36, -43, -57, -69, -53, -36, -43
-};
-
-static const short ugen_H60e050a1c[] = { 
-	-188, 303, -402, 3105, 6860, 7842, -3150, -22705, 752, 18337, 8848, 5272, 3552, 4042, 2552, 1933, 
-	-6754, -10094, -7017, -5204, -4556, -4604, -723, -457, 1037, 2516, 3254, 2696, 1531, 1614, 1256, 428, 
-	-887, 88, 172, 181, -413, -1862, -3036, -2686, -1455, -656, 364, 653, 479, 598, 992, 1376, 
-	1089, 682, -246, -1112, -783, -483, -522, -545, -330, -262, -377, -445, -477, -847, -1356, -1319, 
-	-821, -292, 124, 463, 511, 280, 144, 138, 184, 155, 174, 42, -368, -601, -535, -258, 
-	-87, -90, -256, -461, -370, -116, 0, 128, 43, -143, -183, -82, 86, 128, -16, -236, 
-	-309, -205, -35, 33, -12, -199, -363, -371, -241, -36, 34, -121, -242, -221, -112, 55, 
-	126, 46, -68, -142, -148, -81, -12, 1, -48, -127, -158, -64, 33, 26, -49, -96
-};
-
-static const short ugen_H60e060a0c[] = { 
-	-4, 8, -1, 7, -13, 11, -14, 12, -10, 19, -8, 387, 1869, 2532, 1694, -5527, 
-	-7185, 2290, 7344, 6466, 3227, 1762, 1957, 2316, 1042, -1282, -2392, -2596, -1813, -2116, -2187, -1631, 
-	-1149, -635, 50, 1041, 1005, 1042, 1410, 1112, 424, 234, 98, -2, -59, -456, -910, -1453, 
-	-1421, -903, -419, -94, 158, 265, 235, 287, 435, 307, -181, -348, -263, -248, -203, -195, 
-	-296, -311, -162, -200, -429, -459, -331, -395, -536, -500, -396, -314, -187, -90, -220, -392, 
-	-440, -416, -295, -95, -17, -101, -147, -107, -52, -21, -32, -92, -162, -169, -181, -223, 
-	-195, -132, -126, -168, -154, -83, 0, 26, -12, -28, -15, -3, 0, -30, -65, -115, 
-	-172, -190, -165, -136, -126, -118, -109, -81, -57, -47, -45, -54, -61, -65, -54, -49
-};
-
-static const short ugen_H60e060a1c[] = { 
-	-70, 120, 272, 5582, 7765, 6074, -15082, -16934, 14167, 14456, 5919, 4310, 4470, 3203, 2832, -808, 
-	-10227, -8939, -5881, -4600, -5632, -2781, -590, -557, 2081, 2862, 3529, 2181, 1901, 1574, 1297, -358, 
-	-711, 161, 22, 29, -1187, -2532, -3239, -2104, -987, -108, 601, 419, 533, 812, 1228, 1363, 
-	955, 155, -981, -753, -403, -681, -648, -450, -331, -425, -450, -474, -710, -1116, -1194, -844, 
-	-436, -43, 302, 508, 387, 136, 95, 119, 173, 174, 149, -159, -510, -586, -431, -164, 
-	-47, -122, -372, -418, -193, -50, 68, 89, -46, -143, -169, -4, 82, 46, -118, -298, 
-	-261, -99, -17, 12, -65, -290, -387, -295, -114, -5, -46, -180, -248, -199, -21, 117, 
-	90, -18, -127, -187, -128, -5, 47, -18, -110, -158, -109, 7, 37, -13, -80, -93
-};
-
-static const short ugen_H60e070a0c[] = { 
-	-2, 0, 7, 0, 4, -11, 14, -21, 30, -33, 60, -32, 959, 2097, 2596, -732, 
-	-7767, -3608, 5250, 7136, 4819, 2325, 1918, 2089, 2173, 97, -1688, -2227, -2033, -1702, -2129, -1851, 
-	-1408, -898, -508, 334, 994, 848, 1010, 1257, 763, 169, 205, 81, 27, -111, -750, -1295, 
-	-1083, -801, -655, -342, -111, 124, 246, 282, 177, 10, -16, -36, -112, -241, -354, -244, 
-	-91, -208, -304, -217, -276, -348, -273, -292, -487, -562, -466, -433, -369, -213, -203, -326, 
-	-350, -356, -343, -187, -3, 7, -81, -109, -66, -40, -50, -92, -162, -193, -187, -220, 
-	-242, -171, -99, -120, -162, -122, -35, 28, 19, -12, -9, 0, -9, -35, -51, -71, 
-	-121, -171, -171, -144, -135, -133, -111, -84, -59, -46, -64, -74, -55, -51, -57, -61
-};
-
-static const short ugen_H60e070a1c[] = { 
-	131, -233, 1701, 6854, 8531, 843, -21046, -6404, 18152, 10332, 4966, 4301, 4485, 2694, 3149, -4135, 
-	-11037, -7516, -5252, -5104, -5410, -1496, -1161, -143, 2366, 3275, 3084, 2106, 2355, 1702, 962, -578, 
-	-249, -120, 17, -314, -1853, -3089, -3052, -1579, -599, 188, 483, 391, 633, 968, 1408, 1207, 
-	638, -442, -930, -386, -502, -693, -598, -378, -473, -568, -492, -585, -957, -1073, -874, -607, 
-	-81, 238, 268, 371, 333, 109, 8, 107, 202, 164, 32, -304, -553, -563, -301, -95, 
-	-37, -193, -399, -304, -125, 12, 70, 14, -22, -158, -163, -5, 67, 12, -211, -300, 
-	-193, -66, -18, 24, -141, -321, -326, -224, -76, -6, -77, -222, -259, -149, 37, 113, 
-	57, -71, -196, -206, -61, 71, 41, -77, -138, -123, -41, 23, 13, -43, -82, -88
-};
-
-static const short ugen_H60e080a0c[] = { 
-	0, -2, 7, 0, 8, -13, 11, -15, 16, -10, 27, -18, 349, 1698, 2437, 1461, 
-	-5417, -6763, 2261, 6952, 5649, 2980, 2129, 2079, 2332, 1274, -1151, -1963, -1850, -1679, -1992, -1803, 
-	-1571, -1210, -666, -142, 588, 799, 832, 960, 1018, 428, 108, 177, 202, -195, -673, -770, 
-	-879, -706, -622, -612, -376, 29, 210, 111, -116, -126, 167, 156, -19, -171, -286, -275, 
-	-144, -139, -364, -330, -139, -163, -246, -275, -401, -525, -514, -537, -548, -410, -222, -205, 
-	-288, -324, -313, -184, 0, 46, -27, -77, -68, -66, -98, -136, -178, -209, -213, -230, 
-	-247, -174, -88, -89, -138, -140, -64, 10, 13, -12, -8, -1, -9, -20, -45, -78, 
-	-108, -132, -142, -145, -149, -137, -112, -85, -62, -56, -74, -89, -69, -46, -48, -76
-};
-
-static const short ugen_H60e080a1c[] = { 
-	191, -327, 2692, 7485, 8499, -3862, -21320, 401, 17664, 8405, 4804, 4286, 4007, 2935, 2888, -6133, 
-	-10547, -6468, -5088, -5770, -4702, -1133, -1609, 251, 2222, 3298, 2741, 2123, 2578, 1996, 760, -550, 
-	105, -117, -83, -703, -2255, -3452, -2818, -1123, -415, 120, 415, 517, 591, 1014, 1480, 1055, 
-	232, -604, -559, -457, -579, -492, -498, -465, -588, -625, -573, -681, -1057, -946, -724, -367, 
-	215, 298, 170, 297, 346, 97, -85, 84, 222, 143, -60, -392, -575, -486, -206, -53, 
-	-67, -252, -344, -248, -113, 38, 50, 8, -14, -173, -163, -38, 63, -10, -253, -293, 
-	-175, -69, 18, 18, -187, -298, -276, -182, -74, 1, -92, -251, -259, -118, 42, 88, 
-	37, -115, -228, -186, -24, 81, 16, -95, -118, -77, -11, 16, -9, -61, -83, -87
-};
-
-static const short ugen_H60e090a0c[] = { 
-	0, -4, 4, 0, 7, -8, 1, -5, 1, 8, 2, 12, 130, 1425, 2330, 2038, 
-	-3909, -7496, 461, 6554, 5836, 3267, 2302, 2273, 2430, 1731, -678, -1924, -1857, -1495, -2019, -1915, 
-	-1426, -1426, -899, -216, 403, 473, 747, 1036, 951, 550, 292, 257, -57, -235, -285, -642, 
-	-803, -523, -601, -706, -440, -104, -33, -163, -189, -10, 180, 181, 47, -36, -95, -232, 
-	-299, -308, -378, -292, -71, -75, -231, -274, -300, -434, -543, -627, -715, -587, -223, -84, 
-	-247, -363, -267, -84, 32, 40, 1, -42, -76, -99, -151, -200, -229, -231, -231, -237, 
-	-225, -161, -82, -66, -112, -131, -82, -18, -6, -21, -29, -19, -2, -3, -41, -98, 
-	-103, -99, -113, -141, -153, -135, -109, -86, -77, -70, -80, -97, -84, -58, -62, -95
-};
-
-static const short ugen_H60e090a1c[] = { 
-	172, -296, 2822, 7677, 8185, -5430, -20039, 1901, 16652, 8146, 4881, 4040, 3753, 3310, 2624, -6386, 
-	-9969, -5878, -5008, -6092, -4548, -1198, -1721, 87, 2095, 3055, 2436, 2224, 2588, 2125, 967, -303, 
-	130, 99, 74, -1062, -2559, -3487, -2675, -946, -429, -53, 383, 555, 551, 925, 1367, 964, 
-	102, -465, -342, -601, -622, -241, -393, -593, -640, -641, -613, -755, -1040, -931, -684, -167, 
-	333, 276, 135, 295, 343, 106, -121, 22, 186, 150, -71, -435, -570, -417, -168, -61, 
-	-72, -254, -322, -241, -113, 25, 42, 45, -19, -185, -164, -58, 42, -29, -242, -303, 
-	-199, -73, 40, 15, -179, -262, -261, -157, -62, -2, -92, -247, -262, -133, 24, 73, 
-	16, -134, -228, -174, -26, 55, 0, -68, -79, -56, 2, 16, -25, -82, -96, -72
-};
-
-static const short ugen_H60e100a0c[] = { 
-	-2, -3, 5, -1, 7, -6, 1, -9, 0, 7, 6, 7, 128, 1431, 2406, 1981, 
-	-4119, -7394, 745, 6592, 5578, 3117, 2421, 2434, 2587, 1819, -728, -1926, -1918, -1671, -2021, -1997, 
-	-1511, -1313, -976, -281, 481, 406, 569, 1160, 1156, 447, 406, 235, -365, -32, -126, -739, 
-	-731, -506, -566, -592, -389, -260, -390, -354, 14, 128, 82, 126, 146, 136, -18, -186, 
-	-383, -529, -428, -177, -30, -97, -228, -244, -203, -356, -559, -734, -837, -615, -187, -61, 
-	-270, -362, -191, 8, 62, 62, 28, -44, -98, -135, -202, -272, -273, -249, -234, -230, 
-	-200, -133, -66, -53, -99, -112, -91, -39, -19, -42, -58, -38, 0, -14, -57, -78, 
-	-68, -76, -111, -135, -139, -122, -102, -91, -88, -82, -85, -98, -89, -83, -95, -100
-};
-
-static const short ugen_H60e100a1c[] = { 
-	135, -245, 2156, 7310, 8238, -3846, -18871, -875, 15868, 9026, 5000, 3794, 3721, 3614, 2785, -5272, 
-	-9562, -5723, -4739, -6036, -4950, -1591, -1673, -377, 1651, 2932, 2286, 1975, 2690, 2140, 1157, 132, 
-	266, 146, 331, -870, -2757, -3533, -2464, -975, -729, -165, 373, 405, 479, 823, 1106, 863, 
-	273, -170, -234, -694, -641, -96, -252, -635, -684, -606, -605, -749, -1029, -961, -728, -152, 
-	322, 293, 186, 262, 317, 155, -91, -66, 126, 166, -22, -384, -541, -414, -196, -65, 
-	-64, -233, -324, -264, -133, -4, 37, 62, 18, -168, -175, -68, 17, -30, -222, -307, 
-	-228, -84, 30, 30, -135, -228, -251, -158, -45, 1, -77, -235, -266, -154, -1, 65, 
-	11, -132, -222, -171, -44, 32, 7, -32, -47, -42, 8, 16, -36, -92, -103, -62
-};
-
-static const short ugen_H60e110a0c[] = { 
-	-3, -3, 7, -2, 7, -11, 9, -20, 15, -10, 32, -33, 346, 1765, 2671, 1072, 
-	-6002, -6210, 3132, 6911, 4775, 2650, 2505, 2578, 2701, 1385, -1183, -2071, -1895, -1937, -2423, -1911, 
-	-1503, -1374, -712, -20, 443, 480, 794, 1224, 1087, 643, 279, -251, 24, 109, -563, -711, 
-	-709, -627, -475, -420, -418, -439, -493, -254, 110, 160, 54, 115, 294, 145, -71, -167, 
-	-464, -626, -358, -137, -160, -131, -127, -194, -215, -312, -590, -870, -784, -451, -195, -187, 
-	-293, -278, -88, 60, 95, 96, 23, -64, -132, -189, -267, -305, -267, -245, -239, -226, 
-	-171, -82, -39, -63, -105, -100, -69, -30, -37, -78, -76, -51, -36, -37, -33, -19, 
-	-35, -80, -113, -119, -102, -96, -98, -104, -97, -85, -84, -89, -112, -111, -99, -94
-};
-
-static const short ugen_H60e110a1c[] = { 
-	51, -107, 1008, 6105, 8480, -69, -16613, -6825, 13857, 11085, 5308, 3617, 3660, 3947, 3298, -3049, 
-	-9054, -6049, -4316, -5643, -5496, -2373, -1647, -1007, 1004, 2514, 2490, 1678, 2421, 2317, 1359, 365, 
-	489, 400, 374, -467, -2350, -3531, -2533, -1003, -1009, -505, 310, 327, 276, 620, 842, 743, 
-	499, 186, -44, -697, -748, -26, -69, -594, -735, -555, -534, -684, -987, -1022, -820, -325, 
-	192, 301, 254, 232, 268, 212, -17, -125, 50, 164, 62, -259, -492, -438, -271, -102, 
-	-53, -215, -328, -298, -188, -51, 35, 55, 55, -106, -191, -83, -6, -15, -198, -322, 
-	-265, -113, 10, 35, -83, -196, -235, -177, -51, 8, -60, -216, -275, -182, -36, 37, 
-	9, -106, -207, -197, -89, 11, 18, -9, -25, -37, -7, 3, -32, -93, -106, -67
-};
-
-static const short ugen_H60e120a0c[] = { 
-	-3, 2, 4, 1, 3, -7, 9, -20, 25, -21, 53, -38, 972, 2407, 2749, -1949, 
-	-8111, -2127, 6405, 6412, 3447, 2346, 2588, 2746, 2555, 87, -1890, -1998, -1953, -2439, -2602, -1869, 
-	-1549, -1146, -381, 484, 541, 573, 1214, 1315, 927, 533, -68, -113, 289, -253, -732, -906, 
-	-760, -511, -489, -429, -454, -445, -277, 0, 81, 75, 134, 316, 268, -54, -128, -232, 
-	-526, -521, -247, -223, -307, -150, -23, -111, -272, -421, -700, -782, -529, -296, -287, -339, 
-	-250, -128, -15, 89, 144, 79, -25, -100, -179, -274, -294, -242, -234, -261, -250, -188, 
-	-108, -49, -42, -92, -112, -72, -21, -27, -78, -97, -89, -84, -67, -19, 9, 3, 
-	-41, -87, -89, -67, -69, -94, -107, -104, -98, -83, -89, -113, -113, -105, -98, -85
-};
-
-static const short ugen_H60e120a1c[] = { 
-	-52, 80, 37, 3891, 8099, 4398, -11251, -13528, 7875, 13834, 6617, 3566, 3305, 4236, 3869, -91, 
-	-7487, -7082, -3946, -4906, -5764, -3548, -1707, -1640, 56, 1852, 2578, 1706, 1975, 2291, 1674, 673, 
-	451, 663, 606, -110, -1740, -3041, -2687, -1295, -1113, -863, -43, 285, 190, 286, 484, 609, 
-	687, 533, 192, -485, -842, -162, 140, -416, -789, -576, -399, -554, -870, -1062, -932, -592, 
-	-76, 203, 269, 238, 230, 239, 89, -101, -47, 128, 165, -88, -410, -464, -338, -182, 
-	-92, -180, -322, -333, -263, -138, 20, 80, 49, -43, -177, -110, -13, -15, -150, -322, 
-	-314, -164, -15, 32, -39, -159, -211, -196, -86, -5, -49, -166, -258, -221, -95, -1, 
-	5, -63, -165, -219, -148, -21, 24, 1, -15, -33, -35, -15, -26, -73, -106, -84
-};
-
-static const short ugen_H60e130a0c[] = { 
-	-4, 8, -1, 7, -12, 12, -18, 17, -20, 36, -34, 396, 2045, 3152, 674, -7058, 
-	-5946, 4453, 7579, 4518, 2432, 2479, 2667, 2933, 1206, -1660, -2180, -1898, -2337, -2964, -2301, -1827, 
-	-1615, -685, 301, 729, 704, 1135, 1358, 1189, 780, 11, -173, 446, -17, -738, -924, -968, 
-	-700, -567, -555, -513, -411, -240, 90, 134, 27, 96, 365, 359, -28, -184, -238, -413, 
-	-414, -328, -383, -327, -235, -192, -59, -90, -374, -677, -673, -426, -281, -339, -416, -303, 
-	-157, -54, 26, 117, 120, 8, -117, -214, -268, -253, -207, -230, -274, -261, -201, -144, 
-	-77, -54, -97, -118, -82, -44, -28, -60, -108, -118, -112, -93, -53, -16, -4, -28, 
-	-67, -64, -23, -33, -94, -122, -112, -95, -90, -112, -138, -125, -95, -93, -99, -77
-};
-
-static const short ugen_H60e130a1c[] = { 
-	-48, 72, -124, 1258, 6111, 7400, -2565, -15472, -3673, 13606, 10244, 4183, 2795, 3981, 4415, 2614, 
-	-3780, -7920, -4652, -3795, -5386, -4855, -2278, -1820, -1188, 794, 2307, 2018, 1534, 2194, 1822, 1131, 
-	550, 610, 769, 437, -998, -2443, -2501, -1608, -1302, -1152, -498, 81, 194, 77, 58, 340, 
-	691, 827, 575, -204, -727, -382, 180, -140, -686, -663, -357, -380, -637, -952, -1051, -823, 
-	-434, -71, 161, 244, 229, 235, 194, 44, -95, 27, 218, 129, -252, -452, -396, -275, 
-	-181, -159, -267, -365, -334, -226, -60, 106, 87, -20, -126, -149, -24, -9, -97, -247, 
-	-330, -239, -77, 14, 3, -94, -175, -196, -145, -48, -27, -103, -202, -242, -171, -45, 
-	-2, -40, -109, -183, -180, -83, 3, 15, -7, -27, -50, -36, -18, -45, -84, -83
-};
-
-static const short ugen_H60e140a0c[] = { 
-	4, 0, 6, -7, 2, -7, 0, 3, -3, 14, 121, 1712, 3337, 2058, -5686, -8005, 
-	2486, 8304, 5441, 2659, 2424, 2633, 3029, 1812, -1419, -2414, -2008, -2303, -3062, -2640, -1941, -1872, 
-	-1135, 25, 819, 794, 1186, 1597, 1296, 866, 267, -269, 335, 310, -575, -1029, -1125, -748, 
-	-739, -743, -599, -456, -278, 105, 326, 148, 123, 375, 449, 25, -258, -271, -417, -385, 
-	-273, -412, -448, -303, -201, -161, -164, -332, -602, -612, -318, -169, -285, -395, -319, -187, 
-	-92, -38, 69, 110, 10, -125, -279, -293, -189, -139, -217, -286, -250, -197, -169, -113, 
-	-71, -87, -126, -102, -60, -54, -67, -93, -112, -121, -99, -72, -58, -45, -49, -72, 
-	-49, 0, -4, -65, -114, -131, -104, -76, -113, -161, -149, -113, -89, -72, -69, -64
-};
-
-static const short ugen_H60e140a1c[] = { 
-	39, -73, 101, -76, 2798, 7066, 4729, -8626, -13564, 4779, 13912, 7042, 2765, 3003, 4421, 4090, 
-	744, -5941, -6466, -3397, -4123, -5305, -3729, -1785, -1945, -671, 1314, 2281, 1460, 1725, 2042, 1356, 
-	919, 589, 708, 683, -65, -1687, -2189, -1624, -1447, -1374, -978, -257, 153, -7, -209, -52, 
-	470, 765, 1007, 330, -578, -488, 107, 52, -488, -620, -438, -314, -438, -624, -966, -1034, 
-	-755, -425, -123, 121, 221, 254, 230, 200, 32, -50, 134, 263, 5, -338, -438, -382, 
-	-264, -203, -207, -317, -368, -301, -175, 9, 156, 53, -91, -157, -109, -4, -21, -146, 
-	-271, -296, -169, -33, 9, -17, -114, -177, -180, -104, -30, -45, -135, -209, -208, -116, 
-	-35, -41, -70, -108, -156, -125, -42, 4, 0, -20, -46, -62, -27, -16, -48, -61
-};
-
-static const short ugen_H60e150a0c[] = { 
-	3, 2, -4, -3, 0, -10, 15, -26, 43, 5, 1488, 3523, 2877, -4787, -9138, 1118, 
-	8820, 6176, 2837, 2441, 2713, 3115, 2122, -1459, -2753, -2114, -2343, -3246, -2919, -1922, -1967, -1351, 
-	-126, 738, 780, 1215, 1710, 1484, 1086, 449, -364, 123, 572, -466, -1112, -1106, -842, -883, 
-	-839, -662, -613, -382, 53, 393, 330, 276, 463, 522, 159, -271, -429, -425, -293, -322, 
-	-460, -437, -373, -296, -190, -188, -471, -698, -511, -144, -89, -201, -262, -238, -167, -124, 
-	-68, 18, 65, -27, -214, -325, -246, -161, -163, -193, -205, -226, -233, -187, -113, -63, 
-	-82, -115, -110, -100, -73, -65, -91, -118, -97, -81, -91, -77, -60, -75, -95, -52, 
-	-2, -2, -44, -90, -120, -101, -76, -111, -136, -134, -135, -106, -59, -26, -35, -62
-};
-
-static const short ugen_H60e150a1c[] = { 
-	2, 2, -15, 15, 269, 3927, 6931, 1570, -11941, -9252, 9443, 12199, 4891, 2261, 3457, 4373, 
-	3623, -940, -6446, -4916, -3005, -4292, -4920, -2855, -1773, -1911, -289, 1605, 1963, 1196, 1887, 1662, 
-	1192, 849, 656, 671, 406, -594, -1680, -1503, -1505, -1457, -1246, -822, -58, 13, -277, -387, 
-	56, 515, 948, 980, -4, -542, -118, 237, -249, -561, -462, -330, -394, -444, -583, -919, 
-	-1040, -809, -431, -160, 62, 217, 282, 239, 197, 74, 33, 165, 200, -76, -379, -475, 
-	-394, -276, -205, -217, -309, -363, -274, -123, 35, 149, 23, -146, -178, -90, 1, -18, 
-	-162, -271, -258, -125, -29, -7, -42, -116, -167, -154, -83, -33, -50, -148, -208, -177, 
-	-103, -60, -50, -67, -109, -124, -77, -24, -2, -12, -37, -70, -60, -20, -15, -26
-};
-
-static const short ugen_H60e160a0c[] = { 
-	0, -3, -9, 6, -21, 23, -43, 54, -45, 1356, 3769, 3503, -4337, -10008, 312, 9401, 
-	6735, 2934, 2463, 2836, 3252, 2297, -1655, -3226, -2267, -2448, -3433, -3158, -2010, -1990, -1405, -143, 
-	803, 747, 1087, 1739, 1562, 1160, 788, -140, -298, 558, -154, -1257, -1245, -807, -906, -980, 
-	-670, -618, -605, -184, 398, 487, 374, 553, 627, 320, -185, -509, -493, -270, -315, -476, 
-	-510, -456, -298, -242, -333, -630, -762, -494, -129, 5, -39, -136, -137, -72, -79, -117, 
-	-36, 41, -115, -339, -353, -229, -183, -183, -174, -192, -228, -230, -216, -124, -39, -62, 
-	-132, -144, -125, -98, -69, -103, -131, -119, -98, -86, -79, -82, -97, -105, -86, -54, 
-	-30, -50, -103, -133, -103, -87, -116, -127, -130, -134, -118, -74, -30, -32, -56, -94
-};
-
-static const short ugen_H60e160a1c[] = { 
-	-25, 32, -39, 36, -62, 683, 4432, 6266, -994, -12865, -5327, 11121, 10353, 3711, 2278, 3617, 
-	4148, 3184, -1969, -5994, -3851, -2866, -4257, -4460, -2370, -1897, -1807, -58, 1672, 1555, 1156, 1797, 
-	1439, 1221, 798, 715, 490, 60, -742, -1142, -1380, -1617, -1184, -1194, -660, -43, -179, -496, 
-	-430, 162, 669, 1011, 702, 17, -275, 10, 67, -370, -465, -389, -377, -465, -429, -515, 
-	-817, -1087, -872, -421, -174, 20, 189, 300, 267, 203, 104, 95, 134, 92, -152, -412, 
-	-489, -414, -256, -181, -200, -269, -344, -267, -125, 14, 121, 31, -167, -206, -87, 3, 
-	-15, -161, -254, -222, -111, -40, -32, -53, -94, -146, -138, -76, -32, -59, -151, -205, 
-	-160, -95, -70, -57, -80, -106, -90, -46, -11, -9, -28, -60, -88, -61, -21, -10
-};
-
-static const short ugen_H60e170a0c[] = { 
-	2, -14, 12, -24, 33, -48, 64, -73, 1275, 4062, 4111, -4025, -10892, -325, 10132, 7300, 
-	2959, 2504, 3053, 3446, 2404, -1960, -3792, -2463, -2560, -3698, -3398, -1992, -2056, -1491, 27, 980, 
-	840, 1042, 1652, 1600, 1156, 913, 272, -375, 244, 20, -1222, -1454, -858, -934, -980, -594, 
-	-531, -691, -436, 173, 600, 587, 580, 627, 455, -33, -470, -422, -294, -369, -443, -498, 
-	-525, -344, -243, -455, -826, -827, -456, -111, 18, 77, 61, 29, 37, -15, -70, -3, 
-	-9, -237, -374, -326, -257, -237, -162, -124, -190, -251, -245, -198, -65, 15, -35, -126, 
-	-165, -138, -66, -49, -101, -131, -137, -116, -72, -44, -57, -84, -104, -84, -62, -47, 
-	-63, -100, -123, -110, -85, -84, -95, -103, -100, -88, -49, -13, -16, -48, -83, -104
-};
-
-static const short ugen_H60e170a1c[] = { 
-	12, -32, 42, -53, 62, -93, 973, 4482, 5521, -2562, -12555, -2843, 11267, 9015, 3190, 2405, 
-	3510, 3919, 2840, -2319, -5263, -3197, -2743, -4114, -4074, -2158, -1967, -1715, 61, 1547, 1205, 1132, 
-	1658, 1446, 1210, 806, 713, 186, -158, -436, -851, -1638, -1388, -1003, -1154, -534, -151, -394, 
-	-658, -333, 332, 801, 816, 607, 255, -95, -118, -132, -294, -418, -447, -456, -489, -393, 
-	-425, -736, -1058, -880, -452, -157, -6, 169, 287, 241, 199, 121, 71, 44, 4, -202, 
-	-417, -477, -391, -253, -131, -140, -256, -347, -284, -126, 2, 83, 19, -155, -217, -90, 
-	-2, -54, -148, -201, -181, -118, -71, -40, -57, -69, -114, -132, -81, -42, -59, -143, 
-	-192, -152, -85, -73, -79, -86, -91, -74, -35, -4, -7, -47, -84, -96, -63, -34
-};
-
-static const short ugen_H60e180a0c[] = { 
-	-17, 17, -32, 36, -54, 66, -93, 1159, 4312, 4775, -3504, -11755, -1274, 10776, 8012, 3011, 
-	2489, 3288, 3684, 2564, -2245, -4479, -2755, -2646, -3937, -3727, -2033, -2021, -1623, 100, 1262, 972, 
-	1094, 1583, 1529, 1185, 867, 579, -161, -87, -39, -1016, -1694, -1034, -962, -1056, -524, -331, 
-	-610, -648, -104, 526, 730, 683, 622, 377, 6, -297, -291, -278, -414, -482, -476, -506, 
-	-379, -335, -622, -935, -867, -505, -118, 35, 125, 156, 207, 176, 17, -27, 39, -5, 
-	-278, -421, -406, -312, -231, -126, -147, -252, -278, -254, -175, -34, 47, 2, -127, -202, 
-	-127, -44, -63, -112, -143, -167, -141, -76, -34, -47, -73, -111, -116, -71, -40, -74, 
-	-135, -158, -124, -83, -85, -91, -87, -89, -75, -34, -8, -16, -51, -84, -103, -82
-};
-
-static const short ugen_H60e180a1c[] = { 
-	-17, 17, -32, 36, -54, 66, -93, 1159, 4312, 4775, -3504, -11755, -1274, 10776, 8012, 3011, 
-	2489, 3288, 3684, 2564, -2245, -4479, -2755, -2646, -3937, -3727, -2033, -2021, -1623, 100, 1262, 972, 
-	1094, 1583, 1529, 1185, 867, 579, -161, -87, -39, -1016, -1694, -1034, -962, -1056, -524, -331, 
-	-610, -648, -104, 526, 730, 683, 622, 377, 6, -297, -291, -278, -414, -482, -476, -506, 
-	-379, -335, -622, -935, -867, -505, -118, 35, 125, 156, 207, 176, 17, -27, 39, -5, 
-	-278, -421, -406, -312, -231, -126, -147, -252, -278, -254, -175, -34, 47, 2, -127, -202, 
-	-127, -44, -63, -112, -143, -167, -141, -76, -34, -47, -73, -111, -116, -71, -40, -74, 
-	-135, -158, -124, -83, -85, -91, -87, -89, -75, -34, -8, -16, -51, -84, -103, -82
-};
-
-static const short ugen_H70e000a0c[] = { 
-	-3, -4, -5, 17, -5, 14, -18, 10, -6, -6, 25, -58, 80, 254, 3266, 4222, 
-	4429, -7296, -12654, 5571, 11428, 7081, 3471, 3240, 3321, 2147, -765, -5815, -6342, -5329, -3182, -3043, 
-	-2543, -535, 55, 844, 1519, 2422, 1682, 1230, 1249, 1127, 224, -707, -232, -101, -220, -886, 
-	-1541, -2058, -1667, -988, -365, 291, 792, 922, 663, 705, 873, 528, 26, -352, -596, -640, 
-	-531, -581, -693, -408, -212, -22, -41, -211, -290, -460, -823, -1079, -815, -230, 125, 43, 
-	-107, -39, 110, 52, -97, -102, -73, -218, -355, -343, -203, -65, 2, -102, -273, -331, 
-	-272, -179, -68, -23, -147, -249, -175, 4, 91, 29, -105, -133, -83, 0, 81, 51, 
-	-70, -181, -230, -193, -104, -74, -153, -221, -226, -133, 2, 35, -16, -39, -30, -47
-};
-
-static const short ugen_H70e000a1c[] = { 
-	-3, -4, -5, 17, -5, 14, -18, 10, -6, -6, 25, -58, 80, 254, 3266, 4222, 
-	4429, -7296, -12654, 5571, 11428, 7081, 3471, 3240, 3321, 2147, -765, -5815, -6342, -5329, -3182, -3043, 
-	-2543, -535, 55, 844, 1519, 2422, 1682, 1230, 1249, 1127, 224, -707, -232, -101, -220, -886, 
-	-1541, -2058, -1667, -988, -365, 291, 792, 922, 663, 705, 873, 528, 26, -352, -596, -640, 
-	-531, -581, -693, -408, -212, -22, -41, -211, -290, -460, -823, -1079, -815, -230, 125, 43, 
-	-107, -39, 110, 52, -97, -102, -73, -218, -355, -343, -203, -65, 2, -102, -273, -331, 
-	-272, -179, -68, -23, -147, -249, -175, 4, 91, 29, -105, -133, -83, 0, 81, 51, 
-	-70, -181, -230, -193, -104, -74, -153, -221, -226, -133, 2, 35, -16, -39, -30, -47
-};
-
-static const short ugen_H70e015a0c[] = { 
-	0, -3, -2, -5, 12, -3, 15, -19, 12, -13, 1, 9, -32, 44, 321, 2875, 
-	3708, 3585, -6856, -10992, 4659, 10472, 7132, 3307, 2805, 3077, 2182, -336, -4684, -5486, -4686, -2905, 
-	-2750, -2461, -960, -353, 386, 1205, 2078, 1595, 1409, 1377, 1169, 391, -532, -271, -104, -207, 
-	-845, -1424, -1813, -1525, -976, -394, 157, 538, 736, 583, 618, 804, 550, 134, -264, -564, 
-	-667, -510, -385, -666, -539, -207, -103, -132, -174, -211, -383, -672, -843, -678, -269, 36, 
-	-19, -209, -223, -121, -58, -100, -96, -96, -195, -284, -271, -149, -119, -77, -84, -191, 
-	-264, -279, -197, -71, -27, -127, -241, -194, -42, 64, 20, -100, -112, -54, 25, 87, 
-	79, -29, -155, -208, -195, -130, -122, -174, -213, -217, -139, -19, 45, 16, -45, -54
-};
-
-static const short ugen_H70e015a1c[] = { 
-	-2, -7, 17, -2, 16, -10, -3, 10, -32, 69, -106, 147, 73, 3523, 4807, 5537, 
-	-6793, -15164, 5482, 12736, 7069, 3770, 3857, 3581, 1957, -589, -6805, -7272, -5833, -3724, -3418, -2791, 
-	-158, 371, 1369, 1910, 2691, 1939, 1096, 1032, 1080, 63, -962, -197, -39, -103, -878, -1659, 
-	-2302, -1893, -1085, -333, 450, 842, 1114, 805, 748, 1082, 625, -94, -474, -561, -648, -718, 
-	-695, -647, -462, -191, 104, -33, -165, -235, -502, -1032, -1327, -869, -120, 101, -71, 84, 
-	281, 292, 107, -84, -72, -53, -258, -473, -450, -198, 16, 20, -100, -254, -340, -298, 
-	-169, 2, 7, -184, -279, -168, 15, 113, 38, -137, -172, -101, 12, 110, 62, -97, 
-	-231, -267, -196, -75, -28, -123, -222, -226, -133, 0, 35, 31, 0, -52, -73, -45
-};
-
-static const short ugen_H70e030a0c[] = { 
-	0, 0, -1, -2, -4, 12, 0, 12, -15, 11, -11, 4, 5, -22, 35, 303, 
-	2457, 3254, 3040, -6009, -9965, 3466, 9672, 7054, 3266, 2577, 2811, 2211, 248, -3665, -4705, -4131, 
-	-2689, -2525, -2390, -1284, -623, 133, 863, 1794, 1540, 1419, 1428, 1200, 504, -348, -249, -146, 
-	-233, -830, -1287, -1605, -1431, -961, -446, 5, 235, 670, 754, 554, 639, 597, 239, -297, 
-	-584, -601, -512, -460, -626, -483, -219, -202, -207, -31, -66, -349, -569, -571, -502, -399, 
-	-197, -100, -193, -283, -287, -262, -162, -48, -78, -215, -255, -221, -133, -80, -55, -84, 
-	-147, -183, -210, -191, -118, -75, -136, -224, -216, -100, 1, -5, -66, -66, -5, 54, 
-	93, 68, -13, -113, -204, -207, -152, -139, -185, -202, -192, -141, -35, 35, 34, -11
-};
-
-static const short ugen_H70e030a1c[] = { 
-	-7, 13, 7, 1, 6, -26, 42, -77, 124, -170, 235, -179, 3349, 5369, 6603, -4543, 
-	-17787, 3312, 14233, 7077, 4098, 4546, 4100, 1644, 12, -6938, -8443, -6174, -4149, -4106, -3289, -30, 
-	438, 1785, 2342, 2969, 2202, 1207, 1009, 880, 32, -1213, -308, -56, -2, -638, -1630, -2555, 
-	-2166, -1227, -460, 533, 913, 1101, 882, 862, 1242, 755, -5, -480, -592, -625, -956, -801, 
-	-697, -627, -94, 175, -90, -160, -81, -459, -1139, -1445, -935, -188, 31, 86, 244, 351, 
-	371, 176, -9, -39, -41, -326, -581, -479, -178, 0, 3, -71, -240, -347, -301, -118, 
-	52, 24, -185, -286, -163, 0, 96, 32, -151, -227, -148, -5, 107, 100, -79, -260, 
-	-322, -237, -54, 17, -90, -217, -241, -173, -23, 113, 87, -22, -99, -122, -58, 13
-};
-
-static const short ugen_H70e045a0c[] = { 
-	-2, 0, 0, -2, -1, -5, 8, -2, 11, -16, 11, -18, 12, -10, 0, 8, 
-	371, 2233, 2968, 2411, -6154, -8760, 3474, 9016, 6540, 3037, 2533, 2588, 2198, 449, -3032, -4056, 
-	-3533, -2423, -2443, -2198, -1364, -736, -26, 677, 1553, 1370, 1370, 1417, 1197, 507, -199, -297, 
-	-249, -298, -817, -1193, -1483, -1285, -908, -613, -93, 520, 705, 519, 498, 604, 514, 123, 
-	-321, -569, -657, -551, -391, -503, -510, -288, -130, -122, -42, -2, -211, -464, -478, -471, 
-	-510, -356, -168, -223, -365, -359, -314, -242, -82, -39, -187, -244, -171, -90, -43, -8, 
-	-62, -138, -151, -159, -213, -198, -125, -150, -226, -234, -141, -34, 0, -13, -12, 13, 
-	57, 82, 45, -28, -103, -187, -208, -169, -153, -186, -197, -165, -105, -27, 7, -3
-};
-
-static const short ugen_H70e045a1c[] = { 
-	0, 25, -18, 36, -62, 80, -113, 147, -176, 223, -275, 2126, 5706, 7140, 912, -18478, 
-	-4335, 15448, 8497, 4185, 4964, 5147, 1630, 1098, -5408, -9680, -6764, -4756, -4311, -4510, -631, 393, 
-	1421, 2750, 3235, 2842, 1347, 1322, 1035, 167, -1460, -660, -135, -105, -359, -1333, -2464, -2609, 
-	-1519, -619, 374, 930, 1109, 872, 855, 1320, 1031, 185, -389, -538, -669, -1030, -841, -853, 
-	-881, -218, 197, 8, -167, -56, -345, -1028, -1345, -953, -502, -119, 353, 442, 295, 275, 
-	206, 78, 7, -21, -327, -607, -501, -219, -61, -12, -24, -229, -347, -270, -82, 48, 
-	54, -110, -274, -217, -42, 72, 47, -139, -270, -205, -57, 83, 130, -38, -268, -342, 
-	-255, -88, 29, -29, -183, -272, -242, -21, 143, 113, -25, -149, -157, -63, 41, 10
-};
-
-static const short ugen_H70e060a0c[] = { 
-	-5, 0, 0, 0, -2, -2, -2, 8, -3, 10, -18, 17, -27, 31, -38, 43, 
-	-38, 652, 2236, 2900, 1137, -7585, -6567, 5101, 8422, 5425, 2647, 2617, 2404, 2149, 111, -2904, 
-	-3594, -2899, -2164, -2442, -1861, -1236, -730, -65, 754, 1358, 1103, 1334, 1418, 1081, 321, -237, 
-	-403, -230, -312, -897, -1174, -1306, -1370, -881, 45, 163, 220, 599, 498, 370, 519, 348, 
-	-160, -493, -503, -371, -414, -595, -568, -292, -137, -202, -134, 87, 54, -212, -388, -443, 
-	-560, -621, -424, -239, -328, -389, -338, -323, -241, -35, -16, -164, -185, -105, -36, -16, 
-	0, -83, -180, -172, -170, -244, -236, -155, -154, -229, -224, -111, -15, 15, 9, 8, 
-	21, 53, 54, 9, -39, -106, -178, -199, -172, -167, -174, -149, -126, -87, -36, -4
-};
-
-static const short ugen_H70e060a1c[] = { 
-	22, -9, 26, -30, 18, -14, -4, 40, -76, 123, 220, 4774, 6899, 6649, -11218, -16256, 
-	10542, 13152, 4577, 4513, 6135, 3023, 1311, -1257, -9515, -8643, -5234, -4396, -5418, -2450, 151, 352, 
-	2500, 3063, 3641, 2112, 1514, 1422, 955, -935, -1536, -340, -274, -213, -934, -2107, -2868, -2021, 
-	-984, 31, 865, 1055, 900, 846, 1173, 1260, 591, -169, -468, -714, -893, -754, -983, -1160, 
-	-454, 5, -39, -54, 5, -232, -801, -1170, -941, -608, -318, 206, 625, 430, 121, 122, 
-	142, 62, -29, -186, -516, -558, -342, -128, -15, -15, -154, -313, -295, -96, 57, 85, 
-	-30, -197, -262, -146, 20, 63, -79, -269, -257, -130, 27, 130, 43, -207, -349, -281, 
-	-128, 17, 31, -142, -292, -258, -55, 107, 121, -2, -147, -178, -99, 31, 29, -104
-};
-
-static const short ugen_H70e075a0c[] = { 
-	-3, -3, 0, 0, 0, -3, -3, 2, 1, 2, 0, -8, 6, -18, 30, -40, 
-	62, 11, 1342, 2442, 2762, -2409, -9043, -1351, 7577, 7027, 3664, 2515, 2631, 2340, 1834, -1101, 
-	-3142, -3136, -2233, -2187, -2348, -1407, -983, -564, 101, 1088, 1067, 887, 1440, 1350, 581, -31, 
-	-190, -335, -269, -425, -959, -1613, -1302, -441, -223, -120, 112, 338, 404, 328, 380, 249, 
-	-208, -325, -125, -186, -476, -584, -461, -395, -327, -160, -92, -8, 107, 19, -226, -349, 
-	-504, -720, -715, -433, -285, -401, -374, -277, -230, -106, 44, -25, -139, -100, -24, -21, 
-	-46, -87, -179, -216, -180, -222, -284, -199, -113, -153, -215, -162, -49, 7, 6, 10, 
-	17, 24, 32, 20, -14, -61, -128, -178, -174, -146, -136, -138, -130, -110, -55, -13
-};
-
-static const short ugen_H70e075a1c[] = { 
-	29, -21, 36, -58, 71, -91, 109, -122, 142, -178, 1412, 5987, 7883, 2627, -17444, -7978, 
-	15184, 9471, 3795, 5285, 5591, 1877, 1608, -4057, -10366, -7129, -4684, -4954, -5156, -1177, -90, 665, 
-	2586, 3436, 3265, 1836, 2024, 1590, 543, -1281, -1027, -523, -399, -341, -1529, -2780, -2759, -1579, 
-	-516, 462, 1012, 920, 798, 1012, 1256, 1055, 200, -261, -559, -872, -692, -658, -1262, -1033, 
-	-158, -105, -257, -12, 25, -484, -954, -982, -704, -362, 31, 389, 521, 283, 72, 41, 
-	91, 9, -65, -314, -554, -476, -271, -77, 0, -33, -224, -335, -205, -4, 107, 90, 
-	-81, -251, -247, -77, 26, 1, -185, -308, -221, -64, 71, 98, -53, -269, -334, -212, 
-	-30, 79, -37, -265, -304, -156, 40, 120, 50, -97, -176, -163, -47, 34, -49, -143
-};
-
-static const short ugen_H70e090a0c[] = { 
-	0, -1, 0, 0, 0, -2, -2, 0, 7, 0, 8, -12, 15, -27, 37, -36, 
-	65, -56, 847, 2225, 2846, -382, -8271, -4250, 6177, 7483, 4116, 2561, 2848, 2408, 2366, -10, 
-	-2766, -3043, -2382, -2185, -2456, -1683, -1065, -605, -196, 711, 1207, 823, 1036, 1362, 921, 16, 
-	-95, -181, -239, -386, -1200, -1424, -818, -498, -340, -158, 62, 292, 199, 166, 185, 84, 
-	-85, -91, -38, -187, -346, -290, -401, -667, -530, -123, 0, -25, 66, 74, -81, -215, 
-	-375, -723, -920, -662, -341, -325, -370, -310, -197, -13, 128, 24, -87, -55, -12, -38, 
-	-110, -156, -209, -222, -215, -246, -256, -176, -99, -115, -163, -144, -72, -4, -6, -12, 
-	4, 12, 15, 10, -11, -58, -94, -131, -139, -116, -100, -120, -130, -93, -50, -37
-};
-
-static const short ugen_H70e090a1c[] = { 
-	26, -17, 32, -53, 65, -92, 118, -137, 170, -227, 1773, 6279, 8023, 393, -17801, -4763, 
-	15114, 8459, 3849, 5256, 5053, 1955, 1642, -4797, -9983, -6330, -4524, -5420, -4856, -947, -463, 632, 
-	2348, 3312, 3055, 1766, 2238, 1912, 560, -1218, -732, -415, -467, -560, -1852, -3086, -2747, -1341, 
-	-298, 562, 951, 800, 832, 987, 1211, 923, 22, -267, -520, -770, -610, -707, -1194, -863, 
-	-194, -236, -333, -13, -44, -590, -907, -860, -602, -137, 247, 359, 350, 235, 121, 8, 
-	-1, 0, -57, -354, -553, -476, -240, -33, 14, -53, -234, -321, -192, 8, 124, 98, 
-	-80, -255, -237, -59, 18, -42, -225, -314, -218, -41, 76, 69, -75, -262, -293, -169, 
-	7, 93, -76, -290, -278, -131, 45, 112, 14, -120, -177, -146, -49, -9, -69, -137
-};
-
-static const short ugen_H70e105a0c[] = { 
-	0, -1, 0, 0, 0, -1, -2, 0, 6, 0, 6, -11, 15, -27, 36, -36, 
-	70, -58, 950, 2357, 2885, -1120, -8642, -3168, 6912, 7111, 3573, 2532, 3002, 2582, 2341, -173, 
-	-2787, -2986, -2320, -2453, -2704, -1654, -1105, -675, 13, 891, 1087, 863, 1144, 1165, 767, 265, 
-	-83, -223, -132, -871, -1285, -892, -770, -638, -398, -47, 194, 213, 119, -36, -87, 115, 
-	245, -5, -280, -244, -24, -117, -593, -779, -523, -205, -43, 33, 52, 60, -6, -148, 
-	-349, -710, -956, -767, -385, -308, -399, -359, -102, 133, 132, 41, -13, -19, -48, -96, 
-	-177, -238, -232, -239, -285, -284, -174, -100, -105, -134, -143, -106, -62, -19, -39, -48, 
-	-28, -6, -6, -23, -42, -69, -84, -94, -102, -98, -85, -94, -103, -95, -68, -73
-};
-
-static const short ugen_H70e105a1c[] = { 
-	25, -14, 29, -44, 48, -63, 73, -74, 84, -111, 1024, 5610, 7800, 2130, -15360, -8112, 
-	13320, 9908, 3960, 4683, 5077, 2613, 1851, -3244, -9300, -6487, -4237, -5271, -5336, -1594, -473, -94, 
-	1841, 3071, 2920, 1767, 2245, 2056, 1050, -699, -746, -328, -177, -490, -2030, -3063, -2814, -1459, 
-	-410, 415, 809, 710, 834, 864, 1039, 831, 107, -152, -334, -575, -663, -659, -970, -848, 
-	-363, -284, -351, -103, -36, -522, -889, -853, -564, -128, 237, 337, 278, 210, 200, 36, 
-	-61, -26, -15, -278, -540, -523, -297, -31, 36, -66, -216, -285, -231, -61, 105, 125, 
-	-37, -210, -237, -96, 0, -40, -207, -321, -250, -80, 57, 77, -43, -222, -277, -165, 
-	-5, 78, -34, -248, -286, -161, 6, 89, 26, -104, -168, -153, -84, -39, -63, -115
-};
-
-static const short ugen_H70e120a0c[] = { 
-	-3, -2, 0, 0, 0, -2, -5, 5, 0, 4, -9, 2, -6, -4, 6, -6, 
-	25, 123, 1680, 2888, 2249, -5008, -8424, 2151, 8444, 5416, 2528, 2850, 2982, 2724, 1654, -1707, 
-	-3131, -2645, -2416, -2973, -2615, -1561, -1089, -490, 497, 1457, 1058, 887, 1358, 1193, 397, 0, 
-	124, -196, -822, -927, -861, -1109, -823, -558, -351, 42, 305, 218, -75, -94, 144, 283, 
-	151, -80, -280, -173, -36, -334, -721, -659, -377, -274, -159, 28, 113, 91, -12, -198, 
-	-510, -748, -751, -542, -440, -482, -433, -174, 62, 88, 129, 89, 3, -53, -105, -198, 
-	-248, -213, -243, -312, -307, -212, -103, -67, -105, -163, -152, -86, -22, -23, -83, -80, 
-	-38, -32, -41, -51, -64, -73, -89, -84, -65, -58, -60, -60, -79, -105, -93, -89
-};
-
-static const short ugen_H70e120a1c[] = { 
-	16, 1, 8, -9, 0, 8, -25, 52, -79, 121, 0, 3641, 7055, 5481, -8887, -14126, 
-	6928, 12951, 5072, 3744, 4997, 3798, 2273, -409, -7365, -7432, -4166, -4472, -5686, -3267, -635, -696, 
-	740, 2382, 3125, 1805, 1892, 2280, 1488, 61, -577, -247, -152, -27, -1514, -2968, -2977, -1655, 
-	-757, -87, 663, 614, 704, 754, 790, 733, 273, 41, -37, -284, -645, -597, -675, -831, 
-	-636, -353, -296, -220, -19, -319, -756, -919, -681, -278, 52, 260, 281, 214, 219, 154, 
-	11, -45, -11, -138, -421, -541, -423, -152, 2, -32, -170, -253, -251, -147, 24, 122, 
-	47, -122, -232, -158, -38, -25, -142, -281, -277, -149, 0, 68, 14, -137, -243, -201, 
-	-72, 36, 38, -127, -266, -234, -62, 50, 51, -47, -161, -167, -120, -42, -41, -93
-};
-
-static const short ugen_H70e135a0c[] = { 
-	-4, 0, 0, 0, -4, -3, 0, 4, -1, 0, -11, 10, -28, 31, -46, 68, 
-	-55, 1154, 2863, 3200, -2375, -9469, -1454, 8468, 6817, 2881, 2595, 3210, 2806, 2334, -870, -3376, 
-	-2934, -2404, -3023, -3202, -1901, -1401, -998, 171, 1502, 1453, 1105, 1457, 1288, 720, 130, 0, 
-	-216, -632, -807, -904, -1150, -1001, -806, -506, -99, 158, 227, 47, -33, 219, 547, 285, 
-	-146, -216, -50, -146, -468, -693, -627, -375, -330, -334, -141, 99, 110, -33, -129, -382, 
-	-671, -596, -334, -401, -593, -476, -208, -47, 56, 150, 75, -6, -45, -120, -227, -228, 
-	-170, -228, -310, -297, -198, -111, -79, -87, -145, -178, -136, -49, -13, -72, -80, -67, 
-	-69, -63, -47, -54, -83, -101, -102, -64, -21, -11, -40, -81, -91, -86, -92, -105
-};
-
-static const short ugen_H70e135a1c[] = { 
-	-3, 22, -10, 20, -32, 37, -49, 55, -58, 69, -94, 885, 4949, 6870, 802, -13622, 
-	-6416, 12089, 9551, 3426, 3841, 4841, 3191, 1943, -2898, -7752, -5278, -3568, -4859, -5082, -1958, -829, 
-	-593, 1121, 2620, 2530, 1465, 2041, 1948, 958, -193, -196, -61, 98, -589, -2197, -3006, -2161, 
-	-1004, -690, 148, 525, 557, 620, 538, 539, 413, 223, 134, 144, -332, -652, -410, -547, 
-	-864, -691, -271, -214, -151, -122, -431, -816, -871, -550, -206, 22, 160, 231, 214, 230, 
-	175, 48, -27, -50, -215, -464, -514, -353, -160, -57, -90, -188, -234, -197, -99, 26, 
-	95, -4, -171, -232, -133, -42, -59, -170, -262, -223, -96, 13, 36, -43, -159, -225, 
-	-165, -30, 40, -8, -148, -239, -186, -35, 27, -7, -92, -170, -151, -75, -25, -50
-};
-
-static const short ugen_H70e150a0c[] = { 
-	0, 0, 0, -3, -4, 0, 7, -3, 5, -17, 16, -33, 35, -52, 70, -81, 
-	992, 3060, 3715, -1626, -9946, -2613, 8863, 7446, 2953, 2637, 3375, 2897, 2432, -851, -3784, -3211, 
-	-2503, -3250, -3492, -1993, -1457, -1203, 0, 1496, 1584, 1263, 1699, 1561, 843, 64, 56, -156, 
-	-725, -941, -827, -1132, -1233, -865, -532, -262, 14, 248, 10, -81, 379, 744, 491, 30, 
-	-177, -139, -140, -438, -858, -730, -394, -350, -294, -150, -27, 11, -55, -253, -497, -520, 
-	-335, -218, -361, -440, -291, -193, -120, -28, 81, 43, -65, -140, -208, -208, -146, -141, 
-	-232, -293, -251, -159, -105, -71, -89, -164, -205, -141, -53, -53, -89, -82, -59, -75, 
-	-84, -55, -51, -80, -121, -121, -69, -10, 2, -42, -90, -105, -73, -66, -98, -110
-};
-
-static const short ugen_H70e150a1c[] = { 
-	-4, 3, 15, -6, 14, -29, 35, -52, 68, -87, 116, -156, 1461, 5119, 5984, -2308, 
-	-13704, -1698, 12600, 7663, 2784, 3838, 4578, 3025, 1580, -3774, -6890, -4169, -3376, -4824, -4454, -1554, 
-	-1090, -599, 1170, 2540, 2065, 1399, 1990, 1656, 759, -45, -49, 86, 18, -1093, -2360, -2471, 
-	-1457, -1036, -574, 178, 367, 511, 402, 254, 301, 418, 314, 293, 138, -284, -441, -292, 
-	-579, -975, -679, -229, -165, -181, -156, -407, -785, -784, -505, -266, -87, 63, 147, 237, 
-	309, 157, 32, 46, -17, -317, -497, -458, -357, -228, -103, -64, -141, -205, -184, -101, 
-	21, 70, -55, -223, -243, -106, -31, -52, -154, -224, -195, -86, 13, 3, -75, -166, 
-	-191, -113, -8, 24, -43, -125, -165, -151, -81, -52, -51, -74, -113, -129, -69, -9
-};
-
-static const short ugen_H70e165a0c[] = { 
-	0, 0, -4, -2, 0, 8, -4, 7, -18, 19, -36, 43, -60, 78, -98, 1093, 
-	3504, 4181, -2013, -10770, -2074, 9872, 7444, 2749, 2897, 3647, 2930, 2274, -1528, -4423, -3368, -2672, 
-	-3609, -3779, -1881, -1354, -1207, 191, 1720, 1548, 1267, 1823, 1620, 1022, 151, -49, -159, -538, 
-	-1133, -1251, -1140, -1225, -927, -485, -281, 3, 205, -25, -98, 343, 779, 677, 203, -95, 
-	-34, -134, -598, -867, -676, -568, -470, -215, -77, -73, -80, -228, -462, -573, -435, -188, 
-	-153, -222, -206, -110, -27, -44, -69, -25, -74, -216, -299, -252, -157, -111, -132, -198, 
-	-243, -205, -154, -107, -44, -64, -182, -239, -145, -51, -50, -99, -112, -101, -84, -49, 
-	-34, -66, -106, -127, -110, -45, 4, -16, -82, -118, -106, -66, -70, -89, -96, -105
-};
-
-static const short ugen_H70e165a1c[] = { 
-	-7, -3, 3, 9, -6, 7, -23, 25, -48, 58, -83, 108, -142, 1531, 4722, 5186, 
-	-3241, -12713, -333, 11971, 7029, 2525, 3634, 4290, 2990, 1606, -3448, -5997, -3671, -3147, -4526, -4113, 
-	-1572, -1255, -749, 952, 2296, 1785, 1337, 1910, 1515, 832, 119, 7, 78, -227, -1315, -2142, 
-	-1773, -1259, -1150, -401, 72, 231, 338, 162, 34, 248, 508, 498, 350, 50, -55, -259, 
-	-420, -675, -906, -709, -307, -151, -169, -178, -296, -607, -763, -536, -308, -200, -29, 63, 
-	193, 258, 123, 41, 69, -5, -341, -521, -467, -321, -220, -124, -64, -100, -183, -212, 
-	-130, -15, 9, -91, -236, -238, -99, -29, -50, -140, -193, -182, -86, -17, -28, -81, 
-	-147, -161, -99, -14, 3, -45, -106, -148, -142, -120, -104, -76, -70, -93, -95, -60
-};
-
-static const short ugen_H70e180a0c[] = { 
-	0, -4, -2, 1, 9, -3, 7, -19, 22, -39, 50, -69, 93, -117, 1335, 4117, 
-	4636, -2843, -11734, -881, 11040, 7130, 2533, 3275, 3977, 2971, 1924, -2542, -5187, -3455, -2893, -4081, 
-	-3944, -1730, -1291, -982, 539, 2033, 1639, 1256, 1874, 1540, 974, 220, 3, -85, -431, -1259, 
-	-1686, -1337, -1302, -1031, -300, -157, 38, 261, 26, -89, 281, 661, 668, 317, 2, 7, 
-	-131, -553, -828, -770, -655, -403, -206, -113, -120, -145, -404, -692, -585, -325, -188, -122, 
-	-56, 21, 130, 85, 0, 15, -18, -242, -425, -420, -274, -158, -106, -89, -141, -187, 
-	-203, -164, -57, -18, -82, -204, -227, -120, -44, -41, -115, -154, -141, -82, -41, -32, 
-	-57, -112, -148, -109, -13, 20, -29, -103, -149, -130, -75, -75, -97, -96, -82, -77
-};
-
-static const short ugen_H70e180a1c[] = { 
-	0, -4, -2, 1, 9, -3, 7, -19, 22, -39, 50, -69, 93, -117, 1335, 4117, 
-	4636, -2843, -11734, -881, 11040, 7130, 2533, 3275, 3977, 2971, 1924, -2542, -5187, -3455, -2893, -4081, 
-	-3944, -1730, -1291, -982, 539, 2033, 1639, 1256, 1874, 1540, 974, 220, 3, -85, -431, -1259, 
-	-1686, -1337, -1302, -1031, -300, -157, 38, 261, 26, -89, 281, 661, 668, 317, 2, 7, 
-	-131, -553, -828, -770, -655, -403, -206, -113, -120, -145, -404, -692, -585, -325, -188, -122, 
-	-56, 21, 130, 85, 0, 15, -18, -242, -425, -420, -274, -158, -106, -89, -141, -187, 
-	-203, -164, -57, -18, -82, -204, -227, -120, -44, -41, -115, -154, -141, -82, -41, -32, 
-	-57, -112, -148, -109, -13, 20, -29, -103, -149, -130, -75, -75, -97, -96, -82, -77
-};
-
-static const short ugen_H80e000a0c[] = { 
-	15, -5, 16, -22, 18, -16, 9, 12, -23, 45, 312, 3187, 4577, 4871, -6961, -11475, 
-	5789, 10101, 4319, 3017, 4900, 3464, 1858, -470, -5645, -6096, -4303, -3344, -4193, -2511, -328, 50, 
-	1257, 1928, 2320, 1450, 1179, 1064, 874, -147, -651, -81, 0, -160, -848, -1464, -2029, -1644, 
-	-1024, -551, -36, 465, 947, 914, 952, 1079, 559, -194, -703, -687, -348, -136, -512, -978, 
-	-724, -296, -238, -193, 27, 72, 15, -127, -444, -788, -800, -397, -131, -397, -583, -275, 
-	84, 116, 67, 43, -81, -129, -79, -84, -143, -79, -96, -223, -364, -373, -238, -102, 
-	-113, -274, -371, -238, 0, 91, 18, -97, -114, -38, 67, 145, 100, -78, -194, -199, 
-	-149, -70, -70, -176, -253, -245, -144, -2, 39, -11, -138, -228, -163, 15, 144, 118
-};
-
-static const short ugen_H80e000a1c[] = { 
-	15, -5, 16, -22, 18, -16, 9, 12, -23, 45, 312, 3187, 4577, 4871, -6961, -11475, 
-	5789, 10101, 4319, 3017, 4900, 3464, 1858, -470, -5645, -6096, -4303, -3344, -4193, -2511, -328, 50, 
-	1257, 1928, 2320, 1450, 1179, 1064, 874, -147, -651, -81, 0, -160, -848, -1464, -2029, -1644, 
-	-1024, -551, -36, 465, 947, 914, 952, 1079, 559, -194, -703, -687, -348, -136, -512, -978, 
-	-724, -296, -238, -193, 27, 72, 15, -127, -444, -788, -800, -397, -131, -397, -583, -275, 
-	84, 116, 67, 43, -81, -129, -79, -84, -143, -79, -96, -223, -364, -373, -238, -102, 
-	-113, -274, -371, -238, 0, 91, 18, -97, -114, -38, 67, 145, 100, -78, -194, -199, 
-	-149, -70, -70, -176, -253, -245, -144, -2, 39, -11, -138, -228, -163, 15, 144, 118
-};
-
-static const short ugen_H80e030a0c[] = { 
-	-5, 17, -5, 16, -19, 22, -22, 23, -4, 3, 11, 421, 2929, 3994, 3505, -7892, 
-	-10254, 6375, 10370, 4729, 2534, 4130, 3279, 2213, -9, -4853, -5479, -3916, -3006, -3801, -2511, -593, 
-	-175, 673, 1621, 2169, 1358, 1285, 1152, 949, 86, -508, -151, -14, -206, -906, -1527, -1899, 
-	-1487, -927, -355, 92, 452, 724, 713, 830, 1036, 553, -168, -601, -697, -465, -335, -542, 
-	-788, -621, -219, -146, -124, 102, 115, -17, -97, -237, -612, -861, -618, -218, -350, -642, 
-	-520, -131, 148, 158, 18, -120, -99, 1, 38, -63, -133, -166, -236, -284, -334, -294, 
-	-135, -98, -207, -325, -258, -71, 53, 23, -80, -82, 6, 95, 135, 105, -24, -139, 
-	-191, -172, -114, -120, -184, -214, -191, -105, -6, 15, -4, -21, -54, -76, -26, 17
-};
-
-static const short ugen_H80e030a1c[] = { 
-	7, 4, -4, -5, 18, -40, 74, -101, 149, -23, 3016, 5166, 6681, -3594, -14262, 2224, 
-	10803, 4770, 3381, 5457, 3966, 1515, -34, -5798, -6828, -4687, -3827, -4349, -2998, -376, 180, 1485, 
-	2011, 2581, 1828, 987, 1201, 1017, -316, -926, -90, -86, -105, -474, -1364, -2148, -1879, -1348, 
-	-746, 1, 656, 1098, 911, 806, 1033, 633, -154, -519, -538, -238, 29, -539, -1166, -777, 
-	-470, -466, -152, 41, -14, 8, -123, -478, -807, -771, -333, -59, -338, -517, -129, 163, 
-	171, 145, 67, -155, -234, -107, -70, -43, -58, -235, -353, -352, -260, -115, -78, -99, 
-	-216, -360, -245, -47, 31, -16, -106, -117, -42, 69, 173, 123, -67, -198, -207, -146, 
-	-67, -85, -193, -260, -244, -191, -154, -71, -30, 13, 78, 126, 72, -45, -69, -62
-};
-
-static const short ugen_H80e060a0c[] = { 
-	-7, -2, 12, -9, 15, -26, 31, -45, 55, -62, 77, -84, 946, 3006, 3843, 924, 
-	-10653, -6351, 8932, 9322, 3914, 2526, 3827, 2737, 2329, -659, -4679, -4638, -3233, -2889, -3586, -2006, 
-	-743, -250, 490, 1614, 1899, 1152, 1412, 1238, 802, -42, -327, -229, -70, -369, -1108, -1593, 
-	-1790, -1342, -745, -8, 323, 526, 656, 498, 672, 798, 330, -285, -629, -559, -340, -389, 
-	-758, -806, -474, -127, -56, -14, 166, 103, 16, -5, -195, -642, -932, -655, -314, -482, 
-	-724, -590, -192, 153, 225, 11, -111, -28, 65, 44, -76, -158, -224, -241, -259, -351, 
-	-346, -178, -84, -184, -278, -214, -84, 11, -10, -59, -45, 13, 71, 94, 59, -42, 
-	-130, -192, -170, -118, -127, -172, -180, -161, -96, -26, -20, -31, -22, -24, -66, -59
-};
-
-static const short ugen_H80e060a1c[] = { 
-	-8, 23, -47, 56, -79, 96, -109, 136, -169, 1489, 5014, 7250, 3578, -13366, -7435, 10179, 
-	7247, 3404, 5097, 5238, 1849, 928, -3602, -7659, -5530, -4111, -4413, -3997, -1104, -37, 1039, 1754, 
-	2364, 2676, 1229, 1200, 1403, 376, -1135, -560, -144, -207, -62, -948, -2184, -2293, -1681, -1009, 
-	-30, 656, 1026, 843, 610, 890, 857, 201, -321, -499, -213, 93, -291, -1134, -1103, -646, 
-	-606, -376, -1, 80, 14, -51, -384, -725, -695, -386, -227, -286, -298, -117, 50, 177, 
-	138, 39, -5, -124, -205, -195, -128, -49, -169, -381, -388, -245, -24, 23, -61, -244, 
-	-413, -327, -92, 63, 35, -132, -225, -99, 91, 175, 142, -11, -217, -303, -236, -93, 
-	0, -85, -342, -486, -372, -33, 317, 329, 19, -258, -217, -11, 152, 120, -123, -334
-};
-
-static const short ugen_H80e090a0c[] = { 
-	-4, -6, 10, -3, 9, -13, 11, -14, 3, 5, -12, 28, 256, 2397, 3465, 2760, 
-	-7129, -10355, 4792, 10632, 5486, 2357, 3458, 3212, 2523, 1074, -3326, -4557, -3459, -2658, -3487, -2821, 
-	-1130, -670, 14, 1136, 2024, 1216, 1275, 1579, 975, 118, -257, -208, -234, -191, -827, -1531, 
-	-1857, -1407, -602, -172, 65, 532, 632, 410, 549, 638, 260, -150, -385, -387, -356, -439, 
-	-594, -772, -659, -292, -46, -3, 152, 190, 105, 13, -82, -380, -831, -894, -528, -417, 
-	-666, -724, -393, 52, 240, 120, -18, 21, 94, 87, -50, -193, -253, -264, -284, -343, 
-	-337, -180, -92, -161, -257, -226, -109, -20, -17, -54, -22, 1, 21, 51, 51, -27, 
-	-121, -175, -176, -135, -100, -104, -115, -124, -96, -35, -37, -60, -53, -45, -77, -97
-};
-
-static const short ugen_H80e090a1c[] = { 
-	-4, 14, -39, 50, -78, 103, -137, 176, -207, 2143, 5579, 7778, 837, -14894, -3691, 10886, 
-	6069, 3533, 5400, 4588, 1581, 588, -4675, -7399, -4979, -4065, -4542, -3724, -771, 12, 839, 1633, 
-	2576, 2380, 1270, 1584, 1468, 107, -1001, -416, -425, -159, -87, -1409, -2509, -2250, -1507, -673, 
-	219, 881, 906, 522, 633, 901, 656, 42, -335, -376, -25, 136, -434, -1168, -1035, -721, 
-	-692, -378, 33, 117, 62, -114, -488, -697, -490, -266, -367, -349, -96, 7, -36, 61, 
-	152, 195, -35, -253, -310, -201, 35, -59, -358, -428, -260, -87, -28, -35, -119, -288, 
-	-360, -236, -40, 24, -35, -188, -207, -52, 105, 173, 94, -103, -275, -325, -182, 16, 
-	13, -261, -477, -389, -95, 263, 313, -11, -298, -228, 1, 163, 83, -128, -290, -324
-};
-
-static const short ugen_H80e120a0c[] = { 
-	-4, -2, 14, -6, 14, -20, 24, -31, 31, -31, 37, -34, 537, 2748, 3761, 1672, 
-	-9278, -8159, 7512, 9937, 4127, 2288, 3819, 3179, 2576, 251, -3980, -4344, -3025, -2898, -3757, -2511, 
-	-1172, -790, 83, 1500, 2150, 1244, 1386, 1552, 937, -117, -342, -223, -216, -221, -1058, -1844, 
-	-1764, -896, -466, -374, 230, 621, 372, 362, 651, 563, 43, -150, -127, -337, -519, -371, 
-	-477, -864, -718, -231, -69, 6, 113, 126, 156, 82, -130, -526, -815, -731, -473, -512, 
-	-719, -643, -201, 132, 109, 67, 101, 91, 78, 35, -106, -219, -242, -279, -388, -389, 
-	-234, -105, -111, -190, -221, -160, -78, -28, -59, -70, -32, -4, 13, 29, 2, -80, 
-	-133, -158, -140, -97, -74, -84, -99, -92, -57, -37, -47, -56, -69, -97, -105, -69
-};
-
-static const short ugen_H80e120a1c[] = { 
-	-5, 21, -40, 45, -61, 69, -76, 86, -111, 1002, 4597, 6852, 3736, -11720, -8299, 9297, 
-	7974, 3238, 4501, 5223, 2450, 1235, -2691, -7002, -5295, -3774, -4392, -4348, -1549, -381, 127, 1184, 
-	2289, 2554, 1402, 1672, 1750, 709, -754, -508, -286, -389, -116, -1117, -2398, -2293, -1459, -817, 
-	-143, 720, 896, 522, 657, 790, 571, 43, -237, -297, -40, 183, -189, -887, -1004, -780, 
-	-799, -518, -60, 138, 83, -57, -342, -606, -527, -268, -311, -433, -229, 0, -28, 30, 
-	143, 164, 20, -199, -292, -188, -27, -48, -264, -390, -307, -173, -25, -14, -74, -206, 
-	-336, -290, -106, 9, -15, -131, -213, -116, 38, 128, 120, -7, -187, -282, -211, -60, 
-	24, -49, -259, -375, -270, -48, 135, 153, -42, -204, -158, 12, 131, 91, -96, -234
-};
-
-static const short ugen_H80e150a0c[] = { 
-	-8, 11, 0, 4, -4, -2, 10, -20, 38, -57, 91, 12, 2172, 3847, 3739, -5253, 
-	-11418, 3117, 11042, 5360, 2109, 3727, 3924, 2650, 1293, -3281, -4982, -3456, -2816, -3956, -3332, -1241, 
-	-1134, -447, 1200, 2359, 1695, 1501, 1706, 1118, 224, -318, -367, -340, -58, -814, -1816, -1908, 
-	-1071, -603, -568, 85, 512, 266, 338, 678, 672, 315, 27, -138, -310, -433, -272, -298, 
-	-831, -898, -429, -202, -167, 24, 172, 99, 10, -18, -371, -788, -643, -325, -497, -723, 
-	-513, -111, 13, 40, 128, 50, 11, 33, -19, -128, -111, -114, -300, -438, -360, -191, 
-	-105, -102, -167, -248, -213, -109, -19, -22, -79, -86, -64, 12, 60, 12, -77, -136, 
-	-159, -146, -92, -55, -76, -97, -103, -65, -18, -14, -30, -64, -121, -142, -76, -6
-};
-
-static const short ugen_H80e150a1c[] = { 
-	12, -5, 11, -24, 34, -56, 80, -107, 146, -157, 1974, 4780, 6034, -1575, -13033, -798, 
-	10923, 5709, 2660, 4626, 4588, 2273, 881, -3950, -6329, -4176, -3391, -4594, -3702, -1019, -787, -13, 
-	1332, 2506, 2000, 1448, 1883, 1542, 319, -705, -305, -282, -212, -594, -1716, -2315, -1694, -872, 
-	-676, -118, 660, 602, 574, 771, 676, 287, -99, -207, -175, -48, 59, -241, -911, -871, 
-	-706, -711, -400, 0, 179, 56, -115, -322, -569, -552, -275, -270, -511, -336, -33, -29, 
-	-7, 184, 214, -98, -271, -239, -136, -6, -42, -271, -382, -257, -125, -130, -129, -100, 
-	-183, -313, -250, -79, -16, -34, -117, -172, -103, 38, 99, 32, -69, -168, -224, -148, 
-	-23, 3, -104, -207, -186, -92, -30, -43, -121, -230, -169, -5, 70, 56, 7, -42
-};
-
-static const short ugen_H80e180a0c[] = { 
-	7, 4, 2, 1, -12, 22, -38, 61, -84, 123, -86, 2086, 4288, 4776, -3685, -12163, 
-	1616, 11096, 5364, 2253, 4158, 4312, 2516, 1092, -3617, -5632, -3729, -3081, -4319, -3530, -1140, -1008, 
-	-394, 1240, 2485, 1815, 1570, 1874, 1323, 219, -472, -307, -351, -108, -787, -1869, -2070, -1246, 
-	-654, -640, -55, 466, 353, 491, 766, 665, 294, 32, -125, -279, -331, -51, -174, -902, 
-	-887, -560, -496, -311, 11, 181, 87, -63, -209, -481, -612, -404, -318, -557, -519, -188, 
-	-45, -44, 81, 157, -7, -116, -106, -140, -137, -83, -139, -271, -299, -219, -202, -161, 
-	-135, -174, -273, -263, -90, -4, -6, -74, -122, -96, -11, 68, 23, -73, -156, -205, 
-	-151, -53, -9, -74, -138, -140, -71, -4, -15, -40, -99, -162, -171, -127, -75, -37
-};
-
-static const short ugen_H80e180a1c[] = { 
-	7, 4, 2, 1, -12, 22, -38, 61, -84, 123, -86, 2086, 4288, 4776, -3685, -12163, 
-	1616, 11096, 5364, 2253, 4158, 4312, 2516, 1092, -3617, -5632, -3729, -3081, -4319, -3530, -1140, -1008, 
-	-394, 1240, 2485, 1815, 1570, 1874, 1323, 219, -472, -307, -351, -108, -787, -1869, -2070, -1246, 
-	-654, -640, -55, 466, 353, 491, 766, 665, 294, 32, -125, -279, -331, -51, -174, -902, 
-	-887, -560, -496, -311, 11, 181, 87, -63, -209, -481, -612, -404, -318, -557, -519, -188, 
-	-45, -44, 81, 157, -7, -116, -106, -140, -137, -83, -139, -271, -299, -219, -202, -161, 
-	-135, -174, -273, -263, -90, -4, -6, -74, -122, -96, -11, 68, 23, -73, -156, -205, 
-	-151, -53, -9, -74, -138, -140, -71, -4, -15, -40, -99, -162, -171, -127, -75, -37
-};
-
-static const short ugen_H90e000a0c[] = { 
-	4, -15, 25, -40, 62, -80, 118, -72, 2019, 4377, 5861, -902, -11452, -1185, 9079, 4799, 
-	2576, 4816, 4370, 2143, 574, -3633, -5592, -3943, -3190, -4100, -3271, -1130, -481, 513, 1268, 2171, 
-	1955, 1146, 1255, 989, -221, -779, 133, 459, 256, -480, -1586, -2273, -1905, -1099, -431, -1, 
-	354, 546, 418, 650, 930, 677, 144, -283, -373, -346, -97, -140, -815, -1127, -689, -357, 
-	-271, 104, 74, -124, -119, -95, -274, -591, -606, -360, -363, -646, -562, -76, 189, 91, 
-	41, 0, -122, -221, -169, -54, 58, 52, -194, -452, -386, -119, 22, -106, -439, -606, 
-	-423, -73, 135, 50, -74, -10, 92, 169, 172, 78, -114, -262, -268, -221, -145, -99, 
-	-137, -197, -198, -117, 5, 69, 28, -58, -126, -123, -19, 68, 37, -68, -131, -140
-};
+/* HRTFSet file format (all values little endian):
+ 
+	char[4]		"UGHR"
+	uint32		version (1)
+	uint32		number of responses (N)
+	uint32		number of channels (2)
+	uint32		response size in samples (L)
+	uint32		sample rate
+	uint32		encoding (see HRTFSetInternal::Encodings)
+	int16[N][2]	elevation and azimuth of each response in degrees
+ 
+ Then for the Float32 and Int16 encodings the samples as [N][2][L] floats or shorts 
+ (shorts are scaled by 1/32767). For the Int16Rice encoding a uint32 byte offset 
+ for each response (from the end of the offsets) then for each channel of each 
+ response the differences between successive samples in blocks of 32 samples. Each 
+ block begins with a 4-bit Rice parameter k followed by each zigzag coded difference 
+ as the quotient in unary (ones terminated by a zero) and the k low bits, most 
+ significant bit first. Each channel starts on a byte boundary. */
+
+static const char ugen_HRTFMagic[4] = { 'U', 'G', 'H', 'R' };
+static const unsigned int ugen_HRTFVersion = 1;
+static const int ugen_HRTFHeaderSize = 28;
+static const int ugen_HRTFRiceBlockSize = 32;
+
+/** The KEMAR data in the Int16Rice encoding as base64 text. */
+static const char* const ugen_HRTFKEMARData[] = {
+	"VUdIUgEAAABwAQAAAgAAAIAAAABErAAAAgAAAPb/AAD2/wUA9v8KAPb/DwD2/xQA9v8ZAPb/HgD2/yMA9v8oAPb/LQD2/zIA9v83",
+	"APb/PAD2/0EA9v9GAPb/SwD2/1AA9v9VAPb/WgD2/18A9v9kAPb/aQD2/24A9v9zAPb/eAD2/30A9v+CAPb/hwD2/4wA9v+RAPb/",
+	"lgD2/5sA9v+gAPb/pQD2/6oA9v+vAPb/tADs/wAA7P8FAOz/CgDs/w8A7P8UAOz/GQDs/x4A7P8jAOz/KADs/y0A7P8yAOz/NwDs",
+	"/zwA7P9BAOz/RgDs/0sA7P9QAOz/VQDs/1oA7P9fAOz/ZADs/2kA7P9uAOz/cwDs/3gA7P99AOz/ggDs/4cA7P+MAOz/kQDs/5YA",
+	"7P+bAOz/oADs/6UA7P+qAOz/rwDs/7QA4v8AAOL/BgDi/wwA4v8SAOL/GADi/x4A4v8kAOL/KgDi/zAA4v82AOL/PADi/0IA4v9I",
+	"AOL/TgDi/1QA4v9aAOL/YADi/2YA4v9sAOL/cgDi/3gA4v9+AOL/hADi/4oA4v+QAOL/lgDi/5wA4v+iAOL/qADi/64A4v+0ANj/",
+	"AADY/wYA2P8NANj/EwDY/xoA2P8gANj/JwDY/y0A2P8zANj/OgDY/0AA2P9HANj/TQDY/1QA2P9aANj/YADY/2cA2P9tANj/dADY",
+	"/3oA2P+BANj/hwDY/40A2P+UANj/mgDY/6EA2P+nANj/rgDY/7QAAAAAAAAABQAAAAoAAAAPAAAAFAAAABkAAAAeAAAAIwAAACgA",
+	"AAAtAAAAMgAAADcAAAA8AAAAQQAAAEYAAABLAAAAUAAAAFUAAABaAAAAXwAAAGQAAABpAAAAbgAAAHMAAAB4AAAAfQAAAIIAAACH",
+	"AAAAjAAAAJEAAACWAAAAmwAAAKAAAAClAAAAqgAAAK8AAAC0AAoAAAAKAAUACgAKAAoADwAKABQACgAZAAoAHgAKACMACgAoAAoA",
+	"LQAKADIACgA3AAoAPAAKAEEACgBGAAoASwAKAFAACgBVAAoAWgAKAF8ACgBkAAoAaQAKAG4ACgBzAAoAeAAKAH0ACgCCAAoAhwAK",
+	"AIwACgCRAAoAlgAKAJsACgCgAAoApQAKAKoACgCvAAoAtAAUAAAAFAAFABQACgAUAA8AFAAUABQAGQAUAB4AFAAjABQAKAAUAC0A",
+	"FAAyABQANwAUADwAFABBABQARgAUAEsAFABQABQAVQAUAFoAFABfABQAZAAUAGkAFABuABQAcwAUAHgAFAB9ABQAggAUAIcAFACM",
+	"ABQAkQAUAJYAFACbABQAoAAUAKUAFACqABQArwAUALQAHgAAAB4ABgAeAAwAHgASAB4AGAAeAB4AHgAkAB4AKgAeADAAHgA2AB4A",
+	"PAAeAEIAHgBIAB4ATgAeAFQAHgBaAB4AYAAeAGYAHgBsAB4AcgAeAHgAHgB+AB4AhAAeAIoAHgCQAB4AlgAeAJwAHgCiAB4AqAAe",
+	"AK4AHgC0ACgAAAAoAAYAKAANACgAEwAoABoAKAAgACgAJwAoAC0AKAAzACgAOgAoAEAAKABHACgATQAoAFQAKABaACgAYAAoAGcA",
+	"KABtACgAdAAoAHoAKACBACgAhwAoAI0AKACUACgAmgAoAKEAKACnACgArgAoALQAMgAAADIACAAyABAAMgAYADIAIAAyACgAMgAw",
+	"ADIAOAAyAEAAMgBIADIAUAAyAFgAMgBgADIAaAAyAHAAMgB4ADIAgAAyAIgAMgCQADIAmAAyAKAAMgCoADIAsAA8AAAAPAAKADwA",
+	"FAA8AB4APAAoADwAMgA8ADwAPABGADwAUAA8AFoAPABkADwAbgA8AHgAPACCADwAjAA8AJYAPACgADwAqgA8ALQARgAAAEYADwBG",
+	"AB4ARgAtAEYAPABGAEsARgBaAEYAaQBGAHgARgCHAEYAlgBGAKUARgC0AFAAAABQAB4AUAA8AFAAWgBQAHgAUACWAFAAtABaAAAA",
+	"AAAAAHIBAADlAgAAVgQAAMMFAAAwBwAAmAgAAPwJAABbCwAAswwAAAcOAABXDwAApBAAAO4RAAAzEwAAdxQAALwVAAD8FgAAPRgA",
+	"AH8ZAADGGgAAEBwAAFsdAACmHgAA8B8AAD0hAACOIgAA4iMAADUlAACHJgAA2CcAACYpAABzKgAAwCsAAA4tAABeLgAAry8AAAEx",
+	"AABvMgAA2jMAAEQ1AACvNgAAGDgAAH85AADhOgAAQDwAAJs9AADzPgAASUAAAJ9BAADyQgAAREQAAJJFAADfRgAAIkgAAGlJAACx",
+	"SgAA+UsAAEJNAACQTgAA4k8AADZRAACNUgAA5FMAAD1VAACXVgAA7lcAAEJZAACVWgAA6FsAADpdAACNXgAA418AADlhAACRYgAA",
+	"A2QAAHRlAADlZgAAVmgAAMdpAAAzawAAmmwAAP5tAABdbwAAu3AAABVyAABrcwAAvXQAAAt2AABadwAArHgAAAB6AABWewAArHwA",
+	"AAV+AABhfwAAwYAAACKCAACFgwAA6YQAAE+GAAC1hwAAGokAAIGKAADmiwAASI0AAK6OAAASkAAAeZEAAN6SAABFlAAAqpUAAAqX",
+	"AABmmAAAvJkAAA+bAABfnAAArJ0AAPWeAABAoAAAiqEAANeiAAAmpAAAd6UAAMmmAAAgqAAAeqkAANWqAAAzrAAAk60AAPCuAABP",
+	"sAAAsLEAABCzAABwtAAA2rUAAEK3AACnuAAAD7oAAHS7AADUvAAAMr4AAJC/AADrwAAARcIAAJ7DAADzxAAAR8YAAJXHAADiyAAA",
+	"LcoAAHnLAADIzAAAFs4AAGfPAAC60AAAC9IAAFvTAACr1AAA+9UAAE/XAACk2AAA9tkAAEnbAACc3AAA790AAD/fAACR4AAA5OEA",
+	"ADjjAACR5AAA7eUAAFXnAAC56AAAGuoAAHnrAADZ7AAAN+4AAJLvAADt8AAASPIAAKPzAAD89AAAU/YAAKb3AAD2+AAARfoAAJX7",
+	"AADm/AAAOP4AAIz/AADgAAEAMAIBAH4DAQDJBAEAFAYBAGMHAQCzCAEABQoBAFYLAQCmDAEA9g0BAEUPAQCREAEA3REBAC8TAQCD",
+	"FAEA1RUBACkXAQCLGAEA7RkBAE4bAQCqHAEABx4BAGUfAQDCIAEAHyIBAHojAQDUJAEALCYBAIQnAQDZKAEALCoBAH0rAQDOLAEA",
+	"HS4BAGsvAQC5MAEABTIBAFEzAQCgNAEA6zUBADc3AQCEOAEA0TkBAB07AQBsPAEAvD0BAAo/AQBYQAEAp0EBAPdCAQBIRAEAm0UB",
+	"APJGAQBMSAEAsEkBABFLAQBxTAEA0E0BACtPAQCHUAEA4lEBADtTAQCSVAEA51UBADpXAQCLWAEA2VkBACtbAQB8XAEAy10BABxf",
+	"AQBuYAEAwGEBAA5jAQBYZAEApGUBAO9mAQA6aAEAh2kBANRqAQAhbAEAb20BAL5uAQAOcAEAYHEBALpyAQAYdAEAd3UBANZ2AQA3",
+	"eAEAk3kBAO16AQBDfAEAmn0BAOx+AQA+gAEAj4EBAOCCAQAuhAEAeoUBAMaGAQARiAEAX4kBAKqKAQD5iwEARY0BAJGOAQDbjwEA",
+	"I5EBAG+SAQC7kwEACpUBAFeWAQCjlwEA+5gBAFiaAQCzmwEADp0BAGWeAQC7nwEAEKEBAGOiAQC1owEABKUBAFOmAQCipwEA7qgB",
+	"ADiqAQCDqwEAzawBABiuAQBjrwEArbABAPexAQBEswEAk7QBAOS1AQA+twEAmLgBAPO5AQBMuwEAo7wBAPu9AQBOvwEAocABAPLB",
+	"AQBDwwEAlMQBAOPFAQAzxwEAg8gBANLJAQAfywEAbMwBALnNAQAJzwEAa9ABAM3RAQAs0wEAjNQBAO3VAQBN1wEAqtgBAAXaAQBg",
+	"2wEAutwBABPeAQBr3wEAw+ABACXiAQCF4wEA5+QBAEnmAQCn5wEABekBAGHqAQDQAoAZAOAGMCAArwOwElBRgU0FwAs4eMhhdkBi",
+	"QFMKuKu5+OMVzfhh2OBdeD4YPyqRlf3ynJWpiJifKO9f8Yg0/DVuKcAS1mzLXGytdWmikHLrfu2xWkC0Pa4CHhHF+RfwecpAMIwF",
+	"EFA0dE0te8GmDfy6ZN3ISbO4tDF7aGjDy72S69a7HNJVweuJ8cIouKcEA7pIaY7gRkftelzf6fny7Sa0HpOUlscUsUohqrg8m9GL",
+	"IqeEtJgNTNACgBkA4AYwIACvA7ASUFGBTQXACzh4yGF2QGJAUwq4q7n44xXN+GHY4F14Phg/KpGV/fKclamImJ8o71/xiDT8NW4p",
+	"wBLWbMtcbK11aaKQcut+7bFaQLQ9rgIeEcX5F/B5ykAwjAUQUDR0TS17waYN/Lpk3chJs7i0MXtoaMPLvZLr1rsc0lXB64nxwii4",
+	"pwQDukhpjuBGR+16XN/p+fLtJrQek5SWxxSxSiGquDyb0Ysip4S0mA1MwAAAGAHgJgI4GIEeDOCFhOAqYYoCDjAC+n51/TnXuG8Z",
+	"+WohyOA3w3XQ/fpZfd4/N8V5/soe96wGnQl3kAfW0E9pO1vNDqlSR7L60N8AuSYefirnyvnL7kQ1liXg/6UjmAhYaAhgFZiJ646Z",
+	"96VsCih+jX9qo4Wd0Jg4JZsxInYNFKZ0bo0Tg/BZuiwsjiOnQTIokxPgJuyW+T2/D/T4UwaTT224CapgtGzTHDo2DTkSSokXSR0I",
+	"0APAPgG0CEApwMQDJApAFcAuAH2xiWpd99EkdocxeXRNK0pjDqnttanHDfQt+czD6XXLbmJjTGR2gZ+NLWntu5xpvBerL2wdO6kr",
+	"3Z5Xix27zVhg6D/vV3JI6AIlyqUwP2QUOMbevWq2SuXiyaDuDBHWYF5sHCY7+5ySGbOQDa9Ti4dl8ItEA5/FVdKclXZTgqg6+laz",
+	"2oKH1/HV/m+VspI4WbYMKUmJ0ZUUCNzFBnctHSZomhUgNQWXNwDAA4AoACABAIAKQIQGkE8DfCMBPQwgKrFPGvfk2dos2KtD/TcH",
+	"9sWHfzaur7/Xqu/LsXVvUW8yRIxV/8MPqU/4YAU5jeaLv21qgUxae6npNxfPL5y0WziSJiL3jGUQnkapaDITIsQc2us9Ie6GOqw1",
+	"NO34Czkbqo39fggp6VkmuyOn75xKMyrOaeWQ3REbIwAxZKxpUX0Kv+T8v9X+++UkHuehzMrQF2Rrijx0/dOMLDycjMDQCQBTAWAF",
+	"sBKACwHMEgBmwbhAqwF7owdzR69Nd37qJpMmf/k43HetBF+sc8IelVXiLsz42HTFdUa/MfDTK9osdLxXISuCjwAJRvmfufRhuBDi",
+	"PryESwk8pCyofnY6u1AegcBMDdrJtWoQm9tOhhjfHNwneYD8pPDndzKpDnoeP2GVjmPmtohbRbXwEDChb0tIBUYKET9aAVmd+DvO",
+	"v62vnbtgG+aVBniILbSEo52Rzeln4+fURegUsBiNGIDAAAAcAUADABABgC4CgCGBqBQg1AeISAOBfgMn/J/6LI5VFR9b0bmqfa7T",
+	"GwfIU79noZq2/e96/aunj/Yv4Mv5+kZYNeDTrixQh/kK7g9r8tyu9tqM5NnOlHx7HIHLV9CQjI4Qny8m7OaS2Nl6dGku5bZFULqO",
+	"M9XcRImTxVX6ZSM01GMSTFKeWBBNkZLgVKZlLDrcTy/6/g+b+bgrMOWuZyJ0wQsew48tjzQlEae6gNAAABMAsAawOYGlCdgxsOUF",
+	"bMn6ySPvC/dZGsdaW66xoWKLL1o6c//sb+Gua6N5p2nNc6ouTcp31JZcmbh7Hu5bQd8/fQaV99ZEFa4BsE7q4JAYShuR1c6XJrza",
+	"XghI64qAfaZbeqzJ5rSpXJRhg4p8dHSsSvcHlYUSV5WI1hwm6cX88yCWMRxzkwDBfEVoFQpYETUVuYMUzbrzHH9hJ2lGt25Z8+UL",
+	"DDGYhh3FxWT0FRFRp+cmDHHYXFVcLMAAAAQAoAgACACABADwDwDECUBzBQArwXwoqvycO9H3jGiyTq3gckTkxHP3XsHopdNruqJz",
+	"vSg1/qS3ufwc8EX7TGlYB+M7oMyYnrmw4P82r1k26iT5yqRGoZvYUwEifpXAWhsBMDKcsebm/efOyfSfRZ5zxErXtnDhfHoVH6S/",
+	"xndb+8FOcpVCDFa4TYsfmzEe8nrvxexj7eBCsn1VgDCNw8Dn0CQ0PalFgWBnaMDQD0CUA/wYwIzCyAzUPEBHcKUNEfmfel3RORK5",
+	"8c4n5dYt6JQJefxnULq8Ro7T61v9k2Z1cW1xyak2PbJ4XfgvWdtFG4Y5J7AtT/VMtK+LSzfDKAJloVYgea4GisCqXiUAEWge6u1e",
+	"bCrWpGNELGXCX9HBUneMusp+qjlRQWzOL9uHvG3YMonCePoGNsrYIeh+pZ6TGFm9IuMX63f/gSJoJhviPhNFeeijtSOHY+10+xdo",
+	"3tlgpD2XJHD8/lUAsAMAQAMAMAgAUAYAAAcBYCkDgFMHYIUIYtLgJVC/vd9aZTyuL8LCSpnW6anWc/sM+vT7iGZzX/PL+vTb5+QX",
+	"PN+dZllQe67dRgDFnIpqlvDfwzXUGe91kGpgb5FkC6fIKgTBOB5BBHW9Hbs3+mz+v4DBsCNIF2zSg2eSxly+Nqtdpb8A4urTgEbK",
+	"IvCC+h6XPBzt//Z+jBuhjWN7laB5LSgQJR4iVZoKPs8U0BOA7wWwG9B0AcEICCGZvtMFvm3IgfvgDbH1DoCtyafbVpfF+j44pz59",
+	"pleN5l4gET+YTLK/rxYnGttbnZfW63gYS05Dss6fOCMtz7UM5fFUK+CbrdMwVDMW4BEVkogEI22B+xyaumSwWCIFKY+MEiBE+dUf",
+	"BV4T5thGYndMu2n2HdK0kHJtmV8d4upiMHVQ0nVGkX0xcBySv37SkuBsnYNwicClClD6DnC6areBpJ29iEgj1qvDcPJc5aSQsAAA",
+	"EAIAAAUAYAAAIAEAAAwCEDIEUFwGEGAqLRokd/B34ESoFc/y4psmOXk2dGz84XzrfAQrtr/36/Npo++nnPJ93R+qR9w22yysZsXW",
+	"F2aNXEkuo08rrFpiBq8JgM2Hg+gRRzFoDE9rZzDc/GYHBbvHoUvsHKsuBJIuOtfVx+d1lWIHV4cg4qiBErPreVh14nl/l24ZqzhW",
+	"p2oDMVqIC6uDa1EkSc/d0BJAhgHUAcAZALsCeU9M9A7b3xtHl4Qn5odUesyw+/6ZRN80p8R57vgsS5tbigTjdVH2jjCklY1Jdbxl",
+	"Maubm669D76/jbvWc//wP5sfb4amZnzOYRsTHpuM4p1uxQHX34xWwkyByakfI2n8fT8jgRoD8ecOSNgwqWDDscy3w3q8On+8YEpY",
+	"iwtTEXQRM0RPFurgu1jLrJt1uJIONZ6z8VzBqAwVqpiC5wNs9La4lnfYLrPAXGEKa/j0pACwAAAAAQAAAgCQCgAAAAAAAQCAGQKA",
+	"NQRARQSCJsQ5pnyUclxUarT1rpzlwu9lzcPhb+WXX5WuD3/Gf4OsEXjFxBeYhiCk8+2SqVsHseE3Ni4wYi75TMuOOSc90xrDXN8N",
+	"AGIPBPHi0vt7NdeYkNDxswlEFJOpYYSpiMqt4Kg1OWwZGgcWjCyUqy0AuV2NNVbi+SG9VQGEoZE5kVJiDDlNVqQEPLvg0BPA2AZM",
+	"JkDIw+oGM0U6Nk/LB7YpXuK09forxHEUNt+7In8/fzkRh4x52MVOMjyGNMXNoSDKUUiA6mCd6XBPh4cfTjiFJP9JeunrmSjiF87H",
+	"KgjTsSwkKLJIU5C9WMarvZTY7UllVTSWSBYYBgI/lDrQ1YqemS3Cn5V0rxOtyvEZCrQZlKoI6iqQnIWXyqgVE8pwrW8xsJR5T7D9",
+	"15osCwkPlTpiy12P7utrZ05iMx2G2yVFL7PDqQagAAAAAAEAQAwAgGAAAIAIAQEARA8DMJQQwcGe52lS/xY8DktnAL+ArcFsF4XP",
+	"znfzZ1/n78sV+f8WuUrDJyPvo8GFJyOaxsiSPwSt+p7xghdKzPSnUqSfzRwxKWHcvhBgwACtrNhU6Epg/k7PhfkRPCCXnvN83dWC",
+	"2dYCN3sYg85sJJ+5XKhBYmAyZOo1RBbK8dXAvMLBpMPhTIihTevH0CaBtwnILjDghDGoYTvr5n/JCd3UosmSKSHUl64/Zitv4bar",
+	"4VPy8ZtDCPslzgMsoaQnAFpBCGJgBEUSq0Tys9Vvh/wj3E0h04QJzz9gHRgHDhE1WEpOYF06MXMBsIcXMJcI5kSPlYW4ZQUlDUe9",
+	"gTTlsTDHrVhG3eO6XEKNDtDBgTwhBkvRY3hc/SIZDLHcH1LbpJdpfNE5pqiMHtzBRYSTo2KAFnlcBNwwugFCkkujgNFXVvLRIJAA",
+	"AAAAAAQCAMAAEAEAgAAMBAFAgFQ4EMTDm+fyDf/RvYLaT2H/0y/ELhr3Q/+4VepP/KXk+QD+McEVyFcZ1ObC6pKMpWpAkcE5aob6",
+	"URrDLp1jrIUBkaLFlVEUScj4RzO8VxAral734vH7fy8H12AR5LkBqTARUyIUaniTMJA0VM9UAQxO5sEzsKhPu158PVJmaUCI9EgN",
+	"oqTAbt980ARAJwLYFHBajO7Z9trD9s9z0zLmsNwIJVRPmQw1b+KP0rfPrqKaNpLxSnKOArb0hUCTUPxHwDLRQlCCrGL/Fr3i47Ri",
+	"5uZejva1dkHj+DXax1NANIQBwu7PYrVwznwmrXW2ZcvCxERAofhM88O1L2yN9rZ7bu/5j4STVE0x5kjNCyaVadbp9LXOSH9FseR9",
+	"xx1PYx6j67zGuJX2UxNLQl9hTYfN4XEuIRxhLrYcRURtjb3YckCQAAAAAAAAAQAAAAwEAIAgBAsFARAYBASB8NBu8RMJv9d0b345",
+	"s/Kb9Ynhp5XyQYDf7n2PGg/L7KfvyXGg3ZBjQCPA1Zw2uAV+RLZzznoBmPbea4Ew8VwKWCEk4+THqbgKYfgafD9nwex1aHXUAXHc",
+	"YCXZYxOkxUz0qeCDtmytT2CoM7pSBudEt5tXH4s0qxc1sCklDbVqFT6scNA+Ql4NPERBL3ANoWl+GDvjPaZMBEXRJM7q32GXfEE/",
+	"ELcXsDV2KV+AViztEcSoZAz4NfOiAWIJYmGgH5X91fxQ84871ctIeHRzpiOESjhunPM+oWJMCokxj7V3LTRSY836pwTroV0OAlE9",
+	"SLHZvjSB2WfpvAfdfXTGroenSSHh2QSy9Z5OgeyrRlSaXRc34+/j7Yr2nnNwmwHODszSn4jVYni5HBgp6mgoqo57kBFjZ2cOBGiA",
+	"AAAAAAAAACAAAAgAAAIBwECAiEAECAeMAH9vfn7/73/aPzlyz6U//wFZlB39KRqP3M3uqi9C98uzwWrzc0WfgwJI5Jh8CfWwdmt9",
+	"nYK06uXCsY4T5KFKCYIQ3854COhLRbr2cz5/tTtDK5zSMJTgALesURJcG/vVoAycXrTqagydLeWE6UbT4uHJ12Y2hsVKiMEJRAgi",
+	"nTDQGUEUBtwd4sG4Hdrhv3MHhWHPSoEU62sYne4tDv/AxxT6p6Q4dVsMN2ysQCeUn/wUrYblAIYNJIj5Z6tr9gfZShWDjlViOesU",
+	"uwy0RPHEFlSP6PIG4MIG3tpxr/k3FuJ8sZFEaIAENIRFcR9+SeKYb3lPI/EfvM5F9dmWtAqfOJY8cuywIwdljSbPanddpmIAJNtu",
+	"00E5XcJspOldo9Eq6nm7k7OYy4bKr7oMonwOPmQwVWCAAAAEAACAAAAAAAAAAAEBAOAgIAwUAQMCASE+9v6c/bf/xP5mAgM//jSo",
+	"7Bt9wkP35ydYdJ3NnvDynQPPnd5TEaMAVui0lAhDLDHeccZiL2xiCLcLkbxhBZN7D85wRScFiom1ue/rRBNPXZoRDSSF3JSSFGFC",
+	"XdSKILY5kiiNMXf1s5Gghl7oAFkWRjNHwYF6QYO4XbDQKYGfCXA7mg1ZPl+Qg7X39E+v2BNyy687OpNH4ADxUXDshMgnPD2JTKLI",
+	"FcEU4NSg/WJwCBAjSubDLsU9n+Tv5E4HZN+YfpElsouekKu838TH8OcXAURPFli8kfA+UpaouixoMcpE0uVRtKK/1qJdl1WDSf63",
+	"7iLXOV7NLgcarkErHMKVFc1Q2aFrND3nXROLIDc9jhkFxXwgbOpSMs4tepz+TQaLZXQSa0GcVR9LQsxh0eCAAAgAAACAgCAAAAAA",
+	"AAABAGAAAAgIBQoBAqBQDn7+mtT//wvljbGg62xZ/kMwoZbuQnrVTVi1144SodMmJ1cBkYgUlAG2SuGMliF1TgLC+uMN5mBThvPc",
+	"v/mM/3P1pBw2pn+Hd30YjHXE8xJ9CpDoay7JkXbm2E4DeLYLLGeH1IKHgk8+Sy/ypVlm5vqqxYhSbdBOgykSIDG9gMAAf78LNSvt",
+	"sQdhAe3YzyibO7fxwkOYuaxIKC+yHtLbU9C3iTgE+pqlC7CK0W0T4mBFp9rGjfDQB3tmSqkazSUmw8HQNpoIyCkV6zk8xWi9qTpP",
+	"LuncDRwh6GuIQ9qhQaoGX88PeV0GvcV/iuIj/UaxvCIdzCrIWvcoKsbwUHTVURtPNcbXoxUm4Icx0Xgu+j9yHgM057/o60SwwHXN",
+	"Cd9yEg3n3pcIJjRYcAAAAAAAAAAAAAAAAAAAQDAAQDAAgQFwQKF9+//zYX////vrl/xiVB9ENjpT7OfoF1x/4wiUfvwXSU0Ok6Hf",
+	"MqM2ZJcYXAAKEBmpi6IQNw/RsrAiBVf2Oxh+h9q4npeMLxbWM3L3eeTeFJxoGWtnRH0Tg0FkDNysSfkrnqmYRy208+UZn6sMCxkT",
+	"hq2tCBpg0EaC4w8Ias5/luqP9Nv+DWeqUSxdsT3mbfvvqBfjyeA7R4oi5Zm6YCSdIHjVgydI98H0UCDOVAIIoIGmbVzs+OUpf5+8",
+	"zIJq9xwkrol/klss7Z4yqwM25nugfeXCVSbcm1PoqiiMzgFep2WefmUX5ywKn2f9HBaXsOzYUiANkclLwLbH3b7+QIZWk5/y2Gx6",
+	"EWRthEqPAdhTZvAiMBLVff7WZVVGS4BezyXWVEnh0pKKI0cOcAAAAAAAAAAAAAAAAAAAAAAAAAAAgFAgAcKQjJv/v1s///4zIJ5C",
+	"b7qV+Albig97j1/hG8Mq/5G5s7CB60MaBigPJTRw6AyjIAEQyRCh7V7N4VG9Oj02DQaDDQlxxTYxXQWFt4/Hk4xkxKhkKpkuQIkj",
+	"ZTV2mYKjvflrLQNq4FhIUyjsXdIxsBAt7rcSDpjQIgFlBMFZzqO3zdX8C5/kjXCRMXfFL/L5lJr+FN2f/ZLlxhMZl7MvLTzFtxyA",
+	"ERBCuOyByBEitVB7sIRFy5O/LT3R9k+bXPOBWo0D+Pn8JqmO2F23EgOTJQxd8TZjqLX1PpWCkQ6sc8H0bmX0UZJcZxoge+cinSdV",
+	"vUigA5wgwIKjIDcbtJtsaDAHuenZzA7CRTGa2hcV57sCXf3Z66iovldLBtrjZUmzZ8Z4a8mbFvJUjmfpQGAAAAAAAAAAAAAAAAAA",
+	"AABCAgYAAYIjAo3wX//77+E//381FwBADq96dRuM/2M56fsn/GvKPWMEbCZR9CTgzsNhhMFpdNE7QNQHSUISTa0d2D+NwsRhUfdd",
+	"BaYDwmYgmiWh18KvSkj6mHPElFY8iFDRQmzHbumW/tpTIkbhQpsxxApeCHGKCBWubgnJ0AXANgVmGUc5g/hsvlXv+U7WY7RjUY74",
+	"UJSi/5dCNIcMcEYIE/NA5m+86QSY5cDuylSQZFt4hO8XHBcKDBJpi02HfXO+KW/b+DKBHyK9CCxSKU2hjYZejPVPqnD1c5BqUnAD",
+	"GC8nA47CXqw9q5bC+fY//kvBTjlaT1YqUaZkwThXhRJiejws2TgjJe266XWSgUJgUT13wnVJ/o9HMZKYm83bm2BzLGtaB6DvJRDM",
+	"mZ6mgam3YAAAAAAAAAAAAAAAAAAgIEQAChSwASETTLz9p///9J/0E/MvIHWqQkNtzOJmAmvxT/4P/l/mFG7vnx7w/kjHLNBHlI1a",
+	"uMfCECQ6J6g0iMQW5lx3vi0p59xHVYLhPPcUTQzV/lZ1jHvwVyRsJ480tII8i2N87fH9tKFmsNd93Jho9F0kQT3ypBBBdvDgDaBF",
+	"gVappqnO7yDq4vy4EjipTbPP2pWJ9j6hrZzVS8EH1TTp6FldqJ5PgACANdlHRR8FaUCooHQfjoeUF7TsFCPjuIbAeadjHHrj+EHv",
+	"tlmTfSLVQU5xlNfPpaOrC0PXooCNU2UmgwMhBhs7x5ePeLY7/fdXJuskfdDFRrWgIOYeBL+T4KmlS8gab3PfzLFpJYGdufHfKcZo",
+	"/W1tRmmEXgUa06ZqHWrkOg3EwZUncBcRtLpQYAAAAAAAAAAAAAAACAggIMYCIihwxSyShU3/yX//8F///q5tXQo+g2IGwXs16vWt",
+	"8XWrv22tQtzf2123YACSQpRVCklyJpJIQgmHGgqRqm34Hj3PrejqpoZfcV2XAdZgrpc5q9yzobuREuhsw2WTzZkr4JZ0muXzxXos",
+	"0HhYWY0zuaFZQGLVn1XSQBEg4AhgJgD6peyudu7I7Db84nIVSVsz7Zp9qqCeq6Yu4tFhExsYFBet41YHLSAQXiZcv6LG40WgklDp",
+	"D9E/mhaybmW1vareMXmSkh21H8RvUCUMndmOriXXzUaSPSUFCFryShIE+6sTM5jXJ3SaIS0ODNKOPtOExhhsp4yLZnY0nIeIsOG2",
+	"PYJG42ShckW55tAsBJxgMDY8Z5DlrH0p+yyiqTxM6hZhJgtc1nlLBUISh8BqJeh14HAAACAQAAAAACAAABAgAAAAEABgAJBCITAQ",
+	"sVFuVf+Kfp///V5n53SRq/YL5lebkpq/8ZfPPWTyApH0R8p/J2SMihJHO4mSUIn0kgqBfAQbKGt63keF8Do8DMiJwGo1XUeU8F0R",
+	"B+Nn63l4kOHBIyzKOZEgaiLPUl7YUnXy2w4HCtJYGpcuZUJe/p6dt90lpoDQGoFBBCmCLs0X7Sj7rn/sRVeC2OFaU99q0eP+qV5E",
+	"l5G5J27tG3I2CePgUVIn5KmUT6mULBZVHDkCweCnjdk8uuz8i3/zk8IYlKntH6+dIsuSv1wxmrNCMfoD8MyaCGlInCOhajshhAU7",
+	"S6aRgLIZP1oJfAq1OWNWfmggr1UQYRXddxTiVyl8YL5NPPBNAgxtHBOMjk+K9txkT5MHxWKTZfk8uRYA5hZiZT2WYVhhIG61yfH5",
+	"8HAAAAAAAAAAAAAAAAAgECAAECAQIBABoTJlkGtH/wQH///9DNp8IoCN4EwidpIGbK1XAHmXwL/QLr9277r8A9CUvWYiSgmJVRJl",
+	"gqQaQHCUNqwt+z34nW83Uv4qHxLLw33HWYy2kDbGxxog3EzpFwjCMgItYWZAnRjcXNh9Ve4tOwuEVjdyRUOl9HJv6Lo4YeEA0F6E",
+	"CxZYVO7rp6Sv/Bq/63VzBzeCxbzz/h+P/tG8M2+HIPjecpub9LtdDKe8Nbkq4jBVQhKtfHf4AGWAKgwk/AjPHSnS3xI8Yy5xK8ie",
+	"KHyY27z97JauKI0MrE762n49ltQECJ12bSDBYcZV45RwNfp3zcxOxYfga1Zny4IIlKz8G6IvQKyKwRqHmYwkThGnQ05BsKWjVfnv",
+	"ssMt4EhxFwE2/F69fCRElAYUD6rmgEePLWGsP5vSgIAAAAACAIAAAAAAAAAAAQBAQBAAGA4ICIgCYmEoJAPuLy9/9+/Qv/BE59CG",
+	"Yej3isenV/iyg4uZL8k6UfFDJTCnj7nbXMixAH0JzkgZERxFONQoBaK9u/7cUk9bnUOV26t1cchvNpy2oAw7RpH4GNgYcSVn381P",
+	"KDKyrFYfs9+BQlyxtToazg+V0IFnh5ddPJtiJUKA0IwFwyGwhF5UBJ4f9nf9vS+59awSzV9ykeov5ezDJ/ruQxJvZ8jvma6OhUfA",
+	"SEaRGEZdMrhPfKHsZuNeYh/Pp1GGXPnbyIpTy13ewZfD2Qb3qfUzmhjle8iK1co4k3ScVJx0dWG4T38UC08AI89Ra1bCtzauN5aZ",
+	"9/048JPKLMFwjvBHSi7QObEkrg3VNlj9jB83sdF8t+Q8EE2NPspY5O8fxcncMIS6kavnvUNJeJIVmWNb/QiAAAgCAAIAwEAQAAAA",
+	"BAGAAMBwcCwMBQEAAoAAqFeQP6K/55/+zf83fx1IbBLKbza5/dqfuWvqbXbzbgmNeBXlpr02O1uYcWS7VF81xQynhtEBAZAAuIpq",
+	"J7jTZXe+V5W9OjnoK+812WSzFkgGD4utw8PB4uJEkLBd5YrgKas0uJEGpl8jjWCCiowVPNxQC6tk7MtPANBgg7sUmHebehdtP8j/",
+	"D7f7j88o48/te25ofYW+xi/H7sNo4FTcp5qWMcVuYN0GLxrtiUkaSXyKwpgh/iRaz4gTFafnLM4C/Zm0g3p14HC7wbUipnEAG7p1",
+	"ohXgzCockVMpp4nqPN6f0s1Ljx8wozcGOIb4ZdCgxScq4jF9lpbJGJp2WMJmdEJ5oDyXbTjMnJges9vdB/JfpnnjfD23YEH+V0OB",
+	"URx7UBtnae4yETcsazbOtnvQgAAAAAIAgAAAAAAAAAIAgQBgACAEBAEBAMQBsATl/2F67///TP3t/9ODuUlq18fO9niv+IseSVeH",
+	"Qu9IpAlAzUDu1r4n+NODtqY7zLhONgVJ4oiOMIdB+Pxi5ObGvp9hxWMxVff2lmnmfadAkxuMCoxjbO8yeEkoyAqCf2ck66KsR5NG",
+	"Sg/RNZgbX25bVQzhfgxaKIDQGEFeCrQ1ooa5jR6bL8+d/frNXi4f+yZeQdbBL99n4YZ4z5io+nl0OVADtiR5EdsgBhIFItBmRIPK",
+	"1gvcp1ntM7eCuSJDYtfede7VGH1SplzDB2i1iKDVZSATban4tUE2gAeN71plapAZjv6d5Bczbqzh9hGeQbfeeeQvOyOCI6p1JIsd",
+	"vKLpiCtn/o+7qmBGLxdZhnTt6MrHYSi0FhSMttVV3RiaGKVj+NVoXkaOgVZ6h9/AgAAAAAAAAAAAAAAAAAAAAIAAAAgoFhYSj4fl",
+	"ITf87aE///+G55//99X1xDMLPw4/GLwd/1VzVWAReveacSiPQiV1vtLNUNJBizf4e6e0BEGKsa0AeI1EsdB3H8O4oLS9se7zhNPo",
+	"ueytVTMW0iYJFUryQJmKPHW9fn8BByA4V6I25zMwI3QwKDgh4hkG3g0ZLMhQXA0EAYDQ4NBTQ4QVBGuiB/JpDEb+gj3OD8kOqvt0",
+	"J7BRJtvyEFX9+PoAknJ86ibEt4n9OxFu8O3IYGtRo8MgwR8LyKZZ1u1m8w9GT55yb8/NfCo9Kkc6q/4T1umNUZ1SBWa07C1QadA4",
+	"8GrA856UIZR1yD7tBZXnXPuL8H54KeMxqkZbKwBKCNwvzfS0OMYEeYfx/XU2ZFjUppxvPRa4nkbvDY40hpdfjYTMSk071em8Y0u5",
+	"UxmtQj70kBABAAAABAAAAAAAAAAAABADAYBwWBsIAjDALRKD/sF7cf/W/8kf/OjlhoeXVclXhUp9+Fe7sHQQZm6iQdpaVURJYUZR",
+	"4FbVjPqYXOrUqxM6LE1fjPMoVgZCBHpPu0O6dVn/IYjD9htvDbW6QY+Jr9mlaPIIkNqydjbfZY6mkg4tMzrdJ65oYkKJWjBRZ9PT",
+	"yc2OseRncTYsICHALtABQBkCqBlwfIw829rxA3z/X7y9m+HE2WhDyBjiffpwvVPOFnbn7ohLhSQr19YYeYCSQZEqfKguAdnFhiNW",
+	"cs/3Eiz+cMpdtK4fk3YGmyqcCm2zJSykUfEUkayCB5Ns1HKa5NNoTremtLpf40jnaVKPCOTF5l8uUlZ9G00M4tHqAAqup4mLNEiU",
+	"NK4lPu447OkGMSsZkV7T7yCzOpoOUCR83F1IycYVSLkTvsNVBxYJJlqDPpAAAgBAAAAAAAAAAAAAQGAMBAFA4EwUBMFACAgBcxP6",
+	"rf8+//2X/83v5icU2x/ayf/RzOv/8dfRMfyVzv9xwlx4TSOmPmGjHKlaiaywKJc3A2vfAOZqYtyUaHRQmM/T+9cU6NIMPTU2+8fu",
+	"8DSZCvgDNul2WJQwAZmoCjrLZbPXcDLVhaXM2LnG5W4UHckJzeL7vRwzSgZGp0tSRAuQoskA0C0B5QuQPDElhd2pXQSD8LFG/PtF",
+	"zgvnR/LdL1p8eHaPfWaB1PsXcFJNFzGSRZIUZCKcWMUio4OkhTwRxP8Lbpfrh7w/bNYvEDBn5Bn0RkttzH1h3i45z0FOsaQVZn/V",
+	"IdoVpscBvlzB5co2699WAOG3xhx9zHIRJ1WcqIiNNngzByboCYLnYIikJjO+2YnAjwZp39Tdd15DQF5MrdQUS3Zwpt8DHVVTj+Y9",
+	"MMlxYOQpFoCgCABACAAAAAAAAAAAAAAgAwCAFAYAMBYFgRhICKGpGHpI1C/8y/aV+J6YWLfnK/MJMm//8U/pqqqJzP+79UdXq2Tw",
+	"hZz2xkZm8lVqLi6pw1KzpPmHhCqpswbA2z1LFmf3by6fC7YE7jVRuzz2czVvH5Nhzw9RYcLpZClOixep1sfDxlkVhHVFdIQFlEHS",
+	"RBHc53S2qVtHMoCSmIQwMRMAqdSA0BXA1gVMIKDBw/YAOyiykk/E/edidVI1V83v8YqdofTG8X05XduH+zhiLxd2n/J1iWGF+Jlz",
+	"M0Q8DVJHFOEP6i/K7ab8J+reNWWXd/PlWG/wOzirimmazHHM8oBlLekd5VJiZrDAKuIpUIcc/E1T0BVQd6mnh8B17bfDdsjFlXrM",
+	"CCWgKOLj6M+Ogze8jnZS1VAxbae6bymEhZM5dCJNi5YggjMo8eqPQZ5W/PkGhYCgDAFAAAAAAAABABACAYAIAQCAJBAC8GwSQ4B9",
+	"GYG708AB/+g+Gb/RsgfBPzgf0IBnr/FTw9mJgnFDtNqRnYeEsBuFvUVw9YsnvNNT6csTaujQs5TG1thqXxgoUPEh5CTfkv8NXKkx",
+	"9vb/Z4EPjeL6vEaJ7IbjJS2M45Rj9ft+xbmV5BpS0NQVhRVDCITE3eX1ulmTLqMfOIKkiBhEo2UEV5nQEkCCAfwHYBJAAgD1CiwQ",
+	"rmjO8J+plRMTZn6bZzSDXwddn6HU6zd1DhC5vMhBrgwqsgDl5i8kq6A24KPP1K+d+4fyWq78IXpy+MnwlG8Rps7xSAn/m1cwgjUW",
+	"Ul3lm6VBaPCeCfFSyJ+P8otPE+oadRV7DKP4TGqp6ba+8FDHSnChk2mGMfVQOOTJr4Xk6S1I82rHAc93nBMpUnDWk7Vn3MGTLPVk",
+	"4l0HqoLEyYoksKAAAAAIAAAACAAAUAQCgFgIAmCoG4Qgqh4EaOQLPjG0xf/n30U/+fKBje/zBf7Viqf838/pmT/ekJfiL6S9QsoG",
+	"gp92U8Rnng528inmunsXSvU0GQDY+CdnYbwIdgmVQjQ3+CRGvyGI8nk9PbmrnXw4NHiQfirg5fdBKaeFN9vgw5sTRLEXzva4iHCx",
+	"KxPD9X8X16b2lsSg5HA4BTISmUVdhjDQEYDHBCgTEFqBtQhAKvgVka68Q9Xg/I7F8OxS6+NgmHIjWvnlMEpf5mGVdBNCUuzPChpV",
+	"6oNLhCAYP8zsd7gfouaW/3ozx/lw72T/RucCYyx5aFsTu4ksCSEohxLrXKU8DnPNig+Psk30jEp3IvTi+3yqFY7yV+DuGwDRm81i",
+	"yIo3CYWuMmTAYAk3rcPavDHaGI4LoNlqFT0bGFsfAr5dCeGvZCcadZtpOzFBiICwAAAwAgAQBAAQAQAQDACwDgHQLgNwPATQbgdw",
+	"qgW7BWap+Hjy7/saVQrts+744h330nayswS/IMy/FH8re+Xc4cJadwvdBz2W89op5om3JtXZjxTFgpygBuN4+JAFomDA/jZyq/gm",
+	"/19UB6d6AccXR5Czj9ZQDUHFFrUmL2qGEgQZQEtvtfpSqVwYE+/9308Wu51O1MCLc3J1k9ytUi6bMwDAD4GIF+EGCihnhDorYSnq",
+	"pk6H+AdqmvxEnCzuJ/sTLBT7HdrJ45z4zvw4No8+FbZzMB3McjNDTBBzqezP5uakfrblJEL632xwQTXmXdOrlLzf50BCsXDx3A0G",
+	"YfEvwpi2Qi7jGvBMoC5B6lQt7inqCAdhaPcZvEK/hOHSKYtFCI0WeGkDBCkpbgeay9q3Gn2BWwzHDcFikUSVSKblCrgz4kARrKCa",
+	"46CftxaUsAAAAAEAIAAAEAEAwAsBICECwDEDIDsEgC8EAAebRxmPoG/Lf+slwbsV+HF+Ak+9+mLd3dyn/P+vuw/9j+ZX2KFRovGj",
+	"7wMCt/ysCDnyxacuvHuSclU1cwClJqdUJ60jKJUEEYzfi6OOA/IxV0/4cR5YJheAwXI2+ktNboYiRT6AU7FCINdb/W8AN2HZ5uvZ",
+	"r9ebocLnY0ghpQ9kslTQE1bZGADAAwBUBsB9BiBFQvwgMU0Br3NTSP9n3wcHRsa6d5N7fpSh49WeyksvlPaBmacqxyvrqoiueifV",
+	"RTE4hZN/6SFD838uhk9K9DWgEPrLEWcmYcVthAcwk1USAQCAKqVOJJPinJkE0WGV22EeCBmD0jPH69BN7yEsi3E6Hw6GR8LLD8Uv",
+	"gaskgC3ggs7tc3a8yXGWG43Gojg4VGKlYtC5QsSiMxiqacvmDU6lsAUAIAQAAAEAUA4AsBABsCACEBwB0BoAYAYCaMh1MPVv/ct9",
+	"9rzjMGFLr9Zamp/Ppzx6omWPPhXRX/YPNb+hxzAD6KfwqE2hvu4inNVh27kHQN9RUoqzIHJ3fLXg1kRCmiwwWnbhes6vxY+PSFBM",
+	"fGfhihX4JN5Hh80O8/OtpMvtEKXCBHuCb3Vc3MYfjcGDA0rVGwwVokFSEEuK0LcKeUEIeRCtJ4DABAA0AQAGAdgdgX4SQMyIUEDb",
+	"aasR+aJ4Ay2qm25/TtLl6W/JP6KT+1JF/mrqxMPGoiBbOFlCE/PTsMR36VQP54v8bOWfO/At6Lm4il9O+vWnjmZ2VWTBRAGIeStx",
+	"UdAqLpUiw3SEMjyB9R+s7BHWYoH8PA56nr4rE2tgymQfJRwIbiY+KjFv/F2arO/S+57XmZmpiA3aOjXVlvwQEbHrXsbecIggsAUA",
+	"YAAAMAUA4AsBABUBgBkBAA0AICABMDSDd2/O4r/a97nnzTJ34W38STLA/x4+FPiGZPdDukV+i82XoQXQe/EB4pDdQl5ljmXLpHFz",
+	"HSusxBrXujZCYo9G05g4EiQ1E0QGckV75H8D10Ev4ZGEgOTNqwRUvStfZKeAGQ1sUTzOAD6vIK0mGUgXyHov3/z7YWT1YYeBtca4",
+	"VO0tRi7kpulhp1cEPhfjALAFAWAjAoAfADAkBVCkD/FYRs+Sl4I/+rT5k2rAcrjTfrObSHzMcFvB78tcY1FndFGviyOsSup6wfea",
+	"6XCL4xYH2VSB39ddR8d2fiKhM9YH61bAUqrZJpJnWMyB9mYkl2vqkksxjM+BndBjLb8B9NnCt/PSlJR+704J+9MHDpbNWwR/MtJp",
+	"Rqfo8Pqxxsr1NjlcrxK2HRycmSEHomkGUt7Kmdq0eLADAEABAHAMAHAOAXAcAbAQANAGAQAHAsfa74nJ3/x1dsT7Ii5YW/8lbg+f",
+	"6yfYzzrMjO5uNPXpzKL7dpoGW3keiBqEWOhJRltb/3zk9P2Z8eL9yUl0MWD56zhm/FUVwq42KYzrv6L8X8RxUIk0IHnzxTegrCLV",
+	"OclOqxku4psfc2ocgcwy5OYKc7L5O/X218vf4ts1TmZmFApbFyJFNCp48U+nNdofgfiAsAYA0B4C0DYDcCIBcAQCoFsJBmz2QO77",
+	"/T/1dOU0ndB0/eo7Dn5IPjguF5bcCuDnmolcyxqCk8GpVf4FdjAa80hqxvFSYu5u5r5rrxBFdIJM1y55XSh4u0/ncVtzYxxZJ8r1",
+	"3dTgtB4q26JJJV2jk1EEQRoH0F5z/OTyGJc9BGhggiEFkwoDqcNX7vH4OaV1PG0L3O7Fi3r7L5x6deCS9gYVTieo0LAAAAAJAMAH",
+	"AOAXAcAhAWAXAYAAAGASfC8CzgZ/41OCJ9WgQMID+W50mP9bn0Tc5rAVyUSOcR2oI/ZNjmbrPx7vpbp6c1lBmY2lcSza5iQUANip",
+	"Pia495QLHExBXU8+RGAkx8kxbK/4r4b4Xf0QyLsU7pyCJa9aobDyx6mOZ2XHZG0NyadUJmlFCUjdatvyU3s/t6NNna4lyBe1sq9J",
+	"oiEw8uizRfQ8r73KsAkBIBEBwCsDgDsCwC8CoBEAoAZ7byyOgr/QxsIebwkIfR/M47xH88P4O63lXe1K97iHn12Fp/LpTJVf52fB",
+	"wp5tWwTey9j8r+ELoktqLfVbnGgVitgtSKBzIKAS74pSkaVsK/v+3tarhqHl2jZd1roEOFWo6ked0W/uboZwMIiyGGYJEBwTAFi0",
+	"a2Pr9HwZZ3mczKka3OeJ27rYyF2LhlKRvC0ORqCwAACQDgCQEgHQKAMQJgJwJADwFgC4AXhpcRP+4bVS+OYNQUV/O47MX+VL79ty",
+	"avXj3qw4DKOs/5ffVp9cRP+WHg9XvpZMDPVx8YcyctTZF28sG0/BHPLSZDIYTaikcwniqaLwxvf538LwlfK4SxeBdAtmyb0lJ5YZ",
+	"VXGaDos7iy4rlMOSiKzSYWLVwcOTAwdfl8tmx3MahI0OhQdxW0Q1cWiymXvfI41wsAAAkA4AkBIB0CgDECYCcCQA8BYAuAF4aXET",
+	"/uG1UvjmDUFFfzuOzF/lS+/bcmr1496sOAyjrP+X31afXET/lh4PV76WTAz1cfGHMnLU2RdvLBtPwRzy0mQyGE2opHMJ4qmi8Mb3",
+	"+d/C8JXyuEsXgXQLZsm9JSeWGVVxmg6LO4suK5TDkois0mFi1cHDkwMHX5fLZsdzGoSNDoUHcVtENXFospl73yONcNACABUAyATQ",
+	"F4CNAtAL0CqAmwK4A/ctmxzpLIRRj3VHRxnqjoTwUs5zyqBc+gZygx0y1fmFbYUpdSzBu/40lTay2xx0am8blLYlNPfbV0Dwu2lO",
+	"zHIyhmrBFzQe0Axpgfc/sOkTk+9isWsMZF0DiOZLdR3qajEdWmnC+2yVHdszW73K8TNPyhAtRCwpyI+BwCxYk3So2FykPDZB7hcU",
+	"e2+Cyns86KCaDrCGtaYApZ9zkxzlfPWfQtACABUAyATQF4CNAtAL0CqAmwK4A/ctmxzpLIRRj3VHRxnqjoTwUs5zyqBc+gZygx0y",
+	"1fmFbYUpdSzBu/40lTay2xx0am8blLYlNPfbV0Dwu2lOzHIyhmrBFzQe0Axpgfc/sOkTk+9isWsMZF0DiOZLdR3qajEdWmnC+2yV",
+	"HdszW73K8TNPyhAtRCwpyI+BwCxYk3So2FykPDZB7hcUe2+Cyns86KCaDrCGtaYApZ9zkxzlfPWfQsAEgFgDICoBiAwAigQgD4BM",
+	"CABRA4PCMwN7SXVT+WKxGOW881FRez3PCnM9v5V1SHm1vCKhVPJLW9tf1L/9THy+QfpP+eyEjwNx0Hr+OFhcC2netePiAYx1hWbw",
+	"VQ4pKCPGlXakEacFb1SNJVf3fplEl/0TywD5V7cyvt0k+d2vSbzQ0/ADcxnkiPK1UmBUEpXXWuy9sPQ1SDWqrSpoyPOregz1smes",
+	"cgw0vm+1JzVyGO6U0APANgEkBEAUwE4AZAQQJYDNA3kZqlycYJrj/G0pgDN1NLAoCL7zoDRTJ83hHGMTU2e8aS2eil0xr+93V9Sn",
+	"Dywr+AoQnoPo8yx/39igwCeRG1XmU5PGQsc85xXkP17GVlnJ2OViNHLlROQ7iPi6hQy/6m4eXVZZmPTrFUx7xrVTsuQQ7jgZgOqD",
+	"ogXZJgmGY7K6BS5pYtCsu2PcLTQWXhPIb/zpPEmvBaCTDrjyDM9WhGIThf7t2MACgAgBgA8BAAzAdAVQNAGUCYA1ApAD4/yg892O",
+	"5T4w7BK7x7iyJyN0TvgiZv4bEMJBKcmu4+4Mav65fAL/jO6zGXpE8gRK9pMXSa+yVD56LxYDUuCwJxaJbAO00UnxdjyovGGDlyq2",
+	"wzP894zvCLAfhVgLPAuoQkkzaC2Wa5jhsZOSg7CIVAolm0iTCY0nLdXcsahSGtlEycUafCucDjvCVgEqGeXlf6XqcqTCBIpK0ASA",
+	"FQAQAIARQK4ErBngf0I2HQLvJgnvUAeSuEppGVz8iHn1nXE2rDB9PLoXPEts1XXYeMFPo99NsekUuqRtkf1aaZvgzoAbb/0x67+Q",
+	"jB3p1sa5xGJFq8zzwJhcoBALf3Fh9PzOjEaNZ7rfZJiIRQ/qbkhFX9v4uSybJ12TXbvkGkzfmxZNe7JUWaqmo1F09ntNk89hhpcL",
+	"xVJoUXEZ8H88Q8Pb8/t810SpoHcxDjmdGBYIB/c/weUAsAMAEAYAIAcBYCUCwEsGgHsHwG0JACTZmnkf8EkqbyrOQv+Cx6PWlW3P",
+	"8zKwT/4Po0DrnwCb61f7Rv4L7s/1fayDXxOdO1AOcXDUWnmJHeeiqNmZmCOlPmusSH6LSNROwWxTgGH68crbgH7fpfBIHXdyt0W5",
+	"RwxbRMwJrXfbTGZezhFPRMWiDxULAcCBu3L4nRjIJk0uH27Fn97mQ7LiO8HTYyisD/f+1z8iLcUEYNAIAE0BuAwwTAGXB4AiUKIA",
+	"erIEWX+6934qdPMQPZyAnvLl5URwLb2dXru/Sepq/XNeP6Bb+tLx6K8nAxV2Cc5DIw1cUmGXPkC9BPHgZwqnoT0EprhvVMpZxm2E",
+	"ko88iz+MWC2oCtOMoTCxib0egMDG/vND4xtoxOWKFlblvCcrwPQ8J3ZFD5tK8kOXKwLgNIrDk01gokE15DIotJwe9GYztUCsYrcd",
+	"zDaQEOUUg47AiGWt5AyCqP1XV8mAsAAAAAcAgAAAMA4BkCADsFoHMIQHsIwMzakJA/s/zuNd7MF+ulxlsOkNX2Tssf/WzLuSS8Y2",
+	"vAl+R78iqjfl2yKB/liy0WUwe56mw70UAHArTg9FsP1JLHIhAHqij0WISwLooSRsBe7237DJcQyvA9AoE+zLQiKwVZfhtHjrzc3s",
+	"EGzyuQYwpDgiErXN7QrV1kOhKipz5mX71/dYLx1VIq7SsA5P4Pp58iUnsQDQDUB+AzwRAErBFAQEEsBA44VI8vcA0hHfrn3HkAUv",
+	"w0YsX46bRvzf2UfdmBJjOq9mKcwOHxozWjYEbh2/bgHAiumjt1kveb+HzilbbmNjexpKYbSoULRpRg15J3ZpmDCVeIIfGxqDMC63",
+	"WOouAO6F9HzNcl1a8E1arQa8K4njlsyXWMgXc8Vdkw3DCgCMHCYo69eIQQwccLmDs2wm5RAP16xS8Fj/I5qsB61ekWJnDsRxWIxB",
+	"OELH9hP/PLAAACABAFAGAAAAAEAJAOAhBABfB6B1BqGM1Tj2fz/7jVHyiv8ODHen5mreHdta/zKV/AmK/gr7EPEN8e4JvQRhIK6x",
+	"S7BVoTaxovbdXQDXwwt7FASltobnrK8hohUREE4EwKSQv77g9V9xMzzrst1iZF2ibIfUKVN8zPXONzsxMhFMRC5mhB4EsVHxp8dY",
+	"QRMIQp9W3xOzJcVzWuAxsNil1v4Hz9+gWo9I0AeAWQF4AjATwLoD/A/kZjHGuX18uX4+wE14YVqi2E7trvLrGa/9u3hzFXo0FG/U",
+	"TorbRQjvR5ETQRrC/bxVjIVkZM3ga+9rIi5ClRXUZgvZUjjSt0YJRM36QAovARUbFEFZYZI/EYV1AhZAEfDjVYjSSy19LUcghDbz",
+	"y/WcTq+ZyJgpDgzCEEFKXCMBWAo69hEYDYkLUTvDGu2tlsZtC36Nq51xXdSUMBcsULKVujEQ4mO1haPvj/yHWPw4sAAAAAAAEAMA",
+	"YAEAIAAAEAYBcCwEEGAGcFIgjM6bb+TLZuaKah8kyuE1yolyDt737Ya8VMJ+rHctrU8DZ9OcaTwarlsLQfAgP8bPC2OBnNZqdRUq",
+	"PVeSSB6AR/CRCfDgC4GB2H5HobLy2zqevueDQREtmRO0EYBB5gJOTxNpDwdAcB4jTmhgQkgVDSWIEU8yUY5fT6WDyXoscODyl0mn",
+	"+H8Lm0BnRkzQBgB7A/AZMIUClwywHAxohyF+Oz1YigkQGLlTEFnoC+fIRxT9PbohOqfXeWFtVSzAJWm/D8oUkBZCjJfJUZXB7Yx9",
+	"Sf9X6fuopnPeCYTkgxwSpaDhbjLySJ7nXojKCFKNt6ptGHrjlcKMUd3C5IDOuMJQmI4YvnTNU4ZfadHOJjGwbQrZMMxrD1TEukZl",
+	"CpKTQEYYDcZnZPFpZlnPlaGm2U9DeQ9rqVuX4KANCpJ7HCopapn/ht194/gAoAAAQAACAGAMBABQDAAAGAQBoHAXhICeC5K3jQtD",
+	"/1n7UoQGp/v242mAw3ezD4Bf+DWZNXv/6S9RvUz8Z1n+ZXaQnZfezUZAtoZWXT0Kpd7z1VZU0UfdTDRyGqjc9B7Fs1tP/7fvY/8D",
+	"sdz4dPEMn3cdxOW2QlrGFkXuFxoOIwyxmnRNINhQ9FWS0RK2qNVA+L42DgOm5BAcoppxA8bxdOVM5Hag0B1BGAYcGqBuQhAJPlwU",
+	"9o+BqzrHYLlP7jaxLpZR6UFnZnwcvxy/UtoG2H4YQZFe56zMtKU8TYCpokMgcV7tR14C/wHpvWcVTAKUe46tCXjGxFQkuzYdLH5d",
+	"40zROLlNAcYZ/JtG6ACQUrIEMXlrJvv+4GLlW/8AwzF6Zq6CJDgijoEckDB0UBqG6jUYsWyuK5TQ70c/jClTuuZsqh0N4rlbeuqF",
+	"oJAA7BVwdtI+7TbOvkf9/tn2r/KAoAAAAAAAAAAAAoBgAAAAAAAAAAwIAfB0EkEySOrKgn+fPBU/xFP3EccRF0HdVXNrX8yIRXr+",
+	"VuNSiTeaGDapPkauETbQnZQI0lHt9Ey4+ZlYosg5FLJMhgFhpG7GYEY+LUJt7CduuhwGs6a6oQi+XSTLUqlA4NrMVbU0IQDwKDDs",
+	"jY4mjGSYpQRwVypEo835vOoMt2k0Hkrx1E4PVy5dXh9O0ADAFAH8EEBewaQti0M7RAfWC8i8nt2VxV9qvWqfnDJNW1/H+5woOjQF",
+	"/QYicu6IpHVjSSZgRwKKPDkYWePul3/6T864iG/izDfgdOzdzxG06hD4BKhmCqe2rTtfZuwK3KCY0kCEcakwdgs/8GEuW8WVPQ+G",
+	"8f5DhOBonRjuKWabZJtAm9yht6Dj4I+ShAGoLQXsZ43SraOAKw2A43iuG4GFVBCRIAYmKc+yUUaNeMP85958y/Fv+OCQAAAAAAAE",
+	"AgDAEBgBAIAABAIBwUB0MBFCaBX6EYl//0X22y+hD/5bfl4jIa/mhPcn/8/3vuf/x1Lbul1XHPy0ykBvot7pNLUWEBx2FjrZ2OIG",
+	"AOob8hw1QqK9P5vm7LkPBF/rxa3zfl+V+T2uAQEsh21VQdUoxsenQuYZY3IoWrD5ZwSePmBRo0CkXtj4HoQeCx0c2XY6Gev6mZi2",
+	"8Xgw0CKBlQkIK9DZg0207Oc31XtsT3bKkuaKs7Dm7fCggpj9Qlld9A6oMeNLJu1ojJFZ8ZABBtAPWHohQU15rn29j/qrWIBsWNer",
+	"mGTR9XQVfKRgwwqS6jLeuj9M8LasRUi9EvBkWYAizjTEVP8/bOB0zi3q/gNj2Hb9zCNYQohpjAtbNFouwAuQ6aUg8Ybh4odZ69rG",
+	"q9oGlPCg4UHGZ7lN7aFQQvUGRQcHgrWGTjgHBf+Ptvxj9y/ygJAAAAAAAAAAAAAABAIAAAAAAAGA8FAVCwUQ+ab7pSf//Z/HrY6J",
+	"f/O76kPah8/lBUf/xtx388/8n8GPCTm+8fGrcSQGe2jTEqvMA88X1FMM00LlrKczzwKgMGGj039l8JzWskNeCT/kfic74niwIJ5j",
+	"ukxGCsihcmoUwYYdH245jRBE2ZHo5EWgqIlS4nf8OxhIAs4uLR0RJqaGziz8iNABAGcDyBcwZYtO1vjUNfkSuaEZfliyjDBMwcVe",
+	"0K70wn3KeaILAb2dVMJhq+erPk+CNbBmAC7ECCok3wnAX//pKTQYrN4Xr3VhuvXLr0nEQfiQEUp1dt+POQd0aEoBCdmLpIkqTnA2",
+	"R1Dn0M9+NPP1HruQ47tdfp2sC1uw52g0qRUpovehwMULJIXIBy2zl4CTYBs1gNG4mts7wXO01CPYRkSYTggy1tY5m1c/Wf5bmn3j",
+	"+rfFgJAAAAAAIAQAAAAAAAEBABAIAABAYDwaBEEg1ERPvoA3f/4j3q5BRl/zS9HI2yB35XBx/41+VvD/8a7GdbOj81ecmkRCUIza",
+	"CN1ZXFZDcRUHjTUGV6oi2FB4Aogz/bumVa8aJLo+KxfiuExvJc3D0xqkU+YEieQgpGxgSV3MxIwFW7YfW70AKdlaVpbT7PD9vss2",
+	"JgvM8SIY4V2/LwRaINAyQboI1C0g7+iRWRr7YHjS/fmLQ1bUH7Eiu6uZA9fzn2WcwqQVrt6xqXORwq2XlPUA7QGkgjQHMGIJalfu",
+	"z88MPDALI93NMAnnzZOq1mYwPX1LJEq4cGaaXRwBnbFaXNfR6iTJmLkU1UBhH5fyzsW9/PfG8lxnOxPSLkkVK5RSZDMdqhZrO3hL",
+	"JFGxSGJHMWtwY8umZSw4bHeOsOm5+DBSLcr0HEIKSGLSNaES/4f5/2L90/bsOJAQAwAAAAAAAAAAAAAAACAEBABAABALBgGwgC8O",
+	"ko9+F9/+Nd0uj0Vf4kc0KLCrjKMlfpdqJtl0hsCrgoLgzXE+hkC6E9DTDNPAiJo6hVpoLNqvssIBACjUDg+Ldu6ZyDeLwgM6XDea",
+	"6HA9Ps4FCIUoTSEQaTKBKTCx+4oo+orn21sr1vAQDyNJY2Lizen8OzWsCsZlqJSA4/RrqsjQOEIsDJRAQA11hBpT/eT6WF3Q6TSN",
+	"zEr109TUfvWU/ieLwIm4NEDnhRb2+VkyndRXkEdA+IMsBgpGQh9P/+7Oz9pmc/wD4q6ZSUy47pY4Nn5cOss7EtSHUwZ/5Ml7Acf3",
+	"oQJ+JIE8DlCjncf/FHb2P3/edvznAYlqjsjYJhUWdpOCVJ54/e2xmjTs6EdzpbC61BMAxQ4MliCqb7rN5DTcYyKSCKKNNwiniV62",
+	"n+zx33D+NenIQIAACAIAAAAAAAAACAIAAgAAIBBAFAoQA4KEZGkL/WFy///0n0N/TVi/+vKr8C+ne+iRrWXjPwr3iyuSHa1bKYxL",
+	"BD7DzTw7SDKIggcnrCRkkLUywshYAwrEccQl3l3uHPqRGFpNa8H5/jKbj9BXn56RplCoBBjoKChAxZYe6rqy8idtehrMKThwRUYO",
+	"34+fkVIJZDl6krbo3ack0BdA5AVMEwQyuGTd8Z+zA+nYbI40OAoZWb4EwNa/oquba2LRAgiuycTUHQ5uQPRWIHnCRAsIGTAFGp4i",
+	"Jn/8LTf6nZU/++YDzqrZohzIUa9XbhYxBXtBiTkXXnBsqYKlSOyUPhAIco6O5Dd/BPwJH/Ce403lPPXfAI4RSLSLhGB+IyqUbXv5",
+	"LKEhanyYp2/M0d49gFmmAoXIUBBaDl76wx9m1h2QzUmgAchkS553+fyD75+nZoSggAAAAAAAAAAAAAAABAEAAIBAMBAQCgAGAMGg",
+	"wYV5+0tf//886+/ywq58ZG6vnlN8iMnvgf7r7W4KohH33TpvuBi8IbAc1tLEuWSHeLamkKwM+5sk6VhIO3KmEe9eMWyeRBak8/wP",
+	"hs/b3cxJk4ybplHFZqVgkOIU9/l69EXpWCZnjdRgkAw4EfD6+bI2IvNXpWjSSINXJjjQGYEPBkgseSWafd+gr8vD/Gipo4bTGd8b",
+	"a7YRx5P8bTC5avo3nJrleFgu5lhMilfoOHIYAT8YjMbFxpLpn+rMZPbb7P/+o4QSSw2uVls5Xcy/xjgaHjoMO0+Es84EvCC4MiYa",
+	"zgJFhECz8v+/fFLb9pw2o9j5qWx4uCbpwqIOh+m40FcnwV6jgK9T4Gkdn1ENfIqxGIAlOCHJyJTqMVttBsmjJy2SoDgOJoICfLfa",
+	"9e/UPxZMQ4AAAAACAIAAAAAQAAAAAIAAQCAYEAgBA4KAAHCxQyZ31vH/0Hkj/1tN+ZP8lrqY6eFFbuw/N/gT6syNJXpnZXBTMSrW",
+	"OWmzzD6UCn1HTEcYy0LV0Jhmc0mUq0ruGoW6RNwBW7rYcHYypdaxYuWlyYSReLCEiGkWHuK0Yrk4Y+d6HcjLjtME0ePinXofuw8z",
+	"AixVCVbLYNBEArEQGFpcAQqvX+Brtf/6jMToBsw7DpOmegfF6/aR4mBUaohsZU4zOYPrcUZ8MJAlAgoGDxM1eSPcmm2fMnzq82P+",
+	"mP+FpqGXjddY/rJfDJfCJfhUgYL8GcmbauHAkFxwSsS0Uklicipev/hXwznvoZ/YfH+Zjoe3DM61qTMUNQM0f+BrtMYCGdQyE1vD",
+	"aWxPfoREJIXLkZf1oigOF6bDdOuQmfiyUkCjeKHf0XmvMP4t8kQQsGAAAAAACAggIICAAAAAAABGARYIMOImt9/mvoP6f/6++k56",
+	"j66eTk2o4dSOJHCv8f/TPhnH97+Wc6+tXiZPZ/IqBkJyqMjTdGzDhK7pHi21Zouc2nWfhOw5bGAs3weRxM6xSo345NLXVlZEg5Ic",
+	"KmYVYeC2mEVW1vA6TgoBSc+3XLP1e6N3J0++SwkbFNBeg+EXQHJ8/uZQP9fJgl36L8YYjM4+pzaRmu+9N8+3sg1XQhQkaVzJ8jya",
+	"hGzglwJ6A3QuhFEm8gZYa952B/ATw0/+Ff8o5OAiXi5L1j15kRsIqG0HDBCcqsHbfxNguGo3NCppLTcweZcyH/3Do3D+UtmT+k8p",
+	"LxAJU4pl02RJPJNupeph+JGgROgyz2Gh1OTPZIVMF4bADsMagF1rupr9elAyJow0pAieJxH5LhfkX6l48vkQYAAAAAAAAACAwAAA",
+	"ABAQAAMGGhgpYeSA/IfoOq//tv/////Lz7h+b2zS0cWqGXA9NDi/dX5JzX5x9IYaszVjzQ1aBsWUCggsCDu/IcjwjgG244tYaTaZ",
+	"S85rxnZVBuBgaPbjxsSuCkwhIIqxjAUAVHIcutGfm58K9uYWNsZmwrl44YdOPz+nl6HvRLOyrgVC6oDQcYSVGyiDXWhjNT/gbd3m",
+	"/OHloU6JVbO1eHTP4ZPoyOI6VSpxYqYef8rnziIgJESSNsEtncJrU8oAnjmrIy/i9oB/77/gzD4uDKp+O3Jztcr01rCIAR4uHhcG",
+	"XsObJhyLCrwZBCXFUlBaJ/+2ZBjttbMz91ztRDlHBY5qU2M4PcOITnTyLDHIQfiPB6XZZ/OHxCXIwaYpAqhRoQYb3nbDGlYlElYO",
+	"XDJJM6j8Zjvsn5dx5/YAcAAAACAQACAQACAAABBAMAAAAODQQBDg8CFCd6+Wf9A/zH//zmVZb7tBlkbfCbyEFqasi+tfM3D/2J9C",
+	"cyvCqRlYnqWcjZ+QYUlsTpQM0yBctGWzXGbIVjtFTdZhFsKJX4GJOQixsKtUIYeajrwkZNrTjL5lmPcRVBGOlS6QDxM+rIA4PE4N",
+	"jZayGW0aOInA9SDQdgS5G8iPHS5Fqr/iFtfq/U6mSVQPZyvBBnxn8TBwJnMZKdsoFV6/UE3Yh7GIOBsZViCLUp9IYgPwCk8jzCT9",
+	"poif/aH4a54HuCcw2PxI8vHqh5oQ9CrjMxlH5DrbgetYlITDchYmTAUOLj/+GaVjMts2n+c6Kdm6/paJtkyV5DknAojhaJUE5UnB",
+	"fsdnm7/MHlzcUGxCVGcAx5ScdzzdLiQ2zuTsCKz8WseK/JV/4Z+RaVHXoHAAAAAAAAAgEAAAAAAAAAAgMEAgUKByIpDhskYP/Mvz",
+	"T///+N/+Mz50Q6UvSzgdNzilFH03NyLnSvwf019izP/K7opOk/28GUWGqGpmT7DNez1Bg0WwvsPFFEukqKbDRM63GTalhls4xLlU",
+	"Ll6Wnqw+3Lt1qjlDsZmdwtKM0OqPBt1Y6IO77tXrfU5TOm7auBcM0GID7RbogRw5apgf7gWWjfxjBL3YT1dLv1SWn+S/3q/TDKdU",
+	"YOU03Xu2cCH6CDAaooGCJSn+gbRCYL+fz5rB/LxBP/wh/EXo8CLG21D+YG3lGrLYWTGB4aU4f2E6Q3tcsl0TdU1V0kAccSH/80xq",
+	"YwnOMV8xzlVVXnKyDHI0Y0O6cQa7K1Tguar0W7zZVWdpzuBE0OwAMlc42CEOe88BgbgbssMmgGyTAPjem/FWP5B9W0aCuABwAAAA",
+	"AAAAAAAgEAAAAAAAIHCgUGCxAGAREdJP1j/45//6D///cf+DTxkrYJAbdzPh1tP7hk6soxEHvf3jz9FjVz1WoBrm/80B1XdFhiTd",
+	"2y3DkKAmat1n015L0mQQoRqPX04yWwCR1HNhieHDQSNuBB0tyjXG5lSRicThWBDwcnRfVbXbj0ds/Q5ngToMMQhWyNAxgbsI2Du5",
+	"J5tfX9d5yav+syC+EJXQyOjaJ435J7pouzNWD4WOl9+xpmLEpWFVgTMwUPKktkg8isRXg8py+P+wFCP/wv/xp7xAegtt4T4FaWC1",
+	"e7eqWA6C4iT0wDAK98Yx5XWA6aqZCYO1qf/0rYJKl4os+e6ekyc3vYPhCMP1eKcSGclgWaFgFiiBot9d7yAPJg4UfFguDVrNK8Ea",
+	"z4Tj7IMH7hUiZkpBbDdB+NyX2z5lmyLGgIAgAAAEAYCAABAQAAQAAQFAwDAQBAAKB4QAwGDYRpL+wvNv//SPK3/L0vkYErtYOnCx",
+	"eg/qqac4rywlN7Afc1MN+KJaQLJp7INPFBWdfjRjywqeHIOrX3dee6LSRcOTBxunxelcYgcAmttTHjk0DrYmFV1dvEmF4nc8rSxq",
+	"kqgCHB4/bxWHIrcueG0xO8jnDSbNGa+A0CBBnAscNeLVuiTfEX/p0/8RIwHKqWmy2xlYT585B8Hf19rHaAFGHj6t+P+zfQs8C7Qb",
+	"lbkGnxHeD1Kvy4/WjHuMxve0H8ItPh+G5mvVWaCnQow6JOJiiNDTRgNVpYPEDtfGCVlDJ7xqKKAYFJ//aPLMNheQQbwXjqXHzNle",
+	"aYZDNjAdwaMFOMojA9Uo9iOayewm7yQSLYJFHQOCcAtDtc/H+oisIBHicMh1OgyO4X8VxnxL4FpgtFiAAAAAAAAAAAAQCBACAAAA",
+	"AEBQMCwcAwCAQsIxcPP5UxJ//+a/if/+Jv3FJJhjk59KtYP01+7obiNQNhXJT2Ww0xZsZro71Qhc5N3XEgMU3TtcSXE5AjeYJ95/",
+	"rvihGfSnGPW+FjWeLj47BYqOzneWiAzO5fC1uBiVKhfS8L2OliOl5BiGb8njlyg6qcBGiwljeNrLN6Pi4bzQXcPsF5x8gc94HVK3",
+	"f7xT4557J9dFwQ/Cdt9e5Y39aNqmXGwAPV6bzYF+rlsSYICIHFJ/EeoFoagtAqCyWf9mfrp9hPW3//J1S+Jmf9S05ETMSnSfS6yc",
+	"z+LMnDqlepZB0FZFMX/giScflcON/9u/jlx0+wcm432eIh6GrymELDTaU3FrpU0fRLdBGaJTnIXvK5a8shhaETJyVAmPWhMQeO+a",
+	"4PKp0vQ5WFp84S2r+j9h4Z7pxYwdAJAQAQAAQAwCAAAQBAQAQCAABABAIBwGAEDAVCgLQqB/VDyC/0T/oX+PX1YkFKKwM+KXuN5l",
+	"/4a8azePrFuzI+IAwWWh6QjyA26eIoaB7/1RGJ55Gk+bwLDKsj+Nck5lwQYRUhHu+Bo+G5O4gqgFRS0YtRog2DK7gtHN0dTH1xep",
+	"4nEyLhALUyf5PVNETKoB4c02dAe6m1Ug+b6dPSDQRUKODPQ9QV5nU2DPfxgmCv/sYh/vHDaYdwqJTx/AAYDj4K8tMQu2861teBhM",
+	"8Q4kcGi8LpkB8A6ECQIQK+kOQbnKJz+uHbzkIgzpNN6HRj0DA1HEMQjoUgFkYhWSqh3WqeEY6FUrkRJ0mgUr9c/7wicHS/BGXucV",
+	"GHlbgJO2Mc1i75lh2+5RlToKTwG0ec0XN3VMoCF1AhkSMECZLgJg/e+Jj2KTQ2GDKXS5trPWfcbJ7Ns0WlCQAAAAAAAAAAAAAAAA",
+	"AAAACAECAHAAAQIAUAAWB8FI6flJ7///u32w/0ezUP2Uy9aP1m2R/9afCFPgnxlpCho93MulHycBrDJwAr9Oua8UcHdD4fn+CoGB",
+	"2ZjbP8I4xoXINIPovHXWq8x4bCwWEsrxfsAsFktkYis5TX+cpaAOCTCkEdeSQ5EHOzdixCpmkcsc6HBsLJMNQZKah9PZhpLQGAFX",
+	"Cig88T4BuOAlcFB+9p/H4t26xWlNA3OCYNeNy9yd3nLSDotPSocKfHuodIMhADy6WiaLhwKGjHMQ1dtdPvcRN16c/xP4ej5abYTR",
+	"BFujmLgaaIh6UDQmBUCDMWEpErVRJkXVWccOB4g4Ok/8o+MajleqapxfIxAlkcfj6cASO5lefYpA07DoMgTaEZngY/gbzurRQlAy",
+	"xwjCZBnYPm+68nY75ZCo7GoRZAal6r9JFfSNiqVIkAAAAIAQAAAAAAAIAQAAIAgCAIBwGAcGgxFAXx+Ej8yjS//836E//Dz1oBJj",
+	"Z8hP9Sg4//N3+m4V1kffoLOsNrnW2ziiMOWC1gDMCoFohrLYHnXiWIINEOXjAN4/CvQOzalszANx3Tej7LAa7a4OVQqiWq4bNBiM",
+	"NPWN9RxMmD1dlYqarraEFv6l+9WusRjoInj+nybjKQB0HgIhvHtRRIDQLAHzC3g2kQMFh5+dO9PzVUxx+y9M+scVypDSlqb/6wCK",
+	"k9SUCXq2rboXQOQfEsQb0YelrbZQdWDay2VTFvC7wGbEqQf3L2t7eLDdZ5ezKLEg2GM5xykVClhCCsNyKENDlVsgjLik8eI3CLPE",
+	"/eP9WYNvNu1KO5uIDYYXSRsgos7K8C1QaZZ9TFgurRDlafHXx0NqBsNihVQnRejAJFdD22d2jCg19F3qmSCQ4L8LynwbRqxhAJAA",
+	"AAAAIAQAAAAAAAAAAEAMCALBYJQ4EcVhXHAXfcL8Dv//Wf/n7/+q39SIqRd12r1eXPfjr+iNXKrAUy4rnaOayeanRnQ+lCN8k0R2",
+	"6MOBikox1wAx3nFA6GISxikDP1j2Lm2DY9sjn4zpstwvT7/D4SoTSGXS1TZ+Qg5TKQwEZV0zK2QjZyktkkPK08KSmKS+y0NB9n7u",
+	"3qMhEHScRALBIsmt0BfA5AYkJ6DgxI4Bz0BC5r/R3+2vcH6xcVUA3/RoI5qXtGeUMXVCX704Ok0mbUB0F+QDo7PFcGEwwqP8q6mO",
+	"E0MfhCP95kfpPnIelt3v7FIfZ0SmmpM6XBCoco7QZ2BgyBNACg0V5czNiTFs5clf5F9mmM93TVtR4aWwGnst1IUc3F0y2VoJMo4k",
+	"GU4sk9zF9eVv68iDJc4PC8SUSBQnM9brcK0gesrq/S6uGdT634brmhRzZKAAAAAAAAAABAEAAAAAQDADAUBMDwHwLANAIBgCoEJT",
+	"vg8/Ln/zZ/YF9ykahbVTewiuN76//4I5OVBEErTeuKsHbyKCKiFtEuepLQXVI6kSxm6V3C+mki7p1QiSUccorT+6aNyzwpemLiZ7",
+	"L2GYw3C5aEtFiKjjBL4gCqM5BzO9pICYmbLS01BJj9XIkExiiwWSsimR936mVx2CTCipDBWwA2NagNAYQMgD/BEgOMDCBVV8LAiv",
+	"N7cxR9+uDlp/viKWYJOtvSqS43U4h7WqSxl90XebDoYuJC1xtE/OQsDXSvjSMFxz8C3A5d39O+k3G5GnxPuTLowhyB/o1l0MgXoe",
+	"IyBsVCi4Ke2smZezDkVBE8KiPYP9+0ZljW0TnrdVKZ3Sa2vxQvjo3RsyfEGGLSg7UQM2GMuZxEzPBQAiC0dIj5bj+/7bj51kUCnc",
+	"9MolMDqC3X2sK3p03ICgAAAAAAAAAAABABAGAgAIAgBgCAMBEFATQ/CNGgVb7SNbf/83/ER/m+uMFMUb0UeVivh//zG47UcNErtn",
+	"5DGXWJycCtZyx0oYqSBIRQsPECAOTUv4GClndVyTsJSFD2GafwzpCcqUQjq+S4fO6/O3EPZAxFnVycBF2rC0RystHhVZJRBTFF2S",
+	"SwjSqmt3trcsM/Z/83/Db8jiUJhuZ6GYtFTxQMAoA6wqwbsRwK9G6D0+BcgMv/GwzwH9UJukwsXvXtbN3HfyDOo04LLmCcqTO7tA",
+	"8FcOrU3g3RdkQcn8rxXep6W2p/vycBzY+us78c2vvLSM9SD6kFNEkwXY5BMAMgwkBEiCN3aJQpmbM2J94ABhH8K/rTsRriNwnh8L",
+	"GZTI3MgJoywqWJZcDA0mVBIQijbXXKUeIgCoRlj4bM0KjBtUc/0dLpE4BKSxwZ8UmUb5jynTpZmAoAAAAAgCACAIAAAwCAGAKAYC",
+	"oMAjhiEGKgYJMBY/IhT9//010o/+77e0gQ23nA+JL0h1/zh8VYtoRo68ZZmkql0qMxqTFCkXVepBJPKwlOpAUbw5qdCUOgcImxaB",
+	"uGu3Rtjaup8502p97o+t05fH6+CGm0Go3xOGxmiIXOFbVR2nDsCDO5UyGkCAMswWNKKoaI7nb9bxpOgkKiacV0MoIH4nFsAHgNgR",
+	"INoKGHeFHjPAL3X7ZDn/Sr/DOdjJtYcud4paJq9BXp2+hgF5+CBW6yCoMenagFRkISRRg/aq4rzZdBli4tOUKYnpN42USMt4QW5i",
+	"CPw6xhUF0mi6GOE8FaLk5YERhv/OCD8OZlXyWZZVx7+Nd8Xy8Zhul2lpBlOI0cQBzE+XL1bDwmBAEYXl6HtiwkLp1Tg3GX0ZYWFF",
+	"V/F/G4XNapxT495YKJ8GZ/4sr7LQALAAAAAAAFAGABAAAFAQALASApA8BJBcBzCICVDmDDvOa839KfvF/jsZ/g7hnmOxwVMPf4xs",
+	"/4GofhlNn7YziAZkdKvJL0idpOur2yGFNQcKTamr1jdlqSOLpklWVptjqEI7G8IZofT+bmfX8rST1DsXeS0T7HY6iCrKHHt4qECl",
+	"AApGzaxR6CoMn4iYQgICUWA5/P4/Z5ErUY6knNFSAk5FXhd6wAuA4AggHgBwFEF8E/DBItul89UD9YL9rY1uh4969yDREzxLaCvJ",
+	"8aWfYRiKpntAA6chaxfAqpsFXKpjY8K2DiTOjCmbUjwU4oS2W85kSBkwW4yxv08EMh/FhCCIaP1JJGT4qDEeNseb2eZaBcuyfgwH",
+	"PWofvOMj5HIaHBTlcHxFirGBMCCJDQ8TKyA2FhQOTwNRDF4ainsMcc9X7PIz2SAF1ptgASwuu8P/e+i1ALAAAAABACAAABAFAOAJ",
+	"AWApAuAvAwAvAoANAUAwkDd1z8Uv+ID9+LwVBAEwskDqKXx/sC5g8yfrsSv8c1sycmDbLq58er0J1y060ZX6vkgFuvvYGUp3h4S4",
+	"30Q45O8EqZDwE7RPJ/p/A839vxuaYYEjDRF1jPgOeVZOLN6XSlqh8VJpFLONaS2VEfMwEoTelmBoPFzM3odrErsVnKrNYY81h4ur",
+	"yNmAwBIBZBAAoQTgJ0E0B5AwAfYgbaZfYi8Cz7AIcqc+0NW4CFw8o+UOL6c4W5FBiUr7vQV4qXIqEuK8FWajXdzxRAJvsAMzkr02",
+	"1Kl5yFwMkFHE8aKR1UnjSksJMDGSs+Z+TAsFPCAcLL11B59yo4p3nzUeJsLkMxkshjJ6mrrIOPC1KqQZGZeALyEsMesXY/NxdcOB",
+	"QFJWNEOT8XqUmkDVItgKg0cHUbD/J7P4wLADAAACACAAALAQAFAMAZAWAJACACAfBYBzDIZO8prxMf+d35vH3AhoFUMtrxXKGv5q",
+	"Ow2m3Swj7eCVCd1Ru2iVjaepRBWXsWdPHXSklQqT7r4JS/hJGqFZlUUS1lAMoJUSlXbe1Z/ofzPpfo17AQ5Ies8Q4+a+wDb+Nd6X",
+	"dtURMS1IEkByQbisMhNqlQNG1Gml82TUWPU58Jot1FXGunE9Lb5u7YtQsA0DYGMIoL0OAQ8UgX0cgfHjudXT/6le1X+nwJdh8eL9",
+	"9cp3v4FIAWSv98tKA1noT4MwfUBdKisuXg6p83CcXyIjXyXTQ264mZ9YWbxSQgxIdBVJI/yKBACnD6GHM+ck4JT1spDHO7ohAeRY",
+	"46b116HRSM4DZ32K0W2jY6CMSlGFKZQQHNyEgXF5qJLBi5HpTdcHBSGMtiuX5PRqKoVQq5RNW0YUj3j3/B3AsAMAIAIAAAsBAAMA",
+	"YAkAQAQBECAEsIgJkNZGTx/Mhn/zl7s38gh0Q/DRK84pqf9s/j7u9hGVH54SaD8iQkU3YKtNlUAPpLNdAPa9WPlhVbe+7FPqhS3I",
+	"GJQy5uDYIBDqAtNShF+h6zovcfHV2KROSwzg3MJdbphagyivcThcjOXt3PU6AHyc/U5tcVQnjRlGXmZFSxRxCDQ8TExmkuLCqtIS",
+	"F0fE41yXDrAGANAiA/BiCdDSEVFsHTJgI57Tl+r/1gbPvt9TeMB7yNvj+PJ+ETZL6nPe1nfTmda+YQL0U/MTv4KfyE3y9bvz0KTE",
+	"/DDJXwH858gdtc1yxDR1svtRqMXgjs9wbjmm7dqS8NU4NuGiSeITzPrx7V5sKHsDQcBx/G76zlRaWQSPJyxAFBCGRgKOmtIpvVn7",
+	"PZqzTKIzlkJr8jlV9YSdjWgCNuRZ9B5zy/lwsAUAYAAAkAoAAAQAUAMAgBsC4E0HgIUMoy7wqoBv/kinm/zGsdgujVQ9Mwh/9r/r",
+	"4yETJ2yq7B8ieS4SRSMRHGxZ0hO7jhyRzUWuE0qxbj6TVNi4FoH8vExD8jBHSWwnAhZaSnv8d8/5D6Ht4EAK6hs3Sq5wDZGBVOwO",
+	"b43e3OUw09UopCINBKNWmORYRoVZoa2xkYF7HYpbo7kpDS11GVFsIzfL5GfUp8cAsAMAYAEAoB8DYGMJAM8SQY0igU/wOnUP+v/d",
+	"j86TF2wjvJ08xAYXybecz0BceOc5lO3kaJBe8hL2c/Bj89udnbL4SHxO1acC7E/LnmvNWPp3hxBLUbUqcjzPBOIUGFNVH5Gxpfl8",
+	"HhMB5bI+begbl1DumQBNtrOH6jsMhBRRLIIFODYojVabiEPDmhkwBvNwdznVq6murwxE297EqIQmsbObGLUp7ffc99aAsAAAIAkA",
+	"gAAAYAUAMAYBsDIFUH4JkPAiTvmEu/9cu5r+YxysGttLb1wBCP0u/Cho3tasJV859//IRRB08qPzA8xKBYCfD5Yts8O4iyf9fdUS",
+	"jS922kq1llShNJ9QGUYLh7NNfX8//DfwHj5KCo79YNs513LZokaKsTsOa5XZ1tFbyiGWiJQiZVaBNLyKJ85cw+hn4WNDZ7BTuDbk",
+	"gEVio6iUR/A51/Yy7L5QsAMAQAAAQAMAUBgD0FoIkMgQ0YwCTwHCyP+VniL+qFr4ZGHQA8XI5T5MvjK67MYFo7KTneyzJEia/kx/",
+	"Tz55aTcQvPImD9p/0zmfxR6s5AkOEIgRS2OwkZiVEoHQHJUXzWU61Xf8R3m68Rsrpt3BuNe5eXWARoOK5/lOPyVLD2UgkkCXoJTK",
+	"03CCmyuCBIzrXU4mPCvrbBElb+tpy0wekqh3yNGCl703+GFgsAAAMAQAAAQAMAMAoCUEAGsJ4MkTASDu4Cpf8uHLf+OlzbLO2t16",
+	"QR9n4bfls3s3/UYrgskOfOQ0Ek0+/d7+bi8U2+BEdrs4K4x559bZe2LxBIyR0/MNKaNlLqmzWNyrpKHS1L+s/tvy+Pv0zPdQ8oxb",
+	"vnsWFGtnX8D4PvMjJ0lhGIpRJI+U7AGA9abBIBouDxeNo4ctNZB43qV7UbMU1ZDFdTqVMbiZHtvcALAAADAEAAAEADADAKAlBABr",
+	"CeDJEwEg7uAqX/Lhy3/jpc2yztrdekEfZ+G35bN7N/1GK4LJDnzkNBJNPv3e/m4vFNvgRHa7OCuMeefW2Xti8QSMkdPzDSmjZS6p",
+	"s1jcq6Sh0tS/rP7b8vj79Mz3UPKMW757FhRrZ1/A+D7zIydJYRiKUSSPlOwBgPWmwSAaLg8XjaOHLTWQeN6le1GzFNWQxXU6lTG4",
+	"mR7b3ADABoBgAeAOADgBQBQDkDwC1B0BFwoxHrYaYPf753sFkPCRv5s4v9lMy63iBPCC/lDcqNEI6oPyU0rBX/9cPlO/4BCEa1Zx",
+	"sDnEutzks8ketnkOQBndQvK0EgAtKgtoD3ZQUBJVCdsP4zWtgBA+/DeXeXQkP82KFPBhLC097XylgWESsiUaGCwuT6ClF6LmCz+0",
+	"w42Vd3jS0n+zcR59ieYaJlb4A0sTQCq2mbSyVHAMG24XyXRSaTWsQMAGgGAB4A4AOAFAFAOQPALUHQEXCjEethpg9/vnewWQ8JG/",
+	"mzi/2UzLreIE8IL+UNyo0Qjqg/JTSsFf/1w+U7/gEIRrVnGwOcS63OSzyR62eQ5AGd1C8rQSAC0qC2gPdlBQElUJ2w/jNa2AED78",
+	"N5d5dCQ/zYoU8GEsLT3tfKWBYRKyJRoYLC5PoKUXouYLP7TDjZV3eNLSf7NxHn2J5homVvgDSxNAKraZtLJUcAwbbhfJdFJpNaxA",
+	"wAAAJAFAAgAoBQBGAwAtgfAS4KYFmDcBlW3hAD5hdYlaAVlvktNQ5PRnF9eBHy/WAh0hPG6LwPVf/dh/ozy2/dQ64YJabqFAXs8N",
+	"B0uSkwyeIi6uTXKgl7jCwzQ/sgoGWWVcSqYxhE1De8p8XoFmMVWwRBkn1ix0Pz6qx3JCk/RytOiMxa4DNZh48efx/VYgyoPTnA0C",
+	"zLV+LcZ33kU5+YukjAGEMtD4B0KHQhHMar9+nMDi1hi8wAIADACACAEIDQDiC4B8hLAsYaYRluoIkv+Xx5N6selZfxVzhLaKgvfX",
+	"ucyX/fA5UxNjyFfpnrPDp568GX/NBB9wtrE3HeNM0/sQ7hd5/csDngZEbecklMORZMkxr2GcELFKOEqJvWNg8F6oV+ZeoEdC+2Fl",
+	"dyRc5mYW3dQOHLTg9jkiAYkvFrKYTeo3SrfoPmcHCCvGXNCnXMk6Dn+r8Rhj2l46BiDT7pC4KBhyNCZieMVOPRKNDimwsAAAAAcA",
+	"oAEAAAwBUBwEEGAH0JIJsLwVrnADU/8QWuNlbZpf9XrwDL2JNfdO0Of9+UB4Vv1Ra/bV/rc/ZvB/2tM8BMenOE1CjnZgbrJaLYRc",
+	"oszpsgcTrwqWPHze9Ckm8GINielWIS+Z576ChrR6QxJ+MIRuATDpFQR2CII6GLK7E6nN6DEc68+r/6PAqkzUXliZJFvm77xtmt8I",
+	"uLxBnBjCYNCwNE4GBA1w+yVuz1ypzSaQ0AKADQCIBFAWgJsDeBDwTAFbBqAAqXoDHHjEbG9YOIDrw36FhVUcrV0bSDT+vfseQtpf",
+	"kcgOpA2BHinlf/H9RFxkgo7FvkT2N/yiQh+s3Qc6TWy0/FskGh/PBJhUKx54BWwzhTCMTWF0DoWmEgBftQqF/0bpF1uFK83ATHw+",
+	"ltyouHkIiyfbLJDZisQfR2jkHxv9fdIdWqvFzOYKTxzVtj7Dmfqj6gkpOteMQ0WiIcEAiZtjd6ssuqQvNkrAsAMAQAAAcAgAAAAA",
+	"YA0BIC0EYGEHgH0JAb7g5Ir/0YZ+lBqdb+aJyUnuzedla/b/EDHpPbr+Pf3mflE9m8A/AM6Bj54d9EcDE9Lgsqkx/G9we1nn4FLJ",
+	"O5CnAKzcl0DhIMWAEYSn6Pk/NfhZSN4mquh62dY8Ah0GTouMsDmqoZes3W2vb+o7pq3VYwHCFScmcZDSa8L2vT9J3LIuQOmKwQhd",
+	"CYOAJkUAaarNTrfYrjcZTNABQC4BdAcAKkDWA5QOADrBJgOOGiQiLxZNch0ex0J1ey2QU5FfpzlANN+Qqg06Qxhv+VQYV1i9ZJnQ",
+	"Gq4lM4b9enT7+fXL/6yskH95ZqNsULuU1vAu5BcllOWHdGFTxkRUgRKUFWMME5wIVSYnqgIxDwteQhxFCnDptibDNPmIsHQYEKLC",
+	"etG8L2imDjdZJwAtfLK9jqK28lYsPozsOz691nu2Rv0Jxo31nEIDKBueiCEcs0vG8it8/MYSm+qgoAAAAAAAAGAQAAAACAHAcCUG",
+	"wRQtBbDMbT4+Gh//pbqi0/W+/+Oj9BEItXvqa0u//Q7C3TtfyE7xvo46k44dLRHo/Ssc7Eowq8awopGRXsfw81kglDuytk04wDGG",
+	"QdEMJINIAziXf+K9p8haaPwe8oFewLm3nlgfnRLh4azweEroi/0mHwkD1xKjGbZprMHG02HGPbPrWjZJm0DbK0I2gArQgCQg6lka",
+	"3+iT+rVTBLPA0AsAWwGICDAhgGUAyABwAIArWhrJpzh/Q69pGLM8JA0ZSZfvbOIAMJ3yAmMImvFTr05q/+YHinMx3BKmpq2g+Czy",
+	"V/Db/9W3sc/6y4wfEACjiRWmKVQOPyZzCiXKuAYI2AOg+Go3EM5voo0EqCBXGE6awkNLmrzJ6BhK1Z/JyaMwUGMCAU1MgMq8uEqY",
+	"5RgqHuqdmyVQEdPc8CEYLXJ+H9S8UxT83fbhrlN9ipfCWaogE8I2XIc81iG1kuB2vqCAoAAAAAAAAAAMAgAAAAEAGAYC4KAbhMCS",
+	"EYvHmWG7/6hTMahJ6f83H5VIyaUfAxUv/wU1M7Ev9qtnHuO120izNDiFO/DblOIRK5AFc+pZWw1wznnPNKglu0XQ1nCRJGWH8Bp4",
+	"6fbr1nvvXcnyvLYq6UDQOUeQVJgpRq1wmhsbmNC9HorGqheJPG+csnOPbPOniC5Xv/E8bsdByL0jHEZJi4ItMUQWJHASWGx2R2PQ",
+	"AcAMAHQAcBWAuQRgFzBnCMLDULnP4/bi6S1dGJOMMOUcgtss1X09591mNDolKeg7ZF9bA4NjApFIxAUrhXzslj7X/8Bn46P5e9n/",
+	"NI6LevOfAKxfaBTlnHJZg6KGQQUwNDhFzXqcpA7HRDCKOu4v7wO6d5tyFb4tt/Ix+uVIFxHKoQeuQQqijNY9JDu1bf/wtt719Sjy",
+	"UsDqkpd0HtnlfduuP7AuTGcriWcA5GFiChp3LRsN4/gMpJ5DIahEwKAAAEAAAABABAGAQAAAQCAFAMBUEQKQhBFBwRjrcO9/yIqP",
+	"16RR/xOfSZD3DPxMJ9r9yNiNG/zsxoeNzLHa6tpeTfoIMqFSQ8mjB5bSXN5tAMj6F0cpLeFMcdxfy4iSEYcXn8Uu/qvXed02w2+D",
+	"lF4kXDO8SiYTYknrKwvI6qr9Fj7OmpTrU7gtA2LyLhgvI8Z0vG4W1meeZwxEDW8lDQoSoygo6jxFrlrQB8BIAnwQIFdBqAgMJ+AX",
+	"7LwH/fBlyErBtjvzkggUZPX5I5peni1vmMrdxLqbzVvB1FznzrBsxJH+gfrXrrsaY/zpfV94Z9pNl0X23+m1YN1uEbggu9f/pMAC",
+	"GQGgCmwA0fGBMLDIxNgOPGRWMTHZ+cDUPLOgiXN7LEcTKqdTFHQhFgJEYkCTjV5lhCAum+BaSv7vaNPMUtBvDuu+B+hXH+ivtCwc",
+	"gsOIIMizRR0b864LZ+HcgiYAMKBpUYRWkAAAAAAABAIAAFAYAAAAQCwOBcJAhC4MwwKb8qryf/+Oep/0WnX/9Gv+PkU6j+sFGs+I",
+	"PKLXv7fRTdlVKuMkx1BEizTMT0KCBWGJwWyoFoMoMfKGT3khgSkSHYXpOQ7no0WJRvU+J4Po9/rs/i4wsUDknKJRFIcGDay8hKXU",
+	"YzD2dDT2gDGDot97T8xopPP8n63JoGIvXXE4eweJUZzPaAZJp52XwoDQCwCjA7AQMDyA5wRYGZgHlnC8V70xXYjlITSFpJBPk11D",
+	"gu2rC/VMy6Z6LgfXL7n5Gy3okzPsNqDWxUXS1A06bvlA4O9NsQEeHATmhSljFPBxcDFrHx4FuAsbYo6Nj3FHT6DlQYZwlKFWymR9",
+	"gAP4YbeL+CKWylMXNaAln7sLXhsYVt2tc1LRTjGP/7ak9u+af6BAcUagmnLuo+ZdA8Lfy5A3As2lSioa35cz7k+/51jPbMDh4jS9",
+	"OTkJiECQEAMAAAAAAAAAAAAAAAAAKA0EgZCIHwkCUIBs+ZWen/+BvTX6AI//pt/YYhKA1WJFB0X59dTPpRIN1lRF6hSYYxqLhbQ0",
+	"P0EGspiCA24uFjhduBsjpHU9MwDYSY/D5xnw8wk1ftcF0G80ejwcDOKxv2lNxw6NxcSx9JJ3+KzlFYWhUghtrN15LSO2MD1PVmLB",
+	"3Dssdioffyea2WCyAeHcxs+A0AJAIwHYDrBYAdMIgFPMokmVvxtmiKX3SdEY049Ogqe1lB5/4bbTuQjgG15P8ErYLCCcNiQs8aEA",
+	"YIdnSAo/vr2Hn1jsLkQc/3zgdk9EnpGSZLvcZBEmthQdySEyEAs0bpgVIgWBk0kWqFoQ3PlmZViidpfUZ7YJsGEBq4uGQzLoMBRL",
+	"xqIgEknB1jx3aFveXMmROpKBNy6L5H32kPxh4o3PnsRUhGludEGKdafyvH964DNYThSzI8FB8JiQAAAAAAAAAAAAAAAAAAAgCAAA",
+	"wGA8GghC4KQeG70kyQ/+qPav3sIj7efrtNymgzgX3b6+nnPjwynY3/SL6XW9Y6DxCbhahIE0lBMCI4OYByUgwKiyEwZfEHCwGs/O",
+	"OSUohQ2YpU23LbPFYvMRVCm2ATZGcownIBO+kgK4x2myFsmUiKjKYLOVQl2Zpd2hvC2XgaTJKsHDrJy+00s1TtZs0BnA8AUkFcBZ",
+	"Qa4JVjoVj494NzKHkx0W2xoIaUYObn5kMHmj/pzZ3McH57RPALm+6Kr1x/gX5G/Rg+BE1Ed8ynIl4182LblfeSuvFBMIeKrAdJ+h",
+	"bWww0aiQBmB3CkIlOJaVplrB0H9GZVhdRijtyUzzhRDxONYBN6KhkRrBcCYLP5mGSX3yHiNFEU/J5hw9sr0sSYhs2JOreOeu4P7E",
+	"+7Cf5JZNXYCfHFGdnrLuL77sPGbnDZwnC0DwLkcCAIAAAAAAAAAAQBAAAAACAQCAAFAQDBwPCgRBi6/q7X3//4T/X/9YTp/b3/zZ",
+	"OewgxesV23/I3vzzpBTq5M/zlMznJAgpcDMigaaJbKswPKILHRpHVlVz+aA0GqPxH2hpxUcQuASfn8PxunyZFoAzWEwWcnL4kwYC",
+	"nehy/dtt4uS2ltcBmTw+Tj42PmKqz3cDx28QyqdJMXlYEIl34NAVQOYGHCHAr0NiA4M2ObJ/xOmd4bn5F0KnQ8Eo3nGsm7H88VkM",
+	"pWpC1tFkh5tgNBQoKoP/KpgGuaYiuVdYXylR28bN6OajAr78X+rrjKz7JelDy5Q7EjSYMoTRPQOq1CuwV1IAxVGxFqoobEdOOy36",
+	"ykR1wCNXiDFrN6STykA7IiyAgJIaNEZikbof0/JlQeZN+UrARFJzsfwjseePenN3NvdLc4GoyuOqklFNL4hxTo2Xw2KoKnqMBEhj",
+	"cDyAAAAAAAAAAAAAAAgCAgAAAAAgGAAMAAaEgED52+2hJ/+T/a/hqnv1VP2E2IvygOpzs/I3xPrKY1gNqfC98tMmCDyr00gmJJzF",
+	"oFVE05gHaGuJPoskzjQllWbTCPXDEkoBU7zUYG+ydRbQeJSiIK06hSkiA4ko0nBW0bMPjsEoCgIRMVbwLslYL+DmZzqsg5nU56Eu",
+	"I4uVRtADgBsAvAnAQsDqSVNfw72j7DT4PpYApVUqXQFnMONIG9E5+FDoridtjwCclfx4vm1iPswiwkoETIaqNzV8VWWLHLsNC9gW",
+	"+eXjliDIvnm0MR/gs35DQAuipbBQylqvXeMB0LlwIgeMCcY7iBo5+otR5McEgqkim9V4RUK0XhAPEmTk7FG/SGQ10uPkHgmuK294",
+	"L6C4Nx3B22/M6V548tD75Dxnqbb0CcTbWMsB4HsvWuuzeREdLEmH4aMAUBlwACAAAAAgAAAgEEAAECAwQDCg0SDwEWAAPxj+6ek/",
+	"/0f8nBP+BT2ew2dAvkax0OD2L7kwWSPozoGuJmRUfQoFaWKE17qlCc+ruqnCm98SSCFB4ij1zRM4v2Wb0/Ewo30OYxGtxOSvq5Lo",
+	"k0SSROjcbDiLI7Kv044mRORpSmA1xl9fZhcpnkv+J+9kbfkwcrmcBmeG0B2BOQXYF7BoAmuTmYpB+M85UX8LKXYpKMHUhTPNOixL",
+	"8QF4NbKsJnRZMm+O9+p08u2Rfg/BTMMUQE06wrv0CJNHya49EQfnN1LqvV5cVbA/OJ7HwDYEsSTPlqlpjJTKQqD1ooLh2kVa4g5T",
+	"EW5cba0USqpBqBSsh5XO8ILQQwlWVDKp0sECnmJB79w1zOWLPLiLBkFIQizxb2PMnkzojPf4nO/XWTI87YsBKwzc9U8q5XIgwf1J",
+	"NICJAvA0cGAAAAAAABAAAIGCAgAAAIBAghg8YDEMv/Yfdf/7f9z+ZupUoKN2OC1wCqUiU2Uvb2t+EvPuLKbDSP7yHALWTHEihQVm",
+	"628T25hHIFYx1ejzORaNtWiaNq2BJQQRK8Ru+Q2d3EwguXpFGFyDPkWck2izFeH16N60GziRJclsDH5rvufao78r1s67xX71KMC+",
+	"4NAtAfUKkDGw8ISTt7Ur4/kopZL8h2CRHsoU1ebONrTEf8qZrI+AtWG5rIpTNYrDJ5vQIME1CnUYwgrSQlXFQ/Wx3bb1gSZ/hFvF",
+	"Ra1ylprBV77J9BXlwoyOMrEg8tbDQ8QWrRDUdMcL2F4LGg0SfVW/CLX4neLhmOoWXAyiE88YCkYQHsKlNUzNIv3+tYA2BzZEsdQE",
+	"jglfi/M+9PKmIPF/12+uhKsx52xADdjWVbP6btszFSWKkFxFcwMDJGBgAAAAAAAAIAABAwAAAACAwIwOQFjyBLOf8Jh/9X//x3//",
+	"gZ8P4taoeJXLyDBfT8hl66/WOFph7P0jVggXDIazGZ2wmNQRMat7vwfZlnYQtG93BByQcI5FtmBVx2boYCz/LcdtL+EGRIFl0IlU",
+	"gaHKFJD7b1+XtywmIkKI7Vp16LddP438LYZqphJy0qASoblA0DaCYw2IQnFJBffFemob+vZsM3ygwtbR4hhilIaX1kfv4zCwz6XB",
+	"Vygoa/Sy+Mn0kEAUef+IwxoaL9J5lYoHs5adcPqAwg/mHnzY0aBdSeiB4VKEBumYrWLUmMSsh68yXwbnvBEl0Z8CjSF/QH5ryZyc",
+	"Y61UMvwC9ZNXbGTQDki6pGKRxAZHS8/Wj+OTy9uJNbSPVUEJ/RD9B0T0529DXvv4TuzdEqai6wgqBYJh+6eN65CLAoiMhiX3oFws",
+	"amAAAAAAABAgAEEBAgAAAIDBBgYgINJri/gv9N/nv4P////mZxJDziFzI2S3ot1TzLPyr3B1Jg6EttcKRwBV4Z7eF2vjVPoOdRYg",
+	"pGt7/wJV16y0vVYqnOtanFOmUoJCh1veR5KrjC0BFoQ6WB6dIExGw7D24fC2c+kzkQxbysKtGr1MtquQ2TSp0tarcLgg4uQgEwDQ",
+	"OwKVDohGcVwGucN+gJ39qzV5vplSMmMAJIVrGw+7RB/wBsjp3OCdpELOSmxGNHKgYQb+lmHxhxWOzLjFZOrabvdKvhqqT/WjS3Os",
+	"8gyBURm5KINgpvIm0HgcUAsHK8yjx2pPE8lc2MHj4lgQYah2h0EVaJhWj4Bb8AnNkE4fytgSLhASwCHzvF1j/hclrjcWZJLxJCUl",
+	"aqfn9s9OchFL375pzBm6Ls7c5Ts61zJOEcx3Kp39VziO6DXwBOCscAAAAAAAIABAAAAQECAwAEAQEKCQoACgUDJyo+/8a/Pv//+t",
+	"//uczKstiBjdczWD2ykb6h6S7Kw9Z+bKAn7flHVGczhJ0ymYSpMwJnq364tKubItgYIp5j4DbeS9lorasDTCn3vs8KvpQcZJT0BR",
+	"brXOBQAcCbS83wuDNb7PROBn1Y02ACTWS5zsGmV6vSoXCoGoXQSJWNA0Aj0L8DVQ+QVnpvF0A/mtbKr+I2FxouuwfWojBxMj/+0v",
+	"myfDsJGkSg5ijGZ03p6ABiTyZM4P5RWBnoriCvTsP2/9Si0/5e7l7WniLYDrCDalLcHV9FcA2ltjCSq1sncQrBwsHpR+3h4C7IC1",
+	"57I68DNStep4jZ7JGZkMwTki6GQKSyVgivZYdf2u00hhLMjtytDylSufodI8ta4F3o3xrkbLEZY04QrJFkmZ8y1LgGL4IpBnJdUp",
+	"4aIR5HAAAAAAAAAAIAAAEAAAAAAAACAQYFDg0YDw0h/Pv/un//Q///53dJsxxszgRSs3mgG3J/S3CmIuLaMnPE0Ck+X+/dUuY2ZV",
+	"/gsrO+pe1tmaSpno+2T5DWT3yn5TqIaIwGOOX+nkc/3u3CzElksptLyAlCRc6OCNO836m5hsJXHsHsRM1ABR8lsuCviGL7HCiQgG",
+	"IlJiSIyY0BgA9QOYB1AEgG1j+3E77fvzp/8sKSVl8tvMommUlUqv6pjDAePLSAghFxcOhCnPkA2ECBDZqaLPQ91pYr4OLl6ldh+R",
+	"qEL+inhnrOj2SMUhwb/IUh1PsoOV8tMKolWWjXda90IBr2KoqdMs6IisfDXbAyrdXxPDMHvMKshIGl4W0vE6kQUbiTOgm+663WVL",
+	"Zmh/MkVNFVl/T6B5AzUMOy/JdsaogS0N1WcVQpHerZRs+jWVGjAOaDNxuNUCAIAAAAACAIEAYAAgCAYAAIAAgDAQBAAABQJBAKBI",
+	"AsL/GX5J//2nlz5CnabWpwKIeGUzvon7IhUNlQUlytgbJAromJVH+NepHWiEirv++8g5F0tUUbBDdZB+McMl2MZVBAcwZ0kBc6Di",
+	"cDLQ1MkWbU6GRIgE1dNRU4+bN9P6m9XaDDQ+Ne4zEMAY2oqowIXjdu5ShX0hTPp4vUjQGEEEB9wxgRNFmgFngXWpI/mg/t7GxGT3",
+	"ty0h4mZNCdPyP3MJeC/VCgkPsO9qPBBng5C6GjWLwU2Ni0wyv45kN4lcHJztqX7D/YPGI95BinlNrWkGFq2Cuh9Sbxki0caKMm8s",
+	"I8Q1uNBq35cEX833x1ExqJRLdjlfpkqjyLDqEp2eStZ4KTxOhaWPevFqMgbVjXp6MbO6i/ntW8GX4itS+K2dtqBpA3BfhpLzH2zH",
+	"sy3mWmsxg2bzEfDQ5oAAAAAAAAAAAAAQBAAAAAAAAAAQHAgCBAbGgvIii/5kqX///f85/7e/oyegSaJ14oeO35P/0hi3AEGJUWhu",
+	"KSptcVJ3GWhxqh7f6miEwRWmv+Ca0lSaonPer5eMU4hfppjDfn4SE4fdzVFn7OyXbHrVRqk0HrnFSkCGRBqHwfrbdRdY5XQvOo4I",
+	"sjMugdunKG6eBeT0AciphUdegNAtQbgKVDOg7kScGLbB9EZP3a04I+WCSN0ZIj3lRKo0nbC/CF8KEzMAYxmwttBQ+0iRueByx/ZZ",
+	"QK5RLiv8I2PDU/CnI/0ndov9QpupTDRn4EMLag4kg6JUrRA1tDPMWFboToQWngtXedNGyuI1cchHx1Z0ZxyG2ijS+bU2xigz0dIw",
+	"ybZRQy4aWMOa/OYuTGgharIy9BUW/F8z8JVckod7RKe1IUUmnMlHUuBHUNEwHjUXpxdFZOnJdI5DAJAAAAAAABADAAAgBAIAABAQ",
+	"AADAYBwIBUKg3EARRqA30U0I//Y3yr/LrxC9ZpmwHXab65fb3/vDgCzr2m2WIUkCBeGWCk7J0BYdgEynO+dhGae2LXGaLSnQxT49",
+	"jk00bwLJmOA2AG7L1c9SpzPQp2kEwuGQZYrQ03Hj97OR1ZbI7Xp9vGbYUNrui4qmHAx1v1O1Fwh5SZznBTAEGyTE2YDQBEADAQAN",
+	"MGiCewxgbS15LlxPuVvwSqc6TvOr+QEyx3PPvuW4lbwLg04lD9a9bwQXpS2QBAlFT4GDiWGvzMfl0y1xyxu0VQkf42ennAAEpSY+",
+	"AMTvPCK4zqmiRxmo5TBKlK2h2NskJuWEjgTI/kHahX174Yq6uLA13gLq9vY9JVzfHycraVdIV6Fo//u6nIutQBDjJVeJv5D0bxRg",
+	"YMBfWc150moQWxpoVhpKYFruA8eutSJJjKMFRQ2isJAAAAAAAAgBAIAQAAIAQAAgBwMBEFgjCwKQoC0OAh6afjR//EX/xF/x++ln",
+	"s1hxJGdfP6Bedv/95e67VJPIdz67kJjtezLBwIDYBW2H6keKbrpUGEwcyY0gSQoEoU/h3bOpYlJ0zjylwnb5fJbjVTNmqUcaJNdJ",
+	"kaFSYBnZOft8tk7ZfEyY2UV0eQ+a+EqE4SaU+5+33ZjDTCOY8lwVYKMg2JuF0BoBHwZAH5CVAqsNGEf5dZK2Psm5dD7cFKGRlrAk",
+	"Fo6Cyb0vwpPLyKwhCIa7TDpQ1kMuPriMQj2VDhaukHf6Ksr2rMwMFer7lv/lZQiyqBcUgCz8U1Isi+jGoSKUmkkQe2LllhRcGHtj",
+	"ZaUVRPluS88Olqyi+PUoG4fidppUjAlOuqVBKZQQgk9SEVfGOYY+lChE3D6viEvRPpHRm9E2Pm7k+VsAGR4ZyFxxo6Ib7hvEdro5",
+	"nJoRqORJkLiQAAIAAAAEAgBAAAgBAACgJAwDQQBUEgJAEHAnCTJL/lF/8F///qn/sV/uB7RbUF3VlHtse3/tD6S1MBKMOf2NshbY",
+	"oMsqChhHPIYE4IHEib0RYMfl9GeQ4mp3QxiKS0/zrFn5wvk8teikdl1WV1+Hr2OXLAJoNgECVjB0FENRd4TZ6y5mPDycN39ZzLpW",
+	"hDzedHlf6TpqOYMhJAMarkSfHIWgs5cWEMALgVAXISYN2J+GtkVhHvkPME7/6hv6Sr4kbqLeeq4QJ6EQl/VKxe/yTgE/nt92q0fK",
+	"9AyVUiCyKWfRVeTzQfwLFDd+akhMUX4f/QzA4+m21aB7o4m4Lau8o4bYOcEQ4FZrTQLI2g8rK+wRRTDW1RbmMOCDw8SqYZ/hVElN",
+	"HhAsjCRGMfRKQkwsLwyr65b02V8WoI70ylbf41EngoaxGkqxBGAnUyLoeUj0EysK1/at6kt2EYkLlbXUvKAAAAAAAABABAAAAAAA",
+	"wEABAMAcAgAgFgkCSHAQIqj7fUZzP//qx5Zv2naUrUCyz0V85iJP+5f6CUnI4LGu176Z19RcZJGyKuf4lR4g31ZlNCXJ/WymUExa",
+	"hNCBD4oQMjp/t3Ol6PyNrwXQc1ha2to8w5NoykBRRaYx5sCAeCyVPWYbA3BmCHImI6Wecs6JUCkPZIby3msxBG5KAcq1RgjFukzL",
+	"hMpiMlDACoD4CaAmADAVwbgW0NIk+8cl9Pf/AF/0czkCvd9MNVpM2Mar8D/hiuRI0yfEZ29YwU1wPBOYLJqN6rmos/pi9JFOolhX",
+	"mmkz/cne/DZgfpBE417F8rRaF8VnCFi9gJC0ylILF5LS+pVSPEoVtC2Oq+6Q2I1aDGJrgmPVuZRCNjaaJOOCrFJ6QkmLL0DTdsSx",
+	"HkAAAVJKHzn0v0ZbWhx2BTzeC8fFHVIkQbXEc3bW9nx+VDEPA+Ra8pygCADAAAAAAAAAAAAGAYAAAACARBEDcLQfRSDFJMAP7tj5",
+	"//926/P+lTi8xbGzj8+/arBP/ar/NGZqAQHUDcbLz4XJQswEnQCYspXnJAXcHI+WgiN68spHxVDub0qAAQLCGPpigERwT2nZ+M9H",
+	"BCR/KK9JoRjl4oTwguYADv9bk5UsNsFEnZHqSS/vLboHKMeOgOFD3D/ZcTEo1AlGHcYuCxKLYPVGdwGg2UDAFQGEEQCzBeAwQXAJ",
+	"cEIDZlHuQ2/jaefF/UuRQamrwFTZBYVs++IX4lxXF1cN6zJ6jcBnRV84I6Gr8/zLgz/SRzjRWhngVVtjx+6tu5w8R40RJG2tChAo",
+	"cuGhsFwLUUwQ28qfhbgBGKmOKVjSILqzpQXI1cNFPgt9yDBp/MYfEg3QENBhOi1HOa1qT8nqCqJ0iBCaPtHWj+EQ50FGuX2EWZim",
+	"AvYCuY6P2EilTd+2zLK3KwKJBnU2OKAIAEAIAAAAAAAAEAQCADgOBCDYKIdBNjMHiVwcv1LaYv//w18Bf/4TvJ9q0Pq7b87Wuyv/",
+	"jn/5PSXx6MCffKXOy6CqbWpZUTVt1EVJgXo4amzYE1xcvZOuAdChchuQaQaAnDi9WjuPsUf998n5iYxIMTTbNtSijlumjCstW6DT",
+	"311J0wLQQ5YeIVYj8x1ubdm4IKK8sv15+e9dAYdXAMl0rRqVHoIYTdvIaDe7WMAIgQgOIJgGiD6CUhWgwIcAQ7ZsY37+VhmWfcRR",
+	"0eBg3yinBO1oabK3QcTk/ECwKcnud4EeFoTwleMD5xIII8PQthIUufKdc+OtXwEnRpfvLKETxkFPyrKzL3mZATD2GQl7E0KxFulE",
+	"7GEXW3EdiTXV8acTRtHhbm+BXOmTSCBoHUYmACPRMNpcqrpXd9eUBFQKppw1aXgPvu1JO1WoVUCccLqRNROpOkF8G+6cby3BZjCQ",
+	"jABMs4CwBAAwAgBQBAAAAwAADACwGAMQQAVQdAlwuAyRHgz9IzSA/51vU1/dQ26qwgDInHL6pMfSjr/0hxrvWgcOzCbgJSheRtuz",
+	"2KPe5btJYGCAeeUIpT8SszYlyrA5D0th8i5FhNGDY/ne23XxvxXcfBXkgqJvo3IsAzKoVrAGKY0ONvLXQVlUFlkZZJE9Wfu4+EoX",
+	"BuqR59BsWMvQ/Y2kKm04I5JlGRWpkQo/NQ5pseA42LAIAVA0BZCEDBD0E5GOHlJWJx8KLXI//lxxf/1im8/Xo806pRCs77uCDidf",
+	"I37hMQPXnlJCCLV1k88i3oygstW8akQjuU/RUoT4oeoEuM28foNgUzOXrIsk2kMTkXQE4LzItRPO89er3fzGT6Vq3eOFcw+WRAvA",
+	"Zrn9LvsRH1hULzJANBAaVuyD/+d471SJ6vAFwviIxeSb9o5q5vcgEWmkFdjq6ja4UMwoZxnRLNjVGmMMoiOgsAAAAAEAAAAAUAEA",
+	"4A0BoDMEIFUG4IcJQI0MIG3Lu5en/I/+pr/GU66FvpQ4Dzi8Tpvmw/Prn0HkNPZeS97ppv5FfXz9NhlAjxc5OGJZfx3B8LvXfW1+",
+	"VjXSw0WG4plcKVk1hqf6P7r2n3Xr/wHfwJ9L4lyb2DtEukkeI6CPj8RjsJgIyaGIuZOEQfDrj9piPBvTs0srnhFe335DUSs2xoZJ",
+	"tS0bGEhCOZ+HGddwHb87sAcBIBMCgEMGAJsNQRsXIdUlQi3wTMLL/7X9bP4/CxHnzdn6zlIM39bQKu/1G7gcufGRusD01ZXl28v3",
+	"lMgYnm6SIyDahQqnLPmB4KZZ7By0oCFFLZNUqSox2AlA5BBCoV9mqI3bv4O+8FQ7I9cE8E6R3RCKi+72ub1MnLHAUXxp2RgUnZOn",
+	"cf/sI3FeZkviNTLm6Aey32or7e7qP+bsuLLHRwg8zwISJlpuCYtidst8vTYAsAAAMAQAAAMAEAwAsBwDMDwFEGQHEHIG8KYE/MI6",
+	"RH+3D+xT+oV6Q2H9E0NS3ZG6vj2/K1q2yvCsRjaLgnRXo5/Dr+TBOir5ZeJAE2d8GT5Jb2r7p0VEx2IxVwwSiBHadj7BEN7pPhf8",
+	"F+p/uvI51geV2jyLxbo2LUyQHj7EU0xeYS7n4+MiQKVLWwOcfovcd8+Md+keT0zTLP870UfJ78XC+zapkR4CIBuKnM3xHke4voCw",
+	"AwAACABwGgMwSgeQpA4RLBgx/BkexheI/9DXY79GC6N5bnJ2ozVhrzepDqr+4/DlhpzHa/1LBp/to7qvQZDc/zg2hgD6WKw9/OJ3",
+	"PvJDM+bUNSNrAp7kgQxLKLgEQ4o4y7ntJG/47wcWzPb0e5dw5tvHLoAYOdnhqzSztKmxA8iUEII/P69xT7H9piEsJakjqi0tU2Cd",
+	"3qE04JMSuHW7p0gSdEu3xw5AnA8PwbStFweR4aCwAwBAAAAwBQEACwGAKQMgTQYgdwiAmw5AjdLjljf6pf66/0lPba2Bp9jbm1oM",
+	"h8MP4ZuQ6ERIN4A4Eb1w38BPl9/glPgvu9nFY0Iw8bVxsT809+ZDl+QVJNqsNHsmFB5iBqUMR3X/Qfvv9P85L4zB5lknGuFYNtGU",
+	"QSIqq7K39HCR9dQwgdYSLXNef339BnHu315s5WhbJLfeeNtMPsVOR9g4xZEYVODRQFazjO+8ntbKsAAAMAEAgAUBQCkDwGcIwLcO",
+	"gScZYSflyZdH/T98c3zKOJV4tGjVJaxnIJfUH8UHuRnOu0qX1vUqZktxmdQXcs6Ru2pKh4nRl8J5z6n9tNJLJQJBuMVNhQ83Z4xL",
+	"B1CuJSZtHZ03Y9bu+X+x5ycULi3ZuIcUiwhJXsVg8zAjyQAb2SFURu6DxShfuMWfV2ktXBeb5OSmTc1quFYXoooKrRUQM46Is1nh",
+	"iEFnvGfcJzagzUCwAAAAAwAACABQGALQOAVwdAlwuA2xOA197bby/3+fqi+wN5W3SKtLQltUItf0u/a/4DoR44dTKz7NDivsm6Uu",
+	"zRNyUtCUwBthU5Y38sRxN2ZwzjZO44yWSDwrzjnRFsIeecbY4XwGt/i/zuezuwgta5FzjbNUcngHL3OTyMVWjxVfw4Hkcfdu6QmO",
+	"p1LemwsGPFsysI8k4DUcMhqsg27L+fB4EItEScNx7eco2bTK/K6wAAAAAwAACABQGALQOAVwdAlwuA2xOA197bby/3+fqi+wN5W3",
+	"SKtLQltUItf0u/a/4DoR44dTKz7NDivsm6UuzRNyUtCUwBthU5Y38sRxN2ZwzjZO44yWSDwrzjnRFsIeecbY4XwGt/i/zuezuwgt",
+	"a5FzjbNUcngHL3OTyMVWjxVfw4Hkcfdu6QmOp1LemwsGPFsysI8k4DUcMhqsg27L+fB4EItEScNx7eco2bTK/K7ABoBwAuAkAXgO",
+	"AKoFoCWA4AYgRgOMH9jCvPX6xfwOi4eVu6aw7Djm12Gs26aXtZVQkyGf35oZt7X+0X6MPhKhQRds6h4llp41BeIOv96R04raeRuE",
+	"pJvIcD1H9HjUiMmYNoTA1MAIHmUwefhZmHlnMed9m0HWPRNleIMta4lx7FKuRfa+u7HVsjYalpnDMRip9tJuH2r5WY2h4dvdnDXg",
+	"y266WNRBKb1NO1lYWNMU6LiOSMAGgHAC4CQBeA4AqgWgJYDgBiBGA4wf2MK89frF/A6Lh5W7prDsOObXYazbppe1lVCTIZ/fmhm3",
+	"tf7Rfow+EqFBF2zqHiWWnjUF4g6/3pHTitp5G4Skm8hwPUf0eNSIyZg2hMDUwAgeZTB5+FmYeWcx532bQdY9E2V4gy1riXHsUq5F",
+	"9r67sdWyNhqWmcMxGKn20m4favlZjaHh292cNeDLbrpY1EEpvU07WVhY0xTouI5IsAAAcBIAsBIA8AYAcAkCAD0F4HMHRdTyeulr",
+	"/pG+E1E8Yg/sbSSt8dmXq5V//4i8kW8jy1/TSr5Kv6gZiejTp8oqpspkW6cbkKiP2/iIEbMzIicNMZO2+IyIemZkyfEVAwKaEFVq",
+	"GI7QweQRbsW/0SO+H9oyRGGguyImdFpAJU6pxPdtgx9haEEgnmkOY/E7O3xn5HnchkiUFFJsEuXmxcxkh2XdwbllRSpwr6VTXUjA",
+	"AgAcA0AhANAHwAAC4C6CEBXguEEG3+4Ov4k3v8D2Qn7zBiBbNQpaeq4zCP1QpmJH3KX9NcQg43eu/T96DtCa8u2cpubAuZbhb4R2",
+	"tONcndOksSQbY6kUNvmamiJyBoxg3BVyAiRJ2pWPjTT0OoJcvHBugax7NlD5a2pb1EKqQpLinA/LNPveFMQSw7CcDVQpSO082zPq",
+	"Ym+Ajdr2LDZW0lz1AuvnjGRr3+/t9bYklHSb71CwAAAQBQDgCQFAFQFgJwHgCwAAEADQB413VC+Cz+LH5VgPmP5+I8CFe7A54Gm1",
+	"r9adnvPLyra/w7cuH5sXk+ebpuNBG5WcHNnlLl7spKbn/2CthJaWcEqojZB4SAtZSw8B6gUA8fWOXpGxKE8M7DlMamvgGRa8l7hD",
+	"Ty0gInDFW4dn27W3WlZLhCKg5QWxWZ4eor/MoeinEEcPmOCHy45tAPp3KytaBzkshbWOnZJAwAAAIAAAFQFAGEFEDbCKBaQ3QZTc",
+	"KOCf4OvR8Z8yB99FtXnYq+1R6qAwX/Enm3TPWDZ506h27q8iFX/GksC/v2RfOVTTM/5fG/+UtG1Vs8cLrI04j9rgiybrEtdAS0g5",
+	"KiOA2ktX2Gxsbbo94U6ESOk1juuz/EIn/B3iy5JKJiyOLjt/wnkmU0pvKvh0tC1CwnbZgeBFue4WVFxvadNEpFco1TIIFMz4HJbe",
+	"LymuyO/nLFdsCqGUALAAAAABADAMAHAUAZAYAhAWAHAEAOANADh7cR7zPfkk9Ew1LAw8/o9iF6NvmjZbfqWxJcruvD/+nDh++1dO",
+	"Pqa5CA1wGXpHoSAeSodiYVpZ6bU9ikCOX1MjXBXF2UYmIUgoRPChib9FJuKxLj3Rs6kaPd7jLYGHOGLOMBUU5nd9VzvdJAxhRRmF",
+	"CcBTnazsbGOpeFacQMLRg7OXz97ERR53h5O3s3WuZSlNS1r0wAAAaAegXAToNYH6EmC4hzAWunYXPf28qo7wq0iP4+DSgWPuTt3n",
+	"DYT+NhoiSHFHDzp1Ll3zoUHI6UJCtH8z3+CTSD0Y+naRT2Bs3orvDohG6d98dbFsy2YcsrRU0NnqM0AGLmJMLLzSzUkQBVuTmyfc",
+	"C1z5vhP7O+dtiPJNlEDkmSfL+0Z5BmlsdF5xPyaidJ4rQDlE7zmIhoFXesgbVbtC1qNN5o1GAWpm7jdY7n9NjWNY1WLtKKAGAQAA",
+	"AwBAIAKBACoFgSgsBWDIFIMgS7bPYh/2m/w7/qKSV4Nv0pUQW1iI6kPiv/jD0V18NuiH9yUEH1Ju09pGLArMmFbyeDaAPqDYqM+R",
+	"eW8WJZjYkbhKX4AcuytEZCmASNeM7gS7JNPKVr/F8dnvA894Y4gz9r56BA3xDGNCxzGcTwtnahA+Q0QGm1+ZtRba/qaR9LzldEYJ",
+	"EVKJDxOpsaOZg77WWmgL6nIgwBQBRAxAgwRgHsDEBhA0At52zhcv0MvgFfpZjD+jc8Dw4zznrCjoBPvQfP+o8Kp3guNfx3EMonmA",
+	"DEFTh/f9/wwLn8Q+6LNB4Na5a96r6t5bQxIdhgt0OGujWoI48qIi3BNVzOam1e6OZzmjQd4SarVteGexeK/N32B35WCHhk+kcGcZ",
+	"9M4/YeFNvK4XR5SUoNt2gMeODzvA4KZyPusVhUg2zkWaGauDgLQGwEVosRvOsluNaZiF+khqoAAAAAAAAAAAAgAwHATAsB0EQIwW",
+	"AlBgC/Qt4dP8u/5EfuyUhkk/CdmArXAFtq7w/v3rhR95NIv4UgbeumgTzjUUJFmAsWPIL8ELl3SqThNXCCAJKORMRYG+GSZqDBUA",
+	"1SAxUOBxQbEGK4DjOm0Ws6xH+Ot9Z4wMnijN87xHO8yusQXJlBdNcAMxgGZws2hXMWqR3J6TJNkzZwxLtieFnZ+ljPJYh9EX+vDQ",
+	"A8AgALwBYAoAbwKQDvA4CsK8JYSD1T3Owm55K4yqIPJlyYLdnZ2h88WFClG+OlnVNqxgxpd+uTFA1iu7r+divDYbi2q08YOFmveT",
+	"WZXR6XlREgEyQYx9bbkVCpIgNgXx25/YaVVwcwEU1BKhcH6DcOzjrHu/hz488TVkQE26SijLN6x5NtGwuDqQFzuhqhA3EohKQTcK",
+	"nd/gNN8TyNgonbuBbIVQ1FST4AYTA9kdb0mkwLhmJXSaCwmAoAAAAAAAAAAAAAAgAAIASBADoKAUgwB2FQBO97P1/pt4yfkSUHr8",
+	"+uamyrdXlWHfnXpp5L/SSH72eTu6p88nCkf4F9UkgAazelGNS1V7L7RegePSa0yzUDCB+To7QmRo37v1e9mgESuMhk9tD77ka94N",
+	"794tlBBV+T4XY9Jyk9w7xLLml5hy8h+z5fqzrSKKeql9iosGY43Qsbvfx8dL8z8x7MC+CMAOgVAUYPYJ6FyDpiQAh/E0MGP+UPEi",
+	"fHRAYPMpUTG3Bfz/OOUxv+lxjp68fAae0KyD/dyvJMBxAoHdq7YvZAtmrDMV6FeMuF+hOP3SzQWOzDZSoIgXemSCYHpEAtjYCI+u",
+	"oN28IYZrImKA3jDQ7zvmOo+iS93t5wzQcCIa23CQp515D6pAuxtgLRNNKGIccLHUQKDTkOQzeE9f8vHYt0jr2+WiAylzGVorKVBx",
+	"pOJ3mC49zKxV5ASV4JAAAAAAAAAAAAAgAAQBgFAYEQcCcNAzDwovzQid//0xb39qsOf5sf9DKza42UkZXI300+GvsBpk5WKdYIcJ",
+	"17xpDJQnJYImGpiCP3zvlWWDEJahUbp2jKMwBo8R9gzvadl8dgL1EDt/NZqdgOb1mUdk7RqEKOc/wcRl+dx1ew7KiCYiS/kZAHl/",
+	"HW3ISIpIN5iCzFauRqjG/n12cT6XoWNLgtAMAIUCsApQHwB5AhgQtjyt83RqdzV4ioyeTzqR0Rj1JLyIx3q9U3s4KyumdbQgvv43",
+	"iAeyNRZ0JRgnCvFRsug02ycC/iRwayYsH373qrRyGaKFQPVycYPEniUEiXgApf6BZb3spBhmqKGwNSJig/Pu79un/GnUG7mwdEkD",
+	"QgysI8N+L6zujNEHIaLmY7hUlT80C6G3j97oO6+W46rbt1zgWtDExisnHIISmBlb9jkczHuZahgkgUVsAJAAAAAAAAAAAAAQCAAB",
+	"ABAEAABBIHwiCEEEu+fh7//RMROMSU/xA/gxS6ntHJUL2t/ir/m76i+GHj9oulvCTZotAMkVJwokeeyVtt4wqahsDYSl1aScwijq",
+	"gzAMU6n1vRsQ3eUWZtY+Z4fr1us+e+G3haPypeCy+5h2ioAlJr5XQBm4sLKnB0JCJ8+PfmuxNTQ6Dee/Lnofa87hMNAIAH0DiBRw",
+	"ZAIBCcgAa40Btfxf9Sq2fhVmrpx2aw8twW1Mbf74ZKoulwu4LJ0WUavPcZaeKDH4cIFNq45qGvDU73yB2u7aVR246rb/5DtsVSRR",
+	"U6cGwIQGkfFEMAFcCdVcS6tRfSERtAfPdEfTvwX3LXr+4K4CdCUhC0iWRUbYff/Xa0zhGxjlqVFQnguHY+RARL73nF+W8j2+a3Lt",
+	"WsbtgibP4zC3hYAUwz4Lm5vA7Vr2GaQzSOFvoIAgBAICAIAAwBAYGAIGAoIBIKA4DAAABO8v9lfwX//l3KzU7m//DH/Qm5CnMAKz",
+	"99/yz/hXRfxsqlNlvLiL8Q7iPMnB2M0K0IXpd9iWFTcM3AgwDRXhUizbQkl63Xt+s+YC6XP53neXh67JbbqM1GSMnKIpvCwMq/Gh",
+	"1pWnjGmsTiPADFAJ1d/PltaGJraB8vB15+Z8jhcQ0A1AZAFMAEANgG0AmQ7shE4T/4Qvxmyq7Qz5cqYrxq/OTHTr4/DhcqJjYtMi",
+	"asQNnzLzpYUgLG9ARMRIU/7iQ8TXip3B5EWQzh8ueIFbepanxyAr9ykpxjSHExDkEsRNR9E8KIGEvRtIOBc+SHhpfxTx6DoK50qg",
+	"WJ7JlvQ6d3vkv1LO+AqyHYqpBsJBKAQyQsgjgkXxPvPpeb2lD4xxrKNUoT/LZSZxg7di6i8Rko6d5ZaMU0QqjNPh4IAwFAACAQBA",
+	"QAAABAQDBQFAQDBgXBQACgT7M+HP6P/ikfKv7e/3B/O3jKGXk3GfWf/t3/8Fnj+MsHAuX2jDDUGxYsCNp2lhn69wCAjI20ajCAZz",
+	"WGXimZQZvwEXo2iZEf2PAbbO4GDITNIMmoRWyoagXFJyysaGNq6RGGnWMDqaE+3raR0vh9XNmTAJneymcXxdMDmdDMDQG0EGBbwZ",
+	"QHRCPgpWfER3j5/rAIfAzk+CSxDAaym/5cIa1in3j9cBWit3yJ1cxRZ15Y1AXh/It+Axyd6nBexgQ/QrZLeazLjJ68cs+NTBURYD",
+	"9sXMcRkhAOwYFzAWy2tWcFa53lqR5CdK1ItB84/+d4rX0NbgLwqqLkA5U/AL95P5RaGLEQ/UBLC+NyKJ0SMg3ChPvhf0Hx+1y9I6",
+	"huleyKGH8rrKAFE84d7fOUWNklws22To/f6OgoAgBAICAQBAQAAABAIAAQEAIDAQCAoOBoCQnpJWfwLmmN1N+vv7m7+gdGCMyTxn",
+	"/6b/lH0576kPMu1SqpCcWXVVlXaeS174XalrGfG8hkc4mUjuWTasKSaes1s3DDITuehz9rUQVChWJWYJaV0PSBwuOEmQrKrxZJsC",
+	"9eyNph2t5GMrl9XPdPGkZ3CGt8/mw1ulpNAcQSAG7CKgrMNUBc8QeFVfx1Oc8dHkHLpCIt8jqeANYm16xP3e8fGvRWIdVyPBoxRe",
+	"wFJDA2MOAAqxaZUbXiKuRzI5OTtBX8SPOXbjv8l6ESivkm1nGzJwIQRzKwiwk0gzglHPU2aDIzrJIToJnR/0GFkJVFrEFva04Kf+",
+	"K4noHjOY8SUge4zPEJQEnCMyp+ZwnRJjfS/e+c3mAsnUtev1+YkGhzmBNYFMr3JSNNoaVJMY4g0P9Ho7AHAAAAAAAEAQECAQAAAA",
+	"AAAAAABAEDAQTBv2zN/+j11n+ff9C5pBi3R6CXhN3v/JvMuBK965fMbzmU10B4mw9oK1GSKbUsYW6Z4Tnc/uUQvKBMktFiDAiXZN",
+	"uylX8nw+xqYcQozxIIcVwNZB0yqWBCj9NXu8G7NJeoa2lQsZ3jZRTd/R8vLaoOPOIy9vNbgbQNATQOQGnCXAx0POCkNOgvFP3d/p",
+	"+mhyBpzjsz1oA2lVIBX26XSe5+BqMh8VlodGjSCLKgAIleAXAGVGHla4slm6m8XCrpwnr8PfeiInjACuiEOHW9QECcvxsAbrfLnH",
+	"HArPmNk5TMlGEDkobhCD8b9FvgouhtBSiuhsBZnvcy2fr0H6cWkkvcBtSulMAoIsJsKdPkt+3+S7e3q530zg2eWAST5e7ny2MHFp",
+	"SWis12ETLYM+Fq3c12bAYAAABAIQGBAAAIIAAABAAMUBBixAL85/uv+9/+d/pvmP+9xc4GYYaBZ3BUXaH9LeqLUt7CMPinniC8Wj",
+	"mSKDThFYwVCk+VuA9HaBmqSJ8u8YACI2LV5WXKRZJMBM9N1Wxj40BjRAfOQvKWGLaRk0cecfX+Dz8nJRhXo17c1OVzuMQLD7/j4p",
+	"DSxpEg+7wYqlANAPQMQGNCXg0MQQEBtjQ1d36ij5uVheAZWsiJIrV9qmx0n+Oq2E/NHtHmRZ85BjUr6BQ6h4E36BMx8w3UrWVQJt",
+	"Bygx88RmZHsF6I0mZmCDwPmo7kHNDnRQ3obp0UYx7sBlRHmJhZhrAOUGLihP+99T3ETQyFA9hrwU9N3zKHKpx+Sr0AEOlE4jLHj0",
+	"Ea6uCNmiYWC/mPZ91JkuE7tyLZMEEJXIzEyW0EChIBItJ0PBMu0anKdnoou2AGAAAAQAAAgAIAABBAgAQCBBBgoUiOffuO4v+G//",
+	"xP//+F3U6VdGMBomZrWkhP5E/SHNs6DNkqJopNmsVhiaBxYGkoFTYoFpg3LuocaRfAB4DEtSoBtYMCKj6JVibCF7zeRuYeyp5AHH",
+	"xINosS0LIJE44av8fP4eqQpQRoeFwtjpciABj+r1VxyWiFGk58910EDQEsDqBuwpwOlEsAiTaPNYl+rZ+qrYXgh1qng4y/SaI89b",
+	"/lVMTl4nZiDkgzzOVmdiPEYoJ3TeIKXKfkUqsqyoLg8u8C+9DPD3P7G65IMHwqbUtw+NmJKiiJoBQ7VYv5UvKWPME5TiVFepmVZD",
+	"H9I6buozQenSTsL1gCOP1WrqZsEhQknV+IEKBMFLgBxlfkCNMFwC/r/c9zVBNXsm7cWwweo7KWmyzUyRjAbJkvHdC3i3Tp9y2Zjk",
+	"UHAAAAAAIAAAEAAAEBAgIAAAQCAQcEBwINHjL+Lf6Z//K///cSL/dJ3iv9RK5G6WN2m/z/5T4G0XJNsYGtJZYBQesInzWg5bi2Rg",
+	"JnCuuMw2nZUKW0ktnvovJMpqqkst4yuobfNyczp+h3oiyVCpCWw2wyyCVYqzx/n25wNurO63rb1jiXlev5OvFWWelPBHlxbu7NDQ",
+	"HkFkCZQ14RtFwA03UlqS/+Wl9+e21iAAsJAIe8wZeUn//kEMy351Vd/JPrnNqkLBboSUSemBwL6RnJ/lYXoxKs8XL+9K2Qfwm5u6",
+	"9pHJzYi3gbhEYEnbU/gaQNj/vHUnFqkUHJDAbEYtYb9EZ+h9V1gTJLS4A2Z58FXDLrV0RymKjJEZlQCrHd5NYH1hipDN0PMl/O/R",
+	"eWjSYYSzANowJifS9jF12im0JG8akPK7NqVcsEJymHlEUHBAEAAAQBAAABAAEAAAIBBAAIBQMDAgMIAetf+xfd///2Pzf+hf/i03",
+	"+ZCDnYjj5wt826O09sfX/NFDXUPyGldESDyUgX01OzEiVCv0/oTFU6S7MNhvbdZwnnsYfkvXaY3BkGxm97Pe7uZVosRLQ0dfDmYa",
+	"qwDBKWrBgpHFxcdkKCIkKiAhcjjYMEcVQ0keClRrGhp5MNArQc4K9DdBDMVWGM8HUHXP2bnEjPGEpQ+p8DEjRRicAcJ9jDy63oiF",
+	"/ghT+h2rabtJBlB90heDxgVBdOrHdXw83KzIzrMqr9zuQujyc6U+RMr2qaHRY7Co8i3CAEevtyMDq/RUioCUAawaW6Gv7t6lqxFT",
+	"C2UdwZ30btqxalHCzQqH6TJ8BM1H29Ow3n7OhUboBIr9T+T+Ctdkg0Gh2cYg0CpSRvsBmosyjOYH+1kGKYJTDeosZaiAgCAEAAAC",
+	"AEAAAAgIAgEDAUAAACAEEAUBgQChCsv4Q8D//4BA/85fozpiRqJrox4Cc2/yJ1XHBonV1XsOZcIK8H0yWF0FinH2T8LXipMFNdY3",
+	"mmVZhiey6c5bz0hlvJKJ66s92y3iXs+1q3oVSYuF00mAwbOExmAaGDAREnkcbSlsxjjSy2ZQedy8eYYWmQiAyECTjbHAxYDQHsEY",
+	"BWwToDrAxgW1xsx2j6lfWj/qBS7mHUr7h1pckn2zzAPv7+52aJUuD547BHV+yCrAK4SudmCbaNtXRBm+EXjrshuqMF85vLu47Do/",
+	"OW8jFl1HRUzBRCLUJ8Fcxbs4aXqjbDICsHM7lDUHbnv1WtmRTMSororvI/aFjltOWJTGR5TT8ID1PxxgIBK7NzoXJdAT6f8h8/w2",
+	"2SyJNlm0Y6YDE8idpoqSLBmLEmFz1y07BDyOt5+VgIAwBAIEAYCAAAAQBAAAAADAAAAQBBwbEAbFCu/wEtv//zf8i/7c/54/fiik",
+	"/cfPoJjH/wz8uVSIgYw/kapLDRIRh/JAPROI5pz2feUCR4IQG1zec4w+BpqiGsPecUcouuouB5NjENq/n51FCROPvrJiYuoC/uz2",
+	"WyzSziMBVN3q7UNUZKkSDQQGjyNCUnMRiJQMXDt42Xx8iNAIgIMEIB2Qs4PJE0gEbTkM13+Tr+xQU1ab7x3ouymY1G4z9v36GNcc",
+	"ioHD8jTnf6OM8iFEhcCknBKAyxXhK0KV3YF8aZusE3mJ9ep1cChBqUQoTyWYA7B1JMsIvQBRVsFhrfarseQQi7wZV4Rc2Q/TqffV",
+	"eyiIObPRzov2vUkY6/Rqtb5FTwkJa2tREBa6qcJKXJL1Pxv1Hi6VYHykTrUAxyThxF3OzqqMnTyAQ/NUnStQZFlRE4OAkBAAAAAA",
+	"BAAAgAAAAgBAYAwFAcEARBwKwqC0TA28wMtv/mb72/Uz5jeeT0DvNsv2sq7/+Wv4lqwPRFqzGWimP00H8JiCkpEeOwy4j0drCvpz",
+	"l44gMvac44EY8m4Nm0FJ4lRpJS+Cwd8gD7lZXFoAR3MflEcXDBYApvTV+IYA2GiHhNPP8HWi5rUZgrt3cEIiZ8PWW01HKhBGZiZG",
+	"9kTQGgENBagbUHGBvQgoMFiB1O8+kxoMfuc0u1EBo7YqaUoYdV8r/uSvJEImxflcH/D4HvBF6J+xMRRYAfa6Bs1GNATd08mM70j/",
+	"1Y4h3PRzP7SnGhhmeckFwEfxBgngiKPJGvtuJ3SgF5QxVFHghP+ectztD9jp3VHzFQkb1q4RVZMRmOAQymEUWAtBUXAiRruDzHN7",
+	"xXUfO/P4TiEsr1MyCNDcoFBfJeHvKlGnCEC2M1mTZhVAg9QnkJAQAQAAAAACAAAAAAECgFAQDwSBcIAhBAFQsBfkZ+JX/wN/9Dfz",
+	"C/Lz52V6G2CE/z2zo//yt/86VKfhw31p6zWiXHrJQ0K9S8I4yjRyviGSUtdYYOwKaY/APYsDY/P4MxIaKLNk0qPqqnmTRA6TNyaT",
+	"DewrvIM4izcdBEhyu/v8eyZu8wzODLIdXpyO665FudyVfNBFCPsLxcKfQAKVt8C7dtADQEICjBDgbcKCDURDwDZx7Kj2/Cf+pjXi",
+	"apazDZrSge0D2zIvq9MrQzwJ4FzCl2tfgGqAAZKW1dwsiqH7mwxUMKuthjD8fj16+JEV0TgS4jU2YTL9gSijlkV0DUL4MoJ420Kv",
+	"BHsKUEs6Ee6o+4v7RKw2i8/uT2FqRGwvXpjim2zqwwA/BwpDMRJSRyqnxiL2E3c4fyf5LntcwaeYFRsQCiiJLsx47hptXm4OfGW4",
+	"gUgu0cLSoJCQEAEAQAAIAQAAQAwKAMCANAYBQAA4HQaCsTqUf79f0N//+jf0Q/1q/C7eRGT+/cCunz+CH+9sSMGy0StuxHrNJM9S",
+	"I2qCyLY3gui1yRqrCaRt5sp52yRFyI4XIxxWhHPnUYm7+rlTT021xzWpFh+7qJk25m5868U3iyFCDQcfzPSXu7bU3qoqJOJI3b5W",
+	"Y6K4leTpSQcYmMEh0ZQLIBxBz97RmYHAEYGYEWB6AugGgJQKUEY5q8NR+4P+pD/x9g9KR54PyOMxKiAr8W/23vkPqv7oQ+njAs24",
+	"z4QQ2KAkkqquzdaqsVCD9AMKLNGO/VDqBfkwxVKk5FMqk/wyUPRTFCAOOEuM/amVTn7JwjdhkfK3GzJ6voNSF82gTT3kIMo1y12v",
+	"80xKIx3OikCTUECqkpfJo8AyH31dPGek+pouHWzNqhHrIGwQLtuV76e2qaJY8oLpuUwLOj41YqAIAMAAAAAACACAABAAQGAPAAAg",
+	"CoMAmhwE6NIvXz7aq//xk7yPu24hMiCTQRccnyQV/Kf/5hyh1yQGndXCn2Yiqy/xbzNqqIIhBA/h3i1AOWuJ+NEU5W1XmAg0aIqo",
+	"sAoICkHwjFphM2K7PqrECSd8/xq0SCP17KG8sSSgJkKy5nluYXWkICaDc5trQDKyNKPgBak8Cp9azoLQdNidhxVcqpcTV2MezHjA",
+	"FQGkFMDzCYBgQ5whEUgNLyil8l/tqzgf51KbdeyZeiH+ugpm/7Wc4TyPUN/z9OLJhtp/ojwFzhYq8WSjNMWvKmi7mxFz4cs//mJZ",
+	"+awPqTyhVeYHmnC+i6T4KgNJIYLY2yLvFCYOkCseoulJmsPCLnBpjHT08EXpDI4rujbhxeJRPIE3CVjIAwwlPjOA4tVb6nB0ih+d",
+	"6fBsqv1ygmBQ4fWJDiul3OJWITU1wFAR1HxzCgkAoAgAwAAAAAAIAIBAFADAcB0FgSQ0CNF0NskAl/kGna//6MSk/8HWsbl+OKLH",
+	"Kx+lj4ya//jZuV2XPdgJGrI/N1XRiUmYQJNhCE1Ii0Gs2IzTjvznXT+XIKJXQgOCjocMXACsXrjNLlcH17ptZaGrpE47qchiY3yX",
+	"BHNmmI4GhjcM50zE7nCbYXTWbkNtkE8LFj1l3zJjUKtDtwVk4n6Oy7rsOAT9LxN7Ft2J0MADACAE4FIFCD0C0h+hTY2QPjyMjcf/",
+	"Fc7LrsPoCfDnT70axO4bUXyp81RETZ03X1tJ5uqAiC0B6K+HTmskuvCzpOYyFzxnNSD2z8BJCAOrpMu7q7ytA0CVo/j+CoMOruSV",
+	"DJ/0dgsPHGtPFGdEfR8ht0ehsqZS8IB0sj3As75hisVoClDQPIQFIXi6UHcfXW8jf0VZ0/mbffMcrzw5YMlDAha8RuKrAjxTHjYG",
+	"Il9szyUDILAAAAADAEAAADAEAOANAaAvBCBbCCCnDMDdEmED1GLoX/FHnN/j1SerQwEY0sbboUZRf9U2fyD/mozfYcMsfb7eWnvd",
+	"wkKLmFyKlgEkv+Qalorw56UrTNQSwfd5zn4rRTA6kZjR9DptZQb5bNO2LSW9nvsDg0PpUPcGcDV4hItpGmZPhWHyGzJAfjebUWCI",
+	"EtetpPwefOUwxm3Knj9aQ7Ly3dVmp8Pxdm/PiybAAABAAeABANAVQTgQMMEITFcAVON+o6f4cXXZbpAo7jQJOx0ZC8aAPjmW4Qsf",
+	"HX44UdPVgIdhMNYMPa1nUrAxwYpgtVwttg3hN45dPJSRakXHu2axSp5PTUGjDiEQdF2L/w6m1IqXOH/0trqbHLJ9XssiBxIbK3MJ",
+	"1oybJnPD8EucnRAjosbBfJzynxAPlpNHr87yvx/euvVbaOVYTyVoLBaXa8bVmD40Q2WCheC9phCwAAAQAgAAAQAAFAFQJAOwTAYw",
+	"dgewcgXQiAk7u3Y6/2p/gH/0IspaoEZkdTDK6HUA3/F94Sc/0Ujl6YjVl3PL2q8dPL6QHMLdjBIgK49UX1Ofbvd3BNfEGPKDkyJR",
+	"F8q0gkQhzE1uNOj7v/b9UaMcUL06zSMYCKq8pdDYmhx94pt2OYPnlzoqnK6hAbNgslDFcaAIcj5OhFIIxIpPrbcZ2XbdFon/K7/a",
+	"5su4IKSwBgCwJALwKgKwFADgTwng/RSmAvycPuy//Ub/L48iBRLyEMDKihFW9T3x+wf8f3nU8Ot7DaeAlovPFR6uMEEcGCDK8KGa",
+	"96MlstvCXXuiVq43TZTjWcQEECgKWsE8fpd1lnNEeY8k8ZRhbiy9D1Ndc0WQyUmHRuyxlpAkw0zfNG1rKKCeUyUEaCOuoWiIVto2",
+	"Vr3fmfQ7lHtOGTImGG7KSUQmD2+ntXKV6adMIAtjuqCwBQBgAAAwAwGgGQKAPwTAXQaAawXAPwYgY7vnmAf8SH863/BS4Z1+ZCxo",
+	"OXZyQn+/7k/ZfirTrd1FWjhGif5kfab3yaTpZ1+w2FfCPzhqeRW3u9OM57JQj07JtSYeh0iqHRt11hmDFT+o/A+WuuoYkW8XuFiO",
+	"IybbnVmTpiAV+7Lvd0wLEIOnivJqOBybOYKQNhc76/n7GHGyWqMX8u5KcV4DptQZ3/N8DiUJZYJFgLAPAcARAeAjAaAbAKAOBHCM",
+	"DTEcXW+3N79v/0dfhwe85Ke71kIiHNMc4OfiL4IeSboz4H8VS/ZTsSbcXHk8xgQAYJsBweYiXLzVxC6k702ZoTDoTiLCiiEBDSbC",
+	"uAyCAZlq5ZxEhhip7JwFoyGiTE+E6bBa6Vy+yxblzOqo8S37P+CX+OIEtKkBsLImdy4YFV4fo/F/F8TBYaqXGw4247iOyW+o9nve",
+	"vcr5U42qqQTWALADAEAAAHAYAVAkAxA2A/A4AnACAkAlBKl4fEi/mO/8YX+Nt5SmIVUojOvcbNhBP68Pp7jVnVUptBkRMhO/Lk05",
+	"SoFIbrXpphDwE1EyqlRpnlJfWFMpBAkmMGhKTojIrwGVFsRGRAqIuc+t1xy9gpOzbdrjUJDBC85w4CuZuRvs3UMazzFYalKmJOSR",
+	"IdjZLLSzPT+f7vQ1qmY2iK9pQqK04zuPNEOD6fn8DFgGCIQJsAMAkBwBUCYC8CoDMCoB0AUC4EkGyMd9ID88f/y5/vsejJglc6IA",
+	"xgimBg1+kXwScHeq3BPlKVZFabXR00df16EiVIFHAV3ywRzuwJ5RZ1XEphEgaaF6OB2Sll8HGBwQ9vqVx0i9g8VuvcaYQNSfl233",
+	"SZRsFJm35mi5g7ZuYa1rvIaRU1cVg5BFAEnJZraD1vI+b9DxaTVQA5/FlVmc4C+67XX+T9j4MXGg1RSqpECwAAAADQGgDQHAJQHg",
+	"HQDADAPQcAjw0nPPnUfNr/9+H6cHyeL/W2kq+ZthjER/FB9fmZWPKp7VACSMo9q3hq8b0biFrrqxgPszmdrXOHR7UfJaI01wH1tR",
+	"RQQKMWcdANxO4l1CgTiHgJ0ie+INDEGP6pklxtEJiLK3RGvKYZukdJyfV9/m2Qr+lBYEhuOhtpFN8r4fy/RzK6EhANSvSDqLecN5",
+	"S6wfL+h0rGbORjCCALAAAAANAaANAcAlAeAdAMAMA9BwCPDSc8+dR82v/34fpwfJ4v9baSr5m2GMRH8UH1+ZlY8qntUAJIyj2reG",
+	"rxvRuIWuurGA+zOZ2tc4dHtR8lojTXAfW1FFBAoxZx0A3E7iXUKBOIeAnSJ74g0MQY/qmSXG0QmIsrdEa8phm6R0nJ9X3+bZCv6U",
+	"FgSG46G2kU3yvh/L9HMroSEA1K9IOot5w3lLrB8v6HSsZs5GMIIAwAQARAXAUQPQLkIAFZDbB/RKAQXSrF0vyGfFtDfNMn+D4US2",
+	"Rfp2iy/+mFWTetc/Gf6ff6fIpVupd6tX+X76572Pw4Wd9huKizf2NzKa+Og/FXFgROweH9IS8JlsNi2hQPOjqEE3s6JHWRsRBNF4",
+	"6xeBJnGcqEPsebsiZRUNRUB5lh8cMOkyES1Ozn8ExxDhtnNuUEwORUY3l2kHJoIlf0HrqK7qy13yqJtBvM9AMBj8SoRgwMAEAEQF",
+	"wFED0C5CABWQ2wf0SgEF0qxdL8hnxbQ3zTJ/g+FEtkX6dosv/phVk3rXPxn+n3+nyKVbqXerV/l++ue9j8OFnfYbios39jcymvjo",
+	"PxVxYETsHh/SEvCZbDYtoUDzo6hBN7OiR1kbEQTReOsXgSZxnKhD7Hm7ImUVDUVAeZYfHDDpMhEtTs5/BMcQ4bZzblBMDkVGN5dp",
+	"ByaCJX9B66iu6std8qibQbzPQDAY/EqEYMDAAAAYAKAQAXgXATINIIqFoDZiDAE+ZSAp/IQ7sIW3gg/jBD5Mp/3DxRX+SZNudVF8",
+	"TDi/fTFFwMqfX/Wx/F14f5LvcFA/xG1RNp8QaONcWm/ZKrgAGI9bsuSpF9XmRFBACEvBFCgU8ijO2mF03ovodCMOH5R4IBVb37VF",
+	"SjRKn9Z0Mqj9dng3NY5ZH0itzfdag3tomJUZO/gADEbAgeC4K6g61XjdaUSQL7DLiTICFLHg0APARgHUCiA5wRwFRBfAYsG0Bf4c",
+	"Y8EdPZfkoENey+OPCzU29zcA9W9nZN/+RGb1PjZfAXF963IyR6hUV+iE3H9siefkPyJQh/hDSd0ucHOkOP4GdfMkobSvU8Y2lrMs",
+	"uGd4ApraJSesdeSMEu8cHqwC33FlQGtmcGTgnr+sgU4pm8Pq25S8HbRMVUAAMSwC6XYGFhG12ypezXWe3aS8TtvkNhI2YtPyZKEu",
+	"4TFTTyEeyqpStZDAA4A4AKAAAJAKwIwGsEwDXCRBZw3wOjHwHW/Kh6ypGHMh+aENxuz+U4PO/kSy82268qTad9xoS+r+sv/Pp+Gb",
+	"lJZB57Gb7Vb5k890JXseWLnION5D9j4EpRCKMosIhwG0QMExMhXlTHahd8RRPUfHc2GsN4h5ESRjqk+MAQ+nOu2kpc3fMBCrm1EA",
+	"zGKKMtbiO+U4EpN27oKpMBTt90mAncm7n7McxiYq2fJmhc080A6AfQKAC/A1AO0DQAaQBgAjaUqvB1/EJrwR7N/eLwM9V6T0DCDz",
+	"fCx5fz3jDR691F3lCO6X1N9utZjHDTvf8iEpX3z1fCD/ZvUT60lv+P9gCoLo56SDibiqyoWUTrUuN6MMytv6GWGt5GadN9sMRMaL",
+	"XmMHyTuoraVFlYKS1j3aqTTUYcF9dgOGAAD6sPUdpLERWSrAsj6kIb4VHI5HNfOdQbxpgHkwzbFgsxES1tB1YxerfNzAAAAUAUAD",
+	"AAABgB4CYCiB+BXg4Ah4WQMFgWEnPVV5gxMLDl9qMVHXj7mw2n89iMGzwHXB1SvKxVBl+kf+O75uOB9l3jwbrfHgIZj1Okwrqvdo",
+	"fAm9ONUJTBEQPQnQZ8H4coJQeCjEuNF8VqohtvlNUmhnyrYhFKyqFGosnRnX52aQctsRFD2KKNYMwHbY/luyfwL+/qWQsJRFwFVo",
+	"IafqWZubYwsfVViRY4FAANADwD4BjARgAwChBaAh0J0Nqsmi4nzaXeBVZl3nHV3SznfH5Ldh8BX1p3yoypZ9gd1oy3sYQKi1Y74v",
+	"BleN+RlUg4T5hjJnke1y+bQR5uEmkENRkUXwS2HSILxE+5Cw7pKxB4vFVEtsuk9MPkR9FEAqGBolfawp8a9yZ8PlTZ0hbAOTy2Gb",
+	"3G5AwqR4IKobxU7pLC2lnMlTG2/86JN+nHwPC0H4L3QHam6q9Q5TNwNdNRVsTwo8WxZAxACwAAAwAADACQAgBgCwHgQQaglQuA1R",
+	"HBpulZCB/LB8QCIPbJ/UKQJiO/ACQX/6jYAnmjfmL8Umv/lYhW+5f8eHq80XwRdUxSZw53Fa8eYSpqKZZAwNwCxwg/YAvhhD3DuE",
+	"iJMHEw4ywlNAbPyJHZ+vjkk18tsjZjvsUVDjND4O/koO90kpKrLSLH5pg+dxnWN8WLwduwQLHRAe8olieLLNbM+lSiqI8mbAQNAF",
+	"wFIChBDgd8LwD3RJIKYzuKuO9eP4k1Kw4cNuh2WO1KzOJPIsfA1e0hDXPjQthC0gSgJmKueKDirAu6/V9JXm3tBxOf2l+Sf8rmKT",
+	"5722vax91wkzxdhI+3LxWNXbhjwhKdTU2l9LsN6DR2vpA2MiN+oTlZ3xn2FxQK7E3VD1645f44g9nhbNLlgA7CKxoyicl5wqQ3p9",
+	"kt7F2n8jOs+/MfyX5yY6WTZQo/ASNPiGSKyH4F6iKUQaFsiwAwBAAAAwBgAQAgBgCwGgOQXggwnAoQ5BXOHIuX9GvltMP1j/orBv",
+	"wJ/IuBE/zjTo++l8pmvy2/8vEZXxO/BZ4NqW3dcrQApRZWk77gwVyvS+zUjXSjByOVbBMDtNuUsboZwSSaiheVZZd9rizfroOtn+",
+	"/ZgujWaJT+AJDvWUEuaVeCDiusLhOYL84v5OR5l3JQ4/HQhSJycnW7kC/BmRd8UfJXYOmazQGAERBrAmkMmDpxEgLzwQgkG91ZrU",
+	"CQMKc8mmsMbuRvgXNC/YodHggIHdGU2rQljaFjZuXh1sxPpwitBUw+vVXvsXzO4muV7drwYkSbDiX210j36fVV0rGVddjikaZfcS",
+	"xUsLvXzjrXiX0iyO4RfLxqhPcXNxThrj64Kj4vkEoAWISHjuu4khIoSpJiVZdsY0DCzheG2uU/V2s37EX/NfynJaHahzbGOD0NJG",
+	"KIABh7lheZCOiT7ksAAAEAIAAAEAIAAAAAQAkBgC8E4HMIYHMKYObUaHt9zvRcHLsZ+kYV8//09lCv44MJPqPV/pL/Vf/NBVx6I+",
+	"fbxXKvMBuqSdCm6oweWsLrbJ65PwgDJf6sUMxhk1MWSMbYmAlgdNNvuS4PzITt/36kDW+0/NNDuGglcReXPa4Vw1o6AZLrsYoXC9",
+	"Rn3zNSTNcv5ZJ7EpVXkcBJseQHNXl6dkRa4A0B/BKAY8GuBiwZoILi4GBBeaYwrnDTDHvaMlsEF05Z5iwPxwuAcXBbko5rniHxXo",
+	"pUygR9cZezvRkCGIa9mLmsIvoLpc7ZsYvL6CJVfEj4m1D+NLu6wpUZUzSvNMDXOTC+vVornRgpXX+H4XJs431g4XzRqSDIe1NY0n",
+	"8exeXRmtQrWdttaMhVEU1EV+zVnwjJN5zi82fZvcwPt7H9R/lPYP+Rsz62wNbM1cTDg1hc+N0nVZZ3TxsWCgBgEAAAAAAAQBACAC",
+	"AQBYHgahKC+GwJoXhVeORTH+kflMZN2T/xaVAW8/Ztos/+0PpJr8zH5pf3n/NBmM8XuUDzAHPEdtKeg9tPgPMJa/UkPDfuCA/Mdq",
+	"3xGGcKMt5jyDjrHkfMKK9r0d5HccJ5OAEQLgWvQZXkkuGAtSN8xiJoIro8DLqhLlaufEI/Lb4k+Og7hgnRyTZHAjXjAKB2HZRybK",
+	"4QDQAkAiAiQTAHbCRCsjWqsmb6+Dd+kdjBLhEQ6n5aRAHfgOpgDcJMmLgQ8dWYLAMBEAkTRDCEzM7gL3AK6z7X1fyGhH9JjH+ekW",
+	"8Evnp8e8PXqWxmS1aFs3EDQMCrKLhVkvh9WCCRKLPwqkBJegaOiEAUKo0RgKuIik/U8mwrAIpa0q4HXETHJWRQH0a1sJPo1v+oZF",
+	"FzrMLG6vd6p69048y2gkI+xGEhO0ZyhBNB4+Qx6uSYUcV9PVAKAAAAAAAAAAAACAIAgAwCAHAoCsIATwsA/CkEDjQsM/llouwQd7",
+	"Pw+ajqt/JJ2if8H9fFj8jXfL/GjzVcWHbS7TzkEsEXnan4amMAI1e7m0TG9k7V2YtQKzyGkQPo5p2ieEwP65bJPrLnSfF91t9fK1",
+	"BInWUUpUkkaISlCN7XPyARiYYbEJ8vpYUDsGeXJmCX5AFtGiybCDqcLQlFyAr91uvfNA0CUBwwt4PLEzg7vG9jcr3F0B4qjVaIXC",
+	"nkPlkg3R70rJMbXxYJ5LG1GCsyzEh3OVwiMTiM9Bwi3ZoiVWIfvLaLluYBdmg/J782O6HHNzeUoXxZJLuqHglCeDCr+iul1E4Sk4",
+	"rVBWgU06VIjoFwow1rSosMQpSex7fjOIUYnIRp9JSEKlJOANSoLsSXCQtcX1mERQ8FNFnYTTyz0KfYzf4GAKhhG3M8Zp0rJ8/VaF",
+	"Qng8WWFbPokAoAgAwAAAAAAAAAAQBAEAOBABoDgMgsBiC4CoKADZGNFn3Fih3/dxPCN0NS27iPXRX5M/0j+CaoP+Gmkbic52y5ea",
+	"5Sw3ciFSUFYR0gSOxSg5SbHmmUNqE2+kdQAs58zxEnP8I8qimb8luvE/Bc/VaiXuCpftUwQqgTQHhYaXyearZ2hmCwLq53pQW5Sz",
+	"5uwDfEUw9cksF+Bla3MkFHh590eaeNAnQWAGPBpgmF9uz9LrKe+V4JZabJHdIB9Uew2L2PXQG7ZI/n2GtcCLTU9pxcUJjTYcGgSB",
+	"rmybnABZ9X2X6eXVQGFVnlzr/SHYLlYwAWDZntrTsF8OyOQNkzsMdu6/xgknYGNEiLMToTEGehG39w9MFWRc4+T9Vtt5qI9K+fxh",
+	"KgOV1tGZpqFfUhGRbxjitRkYWu5Bmsu/GviWxTnLa6ZsylDaeKsV+lRLHXtyr0KFk9xWSCRJwJAAAAAAAAAAAAAAAAEBADAYBwIA",
+	"0FgLAAFgDAHcT7pf5s8mf4BfuLjp/kJVXkZXw9dVv8mupBI38ALBecTJOfXu0l0J7QNU0ckFSKKH8IYGhiSMtPBYJVbY1VPM6ccw",
+	"h/QvItmRt97/tuu87voZQz+oUy4aFTC9oowS8gQXS6ucgZ2OMSrh70QDlcinN3gOCcR2cVBt+BGwNbiRJqacWK0M0C9CDAzcQsAW",
+	"9QGKtfk+ZvFqkFIybi4Dd3zblnvkqc4CFQschM0hH0mBk7yT0duEKTTYDPoypMIbIIXdefVrynUxR89lPrzMPgeGhiO5pNQjKh0K",
+	"OWQFAbKwa04ZTPjXT+eEirFQqTVQPCpiSOEsBKx/A/j/YbXj80yQgq1h+NmkqJ2jpVs8MwBUBop/Z8Vi4AnR4tW9FqXyztAZpOTt",
+	"q1Hmu8yEGrGOQpfkJTYLcTIdFmIFgEWaQJAAAACAEAAAAAAAAAAAAAAAAgDAQAQIAEDQwCcFKEfcz2P+fP65fHWK/+lQ30r727Rb",
+	"/t7XVLh90OFHfJH2+/lGpsQnNVhOD2yFB8Wst4QANximtMUEBKYkUyM8V0/Suzc+ri/rfK+e3/B7CLm6JUq1GKZIAN0bAJVMSGRu",
+	"5+IqoOvSFLyMx7YwkQbxOuLRw576IlZShQlPAmGFpiDQHwEFBPAiOBpa4t4RX1IXhyGSYBx6u/45oBzfbRxDWiqXz9WhOeG+9/Kb",
+	"WjEw74HKj04UjCY0V4QmcjaqxY0QW43vl7LYn86wLZWvEhvCdAFAah5kIEnNS6WhlXI7TkpbRC18GMskZA/iFRlTTSSKrQi/r+8S",
+	"7S7qqZv4BLE3FiYLgBcbr9VWcvmTqXIY5LCEYjn+5nvi3wq7Y/o8rAqARVnDYSaZFmSY+x14zSFFdBxtthmbKEZAkAAAAAAAAAAA",
+	"AAAEAACAAAAAAAAQBAwBwCBMSA9BBUPg5Hv85fgFwT6P/3OpWwhPLA5z87cY+hDzd9ZuOgK1HeSzE8RZ4kTyN4+QHIhnrFabxNJJ",
+	"00DSSSR9IyVHzTNuHZ82I+a77kcZtMHdjQIlUiLIZIC4IREJbOQlPY3krQVF6zx2NYOuaiIU5G7FGx89duIoWVE2MKocRBng0EwD",
+	"FRGwOJzcJi8/KcxS3xSRpUkteAbd0m9hN6PLlAiDPcmTDZJbC95yEQWIXAFkXtGsQ3mWIIpxZqrzyFhS8f//AX+Gea9Zr0OV/jF/",
+	"hFmgVZ2Gw/gVr6x+meT5jsLalkZ5x5qxxIrAXz1RYU1B0jKDXfNcks9Z2MhLHTcDKpXZKgyGYhG81VoBsO75mk2NxoFZ8Z0OYfTv",
+	"JlHYcDX4VVmnOb67zDWq0CxMdx7EA13wG4gtorxmxoAgAAAEAICAABAABAgCAABAwJBgJCwPAIOFBLExs/lTlj/7l8ZTn/uet81T",
+	"xDs+V3Hbnonuk3W+PF2TDoi7rsdRQS6rEK47NC5N0qiwLILkRB8gDpjMKRxvwibDfnO2eQeD6HvXIRGcNDJ6aNx2gKHZKEJpzqer",
+	"uX6jzNbADUgTIEKETIKfdbv8OO2eok9icjMlCQ440DmCbQxQk25QRlaf4vjydroRzn2qL+Z8FgX5siJjYCFcxXrkcGbQ3KiBuD2g",
+	"gIJuvTwEAKNqvBfcsUl1tVhW//C38S5j1sjyQ5uW9omxYdSkSrKWGsh0Fq3aU0rhwfrDiI875eYgqnlOCSNVFDDRgVVTfgW8TLic",
+	"pZKV92jKhBtN2PAJRKvPFNRoo9169J6ahRuCl+W3PoX2jXr7rNtMMcSKnvNhIsEzBoSYnMNoWk91t9jcMQDE01BwAAAAAAAgABAg",
+	"EAAAAABAMAChMkGQgQAB0IMv9W//un//o/k/UJ6i+U3GyBfkZ+jXZn+bcttG/9R0x8GIGk7TwZwqpQcGGpt0CHgpWuXAViGQ+WLd",
+	"sMpLHTfWaDRQAnBr7Yxas4Q2ZAnWTJ4UiqombMg5vAqRIkOGEA0lzsK5UJOfJs9XNxQAoj2BuQsKUPPA0AnATgS2DmccE+P4+On/",
+	"P2r9ZfxY5N6+R0tn4VXo9S1Zkt5fuLQnusr6UGA5Qw1MPoi0YqgtjTsBML94IxSMOYX8j/KChiBEhMJXqK8b1fheUnpccIKk+IF5",
+	"PY+Q0kflnWuFNHIjJrpcCCD6SBEfF+sLe5l8bn2F8d1RWV31DCkfIrGlbQ/JoVZUvKqY+JbTLDYdSEYr9ZRfm30gs2PG4HGMcG8z",
+	"1ucwzQMMDJCl4dpAIWyHD1mrUBfhLWBwAAAAAAAAAAAgEAAAAAAAAAAAQNJhcNLgsfBBzxj//zL81//z2c0LjxL7QYwYrficen+P",
+	"tz0m+ze9txMY+Fd6ryHOSEBgxX7D5ahdRprgwWmK8c2/g/cxa2m+M9x32WzFA8TH7+dHQt6zahZqsWKppUXDgQqvyUEyXC10WMja",
+	"uBAhn5N+3myUZELAkAXrlRnQV0N4Fdbq1lln8Tvrmf5a4bOZFnxR7m0n4nzqTfRKj8/LeQZsuvD5aKwUxFRpyPDJG9BPNNiFxAun",
+	"R9SJipgfZr6zYUzq5XTaaRvDxy5UPM5OLFU35NYnwp2owCmuUXVCT0PaVz+VJPSCaQZ3UNZO5wiLvntUC4bkXXhW3e/bmaTg2wwq",
+	"ngE7MqPDBkXf7zg57HoJyy/Fad+QeRVfWa2S36pLO06Oz2rVrAS5aW8ezAtZ5XcSzLianxdFYAAAAAAAAAAAAAAACAgAAAAAAFCY",
+	"F4pUhinvv////sv/gJ76vupol8hrGUa+h27H4y7f10/CP+dppk7muxVwCsZq8VBIrYTRYNkGlAK+fs8X8V8X5zMSaccO4Jq3GrRB",
+	"AAtMY+qsMFq5eZC6sgJB8yHAWoJygcvFDffVTVjZUy1QUktly4uDZfciEtQjoWZkANCLRZQe30niTzf4KqTsfnHy1jhC/m8VXq/k",
+	"wZ172hScf5gWS3IT4SZW+AEJq9E3azUYeL1bo8gLLlpPGXEV1b+2O+ENuC/PTDZmg8dmxI0iCyYQqJUL2MZSN7qCUoP9n3JKV8uK",
+	"5qfk2DBKY/qHEO9gJT1bucV6DLO8lL0CQ8dLqGtaCazUyomNMgh0nvEbzg2jcobFfZ+YfrWpafsM9OtallP2XHQjJssjkRyEs6pa",
+	"m9fnM9cssI7W/t5gAAAAAAAAAACAAQAAAAAggAQAJQCwKBS7VXX89/////6ihIcFaUolId0gRQKmzedFUmfdbLTnD68ydlIqdD9W",
+	"E5Q+kQ0dy+l/IuHSWMERe23v/A/A978Lf5daudepeOaJUFYtcTl5wGQubeThwGEMTgmO0ONCZb1fl5dluK2a1WhJOZzlFdtldeqz",
+	"IXTISocjlNCjxpYid3IpZa/y5ea/fl6Eojs9PvZx3R/VV3q7wNrF3889XEFpsKSu8hM/I5Sr7A9hHFKJiFRJAv+kgpStXvB7sREC",
+	"F4Y6+aeo5vDVtAHC9uGqXQHoE0cQX4MQMreljlxE+ls7MK1OwzBYm4ctEAGTXww9f6XHuTQ3uaJ+nSJlBHQ1q5K2iGVk9I4MOp9J",
+	"gKToeQTzx++e+ZfrV05nssjfuCQax7bTTy7Zk3T+3snHKslx2vzeeZMP2GWuYFAAAAAAAAAAAAAAAADCAGDDMYRNasgf9r////+5",
+	"92jIzRIhSa05JKBzKVBeN7my46/rXqZWHtjqDB2ktY1jkNy7IxpHFCIyLkU1WpHysv/mP6Pr9r3ee5FyL4V5JwDNoYXNLDL43HZq",
+	"ew8tCgUPbLtGGw+NlqD8Xovt1cujahPsY2pIGl0SlU1zSYLtGd2OhcDQpsbAJVdtAZdP89DoK36AVOnbB/7xYGVf2Nuhoecuae7s",
+	"acM4YQxHnFekMmnJsZmGhFfJ7HFuBbZclFjRGSvupx9yOLX4oYSaSnec7WQAI0TbvKjALBhUg5+5kMLPoi56xtotTO961wNhVS6P",
+	"EiEkNtoE+acxkPIYj3tA/ZJwzUQHRsZ94pM0KLaMiXrnQ5enaDh5D+J31P1D9MrHZdfi71y6UUvhtpKsw1xYs+Cs3VK0+1+3w+oZ",
+	"gQ2WKnJgAAAAAAAAAAAAAAAAAABggAQKEFCgYZOQov/+y/Tf///4WhB2QQGIVMnIIF/q3et88GYwjvI3495PQG6sc4Z4HEI0kIrg",
+	"YsrCLRgxMghnhXCZV/Uf3n39tL+mgvbPOuBcS4VWmZdf003e63L3EVT1kuj1eiDUiHSrL0brkPz9V9kKhKUxpizydmeDCDlzUQGu",
+	"NzIg0JZF9iQHN3KRV/k+J/5+49RG2+u+iBI6X9dLiz3w4DSH+WqyMBDVRp8nqQlbeW8yYVwK3ozsHcI+lmUWbENK/b3hR3QSe8Ob",
+	"F66lncPl1hs3SyYRKCBMImhztM4gVnOHm5GusVN7XrIiBGPE896JgOmoAj2PkMb41PPDB37HB2VjoVNOLXGoJmB0QwCdR5jMk7PI",
+	"cSPiOIpxJwI5qzpNWsCwmQ+bNaZWk6bilEL3SldLBPtVhqNPQ0CkqgSGcAAAAAAAAAAAAAAAACAQQDAAAAAAAGDAkSBQkL/dv8U/",
+	"/Yf8ZqUZIQV4XJ8lYHP7O8GfpU4kn8sPh53R0Nipyg14tEgUSJLVGcZZnUZB0hji9Liu9/lPifg83aY+/zDg2cbBqmJIRGhDhTEa",
+	"zO0c1lqPIJkWNUaTglTYSxp8HP8XlnzrzTZXAzik2aaKQ5bhhrkC1MDQWUNoF1akVrTX821qwP8hGE9c+T7ABVNv5XCHr/ZTrCr4",
+	"pjA9AVKBi42cMA4XW0JYQsOuKUbKQeFJzo4OF6V+YfdzyyNH2C0W36RnZDr+jHyFxAUiE5BY1g2NY5dWxJZn/EuqFfasrPiSGlEE",
+	"0qJWRGnBR0Pl0gW3HO5k52ub8OLAI56IuWRzCD+jZCZB0qDpshQkSzh99f8C++Ypznmq/JueTLBeiy2EXjQJJSbiRa5QDOf4DQ3r",
+	"VDSGvJuAcAAAIBAAIBAAAAAAAAAgEAAAAAAAEaFxAKARf07/8e/5j//xP/jU2ieEBNbvyoyq/Yv4axrHTj9ZY2SkQftT1zbW7u3r",
+	"zbCLY+lfroTabBHBHQOE7/E/G6ew0V7AxAcomoSRwpVUYj4CmcZX1mQk5wFGy0uEQUUKdlYF2mhB8O+AkY+nG3sgU1AvBfgYmUcG",
+	"yAQI0A+A/wQJQ86NZ8c39Rv/YqLJVwLfMBuJrfjHOQd/fTgMX2q0H4cgJU/WaD8zGiSqDBgFp5OdNGlYQ6vJ5w6Svqt9BvaQRHPH",
+	"c3GteNd5csPuF8+1ARIA5keCRF68NLwTp8SqnNUqTCn5Ux+wbsCiqgNmqEOHeKVA+7Ju66OeZ7vSDBLfCAz2q4YY0cRNXeq1DO0P",
+	"HCR8DvteWfi27aH21deMMxxZ4Pl4HiWoZRD9TVdQ0g3ueCw9qy5ogcDDwHAAAAAAAAAAAAAAAAAAAEAwACAgkMDhUUCAfQP/9Q5j",
+	"///5b9g//VJiy/+iH3S2W557c5o5Y0LzjtFz+WyAAbak8UYAtHPUq38Xx4r2QwTJoEkNV6W6Hkfd4MBc8CGMEYek8huvNYQ4MMyu",
+	"NFHI2PDrjyyFFyS8iJXSqt0mn5sfbi1MBqBGCClrxMCZUoGN26M80G8EzRyAQ55LFW/f4B75Nx5sBr9ow55K92EH1ff3tTMJPUT6",
+	"7bRtIHyq0R7q3foAdv4jwxoyAtsqQwabqhkFdD/71dXmQbUfq5SJmUpqwKBSfuGSYg5AHBpBJa6+EIhgonUXitR+AeRiDApZbTmR",
+	"vAez5dlm+EQidLzQ2iMT7FnCvgPFkfYRluBokUUfLnPMmwFHByZtfvx1C+ceZPPe8NCdA5Qcc36Ou6FySqPOPoOFZgf0eEvorgE+",
+	"W4iWgIAAAAAEAYCAABAAAAACAIAAgDAQCAgNCwNCQLFha/oDOH/9vu//kid5tviN+6HZj4T+L40EDvP4hzFOi+3MSgz2RMxn4hjw",
+	"qfFmQdCpNAm8UiE0LwQBvZ5ouB8y7L9PmWupwKjsOWpMhSMBLCuhkOVwahZMwIAMWWwxbqxNy5GjXfD54Vx6QMIMmLU1qCCViJP2",
+	"+DTA0F6DzxWAdjtA1ek/YRycf8YuV88XF7HUB+fhnOLIekybuH15GLGBix17MlGvOS3xk6v0BIhsWuCDhx9mED0rf+YejPzfJd7M",
+	"4R99VSFDjEEOnBiKfML0IRUl5yoihPM19uI1CYlvYtM4Ac+IKo4eZwsygPfBdMzVML9yAYebTlkArFSyHnd58mxCKQfWLdYwi5UG",
+	"WU34jN/KPlCx57oKdhXAELSeascewy0GkJh6Vgy8rtsVZZhjAnL2kIAAAAAEAIBAAAAAAAAAAACAICAIOCIUC4mEZSD/6c/cn/+j",
+	"/1r/83RZ9/zXD/PT1I/E31zHG2sgb18RSBdQULhc6s4EgHgl848h5r4Lo6yg2A45jPEgTUCG/dVyLN8Tj+P+pzolLEn8FjKgFBfC",
+	"eKUF0sTMtQqudfjxKgVa9TxOgtkJb+7bEYaWArs0sTOmFTKQy9PN0Z7QGEFCCeQ0gd24NlxoH3MX3NbaiN3Fd9uepelD4HX8PGGk",
+	"vU3V/uZYMGKNoVtSTEEusDTs8lLkmCpUSWlzNJc8Yv4CdmGdbT/wv19Z5pQG/AmFiUKToeRWSgACoJdqb4KcgYISIFRDdJUqQ84w",
+	"YuzAixtKmNj8twUGcPuKUNWyXjiKBfRiys1ByAzCAiH7f7nfzQCjtfWcVtXqFyqOQhRlYq0h63rJrZM6njnZQvRrMpuLexnGJIk3",
+	"cZAAAACAEAAAAAAAAAAAQCAAAQCAUFAXBQEQaBUNgT0k+Y36N/sP+GmbXXNnq94XHR198FpLou435LZf2SJqJCYBM0tUciDmxFAj",
+	"XqJYCNl261R0BaDGM4tyfGQP2asRhkvPc8Fg8zUVlpTQwmN5pzjBEwqTgdxAhxXipy0lIavdz6342FO5z1ffCGgMRZ8lQWdwryQ2",
+	"QVLm15stMNBBwrwQdFPhpmvPRjr7EeCVfJdlePLqehRCkHvieb8dFC4+DzH2WHGEyvariGGLDW5aU+IGRMHWcIYuPk5z5Of/8IfM",
+	"X88gY+3MzfUrZLTI+jCJS0FVknFFprF8XTFg5VGwKtDoM8cMeAOSN4B6sjpvzJg/uOt37uOR9Yc/qNY9ePGrqjror5dhh8R+a8TF",
+	"MefGd9By+N8k9ghWm2UDmGtLXA+qqtcqDoIQUPr2QCT+nn4vDI8szcCQAAIAABAAAAAAAAAAAEAgBAgCQKAUAgBAoAAOBi0n7de4",
+	"f/lH87vZLwPKv/47V40vNj1orGoJpjhdwmkOpkOkDJZUtAhhWVfMoYObVLL9VjohXSy0MoCQ+rGh0So+veXb1gtXfc7xmUxGvjIJ",
+	"PWfTNyVDSPToRG4UiJc5lKiPhcLX0yON5GVUtD27uJxKDPLzzbVSg4dQWCdqx4Iwh4DQFADvBogqUOUCktBmt3vqbfOEuPCa66KA",
+	"9zY2wnRA/Gzj8r0Hl8ztLi5uVWpsCa+JyzEh4kRaR7xowIrZ/ras3fX/3Pcboxqv1ZxY3OoRn03Q5PtkAdzRm8Ce6+KLYA5m2fqc",
+	"A4OV7JrFDB5nqZJxa2goN6NBaJz6Xq0tOr8LVkGaUlyN1S4j8HRw/69e70fA7fUdRT6p41jlFt5tNnQ4gek2cbmzAuKRqUYdWGtj",
+	"B0UPmA9ZQKAIAMAAAAAAAAAAAAAAwCAAAAAEAgAACgGASCgFYYklduUd/687dOpi9le/5Jvjgr4h/RDHtSnlpbjkbLPhARkD+NS7",
+	"YpxaXIIqKGOUR4UzIu3Vajl9rUwhocYsnBST+XZ5mDAfxna8tpdrkqmHGyJIoAJszIhQytPjTG3uIm54pzNcvM4AVLIThizON0Bu",
+	"jxQLEbGiSYbUKjdghvOJEtAaAQMFcBmwbwJra3rop2m/A4/Q1lNTgreOhZ814ImLhdhCx2PsvsLufipj2RzHdS0agiTBwXoNp1mZ",
+	"Bmn/h7762M/ff+Ueyg5cE2V1SjFMjUJoC+s5bAx0TPaIuvLxs1Gu5pgDgIbkX2VR1NC6QgYbsmEeu91iHe/E9ymHr4N8UqTN40kb",
+	"CLVoxMQHWc/AoIitS0uJm999xxDk6YESwrgfkdDDbjCUQA7svANqlOdpRVk3oAAAAAABAEAAAAAAAgCAAAAAAAAEAPAsCUIQSRJF",
+	"O8KQTP77Uie4iqOdn9/35ePufr5x6/Kdd8qv9A7u8/zmCPvSyXQ1FRf0eiXFXZ0gNkJC0H+DuE9EaxQ3scQMQgoD/RPAodixvlNZ",
+	"mPCby+PUZJbsWO42oLTZZKQEtrvJw1eOZ2Xrzip4sCDFhUOh2A+/VkYXMwofHpsGU74AZmBICbDQGcEGBgQfwKdDYg6meXKKHkUZ",
+	"lZ3x6c43IXp2SKt1oe/wYRJ1eO9f3BwtpkU7p8CgIkMCUf0CCUFZb8pST/m/P0Gv7R9hc5qC3fA/A5ervXAVSWGMDfNGLgxWVx1K",
+	"0Sq3wZZYKCDcC1kKYHRhUSfRcwLXbpVYGkaFpwY2LO2SgQoMQD13koPIkkAahZTCy0YLgeX3Jf6D9tTXpaEKt5fieBH4LCJJRNBa",
+	"LUAJVTQyclEAoAAAwAACACAQAIAAAgEAAAAAYDgOguCCFwNothVeJqZL/eq/X8BUNOPn+tr+mr90P5DazmXC9j489Bdle0ig5OLf",
+	"tb0RBy6JmET/wJjXKGDEQwpgyrzgzS+PQtwPQ6loR835D23TWknj9r4l5mtbysJxAjTyq5okvN1FKYuROxhe7K0ipaZ7GXuuTNzS",
+	"Vy4ND0PmWtH4e2lEbsrmlZWARBZA0AQAUQKADzBXgfUKSAnK78mV9aZwCbPTM27Ew+vZP7emn6a4KPdSxHaZuZKfz6mEAGrYK7DI",
+	"EfwnBJ+p//Gr7J/wXXqnP+HcG7vWNpSG85is1ghQvWFGNxDNCkgWYZ4VhmadiQHXgfRVgM/p0KyzTKRmpNkGj/eQx+7yu5Nc7D49",
+	"vC7gHQn+BmiTDVJhtqSUNP8LiZ9PSfJewiG4ZjEt2NLAgVjKaxCxVhqR3Dr26OAAsAAAMAQAEAEAQAMAAAQAEAgA8BoCsDgEkG4I",
+	"ML4DrCOlUe0HL55ywd9EXxNvRi8FnqA1kp7o/+A4/eIvzz+9HmRYGhn4KbiRL3Kx03b0BHJ9bihA1BEveSLKkDCQODhFtEkEZJ2G",
+	"wpe/tPKWiuX0tDyizE0pKHo9xw0/Q0CNvinVehpgq39g7q3ZbMidB3Su98b2tLg/g8+FoDYOOmxhVh0xYQDACwCcAYAeAvgqghIT",
+	"o2xzBW8D+X5+KssXvOP5oz8WJzmu+X83Bi8/nF5HJzNvR090xE/LZHWAyZojPP+TX8aP88/DuqnQv9x0kXBGa5raeyFcOlEcDN7F",
+	"wKkrR4EMX8HQlSGfZCHIIYLv59xQ+yibEU7oTpwPp7A49NomYbOf9YkDPsGhQ8RLbiA5sN4fZV3+3v5u+d+N/3POFEG078A7V0ZN",
+	"DI8LmIIZU62e3vjgsAMAIAAAIAAAMAIAYAMAYA8B4DMEIFEG4HcK4AvBAuqfALyM+wcYxcF8sr5cnp2+NbjXPMz/+iI7aH/w5+a3",
+	"5iY2up+/HLCs/Izbbm/veZCG3JQUTz5RknRXRKeTZFqUYJDeV7tw/zFr8WyJBwB2pMBpkonMfBEldZmRfTTuHhWxTapo7IgADOoh",
+	"7KyNeZgCdWbpNptH2F5FfYXQaLnV6hweErwsBVDACoEYDGBWAggJAAACkBMxu3nnZC8vX6cgfftM+j+9P10M9ZHtZt0jzWMnMsHv",
+	"9Y7o+od9hYI7Y31MFP9QMRv7Y0TIT0v7znASJ4Svk7GePnDY2J+aJVeAMQk+TnImSIZyXgykAoAW653DFDACNDpVskwquIxDae74",
+	"5u1BKZQCEnBotYRhoBhgwjdNXu9Hy9dec3O9753CeS4L8ZLDwXY29wrxRkJFsEKSsAMAIAIAEAEAEAgAEAoBUCQDkEQFMHIHsLYD",
+	"2/1mefDb4YPckeCxH/O2/Hk+MX7bOwo6L106DujXuDxUd7D+QXeB65aJWqatqk21EEId4ZQsi+YGk0Hx6SWUpOEFeQcgQM0IklfE",
+	"8NMxFq3jig9kbV4Y0YW4iTXBT6iMeHxGYgOgXBpW5EtEMKa+Q53K0rCiW4u7eaDNGMruyfFcQqh7uFQQwp+5FwWGwQDADQD0C8B/",
+	"BCAjQSQI8E0C5gls2V23uEl5Oxi/Jl8/l1QG83oo58zMs4k8zdFIuVXPAnwUs6kaoT8sL6fhc231lsTJHk7vOMQEApC96cl1o4dT",
+	"CspayHCQKsdji44wDJ+MLIpILDraBoEWUiNrGHLFNKSauGanwmFYUhqAhO0ngWWApgVn5AENrY2tnaUyjf5EFrui3k0nwpNsqEQc",
+	"yOmLiCDxo0YAaBywAwBAAQAAAQBgBQDgFwJgPwRgTwagcwsATb3Gzx8QftB9yqcNkK+cZ/Dk+kz9SvkiMu+UOMjQDvDXX16TmGoD",
+	"88mhin+lzCRVnbmHsiMc4ZSjIzZahcMaiH+NQQ0QgQwfzCkZC2/Z/0WM6BfpwGA825hbgJdOE2/w6hUvY2uaw/DqxIwvFnImmyo1",
+	"jjbFnBZIRy+7SxlIke8jA8t6q0XzcyWZCYWHTpsNlliwBQHgOwXAgQjgqQ0A6REhMcubvRfv28gHyklZ36/t9ftbezr40NW7al6o",
+	"rxNHtl9ipQCDlDgn5cf04mtw4h9tPtrs/U3TstXoH3A974Jh9WzOTR5RFSm84wyRfqm8Kns+XJSOQY/e9kuAsyw5eBdq68B29n47",
+	"Vb4vYG0uQcP59iiccx1ZVpUwzL7Oxm4GLociL1nrOCeI6EPHSx23ix1RgDULWiUDBUCwAAAAAwAQCgCQEAFQKARQSgUwbAeQrgTb",
+	"6HCs+JX5VPZqtEY6/mPf2oPr0/mx9RZPn2sTUyjq8d8P3xdEbf/6RuJau2VjMJT7jjEuIGTclp3nGw4ngDOC1+j0EXDeOoAgTpjB",
+	"NxHv+xpZ7KYZaIWGfBueEgiREQC5Mlx2G24HD8QwSsxvBsCUqosTtr0EmXTxLL8DpZFlSK+Pd9d8FdFV6sY4E2MyRHQmKgocsAQA",
+	"sBwCkEYHEIIJsMQOsSYSvNG5wn4XvRL4li1y+PthfyhPMT+vvXgi1+OXVpOTZpDGkUSlpiR99P9sA1plaqqOxuqe4M3QvLoPtNY5",
+	"jy4kHqCaLSeRCCyxBUdct4Cp60JbuUOvJdb07jQko37JoBimlDNfiuu6fKKc430fdl7QJUWykHcGpskcqe543CxIOF0M7vPpOiQR",
+	"J1JILHNO5JPJ49P3IZ02sAAAMAEAwAkAwBMCoEkFAFUGoH8LIFfBI46HxJfT36XWD5hS+Ut/kSfS1/gQ9To2H4tq6qBF4Wi4fJYj",
+	"CM/zidM1Rb5NJkeOoc7Ico4zYhBSmhsYoszSP6V4hoTArD0LcIMqFU6N3434bnNQS9fLvpnoUaIWCDDlKs1l57i+ux/GMAtchpES",
+	"Or9PIO5s4gISqLbPw+xnwiyF16nwXxWYHtRJiOETd7KnIikZQMiAsAcAoAMBICEDYFkGYH0KQMUQANnJ65BHz6fEd3xKw0X3ywP7",
+	"43qh/tg6FRm/vT0UyRI4old7afNqLP9DP9Src0o4HWV5W2rsXwvD2jD35ptiVbuYIRoeiUFZDCH14hciTM9S2dfr6Yy+M5zyTk0u",
+	"jFcn1S51WNF1+O5bc7BgUBvKWBpm3WoffQBUa+3CzT+l7fEgR1vuTvSfIb5I7PspZ0zv6UTFSx6ZpSjosAMAEAoAkBABkC4E0FQF",
+	"8H4JsNAIPE85Anxs/Sl5DmGdXt8hL/LS+MH/Hp5IBGPyWYXaFlTMGmvalNpDD5Au8yaVtWH52OQNxIMZMXTq8FfIuMUSpBpAHuCo",
+	"FixR7wYwpD6PC3dLL4/hcxpe/vPvHemKtZwfFmtY1mPi87q8nlleh+EqCMBY1rwTRR1ojbbwx4P3upmS5N/oUfWfJa4GfOspRdF5",
+	"GdIw1oypZ84AsAMAEAoAkBABkC4E0FQF8H4JsNAIPE85Anxs/Sl5DmGdXt8hL/LS+MH/Hp5IBGPyWYXaFlTMGmvalNpDD5Au8yaV",
+	"tWH52OQNxIMZMXTq8FfIuMUSpBpAHuCoFixR7wYwpD6PC3dLL4/hcxpe/vPvHemKtZwfFmtY1mPi87q8nlleh+EqCMBY1rwTRR1o",
+	"jbbwx4P3upmS5N/oUfWfJa4GfOspRdF5GdIw1oypZ84AwAcAfAdASQKgGUCsAxAAgRgQYJp0RwLnjS7X3PWceX4uLGyXr/cAD7f3",
+	"A6M/vvPCy+GT6yrIjZVuIAr/2wdQsW3zPYjdp+p4HfczDrSRKTnJiGHprvrpzRZYCnBXFiN9oTBiOo9I8eQf6jQgPQvwHHyKF+af",
+	"iF/tvGDC35ZXOZ8BAHRQG0QEjaZfHgbImWVomBNJ48BzfExUBEZROb8Z5ymkfO8GfPhW2Nr9tjpBZlcLPThwwAcAfAdASQKgGUCs",
+	"AxAAgRgQYJp0RwLnjS7X3PWceX4uLGyXr/cAD7f3A6M/vvPCy+GT6yrIjZVuIAr/2wdQsW3zPYjdp+p4HfczDrSRKTnJiGHprvrp",
+	"zRZYCnBXFiN9oTBiOo9I8eQf6jQgPQvwHHyKF+afiF/tvGDC35ZXOZ8BAHRQG0QEjaZfHgbImWVomBNJ48BzfExUBEZROb8Z5ymk",
+	"fO8GfPhW2Nr9tjpBZlcLPThwwAOAUAOgMgHIEQCyBUAggFgEgEUCs6U0jHXwzT96dt1+wgtZJ1HnqjMf2kJ9Hg/uqX5JvhXK0iw9",
+	"r0af6jN/NaHjCvBnnwxNj47zbzDSL3yogBHcHSzS9bYFk5jOiWk8UAHJCJtRrg8Bq5+RdhNFKL9+84rdb3B8q7hHJvq6aflDEXDD",
+	"O8WZYAzCB4K0N31biw+Ly9UIg6x8y4TwWmX+L49WhNlrlzjJaGjrvJx1ANABwCAAjAFgAEA7AhgPEGQCMwqYWYtj0/7wuGvMU3Oj",
+	"OXuCV42khLO6qPGP87mmkuvmzMqvmPZ4D3TKqpdTn9/yo+52hysLnTxuuoPXwBoyPppznRsI0NTiBMf3B3CZDshlAcnzcFvp3COL",
+	"5/yX2lpvvLP6AZ43lQFRdw0LNe1hsMgBkGh93K8CmgWtHuRhXHBxs3F+P6vTZ4rfCXvGeoyU/6XsS4IfDY/G5zZX2WxPkXmCYVzA",
+	"AYAIAYAZAYAOQIgFsDUBzAvANQHQCeCowRHQ8r+Y4jF882ZGUJRdp82x9aWQ3vsOIjy++WKlaK9b/jM/JRXDc9owiFMq0aS+zUUb",
+	"foz6vxvFBnLZrAM5gmT4GRG9AWeQgBPVsotGA8iHkPDcmgV3zryJ/idkOlt0gkxxefv6UhNRMovV0RBsaXbSwLmk8Kv1srgi9XOR",
+	"09z3IVi3h9XRxoqCrX9RKRTzG4Gc0AKACgDEBkAvwSIGrCbAycPQAHrn0sF8INscEe7dQNc+pUdbKjFHdm7Yvq6jwHwzGJ7XNJhF",
+	"F+6YgHl0839wicesdbVvGinCyJpKOw9B4JZL5Y2qbRLnDDMRr5EZB8QAmkQyoDBmbJyLhvr/p7rwOsf1iAbvjCZjdo8aVeplaRCK",
+	"MGwfgL/IsEkC466+Bc+mVXbO73Y7LfMZoni9h7a6Q+V9OtLBZq56HAchruud+nSzBa+jgLAAADACAIARAoAzA+BRBeBzB4BfB2Bf",
+	"w1uUJ+S3DntRcxX6gGWoYb5BVCP+rzAn3OPXX8ovnpV9NXRzsO+jBL72rjCNKdKeJ2Ctmqsmb1FhNQDH6FpiQgV7TgAjXiSo/wch",
+	"smxOa4IvLwKr3YMo+mdegqfXjM9piRTb/MWlWQkoMPWyeKAySK7caU0RJnL6mPnhxB8BhOQ4SAc6PBvZc0wr1tI+KPI2VNANAH8D",
+	"GBKwY4INCrAy8PCDBalcildsDhjhKiC68q2kQsJIwLLruO/c6wYBz9CDSmsrMPH1Suu6CzSEbX+YhsnrJO5ji0I08j2S7yo4m4Jg",
+	"46CymcMWEZVQGsHdSsQF50AwBi9BCBkesGasXawp8dgzwsyMUwY/KjP2vjxPKlNSCiYKKW86DVVIMQgH2VS7XUHMcWvEa3JsEPQA",
+	"HkKNm02Bcp1M/RhBKR8XNLhTsGKsda1ASTFZvLAAAAABACAEAJAeArA2BHBQBdBkBVByBVvFbjn0N4cNdbgA+rZqQFr8vJyP9S+n",
+	"HrcdUXzua+2T71Oqm6T6ZkJgi0GMiptGwlqfVucEDsbiwkmZTeMQIQZXMOWOumc+Cbg9CXBA2r/A8v4q87GwiEXynQU6TCU8jwWY",
+	"xvN5OBZEzxZ6YzV4kNNC6UbthUWtwNnDSzRAvAaDkJKTysqPgSqyHXxRo5JMQNAPQLQEXBSgXsGiBhwXYGhhCliO68+eKs3SqXyH",
+	"ZI3StM4q4Kr19OxkPAXGrTcvIpj1J71iMDfgqcsD1cY3gNgh1cVm492zEd8w/AvmmBxwzmhyPbppNgN3E6zY5utaFKYlCCKABKPL",
+	"iFFp5rYuWTejNOcmj+vIPFOlL6lek0Y+IeLDByHO6qhRCGoIVzDs7VYLAmdXuKtoR6uhUDQ8QwwkxvgqSPDjESYew163aI3ZTX1Z",
+	"qRjJlYSwBQBgAAAQAgBgCQGAIwKgOQRATQUgPQWgQaqmtF7UcbWxxuw+DpsmI572hWv307uuxFw16/3X/I9863TrTx8kzlwtcQQ4",
+	"KF1VHqjVVykiOOSsQhhSlkDUCPSF4MymyFsoX4IgNjzhn6T2FIwidnNchFUeHkSNiUXr2EFeBx1JJQIKR3EioUMNlsbPqme05dV5",
+	"+naWhRDY/mfIlU/XnlggCRcOgFOzAMAVAXwJABMCuEaDxiUmiHvtveS/Ez6oKE/+eWQeBGvuQPQ//6LGqw0UHwdN+HwbmNIXPsxL",
+	"9xhnEwPQq7s3H4CnC4sUiGZ929POeSG+2ehs9HUNsievqPoPxuchyIGfkOP0KNbZuQ2HnQaseIv3xorTMArwZmDR2nI5wiIJOZgQ",
+	"aMgwGBSA4HQJ7XqliZkhgMoFauSVIJDQe5rN4zgWouu0MAJHpKpMnjmLatHsXwUGUmxoQZiTgLAHAGACAAABACAEAJAWAfAmAtAs",
+	"ApAoAbBCBNl4aW3hhy96+myrzvtmJQnVYC6+VzhC6j1fG//nF8XXvG4uYvvVc2VZmtQk7P2VKoi7iFPUg985WQ0oxlXMHAwe5Do7",
+	"SGOGYIRh4ZRjHv/vIFikPLX5QclZVc4tAFi+VA5s7W8o6mOorimQKTLvSIPwRfoToMXbowIIWc6vmaUQTH33qEIDk5JzUgDAHQLs",
+	"JwHfFnDvyWAMv1Ri13/AEvBkBnhtLmxc/+Muy0P+03JJ6WTvR8/3XIY3xeoIcwSRZ88hTUNQ62i4+BeZFxV2s5V1+p+JvTTnrTHz",
+	"ZciEl/EagroskqBSnpGxoWPkDKKC0upg2RkDf6F2yf+KrrfqH7l4BV/Bzh2CC4OiO6iq1BJcJ73z8+9O2hmQbmuvNpoFpt3i8+xS",
+	"PQnRcnR2iIM0zqZ9kW2WaV6i1nEIfCuXmq4AoAoBgAgCAAAEAQAgDgQAuB4EYJgNgGAoAQDeET3vfod5L+ZL4a/o0+mqL/1PO8/4",
+	"z/NDXsW8Gv9/O3D0iae1XeJwo6ALaj4EPKYmB6LY0LD1j7YGNttMu4Q3cDKI2BBFTzFCPpEkixbxH5a03iLzcHQlRwNze2YY1Tiq",
+	"IdBhbnCaKEkDaFypfc4mRR81L6BirEvTDBlosn4FTKjT7a2wA708mQ0AwEmFgEAiihdo4If/vmORK/p4eGtphOq42X0sr+FoETf8",
+	"ATR75pjnb9Bis+hkshoPshqmfQ5KQQH+po6J8zilW5Xo7rAP9rfh2hp4o5z9xWsa6W1nMVxoBMHhFc7JWda48xzBpUSeMrZgSkRu",
+	"h0ajnVD25ylURAiNvq8cmpNDGlUGdlEWgOhZ1TswY2eh/kVZrB7RAGPHaSrYNkAZtvBYDAqMoN85Q4xwbfEHS7CPxSXE83TWarCg",
+	"AABAAAAAQAAAgCAEAUBgEwLATAsAsB4LAKgFnA9ZHsP7seLjy29xX10P77fqxP6pa9P/fZs7/oPnm8cFgoqOS4DBYLlHIMVN5Lkv",
+	"GBUoSW7F0Vgfj9jzI00opQOwfKyd0/m2SQi5Eve/M4iM4rGxgjSr0QBOAZtJmyRDtxlb/HZmQEDGAL2PI3MBvRkdSAxYb69GjlwR",
+	"yIm1sUnYMIE07D0WgMANAVwKABQEiCweSfGidwL/EknSu1u8Ilds+9w5wL/Zo82HsVNaryRqUwZ7h3qsQl09SM0Vogd1sSL4rApw",
+	"K/C/QPtKjI38tqkX3MwLvgkgo1HlxsWSCkc1FAzw1+AVPZGgim5bGJUtoVHfQ/LXgNMwBrrEUVKum3m/QBGhEmuazAUlRHQJrmE3",
+	"pbVDAylZ3MUUPHBCk6Oc3jjk+1PpNbPLtHEWnwsm0brS5j+fprlJhaEu4nVMAJAAAADAQAAAAAAAAAAAAGAsDADAIAAXEANwgsp/",
+	"m99mf9vfoh+3vlx/88Jb/il69V99/uH4CqUf3GjI8B0O7cd3DDAdzfQbAMcVIE1evMn5a6E08ixiHYieZbxdgaiSZ0/8C4hdLlTI",
+	"r2vxvVVe12kQKp1fi5cx7NH4YUCepzNPgMHCyAjXNzOhsbBx73iQgKFfs8mbLNFgxuR41Z2WyE5It5bAPgX0T8NvI0DR/GTVR3+h",
+	"t4iPmpvnRni9op++m/cA/ld+AImqfCsl9Fh6QbhfAkzFJIdQMO7ly4v9I5Uqf/NibHoecdIeLV+u91WJbR4yL4zO5YXwLcKlNAXz",
+	"Rx8wlh7DuclAJC06gnhGOdFTwu0E5LVqZ8CtxxvUadmRqULX5XI0LXQsovpcOTBajIgfHK1gyBHbpDl9JnXRN4mvh+Wi9OwIjntD",
+	"R6p37DK3kNRMKchK7i2o2NSwkAAAAAAAAAAAAAAAAQCAAAABAIDgZBwKQ6CkNnQ/hpiD/yx8EPQWFX/t8U/tdWyzy5+2e0Q5/2Jx",
+	"Z8Bw73j4yj9CxxVVGB+XUWChWYkRanZqSCh7aeRUsRvjVBCH4/2z75wx4ukg0XwXg+v5DS0VMSo9eoZWqo/KwmSArLC3dNbSEjWy",
+	"rE4GpztqAdcQBUq+LXNss0YuF7HOeXvjJJOSQNAWwLwCzAiAONag1YDMYfCIV3jfrHtpdl7Wstm+46tNSUVlaJyiIUKm86EWOATc",
+	"rYRHn2AfXCJzlwfdr/4rRMdH06shA42w9B4kY39AYoOoTm4IyWiuLHALZnsAshYpQZuzOuKpaadYVFiBviU4KfzksjB0wTTi/CcD",
+	"xxElR4FOZSQmnJaUMhqUxUxiI16pnk6MpoOE57ncG5l24e5jyOSuWpMlbsMXQOjc2TcNuprIogNs8fL65YBQgAAABAEAAAAAABAE",
+	"AAABAEAAIIBsTDkcA0YI7/40tj//6z8LeaeEf//2VnyrJN62sv0wtSLJ8XOOPWkZq0GK6jpyl+kWhwxplSaXPCsUsqkw4hTO2QMM",
+	"CTjGCXfav0rwCbWA6K2/kfi/BXFDEyg+nGXUhKLm5IGTZYU3NZdXFDUHBFoXN7wvQHh1IksdjVxaerNOAW8DjTmYqgyYINAyQhQM",
+	"XD8AxPCTo/Z7ZHgIO0PZ4M82347ZDvdkaYjfaKzDRRS1BkzNCqR4LnkBhDk7HIhhF6cwAfUVNruT6SHKxHRCgYudzytz7owQ/I90",
+	"8P/bda5YMzJLLe6iVblUUS20SpW1ioMZ4MoXsUQ5iLmTd2HJj2jhGLx/LB1yzBIqPGNsvCKd4NI0ZYGYF/5zLaachoe98DFdw8yy",
+	"q+9XyU9wzOmfA8RYc88wmmB43HXi5CDXH4utZI6H4IAAAAAAAAAAAAAAAAAAAAAAIEAAODoqH48BgDCX9zfir//KrnPP3v//gidh",
+	"Nuvvdin/YWs7VfpX85aiOxWvbTtxVaAwwnsoBN19xheEEwbEFiU/GAiiIJB1jhnnW8IwrUGS+8f1u+lpIlh8KrUcTiAGjB4CryUO",
+	"rsDhpeseLFDlUNrvakIkcY60zydm3LKBpyu1wHBAIcOK0BPA/gcUIOK6t7ioE/zO9ts6nslTJjfgv0x/95zsERV1l+5MqC2tJ8xE",
+	"Xmhjkm6MoIOcBwkzQ3s44m4NUqX8whREb0xi4h8gfqllX/LB55lymuyrUUPMFGfWlOpMMgcUSmNWqm0IS8jkALLtFDHmfO7NvA7f",
+	"vFdAw6nGJItpv1LWFtaap3rsEyBYU6OnU8sgFnQYV36jhd88E8SXOV8tuLdzBkvua21y7lyZRxnAynGJ0azWysODY0EEoIAAAAAA",
+	"AAAAAAAICAABAQAAICAAGAAJCwxIwBEYL+Iv8Yf9H/Gdpfpue73iFxm/MB1f6d4Wz2+0f8j3U8WgzIqGhdu9HQqhdFJGZAqKmhAQ",
+	"rEs4CzPkKmuD/3n3yie4DbB43p+7uVIOxOYow8ROoKshhFNBHKnDwq04+OOgtMicrnTHzIRQse3lty0RT52diUDr9k/QI4FNBngk",
+	"OPFbBt5Oz4WryergakBZnNHIBvZrcFn0tiaJ3NseGPhRnmemA3gPMQFMtit8ACE+iE6UqgbNNZBJF1pleWYn0Y+QPlx9tH5NlyBd",
+	"vYypP4BiTUzuP2ekmAXCjtpUeeMHTwCiC+LdD2UXGHe1OVH2jhvLbhsBTYvx2IpazhpwM4/id7T5dCouvT7LUDyaUfv2FX3b3DqE",
+	"d77vrvpm/Oe55Oi6B3iRUfA6Szac4OtLyci3SoHJ6HAAAAAAAAAAAAAAAAAQIBAgAACAkKBQssFxUM+1f/+bf4D//5j5tOvL8far",
+	"mZ5hQ89R/U+PuHfY1rs+uKfbGomRCmixVqHhpCgGbXhUbAjg6a59li3K7cdxnDYC+57zWkQZPJ2eBSq0KFmEmsEcjpRNVTyaXuU8",
+	"/D046kTs0fg+71SZ2gsLw9/feRIbtlSERjDQToMxEjBGvHlKKV+JW2/v2AKlTTZXmAiEp9QBbtLPlkUsyXNbEzksOhsAreFnFyES",
+	"2LyAVEjjIVR1wpdoQk3SBeCkdOT386fxP2af1fYhAKX+aAprjrEFFe6PLHKmXg7iy28nxU+N56BuiGCAittEcSchRF0b2rM+UUjn",
+	"QC8R2bJ1pZ0w1MORzXOk4WABMx4tO78joYX2+/uXMPkmTbz3fEzjg1ywPVb2MdA54P4HeXe+Z4WSW63OWb0sJLqAcAAAAAAAAAAA",
+	"AAAAAAAgEBBAEABgcaEwMUDQck4J//Zmr//zeVEkLL/uB6HfiY3n6M9R9NqTdufqXxVjrG8KFGOK3WZVRILH0WbjmlEZKYZjaLb8",
+	"h+A627UxUhGrc84ZLCY/e57KQ1jor2GpzkSFUMaEZWZBpbXp46IB8k0AVDI8TEDoiSAypOTVhhADPuvYFQHQVgOlFVAgPfYAP39u",
+	"fHmPk7wTw53+OgZID6pXpuzOdq1sGZTElLVTeY/CCUBJU2JCYN5F76SmelASRp3W6QosjcVKW/zX/xa1J/L17kDJVrY/NYTDg3BC",
+	"KrJTlxfapoGLsyhsNdqqh0SDg+BQjfXInJGaAr454flu4SdgaKeiTPWlYacmS6c0kKspomQ05/uEYQpJCvxe9npXnXozZ3nmczgn",
+	"SHrQdtk6p3DeI3jeFi2rYcQx/B6HkWmBEHgoYAAAAAAAAABAQAAAAAAAooGADCVScEEGwwya///yX//yFQ3iiphxZ77NhEzC2jVo",
+	"uUhgx8RO99WqWaUR+TFKKjAo6ewbQQgKwzjkCko0wIGn3v8V+i39IjFW6Z5Z1LMoszFs1rdNhtVo4idBopEI5AE4+SjISXi2Zhd/",
+	"TFgQaIvK5mFEbFLIhQ8/TRJJfjoTKljQRoMjEnArbl4kpd/debFh8voglYlr42R4unyQnnqAQNwHNcdYYGVtqeU5DU8GDfbI8cEW",
+	"qxIoCsUGtoXvXD9VrAKDCU//qb/bjuq/GE4xhnDhh2wlKkQ8Cc6M6eSFQLdGSv5BlA24tnUPhgA1j4jp7pzoKpqd6xxXQdlwFV2f",
+	"+Y1dfU6aObGV8WqKzpQnJ/7FlFjS0xI7wy7fdPavNE/zvjq7du6CXRc9bZp1zBqXkdhWuSWhLrOIqO0YInxGalAAAAAAAAAAAAAB",
+	"CABBGBAEDqW26Uxrsyv//////IrLRB/THBPjpfhss9pXY08He/k5pJyg8uOvcOKIjVQjScUwR4N8RELYEQjRjj9NybN5v2X9x/Q7",
+	"Lk3QOPeYeTaRl0WYFW16PqMlgZ+TnYhILAzKR4TCAYtyJKq9HFRUPr2yuV2uE5RpgxoGHx58VsMxc+Ve0D2CzRBgU66DJfFf28vT",
+	"IvlY1O9IxO80fDWcsD8CoLdeYmnD7v1BAXUJYKTJQi2RjRk5DxWozuxEaW7R4ysjmuMDi5ODv/44fGX8w3fgc3CtmMuCzIFabQKA",
+	"rtneTETigJpWphakvWbCNEMJwbp0pr9Z7CIqoQ0pUNuXfW5QKY0pVp2mKjAG0oWxRxhE6bRdaMmKmyxEsv8HYM8naEvhh55jkNyZ",
+	"WRNt+ESCxL2Vz9itTqiwm0mYBfISnJfIFPpcUAIEAIEAAIEYMAEAAAAIQUQJZDZncbJk+J////8KmrOAJUr/yw+VX3qf8DXu01g+",
+	"3eNsG+K/xb818GsbylA9UJU/SDQfROGwHaAoa5M0dodepxv91/4vruIdC6d07zTmWPWKHFlt2Hd7GssqWWjkMkj4mIgiOsi9LmRK",
+	"/X44qaAuPZW9zrUia74JCbN3NuiSgoLd4NBEAxsScDZOgtXJv96113T5k1WkRozssXyAPDYfO+jeXsMZZTFhpACzqNnC16IDzsKN",
+	"/Pe6b69yDnCt6YwUjrUSuhyXmf/+2OQX9XEOSGeHqcCTLRwypVxfhcZCcmbQCvWgopGzMGo+TiPQb4yUxRy9xF6iMmTdUqe5cB2Y",
+	"rOnc1zRSE5ZGCu35NoyaHVbVG8HsudpuQ0u5ZhBz5qannTkGBwdDFHG21XqS35ayei+Qym4K0Rx1eMKgyeGMmUimQFAAAAAAAAAA",
+	"AAACDCAACFKFKCFUdlExv///63//+5UiKxN/w6fcj84vzpf+FyOjdrYrBTCfTL1f6uXNpdTc0Z4kGUmVBUYBwAHhkCqa1QKIXw+h",
+	"/J/77tNAsW0eKdO5ZpFOoRNKczvt7r5+YiaQpFz00CIqsQZcilmCc/l3RpkLF10sDWoQmte2FAaw9/VSrFojYgDQWYPxF6geflKU",
+	"Jx/i8uH/fURpa2Ug9hg9X10vX2OgDd8OlTMZ+9KOzs6D/LJ48XQDJOJFdUieLvBIiMOZ6ULXiHkKgc+Rn/5SwP/wvA6M/qSjEkKw",
+	"CQYPwPIaTFLk5eQRCwtG6D5U1UyjSjFBGqkSOcNkefmJduuxnVuOaWVXTuRZqkSRryHG7ZNrCiHFUUj7hdcwTEholyTDZlzS1iJ/",
+	"IcCgeAJsK9rwCHX1YyEheNTSzq2ZR7g+HxLQUHJVgodgAAAAAAAAAAAAAAAAAAAggwkIEFADbwI5Mf/mv/+u//+Xp7c9EGg88EM8",
+	"fkc6dGWqxDIo/CXcjOjVLFi01GrForjHQpUAPyQcUIow6zilXPu/v9/4L4PjbDIqtyLjmiadVnoGP5HV6vF3NVTjIiJBQSB3yQGi",
+	"ioYk6jzbMLAasyREQ2sgySyI0nZ211j1oWI40GeEdRrIbb2dosI/jZaod99IRf4iL1CLmZfSyfU+Hv7yOOUb2gaFuhzMekRKS/WX",
+	"oThCDPq1sU4DwDd0m0odnHWgCbj32/+ws9f8TBuCo2sQgRsVuQhPUZcii2XImsI71GrD1Txtr/hMmWIKHk20c2aE8ZSpOu2yawdH",
+	"u5+bx3LAkyQRWio07VtJVk9qicOxYvkCOD85cbxDsPasuIg47ikMuCYiHV8Oh9sWUxIZmFUu63nYnZdeoFoJ5IlblkBwAAAgEAAA",
+	"AAAAAAAAAAAQYDAAIBAAEWEwAWJDHyb/71+d//3Wb6XCubPXzo/XBze0oGKEYNMc58caRqTaXKsrSVJDByh0QKWUWkUURLpSYrVt",
+	"/7H8/CrfG4UDvu8znsuwykIaXZOxTzuBkyxiaG24zRaooKVNWsKxJYwDYQZtObHw2MbGETP1abopiGRKeWDQVIN7FChvW2GYH5+W",
+	"52eH7+M6tX+/gM0o39P36a1nlnbV9CLsqRVW3VxlIQjRc4NtRgErlv5c5CvortDzqik19rhoc6uf+unYD+zS1pK8qkXDmpjJbmcL",
+	"kZlHzkLFYx6KeMdGMQLXU0TbABEaXKOMNLcrZWhPabHIGRSTKF487g+jIWlqRME4lfmBoEqgA7Hqd1TUPmPhd8/xD4h1AV53qJ7M",
+	"tCIOA6qmz7sVszPh6PUOAXaL6PKwvGLwbyNjcAAAAAAAAAAAAAAAAAAAAAAAABBgEBCgEBEAbfv/8Izv//+T+OTlRYOzPqF/gIOX",
+	"gXMe0+FsQ7DpnAoKZCmuI0q5shU1hcJFEqOETkMC45z5OFv4vqy0BVyYohWIJ5dQXB4ueqnoB/egDBeNgsRAKCJ9VWxmZXE0IyMw",
+	"xPL5OTlzNbSgQcnfbZIxs6gNOMDQDwB3APAJVWy4Th4GX6Vb7RxvgmSzz7CHEewNy07t7GcZ9e9dem4aU/pvyAEkhollA6DHHGsw",
+	"2SShCMP7qiaNPGnHJZ7/gL+d/2Vd3x40eUsMafRRkzRLC9Dh4B0ctgOnUGkdf8I4fJDDXDfItG9N+aA0gBNQ0K1JBlddJnp+V5ei",
+	"6EqmcOfQthyapQZ2I8ZjafCIvbLfO5p4x1o+z3V0t0xh2zPdWOBa9bHnKYejYtfiGf0OAzzdByzwEHAAACAAACAwIBAAAAAAAGAQ",
+	"AAAAYJDAcaHTClf/8M71///+p0n/+ETQvGP5qf8aqv/VeAAt85+R/VdncdopNwQR0NNCd3R3h655eNwfR3OUWyCkyNLEMdCjppEl",
+	"mTMDldC+bHugrHixAJdsbkzmNYkUxa9GuGaO1wuBiVqVJ3D4voo1ik6GJF4OqSRhZkatAkFg0DfCbA/8V2DRdZCSbfwvew0e1tRb",
+	"VoN1mLfp6kr4fEFn+JMvOdkmb8z5VxmE/wY+K6MHCK+J9oEg6sO+0L5yGvcS4pfib/h1ed76HoDXmOlARpTY5I8SZA6S1x+mcJlN",
+	"/EGUF4KA3sMyFqHiNDcuYgyo4qDxeigvXJnC2o9gtCUHJPx0we27Mrp/Qc4caumBk0V5bfaxbXOxUqK6yvqU4m0V2eng9Q3xgy/G",
+	"SmqaUsSepuKtoz9S5CCAAAAAAAAAAAAAAAAAAAAAAEAQAAAUDwMABQMRkcP6C93f/zj6R/tS5Z0Z/D7/yIxj/gunTH8Z3n6M9VWc",
+	"uI6j3aiWWa85keubeVv03LEfkIGoIAyCkmn51hgEmTBGeX9rwnAcFts21yTDBpAoIQRFxNpEvKAG7uLefrFEeyuRCmb3gPeH6uK1",
+	"CAh3YTWLXBQiXFpmgwK80CtBuAnELsECYrNjBHq0+dw+3cUBjOr7ikgzdO/xwTNZt/b4JTKrEsqYGnwiRkRtnlkReC7DfcdQMsAJ",
+	"GsLtgEpuOUvGSv70+Qnn80SEOTJV8qKMaeAlRvi6IbntOymJV9BqETwrlKk+oFAFop7mTD1oXYVbPY7UoufwJMPEqjphuOCVmDIb",
+	"guxuLwkU7SoObAoXL8hps65hqhRf5ubPlEAdP3UNvWKOlVzlPoGQNRzAWtFklkNYyIAAEAIAAABAAAAAAAAAAAAAAEAYKBIKDI4E",
+	"42C38ff3x//gX/cv+5gJ+f65uvuGo18O6cDH6g2nvVjLRYcw+JyKooFCfOQPgmdTqNWNs9PuG0AwawNh2IolJ+oWbJsuPj8Spem7",
+	"D0e9m0yoiEFSivFDCeTgGJnISXZLC3MjWQQZqbA215kDp+LJwNIXg1xF8uDkSAGpUCRUCc1A0BqBNwggMVEIgKXM1Gev4RHbGvDc",
+	"qMrA0+AcYlTNxeY9GNfbX2Mu1/PSK77AAA6Qc3dYG/I1fBjzOwSGnoWkeqH5c1pa/9F/+b5D/LLH6o2PmY0nukVaAiawNMU8fyeE",
+	"7Xe7qMumhs5HkD+IOyprZ9ZQpZ43CYCTmd1i3PeJ39RwslR3RSL6umwHJpN0aoUoci6+h8BBtc3aXJ8rDERIAojTV8iYHQPn7SVU",
+	"q3HEHnbGYXJaVZAAAAAAAAAAAEAgAAAAQAAIAwEAUDgTBQGQqBcKgS5RfLz9p/2V9Ho/dVf4vV+wa8n2ivqHnzfxbrPsRZtZgYU2",
+	"MmEUAHmdT5BibWOMjsBbqUApjRWEMMgykfKcfgnPvALoBiQ5pf0nk6ubwgdna1pzgjuGdPAylGRQ0xODxcKLlVZajaHwsZ/n9EjM",
+	"4jGDv3zKMeJgHC5EQ6AVIxsY0BcA5QSwFXBZAflk2wmLm3Ork974pVWxF0dq9ecjFgf2bbaMfwD+IqMqlL9KunXoz1E6pPwKCHop",
+	"4INrTb3YnVzO/70ixq3+cP1PtdjNsNlVfSgmr3SoMhyeKB+gbgnNXnSFQTbZMPKYEk51v3vG1ZJ8et3J7+kc581L7P9TfeSW5C6A",
+	"MYnUupOgaQYbVUZYY23/s9bhPfeOx0TRpUdVVYfw+jK22US5EJmOkdWevoyWm3w0kAACAEAAAAAAAAAAAABAIAQGAcCgNBAGwqBU",
+	"LgN4Xfp5+af/Cfx81k8D/5zf/8zJ9n//jDvMMn+jfPtr+h8OOqgIhVz+xona3m2BhGqnx/2BfmCtgcA5SnOdkjHMZR/gHtm6LlOh",
+	"XL/YcTp4izSnFz20NxJhGCKRgfQA7bT2evI85GK6IImR73scX58tydM1meXVRQFhCw2MzKAYeQekANAYQPYFzB9gqMNwDNaaEkue",
+	"OuiVnaqnzu0X8uAFvddFztpFg5ufH+atYl+xPmG8EmSVO6uQYhAxBWkoqYt8Ox1vJ+pO+KYdJ/ufnvHSZHJDBajVVvEK/Dqv8yGF",
+	"t3QIWvRuUoKqeorZQedWx7evBKNqXiCdw11gPo+zjnL+/vG6PFo4hHWXOs8GwYnupW2IbbXc7t3tvNcUewIWAgDlT4fmYFtgLhMX",
+	"FQEQXmYcDIaiOKAAAAAAAAAAAAAAAAAAQBABAEAEBQEwLAZAoAAEgAZeu7jcj9eNxmFLB31df7Itc8//zh7/SQ/7a+6Kk9UXi9ag",
+	"Viz4DenDKnDWQEGjRxhnJgmjbu4W3FjyeLGRsbBan9w8OwqwH9VpuiwkcDaTi8nBoVjlYWmwebFgnM3F5dTSABr6q9g7zuVk+zLg",
+	"GXFo9OqFctIQ9E3ucgBFSRIVzdXAAYBkCgCdCBBjxABA7spsHH/CJ+HI9HZ6HM8p+9+7uPTi/D/Zu37z0y9iutYyZpypjjsRLqtE",
+	"gkBfA4T9aOWOr8Gm5/hex6ceEPzpO14pAaHZpVCst4jJY2dEg4w7kWccwcOT7Ch4zzkM/IGrknOqkPc04lJ8lB877nBwXsOe1yaM",
+	"HQMSuKBlREbwonp4gLNsb+PnR9lgNBlkwOFj53d7mFLWWuwSGDKjlAo4ICmJgKAAAAAAAQAACAAAAAIAgAgEAWBICICgCgGAEBYE",
+	"Ub3nm0C/u7oq3AYEeqT/r037/2gz7HZbf+9P3bT/wbTb7EHhYXs566Bkol4nBsuLhhRXFFTm1tzH+IrwhkuyZJg/jfxHqnzIf8O5",
+	"tFbmj+B+Vwn1FIf2lUBDOmke3wuBmuKK4ESwyAzkVpbksBFpjyWjaopzALrW/daCeFuw6Y8bo6OJwBIBfA1AWwIAB8AGAZdjcxF4",
+	"0vy0/x5EHR4WfuGPeSfNwgROcS8Tf259BIaa08cXxGVR8Mo5g2jQ49+f/BqzXaem6ecb/japjI+RPYMUjoktmprpLayXEwdhPhUK",
+	"NI48whnDH8CDRiSED/drtdOPYcBBHeq1n9bQsJ21HR+KvMcBmDxazTM4bkEqvAvVTdl8+Apc6r1nYcBXH73neDeowQwZDYyGbrWa",
+	"yimEjeFHAKAAAAAAAAAAAAAAMAgAQEAJAUAsAwAwCAIAKESF74AsOP+GWHzqYub6rv/YBy6/8Cu8SebX/5Y/syTPnuCP64Si0F7T",
+	"fKQgkQwUDWkZ9jnb1p2eBqFcTWjJEhkqFIdVshk8pFOMRHWVWfQZKf+evfTK85kkEC5KhS49goA5w12mAwcgIcyLYQGTuQJViwgm",
+	"N3Qgtxxx3dt81rDiVmbIE3auBoVIwAyBWBMgvgbYPoI6FKC/0UGcO+Bbtn/J9QCuLD+a+0c3yOcl5PdeEbxrspozXpiad4BCYRsy",
+	"IIo1DOzn+VSa8gYXkf7D2NVToTu/gOOYd2S3gxigti9SIDmmbQ254yDe2XK3ioy7ivbvcrRZLJOkte3aKW2bomF5ejCe/qrwjtnL",
+	"qMQgYmmzixIMNahwLV45szG85zMG9j4XoUdxPG6VHLYpglOpJh4gCG1ooAAAAAAAAAAAAYBAAAEAOA4CYCgBAJBACULz4voWqz/5",
+	"LVXeaawPqy/+2TrP/8vPNxlKr9lPdiBDMaU/qUkqojrw39BGUBCYjtoJUA1TUuBKAI9qICANiXQgpQRBPxJBfDK32QD8H4GqjjlQ",
+	"zk7b0WSinhm/xbB9ByLmhxrLtjj1NJPmqoibtz6V68hoHG34jWag5i1PIb4vTtWZUelQsZ9rIMALALwKQJMGMD/CkBnxBwde8um8",
+	"vZWn09h5LHnJfotnP3pA5SAw9xts+arQh5UvsI4SLRUTEyEiV39PvnpAPFvDeJPMEEYs9lcfZFiShuGnDzHp9qkGQGNdIHNzd9wT",
+	"FlmbImOK+w6ZwaUVI6gRTPMahSfGVXI4XHi/LU0OP49ojgGBp2KXqARNrmLlS0MPUg57CTlj0e5kYiiIPZWDfbacMAgJx1HDk4Cw",
+	"AwAgAgAAAABQBgAQBgCQCgCwAQDAFwOAQwhDWuBkn38e8NjSIZNtgfn2X+fuS3spuXXZn/SlDvmPJn+43Rjf/h9+oBOzC43UJy7H",
+	"JmMC7phauuS6imAoFWKIRGFFjxUDA23aeF+ThOfHcTwLAEvGOUNRqrhrmSlizUTNLpa9Zg5FVIYQNzVEPYszJWSSXuvq01ZPGCMh",
+	"vMsQu9Pi2a5QrhXJeIsAsAAAwBUCwGUJgNUS4ZkhoRfx8Jkn+VOd3ztKt7yn/leCJf4s9gQ/73t92szKnihW5IXdWapxT1Apl4Rd",
+	"TCFxF5du6ss3cc8P9EZRoqLGfGs2QUvlCP08rgQCk3X1lQnP1KxfffdXh3Ang4ZngelWoWKboaTrMvowRlp6Hhc4zYUlYc9KTIwM",
+	"p0syEiIQbCz564tHvB7uBpmCmBnTtxwVgqEqVE1JAbADAEAAAAAFAGABAGAFAEAFAJAYAnBKBnC4LQ5BRWP21xQd4hcG2B/B8wW/",
+	"1TcUqvh4UuWfMXvpXnn/lN6pcD9xP6SFOeHh9Eni6QTXaR0hVRv+QsoykSrDbJCIwRtMXzNjqaL/iP18EE5z0zgmjvfyr0ACeTYq",
+	"joYzSm5rcbpZhYggTalImfJM0bbgAwNguwO5zrfXZIa7guy8tJcv5XjYFQ8AvUpSgsFAsAAAQAAAMAoDUFwIsNgTMZwFTxmlcv5V",
+	"cEPdqUDoof9UZQn/AvisRtvLv5i5GjrLzKo0zqURPRD1W2Q0o5YB1vvxNCpEcpb/vDmXrecMxM9sWMYJpCQTpdTAcCNMxzvCUmRx",
+	"e/+P9LgXMoEOHVAcpttE8n6Wm6DO3IHnJ6HB82zQhq5rAqdRGQZ3RpUlkyl7l+sx10tzOdpRI4Q9lyGU5rFFotXKV0kAsAMAQAAA",
+	"cAgAEAYAUAQAUBECYDkGAIcNwoLnKA8/mfnc8qJXG3d/T8wl/5cuRZgjedXoDnjVuDrZ8SG9CamHDxfDwCDfoWGy8IatpJ4mR7A1",
+	"oJghDOaSJ5YCbmsHWEwAUJphW7v+37KAkF0Qk0S5B1KXSYNWRiEKknzNfheSnN4ZF8iaDRkmQo0iEBBWCiv6fDhsNSN4uM8R5i0z",
+	"foe3ypOSbIX6C2z0wpCwAAAACABwBgBQGwOAVwkg1RIBkO/4hF+9HSN4/wxNTL/j9Quf8cmJpgKebz1Y1dGzZj8OKzNPCjDj8Ntl",
+	"Iod8gU8Nb4wsw5wXhq0OJPKs0Z9aRZ0WAconCEKYzCqAmSbaksYb0/Pex+Eo3glYAptjBDRugOGHqbfm7XHl/AQwiB5hgQtBSFKV",
+	"m3VBh+HexVkmmdHFz3PY43p+vyItUXdnV2s56+SzZKipALAAAAAHAIAAAEADACABAXAwBFBuCXDiJc6VQ4H7JrgPUmShs7f4m17v",
+	"+8njUZT3sm65a2k5+sS/bV0HOfWh4al+B8seKLZGfVy0J87YeADTpxCgpNU8JcjJlDIqPQGgEgxXLvPfa4BG6KxL7Dr3h2GIx4hC",
+	"UYtj3t6HEd9d8MTHs2HCeZYwDMLNkiOAWbHrRcg8RL7cd570k1X8n43iULJkJSpMdrowSrCwBQBgAACABwBAAwGQLgQQcApQ5iMu",
+	"0IgR+83T76mQ5tZj/dAnC/5e897PQ9gXoMvmRCZq9A6f55R4p9/ES6zpehDQ+RLlvxi7n2l4db56aqupXEzY6LAePsyA3EIESOu+",
+	"dZlvjsVl/m/Gcq3C7XqzJSHhXJgbOV9Tzl/oRrlp+jEmHY4MwcaPGNzVol0NOBpISH0MPmvTayt6vq78aYCu0chyXHOj6kg8sAAA",
+	"cAgAAAQAMAAAABsC4EEGwJkNwlbrAG7fvfyleykZ/Xu/0mK4f+UTco0fPdd4db1UxGP7P7vfzUHWWX9FqyPt3gif0tfuHlb99yJO",
+	"DhfqqCxkZea8PwWD9S8NwDQ1kHScR3R/LWEizPjOtfIn6AYglQm/bAY4vDYXtanSkGLgBISVbEAZvAGeDpotice7IUTKdsQHHeCt",
+	"o/ifA68+gIIz8RuuKgHKVACwAABwCAAABAAwAAAAGwLgQQbAmQ3CVusAbt+9/KV7KRn9e7/SYrh/5RNyjR8913h1vVTEY/s/u9/N",
+	"QdZZf0WrI+3eCJ/S1+4eVv33Ik4OF+qoLGRl5rw/BYP1Lw3ANDWQdJxHdH8tYSLM+M618ifoBiCVCb9sBji8Nhe1qdKQYuAEhJVs",
+	"QBm8AZ4Omi2Jx7shRMp2xAcd4K2j+J8Drz6AgjPxG64qAcpUAMADgCgBYBwAiAEAIARQQgN8LAHlEwC8N/BFa8zWgqwgPIGYMgC9",
+	"yUl/b7Xs/dSGc23muZrTBCEn6Yp+h4zeoThMrRLIYzVDgjBEShmzTx7yL6M5K4iLqAeOU0bFkKmZJxM+6fyzqFJ+/BP82RsrH8S+",
+	"vd6j9tqiUbsVUt/mOKtMLOJNHk8gpGYZ8gZbr4A2cpCVj5XC5iyUHsXG7bymGs/O5WGoL4BoS8pruoG+X1ZOdMADgCgBYBwAiAEA",
+	"IARQQgN8LAHlEwC8N/BFa8zWgqwgPIGYMgC9yUl/b7Xs/dSGc23muZrTBCEn6Yp+h4zeoThMrRLIYzVDgjBEShmzTx7yL6M5K4iL",
+	"qAeOU0bFkKmZJxM+6fyzqFJ+/BP82RsrH8S+vd6j9tqiUbsVUt/mOKtMLOJNHk8gpGYZ8gZbr4A2cpCVj5XC5iyUHsXG7bymGs/O",
+	"5WGoL4BoS8pruoG+X1ZOdMABgAQBQA8BIAfANAFQA4CwDeDUCShZCzGqaoA9O2Wos29uRcVEiNC9WD+LjQZR1XIY5BGkCtxK2Q1X",
+	"fsChfyjcd0/YAAVZCYVR/i8WxAWD2LfMLD27ycxfExU2wARci0V7Eqr0uYa3r7X6toSbAcM++ehW2a4QCuLdRsp7vXy8RMIgrLKB",
+	"NKlcG7A9TZrquOKZP1On0GWLD48PtuwhtT3dK+ZTiqjQUGE2BXp+RbjAAoAYAAAcAfgbgX4RALqIAFCjDAuey8Saeq5LeYZXLrdj",
+	"VFJ9sEfv/JamcdZ9yVvGDyimAaDOCKq/QQnfKF77NXYaKNMpvEeoNEUoDVyhtj42a5YxrKgTRnaJlLBKFQ6eJl1K1XNifdA//lFd",
+	"7K6In2z0jKdbuTkrRSTVvk+b5HNVSvUJ/I8Ew7DGyz6eUxJ1wJI6PRUiaJATB4O+alfFXV6qXKEKdpLHVKOXg2wmli5GVLAAADAB",
+	"AKAPAmAnAsA3AwAlAMAyBdBmjLegl2EeiGAjv7/eo1snPvOm8OP9vW6s1t+c7wS+cJXqA3G9n3t6nt5XskFG4Ziv1DqBN+boGDlS",
+	"pUf4p1GtYggnCuoACzs5wSFTuPVCG1ww7MWSLZJRaF+gdMuMHwI5eaQhabqsjE0CCOiHAXSMOkyNKy3BnddhBFj525pNEwLux2w4",
+	"pNxvfyKKIw0BBhrK+xTXr9WAwAMAVAlAdwUgOsJEFfDUBzRAAfvBxaFT4Kl07LYrRvmNoL3cjVD36t/Vy9ipje/PnvbNKUQAKQ4Q",
+	"aiHOn/mYoLwa6mIIe9uY8Kd5AbX6hx5T9ybMqmklX5XnQJFEDKsWDOHuRmA08U6DdHj/h5kjdk+nKP4O6ZUnWDDmnufEcpha1jEe",
+	"exPHoxHoBC9ZZUyVO1B81sZtSkxLhMZjm5YsI6Hs5e/RyCNcrAJZiDVgeKnoArVgsAMAQAMAEAgAkB4CUC4EEEYEsEgCEBAAuel1",
+	"fOxTn6tc3Y/sDUbK7HRy9Pv3v7mSef036ydfORpMir75N0SD+faMCIcRiRXVmHQWBMcYRxT2GztlPRA6a3yShnK91CCiUu28kLQi",
+	"GkCKRNIH57/cfbWIwlX2HFAfD+bi10ZRKpvHqLbAQQBqeXLRkciieXs7SmhgUqCwW0IZXxdbKOsc2bqKzFSzvoTACIEoDSB+BNgk",
+	"AP4F4AGBZBBQgXdyd3Xww6QdKH9ogBwwbm7a/AG+mR4kgsT71kyfsgp65r3KESq1cN/00Tpaq6uEidKOh1GtPEVVBZpt1vaOwmOj",
+	"UFedEhXgb5DYvVP3b4qTa1sRwAoJc+vlLHcvvli+76HGo9tGdPHhPyOcgzJZGQgK64fQqJPPHcLfLtOnGmWwissZDuKxdy3bgSJu",
+	"fbYPGKRFnmahj9jVMq+owEVYsSQgsAUAYAAAAAEAQAcBwCMCgDcEIE8F4FEFYD2kZwSuZviUyDWBfZih9ZlGUZ5KvPbj/TQ/Jjn1",
+	"t/RD3WEz68ePT7fTqbz3oib57y5veB5/HCteu+AKagnYTo5J627vymdq39f35IuQVKxht2UALJ1umjFKcIxG9ZoUZDh4wWGR8Qu7",
+	"GEkCUiMqX1pq4oDVfhydAeOFpFDVZxBk+VnxkdlHx+OqoaYhQMANAHQCAAACOCaCFhyhUY24Z149qWr+KbaKwGPyGU3NGleRi9rj",
+	"+SHxLSkjzNsxfXsZjYkgJIlgAxNd7FOmkm9Br2wnc7F+vDJlNyTagH4z9kNfXd5T4/CrBWBEwCIdzO7PSiaKETIJYAJiIhyCqPDl",
+	"IZ/y+rUpciioSgeB4RRDAXxgEgfQxqDi8Hd5z+LoKi4dOAyl9QI4aNcFA8u6JYN79vrcml02I6OstWbZBAd5q4+5Y0/REKAKAIAQ",
+	"AgAgBAIAMCwIQUA1B4EMKQTwzBP4KPjm+7nyf48SH/z0aZvcZtu/gt+VV+G2mf/3V+ifh998ka6OeTlPPI68DooGhSy4C4vqk7yN",
+	"n/grc3B1T9ztslZhK1UYg1t++W++Ll7SNOD/I+JsWSYw5JUwFwnKtUAL3IQ8WBAcfeXFDAFpdozPn53scBWzrkUAGkcNnS4C3X9m",
+	"zDtfa5ipWFnYwMAVAXQSwPkK0HfFQDZSJg53lirKL653PZxS/nbNOMpw94drnf4hsJJTLdrPeqsIMPFTcA+IpARSwUr0aeD0uGqi",
+	"gHwAyeiYy3LHBABL9NvoP3ld1UcFODhm4GsBcv/VbgzdlUQMowLBlnJFjsMRfEnBV79ircFQQ9oyQ+I75VEJOBHBYRh0yACCAdYu",
+	"IRetJSgoBvg8fepFAA2Nn9y5dgWI+n7mfR7Ijq0ykkyzfAThuapMCySeL7+AoAYAgAACAAAAAIBAAgOAyCYGIOgghGBqDwFevj16",
+	"fGH5Y6VQ2/hW4UvJFiO+pP1mjWrKz8t/G/SxxwALiwxpNMwARKKlGOmJL8wKTWzE4A6WugWPGEEGkmy5DVjibAPxGL+c8I8om+i3",
+	"Th1z+s8xVtSjhhBLsxM18uyZL20lTXURMHGUo4I0BEEFpqgso5cPt0bpcDd0rOGuDVTbrykpjFjdFCLAwBiCWB7hKAroZwNWHCEN",
+	"1n3h1O+l9hHeY9Pp3Jgp3544+P/L4yJMr1yeNtmLdfFbaovQpIbdAX4IKlPxoouZJoH5FU18BwmoK6BP4+fht3xcV10ErR/oIHYF",
+	"LjNxBjjjASuBxqhvhhIRVbEF+fvRRh7td8TgauFoI73k9aIQ9WIgGK0wiWIcQES55faYkabAxIL4rFtAoAE9wGNbpn0D8h7imxTL",
+	"rBR8RKb9zCMaHwuft2YYgJyFhKAGAAAAAABAAAAAEAgAwEATBECUFQNQgA1BcAXKN51PP7464dy9/Jhxydal83rZ8bNCjuP9YvNf",
+	"Ilw1D1YpkSgWvIUMukohkmbuPAI44tC24XYKYY5eRjTtD+H235lQlX+BuHpDtm8FuzdZ/jPLTiwMy9WrBSKlKpxAjmHyegsqMdM9",
+	"fcVYwOROVU4HU1qzOXLgFQcX0y+J0mMnPgyIGFOPYKDADQDEAUAoA9hIg9oqIhZ55YwX+DJ7CXFHfQEJy/Qebgb+J742nBTcHzva",
+	"1KSk/JpYuIKe6eSkPoDfdLJrmdfW7iprng423Tpju+8nvzrWgy6Mpghbv8qYhDxXqrschOxnohn8f0bWNEsoA42h5srLCso55g3S",
+	"RQI9NqsYBxDZilKSalZbQnZYQngOLQpDE5EKFZjcY0TjkWjeSoG9acddl9nwGlZtjTLoMHn3MMEl/E8xE8U2Z2h9BUSgAAAACAIA",
+	"YBAAAAAAAYAoCAFgYAyBgEIKgRguAvdJ49uzvv7dGr/13cXXJVeR3B13JlnnT8jPPW+Db0ZlXmaxrE8hUDlr8HsmMTozgiGvXWru",
+	"HOhF6bVIHAykwhGQk9z4flnenPdzmbO2G+87CVrkKtlMtGJVCUQSCIdrpMJIRwiX76vh6nmTsJ4K91uFEa099sgnh55+V6GVX7de",
+	"FQwGFxjAIgNEJ8GzEsDAx7RFHdLcgR7Yv8F6c//QwL6LQT6973Tf0GNRRNW+FxB7HKWrmyEMmNnkd0CkpCbV0PSKw3fojmPeJlOQ",
+	"fMv1o82LvBT7xMHw8lgRkSS6dUnboIGsosZ8c0iRJZmVGkpNVHylroVVjj+e6iSAZhNilNUtjg64Kvzy021LkGMukZfHaoo5YLGz",
+	"Vu+cdi1xx1dlzbdqZoPzvlLdr29FWi5CtcW3AV1Pe6fYuMVo3qdbVJAAAAAAEAAAAIAABAIAgFAYBQYB0EgTBgCwUBXhJ/eT8Rf5",
+	"Y2/vf/qF+Dn3M8mK5HevkgcUPhZ5J1yaJh9n4wcKUfUfI1SfiXDcWq8kPAEoQWsu5k3HK1ApwZmYPSeZV+P6BUrrAxl6PNP8vxmG",
+	"h2pY8+Ydk0QdnpKa6PEWs7DRh5bjTMJQVlMBOwlFJNg9HShzJdK/CxWeeN7uVZPogO1AwCCB6BGgjgKIAQAGxG9ZM95/jRfCO/Mn",
+	"eHwbB/ioGOf8BCJKLteWXkCRdTIPc/RWgGaVYXCP4h54VyqZULPh9F6reKRRnp7R7TbYuOLFVfAl6IBSV9e2nBN0ZFIpZilUU6AS",
+	"biXapjJ7BBHyBk677ZPI6JRuNlZ1mCVlirZDP43ouAo8dgKbN0vtnVJBgvq+p11F6WMP4tTKilaMibqPNILlSfmcn5jSMTWMknLP",
+	"8qliloWDx5glJviQAAIAQAAAAQBAQAAAAAAADAgBQWBsDAHA4AQHATL7+SXoL+teP+Wv9qPph9Tqy/bmekUNMCfbDtfSFfMZsflS",
+	"TIoKGvOyUsAhibzy0giNW/ksrTW7iMJQK5MzKn7pFHusyq5D7qemDPgfNdfMZZk1KkWDR56hRwRCc9l6Ovg4GuPt08rrd68aCbhc",
+	"CwXxc+a2ITBP0vMvX+zTgUnBwNAYQOYFdB9AqEN0DvaK5YQNT/7ASpNdXEHd6RtgnXKf46a21Uf+kahtiHitGSCoUpQjDFRViF9h",
+	"A8SuqI0wPYm+VohWPJqFlB3QykaCa0abyFwiWZHazmC8kQ5Is4bSENoLug1nLk1pjulujzQlZhBA1RAkoRJ8ex/IlPYcMGYcXjOA",
+	"JggJH4brFnVROgujWwS7Rz8qk15w0Ow7mUQ7/9vueLbtuwzqOEsnRMebdV3E5z7OFwzquEtmYJAAAAAAAAAAAEAACAAAAAAAAwEA",
+	"AEAZAoAAEAADQcrV+k22v4N6y7C/uN8vJ+mXxa+Tv7vktUv9P/eM38hGdgt1+j1mVzqGqX5TNDhK7I6IjFMoaju+bQQlJLp/VM8I",
+	"r2i5hkxxWaaaMOQ4e5tLRl0aVqdGD6CKRIgx2KtpGFKDPVHgcLrYkunJzO5Od7NV18BwA29yLy+/lkkRgMAAABwBIFQGqEaPBe06",
+	"Gef54X2Dv6kjyNkHn+Jkyov4x2t6VJ+FVg2S9rWXhWmkg4mSKW5RvQbQdsUtqmTCz6d8Iwe/wvs38gnqXhfskY5gmoISNyM8Ie07",
+	"1CDUSal9PqRgwE/fG99QquWaUTQ/ItUg9ex+oCVuNdcjKOrciSwcOxWZo+rg1YTyiQLUn5lHuZ5jRlNRDgAmuA1NVVMJfb+JylJl",
+	"TQg8a1Mc7VYSITqFvvSWlEEVHDZVkR4AgAAAAAAAAAAAAAAAAAAAAAAgYBAACgAEAMBgUZZK/+lNQ/+s/xP+t//xFPy2+qnze+NP",
+	"5NxceP9Tfs3bXH6Ejrc9svJXFEdZ0EzQeQYltIJsOVNXsHTbaFSn9c0CXCcVeOsXil2cFa1M0u9dPYRBEqHM0QcmocBAWZuomMqu",
+	"BpR5sLU5QKuWTnY1anj5r5UaY2O11Npfi8eiCMAoA5QsAbEPgKbvlPglvAF/83iSO/1JAeSyE9WB+7dv68PZtseNHD+wBpubYtCR",
+	"V0SX6KiZEBoC+RTurYugVLJi/t5s56VMRu5GXAjOiLPkmrgx7Pcv3tskQUiDFDJwQnEQTLL+s1yocZjGGQEAojXBc2BsaVb0C+Ss",
+	"6qMM+QbPNsKXNC0Z49Y8LWBLSEctpqmDJohzNe+0bMmAnxSewYlYlNVAPq5mFGWxFxJlmrRvPklEYzwjB6QoJMCAAAAAAAAAAAAQ",
+	"EAQAAgAAQEAQIAAAAAaJhSDgMNJc/8TBH/hn9f/5nn5dfTr7hfJz039v3owd/oz6gmnUCh2qVZrFwook0YFgut49y4Kx+zlAZEUp",
+	"dOBLcN/ae8aF8h4rtFUDCy7CGn+ZyNOZnpJtrtQgZMih13AtVlrZUCHJKsYRjtUedMiK5s1hJQwk254UiP1+HXDQGYEjB4gqMNeC",
+	"zbYpaQu6a99N1grpxUFny5oVa6k+wkDplkXiM4X0f8qyDMUCMozw0goFDWAxQC6iw1Aw3S4EP1a+63xKLc9c7S3uHw5eMUmYn4EZ",
+	"QvkWsOE8FgTjN4NTAGYjRjZe+xtrUMw7oazvWt5dedFBTgvIIrESEJEC4xnkJXRdQTtObQ7M1xSERKdtcYSpFUGS17vFWAriHGFc",
+	"ok2KK4jZa4HVMvV0qlPU80mquIEGC9nFLxdKAmBwAAAAAAAAIAAQAAAAICAwIAAAQEBwMuUTAMLqJ//9O6F//mP/+uz8mfb78+vy",
+	"2+kHlf+CbnrX6h+T7s8wmexRFIlDGFhFkMHyAzbGUMooLqgYZvTcdv87+k/dbaO4h1HfDYQC6bMSozt+3zKs46319HHEjKcXSsCr",
+	"4CFqpVwzcCIcNNinzKkCLNCGQWeIoUkIevtgwB0C1CpCGRXgmL4PiNe/8zP7fP/eleE6vbfsuO1T94Lt8oZXrUaaVBczPoomABRx",
+	"ogygi/hHx9wdWn4qBMuuff+f+zi+yvXqZg3N9kI6hl2+heqP5YNjCVleF0G9XTBysAbkzMyMSICIaEhFmg53iaugvkDRUC6xicig",
+	"9CleH8Yx6iNFT056HiEBYMwxAiJuWSV9IUSQyc2xzB2IJSGuYa9MlET4jJHvUEXRTQWjGwXDD1PJ4HN+bxHLDaAocAAAAAAAIBAA",
+	"AAAAAABgUBBgUEBgEFCBRXYAQiRv/+sfmH/v9Yo+KvUF5ZuhqBToHvhhwBJnZeqtONsQokUQkjPofhQznkvFqPwggnZrx1iPL60V",
+	"/6nXeZcekQApJm1aBHJIqHpuQQfN8JnJaSSaLGxwDNjosBJOpcsJKcVVj1bWUovs1QOFvJZtExK5IKhjTnoeqMAGgCgGQK0Gcs2+",
+	"xulLf/pn5pP/1FjvhTT8P1+P1xVe6UwRfduuyWkC4+WgPOHGkOEYo+GKEDoAy6wCotSd/tx2K+MArek/ykhEPhqYyhcM/bbwse8w",
+	"VE+kMCYmO3Ko9QQJWaemVqaOGpIEF9Fy1TKn1J7alBu2CqVWvXCcaDxjF8cbWYkTxnG6OyFihoR7bKzhqElVFF6hKdWXI1EXmeU4",
+	"OqSNATUtUqzI0QH2daZJ9BTQUBPAMOjSKE8IwGAAAAAAAAAAAAAAAAAAACCBiAAIIFBr8Y/DyX////0n//ZVBfr/3h9uHgcjoHQ/",
+	"NcZUoIr6fAfd+jpks25sC7CylEo8NQZaLpKhwzwixRuPk37/4L9fZuYRIDPLts2zYpaI4RIJ/F6nsd1bRt4iicFIDxCEg4ElHHAt",
+	"36mpN6ZGwQyvfV2LxwUFVzEGJFLCaKdAwCWC0BngqghMdF9/Vyb//3Rs/R/7/CTlUFdpZ/CWiC9Vpp3/HpjRXkTHmJ8QKExjkE58",
+	"rmSEC+g2awqlF9Yv5d8L2D4memf48yBVpZanj9HaAfgcyzEEyRRAHiqBoDGqRhJNQco5hS9MEVASWNHrXR34C8SSot36dYXjlaqX",
+	"AuS2zb2ah405LheHsoWwpJDukwydAAOi8cqhy4KudUN6RXs7Vw0CbdcfyVhZJLmSalDVeRgNjzELVUkPEgqgYAAAAAAAAAAAAAAA",
+	"AAAgYIEDDAChceWILokD03////mKiYUrwE8LOWDzKcZAXXysgK9lb4cccOec/YgVtq2Yc1CbiMJnDQlNB+Rmu0qJSS7v+D/I9tX6",
+	"5UFDOusXTJNQpyAaMuV3Wh4bUSVWJFBWPH6PJwcjLgToPv93geoPj2UTBChgwwQMjALRLDGjFxQyjsAug6AmIUQPjPMfgaPKk//b",
+	"y8bF/7YrPExhW44/gy362lu3t/pBy5D459PCJKLAwBnaouP1J3icwKVXBUj/4j+tvuuFAN7S78IYLcMVf3IPw55qPbYsaHrUVB8F",
+	"q6+CMBQOHe1/v/FyCJyCsFlxpMNdWfI3WFwFlrjeU5bN73zvk064CsIJH+Z2zPGYKEPES2iVZmgwkxjHEJKuKpnlMeySHX1VJg83",
+	"XAtCXoUl/LdQlK6oQDKZhtKuaNAOlUAAAAAAAAgBAAIhDIECCK592inHBl///////JV9mcTC3/gDgT/n4+aQrAwVnZI6Z2w8s/b3",
+	"C215CYUpuEgKSuulUIwm5Ih0W+mpI2eN+Q+b/b+iwzhWFbVv06yjjEqZHpj3XG2ek20xCyE+h0GUoM2Bpk20YY3To4imeFZmhMsG",
+	"zQTOkUEhYMpenHKlhEyhRoDQE8DKBAQPYGDVQuB+Yev95Nr+nzRaU9mfUu05aipnTGShJ5xyRfJOiqOe3G2QBaIVOFw/sQzDJADw",
+	"ZaVrZ/Z/APwfITie3J+5M9VdxAuv23fji6uHUVZZZpOh74TUhkACfHrX60sl4b4ID0M9jKJo8tecuUMzDRxgeS5LHMK7Pz6Mbyiw",
+	"QHWZTrRGTpiSUk1uLZkgYrxkfG5svifGNMulRfZ1SHI33i8aiwELmnOtIoS4GgO0K/zq+omEKzBAAAAAAAEAIAACIQQiAxcVI/Mf",
+	"78Av////4q03YHMwP9oNMv95nw5YjCp6LWCmi2n+O+jeM1q6iGgDCT9H9EhE4t5FQqAtl1USj8aL1381/gewvmqdU4dboFpmqUBW",
+	"Kn/B6bD4bJ2dXS2KYQ5iOmAOXF8hf4eHhFWsYvf5J9TjLZOmZvVuMpr8cmxIAu1QqADQB0A4AHQD8AsNdOAfUBP8B/jVHzxh6FGR",
+	"6cdwVsy+qE0xP00kNMZxmv0pmSEgQoCQcFCzgZMGnAE44Kriv/N6LCrxBtcWl/4F1OVLNj6/3Q8TmhqdrAliIk8GzfWh9EQyqQ7d",
+	"0so1HPAgZBh8YfNnlDuThrVi8WYOg+Gyev9573DdJQIHD/LpNrTIUlJqIa9HdRPI6xi3EZKrKkE9IeSRvU1RGo62216qwQJHvJ8/",
+	"lSsmASyexUu2osCqFFAAAAAAAAAAAAABCAAAABCKJGFSLyOWR1v////////qVlYkx4Ce9EOP6tvqeHNrZc2vhsfT7zhvRDOjcurm",
+	"GEFiY9EkqRAihhTAcGiXc+pRX4j+X/jOP5ZxrXNMxyPQrJMOL4WwsLO9uMjg6iWvUsfDw0NExEUl2qRUcYaV5dmpnQKOTBxOtYGi",
+	"x6cGRGi7YWtOwBkCbCRB5xQw376MBYT/93CBq/910KNw0fY2ewdTu9sJem/OhsWchdYFgk5fIqoKfokoQYoQXmBOtaK0G/PGCdNg",
+	"walrM/beBOdhuPETCPoYx3W4WeYdJRAe1BsnXMnqkXDmhtJJ12BHmUDFyjbsroDhbX0FDsNL92j9E7V5NP8cQgIEjJ5FpTMEaKhX",
+	"1if6QhQ7v2/xEH0rj0otvj7LxDdmxx3ev7l4IUUfFeGl+0YYcosvjskzxAfwYAAAAAAAACAAQAAAAAAgQMAADAQwcCaDHWgL///K",
+	"f/////OVDLk9s7w58N376M6XK/hLtWLTxN5O6u4xR2JMLGIWNJzwd0iMwASLBUQZidhNCWkV/3/zPTbHkHgWLT7VKkDyajRXAysZ",
+	"EwSAzmIhjQcNjIFHjIGKaj7g6tikMzPy5GxGn5aJ2puTouiyGCS/RNwtSMDQHYFFCCAvMPsDhcTyh8HzEevt/B9pDpas7FhEpZL7",
+	"duBknVWY2TLbkddJvXIjJISzSAF6gXuEOAeEvoqUvz4oZKiEiYZmfoBi9jmUvb3LHEVhE09UAVATsEiiDhBTs4aDnHKxM/aaySJA",
+	"K7Fyh3gLkrfmyJUAJQDr7II70DzvB6ohAkGGTTjIGVJUXglm1fwNHw7fe/IYngnCK8+9XrOacIaDHH8DvXcopIanzOO4hnASsxuN",
+	"ybQnaJhwAAAAAAAAAAAAAAAAECAAAAAAEIBQQFEhEYAAs6/5x//8w/5vWgdPs5JwPxFetDiD2n1WKF0M0S3sxIqQCkZFqzqAGksc",
+	"IQct5/AnADKMNgKpNzmv+J+lpVGPsa5JgWBPw8AP8LmrOGnSREZyjQAyXgYFQF4IdwtcSIkIs8NZjztZ6q+ebhVmFC8HHiGac8q5",
+	"jOEA0BqBFwZoIRChg6GMhZTh2mHrBfbPtvCwVNyUQ2sADj3TUFiruMawwoeGiUJ4EvYCH4/A6iFOQOMGbk6VCs7gWCutKfLIK7rv",
+	"1+twGO/l8IV46OIi7h10eSpCnxZiEdQUm7WK9C6oxJoSBXFapfHXEWytgVMKCA3HOswDTvO9mhJlH4IQG9WBiahGccnm/zlGQWe8",
+	"+K57PuIW4L13O27h1GH4/nKh0TSHOz6/e5Rggstna6wZM7QMcAAAAAAAIAAQAAAAABAgAAAAACAQgNFA0UExwU/0D//+uf8b////",
+	"WZUWG5g/+QH/Vz4d/EXax/fp/2L0rzPMTBAXyPzQykHwWy8HOP4RmcwZTSILmSaZvj+LyDekwO4d0ipHx7X8LlL6wkaklrNWljcE",
+	"DwAMogilgaYsdvOmS6bwszrMQbaMCBGIXGAhyYabp9LKaRZAwAAAIAaghgg4UBFJ8Ppn2f+2T3UH+SuyGc1P3PHGjojeL8wof1hI",
+	"EjMkZnlFjhaCLhQex0kvAFhWU55PV793cVYh7b4DZke1/+EakwqfmR6Bnd7sfSiuUyJyN9Ut+ZMK9qPsrOOULvqsWkTym483xlTa",
+	"F4JQFQUApPEaF2jrFTqIyGovxWG6WvJeNoYweJ4CNTy/nPIy7h2EGU53M3yjMApBxGG75ygMtdvxkhnBgKmw6RzaWNaAAAAAAAEA",
+	"ACAAAAACAgCAgCAgCBAGCAaCgQBguIgH39/7m8S//5hmmgVFx9UnxfZ0+NefgQ3FbZzE7gfMhVkX8D9kDDgJwNFihrOiXhNrFxkD",
+	"WEyQkho6XSMsukmXohct23Id1vN6PaaCFmd1QNKv18GBkkDCNjEEwXSVuzN6P03crhc6ku7BWOjIQUWR04stVqRMSDm7oMAug9At",
+	"oeoUaNUHQ8etpiv9Cny2f+HItwPGr9zsi66pfTHPbviOeNR3QyuHLt1y00QwRfrYIAloklHJVySZics67MA6Kb1k4+UPCyxwAigQ",
+	"/CYbJvOpoNAjhbA3WTjGV4nGclkKzVHgNIVDVUqsy5eWaNXQkGUopoTW4+qviuYzMSiIUm6v1lfDwYSsYanViqeH5XwV/vWmOBvm",
+	"9VoGaMiTH6jHuiPUJiOE3M6pgYiBDydTIBCAAAAEAQEAQAAAAAQEAAAAQEAAEAQIBQEAQ4EwGFunP/u7g3//2fkfN1FF8s3zeZp+",
+	"gWigC3RzRKpnJmL+xQcxI5hqECpGcRQLNJo8xoqjUWAUUrASRiIEg/CvCsAXp9UJNpVirvGaXO87a7/ib1gm/WSCLREFKYeIHxG5",
+	"wVVuhZ38mh5HgZQqZABjgKcVt+DFDCEvUCn6urFAwBSBIAggLAAIEsCIxC8+txRv9sn2o34BzrsyF3uqOqDZm8Xtnl/muV1Fthsp",
+	"wzuX6GKjgcSZD3LNQu9dbwd+sdcRNdUsWEvXE/1agsQUv8ST9gt0iZ5lyGkV8MZd4uVXAekrcSftg5nw4OZRsu5tzjnX1jxgIGaR",
+	"NbqlK/1vwEGNgpeNa2HaNgEszALspBRHQ6bhtbKsEqBJHbqPX5uN0uCieJXYdVZ/iKXPHIXFFFJbo0CAAAAAAAAAAAAAAAAAAACA",
+	"gABgKBAOBAACgUDQZyV/+5rJ///f/Rvbi7rytfYBon7rauBNdpeAs/N0p9bLEyHNjUq+Hgoh7iF10nEFlBaqUMSa4rUphtIMlZ/i",
+	"G3VzNMmuk2cKfl7fI7bkfP6GRXrbolAqlAjULiTMupcBkpUr2/shPY3qd4ubWaHhTIuTXmxwU362teSn8XZA5gDAGAJUHMExDHCC",
+	"RUgt/TwaBb9y3u5/0UiUrrg/jmodz0ZeS8jdvbc70fPJMa8fPb9SEzc+MSwghXU/jXIhbxthozpoxV0F3FJZ8BNca1D3oLlgcAEe",
+	"5Kp4+CajdHjRqb45jKYJzApxWuKt58vm+NdCw7yL6RkUPVB3bwKUcr9zTxBBUlCgs80rCxkFshsJhDOM3hdzfy2+vn1fl3lkVBn7",
+	"lF462lUOh4U5ZHQwCrPdsJAAAACAEAAAAAAAAAAAABAIAACAEBgHAIAAGAwBwQnF+/A8/+hOlepAk/59V+RzRD5uayideKPH+HnF",
+	"PDHi2jiPzC5XMOA2TtgDsXBiagi55SWnbh/iRSuExKCwn6Vm3Pt245yIu6Px0rFJD4HnMBWblMoNFJATAtoz4uYzG2zkXNmg9iMk",
+	"mGGzgNiIBLqhQ5g3syxEET5KksGi3B0oKqtAwAQALAJgQgPoNQKiGyH3dVU79/bw1t3sZOELMcfhSuLByw/JGUXfu0SUdclj4y9+",
+	"NGCIjscOwx8baz5mfWKYvzvVp7PkKcukHg3++IZh9d+GnYpWFY6RX4ixJAU6tgBBI36buq7c/XRePA8No3DMCsHt3sShJyTFbLGA",
+	"Ht+gnCmNy4lsI1ViJk0KHSNLa0Uu5vazcxtN5LZ/PrDRlk/ytd440ZC8LuyR5DDPCN4AkAAAAAAABAAAQCAIAQDAQAwGAEAgFAEB",
+	"gHCAFQojt/OBZP/rj0R5iC5/nB//MytAfuvuMMR6a9N4lrH6bazp0hXRmVHIuC4mYeDBR2nuHaS8bRI5BY2VYlHGoooyD0bxb3bu",
+	"3NsAvPuORoGE6C62Uskgo2RgghaR2LZCYxY3e6xMyU14J5WV9Lyjlb7cbyO1P7OvJbNn0VtjxsiXz9EipsRAwAuBKA9giARYJoFS",
+	"CwB7xQ3Jkdab5xvrwpljgb/LycwF7+k8BjUuTh6RmCgF+YJGF0mNkcbeqzcN10XHrIWlP/Yi8Zk+AsiSLuC+7tB0PJ/aJK4AftOn",
+	"KVIrhDix14mIFEcU4o/0rsreF5lIUnYtAOL58e6s5vpnnJnFKDqaSIQcemizKSpOEqFhQJCWJLDpqR4t3nOY4IfxdqBNhI69l91x",
+	"xYXQ+RtSiS8zRZCAkBADAAAABAIAAAAAAQAAIAgBAIAQDAYDQkBcOoQf3qoF/+5vnv4THl/ph//nB8hZ/+D/k5Kj/yf/BlRuC/NP",
+	"abgUY2iHjpTgKmaCCUrSnYKo+noPticEaWtiaC3C0EL7x+RfJO3XaP7TTd/5qHJ7SFrksVhCam+DZ1cKEFscJoqKQs7CtcbgfU+g",
+	"9yao8zmcBHl7dVQyvhg7Xa0sfdVAUytCqMAJAKwJwIcFsDlCXBjQ/wdnBZXsnsibZPkPmRrB/7WoFz5gu/iSDdZjjJ4pBm/Bgz1y",
+	"I4ZzNJMfJ7v/Nr0aOnjjY+PGnO1r9NT95XrU3UEzO020hD4eaNQuaxHJ0zBJ4iD1T0o5uv8vml2uKpsCwH658SuEPM4DfxA6oMpD",
+	"WllkkMcXMnBUizSxVaRRFJCWyPekvDdhQZ/h2ICBNR12T1mMMtcT1aOuuMFNJaAAAAAIAABAAAAAAAIAABAAAAAIAIBQHAbBkC0L",
+	"huvIBId/GPsP0RFC8un9rmvP8kM+1WFX/0h/Xt3NS+lub3A5XNou8WG0ClMRWFbxlyRIipMCVd7ItqhJAK8Li2hG/07694VniPqe",
+	"80tF02auhqPZZMpnJ49KoBmzY2j7LHT1AO5e3sGjuA64ldz4J5iJKVxceDTKCs2hqNIuqacqcTPnAh2AwAIACACgEAHoHIFSD4Cz",
+	"h3gMmjCPnei1NU4ICKNn5vkKMqbu0caUij56eVBbdQcY4+O4GWE9IkiasGZ95srHj5TpaNHBGbqeZk9E4v4Gyrip0yxGULFy8jDG",
+	"Ye0c8BTdiQJTGqW/t+hyQgUZFIgsz6Z8GTqCPMOJl68uy9FVwKpOjzC2sRcrk4NkaWYtqwRwuPrOm1RDS5tCTiY6EtUs46GEsvnU",
+	"1NNXCwCgAAAACAIAAAAAADAIAAAAAgAgCAeBwEYNgfiAJ96CrvP79+hniiP15Lv9Lmz3+H3ThPFL/9v/7+1Wyd6r5EayMty88YMF",
+	"IZRYQOc65pa6pOsUHtqaOoCNaoRUDhgQ7XJ+AdI6EFew8vgC+vmOYy/UtsLV2xNE3q3BCa3yEnfRORFMzOztknSdIGv4kTAYCOm8",
+	"3hU9ZaCbFPbaaCn8+7XREIaCkwawAwEAEwGAIwFABgJQVAmw0EwPjgQcf7WIrOnZIl+iF/eY/Up6QPb0wWfzfarMTyz+SdaCSaZ6",
+	"n7jY+Zne91PrH7Qjqr+ppsqLePDfUHGEM8INJqkWkvpAw5HAHywuTI7yaOwq39987B5dIQ+jESSaeZdgEoqjRndQSPIdBaRNgsRJ",
+	"C5uojTZbmhr23QYzQDeDgbbSYpNj9a/ThNAJ5ulsMNCEMTSgk0pcAKAGAIAQAQBAAAGAIAAAgBADAEBMEwNQnBjFUMr1ebHv9f/o",
+	"f7Ql5eM7/ni2z/4b9jWMaf/7x/9EcMrB9dczNGCK7cez2IjvUKJnCMi0dpeR7dHjh3UkwSkZiQCfAGGYyIw+lWTe/LQ8jv7MnY7R",
+	"4tdqRqSdXQjKr0e0eCz2rvVAW2MLERRtRyhyvp08hrGl/m8HI3W2G5krrNxGYXdpYxYSXCz5hACwAAAwFgHQKAQwRAOwOgMwKAMY",
+	"mXuCYgv8JsUPOYHb/R8+m9/JDxs+c5nj/hwwM3bpy5Z1ShhCZofOjklo57PIVgzoaQa14iviQMk9R9UdGYmbrUEglpxfoNVumQiO",
+	"Uc+QXVpnHQ/n/n5FPDszToAYxDuHRBali91xUqjQ7K20xklwA5rUwJefG0j6t3IXAaAbUipacooqp2uNJ4zBYfx6fZZCeLYXPrz0",
+	"sLADAEAAAAAAABADAGAAAGAHAKAjA4BDBcB3C+Bay9rpXqf70uO4j1eM+RVKV9U+adPE6xs//J/MCMvdPVDZ4nezXzg1iZqDS8ZN",
+	"w7Ea37jyeCfgXiiARSN5URpCAWYvhUaZ2v77tKzC52WH1hjKVinj2zT2Au1WoRzQ5XJ52qzhYh4uJIVQblAG3qyjy8mL/f3J2cxx",
+	"a/g8N3Gkp+5o5KWTAIdPCSjcsA0BIAkBYBsCgEcFAFcGQHMI4Kukt522wr+26NdrSEKfvQdlz+grJd5aG4v9vkzNuKaCWtbImnxC",
+	"frduRxe8WjzuXreOg07PyjkVXHmDovSWlmXV5HIvRXYHW4mVCnNlJyUD1yR+4L9th+sPQIuGw9YuzZ4qx2U5PKZdFnOOu5PJseEL",
+	"G9jBg11xizkdejkshMCYFNZYxZidbdjKq4o/DqdNwVUZ4Xk1bYCwAAAAAAAAAwAABAAACADQEgLQPARQZghwxgCsrzPI9mPs259D",
+	"clZ77ZkIn5eMtK4528+Q3OYSd99dauSyt9Gvt1xcmsNSfQ3ryK9haW0oQzi3u+hbEQOmRJxeE0QiBxmKi+Y+g+pt7fD3qp8Xkn69",
+	"5Q1k6AEuV+LsJn7fgrzRh6GjggTX7NGBdzei2WeiK3i7UnXYwLg4vFdRnBuhyZOKnj1XhzGWbTKwAACQCgAQDgFQIAOwQgUwcghw",
+	"qgpbXHiLcrP9eOAFreHOfxNskb+gqcvyLuYz88UapQqg2qNP8kFtkl/BLRLudtQk+SOkM3lj7Pk7ULAnqbrKGzzWA3+gMgkRHQch",
+	"mnjsWs5QOp9zBWX2O26VzSjDRUDTTrmEXmir+gr9kdqfPU8duGkJVJmJezLhuKR+NzoCGyTo+daYzaGOd6F7PZKex/Rj8pqISb7X",
+	"NkiwAwBAAAAwAwCAAACgEQFALQPASQagiwyAN8j7fq9fP1m9KaQlMs/MeUj/B3icZZXf36/KpUmf4P8MumDp8ivwM59ZZDkoqXsO",
+	"xNucFX8npsj23eFSosXIjsoUBoECchDqMy/7r03JeWhpR4ruvw79QjEYhCDD3Leialwmk6ql3Qapa6XQzJsiM25uTFhJqga5fMu6",
+	"LfINPU2ngt8h4PHnrqOG4PSjdBRI8SCwAAAABwCgAQDAEwHAOQQgTQbghwsgfcDrtNd6H8pm2JlPLMfxHH1P4xJHHAs7C/uEpGD+",
+	"S9Z67fSyd+kn5tbydmLYL/tDD20mSfMk5J0Wp785gpA/VstOIeEYV0Zo9HAn8xYguPE/vu+zOcpm1cAyClBUbMucYpfaq04/A7Q+",
+	"YfXxdM0DWgWoxdlqDScND9Dsz9hkICzS13Kb6h7/esMxkD3C5EnWSCxvytmAsAAAAAUAEAoAUA4BUBoDMEIE0GgIcLwFnFi5y3nR",
+	"/TBzHrH0FL9tICD9VFjLW87t/k1qhAbT6M9EPKiPvBD8OuYnHCCka76joN2zuMaGTmvL4d2tTqR2BlTmsdIzEIk4oi9yLf0PE7Xk",
+	"vC/BXru2pZFsGFNOJqnJqVL6nYcFYZg6Wugg8e3TBge1tjSg62pl+vxsTGc0sxN3gPNaCh529VYrDENrx6PJYAJW68CwAAAABQAQ",
+	"CgBQDgFQGgMwQgTQaAhwvAWcWLnLedH9MHMesfQUv20gIP1UWMtbzu3+TWqEBtPoz0Q8qI+8EPw65iccIKRrvqOg3bO4xoZOa8vh",
+	"3a1OpHYGVOax0jMQiTiiL3It/Q8TteS8L8Feu7alkWwYU04mqcmpUvqdhwVhmDpa6CDx7dMGB7W2NKDramX6/GxMZzSzE3eA81oK",
+	"Hnb1VisMQ2vHo8lgAlbrwMAEAAgCoDIDiC4CKhphH4uAHHnUCLm7rpP8LP6gSzIMtb7Dlt+w3uVBQnfYsL1CDhxdQaQZqAZp/zI+",
+	"gHtfeyOXJm4eTfjzjpClS2S3JxnMmtVeMmDaPrSbJIRVbS/mX5s4BjJOQd4oG4Pd3riHDWD1UmUNMhGs/MswqdgiCGisWyFG1KSU",
+	"R5fiEHHRSHJ4/zehziiOSzPyu3aVakHNbeIszgCROAl0itEQV520qD8eJ4DABAAIAqAyA4guAioaYR+LgBx51Ai5u66T/Cz+oEsy",
+	"DLW+w5bfsN7lQUJ32LC9Qg4cXUGkGagGaf8yPoB7X3sjlyZuHk34846QpUtktycZzJrVXjJg2j60mySEVW0v5l+bOAYyTkHeKBuD",
+	"3d64hw1g9VJlDTIRrPzLMKnYIghorFshRtSklEeX4hBx0UhyeP83oc4ojksz8rt2lWpBzW3iLM4AkTgJdIrREFedtKg/HieAsAMC",
+	"ACMCYCsBQAYCcIANcSxVT2BMDnxf+pW/n/lnL9dqTRk/ob9MnmxZlP2Y3XT/NMRqA2CfdOrn8MK7Shn8n93ba+TLS6LayqQdvD27",
+	"ZDWwxmoUKGY2U0gTdYC5PJnYNs2Idx77Hb9/o38uYwDHnaszTbjLnviPB56CQaaKATHKpgEojeOx1aVGZ1CF6O9pU8dF+ciFcwCg",
+	"M9lmYmyLRjLWVCsV8NIXCyFGcjDAEAEcDcDBCNBgxDArMbEKRzu0Lp0TdnnrHfYTb+4CXxyXCq+vvn+o3TzYs0nCZR0h+Ie1LGCT",
+	"1N0/9XvUdf8iMVeM8nfMcyDrNVpOe98zEwKbrLKP2NNPPxecq0I08vfUvTuCa9D4pkbQzl6m7SL9TtJYnCdmJau7ZZcaZND4FqrL",
+	"k5WFTRklfFYxbDSMShfruJ16zQYlrazfugY5Ed3y0VVqwtUObhNMu0kY6Kzk0mTFeCiwAABQHgIQJgMQIAEQBALAVQemJu+5XH6S",
+	"vI7S//MSo7dIiiR9lnh85pV+P3vaebPWgwMcgNP6mYnfMbeKBqLBpJneHrDF6KXDNajX2/rmgV1s5C6M3iVjdk3KuYTf8q8CQXMB",
+	"8KaBy/+BfxCyQ2jUyVyzPkza+N6LPQ6rVocBYAwQiLPeFu5grNioij8DfjsNmC+PV6TyWgs+X0qWotm+jg5bPbiGr8SVqLrAE4II",
+	"HeE+DGiCBPYvAXLidsYd2AOeb4dHzs3idBzPaocHX9EvDfUyXjW7i9l5RESNx2eM2SyEDn903rEwOZ64yyz8uVZYM+a4efOS6Xbv",
+	"VOnoCOGuGnyW2GXu0+afY3qHvaMVkLjNNBk+0PICeySHSGB4IlxA9Y6VRIUMi4G7ZJ1GWFiBVUDoFGsx3G4+3O+3vGVYUCVGC5tz",
+	"jIGnkPCYTONGg1NyFdm2/VSK2VvOo85JMJlYsAMAQAUBgBcBgCMBYAkAECoD0DparlgRh+FfvXtx/OQv/bNVGr1Td3O8RUb9UGjW",
+	"7dYUDancz7FTe+K3Ep61cRCG/HXOuEhX43xmd/QNmywlNJY01C5HKNg6HryI/ojdsYHyiiH59YWz07kx0blzJgicXCuG6ivgkUwI",
+	"qgYStQ5OT6DIxNspxjbM8PMpMlZIacVSba+n+lzqCclh0nNg5jLRzGZB0ADAJQMsIgFBDFBow2Qemh85CTgo+mX6g3revl1hfPeI",
+	"Vmf6iEFTnbPFC5QNbtBRYeYKUUOVLK6HsSYWj9STWGyYkMwuwglvQTKdmrrzQxVM+Y/SIwYOQkq0MAvn/dnD3gx27gE1YP4bGAyP",
+	"3596JrrUEg0cxItg9p3qmNXAPFsFj+N4AxpqhOTHrGSV1HDAW9x1u45lHAFqRt8q5h1AB8z8nbb9tUiveyvMg4FmizjdFOKNPCON",
+	"02PgsAAAMAIAABABEBABUAoAIBEEAFsFJFLasTN0692uEb7u1sDOOr3d7/TbpqUNfGVjFnuQ6Jphtl5HTa+FG5RnuE6ji937dxAP",
+	"GhrLITXeQbEsBEg6382ECB31kIgz6b4OuocEAoiMN4ddN8qTDA5RvigzL0Lt6uRsUsD2ddB5RBEGiydguozBiHzMHGZpk1fkYK6h",
+	"HORqRri0YSdOddXUoBYmQMAlgjgUoKoCuAFATMOO2Um0fMV+xb11n5XQVx39Sy38dbTC4RLdf748bkxmzuyhQm4qsFMSnQddBHTB",
+	"jrWVt1QHOiz13+DDMvoVPJhkgolVjInkbO/7b4HyU9mMhuX3U+TrhUZNGKUew6P0REnEsXk4IKI6J7I/btjqBkOopBlSqy6NyRA/",
+	"+D8PrSXnsg7ZyGOYjq0H8pYVMV9ZUO2Jc7qlwSorG7RK7RVGTwLYHfYdcUGChYuVhkCgAAAACAAAQCAEgIAWAQBAHwpBzDcsL2RA",
+	"D83/2w5hf9PnNx6Qukb9DPplyoah/4hcTIjZ4EaRYucHLgeh2/xsMo41heYY2joj5xpVBvCOmsC2iNpBbwaxGygseEMR+sL/qZhl",
+	"SjaygmORCnV4QT5Vql6jh4TzOSibUPKKiil7VEitjbCt4LPYY7dxsxULnN2rgstEMaGhWmLZs5hzaaSihKPAEYE4EuFCEPjEAXnX",
+	"CKpPGB/igVW39PcVa78B8l+VXygdrJtteFfLyKrdg9ZVFL4ChFUqaBiBLBftVUqAPrXvBCJDL3jSht6dxYXoJImL1BUQRanCyOQ7",
+	"QXwK2d7YZQ6dpwgKkAQ20iciM7Q/MoZSKEeUmbb7ByGNY6p6ODDAZgr7aFQQruXGYcjKPgLWe4VvSkYujBi0GAsGaGgii8GxOGIY",
+	"hpO2bCpeo6nCw/4jMbSio6ImB22HkwCgBgEAAAMAgAABABAAAQBIEAThaD6HwvneA/jp7+qHZH/LlzEeJTq++FPys0UWM/izxfzZ",
+	"mzW/FOM3rlecnIgb1CoFSnVUMiICGV57rnf+tMCTGGA8NSq2MydkrkCa9/5T5SFwBtn6gHVcrnlYnRY9YhVsIHncbmbG6E0Tl4EB",
+	"iDUiMf17+I2WmBV+LXUwxfLrWllcJ72NSnJ6GSwJk5BEgoDAOAVUScM9IfEpdelrfOBV/Z/6Xn/KdU0Gb66R77FPpmZ9qm18ZKF6",
+	"NXxGGz+JJJBlJUNEMgQ3j7CKtTspTQBjLLjIrFUIXtfDE0COWS7wiMvLevhaVlAnp4+OXPm4S2Yupp4ihADxTk9aKybqZu2BsWHj",
+	"MvJvBMcvDQmWFrGpgqLElcM3MOP0uzK2VVy8BrWYrsfQm/Z3fbPNu8K/WevxfGNkLel8DL9A7xbJnrtDqGjRJ3tNvE4gpKAGAIAQ",
+	"AABgEAAAAAAAgEAXA4C8MAhRGCK4TrTNlvyA8k/3UdJ3XJ3GdvPjHgigN+VefVHaNJuMVJriYvcUMZIaXuXi87NpNPeDbqqeydNa",
+	"wuGexERSy4gIS6KQYRR+p/yHlasWscjTRWJolKz6OEkOmzhOI4ko8HgaMPMsdZQxAXFzC9GLkepxh/D4JlScTbySNzvJcnLkubFZ",
+	"3BRKkQjAToYQPuJAFxyE3eAMZ/z8P4Q391N6pQbd70LlOfeqpCii/msXNYiMJTwUSRpRlA9J/mZQDcW6srHpU/+pV35ur2QAYhPI",
+	"uyEHuJfc98Cj3YfVGIgtISFST1I4IcDVCCw0qqqWwcEBzWFqQBRHf640AKnfxD4Lp8saW1UK4PNUyUBPB1pHSrXN0xR9DejZpb1N",
+	"UZAPmlrrjHmZEdWuHX2kKyPU92mrU5eFTEWVYpLkvOoguGDS+qEEAaAAAEAQAAAABAEAAAAAACAMA6CIGYWA6iGAjk4ynXU+m/vX",
+	"81ngA5ku5zaD3gnyIfP/Fv4O8vzV6xU0Hx8OoXOSXlQmCdeWb/ydgHC1Ux7h3KdHQWF69F/goEFkmeeMdX+t4SELOA1MuKAaRWSR",
+	"M0cCBZWv0uNX+SjY8mMddaSJ2XC2rBJ8XMvDY/LJYxDMu6RieRaz+bDsXmKbKIWEwB2DKDEiVABfSJYZD0fv+ylzuX+gySw+AmCp",
+	"fH7tnTD3F072US8YvvxJo4ulCVNEIMgCwa2TQnhQGlKfrPtfUI3OejMPYTfndn5pO+o6Tk0ZjcvueVerxhx83sMGFaE0OZNjoi8Y",
+	"cjIOsAMtx1SwZc2T/bOi01UFuS8TUu4KMoQKyHmelxhGU5BWkbXOMoXQpIoOnytkjXUBUDi2MxtNUHMm1Y9FFqWoQIZkchwdFgyT",
+	"MCtEyM4VF0CgAAAACAAAQAQBABAEAMAgBAFAbBACkHQQwmAppy0APV71fQPua84XHB2aXp9TYcpNz+rvyp4fuXiMKjpZobQcDNUK",
+	"KRZmChMp6rsSzIdqM9MVW9Gl4rTMMRp0Mc3XLPi/73p63tda70nJBaayyGGET57kMhIALN2KBGZW1oUC7XhdLAC2clrIcv6t2ZlC",
+	"x5chrUxnb9VhpREsMMDAaAhUYEQ1qIPDjQBf+pb9g//2G2ycOJdMt6GXEwmiqZvqZ4bE7u9Yy3wy+IEcOO1FnhqgJOzNMiIWarbj",
+	"tTjLzUUFvwy6vZG/DNy1XQDKsBBfVI+6/HEiguDomAdlSHlAExEnMaSkhhl1gQV5jxnOKRfC/J57jSaJggZimuHKCipc4p0yw5kq",
+	"6Dmfi+RXxgxwP2MDl+ytHXwp801qSY6nQDVvQ4lka+m8xZhaaak5NGNpuMHsIqB85pAQAwAAAAAAAAAABAIAAGAIAgRBoIwoCEHA",
+	"LxE9th3/RX/tbvp/02/Ur+EW7f5nyMbyfbP3B9U+e/QS/hF3W6Ob3PEE6npXF2MawpKG5oLM+cbWlKWCEQhxGB5m31oq6v6Xq+dw",
+	"qy04ysqU2gllJUuwtIKyglq0TEhxUHHqTwvncwSfp5o2oVdowyrE5mSShxtQ3Bgog0EAU8BRByxbAjPmAuD29tD/4M/jOv+4apM+",
+	"LOIb+jLHcFK9abwiY4U4LaYRbBpZxkl6l9hdjGhXSO3LOIKazg34qAPua7Yv6JbFenzoewpVkTtp/eE1qe+9lZy0E0gHhkCQjFEL",
+	"bTOQLICPegmHtlDirDjl5z5th8tNaUp4EcHhFsXYtJf4rwqwMBWkcrvyWZLylob4BfO5l5R6dVuQ+54u5ckyCe+H120da2wZ1PXw",
+	"PSsGBZrg7fBpAEIKqJAAAAAAAAQAAIAAAAEAQEAQAwCAcEAdCACwABCa3l9DD4w/+g63f+K38Svyoz7n5GlhRz9h/2PyLs/fCby6",
+	"Uek1SaIQVrSiKnokAUsSojcNUcXtj+gbeGgB6VN9Aiw0Bt/C8OKlBmIw0Tb4oBUxQSdJaCCjroDCrwCIERWqPndig+7dup1nAJ82",
+	"FEOjsvPYFZBfDjxLBY7AGoG4F6nW828/I/0Lv80j/1Ln0I2Pl7zzkyc7KjYdG8prkGypwKGgIQCR3Bl5ixDHIFCWzQVMcKXQB1g3",
+	"lxGWoKUf9JeZvWFtI0WbQh+y8w2HSpdpPjyj6jRQy7xzywVpm5WadSDoKyLyEwkOIPQU9aV79n0SBt1UE2IVlsG19XA1z7uNe1Zj",
+	"KkkznmJZcuJKOe84acdZcr4a41t1Uvy1FlMthh2Wr0XTJpt2sigk8f4Hd4XYR+BhLFqQAAIAQAAAAAAAAAAEAMAAAAYBQIAcCgdC",
+	"QAATCKHXXq+ngf/88Un/+CH90PmFOQPLmqMfeNfbvljovnQ/E3Syl1ACEQxn/Mh/hQb862ESwYJt17lCFKpDoIDaDNb7wF3ZtLIl",
+	"AyklAxMHBrQiSDO1j55mJo+VOA0RxJq/K/u7kw8PnHwcF0Pjy1UOIgnF5DHy3vozAMBsiLh1dIV6/igZ/9nXpY//yXTk5/PwYHje",
+	"W2Y2yPv7buK9VqA5GsyuiSeBwSjSwBScH1Qus0ClaTGsO6fEhwI9afz2gJ0YcCGd6iRBoUYIJP6+2GZSkD0khkpMI5Qudsxpw0OK",
+	"wCSX8g8SV4I6URGmeDxuHRtGUqDXEMdsLCTukfW9+na2MUSFNuMUDelKDKc75c74h6Fgl99v2EQ2zqQh0vMWjkG5JmP8ZXdE2wyn",
+	"uk1tGs0IG1sLkAAAAAAgBAEAgAAAAgBAMBAAAAAAIAcBghD4HQGAmNnJjM7sH/+5Ygf/tV/wCnwU/CnzZ2ghZ8M+1tmeZZtkw8Kq",
+	"zuiwBGA2LRdHlDp65Zx2ghSe/bywvAxiBvbJ8d9pzko24TYNBs2eV3udvz02JZAR6jGTzxBRMhZgEucd0fZP8CMBHhpl4l46/pqw",
+	"NoqWChYwIzNmKXQAwIaLKJK5V70yHXt//N4373/4ODFillrgTt1RQYOasv8YCDXZrDmTvkJs4eB7UQSsBQYlvDbKWEI6POod4YIG",
+	"bm/ol4y5CKZM42aSUBmLugS47RBZio1KdX4sEpgXzVuRkxIvzpF+BaUEYcYC7w0UEcAzaJTLBUsNasdSmmUKgA1T5TidnW1jSAqz",
+	"w+FsbSoNbRsl1Lp3IoFw31u50DumtN/YaTROPZEP5fsIpuGVDOB5TKXq5MCOwmiQAAAAAAAQAwAAAAACAAAQAAMBgEAUDAFAUDxO",
+	"D0CQHvhrxkx9Jf/5s/Rj//j5PQbN1ZXsCAMu/Py57R4vxjleggik3rt2YhYaGBEmpQwzOQkzbaufc9ybMwk25fae27T8h2FRnOMo",
+	"M7kX+31M6jg1LRILQYI8AuNJVEhZla1Dv+WzcKWUPDAMFqGV8c7KaXVacrTjx156IMCCiwiNutU80B8QP/8WX7KD/333UzvdpOzj",
+	"8QBYgjDm+YdXjNjlAZiyYwNVCVqnBO4nqVPlzEwywtV7SfGiZTZmfcTxWxmYoJOqMrCC3nwZ/H3M9lSQpXSq2PqO6dunkY5ZRMnw",
+	"KYK8lYP4u7qLCBdgVsgAbR1EhSz3scISxDRlpu+WXBFqY0Y1g2ShMCQUZb1mF4Ry7OiLrvl7zkXlmJUfscLvnCLwo6LjrRrFELb7",
+	"gbHAqULH56cAkAAAAAAACAAAQAAAAAAAAAABAECgFAQAABAcMgTDkH1e1oyaWb/pv/O3/XKvhA15NfihgsW5e7zl4M6IYdUsjxGq",
+	"jKrSXZwzSHADGCSPFkqGycB2ZeyM4oVwBsbV5z+k/tvPYTDcFtof1vdzt/oUomLDVDosMLvsxurw8nGorPXDj9pcm7M8MeXV2E27",
+	"wdHBDHM7VoHbnhDAfYqQjLpmPO8fJw/+43+Xo/88N4YtlFREbJUKSPExGPqW4BB9Q/vLbU4gpAFBZyJ8jiyA9L4doabqCZ0yDn0J",
+	"hj/z9+adQuPGTGIGnQBLNaFc+mnkkiW9aE4PVs3b5Rqmu4dySOxhTzAWLU4SuIBq8tlhUSIxAzmnUJPhB0Eej8HmuJrYvBbU3OrS",
+	"rhbHusZFd+4teBvs/eTPVvDqtP+luODbpSkvJcLZMynR3W7elwqNDaOJpgCQAAAAACAAAABAAAAAAAAgBAAAwEAICAJAAEgKAATw",
+	"2BTQ7eDcb+qP//Wf+NVf8W2MK4UAx2i1sp4U+WGnEFru5V0TVrPOVlWpCAGQkSBmWyLiDLsLZAbEVrkrHo6dCZd2Lo2cW6AQyEO+",
+	"b4WZw2hgAmQkUObnEvOkKLV5cRwwRXJE8Br5eLAkHIHVTQIWMtTwSNSxDqmNSpxqLrrAbYjofngAvYUeN7/9sf3Qn/sTOpVHH52L",
+	"RskTyo1aL7z1QZLlSoYyayKH/FG7ohfwUCObrWk8UJGhxnjNmPzfqJ/4A/cHNDB5+K3aUImZw2kru56sNlqKANGohap8EXXjaDFf",
+	"BwhKkYLRcWKMlFhagKCFc2nYPcc5xS6AWAanfEZRiCzKkaEfzOzq8TCRo2K3UtouRHzvrornnXJZHeBs9q0ycE9/x1Cy6pItXq6D",
+	"AnozRwJSkAAAAAAgAAAAQAAAAAAAIAQAAMCgHAgBQABIDAPCcDCA2W+S0Hv//XX/1h///Qif/8WrLyJMS54MuL/jr9axrmPzRBHd",
+	"R8rAcoM8BadCkjd5oyjC4skyeO2rTi2E7pF6uUYz7mmlQw6VcDn6zCaK2nYFAGRcE3EyPjKKUYLaQ9JVr9rle/5cKY8HNokoDaky",
+	"fZB41Re23AejIHN6+KDAL4NwNrAze28t+f/T6qgv/haLFvEY9exh73DqVB8X8EehnwKFBCPPs7mEjFOwGheBlRXlF84ghhUg88Wt",
+	"5+UfHr/Hn+ftFNSEsIfUQqCNP4XsivGa/1rT7ihGrIPg+r9BzTuAdUXW7EuLwt7JS4NoGnhlFBnCis9PschIIIQvZq7aFcTc9lzH",
+	"5Crx0JebZBc4w7AhzUeerdc5BTFnYW+nYxXBm64qjYdOimh0M1VlYlJw8oCQAAAAgAAEAAAAAAAAAIAABAAAAIAcAABBAAwKBEAA",
+	"blV99uF3/0x//wN/ml//68T9FDF3F2FoAHf8v/vSMsneJr338nBTLQLIaaBfL0cldcO0dIZLDDjnAERQqKdzrt2ZF8k5F1KbW3Qa",
+	"SilNHpqOKtmANi6quBwBNyYPEMBkLcv/K8jR9k/KYQfyd8PQpTjdsDmbAOPPBpRIRzPH55zAJwPkL4Hg8JhIKf8az1Cf/eIWHXjs",
+	"fHFH8cgK1OAleg1znekyiWYKGnImcG18MxUWCWhmJHCECeHqVZ4Waz82ePHtX/uibOiEmpSziqQXq1DRajk5sQNsXzWkdFPgK1cf",
+	"X5khBh/4/mm/JujeCa8LFe4YcawR+n/xvNQiQB1P1/IzzgWeXISs7HomhJ+O6e5jNMScILwu3pGkZEDZHV5djlWA5raQWwSIdc39",
+	"lAVwCORMiJAAAgAAAAQAAAAAAAIAgDAIAQCAQAQDAAEABAQGwoWb7ldRP/JX/7f8Yv/4if5bTfTfvnXLQpf2R+9a+xRsCgKJRKq5",
+	"w8y8RYyIyGddO+6EhyDYqw9gCPRdAYAT2TVqYsPGcc8G+M43MS9ZpNvAa1UlgyGCFoYDIOMV+NvK5kC/Sk88XKUObdv64etvN7qu",
+	"d0mI819yxeKx+njwMYDQIoF9CRgzWH9XOLaY+ua8FG3mDKO46lKgLAaDHKCVDPx9l50FOIIOg3PYwyuEgQCQagCRQP5B+IfTieeV",
+	"lU+ztnjJ/3x7P5rS+puzmqSoo5IZzr/bvUwi2frWBBl/F9p5gmxJA45+o2900TnHnEyO69pDmGSwK7fzs3hjoz4vt6vYMQr1MW6D",
+	"FsWFHnJ3oqtkk4FrXsbDMNIbpPgJ1apoqEs7jbVPC45S4KioRQkhKACQEAEAABAAAAAAAAgAAEAAAAYAwAAEAAMAsFgVB5bvwO43",
+	"f+Xf/evUr/x4/5adaJ8jfIPaIyP7x/m+h8W7xjFGpmp3cUNEmOcQ0h5SG+dswNYpc8L3TNY0EQPhLnsS1PqVfKkM3Gl1G+uMDs8B",
+	"rGWEDRGGAWJo8GP9Tsq/LL8tKm6C5yrmTbBmy3KCU+utwLRs89zEwg+D5MHIzAzAAYB4DCBuNFd9oZp/yzZKn+3AqiZA/5WLJf5Z",
+	"W+iU4/FGs6cNpgPTluIqRTKsa46JAE3gAVyAPCC1nDAMOTrs5Re6f9lTUvhe8ffC4IH3w6qYlFNt6gsnaMCgQxpCjcG0pX4yo/tG",
+	"6lJsQ9w7IFheZANVi1Cq/eYieQpcbeR5WiUirYEvUMfoCoTxtuzJ9V3VhG+14cXuN0i1dbSZDZTUv41jssQSgbGvHPFZN8CQEAMA",
+	"AAAEAgAAAAABAIAQEAEAADAEEgLA4IQwdz82M3P/iv/obx4/4Cf9BPJD4Xz5e8Wib/vX9C0hyzsbQQCCG5bciLIQsjIUw4o3em2I",
+	"clouNOa0nOajjOIqTyPjRvEOgWiY6XQ3WZ33B6eRwxamlWjEaJpY0BsTxeipaxQmAzVQ9bvcIXDmrhJRotV07ClA4Y+Nyq1Pw+Ct",
+	"cpEXwMApg3gq4cwTrakcuh6P/7932b3LlcyP45LEFebRNuWiHLX+APqdAB15PHPVSSWdCtcwCpgX5iox8vPmdd7M4cY20LT9yfBd",
+	"fEvwJ6+bYW1cbXaFgsXswEizBNOA+le4JlrmYKJEfB9wN4DtQ/BsAhJdJLms58ycNxUAKo9Cq/4PB4dIKdgizPThqAA9qnQyHqOI",
+	"PbPlbc3htIq42TnOeygbY8XNZiCIpZmNNEi5IKAIAMAAAAAAAAAAAAAAAAAEAAAEAIAQCAMAMB0ESfujhTH4p+nnBF5FPhAwecfe",
+	"C+e8Tz/73/QEBre17rENJ584uomzUIkgaou1LoPYdETQOu79ky3FcH4OSYbJUn0ywUy/AGk6PhdDK8R6SKxaHR6EZQvIlgpArgNH",
+	"Z08bYB4MEVs7nseQvvirEwpU3TnsOYQe3B5XqTtH5dnE2JVOyyDADAFEE8D/CrA5N0pHHfkP7/345RjSED+jgxB/Id4wITt6M2u1",
+	"rDJUlfLZLKRkas95FhByyKxBIQPPYuDQt5o0dp5g/8YeI76wjb71GCyD+nGARTLZdYvqBlKpSCwrHdA09HktEDeZxAjZ/EPmypPy",
+	"8ErMI0pN1NbHxarOmh8RLXRiyyEWuYkUQPmGa2P1Hntsr3+hqyGMtLXPnMJnngXOxL6GfPiuThVgxOCgAABAAAIAIAgAADAIAEAw",
+	"AwBAJAIAIAgDAGgKb93dBx/aTuh0IeM754LUPD7XDmEnHX/qj8AQ3yFjjusOlleDHlNoxJqGzKNKirx5PovExjcoZVjmcpcqMzDG",
+	"QEWJ9k8gwav3mP53yGar+D8RJvHpIZLUcoVCiTKlgDfSQ8DFyFJBFwP5Hyl+HZGuc4LRz3QXpFemhqeNK8XzSMDClF3aYADAAAA8",
+	"A8AZAEALUU3FUN5ftQ0+3GEToPLJc6h4qOM9zXE4r5QUhG4unGRlFIMAMA0VYiCwNkLkA6SzuYsWlL4DszSLL30X8BaGppwqzKZe",
+	"KmWDxMFDxlDNdsnQsRstyDUVeRISR4LFQIzO/QvMhPL0Una8atEfqKu4rGMG2h5GMpECwoPxOXrEoa0H61PrvOa5Dq9DOrJAFPrT",
+	"UJWWAbEx6KqpG03kW4gioAAAAAAAAAAAAIAgAAGAKAYBoCgDgOAAAgAEWXmEg//pdwc8Injc+5ydT4A5X9rFxs/+nviORehrC8Rn",
+	"sqTs95BYfU0h8mR1rHCW27Mp8Mt26SkOGRQhYzxQFEo0Kn+BciD9Fxu13PKc773Xe4ZJAmQajzRSiwngRhEZGehzjJzkBgC/4HuQ",
+	"YeCjjZkbTwYIk5+nLG9TxoPv7L2poFMxW44owBGBGAsgcgRYK4IPAWbb7EY+sjlXKRgHH6PJwt5CUepfWZhXqeysxTSFjRcRtAvV",
+	"BpNeEmBggSOZ+RTtPcK0PV8nM2OjPxp7LrDn1oswAcYKTwYKQi/A4KrTxHCgFA7WltQZM58gE7/NxuGeWcWiObipmQ4tRqfT0FHh",
+	"WAB2J10VKIhYEfG6qrN0W2O83H8p8VwAHa9HZophFByZ+KzGUAZGlZW1wS1fCmYwoAYAgBAAACAMAwAADAJAUBECADwKAHA0Aujz",
+	"2vYsf858K/XN5IvyuOe+4dkvFRsj+wGeDJY8hQY6KRcjXiZ7UaHOhABOCpii0834uooQuBs90EMJMx4fgbCHDRbJtP64n2F9luc2",
+	"XxH5Sic08Cj0dWK8XJMAwwYJUecjQpX5+VgjhcG3A2jEtHD4rOzoVkmRxa9NoL6X0ptsyhHSN6nclqjACQD0CoBdA/AqQbgPmTsz",
+	"V2oh7ouJkjNpZjxii4/q93cVCdtXeEhRFChm0qbiAeGlsAopAgoAtkVtStmwUqJ1n5l7VTs+tvorsmrGf1Jk4Wa+UgGCaCGAeNrG",
+	"1sxeBwHH5cEsH4ZECmt5SA6Z75Ss/lphGyvEGyMx+ChM+xQvyOHgxtIKRE9dlbxCzRA3qYrdsmlQjKbPNyKcOS/SWOLY5Km+noLc",
+	"7FyXM2ckoAAAAAAAAKAYAACgFgIAiBoDoIAMgyAvgY+VzoD/5bwQeczzdfseDR+vcBnNt3i/jlZbIx+FqYeD0bB9sd4dcznWZ44F",
+	"VfOE9B2XGhAbR0VIJ+k0Dsnl4B5CzqmgfDwt/BReh+E+x3k05JkDNalRbX6xogmsnzHBw8Cgs3RxCJUaEK/LPa8bnW/i+KbQlEYt",
+	"ex9Lkafj1Ym5mKP3b6OVpFDAAAA4BqBIApgdgUYNQEPNQYcDXX9R+9aoZL6rmtJc3jGY46M+3+Op3TtCKGU6nBrEKzaVQKQayXP2",
+	"2gtsbgAefp/CXpFHf6f95Zp0OjxRxeHUsFHBRi6rAIV7YkhKIo+BVJ9/Xr3nTRRZyqwTcvBIdn81Ap6Y05cZZbHS63XYruMpColT",
+	"Fin6K1bhNJjC+dH8B0WkCbvxuDynYNOH50Hz3kJTR7sm6bQivBy4sAAAAAEAUAgAAAoA8A4BsCICECgC0FICmRpurZ4vxPVANODJ",
+	"G6iRsvZXPwsoaYPLfAvAcn1viR5hRAV7DLg12olAPinKLFeUM2VXOVX5py/EWBUfEmIIrgPD2FzoEWtLxUwH+F8Dymo3K9MFsvwb",
+	"JYR05umKufqsBEhyMt5mQSKtHSCyMe2uMsD4fj3so4Tz6nActJS9OjNRzggvi2460siduMAIAEwCQC8CEBNAzAiQWgB+aEvJNdr0",
+	"q8BRcDYETanUHe5ZldIBDfG5g1VQHOYRqYFggZ9rA4il13A6PNyh9BtDeLaPU+uf7f9hwDmQi0qItRWmkyhQQwpgieI7Wn0F4hkv",
+	"Fd+imfgm9TeDt2NcexgTj7bWcZGLogS+hqLtaqwF2eOmEUrx1bW83MxWU2CPYm9FxGOF8zyZrjtAv3eBacVpi2X0qlZYSxPCgLAA",
+	"ADAFAKAAAKARASAjAsAvA8BHBqArpAcTrjb/UdjjcBLNM7fT4PjFwSLTXIl6U5YwTUpObBeq0Pp3aIY/dMMhCZGQO50xlmaqbY0N",
+	"mCoIbIFPSGBdAaMSLRCZQ23BQ95TyG/vecqdW06ySAmW4trWKADDB5bcWt+LHWOn7laKYaPLCxqYw1cN1PSq4KGf8Cp4DwUxJz4J",
+	"wsRCmNLUqNZjC9bHgMACACgCYBABSBAAkgXgPoKgAHKrXCGrp6IuIewN1pJoDJ0/XRyzjqrbG4zlXoF8XwpME5QGNnVPyUh7rtmY",
+	"a6hGvlTMkhT0mP7A7Ti09ylREp5LJTBCSa70jKGz9HkUgUTtkX5TwWt5V6VfmEQ5FwqwLd5hdvs4zWFK4x0KTKZdhiev41AKM4Nt",
+	"ff4eQ2GCieNX6LnME55G/rOgxEDxdbPaBcpp5MqwvpJGsAAAcAoAEAwBEBACMDADkE4F8IYDG3xy5O8z+GHYg5nWlV4flH/0cabl",
+	"lrvQ9gtV4RKZ2lFPstBzVbYaonCjWApnhGyKtx2XH+bec9axvTxCKdSGBoLUkgZG5QixWV6Xtez0XT+OoencuvhQgYhaiG2WiZ4n",
+	"S6yquR1JYaCpV6ywkkbmHNUZjLQvpdjGVgfR6cNwnTQkixdIlUIoo87KiMNvk1zWgbAAAAAQAVAUAtA8BDBeB7CiARzkOqd8LP9s",
+	"/LW8ArjOepBpf/GJ0NLFXyNfDZkMCATuXwIsAbU/RDqoBHICqDQAHIWCsaZiodGvxVylL2LTDSisAwQDFcyFkpXRZpaWoqEapb+b",
+	"+O1dkv1y6NnRtKsUzgX3/G020o9CSKHMR8+x7Jgynn40jVJsBo/ga+SspKp4VjqOcxTHk5vMd1dQ/E3bSeJBzcGCloIosAcAoAEA",
+	"wBMBQCkDYD0FQG0JgCfFg6JHpp/oE4qnYM2vPL2w9fcvxILBXqZ9yF8wQCbGwJF2l1u9HCyIG0GLkToIqWbODMp2GqDy9wjNuPSp",
+	"T0p0NxfqFKSQi/BvFuaYSgu/g/beNy3BucUBa4xyg1I+PRzd9jWY20xYqrb6LpWOZsJTFFBkps1uLn3efjsgWyvSgee56Ol50LTZ",
+	"SuK6nBnQ0RggMaCIArAHAKABAMATAUApA2A9BUBtCYAnxYOiR6af6BOKp2DNrzy9sPX3L8SCwV6mfchfMEAmxsCRdpdbvRwsiBtB",
+	"i5E6CKlmzgzKdhqg8vcIzbj0qU9KdDcX6hSkkIvwbxbmmEoLv4P23jctwbnFAWuMcoNSPj0c3fY1mNtMWKq2+i6VjmbCUxRQZKbN",
+	"bi593n47IFsr0oHnuejpedC02UriupwZ0NEYIDGgiALAAgAsAIAKAEAFQEQGcFMEBDICHRcAf2+CRNZUXwoOv9/r7PHlT6wjf7pP",
+	"W/5hxfxthW2KmdtU1OpnPBsLbcx3qG8iiCaTdPt+8IKLeXV/UA3AGoSpRMSQGhKMD0SMbDUGFIJf2s1y8cx6r1GM30mII4C+3NnK",
+	"MOSJKMFhSA4xN7Na7yXjZWpsMUAT9AhtIalSYxv2//g8PCzrAigNr3nI5Ds2skuScNh3UOVWeMACACwAgAoAQAVARAZwUwQEMgId",
+	"FwB/b4JE1lRfCg6/3+vs8eVPrCN/uk9b/mHF/G2FbYqZ21TU6mc8GwttzHeobyKIJpN0+37wgot5dX9QDcAahKlExJAaEowPRIxs",
+	"NQYUgl/azXLxzHqvUYzfSYgjgL7c2cow5IkowWFIDjE3s1rvJeNlamwxQBP0CG0hqVJjG/b/+Dw8LOsCKA2vecjkOzayS5Jw2HdQ",
+	"5VZ4wAAACACgAgAQBIA6AwA1gkAa4UgMyIYDdzvjVazj5bflIfo5PZFWskBt68Xq/ZuR5JekrIXV4daunJFlfAi9XneEOiYprilQ",
+	"esrpJh1540PR8aXUWTEKSVUiIghhAqgBlia1LPIyGqNH+v8a2KNK8gwhATvj2cPolaA9kkAiqG06WYNBTqSDZVKIg51PBCLX5rcK",
+	"r1/0/RZ4x0GlEhYEZCdICxcNiUDSr9ePc0DABIAYACAoAjgagY4QwKyHIEViphY8/ZYYZYvuDfel/u+P4ACCYlrPyfPqUcOFfYap",
+	"md7X4n7KmI/DVOmSK2bwHR4UXFxQqGG+/BiFfQLCjaJhjPrUlBskZJzNEFJxIIbA2EkzSb/VgnPjr/vOnxkJeRvOHanQGhDKG0m+",
+	"zjJsrwi5Si8g4NU2O0ZMk+SME0qR2k6Qtt/2fKx2WuBIt5HXzQeDZsSR8i6HpVIplBMGQwCwAABAAQBQAQDgBQAACALwSAeQ3BJx",
+	"gAF93JXjjZ/r7+LH/6Rn7AXlWRFP+Ev8E3T4FO34YVuDTODX7wM5UZ8vxY+Czycnm0V0KqP5y+AP2n3oGLuHV7C6hCpGIeDrHGr2",
+	"9yfbw4/udUP+7/qsJ3aWSiVD/xj+DbBlbiMlIcon7XU1NkECoFko7nWpTxXL/BHoTfZ+rqpOQ0wsTCzi8TmKSejnyOUATHy56YDA",
+	"AoAkCABZA6AuQYQMsHYDPBOAd2O2teqp+2B/PK+ew/8O9FsX13wF/771vNzD2K/w6Ka0l3kDAgRB2sWWhb0gMcsqWtJ6ImWvPCmm",
+	"oW2mSKZNXsq0OznmjGQaQXlCIZjsahkF6k3ZlXTnHk3u3ZIR/bHzQjO4vsBPRzHtLhx62rXcBj1iJgfQDAquvqrIEUB9R7VZNjL/",
+	"+H/RhOc6QxC3FBIUR4Mhj51CFdJVaB0aHQ0MYKiwBQBgAAAgAwAQDABwAABgJwOgWQpA3xIADsxpmrOn+1z3Wf8AT74Ht3SvP5Zf",
+	"lOx8AzMX+PPP+HNmPyqKub16vMzwYwi3siYDoexx0z8L+9+cxm7OxAmUnxoMULi8A9BDU4AM93+soob/J/5yha8gElcUMi8U8EBM",
+	"XvallznYVJZU2grVQsgAZxgy+hOV165g2n4fTdZmvKRsrtIUtg+vs6JnSykd3XZAwAqBCAkgVAQIGYCiBEAVAswlBgLg0F9PgH/6",
+	"jvVXf/iwMbhXkeXx/qD0HvO8Pk9uyj/Q149JiQXjL0VDt9pWFY/ChiCndsRyktNf7l7YRHOe+Nh7z7pKF3HeELM6OWGLUAA7RHRK",
+	"G8ZMKcfov5Rwx/xt2M7fc38sXViXHdPjR13bgt9qFTTgVpnjVDX5gicF0lUaxxa0BA/t/5Gv0XcTRqWdYDhmQMvc3qc+pZz1cScl",
+	"JyOQGTSwAwAABAAAAgAwAADADQDACwBwEAIQWghwphJsTw87Ef+jTsF/r4fIo+DMWJ+JrzbVvBC7WM/G/9/9bvJRnb5Xc5RdYNWN",
+	"molK+O5G5T+WuXOPEwcozkWRGn0DoYKPEPGrWpoX/42bhHtf7b6OVYUWFxlUuHX7RnCS6u4cGh91iR5GSQJfxZedB5p7vHz+/ewy",
+	"iN4unGHXJiWTUlEHVDCRmblS1AuLWNeAwAcAFADgCgL4LAImHgFfjyhfeuqhJuHJ/vxdBj//DLfL5UU2N5/0W+ZL3kRYzczvx4UO",
+	"58sbDlZwgStXWp2RYPBLySvil/3S1IhbwBmNkdM7LIXiPKbSBhtwntSo1KjFgS/Su6cTcr2fbobnLm4HdSNyt6CeiVEKuwnQ0ASF",
+	"izKdCxHIZLBwLtWQMZJ/GmV4RTHOMYScaX/Q/3ejebTTA2WE2HLYQUzsb83P04WeyAlyQhmzocAWALAAABABAEAAAAAAAAAAAAAA",
+	"AAAHAQAlBOB1CSCYrAMRTv/UV5gftrfIG9oKAx61fPDCiAAn8b/W/8Z5AcenJw4pxgp4WcXqiJEhToCRoX3Lq20lv8dxCQYhIOKM",
+	"ozlGfgNl8/tf4Dfr//Q/oe9q8iaC9k55iwdFMEAcDVHITKVAXhoygIxWMsC/I1qkCa22EVw+/joSbL3M41ZxmBEYP1c8Sc9CotAK",
+	"gE0BoA1QTAGlCbgzEQoFAYDBEyn+ns4PH5fwnrx+BiGJJ/K6by/DQmBakKreaCOawSq4BjEwgwA4ErkKs0vCwaijPzeXsTQrFCVG",
+	"zmXPOIJhE2CiZZbwmtFp/JnCp1QL71guJigWbv3U7H8LdUDXDHjT9geAKl0zf6wQm4+JYPc6ithALGmTJJk+VlWwGg9noFQBZvjf",
+	"9/6tJwmWh0e+8J56uDorXQwMifeFhYJEGQFoJwaYFrAEADAAABACACAAABAAACABACAAABAEARAmA5BOEQoAKXSG/LH3qfHm98D0",
+	"HFPvBx3tQZZXf5Q+Wvyxh9bJXcuIVX86EYYYhWCY5rBm4X+AcZRBu7KVJxxrtQoY1oZYK8xn/yr939vwzbf7X9Fq8jjEsboBpFCI",
+	"6ZeB6erAAysAfERM+WCwIAV1veQjwnm8OSCnzYYl097ytQoM155Be/qiQDmg0AXAZANEDmA9QRoDtAsgJslAp6ALzpQfxhXboP2Q",
+	"SB7M1XJJ+VwkLkUKY25ZWkAisMsqLthzobWD3FJar+K2p6QjIxyf38wSzdo3UbtvsWkiCbYld1CMUuTcvQ+DB14A+1z1KtGArlJX",
+	"HZZEPUv8RevMjaipwV73kOFpdyHSef0rpyrDPUoXXkXYMwcCJRS53JhYSbfzP7mJqOCgZ3KeA9FoEyI/x+BMnqwXQr2zBKBmKxwI",
+	"OBSgAAAAAAEAAAgAAAAAAEAQAQCABAAAEBYHgQgcLhqkh0ws/45/nF/p2/5zv88THP4Y/gdlYYy+jfdH1PYpsBdz2FuInhZxswwo",
+	"NA5dHN8AdzWTQGvuQIETIlwrA4OUE7nP/+9Qj/iLzZvV/4P63rprzK5Kq1rkmYHySNzmEMs7QBBfLFRWSHhVJszOGfQu4bcgDTgp",
+	"kh3tJiIOCqhELn5qo87QBIAlAIQGgDFBjAnEOIDWZjc5jT435bK4S/1uTPckTyg890DXwYI0EMV3dWZMSWaxm8CtEEINcQEjaSuF",
+	"qf+tdkFaPATSaPujcf+zcpWFgadFGQZ9iJTFGGmhCvXoNjDbgLSWERDYo2OADg3drfT2XoXFGmADuuNyYPbL1fY8EaOaD7X4dj7A",
+	"mCD5NMij8lKopzW36nEtMQAwtRwnGddZAGe5tTFMmLwpNoXiystiLgodGIygAACACAAAAAQBACACAAAYBABgEAQA0AwDwSAvBYOL",
+	"D1LVAn/A7+mH6kv+FT/KFV59i8/8978vn1D43+T5FrtBVtn2yi61boYHT0CwL3z5U1beG+8TR/PNZLaNkYJORmf3r8WhP3drWO8/",
+	"pfweV3rXjCN3rjzgVQKMMyTMZHPwCEAQEeUymLGz8HE0Fc9mjDSICDHPNIIhWoCNM2g4TTx6KADQEIDXBLAXsHwCNQogNHQHqgkB",
+	"W9YX+F+/GwvwvQUCBpuRN4bORmO1kMdrK5hOXqPLgDij/D9RQQn/HQlRzbi1gVA5f8VbS64wXV+5IcbSTn5YapNCkx5MWtvP/CIx",
+	"6Mm6G3to7lEhBkHmeCOGuuOzhhjVEZGhXGo/P0k0/YrvkLEhank+wtUFgQ8m7dVoSUSIX9lt8HEZ6auUtZgvAdgbicnh3VcsgVYa",
+	"ICyq0NWZCWAFyMuAoAAAAAAAAAAEAQAAAAAAAAMAgAwIADAWAIAoFAPggKFdpFw3H+LP7R/rk/2Af2QK4n/1L/rHf+NO9Oz/T2Vb",
+	"jhdnlFiknGTUaKRsCEEUjcIcO6pkkktTx1wWhsW5rMc+Yebdq7TwEsp/ovjOLxOWVYeTsqrSY4MzMBRWg0VtYFw5WMQmCUAUGEmP",
+	"4T8uuLu9kGHrIQ1EFRr9KMBL/vnA0AEAUQJoD/B0Ar0PmE+Y8lItI/H9m9kDP+SSZ+MQ/yOHhtKh6n0HAF+nkHYL+7tHmQDsipBg",
+	"Se8kJJe1ZSYB4CONngzgxXnlXEdlhJ7EZBBjCiEANSBb1iNW244CAzYu8ReXFmFVwtCjj4Xk/4x+EbQJ9/LixnFx3XbDC9lf+Hdc",
+	"ue7t3POObIXdj1MZRLAVZX3dqPdeCG50Mk2XrLrR3eHBYiQaxZJwWJjwISQrmgwzI0agAAAAAAAAAAAAABAEAIAIAABgEACBIBoA",
+	"wAABAgBsFhBqwopC+/r//Br8X3+er+YqYLf83fy3xjg3lHy7850VaoMqjNIuFiMkoHHAdwNT9wzDxG3famMJJQeeITC7fIvYt+kt",
+	"NFcD0tFhvidzq2cNwhUoE5SxDKzKG3U1BGkuo1aXlxOZUIn5Mua3T11u5wEgY8NJmGdhUqObJecKfpjQGEDAA9wSAD/AwgKsXUqy",
+	"ihdycX78r5QB/J4DFkmjyx+4wgFsCUUY8snRwSzRr6BpkswISEvGYpUkKTK4ncTUtvRHldbnl1Yq1PLSuRVGMibYZFCmXpRttL+h",
+	"cJjWjPrpzbXdMzAjwlzrNCjC0BVcecuq1ty1KUu43MQVjUNYMQlYs9sWJgJcRniNphx8QYq7TjttJ4bmMjajnHFck3zdvDyUcqTr",
+	"wDxMaULiZxskEr61KJAAAAAAAAAAAAAAAAAAgBAAAQCAEGAbAoDQQAkFAPgByGwMwp//6G/2v//kR//5XT/9nMnf85fOudeJfH+9",
+	"t5T3HMA2MHMesGs2leUASoChgk0o5OitEe7L/UuUkjX07gHOmLcxQDtZyFY/42AaNJAhafHqPIrCSAD7DRl9DKZCHBep8CwYzl6O",
+	"qrJbEwug1AHfDlxVKBhcnPZSlTBA0B3BCAYMIgCqQ0gSHTNK94Fr/A5/DU/56Z60lJUTrXOm4iqOZRkaqC4U+AhHaRqAI2MlQ22X",
+	"zLOTIsCt1X31scQPO/GfDv2bgSXDlHCng8x+B7jo0+QHT2nVjaSqyduuB3CKkigAgR/B0HaP1FXORuSvItpr/Q1DYHuFkFdZuizF",
+	"rQZTc1SV8Wq3xmaTJLCmfeFTu333ZHNKWTuuWotXRp1pBU+CwYaGdRkgaSoCxFK5fjCQAAAAAAAIAQCAEAAAAAAgBAAAwIAADAXB",
+	"QGwqBkIhRpFw0td5G//+Z+3///Ryf/9Iv7BdSf4A935Yv7MfEHAeWcxy7QkC3+xkvomQJoBjkDEzVvDScuGI3ASdJhPzpM0juWq7",
+	"XyiOcTMWas6aWwyMJRghGRgxjJ4IMcfDTgBIpgv5XuZw0erV5euNQBJsZUopBeOimMMYnn2wr2BkANAVwMIE1B8gscPUFnXeqsvP",
+	"IP4fnNqf9UUxJaZdop+JYtcqAtAXszvoMprcVtAS5twsvFcKhQsrKORNbUFnBt135x0040epdD1h99oKMqlLQZ8JmSoY0r6HITpA",
+	"VZxE4UYkY0GGATY4dIoQ3IwkkFLOZXy6n+VK40zMr4KpVmyJpth0ZJKVKiJ+CaTARSnQwTvXaWX/5H2qPm1E73pA/dTddnznkQWM",
+	"jM4m8PBqLaufFPiAkAAAAAAAAAAAABAIAQCAAAAAAMAgCAYAQHAIAgoCcHRy2a0wOb/5G//zJ/4OV/i49qi8tWOq0nJ9pS5y4QXH",
+	"ynrBDEXMnDApJjMB/n2hELWQkBCR1JlHduzEWSVnozxo2XKV5rVAyuV2RQ0Haz3AJMIjqQEHYKvEC+ugBkfiLsv7X6WkjZRr4cll",
+	"BBApi1OKBLfrhsDtw469DKyA0A9AgANUF+CVQ2wUdhBFVUoFP5hyPzf6IwzySAE3VuT7O2tiLFWstwQlLSE3hidImRdCklb0YrkU",
+	"Y+VrcRn48lspoDuYvhfnW3t6Y4IM5QhE4a8piBqqxiaMFHOYWY+9c3ssQCwlPwNAEgkEZADsG0eL8rgXk6uNSyXMBLF86Jyl1qSC",
+	"JKk3OHGbLJAooAKVnIsTL/peAJ44KHGtZvTY144CkFOha1tDKyBApBmDx75lgIAAAAAAAQBAAAAAAAAAAQBAAAAAABwPAwHIxJBB",
+	"d7y/DHX3/7v/////3X1hX+fz5QpzJsam0nieiduvoParBzOWIQJhp09VsCWLdhsUkQMOwe4XQJjNudgvU4sh0m8ZRUtMuSbVWkjq",
+	"ypO+p0WyUoVLWRhN1p0LHM5FgYHExZfW/c3nU4c86Vm58zKAfhYgAxDdF9YBcFteFlTg0AxAagLMFGCCQwwSxgU1aUqWv5He0df4",
+	"RER3Q2UQZrzrceyyHsmz+sL68ACekCKZUY1E0rH4xeIIR7vXEJjy8dbyxtc8ec2y7nn26u2zMGfSlvkbUc0LE2woXugjmNtHErJQ",
+	"YkBEMxVBJj2f6o+6ztsH7nBPvWpdzseEEpBmR5us3LHTIsGt/htBlTFiwPwXD7w3oMQFn0IK4VVdW6s3aodFn2FFdQR5wOPRgFvJ",
+	"w5dMgAAAAAAAAAAAAAAABgIBAABgIBAMEA0JBEiD8Dk3dn6Q9pf8Y/////+Dfkev9Sn5WrVGlzjwvhnjzxlyQxkvngjIKAwdrUGj",
+	"OArMXIZRzQcYjy7imjltPRCvgrDp0ymnUvhGvZTt5uVAzMs9BvMumRIJArmSyJ8IiGCp8cTlcjXU6lzAg1dzeg8ubSqCBhDkHDBx",
+	"YoUIpUMqEcWA0BBAiANMFgCBwtoRxaLLKBHhfwLsMQ/q+ScNC+x8qtNvca0skbbAO52tqQW6ScoyhhMY8sjTLYfLGhdcJmaLyYq7",
+	"Ibxg1j3YdcOplglBxK1vZzjyCRUFIQW1H4lov6dS0wbDlDG/ApA5xsP9Qi+C6/M+dwj3bNsFqtOL0y4Kmr3cOjWDT6W8/rsAhGBA",
+	"Oh47Fl/zvyjPDMP5Vrf7r2HgmNW5sa54HCeYWlchzN0baJiQAAAAAAAAAAAAAAAAAAAACAEAABAYAwAA8HAFCwPwKE+23OTTz99/",
+	"//0FTqv+rD8l1Xzmczdb4zpockcBb/ZCWhjyKyOBTx5sP0kQJGHOASu8kHToap2+haGcMB8cM+OfRPZp5V7WqtNVDDTB+RqWxMSi",
+	"cnplMEgoK5+LTQ4VU1VqGcar5n3IPfTlQjyEgqsFoANkFRpQ05QxkcDQEUCQA1QUIGpCIAy8+OsyxkT85FoJ/7/FVAIqStGVR2L0",
+	"oODNxmpMyzcuAMsnhNCkEg9vUDm0RDSJ8avu7svH7EicfejUTmG439up6oBBRjayhBcCXHdFge8uqFnQzTsFXEEoY7gBxCvFg/za",
+	"lzm1yXiZj6hkRrcZcEgFSjmS46QtlktzXvtHNDDFlzI85Om7bWUGRGEqKEpbcQjhQJY6nDDqq8XBDENaKImjRkAYkAAAAAAAAAAA",
+	"AAAAAAAAAAAAAAAgBAgDQBAgGgKDUBRy4DeZBd//+OP/9af/79V/0xdqSZsPe49aajclsh70Y12ojrBwTQ2RWcT2MYm6poyDwtjL",
+	"M2PEnBqV4TRMSEPDrt9A+TVJwsTzld/xPEUw/2cz4xUJKfnk4aixdga4iGw+lo6w7ktf8j/EJ7ZudQhknHQ490UM0ZbSMFWOJPeD",
+	"wBeBMAwggAN4EABOLm3+1NZ/h1f5b//xRn7+zE45HjOQ9Gmh2wJHEG+RXkUjVSrUv1K0MXzhVnVE8B6Zb3/z+9F/VuzflD5y+Dmo",
+	"P5gnm7VXKe63SMU/XTYo+3ppQXumeaJOQ6bWWilEabD9MWZyawHCc95Vww0wNGQgM+wqC7WblkEuzBjt5IBeCVaT5aur97seBhh0",
+	"MrmYPiix9NxgeKvJyOViHUtLrVNHZQakgKAAAAAAAAAAEAGAAAAAAAACACAAAABABgEAaAYAQIgOgGCCyrOJSl9Lf/UfgM/9glfl",
+	"spStt43XggryL5L3RwawGmnRwIYzgQGcafEpBki8Bc2UBZXbI6Nyem2AEHsIr5Z+6eFYBJsmxBZ5XX8X7W0hjGHy6TAJ5OIEeLrK",
+	"hKwcVj72gqXm3P2PkGz42laZioUFdWmW2SqHc41RtUmEsCuAwAAAdAWAQwSQP8MgJltKOFE8n//1APj0v+luR94nAy77ac0jixop",
+	"P3Dotl/4pJAnyawX8xLVkRyhmieTP+2ELvn/u30L8T26jF9x8AQt1ygqYNphNulwmLx05WPBd3et0ZyJyTkRgQNB6wAPK9D2/iMY",
+	"6hEsJVV4YHLcqcXc0ggjl8ecTGRQ7liBX7KtbieEtBmYXrIdXgt6t6YizLvqaFqdkbnKqaLbwl2gAAAAAAIAAAQAAAAAAAAQAQAA",
+	"AAIAEAABwCABAwBEAAFT1aXsO3yV/9jp/v/O9/WRPnp6T/2ZvS+HPv3hzt5A6tlTKJTqOLAJXzC0QY3DpRp6l+mPG/nSsrGCCVYl",
+	"js/7p9OjzBt3BgrH2d/7b2/SwGTCDGdZZwCQMajEEBhIyBjYSGfs54rpFzFDFWEsWkwzgxB1q8oiawKK2lBh96gkiUDKgMAJAPwI",
+	"gEsDgCHBMA5TNW8aRKf453t7f881z4krVp2PVJ8A3b6QKXY56yGEYGNmr2PDShZ+4gm1l+0xt2c/hJ297/8O9yeHe2msPoSuuLzp",
+	"X1N4zp/acTwPdtK6HnsTluoxDKvAZFj0d+AYTiR1LcfivHq5I8pEC5wkVKwGqnwQKWp0i7SasaNPjnCV9up2uhz4HW+BsYPo3XWq",
+	"xwuXlq2iqHC62Mo9AHflgKAAAAAQAQAAAAAAAAAAAAAAACAQAAAQAAFAEAgBgEwBj0zbbUvOv/4U5e/+0b/e5yHVid9D8v67KCdL",
+	"byZn7d2EnaS4syCwPVOmSQNxUCIJZAoW2Y2sdp43jYDDQCGx0D/YjCccA2KQYSxrGj732XlIFFieKyTwbiiCHzBEPXMhbU95ip0v",
+	"ocBhxpiNytQKSg9FwdcFQLDC5mAVZBkRnoOLbMACABQDICABCBGBAg1gp86ttyukj/vvdW9+c6tyO3sq7/mlw2WO+mG/AMmPUkyO",
+	"MVtA0BXwm8y07anWSJ/8OplfGHe+avrWc1RPq3gbE6+UuU3MuVGzEpCgRK3S3WL2nflBjhIZJEsfChJ9hm3Pstz2dZQIcbmLg0Ra",
+	"fFNrBgM1csCBmN/XRGeJ03X/Hk43EXp+J6neX28M8mNGS0c2G0APwu1iJb2YDLvgoAAAAAAAAAAEAAAgBABACAAAQBABgBAOAYAY",
+	"GgMgMD1km5ePB7/5u8u//ON/3GeHDGzP/krxvtVpX95cc7r9A6KjUkzabNTUlZ8ZM1ADCqiYDqbiLtXs2L9IiimmftqLaOVlWzci",
+	"q1hVWiJ5vpfFcPXU1hTOiZVNsEYjg1B1+ayuggEWbFsydzEWjaGFAaAMf1bZSFuHQ3NhPj09biJWd1eEwAUAAAKgAAAIBIAKADAC",
+	"BtMLNZGfVJ/MI+PM83l2TWzk9JD22NBFRvaY/hBSYQbg2ue4YUFWUqkYhPyoXyS374aq+hos8I/HHlZnb63kbIBmJfmeWO3mRgjo",
+	"5gVPhK7T4nviAwjDYAL9onxoBRqgJE7z+yUKD8lK2iEQx0S2U3PRGkVYJcXdJPJ0Ar+X/TR1MTJW5HQ4Qt1GQWiUdm3wxX5W1Ute",
+	"dzlD6oCgAAAAAAAAIAABAAAAAAAAAABABAAAsBgCwQAhA8LTZlysfX7/7TVJ/+g7/xKdknSz9es13yi6z/mDhTfXlm3LUG4c2i2G",
+	"xPegHnIyiK5ag60+QeWOw7JzylxCmCMyshBUep4Zn0qi4O4HuK8fw8NhvJa24Z1zzKHCLQSAE8Tm+ht8GbDk7XAwrYnrdLCQNSrG",
+	"6/LRMdVjdDcE18srSwIOrPWFwAgALAAgEwBgAIAQAVAWAeT2mkmEH/sAcz36CLzH3rVif/z2dhjjEDZHLZ24qTIZuPvWeFbhS76C",
+	"f2s70FP6zc4vkmpLF/AkR54efebJP1IROG4cPxqpFATYmaNExJGUNiZYga1A1uc9ytyMUxSRSC9y+TN05yENRHh8dmeKrpCjYE6I",
+	"KqSn61Dlp/j/RZyqFUSN3OcMvQFZLLZutljhMIcL2vQlGpigCADAAAEAAAgAAAACAAAQBABgAAWAwCYJANgiDds67pPtR/+ul8v/",
+	"u2/9+HnU8EP6uV8zxu71/yrzXqPyLbd7lgXzJDYwJL6fH7cot9xS5Z/NenvBfD+fGYCjwhhZdBGgedmPYYMJrkRXHnefsQnwfH6L",
+	"vXyiYGKJpVIPW+z1siEHclOjBWaLnQ8rpNDoKFS93Hvrg4nOzCWRxjH1QxkdfBDAAABIAiAAAKgEgAIAYAiAsAnuwtHRfh/oFTp/",
+	"pcvjdurW16ftDSh+TqXo8zm19RPGbwdLAoGEL8n+qXxI1af76IU51jgl0P3FcqHPVXC8woESrImDlJJ5PoWlMqmFK98Fb4z/N5xm",
+	"qZnuvPZJfLZjQZEDTHdbVk1bzfNN/mVpO47ZYHD0rvTL2tX9n20+gtu0bH0OACNSEAl7NVIR049viep5GYGCsAAAEAAAAAQAAAEA",
+	"EAIAIAAAEAAAsBABUCQCEDQMyydbq8Lf8RVfj8sb6PVrTeL6no9j8E/av/AnA2++4InxSOCXmzXAgvFg9PuRgta+wHavAudfEPS1",
+	"TtFj4QFnqQQIHoGnicVS4VHKzuOarZw19H47h33bPIak3bPjhxi4sjQOtp4kNEpapeh4XG52EYDUKy+rol279rysocYy9K0dNVAq",
+	"jjvAwAGAGAIAEQAABcAwANAKAFQEAAGBOy+mYB/DakdfbffSoaMri2fH8gfsiREv8OCfHOVILQJy1QAPOTH5ream32emqGTapGLy",
+	"hpKeMGed97zCJyE4WYlT+Mh3p8QIKw6DjovelxSgb44l4W/9B6QokPeg2TAXP4NkL5uN1khtc7W0vVfOLHpM6abXItDu14Yohej3",
+	"14aBVlYPg5GjYtGhw6/TYK0fDCCwAwAgAgAAAgAQAwBAAABgBwBAEwGAGwKgKwSAhrVmOp5J/7XK6n7tH3+sELjt+QCUlK4pLz/y",
+	"bwTvTwPLyOhmUE4ac5n0Hvqt3SXjdGn6T4KuzlP1FLPORrACihN5nmKQ5i31E0oTvkuA8RPXB3+u5f8w/BK1RU6rOB3HRa2D+btZ",
+	"0my0lRg5YnpeBkaVwxKJj+zdk13TolrchEytI7R2ZpRp7y7AA4AgAEAKAFgAADoCQA6AoAYgQgP0nVgMuUv+jXYDfL9fFgRqXQ49",
+	"NOwMukrK/Sjg7xviUccol2k/+Gn0W8MOaWBQLD3WK3OPtt0HobzFmuCg+RDhZoM7AnRcooTx6Jsyd43hDF66yBtlxdc0K+IBVp2e",
+	"RSTwEeVJnipmyC0poMNJskwhCBhMPWh2Bvg++6MCmvNhZS0zxORJ4/PsmVsx6q7M4WYwMLAFACAEACAFAAACACAEAJAEATAaAfAw",
+	"A5BYEWyssEj7Iv8EnI+/wOPwOJO3mJ+WXF2ljY8OeLME8l+CdHJJAlix186cQsOXfbtQ1WjOWNFYmvbeXcWFM4ouIhCai0NGYNwi",
+	"WleMTbsfGbjV1l18N6zpnybTkzZtOGKHh5FoBttNNdDqq1k5NkSNL7HIaicTEtQeb37atGeGIdnYAWJrLK4eGmq+4dJAwAAAFADA",
+	"AgBgBEAQAjATAIQGQDkCQBmjWLt7hRfloVEHymnr3oC7he+cZWAV0VRHkQQwYiRLaNKnw2JvVT288aOyiHCjX6PlAcI75tHc/WOw",
+	"4TBqn9ZrfNMqkZDCUiLgcSvjiDjrfpdpJMl0MZv3NtmhS5xDOLvMaoxcL1slemOkwFLVKZiE8LFtb/C+E37/s0VqCubdWyjom5oA",
+	"Vd3LY8S9ZknHWLzgsAMAYAIAMAMAQAAAoAsAIBcCACUDoEUGQLbKq0rPuD/4LODh/sifrQT3vVx+FPI2toZ2e5iOvNg+weDV9DZx",
+	"e8KPGipjP4kdAp9Y24h5Hz5a+5NxZzrwvzlSem1CJqE4GUVB0er+S22M7zVeE93W+dYZdtq5RxoEwOQ4osZTbSkOK3eHvpOyUquL",
+	"0FgGulwnev1cWWNHjxVJwVTtYwg6cUdPRRjFEMAEABwAYAQAQAGAGgAgDYCoBWA8AlgYgZUrZSec7z7DORo+Pk8G8ka4HvfgvgpJ",
+	"isrttwEQKNJTONXOIl9FPOLza5HKWvGbUJpe5D1/rLQ/LetIMlKeEiJqPhLRtCxZioAb2BYN2w99f8ZqsFuotkXGusZRFGSqFyma",
+	"HOo6KsvjDTXkTaKRjEuAF0QfA5Ev2+y6sVhwVQUgYXS0CH7tGV3Ie2dADWuAsAAAQAMAcAgAAAwBEAgB8CYCcDgEEFwGjHw4uX1b",
+	"/+KXPG/53H9QCyJ7pP204oWcppM84chsV2fSu4nEZHbseRHn9sBAeWW61hKO5U3/v+1eWtG11A9ZGIlpOKWSRCURkmhanW/Ny8f6",
+	"P5X2mygk6p2VdI5JtAjDYZPnO6zWrvZ8NU21gkOplOhC1DyNjek6O7rxRyW4qY5GF4GMaQDBFetzWjSrwLAAAEADAHAIAAAMARAI",
+	"AfAmAnA4BBBcBox8OLl9W//ilzxv+dx/UAsie6T9tOKFnKaTPOHIbFdn0ruJxGR27HkR5/bAQHllutYSjuVN/7/tXlrRtdQPWRiJ",
+	"aTilkkQlEZJoWp1vzcvH+j+V9psoJOqdlXSOSbQIw2GT5zus1q72fDVNtYJDqZToQtQ8jY3pOju68UcluKmORheBjGkAwRXrc1o0",
+	"q8DABQAUByB8BphYBAIswQPYeJOIoX4tfuAf+Ci97dMMV4P4SF6vi3AJ+fFRAwZ7oiKuSallDljTI0xPsNxW4zq0Pni/2NY2HqJf",
+	"TXjb02RDQDrwbjU5gIovNh5a4sPhamPb5NzXU4WxjT99yx1FrKiMmTkm3cPDGKmDkFxrIJnsokVdpp+IwIjpRNiGDEn1/6PHowcP",
+	"8XP43UzgVGm6WNJClDYwWCeerFszN7AbwAUAFAcgfAaYWAQCLMED2HiTiKF+LX7gH/gove3TDFeD+Eher4twCfnxUQMGe6Iirkmp",
+	"ZQ5Y0yNMT7DcVuM6tD54v9jWNh6iX01429NkQ0A68G41OYCKLzYeWuLD4Wpj2+Tc11OFsY0/fcsdRayojJk5Jt3Dwxipg5BcayCZ",
+	"7KJFXaafiMCI6UTYhgxJ9f+jx6MHD/Fz+N1M4FRpuljSQpQ2MFgnnqxbMzewG8APAKwIQH8E4DTCKBPQyQbtpJLBJmdQz9z7ycX8",
+	"MJwrE7N8CH2yJ5aLefCsb4B9FjDGDcSOBfgehP5afBjXZe0cMaNHb3sbizYfPHrLi9JbGrahoGPjpNA50DwXdbaYY9U3rBipI8uQ",
+	"/qvoeGf0LvS959+RXnvsYzJmNsN8HBn6P0EgHUsos1OVpc5RR6YRhe7qZvBw4xcumpWJwmYqAeLxJrLcMW2OXATzpXiT94DAFAJU",
+	"HoFbD7CqRvg5evYiFIsH43/8Cn/2/38KAyelHf2Qtmvj0mG2+lXbs/0YViEhDDvFjn8yTYvJPphluw41dMfg3E1U6OfDX6581rRZ",
+	"IeGEOo75XN0KN0dpcCJFOep5lo+18PZEyBjK8J+EP1dUkN7C0gRkeGUy87nvcmoxyO19jx4ExEGYeGZVQ4Yj3Ea/s2VMv8fF9LY4",
+	"FoeBFDUc4T9vWnYN1GGzQ4kAwMHAAYBwBGA0AwgdgVIOIIGFYDAsZoQ43/mIfeI65j7NDgXJCjwA/FRjdm7Tvtb+1nQarLgRpUwb",
+	"JNXPyI8vLGFYqCfTK6z9H6I0h4P6r2YZSuF3FwAqHCmDmP8OYjZTFrmXNkzS3fN+s9jnePfdPNi+AfGJFud7mW4JU/zuEjoq20UK",
+	"oR4qSSfOyVAFlJa/s/RzbvqnxrWIU7e8KwpxdMrU+gH29ls6w1n54MA8hEAyIi4VWMwHdzSVvQ+f9ZH/oo/+Dg/8pwdSdN/yCumj",
+	"vFpKLYt0B6NsrZiDCaYjIWsykb3HJjkU5qsAyvaf27uDA3ETrv/MPKDRDULuRapn7gOMRDO+IZB3grk5eA4fnm08raZ4Fxzn+DP+",
+	"+HJxf290ZAQErWFSrYvEKHjg1SmEkgIjc1lcLiocHIvBTTcermqAfX09Lc/O5ksUkUSthT6vEuYvh6KGdyKi+M9TCLADACAQAXAm",
+	"BLBYCBC4DPEKEllbWMkSfCX/z8++R/1fvsGain4nvzzwGoeVc+LXOXiRwEBTEJJfa0n0g6dWSc5oh8lhkPvvROyPCHQmECGRgqRF",
+	"IogiYyBBhtzJaxiW3HlbCd6HPek4avVbnXco0BaJoEbx0xsV+h+CwOZgSwppsgsDUQNDQeNHOEULqdaxm7ljCWEYoUnoZ0glZlRQ",
+	"TgXBw4QQyQCwwCsEPDMBqwzAbVmRpEj3/UL/+lV+uQ//xU0RQqn/hcfC82alhtmc8smdLEr6goIcBTOeGrG3iTZcoitoR7JMFfCi",
+	"1NRrsmZ+lUsFb1UVlzSA1yUFGFyhDQHWbc9XxLK+01BCUVlTifnvR/H3Z/zNP2H+PvPkcOuYVWk8a8hsmGFFB5NKiMUT4aArMhid",
+	"0FCur6NP7JSjPVkMB2mqVg4UlZSETeqKSQd87S2mINAT2GJUZM+AsAAAEAIAoA8BwDsEYGUI4JsL4MWHpQWHd5mP88/VO/xpPnyb",
+	"MXsX+tGUSj1OhffkpxUV8h1JlY4FbvUjktXhZH+eytVHdi6V237I7Hx6LR9qjL4IDVS6RwA0rSSzxE5j0bfH6jwPUZFEobpXu12N",
+	"4hmAdXauw5wpavFzE0dBgPbJY3DwiiNMUThzS5ujS3MecqKKIBLUQZYuVx4CecCcDGvkyBQAwA+AIBHBXRIQQba8GxMc3/7lFFf/",
+	"/7lbvJFz/2f/3x7hLFMPw+m/VenU8m9ABBkUkxUh0QW4fEFRSctJIjr2m3Cl7OUc70jzo1lZmMIClBNx3RUKXY5ln2f4xseVF8+p",
+	"9DNEjQLTrZiaqhqPY2AAZyt62WVFqszrekey7xdF0E+oS7A0uREqi+BFFBTOF0n1+4zi0Ub2LfDd5vA02kWTEVCyYtUoFcK3zCQY",
+	"YeQwNeMHCrAAABAAACAGAJAWAxA8BVByCBCeCTdwlCABbPf68tTr+Ft8c7aG66/e7TtGQjFuKxPYYqM0opDhzJpdRswsKKhS+cSq",
+	"UCdi7/4W+C+fNAi0FyO10CkO6sT5GfGuHFRI/4uvj+M+n42nPDGD7d1jElRwoA3itdTTgkMR05E5ZRi4BBmp2BFEgYCXJ7PDwTwY",
+	"JPC71zBxUoWIxp9VLnYDPHw5HIyA0DRCRg30S0FfYdg4xIO/ltPcHf7El61Qka2DXqOpfW7QFsFuRc1x9FbEcBAl1DoB2DvIkUM+",
+	"gAki7ErKp90z3xpfJLOd0I8ncLmX7Ys2wBzPKShOjewx5i6EJMhN2lpphSMcmG3WxVHWFIykEHenfGjCGmBtQKzTfcu/YYrwRQvA",
+	"peqa4kQvxMyiQxEohbfk0xjxUP3dPW/mfsA8ftaD+YLZlR7YUszKQJwrAVdXShHQwLAAACABABACAGAFAQAjAwBJBgBzCUCBZ+iZ",
+	"CjZu/4u8L78oz3gNMrfr5P7IILMBdpGA66nMmhEkMjhBcLOVmfUyo2M5MaHettrcGfCW2cZjrfzJZsAxvBRIVx3iOWlFFLf/U9tL",
+	"fO8pkA4PmmacK0ivDRCmz3FW8MTEYpFGSYOQcVAKA5LSo65AW70YrlxLLL8bmEbuXQoEP6+e1xtAPRhqZgDQL4GzCJApk1mnJAbN",
+	"n9v4tT22b/CJguSE78XPqH53g9hRKe6BiGJHs8+AjqA0UJEix3EZ0EUh3SI2BDtcNejFGLMYsIb/SmyfPVytN0MM9ibJdBqcH9Yc",
+	"TRcA+N7rnUBDEN2/WkVeFyBFhWxwR2dm65xTpAsYHqvOOaU3OEOP19hGTLgeQzPKcGx0WwbnOtSCKDov3fryPU/oVNPjZ1FwYeYr",
+	"zSpwyzECpQB4r8jScSjgsAMAQAAAAAAAAAQAMAgBUCYEMFYGMIYGdi5/QejMb+ujEa+3J6P2E5oz6v7VIyrTrJLo867pwlLkJslH",
+	"ADktiM0kCECepNcc7m4H9TcbaXOIgUlF+mlSY3AxiDDORk6H+c/yUYRfk83oD+KXbFsQ0CxDs7V5jjooQJZtXooNnjwlIxMHKkto",
+	"9GueuzSwHF3RuVxB+vrxEjX8O21tcapJyY7QOwKLEEhMWPxPHy/n9EJy83/dHub9Sj+9I6KKUCrdBw9misIVJwm3oduCfE1QMgUP",
+	"jH5LkI1xn0WAK466X4+0cjpaJ0w7pV1eAS+oNMF1HE+wqcXdJqSjrBgTbZmMGCYPkuc+poqfl4BuJFGLOqIj1bP3MDN27etvzaVr",
+	"MFcZm9rVNMh8V5NTQ0WxChXAq5OjCAjeDjarKVTQc6agkoqGdy7a8Bs0UAcTNGs6pRUCwvSgoAoBgAAAAAAEAQAAAAAAKBYG4Rgk",
+	"h4CDVRVIdr69f/L74Fv/jW/wFZlPW35J5zzRzS0bzzRuiipl28LoZssOQE0AAhM4D8JrW+4e/OSotoYALQS6Yi0EIINrWKQhmo/G",
+	"uy+Jj1h87jpAf3DNH6PZtLmWtvbjEzUEJIJRFwFJHKALACufVHxefhyM5yZEGZJoblqr4/HQmCRdt2pzOdUo7oDQHcEQBbyBqgeH",
+	"vWhu/mHfOAv80KCw5qLl9cznA6IjU0Q6YaOmpVy8oHwpVgiYPVLZiRkVLG7I0oGXoBNaw0hzzvgi/8Ecr+tbo0BU9SmSah50q+Ac",
+	"kJ8jXGlrRb6xYEza4NwpPigoWkUYQ0VhSGg5L1BhjJt/1PcZprxvSu/0hIk8RgFYNBaGPS2Qtx1yEnY/kKvtoVuR7AJRm7dT5Wby",
+	"b3yr2KdtCBaCmXfjyLiWrLCgBgCAEAAAAAABgGAKAYAoCgFgPBAAkCwqrdJdAp/4Af7lf5Tv/SV+EYHPmP4/WZmhm5nlvzfK1DyP",
+	"nwJoV1+4rJ8F9YoxGgCuZuWoX0FwRFuPjIJtURflzBlDhVF94s/UWAuvvvLyQoKMsuwavWibRuhr8NY2qDOo9eoICGTgoEy0/H10",
+	"z4odjYkPCJjxMCcXw+7gyIRrtU2txOtEmtBQw1gVPWKJwwB1eXm+yb/vdX2fCSPzF3IK3hsr4kdF6Vwr0hMS+icAMOXzhnM68UMl",
+	"pgAOHoy3wiLSDat5MngXUVkh5UT2+NLAYnPEVYJBgFWWeKEQLHAMSc1FioSpGqrkC6YGgQPJwHcLCJqMe3RTvxoavnmv6bkDDCPt",
+	"EuxlEk8NQtw6GCo1jdM+CYZSzyWhBU8MDyOoAVxeLwcJb2QvietJf5m5PgYlO2EGIibs1KAAAAAAAAAAAAAAAAwCQHARA8DkHQFQ",
+	"cCJbpbREtop/8/dN//tU/zBbqMl/WviZBM7+P077P83snbL6mabRH4A/EwcPXhjna8btW2y+9+e+AzHvzQTvImqKCSYKNDgyWJYh",
+	"X/sfkY45BzNiSMjqlWnkrvctYo8OOsHnV8gQwGDwYrXg+qzlTIMStlGBpGiPRAJerzYcigxVxUMjkbjg0E7DYhX91umHB4f8w317",
+	"f/AqOtxTKeRf4W21HrHEHs0JGi7oSxscBRl5CpQRbpkifMnVDMYPIUoFiZ2rOweVfGkl/1H9S5Hf2ghc4ntFnFbRkc77GxSoZP3h",
+	"Xhq9Rx7DqXACFFnsWjqTA8Ilqw9EijaCe1DZdUpGtLkkevwHCEiTYlEW8RkVmcLaDtldqp+IgGrWRe5nSDf9/k38jL8nc+FsWZXl",
+	"VlcQrffjKCu4e/xAoAAAAAAAAAAAAAAwEAFAIAkBgBwAAeAODMclm05BF/8u/8EP+LT/wPeO45fGTtVZuEqd2c18KcS6Gke9ihtn",
+	"P7hdCIG8GpcPTZ5ztTcQYr4FzBsUrlOyq1eeYtR0CZ0aJMMlAs/+V7fjF+VTKjErbgVeUaSprDYYSl/hl8gxMAGYioOLwzOE8Pav",
+	"BL0pTcU20Y3f581racfp04WZ40jQQcLYEtXZaZ/LTP0Z+uU/1vTb8oejCN8KLanXAhlq0bOQzppRCEKUm3SQUN4p/CnojdFEItcX",
+	"EGYJgDLm88fDU0/1H+Te9X7pQJ2c9XK/S6SnCmZ+IETsRdx4yoZMvM8qYiPxdjE4GlmVR794v6OD/Hq1536zto9uG8YvqazZs+4U",
+	"tR+CmCZDGvceLx1oxyYFbIk0pFUQCJxszIlpuJlLZoJhr50FkAdOlWMhBGroa4CgAAAAAAAAAAAAABAMAMAgBwCAAAACoFIAQaVf",
+	"VQCc/mZ/yM/qQ/883pILtof4eYdwRzsrlXiLf3JdrX+LM64Pc9HuBSyQF241ckPfOWOeuG5kBDJ8i6tWUVBEB2KByaTDHiO30jk/",
+	"3GrcAPlsUABiiLxqKsQqMhCqHv1ALDEODzlZ7srCSMoaEA+PKoR5psYhOLsy5WZMEu8kPhdSYNA5QoARJYOp5Aez/G+76n+2AcLM",
+	"VsWu/FF3fdxYWnMrlkmKgcLVDPJZYeeCZaYQpxJFRDCG7F8xTWWVyeuZPwHiH8wfhrSb6eBfnt0s0qnZQeYZD2YeqoOeMvyymznK",
+	"dbmROnFkIQiiJxEeVDu8T6AlyxdC2eYJ0hJ4w2SVY5qMSCNMpAExcKMW1eqTE6G0GVFa9rStES+3p8OLpxZXAtC7HKtGawG6rEqP",
+	"M6evaKAAAAAAAAAAAAAAAAgAwEARAQAsDQGARgjGdadYQfX/a7+2n/Pl/4BuwAN+WHXLC2bOfHPR928L8c0THopU6y2z+bQ3mT0S",
+	"7+L3UdO8OeEorjbgy9dVrPEc6yjNIvzR+dEdT/L8r7n0b/03RTuNMbCSdJESqKucPjrKOVNZ9OYbqHytCCRc2qSoZwz4bbJDBk3D",
+	"m0ORlL8/hh9LkCDAWYeIZi3K3Uh4j/VJ/pCf/Qtf4pYJ1CH+br0Ec6dXDdfryiMDMkwPfmenhRSN95JrRqgscFKz2QiqAZbWzvwv",
+	"Q/1L+Kq+cxlyvtrNrtmFdGc7PRCkIkuTdgQ6SnbVxzseKOGLCoJ0tj6hV/0Gs+BeWVP4L8NGORYtbc9M6I+adWB13Gi4iFLLxvAU",
+	"KZTwsUZXtdrKII1eHw6vHx52VoE1uheGzHrKNKQkXP3wwKAAAMAQAgAAAAAAAAwBwFATAkCMJAKQUCFZNi4pq6l//h1XL/93n9pF",
+	"MkqOt/EyCOjWfjjf2qs5aFj0FyZ3S66X4A+Vslvew9qhuTXvN9YTrzNpbBrS4zARTaJVMBsfP62ODG4/G87c0DOhOBiTwxKEGVFc",
+	"LEgVETIAJp62vrI6tL8TlW373YpJokQiZbbc+ViET80252IWf07dbrWuOMAZgcgSYtTKDYgT5tH/he/gKv+/G0kgD3w6vUtsDMQJ",
+	"iHfFAg4oFgqWDTfEC2TkUlZHhGIC3rXATqsVmW8S/riVtRfwtUHKZ0D0yq3Y1+n3Q+TR3TQhJgTliLJ/bR3DEJIGmuVFRhGgfEDD",
+	"7TvOOe2G3R/teE8c3yr7KXtzpkVaMhknABpwc9b0MlYJMlLAbzupmSrUXjzePxe6Jpc5RPI4SFasazcrCjReuUCgBgEAAAAAAAAB",
+	"gIAGAQBIBgGgOAoA8A4iLos5zuf/FT/AD/18f/LBzRKv3k8FoXy77MZ5L5I6a3TSCBiHyC5Gb6Skj29Pykww01RmxejpbmPo3d07",
+	"NEIoAQHqXZPNQ6b42EqwF1PtO+wnMAKIlCFArJNA4bYXOHVhqH0sbbVeVo9ImSpQ521kOEFngCAg6d2djSi2Za2MdD28WpzpWH2w",
+	"wB0ClCPB5YfLbkRQf+6Lyyv+8M/EJWq2ut982sLxGQEHvi7heHwFbF61NRUYNe/iisn2BP0x0dOSCzp/FX40590i9tcUU4c4pD43",
+	"A5VI/fOYD7IVcYw9JY6xgm7y/Q1iiyaSf0nH6e8Urw3xdo7Jik19L6uzcEB9/YSpMpWBNAsIg5XHD617/DxpaalJcxt6It1pWefw",
+	"fB6del3LVsjqWDshZ+RrMN4KoICwAwAgAgAAAQAAAgAgAQAABQBAEQKgIQKALWCqAwbHql+1D1tv1itH4aGq3cHFJCsk9ugzZnkX",
+	"uGZ7qFJTbm9yUosXtUfUbllxtZezuwozifn3k+P2kVmiZEU0sBJjO2vbu6gRYbK9tzWNQfPWCSEFa49VK7scUrCNLAGDxUGh9tVL",
+	"kcJavTPO5xAEVx26YVRqxtB4kky5Ao5evZsdy5R7+GDACwDMB4BJESXqWJu9jn/V57Xj/NJe7GAK/Al8WDInUj15L1AIjNxsURCg",
+	"KogbpXyAUimjDQ2lSICtnVO4Ppz6a3KtDsaDU+4NARIjmEoVO2QmAzUZk+jPbk1gL4G4RqsjQhsFPCqj5tOpv6Wb4tywy1ntMDjz",
+	"hYa+WEBxNJk2CQeAH0yN8nyE9GEBUoGprAT9r4xU2X7uXTftaw0GhgNZFI8PWxLMW8UAoAAAAAAAACAIAQAQBAHAMBMEgHQZBJlM",
+	"5uFKf9Kf/rf/ax//pu/F4Znwe+WEY5qtnOAlTs8WdpUdLIi45ePHk5KpZKp6VfFbQvQW4uZp6rTSO/7E4lcKCgfUOskKRQ1Xsk2w",
+	"IWl7+5NG/T/MkUdB89+m6TR7l5YbbFW+nS1/Gk9pFPUjxXq3IzpUTLzyRIuqbicKkXJQ6VSHz/Tv0Ny0hR4dMMAIgKgHIE4FCduz",
+	"qCbr9Qj8MD8HB/gnO3UzffxD8eLYJKgNwbqaVZRdIsWW2PWBEUSUCo9kAghlD50qDBv01+v6bv9hSVG7MXaZAtlhCiIcSKjE1SJa",
+	"FngSFoI4a4LiqJAfhIqUmn/PL0W6vaV7aubSXmeAoBC0y8/AA0ccppLBwLEoJCG/Bb20oy85U7CvSx+h5SE3V4aeSjsZD9FSlicQ",
+	"A2dWVQ4AALAAAEAFAAACAEAAABAJAIAVAkAZAuA9W+v6CFfSX+Vz5FH9zzgZKh6TONKPUJ9Unhljur0zuSNSWNXJjwC8PqKWkdls",
+	"votQvovYvLmAb/yHpauM5OHEtm5D+5FeGzdNGThcIKdlhc8FKHrI/B4HvnrUKqp9EmBMFHOPqc7OY8nLp/AoMJqJpSN7Wl9OCI7k",
+	"463a8Au3c4DR+T4e6FOvMR45MwDABoAQA4ArAfAd2ImjCZ9/wIfGJ/icP7NTIXdkf4z0hDWqAKON7rIW6AFkgqd+L/BI1GEA4qaD",
+	"kkUp4VLFnL+u/DslhYY7Dv0FktARgovQPXDW54EyeQNV9E0ZJp4sjCbzQsqODsPzzy7FDW3iUQ59iVB02Mjr2rxl1VxMqi1Egh0k",
+	"BECcmHGbuPrxKmGDgZSael3jFc3djkYUpuzPM4nGoDOBj42gCLAAADAAAEACABAAAHAIATAcAdA4A5Z4yXhP/z4fkB/Iw/0aN7qO",
+	"fxY8T1SIGTAlicieq+qmyrC/PjYDw48BHCrA8CG+EEPOlvCm27f4tyTKuOqXdAMlnZEey1MDPZOA8NyueTcPys0QX8YAtNd+mc8n",
+	"RxCS7SqJP8/iaiTqgWzhDgzCZEyLUW2HM81xfh7MsThaSC07GuB8Hp1wUIQ89uFwsYDADoCIAyAuAegVAJb3zMnVGv7enCP/syP5",
+	"AJ2F36vMkgNqrw3Txgb/FhIPfFsooCIwWtdg5GOWBF5105bLN69/RGkJg6OA39Jci8NjyVhQyRzgxwoUgjqg2cwAvzRVg0OGyZ9M",
+	"yWf5ZSptrlMPCqUZtHDiq4zPRtXwmnoo8aSSRRx0RhR0hSvl9NU3ERnnXtomTW8AKfPyy+JQq48V2VzM6dSNx6G5KLAAADAEAGAD",
+	"ABALAMAPAaAfA4Anfi1FFvf6lvtM/sIf8RjTywCezveJiZCP5+8VEKFZND0qiXwiLer1G8blckZR59a8Z2YQ837I1nzXgaFcYw82",
+	"y3+Hg449TeJI+Z5ynDxEnwneZjcSdwO8jPulfKMa4O+79pBTabvhIjBlWjgLgnKQ0gICovAgRc12kdh+HvyONeFChcLkAcXn1Uri",
+	"1nJPa2uBVMAAAGQDwBkBcBBAuAJ4NDF0X0/6PGZX/ebfoAhynUa7y0EpUCLj90ak7RzFpQ/KPoScDbXoLzjB0h7xo5nHz7293bq0",
+	"E5AdgfjqZtPjgM2Fc9NMsArkFzWMTp5EnZt4SUOAo5z3ddX9O4AqQbwzeEhQiihiQPznh6SL1+ywkjkGKMiM4SCDMAM90VfNoswR",
+	"Mi8UQNIyJbLlmPlSk59teRwtTKD6aXKjALAFAGAIAHAAANAOAPAcAlA+Adjob80+H/cr8Uv/Pi/6u2DdvT+Z/Q9q8Hd8FeGmDIv2",
+	"Z2gMQhLg53ei3iVG6PFfFxmDcxkuetxZ3804RsVINJ9Ot3nMFB6G+RQOauw7PQjogvwVTmNDjbfQa5+efjCTnsE1KEI9Z2lphUhz",
+	"MUXjM8lCoMSKFGa2pGzyxIWDv1TsjcCxxut2k92jVYzoFW/Xh8bjT6LAAgAUAmAYAJgKAH4FoAXApX5V43+I9ie/1E32xAWbhx9d",
+	"WD/oHGVOhvNalyjR4V1EADeAUqiFHk7yGZzu1Wh33p6ysDzeCb3b4/m3MgDpXkfrVlpayKilwXJCDhV0XPklhMVObb/Iexy76ltB",
+	"LyLzzXAJNQscbua+VrYhY7GqgzNTIs+RSTIiUKOK/g9Gqu6VAlXLAteQkcZm5dbjYE/k2b3MqKZcXkZgsAAAwAsAAA0A4A8CACsE",
+	"YBGg5yqsvX/xL+Yf/5HX/j9S1vA39ymCjjsN99VOBSPAxKSSpoOAGPPEr1i6dSiwyoMUe8re6XSZ25rjxbiXBSIcN8TuFkvjAXJe",
+	"EQBywrUxAAilrsu+lml+P2cf+lfyStDtgwRyMUuku5fb9POzA1KzKXP0SnhMBpjHHeHkxxOxVuLSEQxZPERDNGpcuqY8Rb2LGusI",
+	"WJpgwAcANAAAEQCQBEBIA3AoAA3PFpZUG/Ubyiv3wHzUhSjRz6aciTKiKdcTOb/GdGdwmprQGwAcQqT68cdICb4WiXnk7wprJcjW",
+	"XiLsi9svFBrXD7kNdiHhzASFiINqr5HD2raYo++t8J8p2XxL9orT11zqh8shDkK1vecHT3mEn4KhRikTp4UDRuAWvc+3Mo4ta0wE",
+	"gRZqXzQUTl4mOxTZLMzoS2jImJkKgMAPAUwMgEEAWBcIGVAQ+w/b+pFPs/8rhTTRounTfCsIgj9xDjSwZARSMWD3Ab1oBQBAgV+O",
+	"pCl5BuDKt6P7y0QHtDfCPi+2ONWCWKGhUzA9h3BhhlfhrZeS6ULUCY0C2z6KmvDkhfrWP/RH09VAmZ8XkMwGwbDhp2bKYqr5mG+G",
+	"4bFC4lqsgc72SKm9Fuul7VSmulkLndezqOaoMPCkqDAQQmDpW2UOReP2pvlgwA8BTAyAQQBYFwgZUBD7D9v6kU+z/yuFNNGi6dN8",
+	"KwiCP3EONLBkBFIxYPcBvWgFAECBX46kKXkG4Mq3o/vLRAe0N8I+L7Y41YJYoaFTMD2HcGGGV+Gtl5LpQtQJjQLbPoqa8OSF+tY/",
+	"9EfT1UCZnxeQzAbBsOGnZspiqvmYb4bhsULiWqyBzvZIqb0W66XtVKa6WQud17Oo5qgw8KSoMBBCYOlbZQ5F4/am+WCwOwgAqQzA",
+	"2Q3A13nNR4tbBb//Jz0gP/+gtkdX5fjizDZJwE/bv44oloVmGYJGFdCAaKaMX+d+l7xUjml+5+WcdBwgT3fzlV2+FuqhWyrcQMGX",
+	"edoW5G1ReFDlcMkjhZq6HL7Qj+59vr34p+teQTDl/Y0TEE4YNobquEh9uwQAzGrkE8xjejK7wdgG0ymP4UMmlI6pz+Pd1WefTc+c",
+	"1mCKoQJstECoOPr4UMAIAUQagYUR8CDtoD5QDT9BPztP/szOHWst82fRQvKgTdZHtWw44tSP2NvCa3PhHo/oWqQ1DvRQ8hiweWfc",
+	"nTotVL6l+Xs3cwtMsKuRFYDbgm/ztKHEnJu5ZvQqgIPKilub5YkNFQ+/7x+dv5akZisQxmsKoMSNpy7rqN6YoSxhfs4g1oWdQwCg",
+	"WSztZDzzE83kblcFRxxeigLxfnaKloyPVRyMV2BlEwWlmryE0mzMsBoFUH4KENIQEToU2NBgzFubbf/rz+W9/+x1g6Xd/cBfLi7C",
+	"/9FfPZRHIYrVFsiHPENmKmOMTz+a0eIduzrLS1oBomPzPybUPDqXkKr7Webtc8RFghbF+R6gmUvCLrmDJ5udJGh72g6F3DaOZbde",
+	"fCZDUqM6KU3zuGnEYjRRG46GwazY4ZWdq9VVOJenVTEcAzONlU7TDNIeRPbS4MqwhUgyEo2s+MBOhxBaY8wgvYWQIxMz47H+EN/9",
+	"SB+DQ0YOFLwIbTAF9Fj8/qjlKmQ1Dd4k7E2EuEIhPRCkD1OXgH5Feefzx2wXBh+QPuXs3ZboRjF0iw0BuQ8Ao0KzE3GfWtfbHWAO",
+	"EkSzV0nU2R+P131z+Lv+QFlDeRhS2Rqiw2pHvxXSLKvZuEB34FOtAY+ZgBdc5qCylE8L5Hos6yCeFe65ajy7XplBZeuwDMGBLkML",
+	"OJE2MdXSUh0QhYCwAAEAPQZAhwuA7xQhP5aVIAvrqV/8U36k3/q4WbMW/y80IYARhfD/wk1p0Jo0SJJNjZDDCUUf46+tr9f1G4x9",
+	"24nYAa5R/KPeI55mnrb3EGIoQXFkCO28GzqvSmC1OSAs++gbZhs7SJ5FMS8m2C29zxdY158El+iuqpUiQYEV1fEKxUAJfl6+BnQL",
+	"KORuMW+z19VehmRna5XzvARxZKUaAzHkgMB5CVRlg+mIkuFCimzj/8Oz/CEf+si1LeF3xv59wHScz5h/AftEFuEawT9j4kYRjxHI",
+	"Q+GyJSQnojeRA+t8HsMjvtX9w+1p2dhtNu5WbgeMKo1HDhifennzbnIrBaIqcDxEsezoOXdGPQPSH++OunG8KEdNVgNIByGd81KH",
+	"KYn49MO5X7UGXmsLJ5kV3Swvg+/iuryTDMMJtv1GGq21bQh7TI6lq0kIb/PxidPDLIw0OOnwqMywDgDQBAHQPAXwkAvREAx5v0YA",
+	"qDz4/6QP633/CGlpabvUrDhXuR92DbHau6tCrCE55yxSrE5DePV8l3dhK6C4Xq2QIw15zzp2L81kUUDRzQZYwxYQ2z7RNxaBkDNw",
+	"woWvcYFBHnCwRTKMiwLdscsfCaiz0jMKVA7CGxKcFg6gkaikvU6UDycm56GNLZrWmJPN6PHblXkiTaXewCZrpEBQ1sDAIgOUM4Gw",
+	"zyCgwzv/2dMdH//qaEEHLq135XsPwW3wQ/YencGdkcYO3eVR5wCJ7AOuKMJQRTIp0HTPpTOHmMyoJezP0Zwz8HOFnPbqIEiIqdXg",
+	"bJV0N667y2EywfsOoOJChYEhfkjjDEyfh75+phZNh8y6ByILQxnvdZ5mK1GYgaxi2aMELSEJzqFLRlDgEuN+Jn100ZmynX6+YZ1x",
+	"4s5LJYVk2GGlnr6erSoMUzVXDqE0ILeAsAYAEAYA8AQAgCMEwGMJ4GSgM3UFF9af5TP+HB/IsOQ4KuoGJwfEyrnxz4USWbBRi8Up",
+	"kYJxszC8xHCNeTik4N03V9GQlo/i7LcJBhkdxCq4iQ/gAORpG/c+gohRwUZ8357pWOX/RR8oVyKkWjALJC9ly9pyrjEyjsPLJFDA",
+	"dNVydLT1ZfOF7afQ+xpZNWNaYm6/T7rcbCKSWkYEBI1teBCNwLuPWLA1s1qses+Xf/6MX/50L/Sxeohr72t49RdGTV8e7UL0BTio",
+	"ogBfuUhCi6xccXEItpGQUwsszvPxF7PFQCWUf1R9K5eez3D7vxEJWzuopQCHtLen/MOSUWBNC1riIOUhw/nHfkSo7k8RcgamMFmw",
+	"eCy4ORNA/GdooTFUrAWS6ZW1+OiAFTOZPZUoFSH63eI1DVIQs7ro4fgnGoZmtxKq1p0Oj9jiYXBoUNMMdPZ5Qg2KroCwBwGAEQEA",
+	"JwMAMQNAKwOgNTFpyilzRf8Gmnn/yBvd8bb4ps3EYYs6PnkTwqxl2HiXQjUWJuJgJq12+EcSpwRT1fXtDzHHGjNi8PRAwMuRIp+D",
+	"WDsaEoP+56mlUDwtAg9JHcqS+kneAP+MpFQkl+oWB6uvmFy4hHJOtqDcfCrvCw0XU1sd4zTc8741TLfaYGt4vD6MOlaUQSsUFBET",
+	"R1igwEWF8CYaXyEOaa/+VHc7//8X0JC8ViyRCgJ5Rctjf6ZVQhPyKAkB8yNCPAQpJww0U2VDiLxRoilnbMweaCKgd6//IHYXze8u",
+	"ub2xS1nJC6oCHUv4f+b7kS8hWITGHcXYYhe69Kybl5HGHCWsqceN6lEYGwBDHM+vUvG2FnUlbzLdhQ87BVBrBGclKwjyPM7pWiSQ",
+	"6jPQaDONqrSjhcHYtkxQ1q9Zd3a7NEBm6+xWg8Y4KMiwAwBADgDQCAHQMgRQZgfQugt3voch83H//b18H7/U0teZDOb2ZaKsFRgb",
+	"18UNRhCljVSLI52784M/SnxREciXd236jJD3NcJ+/fINUY0iTOVnWs9CQ0ZNGYnS8AuFuN7Lqd/rrXH5ZL+FyvAQWA9wU7VeLNe4",
+	"+wKa9vLNCcni3oyBWX53oSdPQ+d3kboySNN+Pw+GBWSEmVqTUNOMQWOAwIMLXeOaEJo12B//rAf4mT/79jtF9PWUxC4N/Rx3Rz8v",
+	"XXBQ2ASgTHdKCnj+kc0caC+now+RRkuOwHmSSBIlJX8BfacSvsF2o4TROLd5JPVwZHHHxvufiAc6+l83Bel6TBcznOdjoLR4cz8P",
+	"GcS6/ZLGXxLgfT94hPBlOHSN6bX0zQkdDeR4PBMeJA216sXq1+YFTSdnCaZlEMhuQpNc3SMN9/vInkWEHdreR6SQATb00LCwAAAw",
+	"EgDQEAKQMAMwPgMwSgWS3pRS4zz/63coP/aA9KaRbpstSgxj9QQ8vFlcOIVYnEXqLQ2l5A8MfWlTEKADp6bz+ihlwz12wWzLSoCl",
+	"scVTUxbFCeSgrLsXuULN4YV/Awn3y/Sue77cstK+U+4RaWHLeC+wnMjRkgj+Lk3odCsH0vmA8EP2PUGokHHq0cG3PTFHYpVpxkN2",
+	"RODrgMC/EC55bK5H7PwSP+hj/9Nl/m3vQq2EJAsRahfAu+Z5xPd+8rIKpoWK+Idu6IezIaCLJNMccSLTTqO50ebsRM1/wf9Wc9P0",
+	"+2IwuicZhKVOtJVHjbyHFozDzK4CxCPUSRoNed5vN5MqPRimf7+MV4zXKUKJ2ldLzassYRkG5xW7Ag6LgwUxXHoUfTKSNyk97ZVJ",
+	"cAcZrpZPKxFpznofjWgLjLl9hVNEqUBrpapQQ2MWcrBwsAAAcBAAcA4B0BIAsAwA4AsBQOyQ84kSP9nXoC/2KvvNLN6CLxIHInSu",
+	"uWjG7CGLUQXDQjtIAeHvlb2sjMSZCVPEOAyLnOYzHsmQcYJto4U1AjoDGczT4AoLUp1hF4KIwuWc6B83VTPC6zJ5fgH1jFtFs9A2",
+	"60CCaqoZazsJyBgAWrHge9A24vC8Bh09SEDl9EkhuuvEqTkjk4LVQfBAwKwOnoXMvcP4/Uu/xEP/raP4z7xOdMCaREejdSrfmY6/",
+	"2/2NmId2CFRYQVcQPsDwBNUNOLYHOpC09c1iD0MfN/7Y9P+LH7BYFTwrQrADzsrpSXl3jae0BQpn0l7Hi6AIcI3Dk2nuwKjug4wz",
+	"IBgtmxYekgj1zteDYyvJrBWa0OooAhQRAY/yWKmoyEbVJ5eoXyxGPA5KBVCfPEzzUdwLOmJxyudtmUSJtg4qXOg4ouI2YLADABAQ",
+	"ALAQAZAOATASAOABACDykXPPGo/en4yv95b61z9eZyreA0Jkv/nyxWwEB7iuwMI7MozUXzd96JWRvTwH+iSjKvq/TS79khCwjuM6",
+	"WgKAyRuByFssCgJxnJ78JyOld2yaC4KPqWY8V12m88/WL5yGb6tw5sAEOHtaTBYWAmA8ELc8bxmttmVyJE1+RmN6slQ/FnjwpCwx",
+	"grKRi5LAhwveLC0Ih0D7mf+Vh/2TH+LO5XO9zS1gkQapnnu8cMHb/HsFEKHyo+BRqIH7CgIoWJtLLESz1qAGUMO9cvWH+XvA/xa+",
+	"0T2Y0YaCASksIbPLk3XUf7LjViEm8/RhJwAkfheRDpZAP/NDmqxhu0PtZlwBQ3f6nnN+5pgwFqM1eMGwJSMlfcw2rSpd3+UvHsgs",
+	"gBpM5LZ1YlyN52e2DMoI147M2a/RgxTR0KZBBnbxVSCwBQAAFAEQEgIwKAOQRgMQVAgS9pizilH390MZ//h+dYbCvwmRIQkg9pI+",
+	"ge3eLACmeWgBHGEBfFnzR08Ss6cuQjzvtfxHiZVfH8TgRSRgbgIKTXb22DI0z1M0U1ev39R0PxjnRadBEFKaD5X5fLPjXgAhUx7f",
+	"MoRgKIy2DuMbS0wsDBped9LWn6ZV7ON0RKTwJDj+zglwjAyzmAiZoTBQwDME7RbZ9KKO8WT/hP/Y8f+GUlp9pC01ArCPiiPDK7um",
+	"d6bFKXQk1DMWsKAPtl5gC8yuXOBnnez4cnwWIZ8kf5a+nPcz76AXfDi8EQyywbwxXnji5ejIy7SCrgyjK0BUlcXRFZS7z/4VWl0r",
+	"SG/pNX16yUv4D1Fs07UmLQ7CeVzEpYUAGgymsRoR227u5ZhdjK12FNdL47QfN3WdZJEjey0kUrFIDjUfFzwURXkZTrAFAKAEAFAE",
+	"ATAgA5BaBbCUC1fkmbFWeln+BH9sD/KoAO3KYTI8gngvuaPdxDXBaPLFFW6jQHE331+wjkQPgJlcD8J+sSzxJ4769luJLyFh4GIS",
+	"lDFSiBZ2mwv6DSbPf0sK8kMJPnV+l+g5T5bI+9dSEmeZXSxVBugNPisdnpO0CBqLPi/A6x3Dj6HGL4sVAqFwLBevthzA6LIxjxc8",
+	"BA5owDOEIAq3DmDgs6f6kGHJ/85tujuhhn1RBJ0YW7d39OOMqogDv5rOFQcxAhmoDggtYbPENCeCaJ9GW7agcdl/y7+FMxPnAtj6",
+	"caJIF6YDGH0TiZyp1JmTqhFzFedLVLEmsd1/QSVD/4R5dBD0PEsr3ts15K7z8Da75nE0l+NisMvWePB7N8Lg1CA8N1diHrPVT2N6",
+	"+nPc5opfqdvFd5vBmH4urx3fTS0+jBqCs7ArALAHAYARAQAlAwA7BGBJBwCLNcpxQps1v+jPCw/8T7g2b9OCWC8LwQpV92Y0DyND",
+	"bU5VLjtJajqJ20qwGNXm+VGmPAFb81rO7QrmK8GEKBgVDMVaSgsGqRUGgLoKm41q64DLG1wnCthR75v66EduyJzjNiySnSCbA1fv",
+	"NBax5cLVcaeHJfGnasnIzIF/fTMjaGUxPzRtJPs11IRUum1cELmAwC+DwDDqzMvUoS9uz+TV+wu/zf1SHvWVa6UQbI4R4fPAr0xB",
+	"rJjaQmkIhyhPB74vSEgjxylAucrLORI8J9Jf6a/Ukc+fUZEs0cyGOI6QlhpL5EH34K4Kyyxkj/iGF0ZAtgDHUxXIf8K+rdQkw6GK",
+	"OV4rdN+mP3nh7hcp4WVehn1Y0zTCWq1MtvQ9L8rbS7b4TbFeB0Kmm4JVl+Fj8d3ktF4nJhuC1hhWnWnEjWNBALAIAHAMAZASARAO",
+	"AGALAiDWo3Uso/v9H/Id/8fb6umy7rdjqjRGMRgeJ6+KZYSavaaYrsEVO4Xohw0DGiFNos1bytwvy4DHnTYsv55AkA6QI8sk/m6W",
+	"MMX4JSp8NQZSMQHsGKo+RUxQBdP8bE/TMqs9bjGET5sqylR8NzMbqDJG4SkNRw4LqP5tDUMZpxUZlZxoebO4Q/Z4MGtYyd9jIoQh",
+	"isAnA3wrgWGZ0wrESD+hVzSf+9O861y1eFpDuLFBStRHyHJBmf6LVpO2KDzAJ+n0fBHjjNIhIT0VbmtMkzuDHdf8q7141LESVGNo",
+	"qaJ+yadYKROeTUnouWmUw24boOth8HuucqyHfy74p652ikIRed6fI9wwLwP5bR3C2PQPW2WDXzcMmpuPwNgqRDeW7lj33kJRnwN6",
+	"FzGUO7PJgtxohbmLn32mnA6dmfhiz8yAsAYAEAsAIAYBMDIFEIoEuctfmUL/nv+P7/4EH9CzSn5Cpi5EBkj4PP5kNp/DkuGlHPlA",
+	"spoT7JcwBUrNd5w6N588WbnWC8G9CwMggKIsLEMTnVmlQPo1rsO01atp2BCEBy+Jl0AjVUBPNei7t9ebq+8mEOVnCWL033Wux6VA",
+	"Z2LlIauRRkWLglKVkKdWVATchOx9biAae3bjUsWiIDa3sJGqwAIAAAQgPA/lkpO8aeH9MbKBf8QdLEdIvJFpWDlBdvHS6wNfo7uU",
+	"Gk54CJDoETZWOzBZhf0rMHBm1crWBB6CPc/x7WIAxgaaqG/BHRDNuu1lqxCB2vwzqhMa5cbzGQgfxjRWT73Hp33Tx7nmbQJVU7qo",
+	"4QjeT+uz+RWyHC83a5ll2eWS96ifzCbEref5k14rgFkLk6U1jqRDwdu+yksUQyZ2eqlhNjAlJAUVsAAAUAsB4DUFgIMMIMWXlltE",
+	"J/1P/om/+FB/uBaafWxOtLqNAd17b9EV34Wl7EiaHwBQklHcnrIN8qNGFhpHOfp+nfLDY/ydBithiknGwaAaqVkYWRwrMSkZb4yH",
+	"CBvhZUF0NszxwmvqOD+MfWsMV6CAwINS5FGs35+N3hcABIjRwMcnEqLV8teNWtYddiUwcK6fGwKEfk27kCyqKPA2NgOflsAYgcgR",
+	"oJYGGXStSnKnRb/Ze9XJ/ggC//HxrMVOxCY8PoQb3GC+PZK3QysCoOyBaNqmwgOkY6UCmZbZ1NKVwat8Q6Pu27NYgTwszSQ+PJCZ",
+	"QX2lZGnVmI8OhyrSXpMAwV4kFXGW8N1d0Nd1CSk3iCf2KEScU7nwOmUtHiWEqJSqahyFmss6LJruWjI/R7mA57HEFMjTkLyYa7er",
+	"msEyNLWaCYhgiV+3bSBYsAQB8DQEcHIKEOARGURrjAxf3j/1pf/KO/8bLYf8ek41EoxKBH5C9k+TEGDDjJYl+A/o1T3HcpRdlMxB",
+	"nru8ugOhuazf+2bn5UEuLdBB+T9/swqrAyBovKvc+tIwIASpJja5rtVK5P9lAfs3zLAnYfPxBnbYMF9HxFghRRFkyBvIYvYVIGOa",
+	"rm1vQhce2XK2LDNWPImPP5M1qkEqeMxnZAt/FkjADAFcEoC9BzBNUKlbUge7yX3CPr4P3HkMvtgTEKKIZkht0Js3/ASDjFWoFB3w",
+	"F+D8N4FzgqsEjODjTuvScucHZXwrp7wlfSgSW5sT+eWB8itMrVA80Mv5dhaDahnuHIIiCYDn/tvwPZP1j07Lteti2pxtjNU/jfLX",
+	"eWYpdBGzzV+zzAJE/62935thT7upUX08+Ql5lHTRyHT0MhhjAsaJRRz4LHxJeCdAwBCBEAwgiAWYPAJ6nIoohz3grfA6/DxfcSSy",
+	"+cRIJmPhjCL/LIwubXgG0oVDSNPADAxxrskUEhw9O0jXq/PeP/sdKGD+ofkv4oSC78UUFi0l+QPdlMF083TuXLoMDUHocGDt78se",
+	"e+4wj6p+DZlND5mPc9V4Ir+Q46PTyRVIpqJmYR7GpEs4DFV9b40Xg3Z9TwtRmnlk7V7D7M3E0gyyA3NKofi4MWUAwBCBEAwgiAWY",
+	"PAJ6nIoohz3grfA6/DxfcSSy+cRIJmPhjCL/LIwubXgG0oVDSNPADAxxrskUEhw9O0jXq/PeP/sdKGD+ofkv4oSC78UUFi0l+QPd",
+	"lMF083TuXLoMDUHocGDt78see+4wj6p+DZlND5mPc9V4Ir+Q46PTyRVIpqJmYR7GpEs4DFV9b40Xg3Z9TwtRmnlk7V7D7M3E0gyy",
+	"A3NKofi4MWUAsAUAEAECwCsCYD8DgB8AAD4KURQVzeId4Ge/+cz8dv//7MX1wvH16GY5oUUSva/93NB1+rDGEWm9H9sMnOFWo3Q7",
+	"cew4THn0N6i22QY7dM9HcCaHanZvaQXqQSAoqKhLG9c83nFeG0Y2/jqiJ8Espp2U9q3/hD0lsZRxWiIqOcUgkdRDCIYhiFEMz5VO",
+	"bu06ry1d6XFNmlz3hZuySaRHdxrrClTI8jsHCZ1hyEylokQgsAUAEAECwCsCYD8DgB8AAD4KURQVzeId4Ge/+cz8dv//7MX1wvH1",
+	"6GY5oUUSva/93NB1+rDGEWm9H9sMnOFWo3Q7cew4THn0N6i22QY7dM9HcCaHanZvaQXqQSAoqKhLG9c83nFeG0Y2/jqiJ8Espp2U",
+	"9q3/hD0lsZRxWiIqOcUgkdRDCIYhiFEMz5VObu06ry1d6XFNmlz3hZuySaRHdxrrClTI8jsHCZ1hyEylokQgsAAAUAIAUCIB0CQE",
+	"MD4DEBwBAFEJgirP0aCD1/8ZHwT//+SN9WrkL9eE+siBv3Or8fdkNkCvVKbRC+3WX243GbmlcVcw/Z/gn01gUpxm595C0JiBiVkZ",
+	"idPpjExEZdH7p/RuK703Or15jfvjFQOVNJ1f0HVdK/MvYm3exumPymEAFFmI1dDxUDaq8RHZJfFij2NezCqK9vF3SPPgfV720jUC",
+	"EGdNB45cIAcvIiDAAYAkBgAlASAMwBwBoCmDKCuh+gSdXooILafgU/Cy/+FM6KzYi04oK4ROyvj4+CPHSrPoHoTITmr4koIrzIOq",
+	"Gp36lQ/hgvxwAz9E8D/QbQzIKzKlCeCh5iCIE0hxU45GZ1e4rRWiLgXGCcsPZOhGB0XhXxHk3pT7arqV42ooLTjPoYE1M1aLr4qw",
+	"EO+M1WVHwLVgrfZ7XtuokV11Fh1ioi/nuFo8OuS9PaKDzrCkYHPWcpOAsAAAAAEAEAMCABcBgDUDQCsB4AIDUHIhjDUY6Gr/2se3",
+	"P//Du/B80c+surCOolfdV7SMB9HyfqIpCHeUmlW9G2nUZ+zxBJx9b+U5jGcVuVNkY9q5azAawzmVmKhjyqFOZeF7+ekMyaNLx7xA",
+	"iCdgRfNebgcKp3FKFOZmDmVIsh3iKeiTBqMjlr2HapslLXOvIdRxQu5AXVtHMdDw+1C1xqbQlKblMYBmQMAGgKABYAsAUA/BEA7Q",
+	"yQksZUM7rkH5CaT5xP87v/5Nb5VLn550UcAN7jL2X/MlrwYbp+kBWMxUu02o+Q2LWc2/vcVi0B5P+3PRJ+Bsz37f9OaFdVt/u4U+",
+	"F4bUJ58XN3vtqb4gyVTaGgjPFWGsIotPbz+T8x9+fa1bG6PGsKKFnEdgPHN+szLUyAZJyi1S5Nz6ob8hpN20agP+2xePY9YA3Zdp",
+	"e5Vt0Oqt9L4RlmIGdZjJbAIcsAMAQAAAMAIAcBoBMBoDUDYDkDwCsBQBAta0Yt8iz/l06Lf/3lPmmZq/NdPvBuMLrU8zF/+cFvKw",
+	"J3q5CZ0bGa/c2FtAAXm31j2DMMYBhwNnfENjJ5ROwQzKXJcwpNQs6Gv+79vl9U0CvhvPM8EJAoch7yNhybmm8NuNhi1ENAVsncYl",
+	"Il5Gary5kfVnskxy4/dctCGQTKYZRORyunUxyCBKwFxnIQmAwAAAyAqgbAYYRwMCIIFCjHh8cWFX8LNOCn/53v9z9/1R3Mm4a8ws",
+	"FureSE/Fp4V+bIfYDegxtycgArARpieUxHdaDFHtY/FrSBA0Dw/dzeNUkOISwi8KFgsx2QQuiSDU3D2Skgq0S9AXgb/F3H08y63s",
+	"g/KueeEOht/dYLKJROiX+jRvmPF7UxpHhiC9MutNTxAjhmj6O5a9ZDHc8FgWUYwvaf0uJy7TrU55nMTznWkHeJ3cPnlQPbAJAKAA",
+	"AAADAAAAAUAVAaA3BGBXB0CJCiChVkowKYVxf9CN/T/5lHHy3adbMDsakf2/XvGzrHrdt9CvIrOK+mmXGbLh/XOKiUO9+Lalq0Ue",
+	"SMKUHH+6XTw7BynsZJ/pUqr/3f4yJ4Qq7SbeUZtAYRzpB8T19ttLzwrcpi8sw9JOOE2TlMghRQyDS8CQCZMhogWVFdFwDwWBNQAK",
+	"Zn8Lj1LYUNZLo6mgAMAWAPQIwG8DAA/AKAWAc4Y4GFjlIJoPn/rlc63//CuSMni/QP7KyhPavyB/ggzaFVEaMP9zmEikGSrxkQzR",
+	"Cb8Yqxbul6w4scrAhA9TQ5KZ8ansDV91QhfCahrUcK6Tme9Kp6yykWOSWGPoTpYrh07Wz5x3DZWmsieGORqFzSAhQn1rHOkynWFW",
+	"OIAQrHoko6Mhw9l02A2jTFbG97GL9nVOlvc8bhGZZEOazlaJxbRBy65Cex7BAPCQsAUAAAYAAAAAUAAAoAEAIAMA8BwC8GAIsMwG",
+	"WTNCYKA+DL+en/QY/1wES+SLD5DoJFPz27Z/viBnQ4XFB6tVQqNpl22ClZ8Uiz4A5jp6kJCJvhXo3G7l02hnOg4hCEuNCCx0i6aQ",
+	"POQ2u9kIiJORCocyvul6xrV4KxpFDnGzCLz4ixEuMnJgDMxkdvExEnd6rWR93VdFYARA4cQLwc7haMQ4KAyCiulAwB0BjA5AuwgQ",
+	"UMMgHNEICf2NmO+doaQ//szfT6f/J6bKHYrrpBMloGIZ2IPCk0pUY0IbDJ3iyH4vNXYFVIVXZSXhseC3o/P4/AfAdMo+cUFWTjCd",
+	"dJCYLceZrD0GRqtcylNOJaAiRbnKj9rGqL7qJXfPVY3xZqzhLZkEW3Uo9MijSd42+nKaoRNEGfW7AlJN4QvquphGqU4x3O6y7OsO",
+	"Nst5fAbptlas/R03KOESCF5LHRq0SKSzsLAAABACAAAAADAAAEAOANAQAnA2BTCACRDKDxcOliJtcTf+tD3av/F2kack2hKR8beC",
+	"nlHz/7Dwp0qYqDvArNSzFMui14J/tVIyuPRE3SrHNJeLbf5eSATxbG4cwuRBCYyX1ELaspz1wrvieJfl12MZsIZrhef/N+E+CfAi",
+	"BZeLFuGNU+uoCsZr5+3yWTrqfwPaf343oeQGXAQGJk7uPknzoEdPK1mgwBoBVAxAqQdgTkNIH9EzDGX0GM0bQdc3/uI/y7n/Wlcf",
+	"7kA1fwZWgzE48Sbog7Ipw4b/I0XRQ8hEdXLRcQgHQi7BReo/njeYnoM4udC+aNU2vzBNVwwoloQCbHAR/YSkE/J8ygDBeapaPjop",
+	"sHQA98h55L2BOouAHAEXK43CEQEcco0amrYp4vIWaVbAVIOgZvseukmyRp322Y0DYrUG4/up7eNglmo8rGMm2CDUPC3E+oSg7wew",
+	"AAAQAgAAAAAQAQBADACwDAIQNAUwfgjw1A/34JfyEHdJ/lh/LE/7YAx3OjgQnWGjjw50c/+NbG6aIS+vhpiVVzWDm4xDfwyCqjd6",
+	"5bouW24tO6JHohDwS+eIJi7TUZWUiBLzxKSK4XPW854Az5IiYEwQQcN0jtG65634mlqUMBWsAVqawWOS+vweyYbthfueoTZRytjW",
+	"joyJgEGLVdTPIaRRQrEgwBkBNArAkQXAN0IgElCeBhUb2PUhHNiX/oo+ig/87hVT7nctMMUjPy+efN3p8v1DKIEwQNp4jCF7T/R7",
+	"2cS30Bt4vPdv9qRdqIl0cfwH8EXy+S3hlxyooYp8B4rzP7TwFWt4SvAiNp6R2UnkLeCG7L26SMhc0baZB1Q4TkdgkYLYNwWIrEwo",
+	"hmXFaJNkqSYKH0PWTXGqAn6bY4dqmJFFv2VtsGgSav8rS71p0mfcDfx6FLRezrAFACAEAAAAADAFAUAJAIAZAWAPAEAUAXA+DEoV",
+	"RcE/f4WPKv/8p78Sren2jyhBCCA4LfJBn6P3McrFmZnh5bDK7tt2Ao6qtrlJ4b0ZPiP+cZokI98PIJM9RKBxWxJCV3EWiB7No9rQ",
+	"llPgU+Y0ZzmnZVCtmznm+2wLUTMKZiwNbA0KRPVZvM65Xh41vySvvftZGX01vE8AHrjahiKbKL5UY4MCLTYIwBAAdAHAIQCQBACC",
+	"CaCChkAeNjlVWMS/4D/R2/+R83h3bGqX05SV1fTJ58yuCFphBMaXuLmkkAPNbOONSc7SeK5hFF+yWPtSgvh9bndrYEdKlgknk7gY",
+	"RaBkCQHFy5zxNntWiGATZN4obGxyTFJZX5pkW3OJtKVAKkKCkDDpvIj9xq73Zh6NCHCalAjQlZiPFdRrcUuA1acVCMAyqENeW1NU",
+	"wKsAmk4qgaxYAKh2MLXo4BM4sAcAgAAAAAcAIAYAgAkAIBUCoEsHYJkOQPWLlVaKi+cb+7X/ae/6wlOXtfkdpnGTnX8QfOTmumEm",
+	"aqy/Cq9FJvSL4zDDLeYCo435NoG19P1dMF60qYaLFLoBEUs5PvxJCBccuouTF/oOwUJfBaA9BXAFodX985BS2DELP7qwxITOXiVU",
+	"JNSrVAK9Tp/Da/G+dgH9PB1PnZHVPaDMgG2YYOZrKWdFMotkwAKAyAfgPAM4IoFWDQBwg/gop6a/AeBb2f+Cv6Ez/gko9PfsjPj6",
+	"DONN/l0cvXGqNXFCob2hoRpS7H6yfbYs/FHIAue3fn6AqHJ9q7+R/FHk16FR05GTyEAfijAI+17LEFLbx/eREYzzLXJByPw6zTwC",
+	"bdBawsiFEcIRAbX6lRbJN4mOQqCZxBYZbJTEfTwqi6a80abENdm6dfq0XR2zwN4w6GL+LzVqy58Q5TGyaMMhiLAAAAAAAFABAIAO",
+	"ATAQArBCBhCICtD0EtgxYFCj3xuf8P/+KV/8aiYj5jJO64h3Z0PGl26Uep2I3VeP7bYYP56zfbAsJA1oRPZvgqB7T44teckYTJnB",
+	"JqDkKHUdstbMTafmzL8dTAH1P9HwD5AsOGQXZMgfC+zlu5WrHY7lVEiU4rSXV4rBwB8Cm2tzKbishEeVkcBsAEOOXHyLoQ5kQFRb",
+	"GJefOwA5+XDAA4A4AwApAUAVQQAK0HgE1DLCH2UVkobC8GP9IP9uZ++0zSOYdQeFyGEK0nTp0K8qEYyWni5JqibQXW/dL5aW10zy",
+	"ek30B4jgOhxD+VvvKbveypVnN4F6SA2UnF46jPClNalpylUY94Xyh0IgA+Mr13mAsXW9M0WKhaJCL3yHD7leZycyoCfROTJ/FSmb",
+	"tKLufj0/kssp4vFuua4Ynm9qxznJQGF0cecxjoEtjT9xcLAAAAAHAEAEAQAXAWAxBKBtCeDNEUFfinZaypX4Mf+jT/n4f/VUy9/S",
+	"tEoXcWZUf62e07A+Vwnqiqf81MHkm+dn3yVeGOLDK5V8zWPNueuUp1m8VMVK6MxDhlHLJGuVaDLtnFN3qj/x/xnfqxRO/YoEBuT9",
+	"TruKduRoSQUCTEJisMONyVeny4UwNpmMpp6+T9XY7zeAqEyWRQx5/HqUWCok+DhzEgHSjSLABoAgAYAMAOgGgHYGAEiDUCMhfg+b",
+	"RKjuHQeHV9P/+C4/AQZpvGXoqikCidWfne4+mIsIMKxRnU/92o9X0/Ur5AX9r/j1RXVXZE3yOjD4/8dZxYCG1u1bJPjWV8/2sgQC",
+	"aTxXNFl4kG/bNoriSOBGEXXm2N7GshsSsuIEQUGqMcJPT8zmyJGUwDwR1KOW0nTMOH9CD8tjFOzqS3AYorU4M3eapFP3MmMWIHAx",
+	"aDhgsAAAcAQAYBABcBQDMFIHkLIO0UQaOaxreIHfybf9XX/0yv/qRdovz6VzFfH24Fvlx6VNYhGSKPKJf6mVujV94vtZROfuakm8",
+	"a942xK+WfHeqsuhGg9tsjzDN86pyzknwB0vY6gU+J/pfkrpZu8cKnQaY+C+f1bwjEoJBI1WlmUjyDz/bQrJLQ0ETOtsfjuWjr/s1",
+	"vLZgNk401bSRJjWw8dwEFQ5ObTVwBWCOCrAAAHAEAGAQAXAUAzBSB5CyDtFEGjmsa3iB38m3/V1/9Mr/6kXaL8+lcxXx9uBb5cel",
+	"TWIRkijyiX+plbo1feL7WUTn7mpJvGveNsSvlnx3qrLoRoPbbI8wzfOqcs5J8AdL2OoFPif6X5K6WbvHCp0GmPgvn9W8IxKCQSNV",
+	"pZlI8g8/20KyS0NBEzrbH47lo6/7Nby2YDZONNW0kSY1sPHcBBUOTm01cAVgjgrADwCcBUBLAoAQwGQAYCKCIELTOytwSZ9jfjQ/",
+	"83BhsNpWordbLN2RcRfobRwrgI78ahaSQhwvSfW7T6iHMuDpyr335vfjoUSf6v5n400CzYtlgNeq4ggiYf2B+8N+QglM1E77Rv3z",
+	"9YdFrnC04437z8vF/ybxTxPc/aPpyAwl93X2QJdYAQ33GRHDsQcV0Gg4V1ybRGykMYqUcWdjs4SyR4AqcZEKVjikx32ZwLZMCMzA",
+	"DwCcBUBLAoAQwGQAYCKCIELTOytwSZ9jfjQ/83BhsNpWordbLN2RcRfobRwrgI78ahaSQhwvSfW7T6iHMuDpyr335vfjoUSf6v5n",
+	"400CzYtlgNeq4ggiYf2B+8N+QglM1E77Rv3z9YdFrnC04437z8vF/ybxTxPc/aPpyAwl93X2QJdYAQ33GRHDsQcV0Gg4V1ybRGyk",
+	"MYqUcWdjs4SyR4AqcZEKVjikx32ZwLZMCMywCQLAKwKgRQUgVwWgNQDgEDNM5iCkej/8QnJz//8erubfQRxJaPDUsFPFb9ddOOhs",
+	"44xrIUt+TUTlB1oxI4qkihLK8vco5lIkv+u+bM56cYwY8V+mhCAFTqZy4u0NYS/dBBGdi65O4kSQssQNQOn4X3beNzcQQPkd6cFY",
+	"uCkLwmKmQSmSiyCiy+Yyg3vormerw323cO+NB7DZSDvwPS06a0F37tdrOGVJUMCrpJbABwAUAeABAXAcwcgV0PoFXnvoMxet8CL8",
+	"av/gzPGDbyFWzAcLpYyVgztB0BcF0a4IJqjpHwiwoynBzHTeHki1i3/GnMPkQBASzh558H4NYTZabraPV0XU0XGo/wlmyEsWILY3",
+	"5y0KjMwIzpQRtFkC7F0iSObMSYtmXgjJAQGabrtOv4lDYOzC6wEuIiJQpe04/ZuGRxdmYrFq9UGPe8FEXqPEdXgpA1JUmUlaBMDX",
+	"aS8OsA0AoBwCkDAFEHIJcMgOkRYUGAZgMNFbZv/ycfGc//3ZjDPkfy15FUIMy/dX7s4KUvorBXGixPu9drcjzIh1urAhW6z8l4cm",
+	"In0VdxbksTYDKrcKSzLIInauH5afM2V5GNsMMbhL+mNbI4qTQfVaKZ759yHirVUn3HBnDmskhVbzUy6FLvUaDEIjW7CvkN5w+7wH",
+	"hN8poTlpaLoXidfdrKgjMj02CxgwqSByY4DAB4D4EWDOCGhXgzIeoTCz0rioXiyv/yL+5W/0zk3PcCtOgjVTycxxsd9jBRLFhLY0",
+	"CaaQrIaCy05iRw+pocst4C/c3H6oA+pFzr9pzZzI1A7TauTkW10YYCDo/gmscPIyT/5Kh9ZKChZm7lEg0DpnVI8zVHx1C81Sc/ia",
+	"xSu7VCFEMnnfU4Nh6ui8p5tiUVZa0bDeTVy/J8VBBjGm1WhoeXSpwDD7k1NrwMZrxSUqckYf3LUosAcAMCABkBgCsDADECIAQCEF",
+	"AcjC6gsLA/9UHiZ//7K31oPgZ8HGE0PWrDNR8l+M7CUZCZ5U0n9NrMaseYnPDieO0YMt+WM7RiDMVs99f5F2E4lVcdq0xkN2ixZT",
+	"zpm6oBh8UsRrMbi29dhWjYmKlbr3KfQp9243rxOeluep4d8Jk5JA2EYdO4VE51YZ7rYYnfvuq2QaJgFyh4Aze7qwMlDBypFxdA1o",
+	"4g/TgMADgJANILIH+FqDvichfsS5VsQl3Mc/1cvzw38PFloY890sZXnfT4OkdlR4ug5IO5MyTiRh4zsY0nq8w/lXHQ5/lD5T5JAj",
+	"BQkPin5LwG3O5Cc+NLAyn+b0GHpzLniKMvlCxz27QqOkDrOnGyoNsv7rqGnrAZIkvpnFVhLYrWXWZxbVsLvKqLlCWjsDVPKMI98U",
+	"QgDrGIljaOkQnaJlcxw9RgFxHV6wyZswyaHx6jLKkRP1LIZDsAcAQCACcCgEMFgG0HwHsIgI1HbFGfqwUf/WLhff/8m7Ly+rHZdn",
+	"7J/pa5FPiGlryTg/mtY3k/HafnNL6JaKdE0cUzM3w7cE7gOAnkTwjKDmRVwuMuKHPiCcQivwPYELmjWtKIafAsSdnSIlmsGh4k6n",
+	"4XyCqMCE2nUxzppoWlMiBMMlWGXCLSS2QC3tvBC869utJSPSsY4RIGujqWKSWXEzo6GUEyJluPiAwASA0A8gqgaYQQJCFEDEosrB",
+	"aGeoV/6L+q6/0vClXJ/p3i0ktSl9uq8Na1WXxE0wLEu8kgH8IQp8ooJef8HCc8Ifra9jeGbCLuj8ATS5CaCaicvlgnWhyFNrg/C8",
+	"d4BN9OfXM6XAgS4y6Uow2wvjnB6ewMVXnTFlDc6OIVQ/Wq5aEhCmr32poMigLHeB3wNc3CzF9nkdCzSaB992eew7LpREeR2epc82",
+	"4k4Loa5qluT91xPAB4CYAqAIAHgBADADsDoC9CUAnYOBosDX8x/wFP8Md29WxjpZWUgYpPmqZx3bUlfYUARzk4IFaTW1e/N70O0v",
+	"YNmsl+feHYwhtDTefumW/Iq1AjaNVWeskJUAXMmH6kqueqhBnHilC9VWMRp+ihIrEb7B5BiLPkr2HUnEj4GywTZNFhnbIiAs5wmn",
+	"JSbWBsDoYbkNoFsRqzMUE/sbVaarIpSpFxk8IPwdipwmMMAMAIQEAEUDoCzCIBdQ/Ql2Cml7E5nW4/TB/fLfXJaLufReuAS4hVW/",
+	"lvYpWDSMRJZTfEnsHQMGT8gvSy+eJ9ZpU+xvf+kAXEZPvzDytza42MRi5wUHMN2KL2hNAzXEA/jWivp2KD6UE+3fkGzXXVeO9tIv",
+	"KgrsOvevBBZvx57frKBTsER+k129YQEgR08lwN+1Z+I5K2wrGnqC0mit8YvRpVaaVTx8GY3WXrSIsNsLCMAHABQAYAEAyBEA7gxg",
+	"kIZ4NDB8Qmg9DxDPiO/103qENmPQmu4gmjgdY/kyX3rt4ogmrMVRVgQiczPzE9utO3pjBib5P6yqUK7zam+ObI8cMoAcySwSOFFI",
+	"TGTOWBacpmM8MD12vce+HQDcvgmqTvK8j8fwXkEs66mfFseAr1GNHrIohgzY34ObyAiUmaRvClPmtYDw8+01Wemd/paGs4SYwN+D",
+	"xWGKsbW9IzFRGMAHABQAYAEAyBEA7gxgkIZ4NDB8Qmg9DxDPiO/103qENmPQmu4gmjgdY/kyX3rt4ogmrMVRVgQiczPzE9utO3pj",
+	"Bib5P6yqUK7zam+ObI8cMoAcySwSOFFITGTOWBacpmM8MD12vce+HQDcvgmqTvK8j8fwXkEs66mfFseAr1GNHrIohgzY34ObyAiU",
+	"maRvClPmtYDw8+01Wemd/paGs4SYwN+DxWGKsbW9IzFRGLAIAlBQCBDMEbGMF7wVsmycx+mr/5Nf/gbf+Bh4t+K7jAG94stEHw3b",
+	"ptOJeJxtnrC6USfEXmcOlr+KJtQT9c8W+kEjGV2/8o9XZwcTNOKuTGYA/3Qhg/OFNVSzDZ8hV1FjfWyTEKzdw7osFDCZc8h27ALj",
+	"VUdmYSYZjKLzYpoczgBd14DQmFoaf+mZNfbvnnIJTd4BTI0DTvf8nC16MLiW7gMiukAUZXBwaoS49qL6IrAIAlBQCBDMEbGMF7wV",
+	"smycx+mr/5Nf/gbf+Bh4t+K7jAG94stEHw3bptOJeJxtnrC6USfEXmcOlr+KJtQT9c8W+kEjGV2/8o9XZwcTNOKuTGYA/3Qhg/OF",
+	"NVSzDZ8hV1FjfWyTEKzdw7osFDCZc8h27ALjVUdmYSYZjKLzYpoczgBd14DQmFoaf+mZNfbvnnIJTd4BTI0DTvf8nC16MLiW7gMi",
+	"ukAUZXBwaoS49qL6Ig==",
+	0
+};
+
+static ByteArray ugen_HRTFDecodeBase64(const char* const* lines) throw()
+{
+	int numChars = 0;
+	for(int i = 0; lines[i] != 0; i++)
+		for(const char* c = lines[i]; *c != 0 && *c != '='; c++)
+			numChars++;
+	
+	ByteArray bytes = ByteArray::withSize(numChars * 6 / 8);
+	unsigned char* output = bytes.getArray();
+	int numBytes = 0;
+	unsigned int bits = 0;
+	int numBits = 0;
+	
+	for(int i = 0; lines[i] != 0; i++)
+	{
+		for(const char* c = lines[i]; *c != 0; c++)
+		{
+			unsigned int value;
+			
+			if(*c >= 'A' && *c <= 'Z')		value = *c - 'A';
+			else if(*c >= 'a' && *c <= 'z')	value = *c - 'a' + 26;
+			else if(*c >= '0' && *c <= '9')	value = *c - '0' + 52;
+			else if(*c == '+')				value = 62;
+			else if(*c == '/')				value = 63;
+			else continue;					// padding
+			
+			bits = (bits << 6) | value;
+			numBits += 6;
+			
+			if(numBits >= 8)
+			{
+				numBits -= 8;
+				output[numBytes++] = (unsigned char)(bits >> numBits);
+			}
+		}
+	}
+	
+	ugen_assert(numBytes == bytes.length());
+	return bytes;
+}
 
-static const short ugen_H90e000a1c[] = { 
-	4, -15, 25, -40, 62, -80, 118, -72, 2019, 4377, 5861, -902, -11452, -1185, 9079, 4799, 
-	2576, 4816, 4370, 2143, 574, -3633, -5592, -3943, -3190, -4100, -3271, -1130, -481, 513, 1268, 2171, 
-	1955, 1146, 1255, 989, -221, -779, 133, 459, 256, -480, -1586, -2273, -1905, -1099, -431, -1, 
-	354, 546, 418, 650, 930, 677, 144, -283, -373, -346, -97, -140, -815, -1127, -689, -357, 
-	-271, 104, 74, -124, -119, -95, -274, -591, -606, -360, -363, -646, -562, -76, 189, 91, 
-	41, 0, -122, -221, -169, -54, 58, 52, -194, -452, -386, -119, 22, -106, -439, -606, 
-	-423, -73, 135, 50, -74, -10, 92, 169, 172, 78, -114, -262, -268, -221, -145, -99, 
-	-137, -197, -198, -117, 5, 69, 28, -58, -126, -123, -19, 68, 37, -68, -131, -140
-};
+static inline unsigned int ugen_HRTFReadUInt32(const unsigned char* bytes) throw()
+{
+	return (unsigned int)bytes[0] | ((unsigned int)bytes[1] << 8) | ((unsigned int)bytes[2] << 16) | ((unsigned int)bytes[3] << 24);
+}
 
-HRTF::HRTF() throw()
+static inline int ugen_HRTFReadInt16(const unsigned char* bytes) throw()
 {
-	addResponse("H-10e000a", ugen_H_10e000a0c, ugen_H_10e000a1c);
-	addResponse("H-10e005a", ugen_H_10e005a0c, ugen_H_10e005a1c);
-	addResponse("H-10e010a", ugen_H_10e010a0c, ugen_H_10e010a1c);
-	addResponse("H-10e015a", ugen_H_10e015a0c, ugen_H_10e015a1c);
-	addResponse("H-10e020a", ugen_H_10e020a0c, ugen_H_10e020a1c);
-	addResponse("H-10e025a", ugen_H_10e025a0c, ugen_H_10e025a1c);
-	addResponse("H-10e030a", ugen_H_10e030a0c, ugen_H_10e030a1c);
-	addResponse("H-10e035a", ugen_H_10e035a0c, ugen_H_10e035a1c);
-	addResponse("H-10e040a", ugen_H_10e040a0c, ugen_H_10e040a1c);
-	addResponse("H-10e045a", ugen_H_10e045a0c, ugen_H_10e045a1c);
-	addResponse("H-10e050a", ugen_H_10e050a0c, ugen_H_10e050a1c);
-	addResponse("H-10e055a", ugen_H_10e055a0c, ugen_H_10e055a1c);
-	addResponse("H-10e060a", ugen_H_10e060a0c, ugen_H_10e060a1c);
-	addResponse("H-10e065a", ugen_H_10e065a0c, ugen_H_10e065a1c);
-	addResponse("H-10e070a", ugen_H_10e070a0c, ugen_H_10e070a1c);
-	addResponse("H-10e075a", ugen_H_10e075a0c, ugen_H_10e075a1c);
-	addResponse("H-10e080a", ugen_H_10e080a0c, ugen_H_10e080a1c);
-	addResponse("H-10e085a", ugen_H_10e085a0c, ugen_H_10e085a1c);
-	addResponse("H-10e090a", ugen_H_10e090a0c, ugen_H_10e090a1c);
-	addResponse("H-10e095a", ugen_H_10e095a0c, ugen_H_10e095a1c);
-	addResponse("H-10e100a", ugen_H_10e100a0c, ugen_H_10e100a1c);
-	addResponse("H-10e105a", ugen_H_10e105a0c, ugen_H_10e105a1c);
-	addResponse("H-10e110a", ugen_H_10e110a0c, ugen_H_10e110a1c);
-	addResponse("H-10e115a", ugen_H_10e115a0c, ugen_H_10e115a1c);
-	addResponse("H-10e120a", ugen_H_10e120a0c, ugen_H_10e120a1c);
-	addResponse("H-10e125a", ugen_H_10e125a0c, ugen_H_10e125a1c);
-	addResponse("H-10e130a", ugen_H_10e130a0c, ugen_H_10e130a1c);
-	addResponse("H-10e135a", ugen_H_10e135a0c, ugen_H_10e135a1c);
-	addResponse("H-10e140a", ugen_H_10e140a0c, ugen_H_10e140a1c);
-	addResponse("H-10e145a", ugen_H_10e145a0c, ugen_H_10e145a1c);
-	addResponse("H-10e150a", ugen_H_10e150a0c, ugen_H_10e150a1c);
-	addResponse("H-10e155a", ugen_H_10e155a0c, ugen_H_10e155a1c);
-	addResponse("H-10e160a", ugen_H_10e160a0c, ugen_H_10e160a1c);
-	addResponse("H-10e165a", ugen_H_10e165a0c, ugen_H_10e165a1c);
-	addResponse("H-10e170a", ugen_H_10e170a0c, ugen_H_10e170a1c);
-	addResponse("H-10e175a", ugen_H_10e175a0c, ugen_H_10e175a1c);
-	addResponse("H-10e180a", ugen_H_10e180a0c, ugen_H_10e180a1c);
-	addResponse("H-20e000a", ugen_H_20e000a0c, ugen_H_20e000a1c);
-	addResponse("H-20e005a", ugen_H_20e005a0c, ugen_H_20e005a1c);
-	addResponse("H-20e010a", ugen_H_20e010a0c, ugen_H_20e010a1c);
-	addResponse("H-20e015a", ugen_H_20e015a0c, ugen_H_20e015a1c);
-	addResponse("H-20e020a", ugen_H_20e020a0c, ugen_H_20e020a1c);
-	addResponse("H-20e025a", ugen_H_20e025a0c, ugen_H_20e025a1c);
-	addResponse("H-20e030a", ugen_H_20e030a0c, ugen_H_20e030a1c);
-	addResponse("H-20e035a", ugen_H_20e035a0c, ugen_H_20e035a1c);
-	addResponse("H-20e040a", ugen_H_20e040a0c, ugen_H_20e040a1c);
-	addResponse("H-20e045a", ugen_H_20e045a0c, ugen_H_20e045a1c);
-	addResponse("H-20e050a", ugen_H_20e050a0c, ugen_H_20e050a1c);
-	addResponse("H-20e055a", ugen_H_20e055a0c, ugen_H_20e055a1c);
-	addResponse("H-20e060a", ugen_H_20e060a0c, ugen_H_20e060a1c);
-	addResponse("H-20e065a", ugen_H_20e065a0c, ugen_H_20e065a1c);
-	addResponse("H-20e070a", ugen_H_20e070a0c, ugen_H_20e070a1c);
-	addResponse("H-20e075a", ugen_H_20e075a0c, ugen_H_20e075a1c);
-	addResponse("H-20e080a", ugen_H_20e080a0c, ugen_H_20e080a1c);
-	addResponse("H-20e085a", ugen_H_20e085a0c, ugen_H_20e085a1c);
-	addResponse("H-20e090a", ugen_H_20e090a0c, ugen_H_20e090a1c);
-	addResponse("H-20e095a", ugen_H_20e095a0c, ugen_H_20e095a1c);
-	addResponse("H-20e100a", ugen_H_20e100a0c, ugen_H_20e100a1c);
-	addResponse("H-20e105a", ugen_H_20e105a0c, ugen_H_20e105a1c);
-	addResponse("H-20e110a", ugen_H_20e110a0c, ugen_H_20e110a1c);
-	addResponse("H-20e115a", ugen_H_20e115a0c, ugen_H_20e115a1c);
-	addResponse("H-20e120a", ugen_H_20e120a0c, ugen_H_20e120a1c);
-	addResponse("H-20e125a", ugen_H_20e125a0c, ugen_H_20e125a1c);
-	addResponse("H-20e130a", ugen_H_20e130a0c, ugen_H_20e130a1c);
-	addResponse("H-20e135a", ugen_H_20e135a0c, ugen_H_20e135a1c);
-	addResponse("H-20e140a", ugen_H_20e140a0c, ugen_H_20e140a1c);
-	addResponse("H-20e145a", ugen_H_20e145a0c, ugen_H_20e145a1c);
-	addResponse("H-20e150a", ugen_H_20e150a0c, ugen_H_20e150a1c);
-	addResponse("H-20e155a", ugen_H_20e155a0c, ugen_H_20e155a1c);
-	addResponse("H-20e160a", ugen_H_20e160a0c, ugen_H_20e160a1c);
-	addResponse("H-20e165a", ugen_H_20e165a0c, ugen_H_20e165a1c);
-	addResponse("H-20e170a", ugen_H_20e170a0c, ugen_H_20e170a1c);
-	addResponse("H-20e175a", ugen_H_20e175a0c, ugen_H_20e175a1c);
-	addResponse("H-20e180a", ugen_H_20e180a0c, ugen_H_20e180a1c);
-	addResponse("H-30e000a", ugen_H_30e000a0c, ugen_H_30e000a1c);
-	addResponse("H-30e006a", ugen_H_30e006a0c, ugen_H_30e006a1c);
-	addResponse("H-30e012a", ugen_H_30e012a0c, ugen_H_30e012a1c);
-	addResponse("H-30e018a", ugen_H_30e018a0c, ugen_H_30e018a1c);
-	addResponse("H-30e024a", ugen_H_30e024a0c, ugen_H_30e024a1c);
-	addResponse("H-30e030a", ugen_H_30e030a0c, ugen_H_30e030a1c);
-	addResponse("H-30e036a", ugen_H_30e036a0c, ugen_H_30e036a1c);
-	addResponse("H-30e042a", ugen_H_30e042a0c, ugen_H_30e042a1c);
-	addResponse("H-30e048a", ugen_H_30e048a0c, ugen_H_30e048a1c);
-	addResponse("H-30e054a", ugen_H_30e054a0c, ugen_H_30e054a1c);
-	addResponse("H-30e060a", ugen_H_30e060a0c, ugen_H_30e060a1c);
-	addResponse("H-30e066a", ugen_H_30e066a0c, ugen_H_30e066a1c);
-	addResponse("H-30e072a", ugen_H_30e072a0c, ugen_H_30e072a1c);
-	addResponse("H-30e078a", ugen_H_30e078a0c, ugen_H_30e078a1c);
-	addResponse("H-30e084a", ugen_H_30e084a0c, ugen_H_30e084a1c);
-	addResponse("H-30e090a", ugen_H_30e090a0c, ugen_H_30e090a1c);
-	addResponse("H-30e096a", ugen_H_30e096a0c, ugen_H_30e096a1c);
-	addResponse("H-30e102a", ugen_H_30e102a0c, ugen_H_30e102a1c);
-	addResponse("H-30e108a", ugen_H_30e108a0c, ugen_H_30e108a1c);
-	addResponse("H-30e114a", ugen_H_30e114a0c, ugen_H_30e114a1c);
-	addResponse("H-30e120a", ugen_H_30e120a0c, ugen_H_30e120a1c);
-	addResponse("H-30e126a", ugen_H_30e126a0c, ugen_H_30e126a1c);
-	addResponse("H-30e132a", ugen_H_30e132a0c, ugen_H_30e132a1c);
-	addResponse("H-30e138a", ugen_H_30e138a0c, ugen_H_30e138a1c);
-	addResponse("H-30e144a", ugen_H_30e144a0c, ugen_H_30e144a1c);
-	addResponse("H-30e150a", ugen_H_30e150a0c, ugen_H_30e150a1c);
-	addResponse("H-30e156a", ugen_H_30e156a0c, ugen_H_30e156a1c);
-	addResponse("H-30e162a", ugen_H_30e162a0c, ugen_H_30e162a1c);
-	addResponse("H-30e168a", ugen_H_30e168a0c, ugen_H_30e168a1c);
-	addResponse("H-30e174a", ugen_H_30e174a0c, ugen_H_30e174a1c);
-	addResponse("H-30e180a", ugen_H_30e180a0c, ugen_H_30e180a1c);
-	addResponse("H-40e000a", ugen_H_40e000a0c, ugen_H_40e000a1c);
-	addResponse("H-40e006a", ugen_H_40e006a0c, ugen_H_40e006a1c);
-	addResponse("H-40e013a", ugen_H_40e013a0c, ugen_H_40e013a1c);
-	addResponse("H-40e019a", ugen_H_40e019a0c, ugen_H_40e019a1c);
-	addResponse("H-40e026a", ugen_H_40e026a0c, ugen_H_40e026a1c);
-	addResponse("H-40e032a", ugen_H_40e032a0c, ugen_H_40e032a1c);
-	addResponse("H-40e039a", ugen_H_40e039a0c, ugen_H_40e039a1c);
-	addResponse("H-40e045a", ugen_H_40e045a0c, ugen_H_40e045a1c);
-	addResponse("H-40e051a", ugen_H_40e051a0c, ugen_H_40e051a1c);
-	addResponse("H-40e058a", ugen_H_40e058a0c, ugen_H_40e058a1c);
-	addResponse("H-40e064a", ugen_H_40e064a0c, ugen_H_40e064a1c);
-	addResponse("H-40e071a", ugen_H_40e071a0c, ugen_H_40e071a1c);
-	addResponse("H-40e077a", ugen_H_40e077a0c, ugen_H_40e077a1c);
-	addResponse("H-40e084a", ugen_H_40e084a0c, ugen_H_40e084a1c);
-	addResponse("H-40e090a", ugen_H_40e090a0c, ugen_H_40e090a1c);
-	addResponse("H-40e096a", ugen_H_40e096a0c, ugen_H_40e096a1c);
-	addResponse("H-40e103a", ugen_H_40e103a0c, ugen_H_40e103a1c);
-	addResponse("H-40e109a", ugen_H_40e109a0c, ugen_H_40e109a1c);
-	addResponse("H-40e116a", ugen_H_40e116a0c, ugen_H_40e116a1c);
-	addResponse("H-40e122a", ugen_H_40e122a0c, ugen_H_40e122a1c);
-	addResponse("H-40e129a", ugen_H_40e129a0c, ugen_H_40e129a1c);
-	addResponse("H-40e135a", ugen_H_40e135a0c, ugen_H_40e135a1c);
-	addResponse("H-40e141a", ugen_H_40e141a0c, ugen_H_40e141a1c);
-	addResponse("H-40e148a", ugen_H_40e148a0c, ugen_H_40e148a1c);
-	addResponse("H-40e154a", ugen_H_40e154a0c, ugen_H_40e154a1c);
-	addResponse("H-40e161a", ugen_H_40e161a0c, ugen_H_40e161a1c);
-	addResponse("H-40e167a", ugen_H_40e167a0c, ugen_H_40e167a1c);
-	addResponse("H-40e174a", ugen_H_40e174a0c, ugen_H_40e174a1c);
-	addResponse("H-40e180a", ugen_H_40e180a0c, ugen_H_40e180a1c);
-	addResponse("H0e000a", ugen_H0e000a0c, ugen_H0e000a1c);
-	addResponse("H0e005a", ugen_H0e005a0c, ugen_H0e005a1c);
-	addResponse("H0e010a", ugen_H0e010a0c, ugen_H0e010a1c);
-	addResponse("H0e015a", ugen_H0e015a0c, ugen_H0e015a1c);
-	addResponse("H0e020a", ugen_H0e020a0c, ugen_H0e020a1c);
-	addResponse("H0e025a", ugen_H0e025a0c, ugen_H0e025a1c);
-	addResponse("H0e030a", ugen_H0e030a0c, ugen_H0e030a1c);
-	addResponse("H0e035a", ugen_H0e035a0c, ugen_H0e035a1c);
-	addResponse("H0e040a", ugen_H0e040a0c, ugen_H0e040a1c);
-	addResponse("H0e045a", ugen_H0e045a0c, ugen_H0e045a1c);
-	addResponse("H0e050a", ugen_H0e050a0c, ugen_H0e050a1c);
-	addResponse("H0e055a", ugen_H0e055a0c, ugen_H0e055a1c);
-	addResponse("H0e060a", ugen_H0e060a0c, ugen_H0e060a1c);
-	addResponse("H0e065a", ugen_H0e065a0c, ugen_H0e065a1c);
-	addResponse("H0e070a", ugen_H0e070a0c, ugen_H0e070a1c);
-	addResponse("H0e075a", ugen_H0e075a0c, ugen_H0e075a1c);
-	addResponse("H0e080a", ugen_H0e080a0c, ugen_H0e080a1c);
-	addResponse("H0e085a", ugen_H0e085a0c, ugen_H0e085a1c);
-	addResponse("H0e090a", ugen_H0e090a0c, ugen_H0e090a1c);
-	addResponse("H0e095a", ugen_H0e095a0c, ugen_H0e095a1c);
-	addResponse("H0e100a", ugen_H0e100a0c, ugen_H0e100a1c);
-	addResponse("H0e105a", ugen_H0e105a0c, ugen_H0e105a1c);
-	addResponse("H0e110a", ugen_H0e110a0c, ugen_H0e110a1c);
-	addResponse("H0e115a", ugen_H0e115a0c, ugen_H0e115a1c);
-	addResponse("H0e120a", ugen_H0e120a0c, ugen_H0e120a1c);
-	addResponse("H0e125a", ugen_H0e125a0c, ugen_H0e125a1c);
-	addResponse("H0e130a", ugen_H0e130a0c, ugen_H0e130a1c);
-	addResponse("H0e135a", ugen_H0e135a0c, ugen_H0e135a1c);
-	addResponse("H0e140a", ugen_H0e140a0c, ugen_H0e140a1c);
-	addResponse("H0e145a", ugen_H0e145a0c, ugen_H0e145a1c);
-	addResponse("H0e150a", ugen_H0e150a0c, ugen_H0e150a1c);
-	addResponse("H0e155a", ugen_H0e155a0c, ugen_H0e155a1c);
-	addResponse("H0e160a", ugen_H0e160a0c, ugen_H0e160a1c);
-	addResponse("H0e165a", ugen_H0e165a0c, ugen_H0e165a1c);
-	addResponse("H0e170a", ugen_H0e170a0c, ugen_H0e170a1c);
-	addResponse("H0e175a", ugen_H0e175a0c, ugen_H0e175a1c);
-	addResponse("H0e180a", ugen_H0e180a0c, ugen_H0e180a1c);
-	addResponse("H10e000a", ugen_H10e000a0c, ugen_H10e000a1c);
-	addResponse("H10e005a", ugen_H10e005a0c, ugen_H10e005a1c);
-	addResponse("H10e010a", ugen_H10e010a0c, ugen_H10e010a1c);
-	addResponse("H10e015a", ugen_H10e015a0c, ugen_H10e015a1c);
-	addResponse("H10e020a", ugen_H10e020a0c, ugen_H10e020a1c);
-	addResponse("H10e025a", ugen_H10e025a0c, ugen_H10e025a1c);
-	addResponse("H10e030a", ugen_H10e030a0c, ugen_H10e030a1c);
-	addResponse("H10e035a", ugen_H10e035a0c, ugen_H10e035a1c);
-	addResponse("H10e040a", ugen_H10e040a0c, ugen_H10e040a1c);
-	addResponse("H10e045a", ugen_H10e045a0c, ugen_H10e045a1c);
-	addResponse("H10e050a", ugen_H10e050a0c, ugen_H10e050a1c);
-	addResponse("H10e055a", ugen_H10e055a0c, ugen_H10e055a1c);
-	addResponse("H10e060a", ugen_H10e060a0c, ugen_H10e060a1c);
-	addResponse("H10e065a", ugen_H10e065a0c, ugen_H10e065a1c);
-	addResponse("H10e070a", ugen_H10e070a0c, ugen_H10e070a1c);
-	addResponse("H10e075a", ugen_H10e075a0c, ugen_H10e075a1c);
-	addResponse("H10e080a", ugen_H10e080a0c, ugen_H10e080a1c);
-	addResponse("H10e085a", ugen_H10e085a0c, ugen_H10e085a1c);
-	addResponse("H10e090a", ugen_H10e090a0c, ugen_H10e090a1c);
-	addResponse("H10e095a", ugen_H10e095a0c, ugen_H10e095a1c);
-	addResponse("H10e100a", ugen_H10e100a0c, ugen_H10e100a1c);
-	addResponse("H10e105a", ugen_H10e105a0c, ugen_H10e105a1c);
-	addResponse("H10e110a", ugen_H10e110a0c, ugen_H10e110a1c);
-	addResponse("H10e115a", ugen_H10e115a0c, ugen_H10e115a1c);
-	addResponse("H10e120a", ugen_H10e120a0c, ugen_H10e120a1c);
-	addResponse("H10e125a", ugen_H10e125a0c, ugen_H10e125a1c);
-	addResponse("H10e130a", ugen_H10e130a0c, ugen_H10e130a1c);
-	addResponse("H10e135a", ugen_H10e135a0c, ugen_H10e135a1c);
-	addResponse("H10e140a", ugen_H10e140a0c, ugen_H10e140a1c);
-	addResponse("H10e145a", ugen_H10e145a0c, ugen_H10e145a1c);
-	addResponse("H10e150a", ugen_H10e150a0c, ugen_H10e150a1c);
-	addResponse("H10e155a", ugen_H10e155a0c, ugen_H10e155a1c);
-	addResponse("H10e160a", ugen_H10e160a0c, ugen_H10e160a1c);
-	addResponse("H10e165a", ugen_H10e165a0c, ugen_H10e165a1c);
-	addResponse("H10e170a", ugen_H10e170a0c, ugen_H10e170a1c);
-	addResponse("H10e175a", ugen_H10e175a0c, ugen_H10e175a1c);
-	addResponse("H10e180a", ugen_H10e180a0c, ugen_H10e180a1c);
-	addResponse("H20e000a", ugen_H20e000a0c, ugen_H20e000a1c);
-	addResponse("H20e005a", ugen_H20e005a0c, ugen_H20e005a1c);
-	addResponse("H20e010a", ugen_H20e010a0c, ugen_H20e010a1c);
-	addResponse("H20e015a", ugen_H20e015a0c, ugen_H20e015a1c);
-	addResponse("H20e020a", ugen_H20e020a0c, ugen_H20e020a1c);
-	addResponse("H20e025a", ugen_H20e025a0c, ugen_H20e025a1c);
-	addResponse("H20e030a", ugen_H20e030a0c, ugen_H20e030a1c);
-	addResponse("H20e035a", ugen_H20e035a0c, ugen_H20e035a1c);
-	addResponse("H20e040a", ugen_H20e040a0c, ugen_H20e040a1c);
-	addResponse("H20e045a", ugen_H20e045a0c, ugen_H20e045a1c);
-	addResponse("H20e050a", ugen_H20e050a0c, ugen_H20e050a1c);
-	addResponse("H20e055a", ugen_H20e055a0c, ugen_H20e055a1c);
-	addResponse("H20e060a", ugen_H20e060a0c, ugen_H20e060a1c);
-	addResponse("H20e065a", ugen_H20e065a0c, ugen_H20e065a1c);
-	addResponse("H20e070a", ugen_H20e070a0c, ugen_H20e070a1c);
-	addResponse("H20e075a", ugen_H20e075a0c, ugen_H20e075a1c);
-	addResponse("H20e080a", ugen_H20e080a0c, ugen_H20e080a1c);
-	addResponse("H20e085a", ugen_H20e085a0c, ugen_H20e085a1c);
-	addResponse("H20e090a", ugen_H20e090a0c, ugen_H20e090a1c);
-	addResponse("H20e095a", ugen_H20e095a0c, ugen_H20e095a1c);
-	addResponse("H20e100a", ugen_H20e100a0c, ugen_H20e100a1c);
-	addResponse("H20e105a", ugen_H20e105a0c, ugen_H20e105a1c);
-	addResponse("H20e110a", ugen_H20e110a0c, ugen_H20e110a1c);
-	addResponse("H20e115a", ugen_H20e115a0c, ugen_H20e115a1c);
-	addResponse("H20e120a", ugen_H20e120a0c, ugen_H20e120a1c);
-	addResponse("H20e125a", ugen_H20e125a0c, ugen_H20e125a1c);
-	addResponse("H20e130a", ugen_H20e130a0c, ugen_H20e130a1c);
-	addResponse("H20e135a", ugen_H20e135a0c, ugen_H20e135a1c);
-	addResponse("H20e140a", ugen_H20e140a0c, ugen_H20e140a1c);
-	addResponse("H20e145a", ugen_H20e145a0c, ugen_H20e145a1c);
-	addResponse("H20e150a", ugen_H20e150a0c, ugen_H20e150a1c);
-	addResponse("H20e155a", ugen_H20e155a0c, ugen_H20e155a1c);
-	addResponse("H20e160a", ugen_H20e160a0c, ugen_H20e160a1c);
-	addResponse("H20e165a", ugen_H20e165a0c, ugen_H20e165a1c);
-	addResponse("H20e170a", ugen_H20e170a0c, ugen_H20e170a1c);
-	addResponse("H20e175a", ugen_H20e175a0c, ugen_H20e175a1c);
-	addResponse("H20e180a", ugen_H20e180a0c, ugen_H20e180a1c);
-	addResponse("H30e000a", ugen_H30e000a0c, ugen_H30e000a1c);
-	addResponse("H30e006a", ugen_H30e006a0c, ugen_H30e006a1c);
-	addResponse("H30e012a", ugen_H30e012a0c, ugen_H30e012a1c);
-	addResponse("H30e018a", ugen_H30e018a0c, ugen_H30e018a1c);
-	addResponse("H30e024a", ugen_H30e024a0c, ugen_H30e024a1c);
-	addResponse("H30e030a", ugen_H30e030a0c, ugen_H30e030a1c);
-	addResponse("H30e036a", ugen_H30e036a0c, ugen_H30e036a1c);
-	addResponse("H30e042a", ugen_H30e042a0c, ugen_H30e042a1c);
-	addResponse("H30e048a", ugen_H30e048a0c, ugen_H30e048a1c);
-	addResponse("H30e054a", ugen_H30e054a0c, ugen_H30e054a1c);
-	addResponse("H30e060a", ugen_H30e060a0c, ugen_H30e060a1c);
-	addResponse("H30e066a", ugen_H30e066a0c, ugen_H30e066a1c);
-	addResponse("H30e072a", ugen_H30e072a0c, ugen_H30e072a1c);
-	addResponse("H30e078a", ugen_H30e078a0c, ugen_H30e078a1c);
-	addResponse("H30e084a", ugen_H30e084a0c, ugen_H30e084a1c);
-	addResponse("H30e090a", ugen_H30e090a0c, ugen_H30e090a1c);
-	addResponse("H30e096a", ugen_H30e096a0c, ugen_H30e096a1c);
-	addResponse("H30e102a", ugen_H30e102a0c, ugen_H30e102a1c);
-	addResponse("H30e108a", ugen_H30e108a0c, ugen_H30e108a1c);
-	addResponse("H30e114a", ugen_H30e114a0c, ugen_H30e114a1c);
-	addResponse("H30e120a", ugen_H30e120a0c, ugen_H30e120a1c);
-	addResponse("H30e126a", ugen_H30e126a0c, ugen_H30e126a1c);
-	addResponse("H30e132a", ugen_H30e132a0c, ugen_H30e132a1c);
-	addResponse("H30e138a", ugen_H30e138a0c, ugen_H30e138a1c);
-	addResponse("H30e144a", ugen_H30e144a0c, ugen_H30e144a1c);
-	addResponse("H30e150a", ugen_H30e150a0c, ugen_H30e150a1c);
-	addResponse("H30e156a", ugen_H30e156a0c, ugen_H30e156a1c);
-	addResponse("H30e162a", ugen_H30e162a0c, ugen_H30e162a1c);
-	addResponse("H30e168a", ugen_H30e168a0c, ugen_H30e168a1c);
-	addResponse("H30e174a", ugen_H30e174a0c, ugen_H30e174a1c);
-	addResponse("H30e180a", ugen_H30e180a0c, ugen_H30e180a1c);
-	addResponse("H40e000a", ugen_H40e000a0c, ugen_H40e000a1c);
-	addResponse("H40e006a", ugen_H40e006a0c, ugen_H40e006a1c);
-	addResponse("H40e013a", ugen_H40e013a0c, ugen_H40e013a1c);
-	addResponse("H40e019a", ugen_H40e019a0c, ugen_H40e019a1c);
-	addResponse("H40e026a", ugen_H40e026a0c, ugen_H40e026a1c);
-	addResponse("H40e032a", ugen_H40e032a0c, ugen_H40e032a1c);
-	addResponse("H40e039a", ugen_H40e039a0c, ugen_H40e039a1c);
-	addResponse("H40e045a", ugen_H40e045a0c, ugen_H40e045a1c);
-	addResponse("H40e051a", ugen_H40e051a0c, ugen_H40e051a1c);
-	addResponse("H40e058a", ugen_H40e058a0c, ugen_H40e058a1c);
-	addResponse("H40e064a", ugen_H40e064a0c, ugen_H40e064a1c);
-	addResponse("H40e071a", ugen_H40e071a0c, ugen_H40e071a1c);
-	addResponse("H40e077a", ugen_H40e077a0c, ugen_H40e077a1c);
-	addResponse("H40e084a", ugen_H40e084a0c, ugen_H40e084a1c);
-	addResponse("H40e090a", ugen_H40e090a0c, ugen_H40e090a1c);
-	addResponse("H40e096a", ugen_H40e096a0c, ugen_H40e096a1c);
-	addResponse("H40e103a", ugen_H40e103a0c, ugen_H40e103a1c);
-	addResponse("H40e109a", ugen_H40e109a0c, ugen_H40e109a1c);
-	addResponse("H40e116a", ugen_H40e116a0c, ugen_H40e116a1c);
-	addResponse("H40e122a", ugen_H40e122a0c, ugen_H40e122a1c);
-	addResponse("H40e129a", ugen_H40e129a0c, ugen_H40e129a1c);
-	addResponse("H40e135a", ugen_H40e135a0c, ugen_H40e135a1c);
-	addResponse("H40e141a", ugen_H40e141a0c, ugen_H40e141a1c);
-	addResponse("H40e148a", ugen_H40e148a0c, ugen_H40e148a1c);
-	addResponse("H40e154a", ugen_H40e154a0c, ugen_H40e154a1c);
-	addResponse("H40e161a", ugen_H40e161a0c, ugen_H40e161a1c);
-	addResponse("H40e167a", ugen_H40e167a0c, ugen_H40e167a1c);
-	addResponse("H40e174a", ugen_H40e174a0c, ugen_H40e174a1c);
-	addResponse("H40e180a", ugen_H40e180a0c, ugen_H40e180a1c);
-	addResponse("H50e000a", ugen_H50e000a0c, ugen_H50e000a1c);
-	addResponse("H50e008a", ugen_H50e008a0c, ugen_H50e008a1c);
-	addResponse("H50e016a", ugen_H50e016a0c, ugen_H50e016a1c);
-	addResponse("H50e024a", ugen_H50e024a0c, ugen_H50e024a1c);
-	addResponse("H50e032a", ugen_H50e032a0c, ugen_H50e032a1c);
-	addResponse("H50e040a", ugen_H50e040a0c, ugen_H50e040a1c);
-	addResponse("H50e048a", ugen_H50e048a0c, ugen_H50e048a1c);
-	addResponse("H50e056a", ugen_H50e056a0c, ugen_H50e056a1c);
-	addResponse("H50e064a", ugen_H50e064a0c, ugen_H50e064a1c);
-	addResponse("H50e072a", ugen_H50e072a0c, ugen_H50e072a1c);
-	addResponse("H50e080a", ugen_H50e080a0c, ugen_H50e080a1c);
-	addResponse("H50e088a", ugen_H50e088a0c, ugen_H50e088a1c);
-	addResponse("H50e096a", ugen_H50e096a0c, ugen_H50e096a1c);
-	addResponse("H50e104a", ugen_H50e104a0c, ugen_H50e104a1c);
-	addResponse("H50e112a", ugen_H50e112a0c, ugen_H50e112a1c);
-	addResponse("H50e120a", ugen_H50e120a0c, ugen_H50e120a1c);
-	addResponse("H50e128a", ugen_H50e128a0c, ugen_H50e128a1c);
-	addResponse("H50e136a", ugen_H50e136a0c, ugen_H50e136a1c);
-	addResponse("H50e144a", ugen_H50e144a0c, ugen_H50e144a1c);
-	addResponse("H50e152a", ugen_H50e152a0c, ugen_H50e152a1c);
-	addResponse("H50e160a", ugen_H50e160a0c, ugen_H50e160a1c);
-	addResponse("H50e168a", ugen_H50e168a0c, ugen_H50e168a1c);
-	addResponse("H50e176a", ugen_H50e176a0c, ugen_H50e176a1c);
-	addResponse("H60e000a", ugen_H60e000a0c, ugen_H60e000a1c);
-	addResponse("H60e010a", ugen_H60e010a0c, ugen_H60e010a1c);
-	addResponse("H60e020a", ugen_H60e020a0c, ugen_H60e020a1c);
-	addResponse("H60e030a", ugen_H60e030a0c, ugen_H60e030a1c);
-	addResponse("H60e040a", ugen_H60e040a0c, ugen_H60e040a1c);
-	addResponse("H60e050a", ugen_H60e050a0c, ugen_H60e050a1c);
-	addResponse("H60e060a", ugen_H60e060a0c, ugen_H60e060a1c);
-	addResponse("H60e070a", ugen_H60e070a0c, ugen_H60e070a1c);
-	addResponse("H60e080a", ugen_H60e080a0c, ugen_H60e080a1c);
-	addResponse("H60e090a", ugen_H60e090a0c, ugen_H60e090a1c);
-	addResponse("H60e100a", ugen_H60e100a0c, ugen_H60e100a1c);
-	addResponse("H60e110a", ugen_H60e110a0c, ugen_H60e110a1c);
-	addResponse("H60e120a", ugen_H60e120a0c, ugen_H60e120a1c);
-	addResponse("H60e130a", ugen_H60e130a0c, ugen_H60e130a1c);
-	addResponse("H60e140a", ugen_H60e140a0c, ugen_H60e140a1c);
-	addResponse("H60e150a", ugen_H60e150a0c, ugen_H60e150a1c);
-	addResponse("H60e160a", ugen_H60e160a0c, ugen_H60e160a1c);
-	addResponse("H60e170a", ugen_H60e170a0c, ugen_H60e170a1c);
-	addResponse("H60e180a", ugen_H60e180a0c, ugen_H60e180a1c);
-	addResponse("H70e000a", ugen_H70e000a0c, ugen_H70e000a1c);
-	addResponse("H70e015a", ugen_H70e015a0c, ugen_H70e015a1c);
-	addResponse("H70e030a", ugen_H70e030a0c, ugen_H70e030a1c);
-	addResponse("H70e045a", ugen_H70e045a0c, ugen_H70e045a1c);
-	addResponse("H70e060a", ugen_H70e060a0c, ugen_H70e060a1c);
-	addResponse("H70e075a", ugen_H70e075a0c, ugen_H70e075a1c);
-	addResponse("H70e090a", ugen_H70e090a0c, ugen_H70e090a1c);
-	addResponse("H70e105a", ugen_H70e105a0c, ugen_H70e105a1c);
-	addResponse("H70e120a", ugen_H70e120a0c, ugen_H70e120a1c);
-	addResponse("H70e135a", ugen_H70e135a0c, ugen_H70e135a1c);
-	addResponse("H70e150a", ugen_H70e150a0c, ugen_H70e150a1c);
-	addResponse("H70e165a", ugen_H70e165a0c, ugen_H70e165a1c);
-	addResponse("H70e180a", ugen_H70e180a0c, ugen_H70e180a1c);
-	addResponse("H80e000a", ugen_H80e000a0c, ugen_H80e000a1c);
-	addResponse("H80e030a", ugen_H80e030a0c, ugen_H80e030a1c);
-	addResponse("H80e060a", ugen_H80e060a0c, ugen_H80e060a1c);
-	addResponse("H80e090a", ugen_H80e090a0c, ugen_H80e090a1c);
-	addResponse("H80e120a", ugen_H80e120a0c, ugen_H80e120a1c);
-	addResponse("H80e150a", ugen_H80e150a0c, ugen_H80e150a1c);
-	addResponse("H80e180a", ugen_H80e180a0c, ugen_H80e180a1c);
-	addResponse("H90e000a", ugen_H90e000a0c, ugen_H90e000a1c);	
+	return (short)((unsigned short)bytes[0] | ((unsigned short)bytes[1] << 8));
 }
-				 
-void HRTF::addResponse(Text const& key, const short* left, const short* right) throw()
+
+static inline void ugen_HRTFWriteUInt32(unsigned char* bytes, const unsigned int value) throw()
 {
-	static const float factor = 1.f / 32767.f;
-	Buffer leftBuffer(FloatArray(ShortArray(128, (short*)left, false)) * factor);
-	Buffer rightBuffer(FloatArray(ShortArray(128, (short*)right, false)) * factor);
-	database.put(key, Buffer(leftBuffer, rightBuffer));
+	bytes[0] = (unsigned char)(value & 0xFF);
+	bytes[1] = (unsigned char)((value >> 8) & 0xFF);
+	bytes[2] = (unsigned char)((value >> 16) & 0xFF);
+	bytes[3] = (unsigned char)((value >> 24) & 0xFF);
 }
 
-Buffer HRTF::getClosestResponse(const float azimuth, const float elevation) throw()
+static inline void ugen_HRTFWriteInt16(unsigned char* bytes, const int value) throw()
 {
-	return getClosestResponseDegrees((int)(rad2deg(azimuth) + 0.5f), 
-									 (int)(rad2deg(elevation) + 0.5f));
+	bytes[0] = (unsigned char)(value & 0xFF);
+	bytes[1] = (unsigned char)((value >> 8) & 0xFF);
 }
 
-Buffer HRTF::getClosestResponseDegrees(const int azimuth, const int elevation) throw()
+/** Reads the bits of the Int16Rice encoding. */
+class HRTFBitReader
 {
-	int elevationChecked = closestElevation(elevation);
+public:
+	HRTFBitReader(const unsigned char* bytesToUse, const int numBytesToUse) throw()
+	:	bytes(bytesToUse),
+		numBytes(numBytesToUse),
+		position(0)
+	{
+	}
 	
-	if(azimuth < 0)
-	{		
-		int azimuthChecked = closestAzimuth(elevation, -azimuth);
-		const int size = 512;
-		char buf[size];
-		snprintf(buf, size, "H%de%03da", elevationChecked, azimuthChecked);
-		
-		Buffer temp = getInstance().database[buf];
-		
-		return Buffer(temp.getChannel(1), temp.getChannel(0));
+	inline unsigned int readBit() throw()
+	{
+		const int byte = position >> 3;
+		if(byte >= numBytes) return 0;
+		const unsigned int bit = (bytes[byte] >> (7 - (position & 7))) & 1;
+		position++;
+		return bit;
 	}
-	else
+	
+	inline unsigned int readBits(const int numBits) throw()
 	{
-		int azimuthChecked = closestAzimuth(elevation, azimuth);
-		const int size = 512;
-		char buf[size];
-		snprintf(buf, size, "H%de%03da", elevationChecked, azimuthChecked);
+		unsigned int value = 0;
+		for(int i = 0; i < numBits; i++)
+			value = (value << 1) | readBit();
+		return value;
+	}
+	
+	inline unsigned int readUnary() throw()
+	{
+		unsigned int value = 0;
+		while(readBit() && (position >> 3) < numBytes) value++;
+		return value;
+	}
 	
-		return getInstance().database[buf];
+	inline void alignToByte() throw()
+	{
+		position = (position + 7) & ~7;
 	}
+	
+private:
+	const unsigned char* bytes;
+	const int numBytes;
+	int position;
+};
+
+HRTFSetInternal::HRTFSetInternal(ByteArray const& dataToUse) throw()
+:	data(dataToUse),
+	encoding(0),
+	dataOffset(0),
+	numMeasured(0),
+	responseSize(0),
+	sampleRate(0.0),
+	symmetric(true)
+{
+	parse();
 }
 
-
-// interpolated version?
-
-//Buffer HRTF::getResponse(const float azimuth, const float elevation) throw()
-//{
-//	return getResponseDegrees((int)(rad2deg(azimuth) + 0.5f), 
-//							  (int)(rad2deg(elevation) + 0.5f));
-//}
-
-
-//static Buffer HRTF::getResponseDegrees(const int azimuth, const int elevation = 0) throw();
-//{
-//}
-
-int HRTF::closestElevation(const int elevation) throw()
+HRTFSetInternal::HRTFSetInternal(ObjectArray<Buffer> const& responsesToUse, 
+								 IntArray const& elevationsToUse, 
+								 IntArray const& azimuthsToUse,
+								 const double sampleRateToUse) throw()
+:	encoding(0),
+	dataOffset(0),
+	numMeasured(0),
+	responseSize(0),
+	sampleRate(0.0),
+	symmetric(true)
 {
-	if(elevation <= -40) return -40;
-	if(elevation >= 90) return 90;
+	// store in the file format so there is only one path for reading the data
+	const int numResponses = ugen::min(responsesToUse.length(), ugen::min(elevationsToUse.length(), azimuthsToUse.length()));
+	int size = 0;
+	
+	for(int i = 0; i < numResponses; i++)
+		size = ugen::max(size, responsesToUse[i].size());
 	
-	float rounding = (elevation < 0) ? -0.5f : 0.5f;
+	const int directionsOffset = ugen_HRTFHeaderSize;
+	const int samplesOffset = directionsOffset + numResponses * 4;
+	data = ByteArray::withSize(samplesOffset + numResponses * 2 * size * 4, true);
+	unsigned char* bytes = data.getArray();
 	
-	float temp = (float)elevation * 0.1f;
-	temp += rounding;
-	int decade = (int)temp * 10;
+	memcpy(bytes, ugen_HRTFMagic, 4);
+	ugen_HRTFWriteUInt32(bytes + 4, ugen_HRTFVersion);
+	ugen_HRTFWriteUInt32(bytes + 8, numResponses);
+	ugen_HRTFWriteUInt32(bytes + 12, 2);
+	ugen_HRTFWriteUInt32(bytes + 16, size);
+	ugen_HRTFWriteUInt32(bytes + 20, (unsigned int)(sampleRateToUse + 0.5));
+	ugen_HRTFWriteUInt32(bytes + 24, Float32);
+	
+	for(int i = 0; i < numResponses; i++)
+	{
+		ugen_HRTFWriteInt16(bytes + directionsOffset + i * 4, elevationsToUse[i]);
+		ugen_HRTFWriteInt16(bytes + directionsOffset + i * 4 + 2, azimuthsToUse[i]);
+		
+		Buffer const& response = responsesToUse[i];
+		
+		for(int channel = 0; channel < 2; channel++)
+		{
+			unsigned char* channelBytes = bytes + samplesOffset + (i * 2 + channel) * size * 4;
+			
+			for(int j = 0; j < response.size(); j++)
+			{
+				union { float f; unsigned int u; } sample;
+				sample.f = response.getSampleUnchecked(channel % response.getNumChannels(), j);
+				ugen_HRTFWriteUInt32(channelBytes + j * 4, sample.u);
+			}
+		}
+	}
 	
-	return decade;
+	parse();
 }
 
+HRTFSetInternal::~HRTFSetInternal()
+{
+}
 
-static int ugen_HRTFclosestAzimuth7(const int azimuth) throw()
+void HRTFSetInternal::parse() throw()
 {
-	if(azimuth <= 0) return 0;
-	if(azimuth >= 180) return 180;
+	const unsigned char* bytes = data.getArray();
+	const int numBytes = data.length();
+	
+	if(numBytes < ugen_HRTFHeaderSize || memcmp(bytes, ugen_HRTFMagic, 4) != 0)		return;
+	if(ugen_HRTFReadUInt32(bytes + 4) != ugen_HRTFVersion)							return;
+	if(ugen_HRTFReadUInt32(bytes + 12) != 2)										return;
+	
+	const int numResponses = (int)ugen_HRTFReadUInt32(bytes + 8);
+	const int size = (int)ugen_HRTFReadUInt32(bytes + 16);
+	const int encodingInFile = (int)ugen_HRTFReadUInt32(bytes + 24);
+	
+	if(numResponses <= 0 || size <= 0 || encodingInFile < 0 || encodingInFile >= NumEncodings)	
+		return;
+	
+	const int samplesOffset = ugen_HRTFHeaderSize + numResponses * 4;
+	int requiredBytes = samplesOffset;
 	
-	float temp = (float)azimuth / 30.f;
-	temp += 0.5f;
+	if(encodingInFile == Float32)		requiredBytes += numResponses * 2 * size * 4;
+	else if(encodingInFile == Int16)	requiredBytes += numResponses * 2 * size * 2;
+	else								requiredBytes += numResponses * 4;
 	
-	return (int)temp * 30;
+	if(numBytes < requiredBytes) 
+		return;
+	
+	encoding = encodingInFile;
+	dataOffset = samplesOffset;
+	responseSize = size;
+	sampleRate = ugen_HRTFReadUInt32(bytes + 20);
+	elevations = IntArray::withSize(numResponses);
+	azimuths = IntArray::withSize(numResponses);
+	
+	for(int i = 0; i < numResponses; i++)
+	{
+		elevations[i] = ugen::clip(ugen_HRTFReadInt16(bytes + ugen_HRTFHeaderSize + i * 4), -90, 90);
+		azimuths[i] = ugen::clip(ugen_HRTFReadInt16(bytes + ugen_HRTFHeaderSize + i * 4 + 2), -180, 180);
+		
+		if(azimuths[i] < 0)
+			symmetric = false;
+	}
+	
+	numMeasured = numResponses;
+	responses = ObjectArray<Buffer>::withSize(symmetric ? numMeasured * 2 : numMeasured);
+	
+	buildIndex();
 }
 
-static int ugen_HRTFclosestAzimuth13(const int azimuth) throw()
+static int ugen_HRTFClosest(IntArray const& values, const int target, const bool circular) throw()
 {
-	if(azimuth <= 0) return 0;
-	if(azimuth >= 180) return 180;
+	// ties go to the value with the larger magnitude
+	int closest = 0;
+	int closestDistance = 0x7fffffff;
 	
-	float temp = (float)azimuth / 15.f;
-	temp += 0.5f;
+	for(int i = 0; i < values.length(); i++)
+	{
+		int distance = values[i] - target;
+		if(distance < 0) distance = -distance;
+		if(circular && distance > 180) distance = 360 - distance;
+		
+		const int absValue = values[i] < 0 ? -values[i] : values[i];
+		const int absClosest = values[closest] < 0 ? -values[closest] : values[closest];
+		
+		if((distance < closestDistance) || ((distance == closestDistance) && (absValue > absClosest)))
+		{
+			closest = i;
+			closestDistance = distance;
+		}
+	}
 	
-	return (int)temp * 15;	
+	return closest;
 }
 
-static int ugen_HRTFclosestAzimuth19(const int azimuth) throw()
+void HRTFSetInternal::buildIndex() throw()
 {
-	if(azimuth <= 0) return 0;
-	if(azimuth >= 180) return 180;
+	// the rings of responses at each measured elevation, sorted by azimuth
+	for(int i = 0; i < numMeasured; i++)
+	{
+		const int size = 32;
+		char buf[size];
+		snprintf(buf, size, "H%de%03da", elevations[i], azimuths[i]);
+		names.put(buf, i);
+		
+		int ring = 0;
+		while(ring < ringElevations.length() && ringElevations[ring] < elevations[i]) ring++;
+		
+		if(ring == ringElevations.length() || ringElevations[ring] != elevations[i])
+		{
+			ringElevations.add(0);
+			ringAzimuths.add(IntArray());
+			ringIndices.add(IntArray());
+			
+			for(int j = ringElevations.length() - 1; j > ring; j--)
+			{
+				ringElevations[j] = ringElevations[j - 1];
+				ringAzimuths.put(j, ringAzimuths[j - 1]);
+				ringIndices.put(j, ringIndices[j - 1]);
+			}
+			
+			ringElevations[ring] = elevations[i];
+			ringAzimuths.put(ring, IntArray());
+			ringIndices.put(ring, IntArray());
+		}
+		
+		IntArray& ringAzimuth = ringAzimuths[ring];
+		IntArray& ringIndex = ringIndices[ring];
+		
+		int position = 0;
+		while(position < ringAzimuth.length() && ringAzimuth[position] < azimuths[i]) position++;
+		
+		ringAzimuth.add(0);
+		ringIndex.add(0);
+		
+		for(int j = ringAzimuth.length() - 1; j > position; j--)
+		{
+			ringAzimuth[j] = ringAzimuth[j - 1];
+			ringIndex[j] = ringIndex[j - 1];
+		}
+		
+		ringAzimuth[position] = azimuths[i];
+		ringIndex[position] = i;
+	}
+	
+	// lookup tables for the closest responses for each degree
+	closestRing = ShortArray::withSize(NumElevations);
 	
-	float temp = (float)azimuth / 10.f;
-	temp += 0.5f;
+	for(int i = 0; i < NumElevations; i++)
+		closestRing[i] = ugen_HRTFClosest(ringElevations, MinElevation + i, false);
+	
+	for(int ring = 0; ring < ringElevations.length(); ring++)
+	{
+		ShortArray closest = ShortArray::withSize(NumAzimuths);
+		
+		for(int i = 0; i < NumAzimuths; i++)
+		{
+			const int azimuth = MinAzimuth + i;
+			
+			if(symmetric && azimuth < 0)
+				closest[i] = ringIndices[ring][ugen_HRTFClosest(ringAzimuths[ring], -azimuth, false)] + numMeasured;
+			else
+				closest[i] = ringIndices[ring][ugen_HRTFClosest(ringAzimuths[ring], azimuth, !symmetric)];
+		}
+		
+		ringClosest.add(closest);
+	}
+}
+
+void HRTFSetInternal::decode(const int index, float* left, float* right) const throw()
+{
+	const unsigned char* bytes = data.getArray() + dataOffset;
+	float* channels[2] = { left, right };
 	
-	return (int)temp * 10;		
+	if(encoding == Float32)
+	{
+		for(int channel = 0; channel < 2; channel++)
+		{
+			const unsigned char* channelBytes = bytes + (index * 2 + channel) * responseSize * 4;
+			
+			for(int i = 0; i < responseSize; i++)
+			{
+				union { float f; unsigned int u; } sample;
+				sample.u = ugen_HRTFReadUInt32(channelBytes + i * 4);
+				channels[channel][i] = sample.f;
+			}
+		}
+	}
+	else if(encoding == Int16)
+	{
+		static const float factor = 1.f / 32767.f;
+		
+		for(int channel = 0; channel < 2; channel++)
+		{
+			const unsigned char* channelBytes = bytes + (index * 2 + channel) * responseSize * 2;
+			
+			for(int i = 0; i < responseSize; i++)
+				channels[channel][i] = ugen_HRTFReadInt16(channelBytes + i * 2) * factor;
+		}
+	}
+	else
+	{
+		static const float factor = 1.f / 32767.f;
+		const int codedOffset = numMeasured * 4;
+		const int responseOffset = codedOffset + (int)ugen_HRTFReadUInt32(bytes + index * 4);
+		const int available = data.length() - dataOffset - responseOffset;
+		
+		HRTFBitReader reader(bytes + responseOffset, available < 0 ? 0 : available);
+		
+		for(int channel = 0; channel < 2; channel++)
+		{
+			float* samples = channels[channel];
+			int previous = 0;
+			int k = 0;
+			
+			for(int i = 0; i < responseSize; i++)
+			{
+				if((i % ugen_HRTFRiceBlockSize) == 0)
+					k = reader.readBits(4);
+				
+				const unsigned int zigzag = (reader.readUnary() << k) | reader.readBits(k);
+				const int difference = (zigzag & 1) ? -(int)((zigzag + 1) >> 1) : (int)(zigzag >> 1);
+				previous += difference;
+				samples[i] = previous * factor;
+			}
+			
+			reader.alignToByte();
+		}
+	}
 }
 
-static int ugen_HRTFclosestAzimuth23(const int azimuth) throw()
+Buffer HRTFSetInternal::getResponseAtIndex(const int index) throw()
 {
-	if(azimuth <= 0) return 0;
-	if(azimuth >= 176) return 176;
+	if(index < 0 || index >= responses.length()) 
+		return Buffer();
+	
+	const ScopedAtomicSpinLock sl(lock);
 	
-	float temp = (float)azimuth / 8.f;
-	temp += 0.5f;
+	if(responses[index].size() == 0)
+	{
+		// convert on first access
+		const int measured = index % numMeasured;
+		Buffer response(BufferSpec(responseSize, 2, false));
+		decode(measured, response.getData(0), response.getData(1));
+		responses.put(measured, response);
+		
+		if(symmetric)
+			responses.put(measured + numMeasured, Buffer(response.getChannel(1), response.getChannel(0)));
+	}
 	
-	return (int)temp * 8;		
+	return responses[index];
+}
+
+int HRTFSetInternal::indexOfName(Text const& name) const throw()
+{
+	const int index = names.indexOf(name);
+	return index < 0 ? -1 : names.value(index);
 }
 
-static int ugen_HRTFclosestAzimuth29(const int azimuth) throw()
+int HRTFSetInternal::closestElevation(const int elevation) const throw()
 {
-	static const int choices[] = {
-		0, 6, 13, 19, 26, 32, 39, 45, 51, 58, 64, 71, 77, 84, 90, 96, 
-		103, 109, 116, 122, 129, 135, 141, 148, 154, 161, 167, 174, 180
-	};
+	return ringElevations[closestRing[ugen::clip(elevation, -90, 90) - MinElevation]];
+}
 
-	if(azimuth <= 0) return 0;
-	if(azimuth >= 180) return 180;
+int HRTFSetInternal::closestIndex(const int azimuth, const int elevation) const throw()
+{
+	const int ring = closestRing[ugen::clip(elevation, -90, 90) - MinElevation];
+	return ringClosest[ring][ugen::clip(azimuth, -180, 180) - MinAzimuth];
+}
 
-	int upper = 0;
+int HRTFSetInternal::getInterpolatedResponses(const float azimuthDegrees, const float elevationDegrees, 
+											  int* responseIndices, float* weights) const throw()
+{
+	const int numRings = ringElevations.length();
 	
-	while(choices[upper] < azimuth) upper++;
+	if(numRings == 0) 
+		return 0;
 	
-	int lower = upper-1;
+	// the two rings either side of the elevation
+	const float elevation = ugen::clip(elevationDegrees, (float)ringElevations[0], (float)ringElevations[numRings - 1]);
+	int ring0 = 0;
+	while(ring0 < numRings - 2 && ringElevations[ring0 + 1] < elevation) ring0++;
 	
-	if((azimuth - choices[lower]) < (choices[upper] - azimuth))
-	{
-		return choices[lower];
-	}
-	else
+	const int ring1 = ugen::min(ring0 + 1, numRings - 1);
+	const float ringWeight1 = ring0 == ring1 ? 0.f : ugen::clip((elevation - ringElevations[ring0]) / (float)(ringElevations[ring1] - ringElevations[ring0]), 0.f, 1.f);
+	
+	// azimuths outside -180 to 180 are clipped for consistency with closestAzimuth()
+	const float azimuthChecked = ugen::clip(azimuthDegrees, -180.f, 180.f);
+	const bool mirror = symmetric && azimuthChecked < 0.f;
+	const float azimuth = mirror ? -azimuthChecked : azimuthChecked;
+	const int mirrorOffset = mirror ? numMeasured : 0;
+	
+	int count = 0;
+	
+	for(int ring = ring0; ring <= ring1; ring++)
 	{
-		return choices[upper];
+		const float ringWeight = ring == ring0 ? 1.f - ringWeight1 : ringWeight1;
+		
+		if(ringWeight <= 0.f) continue;
+		
+		IntArray const& ringAzimuth = ringAzimuths[ring];
+		IntArray const& ringIndex = ringIndices[ring];
+		const int numAzimuths = ringAzimuth.length();
+		
+		int upper = 0;
+		while(upper < numAzimuths && ringAzimuth[upper] < azimuth) upper++;
+		
+		int lower;
+		float lowerAzimuth, upperAzimuth;
+		
+		if(symmetric)
+		{
+			// clamp at the ends of the ring
+			upper = ugen::min(upper, numAzimuths - 1);
+			lower = ugen::max(0, upper - 1);
+			lowerAzimuth = (float)ringAzimuth[lower];
+			upperAzimuth = (float)ringAzimuth[upper];
+		}
+		else if(upper == numAzimuths || upper == 0)
+		{
+			// wrap around through 180 degrees
+			lower = numAzimuths - 1;
+			upper = 0;
+			lowerAzimuth = (float)ringAzimuth[lower];
+			upperAzimuth = (float)ringAzimuth[upper] + 360.f;
+			
+			if(azimuth < lowerAzimuth) lowerAzimuth -= 360.f, upperAzimuth -= 360.f;
+		}
+		else
+		{
+			lower = upper - 1;
+			lowerAzimuth = (float)ringAzimuth[lower];
+			upperAzimuth = (float)ringAzimuth[upper];
+		}
+		
+		float upperWeight = 1.f;
+		
+		if(upperAzimuth != lowerAzimuth)
+			upperWeight = ugen::clip((azimuth - lowerAzimuth) / (upperAzimuth - lowerAzimuth), 0.f, 1.f);
+		
+		if(upperWeight < 1.f)
+		{
+			responseIndices[count] = ringIndex[lower] + mirrorOffset;
+			weights[count++] = ringWeight * (1.f - upperWeight);
+		}
+		
+		if(upperWeight > 0.f)
+		{
+			responseIndices[count] = ringIndex[upper] + mirrorOffset;
+			weights[count++] = ringWeight * upperWeight;
+		}
 	}
+	
+	return count;
 }
 
-static int ugen_HRTFclosestAzimuth31(const int azimuth) throw()
+bool HRTFSetInternal::write(Text const& path) const throw()
 {
-	if(azimuth <= 0) return 0;
-	if(azimuth >= 180) return 180;
+	if(!isValid()) 
+		return false;
+	
+	FILE* file = fopen(path.getArray(), "wb");
 	
-	float temp = (float)azimuth / 6.f;
-	temp += 0.5f;
+	if(file == 0) 
+		return false;
 	
-	return (int)temp * 6;			
+	const bool written = (int)fwrite(data.getArray(), 1, data.length(), file) == data.length();
+	fclose(file);
+	
+	return written;
+}
+
+HRTFSet::HRTFSet() throw()
+{
 }
 
-static int ugen_HRTFclosestAzimuth37(const int azimuth) throw()
+static ByteArray ugen_HRTFReadFile(Text const& path) throw()
 {
-	if(azimuth <= 0) return 0;
-	if(azimuth >= 180) return 180;
+	FILE* file = fopen(path.getArray(), "rb");
 	
-	float temp = (float)azimuth / 5.f;
-	temp += 0.5f;
+	if(file == 0) 
+		return ByteArray();
 	
-	return (int)temp * 5;				
+	fseek(file, 0, SEEK_END);
+	const long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	
+	ByteArray bytes = ByteArray::withSize(size > 0 ? (int)size : 0);
+	
+	if(size <= 0 || (long)fread(bytes.getArray(), 1, size, file) != size)
+		bytes = ByteArray();
+	
+	fclose(file);
+	
+	return bytes;
 }
 
-int HRTF::closestAzimuth(const int elevation, const int azimuth) throw()
+HRTFSet::HRTFSet(Text const& path) throw()
+:	SmartPointerContainer<HRTFSetInternal>(new HRTFSetInternal(ugen_HRTFReadFile(path)))
+{
+}
+
+HRTFSet::HRTFSet(ByteArray const& data) throw()
+:	SmartPointerContainer<HRTFSetInternal>(new HRTFSetInternal(data))
+{
+}
+
+HRTFSet::HRTFSet(ObjectArray<Buffer> const& responses, 
+				 IntArray const& elevations, 
+				 IntArray const& azimuths,
+				 const double sampleRate) throw()
+:	SmartPointerContainer<HRTFSetInternal>(new HRTFSetInternal(responses, elevations, azimuths, sampleRate))
+{
+}
+
+HRTFSet& HRTFSet::getDefault() throw()
+{
+	static HRTFSet kemar(ugen_HRTFDecodeBase64(ugen_HRTFKEMARData));
+	return kemar;
+}
+
+bool HRTFSet::write(Text const& path) const throw()
+{
+	return isNotNull() && getInternal()->write(path);
+}
+
+bool HRTFSet::isValid() const throw()
+{
+	return isNotNull() && getInternal()->isValid();
+}
+
+int HRTFSet::getResponseSize() const throw()
+{
+	return isNotNull() ? getInternal()->getResponseSize() : 0;
+}
+
+double HRTFSet::getSampleRate() const throw()
+{
+	return isNotNull() ? getInternal()->getSampleRate() : 0.0;
+}
+
+int HRTFSet::getNumResponses() const throw()
+{
+	return isValid() ? getInternal()->getNumResponses() : 0;
+}
+
+Buffer HRTFSet::getResponseAtIndex(const int index) const throw()
 {
-	const int checkedElevation = closestElevation(elevation);
+	return isValid() ? const_cast<HRTFSetInternal*>(getInternal())->getResponseAtIndex(index) : Buffer();
+}
+
+Buffer HRTFSet::getResponse(Text const& name) const throw()
+{
+	return isValid() ? getResponseAtIndex(getInternal()->indexOfName(name)) : Buffer();
+}
+
+Buffer HRTFSet::getClosestResponse(const float azimuth, const float elevation) const throw()
+{
+	return getClosestResponseDegrees((int)(rad2deg(azimuth) + (azimuth < 0.f ? -0.5f : 0.5f)), 
+									 (int)(rad2deg(elevation) + (elevation < 0.f ? -0.5f : 0.5f)));
+}
+
+Buffer HRTFSet::getClosestResponseDegrees(const int azimuth, const int elevation) const throw()
+{
+	return isValid() ? getResponseAtIndex(getInternal()->closestIndex(azimuth, elevation)) : Buffer();
+}
+
+int HRTFSet::closestElevation(const int elevationDegrees) const throw()
+{
+	return isValid() ? getInternal()->closestElevation(elevationDegrees) : 0;
+}
+
+int HRTFSet::closestAzimuth(const int elevationDegrees, const int azimuthDegrees) const throw()
+{
+	if(!isValid()) 
+		return 0;
 	
-	switch(checkedElevation)
-	{
-		case -40: 
-		case 40:
-			return ugen_HRTFclosestAzimuth29(azimuth);
-			
-		case -30:
-		case 30:
-			return ugen_HRTFclosestAzimuth31(azimuth);
-			
-		case -20:
-		case -10:
-		case 0:
-		case 10:
-		case 20:
-			return ugen_HRTFclosestAzimuth37(azimuth);
-			
-		case 50: return ugen_HRTFclosestAzimuth23(azimuth);
-		case 60: return ugen_HRTFclosestAzimuth19(azimuth);
-		case 70: return ugen_HRTFclosestAzimuth13(azimuth);
-		case 80: return ugen_HRTFclosestAzimuth7(azimuth);
-		case 90: return 0;
-	}
+	const HRTFSetInternal* internal = getInternal();
+	const int index = internal->closestIndex(azimuthDegrees, elevationDegrees);
+	const int azimuth = index >= internal->getNumMeasured() ? -internal->getAzimuth(index) : internal->getAzimuth(index);
+	
+	// 0-359 as for the original KEMAR only version
+	return azimuth < 0 ? azimuth + 360 : azimuth;
+}
+
+int HRTFSet::getInterpolatedResponses(const float azimuth, const float elevation, 
+									  int* responseIndices, float* weights) const throw()
+{
+	if(!isValid()) 
+		return 0;
 	
-	return 0;
+	return getInternal()->getInterpolatedResponses(rad2deg(azimuth), rad2deg(elevation), responseIndices, weights);
+}
+
+Buffer HRTF::getClosestResponse(const float azimuth, const float elevation) throw()
+{
+	return HRTFSet::getDefault().getClosestResponse(azimuth, elevation);
+}
+
+Buffer HRTF::getClosestResponseDegrees(const int azimuth, const int elevation) throw()
+{
+	return HRTFSet::getDefault().getClosestResponseDegrees(azimuth, elevation);
 }
 
+int HRTF::closestElevation(const int elevation) throw()
+{
+	return HRTFSet::getDefault().closestElevation(elevation);
+}
+
+int HRTF::closestAzimuth(const int elevation, const int azimuth) throw()
+{
+	return HRTFSet::getDefault().closestAzimuth(elevation, azimuth);
+}
+
+Buffer HRTF::getResponse(Text const& name) throw()
+{
+	return HRTFSet::getDefault().getResponse(name);
+}
+
+int HRTF::getNumResponses() throw()
+{
+	return HRTFSet::getDefault().getNumResponses();
+}
 
-HRTF& HRTF::getInstance()
+Buffer HRTF::getResponseAtIndex(const int index) throw()
 {
-	static HRTF hrtf;
-	return hrtf;
+	return HRTFSet::getDefault().getResponseAtIndex(index);
 }
 
+int HRTF::getInterpolatedResponses(const float azimuth, const float elevation, 
+								   int* responseIndices, float* weights) throw()
+{
+	return HRTFSet::getDefault().getInterpolatedResponses(azimuth, elevation, responseIndices, weights);
+}
 
 END_UGEN_NAMESPACE
 
 #endif
-
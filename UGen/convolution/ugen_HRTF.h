@@ -44,6 +44,159 @@
 
 #include "../core/ugen_Collections.h"
 #include "../buffers/ugen_Buffer.h"
+#include "../core/ugen_AtomicSpinLock.h"
+
+/** @internal */
+class HRTFSetInternal : public SmartPointer
+{
+public:
+	HRTFSetInternal(ByteArray const& data) throw();
+	HRTFSetInternal(ObjectArray<Buffer> const& responses, 
+					IntArray const& elevations, 
+					IntArray const& azimuths,
+					const double sampleRate) throw();
+	~HRTFSetInternal();
+	
+	inline bool isValid() const throw()				{ return numMeasured > 0;		}
+	inline int getNumMeasured() const throw()		{ return numMeasured;			}
+	inline int getResponseSize() const throw()		{ return responseSize;			}
+	inline double getSampleRate() const throw()		{ return sampleRate;			}
+	inline int getElevation(const int index) const throw()	{ return elevations[index % numMeasured];	}
+	inline int getAzimuth(const int index) const throw()	{ return azimuths[index % numMeasured];		}
+	inline int getNumResponses() const throw()		{ return responses.length();	}
+	
+	Buffer getResponseAtIndex(const int index) throw();
+	int indexOfName(Text const& name) const throw();
+	int closestElevation(const int elevation) const throw();
+	int closestIndex(const int azimuth, const int elevation) const throw();
+	int getInterpolatedResponses(const float azimuthDegrees, const float elevationDegrees, 
+								 int* responseIndices, float* weights) const throw();
+	bool write(Text const& path) const throw();
+	
+	enum Encodings { Float32, Int16, Int16Rice, NumEncodings };
+	
+private:
+	void parse() throw();
+	void buildIndex() throw();
+	void decode(const int index, float* left, float* right) const throw();
+	
+	enum Constants
+	{
+		MinElevation = -90,
+		NumElevations = 181,	// -90 to 90
+		MinAzimuth = -180,
+		NumAzimuths = 361		// -180 to 180
+	};
+	
+	ByteArray data;
+	int encoding;
+	int dataOffset;
+	int numMeasured;
+	int responseSize;
+	double sampleRate;
+	bool symmetric;
+	IntArray elevations, azimuths;			// the direction of each measured response
+	ObjectArray<Buffer> responses;			// converted on first access, mirrored responses follow the measured ones
+	HashDictionary<int> names;				// e.g., "H-10e005a" for the measured responses
+	
+	IntArray ringElevations;				// the measured elevations in ascending order
+	ObjectArray<IntArray> ringAzimuths;		// the measured azimuths on each ring in ascending order
+	ObjectArray<IntArray> ringIndices;		// the response indices for each of ringAzimuths
+	ObjectArray<ShortArray> ringClosest;	// the closest response index for each degree of azimuth on each ring
+	ShortArray closestRing;					// the closest ring for each degree of elevation
+	
+	AtomicSpinLock lock;					// guards the conversion of responses on first access
+};
+
+/** A set of HRIRs (Head Related Impulse Responses) indexed by direction.
+ The built-in set (see getDefault()) is the KEMAR data from Gardner and Martin's 
+ 1994 work. Other sets may be loaded from files in the same binary format which 
+ can be created from any collection of measured responses using the constructor 
+ taking an array of Buffer objects and then write(). Azimuths and elevations are
+ in degrees (positive azimuths are to the right). If a set has no responses with 
+ negative azimuths the responses are assumed to be symmetrical and those for the
+ left are taken from the right with the channels swapped.
+ 
+ Responses are stored compactly and converted to float Buffer objects the first
+ time they are accessed.
+ 
+ @see HRTF, BinauralPan */
+class HRTFSet : public SmartPointerContainer<HRTFSetInternal>
+{
+public:
+	/** Creates a null set. */
+	HRTFSet() throw();
+	
+	/** Loads a set from a file previously saved with write(). 
+	 Use isValid() to check whether this was successful. */
+	HRTFSet(Text const& path) throw();
+	
+	/** Loads a set from memory in the same format as the file. */
+	HRTFSet(ByteArray const& data) throw();
+	
+	/** Creates a set from an array of stereo responses and their directions.
+	 @param responses	The responses, these should all be two channels (left and right)
+						and the same size.
+	 @param elevations	The elevation of each response in degrees.
+	 @param azimuths	The azimuth of each response in degrees (-180 to 180).
+	 @param sampleRate	The sample rate of the responses. */
+	HRTFSet(ObjectArray<Buffer> const& responses, 
+			IntArray const& elevations, 
+			IntArray const& azimuths,
+			const double sampleRate = 44100.0) throw();
+	
+	/** Returns the built-in KEMAR set. */
+	static HRTFSet& getDefault() throw();
+	
+	/** Saves the set to a file that can be loaded using HRTFSet(Text const&). */
+	bool write(Text const& path) const throw();
+	
+	/** Returns whether the set contains any responses. */
+	bool isValid() const throw();
+	
+	/** Returns the size of the responses in samples. */
+	int getResponseSize() const throw();
+	
+	/** Returns the sample rate of the responses. */
+	double getSampleRate() const throw();
+	
+	/** Returns the number of responses accessible via getResponseAtIndex().
+	 For symmetrical sets this is twice the number of measured responses since
+	 each is also available with its channels swapped for negative azimuths. */
+	int getNumResponses() const throw();
+	
+	/** Returns a response by index. 
+	 For symmetrical sets indices at getNumResponses()/2 and above are the left/right 
+	 mirrored versions of the responses below this. */
+	Buffer getResponseAtIndex(const int index) const throw();
+	
+	/** Returns a measured response by name, e.g., "H-10e005a" (or an empty Buffer if not found). */
+	Buffer getResponse(Text const& name) const throw();
+	
+	Buffer getClosestResponse(const float azimuth, const float elevation = 0.f) const throw();
+	Buffer getClosestResponseDegrees(const int azimuth, const int elevation = 0) const throw();
+	int closestElevation(const int elevationDegrees) const throw();
+	
+	/** Returns the closest measured azimuth to a direction in degrees.
+	 The result is in the range 0-359 (clockwise from straight ahead) so directions to 
+	 the left are returned as 360 minus the azimuth e.g., -30 gives 330 if there is a 
+	 response at (or mirrored from) 30 degrees. */
+	int closestAzimuth(const int elevationDegrees, const int azimuthDegrees) const throw();
+	
+	/** Finds the responses surrounding a direction for interpolation.
+	 This finds the two closest measured azimuths on each of the two closest 
+	 measured elevations and the weight for each of these responses such that
+	 a weighted sum of the responses gives a bilinear interpolation. Responses with
+	 zero weight are omitted.
+	 @param azimuth				The azimuth in radians.
+	 @param elevation			The elevation in radians.
+	 @param responseIndices		An array of at least 4 ints to receive the indices 
+								suitable for getResponseAtIndex().
+	 @param weights				An array of at least 4 floats to receive the weights.
+	 @return					The number of responses found (0-4). */
+	int getInterpolatedResponses(const float azimuth, const float elevation, 
+								 int* responseIndices, float* weights) const throw();
+};
 
 /** Encapsulates a collection of HRTFs.
  In fact this stores HRIRs (Head Related Impulse Responses) rather than HRTFs
@@ -53,6 +206,8 @@
  and elevation. This can then be used via either TimeConvolve or PartConvolve to
  perform convolution and thus apply the HRTF to a real-time signal.
  
+ These functions use the built-in set, see HRTFSet for loading others.
+ 
  See http://sound.media.mit.edu/resources/KEMAR.html
  
  For example:
@@ -63,21 +218,30 @@
 class HRTF
 {
 public:
-	static HRTF& getInstance();
-	
 	static Buffer getClosestResponse(const float azimuth, const float elevation = 0.f) throw();
 	static Buffer getClosestResponseDegrees(const int azimuth, const int elevation = 0) throw();
 //	static Buffer getResponse(const float azimuth, const float elevation = 0.f) throw();
 //	static Buffer getResponseDegrees(const int azimuth, const int elevation = 0) throw();	
 	static int closestElevation(const int elevationDegrees) throw();
+	
+	/** @see HRTFSet::closestAzimuth() */
 	static int closestAzimuth(const int elevationDegrees, const int azimuthDegrees) throw();
 	
+	/** Returns a response by name, e.g., "H-10e005a" (or an empty Buffer if not found). */
+	static Buffer getResponse(Text const& name) throw();
+	
+	/** @see HRTFSet::getNumResponses() */
+	static int getNumResponses() throw();
+	
+	/** @see HRTFSet::getResponseAtIndex() */
+	static Buffer getResponseAtIndex(const int index) throw();
+	
+	/** @see HRTFSet::getInterpolatedResponses() */
+	static int getInterpolatedResponses(const float azimuth, const float elevation, 
+										int* responseIndices, float* weights) throw();
 	
 private:
-	HRTF() throw();
-	void addResponse(Text const& key, const short* left, const short* right) throw();
-
-	Dictionary<Buffer> database;
+	HRTF();
 };
 
-#endif // _UGEN_ugen_HRTF_H_
\ No newline at end of file
+#endif // _UGEN_ugen_HRTF_H_
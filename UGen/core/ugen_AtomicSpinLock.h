@@ -0,0 +1,108 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_AtomicSpinLock_H_
+#define _UGEN_ugen_AtomicSpinLock_H_
+
+END_UGEN_NAMESPACE
+#if defined(_MSC_VER)
+	#include <intrin.h>
+	#define ugen_memoryBarrier() _ReadWriteBarrier()
+	#define ugen_atomicIncrement(value) _InterlockedIncrement((long volatile*)&(value))
+	#define ugen_atomicDecrement(value) _InterlockedDecrement((long volatile*)&(value))
+	#define ugen_atomicCompareAndSet(value, oldValue, newValue) (_InterlockedCompareExchange((long volatile*)&(value), (newValue), (oldValue)) == (oldValue))
+#else
+	#define ugen_memoryBarrier() __sync_synchronize()
+	#define ugen_atomicIncrement(value) __sync_add_and_fetch(&(value), 1)
+	#define ugen_atomicDecrement(value) __sync_sub_and_fetch(&(value), 1)
+	#define ugen_atomicCompareAndSet(value, oldValue, newValue) __sync_bool_compare_and_swap(&(value), (oldValue), (newValue))
+#endif
+BEGIN_UGEN_NAMESPACE
+
+/** A minimal spin lock built on the atomic macros above.
+ 
+ This is intended for short sections that guard shared lists which may be accessed from more 
+ than one thread (e.g., while rendering in parallel on a ThreadPool). It should never be held
+ while doing anything slow. Objects with static storage duration are usable before their 
+ constructor runs since the lock is unlocked when zero. @see ScopedAtomicSpinLock */
+class AtomicSpinLock
+{
+public:
+	AtomicSpinLock() throw() : lock(0) { }
+	
+	inline void enter() const throw()
+	{
+		while(!ugen_atomicCompareAndSet(lock, 0, 1))
+		{
+#if defined(UGEN_JUCE)
+			Thread::yield();
+#endif
+		}
+		
+		ugen_memoryBarrier();
+	}
+	
+	inline void exit() const throw()
+	{
+		ugen_memoryBarrier();
+		lock = 0;
+	}
+	
+private:
+	mutable volatile int lock;
+	
+	AtomicSpinLock (const AtomicSpinLock&);
+    const AtomicSpinLock& operator= (const AtomicSpinLock&);
+};
+
+/** Holds an AtomicSpinLock for the lifetime of the object. */
+class ScopedAtomicSpinLock
+{
+public:
+	inline ScopedAtomicSpinLock(AtomicSpinLock const& lockToUse) throw() : lock(lockToUse)	{ lock.enter(); }
+	inline ~ScopedAtomicSpinLock() throw()												{ lock.exit();	}
+	
+private:
+	AtomicSpinLock const& lock;
+	
+	ScopedAtomicSpinLock (const ScopedAtomicSpinLock&);
+    const ScopedAtomicSpinLock& operator= (const ScopedAtomicSpinLock&);
+};
+
+
+#endif // _UGEN_ugen_AtomicSpinLock_H_
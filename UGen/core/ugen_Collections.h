@@ -315,4 +315,339 @@ public:
 };
 
 
+/** Hash functions for HashDictionary keys.
+ The default casts numerical keys to an unsigned int and mixes the bits, other key
+ types need a specialisation (one is provided for Text). */
+template<class KeyType>
+class DictionaryHash
+{
+public:
+	static inline unsigned int hash(KeyType const& key) throw()
+	{
+		unsigned int h = (unsigned int)key;
+		h ^= h >> 16;
+		h *= 0x85ebca6bU;
+		h ^= h >> 13;
+		h *= 0xc2b2ae35U;
+		h ^= h >> 16;
+		return h;
+	}
+};
+
+/** Text keys are hashed using FNV-1a. */
+template<>
+class DictionaryHash<Text>
+{
+public:
+	static inline unsigned int hash(Text const& key) throw()
+	{
+		unsigned int h = 2166136261U;
+		const char* chars = key.getArray();
+		const int length = key.length();
+		
+		for(int i = 0; i < length && chars[i] != 0; i++)
+		{
+			h ^= (unsigned char)chars[i];
+			h *= 16777619U;
+		}
+		
+		return h;
+	}
+};
+
+template<class ValueType, class KeyType = Text>
+class HashDictionaryInternal : public SmartPointer
+{
+public:
+	enum SlotStates { Empty = -1 };
+	
+	HashDictionaryInternal() throw()
+	:	numSlots(0),
+		slots(0)
+	{
+		resizeSlots(16);
+	}
+	
+	~HashDictionaryInternal() throw()
+	{
+		delete [] slots;
+	}
+	
+	ObjectArray<ValueType>& getValues() throw()					{ return values;	}
+	ObjectArray<KeyType>& getKeys() throw()						{ return keys;		}
+	NumericalArray<unsigned int>& getHashes() throw()			{ return hashes;	}
+	const ObjectArray<ValueType>& getValues() const throw()		{ return values;	}
+	const ObjectArray<KeyType>& getKeys() const throw()			{ return keys;		}
+	const NumericalArray<unsigned int>& getHashes() const throw() { return hashes;	}
+	
+	/** Find the index of a key in the keys/values arrays (or -1 if not found). */
+	int find(KeyType const& key, const unsigned int keyHash) const throw()
+	{
+		const unsigned int mask = numSlots - 1;
+		const unsigned int* hashesPtr = hashes.getArray();
+		
+		for(unsigned int slot = keyHash & mask; ; slot = (slot + 1) & mask)
+		{
+			const int index = slots[slot];
+			
+			if(index == Empty) 
+				return -1;
+			
+			if(hashesPtr[index] == keyHash && keys[index] == key)
+				return index;
+		}
+	}
+	
+	/** Add a key/value that is known not to be present. */
+	int insert(KeyType const& key, const unsigned int keyHash, ValueType const& value) throw()
+	{
+		const int index = keys.length();
+		
+		keys.add(key);
+		values.add(value);
+		hashes.add(keyHash);
+		
+		if((index + 1) * 4 > numSlots * 3) // keep the load factor below 0.75
+			resizeSlots(numSlots * 2);
+		else
+			insertSlot(keyHash, index);
+		
+		return index;
+	}
+	
+	/** Remove the item at an index from the arrays and rebuild the slots. */
+	void removeIndex(const int index) throw()
+	{
+		keys.remove(index);
+		values.remove(index);
+		hashes.remove(index);
+		resizeSlots(numSlots);
+	}
+	
+private:
+	void insertSlot(const unsigned int keyHash, const int index) throw()
+	{
+		const unsigned int mask = numSlots - 1;
+		unsigned int slot = keyHash & mask;
+		
+		while(slots[slot] != Empty)
+			slot = (slot + 1) & mask;
+		
+		slots[slot] = index;
+	}
+	
+	void resizeSlots(const int newNumSlots) throw()
+	{
+		delete [] slots;
+		numSlots = newNumSlots;
+		slots = new int[numSlots];
+		
+		for(int i = 0; i < numSlots; i++)
+			slots[i] = Empty;
+		
+		const int numItems = hashes.length();
+		
+		for(int i = 0; i < numItems; i++)
+			insertSlot(hashes[i], i);
+	}
+	
+	ObjectArray<ValueType> values;
+	ObjectArray<KeyType> keys;
+	NumericalArray<unsigned int> hashes;
+	int numSlots;
+	int* slots; // indices into the arrays above, or Empty
+};
+
+/** A dictionary class for storing key/value pairs using an open-addressing hash table.
+ This has the same interface as Dictionary but looks up keys in (on average) constant time
+ rather than searching the array of keys. The hash of each key is stored so keys are only
+ compared when their hashes match. Keys that are used repeatedly can be hashed once using
+ hash() and then passed to the versions of contains(), at() and operator[] that take 
+ a precomputed hash. 
+ 
+ Items are still stored in arrays in the order they are added so getKeys(), getValues(),
+ key() and value() behave as for Dictionary.
+ 
+ @see Dictionary, DictionaryHash */
+template<class ValueType, class KeyType = Text>
+class HashDictionary : public SmartPointerContainer< HashDictionaryInternal<ValueType,KeyType> >
+{
+public:
+	typedef KeyValuePair<ValueType,KeyType> KeyValuePairType;
+	typedef ObjectArray<KeyValuePairType> KeyValuePairArrayType;
+	
+	/** Creates an empty dictionary. */
+	HashDictionary() throw()
+	:	SmartPointerContainer< HashDictionaryInternal<ValueType,KeyType> >
+		(new HashDictionaryInternal<ValueType,KeyType>())
+	{
+	}
+	
+	/** Creates a dictionary initialise with an array of key/value pairs. */
+	HashDictionary(KeyValuePairArrayType pairs) throw()
+	:	SmartPointerContainer< HashDictionaryInternal<ValueType,KeyType> >
+		(new HashDictionaryInternal<ValueType,KeyType>())
+	{
+		put(pairs);
+	}
+	
+	/** Compute the hash for a key. */
+	static inline unsigned int hash(KeyType const& key) throw()
+	{
+		return DictionaryHash<KeyType>::hash(key);
+	}
+	
+	/** Returns the array of values. */
+	const ObjectArray<ValueType>& getValues() const throw()
+	{ 
+		return this->getInternal()->getValues(); 
+	}
+	
+	/** Returns the array of keys. */
+	const ObjectArray<KeyType>& getKeys() const throw()
+	{
+		return this->getInternal()->getKeys(); 
+	}
+	
+	/** Returns an array of the key/value pairs. */
+	KeyValuePairArrayType getPairs() const throw()
+	{
+		KeyValuePairArrayType pairs = KeyValuePairArrayType::withSize(length());
+		
+		for(int i = 0; i < length(); i++)
+		{
+			pairs[i] = KeyValuePairType(key(i), value(i));
+		}
+		
+		return pairs;
+	}
+	
+	/** Put an item into the dicionary associated with the specified key. 
+	 If an item is already stored agains that key the old value is returned.
+	 Otherwise a "null" version of the value is returned. */
+	ValueType put(KeyType const& key, ValueType const& value) throw()
+	{
+		const unsigned int keyHash = hash(key);
+		const int index = this->getInternal()->find(key, keyHash);
+		
+		if(index >= 0)
+		{
+			ObjectArray<ValueType>& values = this->getInternal()->getValues();
+			ValueType oldValue = values[index];
+			values.put(index, value);
+			return oldValue;
+		}
+		else
+		{
+			this->getInternal()->insert(key, keyHash, value);
+			return ObjectArray<ValueType>::getNull();
+		}
+	}
+	
+	ValueType put(KeyValuePairType pair) throw()
+	{
+		return put(pair.getKey(), pair.getValue());
+	}
+	
+	void put(KeyValuePairArrayType pairs) throw()
+	{
+		for(int i = 0; i < pairs.length(); i++)
+		{
+			put(pairs[i]);
+		}
+	}
+	
+	/** Returns the index of a key or -1 if it is not found. */
+	inline int indexOf(KeyType const& key, const unsigned int keyHash) const throw()
+	{
+		return this->getInternal()->find(key, keyHash);
+	}
+	
+	inline int indexOf(KeyType const& key) const throw()		{ return indexOf(key, hash(key));			}
+	inline bool contains(KeyType const& key) const throw()		{ return indexOf(key) >= 0;					}
+	inline bool contains(KeyType const& key, const unsigned int keyHash) const throw()	
+																{ return indexOf(key, keyHash) >= 0;		}
+	
+	/** Return a value at the specified key.
+	 If the key is not found then a "null" version of the value is returned. */
+	ValueType& at(KeyType const& key) throw()					{ return value(indexOf(key));				}
+	const ValueType& at(KeyType const& key) const throw()		{ return value(indexOf(key));				}
+	ValueType& operator[](KeyType const& key) throw()			{ return value(indexOf(key));				}
+	const ValueType& operator[](KeyType const& key) const throw() { return value(indexOf(key));				}
+	
+	/** Return a value at the specified key using a hash precomputed with hash().
+	 If the key is not found then a "null" version of the value is returned. */
+	ValueType& at(KeyType const& key, const unsigned int keyHash) throw()				
+	{ 
+		return value(indexOf(key, keyHash));	
+	}
+	
+	const ValueType& at(KeyType const& key, const unsigned int keyHash) const throw()	
+	{ 
+		return value(indexOf(key, keyHash));	
+	}
+	
+	/** Remove and return an item at the specified key.
+	 If the key is not found then a "null" version of the value is returned. */
+	ValueType remove(KeyType const& key) throw()
+	{
+		const int index = indexOf(key);
+		
+		if(index >= 0)
+		{
+			ValueType removed = value(index);
+			this->getInternal()->removeIndex(index);
+			return removed;
+		}
+		else
+		{
+			return ObjectArray<ValueType>::getNull();
+		}
+	}
+	
+	/** Return the key for a particular value. */
+	const KeyType& keyForValue(ValueType const& value) const
+	{
+		int index = getValues().indexOf(value);
+		return key(index);
+	}
+	
+	/** Get a key at a particular index. */
+	KeyType& key(const int index) throw()
+	{
+		return this->getInternal()->getKeys()[index];
+	}
+	
+	/** Get a value at a particular index. */
+	ValueType& value(const int index) throw()
+	{
+		return this->getInternal()->getValues()[index];
+	}
+	
+	/** Get a key at a particular index. */
+	const KeyType& key(const int index) const throw()
+	{
+		return getKeys()[index];
+	}
+	
+	/** Get a value at a particular index. */
+	const ValueType& value(const int index) const throw()
+	{
+		return getValues()[index];
+	}
+	
+	/** Get the number of items stored in the dictionary. */
+	int length() const throw()
+	{
+		return getValues().length();
+	}
+	
+	/** Get the number of items stored in the dictionary. */
+	int size() const throw()
+	{
+		return getValues().size();
+	}
+};
+
+
 #endif // _UGEN_ugen_Collections_H_
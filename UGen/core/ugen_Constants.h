@@ -81,6 +81,9 @@ const double oneOver440			= 1.0 / 440.0;
 const double oneOver12			= 1.0 / 12.0;
 const double oneOver360			= 1.0 / 360.0;
 
+/** Level (about -160dB) below which the tails of filters with silent inputs are treated as having decayed. */
+const float silenceThreshold	= 1.0e-8f;
+
 //}
 
 #endif // _UGEN_ugen_Constants_H_
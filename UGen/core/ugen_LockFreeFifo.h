@@ -0,0 +1,183 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_LockFreeFifo_H_
+#define _UGEN_ugen_LockFreeFifo_H_
+
+#include "ugen_Bits.h"
+#include "ugen_AtomicSpinLock.h"
+#include "../basics/ugen_InlineBinaryOps.h"
+
+/** A single-producer, single-consumer lock-free FIFO.
+ 
+ This is intended to pass data from one thread to another without locking e.g., from 
+ the audio thread to a background thread or vice versa. Exactly one thread may call 
+ the write functions and exactly one (other) thread may call the read functions.
+ 
+ The storage is allocated once at construction time (rounded up to a power of 2 items)
+ so the read and write functions never allocate memory. Items are copied using 
+ their assignment operator so simple types or structs are most appropriate. */
+template<class ItemType>
+class LockFreeFifo
+{
+public:
+	/** Create a FIFO which can hold at least @c minimumCapacity items. */
+	LockFreeFifo(const int minimumCapacity) throw()
+	:	capacity((int)Bits::nextPowerOf2(minimumCapacity < 2 ? 2 : minimumCapacity)),
+		mask(capacity - 1),
+		items(new ItemType[capacity]),
+		readIndex(0),
+		writeIndex(0),
+		numDropped(0)
+	{
+	}
+	
+	~LockFreeFifo()
+	{
+		delete [] items;
+	}
+	
+	/** The total number of items the FIFO can hold. */
+	inline int getCapacity() const throw()		{ return capacity;								}
+	
+	/** The number of items available to be read. */
+	inline int getNumReady() const throw()		{ return (int)(writeIndex - readIndex);			}
+	
+	/** The number of items that can currently be written. */
+	inline int getFreeSpace() const throw()		{ return capacity - getNumReady();				}
+	
+	/** The number of write attempts that failed because the FIFO was full. */
+	inline int getNumDropped() const throw()	{ return numDropped;							}
+	inline void resetNumDropped() throw()		{ numDropped = 0;								}
+	
+	/** Write one item, returns false (and counts a drop) if the FIFO is full. */
+	bool write(ItemType const& item) throw()
+	{
+		if(getFreeSpace() < 1)
+		{
+			numDropped++;
+			return false;
+		}
+		
+		items[writeIndex & mask] = item;
+		ugen_memoryBarrier();
+		writeIndex++;
+		return true;
+	}
+	
+	/** Write a number of items.
+	 This writes either all of the items or none of them (and counts a drop) which
+	 allows multi-item frames to be kept intact. */
+	bool write(const ItemType* source, const int numItems) throw()
+	{
+		ugen_assert(numItems >= 0);
+		
+		if(getFreeSpace() < numItems)
+		{
+			numDropped++;
+			return false;
+		}
+		
+		const unsigned int start = writeIndex;
+		
+		for(int i = 0; i < numItems; i++)
+			items[(start + i) & mask] = source[i];
+		
+		ugen_memoryBarrier();
+		writeIndex = start + numItems;
+		return true;
+	}
+	
+	/** Read one item, returns false if the FIFO is empty. */
+	bool read(ItemType& item) throw()
+	{
+		if(getNumReady() < 1)
+			return false;
+		
+		ugen_memoryBarrier();
+		item = items[readIndex & mask];
+		ugen_memoryBarrier();
+		readIndex++;
+		return true;
+	}
+	
+	/** Read upto @c maximumItems items, returns the number actually read. */
+	int read(ItemType* destination, const int maximumItems) throw()
+	{
+		const int numItems = ugen::min(getNumReady(), maximumItems);
+		
+		if(numItems <= 0)
+			return 0;
+		
+		ugen_memoryBarrier();
+		
+		const unsigned int start = readIndex;
+		
+		for(int i = 0; i < numItems; i++)
+			destination[i] = items[(start + i) & mask];
+		
+		ugen_memoryBarrier();
+		readIndex = start + numItems;
+		return numItems;
+	}
+	
+	/** Get the next item without removing it, returns false if the FIFO is empty. */
+	bool peek(ItemType& item) const throw()
+	{
+		if(getNumReady() < 1)
+			return false;
+		
+		ugen_memoryBarrier();
+		item = items[readIndex & mask];
+		return true;
+	}
+	
+private:
+	const int capacity;
+	const unsigned int mask;
+	ItemType* const items;
+	volatile unsigned int readIndex;
+	volatile unsigned int writeIndex;
+	volatile int numDropped;
+	
+	LockFreeFifo (const LockFreeFifo&);
+    const LockFreeFifo& operator= (const LockFreeFifo&);
+};
+
+
+#endif // _UGEN_ugen_LockFreeFifo_H_
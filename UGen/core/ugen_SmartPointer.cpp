@@ -41,6 +41,7 @@ BEGIN_UGEN_NAMESPACE
 
 #include "ugen_UGen.h"
 #include "ugen_SmartPointer.h"
+#include "ugen_AtomicSpinLock.h"
 
 #define DEBUG_SmartPointer 0
 
@@ -85,17 +86,18 @@ SmartPointer::~SmartPointer()
 //	}
 //}
 //#else
+// the counts are atomic since objects may be copied and released on different threads
+// (e.g., Buffer objects loaded on a worker thread or events rendered on a ThreadPool)
 void SmartPointer::incrementRefCount()  throw()
 {	
-	if(active) ++refCount; 
+	if(active) ugen_atomicIncrement(refCount); 
 }
 
 void SmartPointer::decrementRefCount()  throw()
 { 
 	if(active)
 	{
-		--refCount; 
-		if(refCount == 0) 
+		if(ugen_atomicDecrement(refCount) == 0) 
 		{
 			active = false;
 			UGen::getDeleter()->deleteInternal(this);
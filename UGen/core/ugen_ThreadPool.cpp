@@ -0,0 +1,267 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#include "ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_ThreadPool.h"
+#include "ugen_AtomicSpinLock.h"
+#include "../basics/ugen_InlineBinaryOps.h"
+
+ThreadPool* volatile ThreadPool::shared = 0;
+int ThreadPool::sharedRefCount = 0;
+static volatile int hasOwnReference = 0;
+static AtomicSpinLock sharedLock;
+
+#if defined(UGEN_JUCE)
+/** Waits to be notified by its ThreadPool then runs jobs until there are none left. */
+class ThreadPoolThread : public Thread
+{
+public:
+	ThreadPoolThread(ThreadPool& poolToUse) throw()
+	:	Thread("ThreadPool"),
+		pool(poolToUse)
+	{
+	}
+	
+	void run()
+	{
+		while(!threadShouldExit())
+		{
+			wait(-1);
+			
+			if(threadShouldExit())
+				break;
+			
+			pool.joinRun();
+		}
+	}
+	
+private:
+	ThreadPool& pool;
+};
+#endif
+
+ThreadPool::ThreadPool(const int numThreadsToUse, const int threadPriority) throw()
+:	numThreads(0),
+	threads(0),
+	currentJob(0),
+	numJobs(0),
+	nextJob(0),
+	numJoined(Closed),
+	running(0)
+{
+	ugen_assert(numThreadsToUse >= 0);
+	
+#if defined(UGEN_JUCE)
+	numThreads = numThreadsToUse > 0 ? numThreadsToUse : 0;
+	finished = new WaitableEvent();
+	
+	if(numThreads > 0)
+	{
+		threads = new ThreadPoolThread*[numThreads];
+		
+		for(int i = 0; i < numThreads; i++)
+		{
+			threads[i] = new ThreadPoolThread(*this);
+			threads[i]->startThread(threadPriority);
+		}
+	}
+#else
+	(void)numThreadsToUse;
+	(void)threadPriority;
+#endif
+}
+
+ThreadPool::~ThreadPool()
+{
+#if defined(UGEN_JUCE)
+	for(int i = 0; i < numThreads; i++)
+	{
+		threads[i]->signalThreadShouldExit();
+		threads[i]->notify();
+		threads[i]->stopThread(4000);
+		delete threads[i];
+	}
+	
+	delete [] threads;
+	delete finished;
+#endif
+}
+
+void ThreadPool::runJobs() throw()
+{
+	ThreadPoolJob* const job = currentJob;
+	int index;
+	
+	while((index = ugen_atomicIncrement(nextJob) - 1) < numJobs)
+		job->runJob(index);
+}
+
+void ThreadPool::joinRun() throw()
+{
+#if defined(UGEN_JUCE)
+	// a worker woken too late finds the run closed and goes back to waiting
+	int joined;
+	
+	do
+	{
+		joined = numJoined;
+		
+		if(joined & Closed)
+			return;
+	}
+	while(!ugen_atomicCompareAndSet(numJoined, joined, joined + 1));
+	
+	runJobs();
+	
+	if(ugen_atomicDecrement(numJoined) == Closed)
+		finished->signal();
+#endif
+}
+
+void ThreadPool::run(ThreadPoolJob& job, const int numJobsToRun) throw()
+{
+	if(numJobsToRun <= 0)
+		return;
+	
+	if(numThreads == 0 || numJobsToRun == 1 || !ugen_atomicCompareAndSet(running, 0, 1))
+	{
+		// no threads, nothing to share or called from one of our own jobs
+		for(int index = 0; index < numJobsToRun; index++)
+			job.runJob(index);
+		
+		return;
+	}
+	
+#if defined(UGEN_JUCE)
+	currentJob = &job;
+	numJobs = numJobsToRun;
+	nextJob = 0;
+	ugen_memoryBarrier();
+	numJoined = 0; // open the run to the workers
+	ugen_memoryBarrier();
+	
+	for(int i = 0; i < numThreads; i++)
+		threads[i]->notify();
+	
+	runJobs();
+	
+	// close the run, then wait only for the workers which joined it
+	int joined;
+	
+	do
+	{
+		joined = numJoined;
+	}
+	while(!ugen_atomicCompareAndSet(numJoined, joined, joined | Closed));
+	
+	// the event may still be signalled from a previous run so check the count too
+	while(numJoined != Closed)
+		finished->wait(-1);
+	
+	currentJob = 0;
+	running = 0;
+#endif
+}
+
+ThreadPool* ThreadPool::retainShared() throw()
+{
+	const ScopedAtomicSpinLock sl(sharedLock);
+	
+	if(shared == 0)
+	{
+#if defined(UGEN_JUCE)
+		ThreadPool* const pool = new ThreadPool(ugen::max(0, SystemStats::getNumCpus() - 1));
+#else
+		ThreadPool* const pool = new ThreadPool(0);
+#endif
+		ugen_memoryBarrier(); // the pool must be complete before other threads can see it
+		shared = pool;
+	}
+	
+	sharedRefCount++;
+	
+	return shared;
+}
+
+void ThreadPool::releaseShared() throw()
+{
+	ThreadPool* pool = 0;
+	
+	{
+		const ScopedAtomicSpinLock sl(sharedLock);
+		
+		ugen_assert(sharedRefCount > 0);
+		
+		if(--sharedRefCount == 0)
+		{
+			pool = shared;
+			shared = 0;
+		}
+	}
+	
+	delete pool; // stopping the threads may take a while so this is done outside the lock
+}
+
+void ThreadPool::createShared() throw()
+{
+	// UGen++ holds one reference itself between UGen::initialise() and UGen::shutdown()
+	if(ugen_atomicCompareAndSet(hasOwnReference, 0, 1))
+		retainShared();
+}
+
+ThreadPool& ThreadPool::getShared() throw()
+{
+	if(shared == 0)
+	{
+		ugen_assertfalse; // UGen::initialise() should have created the pool
+		createShared();
+	}
+	
+	return *shared;
+}
+
+void ThreadPool::deleteShared() throw()
+{
+	if(ugen_atomicCompareAndSet(hasOwnReference, 1, 0))
+		releaseShared();
+}
+
+END_UGEN_NAMESPACE
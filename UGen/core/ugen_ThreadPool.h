@@ -0,0 +1,127 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_ThreadPool_H_
+#define _UGEN_ugen_ThreadPool_H_
+
+/** A job for a ThreadPool.
+ The job is run once for each index from 0 to the number of jobs passed to ThreadPool::run(), 
+ these may be run at the same time on different threads. */
+class ThreadPoolJob
+{
+public:
+	virtual ~ThreadPoolJob() { }
+	virtual void runJob(const int index) throw() = 0;
+};
+
+class ThreadPoolThread;
+
+/** A fixed set of worker threads for running short jobs in parallel e.g., during an audio callback.
+ 
+ ThreadPool::run() hands out the job indices to the worker threads and the calling thread 
+ using an atomic counter and returns when all of them have finished. The threads are created 
+ once at construction time and wait between calls to run(). Workers join a run when they wake,
+ once the calling thread has finished its own share it closes the run to latecomers and only 
+ waits for the workers which joined (and so may still be running jobs).
+ 
+ Threads are only available in Juce builds, otherwise (or if the pool has no threads, or if 
+ run() is called from inside a job on the same pool) the jobs are run in turn on the calling thread. 
+ @see SpawnBaseUGenInternal */
+class ThreadPool
+{
+public:
+	/** Create a pool with a number of worker threads (in addition to the thread calling run()).
+	 @param numThreads		The number of worker threads.
+	 @param threadPriority	The priority of the worker threads (as for the Juce Thread class, 0-10), 
+							the default is the highest since the audio thread waits for them. Use
+							a lower priority for pools used for offline processing. */
+	ThreadPool(const int numThreads, const int threadPriority = 10) throw();
+	~ThreadPool();
+	
+	inline int getNumThreads() const throw()	{ return numThreads; }
+	
+	/** Run a job for the indices 0 to numJobs-1 and wait for them all to finish. */
+	void run(ThreadPoolJob& job, const int numJobs) throw();
+	
+	/** Get a pool shared by the whole application with one thread for each processor after the first. 
+	 The pool is created by UGen::initialise(). This doesn't add a reference so the result must not 
+	 be kept, use retainShared() for that. */
+	static ThreadPool& getShared() throw();
+	
+	/** Get the shared pool and add a reference to it, this keeps it alive (even after UGen::shutdown())
+	 until the reference is removed with releaseShared(). */
+	static ThreadPool* retainShared() throw();
+	
+	/** Remove a reference added by retainShared(), the pool is stopped and deleted with its last reference. */
+	static void releaseShared() throw();
+	
+	/** Create the shared pool if it doesn't exist yet and add UGen++'s own reference to it (if it
+	 doesn't already hold it), this is called by UGen::initialise(). */
+	static void createShared() throw();
+	
+	/** Remove the reference added by createShared(), this is called by UGen::shutdown(). The pool is 
+	 stopped and deleted unless something else still has a reference (e.g., a parallel Spawn in 
+	 another plugin instance). */
+	static void deleteShared() throw();
+	
+private:
+	friend class ThreadPoolThread;
+	
+	enum { Closed = 0x40000000 };
+	
+	void runJobs() throw();
+	void joinRun() throw();
+	
+	int numThreads;
+	ThreadPoolThread** threads;
+	ThreadPoolJob* volatile currentJob;
+	volatile int numJobs;
+	volatile int nextJob;
+	volatile int numJoined;	// the workers running jobs, or'ed with Closed when no more may join
+	volatile int running;
+	
+#if defined(UGEN_JUCE)
+	WaitableEvent* finished;
+#endif
+	
+	static ThreadPool* volatile shared;
+	static int sharedRefCount;
+};
+
+
+#endif // _UGEN_ugen_ThreadPool_H_
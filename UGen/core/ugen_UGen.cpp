@@ -53,6 +53,12 @@ BEGIN_UGEN_NAMESPACE
 #include "../filters/control/ugen_Lag.h"
 #include "../envelopes/ugen_EnvGen.h"
 #include "../buffers/ugen_PlayBuf.h"
+#include "ugen_ThreadPool.h"
+#include "../buffers/ugen_BufferDispatcher.h"
+
+#if defined(UGEN_HRTF)
+	#include "../convolution/ugen_BinauralPan.h"
+#endif
 
 #ifndef UGEN_ANDROID
 	#include "../spawn/ugen_VoicerBase.h"
@@ -962,6 +968,16 @@ float* UGen::processBlock(bool& shouldDelete, const unsigned int blockID, const
 	}
 	
 }
+
+const UGenOutput* UGen::processControlBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
+{
+	ugen_assert(numInternalUGens > 0);
+	ugen_assert(internalUGens != 0);
+	ugen_assert(channel >= 0);
+	
+	unsigned int internalChannel = (unsigned int)channel % numInternalUGens;		
+	return internalUGens[internalChannel]->processControlBlockInternal(shouldDelete, blockID, channel);
+}
  
 void UGen::prepareForBlock(const int actualBlockSize, const unsigned int blockID, const int channel) throw()
 {	
@@ -1318,6 +1334,22 @@ void UGen::removeBufferReceiver(UGen const& receiverUGen) throw()
 #endif
 }
 
+UGen& UGen::setBufferSendersDeferred(const bool shouldDefer) throw()
+{
+#if !defined(UGEN_ANDROID) || defined(UGEN_JUCE)
+	for(unsigned int i = 0; i < numInternalUGens; i++)
+	{
+		BufferSender* sender = dynamic_cast<BufferSender*> (internalUGens[i]);
+		
+		if(sender != 0) sender->setDeferred(shouldDefer);
+	}
+#else
+	(void)shouldDefer;
+#endif
+	
+	return *this;
+}
+
 UGen& UGen::addDoneActionReceiver(DoneActionReceiver* const receiver) throw()
 {
 #if !defined(UGEN_ANDROID) || defined(UGEN_JUCE)
@@ -1546,6 +1578,36 @@ bool UGen::setPositions(DoubleArray const& newPositions) throw()
 //#endif
 
 
+void UGen::initialise() throw()
+{
+	if(isInitialised == false)
+	{
+		isInitialised = true;			
+		ugen_debugprintf(("UGen++ v%d.%d.%d\n", UGEN_MAJOR_VERSION, UGEN_MINOR_VERSION, UGEN_BUILDNUMBER));
+		ThreadPool::createShared();
+		BufferDispatcher::createShared();
+	}
+}
+
+void UGen::shutdown() throw()
+{ 
+	getDeleter()->flush();
+	setDeleter(&defaultDeleter);
+	
+	ThreadPool::deleteShared();
+	BufferDispatcher::deleteShared();
+	
+#if defined(UGEN_HRTF)
+	BinauralPanSpectra::deleteUnused();
+#endif
+	
+#ifdef JUCE_VERSION
+//		#include "../juce/io/ugen_JuceMIDIInputBroadcaster.h"
+//		JuceMIDIInputBroadcaster::deleteInstance();
+#endif
+	isInitialised = false;
+}
+
 void UGen::prepareToPlay(const double sampleRate, const int estimatedSamplesPerBlock, const int newControlRateBlockSize) throw()
 {	
 	if(sampleRate > 0.0)
@@ -198,6 +198,7 @@
 			UGenInternal* getKr() throw()					{ incrementRefCount(); return this; }							\
 			float getValue(const int channel) const throw()	{ (void)channel; return value;		}							\
 			void setValue(const float newValue) throw()		{ value = newValue;					}							\
+			void initValue(const float newValue) throw()	{ value = newValue; UGENINTERNAL_NAME::initValue(newValue); }	\
 			void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();					\
 		private:																											\
 			float value;																									\
@@ -692,6 +693,18 @@ public:
 				is processing all channels. */
 	float* processBlock(bool& shouldDelete, const unsigned int blockID, const int channel = -1) throw();
 	
+	/** Processes a single channel in this UGen for a control rate consumer.
+	 
+	 This is similar to processBlock() but control rate UGenInternal objects are not expanded to 
+	 a full block of samples. The returned output should be read using UGenOutput::getControlValue()
+	 which works for both control rate and audio rate outputs.
+	 
+	 @param shouldDelete		See processBlock().
+	 @param blockID				The current block ID.
+	 @param channel				The channel index to process (this must not be -1).
+	 @return	The output of the UGenInternal for this channel. */
+	const UGenOutput* processControlBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
 	/** Prepares for a block then processes it.
 	 
 	 This is the normal way of processing a block of audio to/from another host using UGen++.
@@ -890,6 +903,11 @@ public:
 	UGen& addBufferReceiver(UGen const& receiver) throw();
 	void removeBufferReceiver(UGen const& receiver) throw();
 	
+	/** Set whether any BufferSender internals (e.g., in a Sender or FFTSender) deliver their 
+	 Buffer objects on the BufferDispatcher's thread rather than the audio thread.
+	 @see BufferSender::setDeferred() */
+	UGen& setBufferSendersDeferred(const bool shouldDefer = true) throw();
+	
 	//#if defined(UGEN_IPHONE) || defined(DOXYGEN)
 	//	void addBufferReceiver(UIScopeView* receiver) throw();
 	//	void removeBufferReceiver(UIScopeView* receiver) throw();
@@ -1000,32 +1018,20 @@ public:
 	
 	/** Shutdown UGen++.
 	 This should be done as application is closing down (or a plugin is being removed from a host).
+	 This releases UGen++'s references to the shared ThreadPool and BufferDispatcher, these are 
+	 kept while any parallel Spawn or deferred BufferSender (e.g., in another plugin instance) 
+	 still uses them.
 	 @see initialise
 	 */
-	inline static void				shutdown() throw()							
-	{ 
-		getDeleter()->flush();
-		setDeleter(&defaultDeleter);
-		
-#ifdef JUCE_VERSION
-//		#include "../juce/io/ugen_JuceMIDIInputBroadcaster.h"
-//		JuceMIDIInputBroadcaster::deleteInstance();
-#endif
-		isInitialised = false;
-	}
+	static void shutdown() throw();
 	
 	/** Initialise UGen++.
 	 This should be called as soon as possible when an application or plugin loads.
+	 This creates the shared ThreadPool and BufferDispatcher (see ThreadPool::getShared() and 
+	 BufferDispatcher::getShared()) so neither is created on the audio thread.
 	 @see shutdown
 	 */
-	inline static void initialise() throw()
-	{
-		if(isInitialised == false)
-		{
-			isInitialised = true;			
-			ugen_debugprintf(("UGen++ v%d.%d.%d\n", UGEN_MAJOR_VERSION, UGEN_MINOR_VERSION, UGEN_BUILDNUMBER));
-		}
-	}
+	static void initialise() throw();
 	
 	
 	
@@ -1219,6 +1225,18 @@ public:
 	
 	inline float poll(const int index = 0) throw()							{ return internalUGens[index % numInternalUGens]->poll(index);						}
 	
+	/** Returns true if a channel was marked as silent (all zeros) in the block most recently processed.
+	 
+	 Consumers may call this after processBlock() to skip processing of silent inputs.
+	 @param		index	The index of the UGenInternal, larger values will be wrapped to the number of channels. */
+	inline bool isSilent(const int index = 0) const throw()				{ return internalUGens[index % numInternalUGens]->getOutputPtr()->isSilent();		}
+	
+	/** Returns true if a channel was marked as constant in the block most recently processed.
+	 
+	 This is also true for silent blocks. 
+	 @param		index	The index of the UGenInternal, larger values will be wrapped to the number of channels. */
+	inline bool isConstant(const int index = 0) const throw()				{ return internalUGens[index % numInternalUGens]->getOutputPtr()->isConstant();		}
+	
 	
 	/** Defines actions to be done at the end of an event e.g., a line or envelope. */
 	enum DoneAction
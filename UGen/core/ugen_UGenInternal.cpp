@@ -42,6 +42,7 @@ BEGIN_UGEN_NAMESPACE
 #include "ugen_UGenInternal.h"
 #include "ugen_UGen.h"
 #include "ugen_UGenArray.h"
+#include "ugen_AtomicSpinLock.h"
 #include "../basics/ugen_ScalarUGens.h"
 
 
@@ -52,7 +53,17 @@ UGenOutput::UGenOutput() throw()
 	allocatedBlockSize(blockSize),
 	block(blockSize <= 0 ? 0 : new float[blockSize]),
 	usingExternalOutput(false),
-	externalOutput(0)
+	controlInterpolate(true),
+	controlDataExpanded(false),
+	silentBlock(false),
+	constantBlock(false),
+	externalOutput(0),
+	controlValues(0),
+	numControlValues(0),
+	allocatedControlValues(0),
+	controlBlockSize(1),
+	controlPhase(0),
+	initialControlValue(0.f)
 {
 	ugen_assert(blockSize > 0);
 	initValue(0.f);
@@ -63,16 +74,115 @@ UGenOutput::~UGenOutput()
 	if(usingExternalOutput == false)
 		delete [] block;
 	
+	delete [] controlValues;
+	
 	block = 0;
 	blockSize = 0;
 	allocatedBlockSize = 0;
 	externalOutput = 0;
+	controlValues = 0;
+	numControlValues = 0;
+	allocatedControlValues = 0;
 }
 
 void UGenOutput::initValue(const float value) throw()
 {
 	if(block)
 		block[blockSize-1] = value;
+	
+	initialControlValue = value;
+	numControlValues = 0;
+}
+
+int UGenOutput::beginControlBlock(const unsigned int blockID, const bool interpolate) throw()
+{
+	const int krBlockSize = UGen::getControlRateBlockSize();
+	const int phase = blockID % krBlockSize;
+	
+	float previousValue, currentValue;
+	
+	if(numControlValues == 0)
+	{
+		previousValue = initialControlValue;
+		currentValue = initialControlValue;
+	}
+	else
+	{
+		previousValue = controlValues[numControlValues-2];
+		currentValue = controlValues[numControlValues-1];
+	}
+	
+	const int requiredControlValues = (blockSize + krBlockSize - 1) / krBlockSize + 2;
+	
+	if(requiredControlValues > allocatedControlValues)
+	{
+		delete [] controlValues;
+		allocatedControlValues = requiredControlValues;
+		controlValues = new float[allocatedControlValues];
+	}
+	
+	controlBlockSize = krBlockSize;
+	controlPhase = phase;
+	controlInterpolate = interpolate;
+	controlDataExpanded = false;
+	numControlValues = (blockSize + phase - 1) / krBlockSize + 2;
+	
+	if(phase == 0)
+	{
+		// a ramp starts on the first sample of this block
+		controlValues[0] = currentValue;
+		return 1;
+	}
+	else
+	{
+		// continue the ramp which started in the previous block
+		controlValues[0] = previousValue;
+		controlValues[1] = currentValue;
+		return 2;
+	}
+}
+
+void UGenOutput::expandControlDataInternal() throw()
+{
+	float* outputSamples = block;
+	int numSamplesToProcess = blockSize;
+	int numKrSamples = controlBlockSize - controlPhase;
+	int position = controlPhase;
+	int index = 1;
+	
+	while(numSamplesToProcess > 0)
+	{
+		if(numKrSamples > numSamplesToProcess) 
+			numKrSamples = numSamplesToProcess;
+		
+		numSamplesToProcess -= numKrSamples;
+		
+		const float nextValue = controlValues[index];
+		const float previousValue = controlValues[index-1];
+		
+		if(controlInterpolate == false || nextValue == previousValue)
+		{
+			while(numKrSamples--)
+				*outputSamples++ = nextValue;
+		}
+		else
+		{
+			const float valueSlope = (nextValue - previousValue) / (float)controlBlockSize;
+			float value = previousValue + valueSlope * (float)position;
+			
+			while(numKrSamples--)
+			{
+				*outputSamples++ = value;
+				value += valueSlope;
+			}
+		}
+		
+		numKrSamples = controlBlockSize;
+		position = 0;
+		++index;
+	}
+	
+	controlDataExpanded = true;
 }
 
 void UGenOutput::useExternalOutput(UGenOutput* externalOutputToUse)
@@ -235,11 +345,21 @@ UGenInternal* UGenInternal::getKr() throw()
 
 
 float* UGenInternal::processBlockInternal(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
+{
+	processControlBlockInternal(shouldDelete, blockID, channel);
+	uGenOutput.expandControlData();
+	return uGenOutput.getSampleData();
+}
+
+const UGenOutput* UGenInternal::processControlBlockInternal(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
 {
 	if(blockID != lastBlockID)
 	{
 		processBlock(shouldDelete, blockID, channel);
 		
+		if(uGenOutput.hasControlData())
+			uGenOutput.updateControlDataFlags();
+		
 		if(isScheduledForDeletion == false && shouldDelete == true)
 		{
 			isScheduledForDeletion = true;
@@ -249,7 +369,7 @@ float* UGenInternal::processBlockInternal(bool& shouldDelete, const unsigned int
 		lastBlockID = blockID;
 	}
 	
-	return uGenOutput.getSampleData();
+	return &uGenOutput;
 }
 
 const UGen& UGenInternal::getInput(const int index) throw()
@@ -335,6 +455,10 @@ float UGenInternal::getValue(const int /*channel*/) const throw()
 { 
 	const int blockSize = uGenOutput.getBlockSize();
 	
+	// compact control data is not written to the sample block unless an audio rate consumer needs it
+	if(uGenOutput.hasControlData() && (blockSize > 0))
+		return uGenOutput.getLastRenderedValue();
+	
 	if(blockSize > 0)
 	{
 		const float *samples = uGenOutput.getSampleData();
@@ -395,7 +519,7 @@ ProxyOwnerUGenInternal::~ProxyOwnerUGenInternal()// throw()
 //#else
 void ProxyOwnerUGenInternal::decrementRefCount()  throw()
 {
-	refCount--;
+	ugen_atomicDecrement(refCount);
 	deleteIfOnlyMutualReferencesRemain();
 }
 //#endif
@@ -495,7 +619,7 @@ void ProxyUGenInternal::decrementRefCount() throw()
 {
 	ugen_assert(refCount > 0);
 	
-	refCount--;
+	ugen_atomicDecrement(refCount);
 	owner_->deleteIfOnlyMutualReferencesRemain();
 }
 //#endif
@@ -76,6 +76,9 @@ public:
 				block = new float[allocatedBlockSize];
 			}
 		}
+		
+		silentBlock = false;
+		constantBlock = false;
 	}
 	//void optimiseBlockSize(); // reduce block sizes to minimum
 	
@@ -87,12 +90,128 @@ public:
 	void useExternalOutput(UGenOutput* externalOutputToUse);
 	void useExternalOutput(float* externalOutputToUse, const int externalBlockSize);
 	
+	/** Mark this block as silent (i.e., all zeros) or not.
+	 
+	 Producers which know their output is all zeros (e.g., a finished envelope, a stopped 
+	 PlayBuf or a Null) set this so that consumers can skip work. The flags are cleared in 
+	 prepareForBlock() but producers which set them should also clear them explicitly when 
+	 their output is no longer silent. */
+	inline void setSilent(const bool state)				{ silentBlock = state; constantBlock = state;		}
+	
+	/** Mark this block as having a constant value in all samples (or not). */
+	inline void setConstant(const bool state)			{ constantBlock = state; silentBlock = false;		}
+	
+	/** Zero the block and mark it as silent. */
+	inline void setSilentAndClear()
+	{
+		zeroAllData();
+		setSilent(true);
+	}
+	
+	inline bool isSilent() const						{ return silentBlock;		}
+	inline bool isConstant() const						{ return constantBlock;		}
+	
+	/** Start a block of compact control rate data.
+	 
+	 Control rate UGenInternal subclasses call this from processBlock() instead of writing
+	 every sample. Control value i is evaluated at sample position getControlValuePosition(i) 
+	 (i.e., on a control rate block boundary) and the output ramps (or steps) from value i-1 to 
+	 value i over the following UGen::getControlRateBlockSize() samples. The values needed to 
+	 continue a ramp which started in a previous block are carried over.
+	 
+	 @param blockID		The block ID being processed.
+	 @param interpolate	If true the output ramps linearly between control values, otherwise
+						each value is held until the next control rate block boundary.
+	 @return			The index of the first control value which needs to be computed, 
+						values from this index up to getNumControlValues()-1 should be written 
+						to getControlValues(). */
+	int beginControlBlock(const unsigned int blockID, const bool interpolate = true) throw();
+	
+	inline bool hasControlData() const					{ return numControlValues > 0;	}
+	inline int getNumControlValues() const				{ return numControlValues;		}
+	inline float* getControlValues() const				{ return controlValues;			}
+	
+	/** Returns the sample position in the current block of a control value. */
+	inline int getControlValuePosition(const int index) const 
+	{ 
+		return (index - 1) * controlBlockSize - controlPhase; 
+	}
+	
+	/** Returns the output value at a sample position in the current block.
+	 
+	 This reads the compact control data without expanding it (if this output has control data) 
+	 otherwise it simply returns the sample from the block. */
+	inline float getControlValue(const int sampleIndex) const
+	{
+		ugen_assert(sampleIndex >= 0 && sampleIndex < blockSize);
+		
+		if(numControlValues == 0 || controlDataExpanded)
+			return block[sampleIndex];
+		
+		const int offset = controlPhase + sampleIndex;
+		const int index = offset / controlBlockSize + 1;
+		
+		if(controlInterpolate == false)
+			return controlValues[index];
+		
+		const float from = controlValues[index-1];
+		return from + (controlValues[index] - from) * (float)(offset - (index - 1) * controlBlockSize) / (float)controlBlockSize;
+	}
+	
+	/** Returns the value of the last sample in the current block.
+	 This is the value downstream UGens saw at the end of the block, the last compact control value 
+	 is the target of the ramp which continues into the next block. */
+	inline float getLastRenderedValue() const
+	{
+		return getControlValue(blockSize - 1);
+	}
+	
+	/** Set the constant and silent flags from the compact control data. */
+	inline void updateControlDataFlags()
+	{
+		const float firstValue = controlValues[0];
+		
+		for(int i = 1; i < numControlValues; i++)
+		{
+			if(controlValues[i] != firstValue)
+			{
+				setSilent(false);
+				return;
+			}
+		}
+		
+		if(firstValue == 0.f)
+			setSilent(true);
+		else
+			setConstant(true);
+	}
+	
+	/** Write the compact control data to the sample block (if it has not been done already this block). */
+	inline void expandControlData()
+	{
+		if(numControlValues > 0 && controlDataExpanded == false)
+			expandControlDataInternal();
+	}
+	
 private:
+	void expandControlDataInternal() throw();
+	
 	int blockSize;
 	int allocatedBlockSize;
 	float *block;
 	bool usingExternalOutput:1;
+	bool controlInterpolate:1;
+	bool controlDataExpanded:1;
+	bool silentBlock:1;
+	bool constantBlock:1;
 	UGenOutput* externalOutput;
+	
+	float *controlValues;
+	int numControlValues;
+	int allocatedControlValues;
+	int controlBlockSize;
+	int controlPhase;
+	float initialControlValue;
 };
 
 
@@ -181,6 +300,13 @@ public:
 	
 	virtual float* processBlockInternal(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
 	
+	/** Process this block if necessary but leave any compact control rate data unexpanded.
+	 
+	 Control rate consumers use this to read their inputs with UGenOutput::getControlValue() 
+	 so that chains of control rate UGenInternal objects are only evaluated once per control 
+	 rate block rather than once per sample. */
+	const UGenOutput* processControlBlockInternal(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
 	/** Process a block of samples for this blockID and channel.
 	 
 	 This is the main rendering function and needs to be implement by all subclasses.
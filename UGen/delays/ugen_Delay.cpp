@@ -51,15 +51,21 @@ DelayBaseUGenInternal::DelayBaseUGenInternal(const int numInputs,
 											 UGen const& input, 
 											 UGen const& delayTime, 
 											 Buffer const& delayBuffer,
-											 const bool isMultiTap) throw()
+											 const bool isMultiTap,
+											 const Interpolation::Mode interpolationToUse) throw()
 :	ProxyOwnerUGenInternal(numInputs, isMultiTap ? delayTime.getNumChannels()-1 : 0),
 	delayBuffer_(delayBuffer),
 	delayBufferSize(delayBuffer_.size()),
 	bufferSamples(delayBuffer_.getData(0)),
-	bufferWritePos(0)
+	bufferWritePos(0),
+	numSilentSamples(0),
+	interpolation(interpolationToUse)
 {
 	inputs[Input] = input;
 	inputs[DelayTime] = delayTime;
+	
+	if(interpolation == Interpolation::Sinc)
+		Interpolation::initialise();
 }
 
 DelayNUGenInternal::DelayNUGenInternal(UGen const& input, UGen const& delayTime, Buffer const& delayBuffer) throw()
@@ -81,6 +87,19 @@ void DelayNUGenInternal::processBlock(bool& shouldDelete, const unsigned int blo
 	float* outputSamples = uGenOutput.getSampleData();
 	float* inputSamples = inputs[Input].processBlock(shouldDelete, blockID, channel);
 	float* delayTimeSamples = inputs[DelayTime].processBlock(shouldDelete, blockID, channel);
+	
+	if(hasTailDrained(inputs[Input].isSilent(channel), numSamplesToProcess))
+	{
+		uGenOutput.setSilentAndClear();
+		return;
+	}
+	
+	uGenOutput.setSilent(false);
+	
+	if(isDelayTimeConstant(inputs[DelayTime], channel, delayTimeSamples, numSamplesToProcess) &&
+	   processDelayBlock(outputSamples, inputSamples, (float)ugen::max(0, (int)(*delayTimeSamples * sampleRate)), numSamplesToProcess))
+		return;
+	
 	LOCAL_DECLARE(float * const, bufferSamples);
 	LOCAL_DECLARE(const double, delayBufferSize);
 	LOCAL_DECLARE(int, bufferWritePos);
@@ -132,6 +151,21 @@ void DelayNMultiUGenInternal::processBlock(bool& shouldDelete, const unsigned in
 	float* outputSamples = uGenOutput.getSampleData();
 	float* inputSamples = inputs[Input].processBlock(shouldDelete, blockID, 0);
 	float* delayTimeSamples = inputs[DelayTime].processBlock(shouldDelete, blockID, 0);
+	
+	if(hasTailDrained(inputs[Input].isSilent(0), numSamplesToProcess))
+	{
+		for(int channel = 0; channel < getNumChannels(); channel++)
+		{
+			inputs[DelayTime].processBlock(shouldDelete, blockID, channel);
+			proxies[channel]->getOutputRef().setSilentAndClear();
+		}
+		
+		return;
+	}
+	
+	for(int channel = 0; channel < getNumChannels(); channel++)
+		proxies[channel]->getOutputRef().setSilent(false);
+	
 	LOCAL_DECLARE(float * const, bufferSamples);
 	LOCAL_DECLARE(const double, delayBufferSize);
 		
@@ -195,8 +229,11 @@ void DelayNMultiUGenInternal::processBlock(bool& shouldDelete, const unsigned in
 }
 
 
-DelayLUGenInternal::DelayLUGenInternal(UGen const& input, UGen const& delayTime, Buffer const& delayBuffer) throw()
-:	DelayBaseUGenInternal(NumInputs, input, delayTime, delayBuffer, false)
+DelayLUGenInternal::DelayLUGenInternal(UGen const& input, 
+									   UGen const& delayTime, 
+									   Buffer const& delayBuffer, 
+									   const Interpolation::Mode interpolation) throw()
+:	DelayBaseUGenInternal(NumInputs, input, delayTime, delayBuffer, false, interpolation)
 { 
 }
 
@@ -204,7 +241,8 @@ UGenInternal* DelayLUGenInternal::getChannel(const int channel) throw()
 {
 	return new DelayLUGenInternal(inputs[Input].getChannel(channel), 
 								  inputs[DelayTime].getChannel(channel), 
-								  Buffer(BufferSpec(delayBuffer_.size(), 1, true)));
+								  Buffer(BufferSpec(delayBuffer_.size(), 1, true)),
+								  interpolation);
 }
 
 void DelayLUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
@@ -214,9 +252,23 @@ void DelayLUGenInternal::processBlock(bool& shouldDelete, const unsigned int blo
 	float* outputSamples = uGenOutput.getSampleData();
 	float* inputSamples = inputs[Input].processBlock(shouldDelete, blockID, channel);
 	float* delayTimeSamples = inputs[DelayTime].processBlock(shouldDelete, blockID, channel);
+	
+	if(hasTailDrained(inputs[Input].isSilent(channel), numSamplesToProcess))
+	{
+		uGenOutput.setSilentAndClear();
+		return;
+	}
+	
+	uGenOutput.setSilent(false);
+	
+	if(isDelayTimeConstant(inputs[DelayTime], channel, delayTimeSamples, numSamplesToProcess) &&
+	   processDelayBlock(outputSamples, inputSamples, ugen::max(getMinimumDelay(), *delayTimeSamples * sampleRate), numSamplesToProcess))
+		return;
+	
 	LOCAL_DECLARE(float * const, bufferSamples);
 	LOCAL_DECLARE(const double, delayBufferSize);
 	LOCAL_DECLARE(int, bufferWritePos);
+	const float minimumDelay = getMinimumDelay();
 		
 	while(numSamplesToProcess > 0)
 	{
@@ -229,11 +281,11 @@ void DelayLUGenInternal::processBlock(bool& shouldDelete, const unsigned int blo
 		{
 			bufferSamples[bufferWritePos] = *inputSamples++;
 			
-			float bufferReadPos = (float)bufferWritePos - ugen::max(0.f, *delayTimeSamples++ * sampleRate);
+			float bufferReadPos = (float)bufferWritePos - ugen::max(minimumDelay, *delayTimeSamples++ * sampleRate);
 			if(bufferReadPos < 0.f)
 				bufferReadPos += (float)delayBufferSize;
 			
-			*outputSamples++ = lookupIndexL(bufferReadPos);
+			*outputSamples++ = lookupIndex(bufferReadPos);
 			
 			bufferWritePos++;
 		}
@@ -245,8 +297,11 @@ void DelayLUGenInternal::processBlock(bool& shouldDelete, const unsigned int blo
 	LOCAL_COPY(bufferWritePos);
 }
 
-DelayLMultiUGenInternal::DelayLMultiUGenInternal(UGen const& input, UGen const& delayTime, Buffer const& delayBuffer) throw()
-:	DelayBaseUGenInternal(NumInputs, input, delayTime, delayBuffer, true)
+DelayLMultiUGenInternal::DelayLMultiUGenInternal(UGen const& input, 
+												 UGen const& delayTime, 
+												 Buffer const& delayBuffer, 
+												 const Interpolation::Mode interpolation) throw()
+:	DelayBaseUGenInternal(NumInputs, input, delayTime, delayBuffer, true, interpolation)
 { 
 }
 
@@ -254,7 +309,8 @@ UGenInternal* DelayLMultiUGenInternal::getChannel(const int channel) throw()
 {
 	return new DelayLMultiUGenInternal(inputs[Input].getChannel(channel), 
 									   inputs[DelayTime].getChannel(channel), 
-									   delayBuffer_);
+									   delayBuffer_,
+									   interpolation);
 }
 
 void DelayLMultiUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
@@ -265,8 +321,24 @@ void DelayLMultiUGenInternal::processBlock(bool& shouldDelete, const unsigned in
 	float* outputSamples = uGenOutput.getSampleData();
 	float* inputSamples = inputs[Input].processBlock(shouldDelete, blockID, 0);
 	float* delayTimeSamples = inputs[DelayTime].processBlock(shouldDelete, blockID, 0);
+	
+	if(hasTailDrained(inputs[Input].isSilent(0), numSamplesToProcess))
+	{
+		for(int channel = 0; channel < getNumChannels(); channel++)
+		{
+			inputs[DelayTime].processBlock(shouldDelete, blockID, channel);
+			proxies[channel]->getOutputRef().setSilentAndClear();
+		}
+		
+		return;
+	}
+	
+	for(int channel = 0; channel < getNumChannels(); channel++)
+		proxies[channel]->getOutputRef().setSilent(false);
+	
 	LOCAL_DECLARE(float * const, bufferSamples);
 	LOCAL_DECLARE(const double, delayBufferSize);
+	const float minimumDelay = getMinimumDelay();
 		
 	int bufferWritePos = this->bufferWritePos;
 	while(numSamplesToProcess > 0)
@@ -280,11 +352,11 @@ void DelayLMultiUGenInternal::processBlock(bool& shouldDelete, const unsigned in
 		{
 			bufferSamples[bufferWritePos] = *inputSamples++;
 			
-			float bufferReadPos = (float)bufferWritePos - ugen::max(0.f, *delayTimeSamples++ * sampleRate);
+			float bufferReadPos = (float)bufferWritePos - ugen::max(minimumDelay, *delayTimeSamples++ * sampleRate);
 			if(bufferReadPos < 0.f)
 				bufferReadPos += (float)delayBufferSize;
 			
-			*outputSamples++ = lookupIndexL(bufferReadPos);
+			*outputSamples++ = lookupIndex(bufferReadPos);
 			
 			bufferWritePos++;
 		}
@@ -310,11 +382,11 @@ void DelayLMultiUGenInternal::processBlock(bool& shouldDelete, const unsigned in
 
 			while(numFramesThisTime--)
 			{
-				float bufferReadPos = (float)bufferWritePos - ugen::max(0.f, *delayTimeSamples++ * sampleRate);
+				float bufferReadPos = (float)bufferWritePos - ugen::max(minimumDelay, *delayTimeSamples++ * sampleRate);
 				if(bufferReadPos < 0.f)
 					bufferReadPos += (float)delayBufferSize;
 				
-				*outputSamples++ = lookupIndexL(bufferReadPos);
+				*outputSamples++ = lookupIndex(bufferReadPos);
 				
 				bufferWritePos++;
 			}
@@ -330,8 +402,9 @@ void DelayLMultiUGenInternal::processBlock(bool& shouldDelete, const unsigned in
 RecircBaseUGenInternal::RecircBaseUGenInternal(UGen const& input, 
 											   UGen const& delayTime, 
 											   UGen const& decayTime, 
-											   Buffer const& delayBuffer) throw()
-:	DelayBaseUGenInternal(NumInputs, input, delayTime, delayBuffer, false),
+											   Buffer const& delayBuffer,
+											   const Interpolation::Mode interpolation) throw()
+:	DelayBaseUGenInternal(NumInputs, input, delayTime, delayBuffer, false, interpolation),
 	currentDelay(0.f),
 	currentDecay(0.f),
 	feedback(0.f)
@@ -377,6 +450,10 @@ void CombNUGenInternal::processBlock(bool& shouldDelete, const unsigned int bloc
 		LOCAL_COPY(feedback);
 	}
 	
+	if(isDelayTimeConstant(inputs[DelayTime], channel, delayTimeSamples, numSamplesToProcess) &&
+	   processRecircBlock(outputSamples, inputSamples, (float)ugen::max(1, (int)(*delayTimeSamples * sampleRate)), numSamplesToProcess, false))
+		return;
+	
 	while(numSamplesToProcess > 0)
 	{
 		int bufferSamplesRemaining = delayBufferSize - bufferWritePos;
@@ -410,8 +487,9 @@ void CombNUGenInternal::processBlock(bool& shouldDelete, const unsigned int bloc
 CombLUGenInternal::CombLUGenInternal(UGen const& input, 
 									 UGen const& delayTime, 
 									 UGen const& decayTime, 
-									 Buffer const& delayBuffer) throw()
-:	RecircBaseUGenInternal(input, delayTime, decayTime, delayBuffer)
+									 Buffer const& delayBuffer, 
+									 const Interpolation::Mode interpolation) throw()
+:	RecircBaseUGenInternal(input, delayTime, decayTime, delayBuffer, interpolation)
 {
 }
 
@@ -420,7 +498,8 @@ UGenInternal* CombLUGenInternal::getChannel(const int channel) throw()
 	return new CombLUGenInternal(inputs[Input].getChannel(channel), 
 								 inputs[DelayTime].getChannel(channel),
 								 inputs[DecayTime].getChannel(channel),
-								 Buffer(BufferSpec(delayBuffer_.size(), 1, true)));
+								 Buffer(BufferSpec(delayBuffer_.size(), 1, true)),
+								 interpolation);
 }
 
 void CombLUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
@@ -447,6 +526,12 @@ void CombLUGenInternal::processBlock(bool& shouldDelete, const unsigned int bloc
 		LOCAL_COPY(feedback);
 	}
 	
+	if(isDelayTimeConstant(inputs[DelayTime], channel, delayTimeSamples, numSamplesToProcess) &&
+	   processRecircBlock(outputSamples, inputSamples, ugen::max(getMinimumDelay(), *delayTimeSamples * sampleRate), numSamplesToProcess, false))
+		return;
+	
+	const float minimumDelay = getMinimumDelay();
+	
 	while(numSamplesToProcess > 0)
 	{
 		int bufferSamplesRemaining = delayBufferSize - bufferWritePos;
@@ -456,11 +541,11 @@ void CombLUGenInternal::processBlock(bool& shouldDelete, const unsigned int bloc
 		
 		while(numSamplesThisTime--)
 		{
-			float bufferReadPos = (float)bufferWritePos - ugen::max(1.f, *delayTimeSamples++ * sampleRate);
+			float bufferReadPos = (float)bufferWritePos - ugen::max(minimumDelay, *delayTimeSamples++ * sampleRate);
 			if(bufferReadPos < 0.f)
 				bufferReadPos += (float)delayBufferSize;
 			
-			float value = lookupIndexL(bufferReadPos);
+			float value = lookupIndex(bufferReadPos);
 			
 			bufferSamples[bufferWritePos] = value * feedback + *inputSamples++;// + denom;
 			//denom *= -1.f;
@@ -534,6 +619,10 @@ void AllpassNUGenInternal::processBlock(bool& shouldDelete, const unsigned int b
 	
 	float currentDelayMax1 = ugen::max(1.f, currentDelay);
 	
+	// the delay time is only read once per block so the block path can always be tried
+	if(processRecircBlock(outputSamples, inputSamples, (float)(int)currentDelayMax1, numSamplesToProcess, true))
+		return;
+	
 	while(numSamplesToProcess > 0)
 	{
 		int bufferSamplesRemaining = delayBufferSize - bufferWritePos;
@@ -567,8 +656,9 @@ void AllpassNUGenInternal::processBlock(bool& shouldDelete, const unsigned int b
 AllpassLUGenInternal::AllpassLUGenInternal(UGen const& input, 
 										   UGen const& delayTime, 
 										   UGen const& decayTime, 
-										   Buffer const& delayBuffer) throw()
-:	RecircBaseUGenInternal(input, delayTime, decayTime, delayBuffer)
+										   Buffer const& delayBuffer, 
+										   const Interpolation::Mode interpolation) throw()
+:	RecircBaseUGenInternal(input, delayTime, decayTime, delayBuffer, interpolation)
 {
 }
 
@@ -577,7 +667,8 @@ UGenInternal* AllpassLUGenInternal::getChannel(const int channel) throw()
 	return new AllpassLUGenInternal(inputs[Input].getChannel(channel), 
 									inputs[DelayTime].getChannel(channel),
 									inputs[DecayTime].getChannel(channel),
-									Buffer(BufferSpec(delayBuffer_.size(), 1, true)));
+									Buffer(BufferSpec(delayBuffer_.size(), 1, true)),
+									interpolation);
 }
 
 void AllpassLUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
@@ -621,7 +712,11 @@ void AllpassLUGenInternal::processBlock(bool& shouldDelete, const unsigned int b
 		LOCAL_COPY(feedback);
 	}
 	
-	float currentDelayMax1 = ugen::max(1.f, currentDelay);
+	float currentDelayMax1 = ugen::max(getMinimumDelay(), currentDelay);
+	
+	// the delay time is only read once per block so the block path can always be tried
+	if(processRecircBlock(outputSamples, inputSamples, currentDelayMax1, numSamplesToProcess, true))
+		return;
 	
 	while(numSamplesToProcess > 0)
 	{
@@ -636,7 +731,7 @@ void AllpassLUGenInternal::processBlock(bool& shouldDelete, const unsigned int b
 			if(bufferReadPos < 0.f)
 				bufferReadPos += (float)delayBufferSize;
 			
-			float inValue = lookupIndexL(bufferReadPos);
+			float inValue = lookupIndex(bufferReadPos);
 			float outValue = inValue * feedback + *inputSamples++;// + denom;
 			//denom *= -1.f;
 			
@@ -707,7 +802,10 @@ DelayN::DelayN(UGen const& input, const float maximumDelayTime, UGen const& dela
 	}
 }
 
-DelayL::DelayL(UGen const& input, const float maximumDelayTime, UGen const& delayTime) throw()
+DelayL::DelayL(UGen const& input, 
+			   const float maximumDelayTime, 
+			   UGen const& delayTime, 
+			   const Interpolation::Mode interpolation) throw()
 {
 	ugen_assert(maximumDelayTime >= 0.f);
 	
@@ -718,7 +816,7 @@ DelayL::DelayL(UGen const& input, const float maximumDelayTime, UGen const& dela
 	{
 		initInternal(numDelayTimeChannels);
 		Buffer delayBuffer(BufferSpec(int(UGen::getSampleRate() * maximumDelayTime) + 1, 1, true));
-		generateFromProxyOwner(new DelayLMultiUGenInternal(input, delayTime, delayBuffer));
+		generateFromProxyOwner(new DelayLMultiUGenInternal(input, delayTime, delayBuffer, interpolation));
 	}
 	else if(numDelayTimeChannels > numInputChannels)
 	{
@@ -735,7 +833,8 @@ DelayL::DelayL(UGen const& input, const float maximumDelayTime, UGen const& dela
 			{
 				proxyOwner = new DelayLMultiUGenInternal(input[inputChannel], 
 														 delayTime[delayChannel], 
-														 delayBuffers[inputChannel]);
+														 delayBuffers[inputChannel],
+														 interpolation);
 				internalUGens[delayChannel] = proxyOwner;
 			}
 			else
@@ -755,7 +854,7 @@ DelayL::DelayL(UGen const& input, const float maximumDelayTime, UGen const& dela
 		for(unsigned int i = 0; i < numInternalUGens; i++)
 		{
 			Buffer delayBuffer(BufferSpec(int(UGen::getSampleRate() * maximumDelayTime) + 1, 1, true));
-			internalUGens[i] = new DelayLUGenInternal(input, delayTime, delayBuffer);
+			internalUGens[i] = new DelayLUGenInternal(input, delayTime, delayBuffer, interpolation);
 		}	
 	}
 }
@@ -777,7 +876,11 @@ CombN::CombN(UGen const& input, const float maximumDelayTime, UGen const& delayT
 	}	
 }
 
-CombL::CombL(UGen const& input, const float maximumDelayTime, UGen const& delayTime, UGen const& decayTime) throw()
+CombL::CombL(UGen const& input, 
+			 const float maximumDelayTime, 
+			 UGen const& delayTime, 
+			 UGen const& decayTime, 
+			 const Interpolation::Mode interpolation) throw()
 {
 	ugen_assert(maximumDelayTime >= 0.f);
 	
@@ -790,7 +893,8 @@ CombL::CombL(UGen const& input, const float maximumDelayTime, UGen const& delayT
 		internalUGens[i] = new CombLUGenInternal(input, 
 												 delayTime,//Clip(delayTime, 0.f, maximumDelayTime),
 												 decayTime,
-												 Buffer(BufferSpec(int(UGen::getSampleRate() * maximumDelayTime) + 1, 1, true)));
+												 Buffer(BufferSpec(int(UGen::getSampleRate() * maximumDelayTime) + 1, 1, true)),
+												 interpolation);
 	}	
 }
 
@@ -811,7 +915,11 @@ AllpassN::AllpassN(UGen const& input, const float maximumDelayTime, UGen const&
 	}	
 }
 
-AllpassL::AllpassL(UGen const& input, const float maximumDelayTime, UGen const& delayTime, UGen const& decayTime) throw()
+AllpassL::AllpassL(UGen const& input, 
+				   const float maximumDelayTime, 
+				   UGen const& delayTime, 
+				   UGen const& decayTime, 
+				   const Interpolation::Mode interpolation) throw()
 {
 	ugen_assert(maximumDelayTime >= 0.f);
 	
@@ -824,7 +932,8 @@ AllpassL::AllpassL(UGen const& input, const float maximumDelayTime, UGen const&
 		internalUGens[i] = new AllpassLUGenInternal(input, 
 													delayTime,//Clip(delayTime, 0.f, maximumDelayTime),
 													decayTime,
-													Buffer(BufferSpec(int(UGen::getSampleRate() * maximumDelayTime) + 1, 1, true)));
+													Buffer(BufferSpec(int(UGen::getSampleRate() * maximumDelayTime) + 1, 1, true)),
+													interpolation);
 	}	
 }
 
@@ -954,16 +1063,22 @@ void TapOutNUGenInternal::processBlock(bool& shouldDelete, const unsigned int bl
 	}	
 }
 
-TapOutLUGenInternal::TapOutLUGenInternal(Buffer const& buffer, UGen const& delayTime) throw()
+TapOutLUGenInternal::TapOutLUGenInternal(Buffer const& buffer, 
+										 UGen const& delayTime, 
+										 const Interpolation::Mode interpolation) throw()
 :	ProxyOwnerUGenInternal(NumInputs, ugen::max(buffer.getNumChannels(), delayTime.getNumChannels())-1),	
-	buffer_(buffer)
+	buffer_(buffer),
+	interpolation_(interpolation)
 {
 	inputs[DelayTime] = delayTime;
+	
+	if(interpolation_ == Interpolation::Sinc)
+		Interpolation::initialise();
 }
 
 UGenInternal* TapOutLUGenInternal::getChannel(const int channel) throw()
 {
-	return new TapOutLUGenInternal(buffer_.getChannel(channel), inputs[DelayTime].getChannel(channel));	
+	return new TapOutLUGenInternal(buffer_.getChannel(channel), inputs[DelayTime].getChannel(channel), interpolation_);	
 }
 
 void TapOutLUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
@@ -981,7 +1096,7 @@ void TapOutLUGenInternal::processBlock(bool& shouldDelete, const unsigned int bl
 		{
 			memset(outputSamples, 0, blockSize * sizeof(float));
 		}
-		else
+		else if(interpolation_ == Interpolation::Linear)
 		{
 			const float floatBlockSize = blockSize;
 			int numSamplesToProcess = blockSize;
@@ -1000,6 +1115,28 @@ void TapOutLUGenInternal::processBlock(bool& shouldDelete, const unsigned int bl
 					channelBufferPos -= bufferSize;
 			}	
 		}
+		else
+		{
+			// the extra points after the read position must have been written by the TapIn too
+			const float minimumDelay = blockSize + Interpolation::getNumPointsAfter(interpolation_) - 1;
+			const int intBufferSize = buffer_.size();
+			int numSamplesToProcess = blockSize;
+			const float* bufferSamples = buffer_.getData(channel % buffer_.getNumChannels());
+			const float* delayTimeSamples = inputs[DelayTime].processBlock(shouldDelete, blockID, channel);
+			
+			while(numSamplesToProcess--) 
+			{				
+				float delay = ugen::max(minimumDelay, *delayTimeSamples++ * sampleRate);
+				float bufferReadPos = channelBufferPos - delay;
+				if(bufferReadPos < 0.f)
+					bufferReadPos += bufferSize;
+				const int index = (int)bufferReadPos;
+				*outputSamples++ = Interpolation::lookup(interpolation_, bufferSamples, intBufferSize, index, bufferReadPos - (float)index);
+				channelBufferPos += 1.f;
+				if(channelBufferPos >= bufferSize)
+					channelBufferPos -= bufferSize;
+			}	
+		}
 	}	
 }
 
@@ -1013,14 +1150,14 @@ TapOutN::TapOutN(Buffer const& buffer, UGen const& delayTime) throw()
 	generateFromProxyOwner(new TapOutNUGenInternal(buffer, delayTime));	
 }
 
-TapOutL::TapOutL(Buffer const& buffer, UGen const& delayTime) throw()
+TapOutL::TapOutL(Buffer const& buffer, UGen const& delayTime, const Interpolation::Mode interpolation) throw()
 {
 	ugen_assert(buffer.size() > 0);
 	ugen_assert(buffer.getNumChannels() > 0);
 	
 	const int numChannels = ugen::max(buffer.getNumChannels(), delayTime.getNumChannels());
 	initInternal(numChannels);
-	generateFromProxyOwner(new TapOutLUGenInternal(buffer, delayTime));	
+	generateFromProxyOwner(new TapOutLUGenInternal(buffer, delayTime, interpolation));	
 }
 
 
@@ -42,6 +42,7 @@
 #include "../core/ugen_Constants.h"
 #include "../core/ugen_Value.h"
 #include "../basics/ugen_Chain.h"
+#include "../buffers/ugen_Interpolation.h"
 
 /** @ingroup UGenInternals */
 class DelayBaseUGenInternal : public ProxyOwnerUGenInternal
@@ -51,13 +52,201 @@ public:
 						  UGen const& input, 
 						  UGen const& delayTime, 
 						  Buffer const& delayBuffer, 
-						  const bool isMultiTap) throw();
+						  const bool isMultiTap,
+						  const Interpolation::Mode interpolation = Interpolation::Linear) throw();
 	UGenInternal* getChannel(const int channel) throw() = 0;		// final subclasses now MUST implment this..						
 	
 	enum Inputs { Input, DelayTime, NumInputs };
 	
 protected:
 
+	/** Keeps track of how long the input has been silent.
+	 
+	 @return true if the input has been silent for at least the length of the delay buffer,
+			 in which case the buffer contains only zeros and the block need not be processed. */
+	inline bool hasTailDrained(const bool inputIsSilent, const int numSamples) throw()
+	{
+		if(inputIsSilent == false)
+		{
+			numSilentSamples = 0;
+			return false;
+		}
+		
+		if(numSilentSamples >= delayBufferSize)
+			return true;
+		
+		numSilentSamples += numSamples;
+		return false;
+	}
+	
+	/** Returns true if the delay time is the same for the whole block.
+	 
+	 In this case the block fast paths below can be used rather than computing a read position 
+	 for each sample. */
+	static inline bool isDelayTimeConstant(UGen const& delayTime, 
+										   const int channel, 
+										   const float* delayTimeSamples, 
+										   const int numSamples) throw()
+	{
+		if(delayTime.isConstant(channel))
+			return true;
+		
+		const float firstValue = delayTimeSamples[0];
+		
+		for(int i = 1; i < numSamples; i++)
+		{
+			if(delayTimeSamples[i] != firstValue)
+				return false;
+		}
+		
+		return true;
+	}
+	
+	/** Wrap a (possibly negative) read position into the delay buffer. */
+	inline int wrapBufferPos(int bufferPos) const throw()
+	{
+		const int bufferSize = (int)delayBufferSize;
+		
+		if(bufferPos < 0)
+			bufferPos += bufferSize;
+		else if(bufferPos >= bufferSize)
+			bufferPos -= bufferSize;
+		
+		return bufferPos;
+	}
+	
+	/** Copy a block of samples into the delay buffer at the write position, 
+	 in at most two segments, and advance the write position. */
+	inline void writeBlock(const float* inputSamples, int numSamples) throw()
+	{
+		const int bufferSize = (int)delayBufferSize;
+		
+		while(numSamples > 0)
+		{
+			const int numSamplesThisTime = ugen::min(numSamples, bufferSize - bufferWritePos);
+			memcpy(bufferSamples + bufferWritePos, inputSamples, numSamplesThisTime * sizeof(float));
+			inputSamples += numSamplesThisTime;
+			numSamples -= numSamplesThisTime;
+			bufferWritePos += numSamplesThisTime;
+			
+			if(bufferWritePos >= bufferSize)
+				bufferWritePos = 0;
+		}
+	}
+	
+	/** Copy a block of samples from the delay buffer, in at most two segments. */
+	inline void readBlockN(float* outputSamples, int bufferReadPos, int numSamples) throw()
+	{
+		const int bufferSize = (int)delayBufferSize;
+		
+		while(numSamples > 0)
+		{
+			const int numSamplesThisTime = ugen::min(numSamples, bufferSize - bufferReadPos);
+			memcpy(outputSamples, bufferSamples + bufferReadPos, numSamplesThisTime * sizeof(float));
+			outputSamples += numSamplesThisTime;
+			numSamples -= numSamplesThisTime;
+			bufferReadPos = 0;
+		}
+	}
+	
+	/** Read a block of samples from the delay buffer using linear interpolation with a fixed
+	 fraction between each sample and the next, in at most two segments. */
+	inline void readBlockL(float* outputSamples, int bufferReadPos, const float frac, int numSamples) throw()
+	{
+		const int bufferSize = (int)delayBufferSize;
+		
+		while(numSamples > 0)
+		{
+			if(bufferReadPos == bufferSize - 1)
+			{
+				// interpolate across the end of the buffer
+				const float value0 = bufferSamples[bufferReadPos];
+				*outputSamples++ = value0 + frac * (bufferSamples[0] - value0);
+				bufferReadPos = 0;
+				--numSamples;
+			}
+			else
+			{
+				const int numSamplesThisTime = ugen::min(numSamples, bufferSize - 1 - bufferReadPos);
+				const float* samples = bufferSamples + bufferReadPos;
+				
+				for(int i = 0; i < numSamplesThisTime; ++i)
+					outputSamples[i] = samples[i] + frac * (samples[i+1] - samples[i]);
+				
+				outputSamples += numSamplesThisTime;
+				numSamples -= numSamplesThisTime;
+				bufferReadPos += numSamplesThisTime;
+			}
+		}
+	}
+	
+	/** Read a block of samples from the delay buffer using the cubic or sinc interpolation mode 
+	 with a fixed fraction between each sample and the next. */
+	inline void readBlockI(float* outputSamples, int bufferReadPos, const float frac, const int numSamples) throw()
+	{
+		const int bufferSize = (int)delayBufferSize;
+		
+		if(interpolation == Interpolation::Cubic)
+		{
+			for(int i = 0; i < numSamples; ++i)
+			{
+				outputSamples[i] = Interpolation::cubic(bufferSamples, bufferSize, bufferReadPos, frac);
+				if(++bufferReadPos == bufferSize) bufferReadPos = 0;
+			}
+		}
+		else
+		{
+			for(int i = 0; i < numSamples; ++i)
+			{
+				outputSamples[i] = Interpolation::sinc(bufferSamples, bufferSize, bufferReadPos, frac);
+				if(++bufferReadPos == bufferSize) bufferReadPos = 0;
+			}
+		}
+	}
+	
+	/** Read a block of samples delayed by a constant (fractional) number of samples relative to writePos. */
+	inline void readBlockDelayed(float* outputSamples, const int writePos, const float delaySamples, const int numSamples) throw()
+	{
+		const int integerDelay = (int)delaySamples;
+		const float frac = delaySamples - (float)integerDelay;
+		
+		if(frac == 0.f)
+			readBlockN(outputSamples, wrapBufferPos(writePos - integerDelay), numSamples);
+		else if(interpolation == Interpolation::Linear)
+			readBlockL(outputSamples, wrapBufferPos(writePos - integerDelay - 1), 1.f - frac, numSamples);
+		else
+			readBlockI(outputSamples, wrapBufferPos(writePos - integerDelay - 1), 1.f - frac, numSamples);
+	}
+	
+	/** Process a block with a constant delay, writing each chunk to the delay buffer before reading.
+	 @return false if the delay is too long for this (in which case the block should be processed per sample). */
+	inline bool processDelayBlock(float* outputSamples, 
+								  const float* inputSamples, 
+								  const float delaySamples, 
+								  int numSamplesToProcess) throw()
+	{
+		// chunks must not overwrite samples yet to be read from the other end of the buffer
+		const int maxSamplesThisTime = (int)delayBufferSize - (int)delaySamples - 2 - Interpolation::getNumPointsBefore(interpolation);
+		
+		if(maxSamplesThisTime <= 0)
+			return false;
+		
+		while(numSamplesToProcess > 0)
+		{
+			const int numSamplesThisTime = ugen::min(numSamplesToProcess, maxSamplesThisTime);
+			const int writePos = bufferWritePos;
+			
+			writeBlock(inputSamples, numSamplesThisTime);
+			readBlockDelayed(outputSamples, writePos, delaySamples, numSamplesThisTime);
+			
+			outputSamples += numSamplesThisTime;
+			inputSamples += numSamplesThisTime;
+			numSamplesToProcess -= numSamplesThisTime;
+		}
+		
+		return true;
+	}
+	
 	// perhaps move these lookups to Buffer?
 	inline float lookupIndexN(const int index)
 	{
@@ -82,34 +271,29 @@ protected:
 		return value0 + frac * (value1 - value0);
 	}
 	
-	// 0 is one ahead, 1 is this, 2 is on behind, 3 is two behind
-	//static float cubicinterp(float x, float y0, float y1, float y2, float y3)
-	inline float lookupIndexC(const float fIndex)
+	/** Read from the delay buffer using the interpolation mode of this delay. */
+	inline float lookupIndex(const float fIndex)
 	{
-		const int iIndex1 = (int)fIndex;
-		const int iIndex0 = iIndex1+1;
-		const int iIndex2 = iIndex1-1;
-		const int iIndex3 = iIndex1-2;
-		const float y0 = bufferSamples[iIndex0];
-		const float y1 = bufferSamples[iIndex1];
-		const float y2 = bufferSamples[iIndex2];
-		const float y3 = bufferSamples[iIndex3];
+		if(interpolation == Interpolation::Linear)
+			return lookupIndexL(fIndex);
 		
-		const float frac = fIndex - iIndex1;
-		
-		// 4-point, 3rd-order Hermite (x-form)
-		float c0 = y1;
-		float c1 = 0.5f * (y2 - y0);
-		float c2 = y0 - 2.5f * y1 + 2.f * y2 - 0.5f * y3;
-		float c3 = 0.5f * (y3 - y0) + 1.5f * (y1 - y2);
-		
-		return ((c3 * frac + c2) * frac + c1) * frac + c0;
+		const int iIndex = (int)fIndex;
+		return Interpolation::lookup(interpolation, bufferSamples, (int)delayBufferSize, iIndex, fIndex - (float)iIndex);
+	}
+	
+	/** The shortest delay (in samples) which reads only samples already written to the buffer, 
+	 where the input sample is written before the delayed sample is read. */
+	inline float getMinimumDelay() const throw()
+	{
+		return (float)(Interpolation::getNumPointsAfter(interpolation) - 1);
 	}
 	
 	Buffer delayBuffer_;
 	const double delayBufferSize;
 	float *bufferSamples;
 	int bufferWritePos;
+	int numSilentSamples;
+	const Interpolation::Mode interpolation;
 };
 
 /** @ingroup UGenInternals */
@@ -135,7 +319,10 @@ public:
 class DelayLUGenInternal : public DelayBaseUGenInternal
 {
 public:
-	DelayLUGenInternal(UGen const& input, UGen const& delayTime, Buffer const& delayBuffer) throw();
+	DelayLUGenInternal(UGen const& input, 
+					   UGen const& delayTime, 
+					   Buffer const& delayBuffer, 
+					   const Interpolation::Mode interpolation = Interpolation::Linear) throw();
 	UGenInternal* getChannel(const int channel) throw();
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
 };
@@ -144,7 +331,10 @@ public:
 class DelayLMultiUGenInternal : public DelayBaseUGenInternal
 {
 public:
-	DelayLMultiUGenInternal(UGen const& input, UGen const& delayTime, Buffer const& delayBuffer) throw();
+	DelayLMultiUGenInternal(UGen const& input, 
+							UGen const& delayTime, 
+							Buffer const& delayBuffer, 
+							const Interpolation::Mode interpolation = Interpolation::Linear) throw();
 	UGenInternal* getChannel(const int channel) throw();
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
 };
@@ -157,7 +347,8 @@ public:
 	RecircBaseUGenInternal(UGen const& input, 
 						   UGen const& delayTime, 
 						   UGen const& decayTime, 
-						   Buffer const& delayBuffer) throw();
+						   Buffer const& delayBuffer,
+						   const Interpolation::Mode interpolation = Interpolation::Linear) throw();
 	
 	enum Inputs { Input, DelayTime, DecayTime, NumInputs };
 	
@@ -192,6 +383,100 @@ protected:
 	}	
 #endif
 	
+	/** Write the comb filter recirculation for a block which has already been read from the delay buffer. */
+	inline void writeCombBlock(const float* delayedSamples, const float* inputSamples, int numSamples) throw()
+	{
+		const int bufferSize = (int)delayBufferSize;
+		
+		while(numSamples > 0)
+		{
+			const int numSamplesThisTime = ugen::min(numSamples, bufferSize - bufferWritePos);
+			float* samples = bufferSamples + bufferWritePos;
+			
+			for(int i = 0; i < numSamplesThisTime; ++i)
+				samples[i] = delayedSamples[i] * feedback + inputSamples[i];
+			
+			delayedSamples += numSamplesThisTime;
+			inputSamples += numSamplesThisTime;
+			numSamples -= numSamplesThisTime;
+			bufferWritePos += numSamplesThisTime;
+			
+			if(bufferWritePos >= bufferSize)
+				bufferWritePos = 0;
+		}
+	}
+	
+	/** Write the allpass recirculation for a block which has already been read from the delay buffer 
+	 into outputSamples, outputSamples is then replaced with the allpass output. */
+	inline void writeAllpassBlock(float* outputSamples, const float* inputSamples, int numSamples) throw()
+	{
+		const int bufferSize = (int)delayBufferSize;
+		
+		while(numSamples > 0)
+		{
+			const int numSamplesThisTime = ugen::min(numSamples, bufferSize - bufferWritePos);
+			float* samples = bufferSamples + bufferWritePos;
+			
+			for(int i = 0; i < numSamplesThisTime; ++i)
+			{
+				const float outValue = outputSamples[i] * feedback + inputSamples[i];
+				samples[i] = outValue;
+				outputSamples[i] -= feedback * outValue;
+			}
+			
+			outputSamples += numSamplesThisTime;
+			inputSamples += numSamplesThisTime;
+			numSamples -= numSamplesThisTime;
+			bufferWritePos += numSamplesThisTime;
+			
+			if(bufferWritePos >= bufferSize)
+				bufferWritePos = 0;
+		}
+	}
+	
+	/** Process a comb or allpass block with a constant delay, reading each chunk before writing.
+	 @return false if the delay is too short or too long for this (in which case the block 
+			 should be processed per sample). */
+	inline bool processRecircBlock(float* outputSamples, 
+								   const float* inputSamples, 
+								   const float delaySamples, 
+								   int numSamplesToProcess, 
+								   const bool isAllpass) throw()
+	{
+		// chunks must be no longer than the delay so every read is of samples written in previous chunks
+		const int integerDelay = (int)delaySamples;
+		const int maxSamplesThisTime = ugen::min(integerDelay + 1 - Interpolation::getNumPointsAfter(interpolation), 
+												 (int)delayBufferSize - integerDelay - 2 - Interpolation::getNumPointsBefore(interpolation));
+		
+		if(maxSamplesThisTime <= 0)
+			return false;
+		
+		while(numSamplesToProcess > 0)
+		{
+			const int numSamplesThisTime = ugen::min(numSamplesToProcess, maxSamplesThisTime);
+			
+			readBlockDelayed(outputSamples, bufferWritePos, delaySamples, numSamplesThisTime);
+			
+			if(isAllpass)
+				writeAllpassBlock(outputSamples, inputSamples, numSamplesThisTime);
+			else
+				writeCombBlock(outputSamples, inputSamples, numSamplesThisTime);
+			
+			outputSamples += numSamplesThisTime;
+			inputSamples += numSamplesThisTime;
+			numSamplesToProcess -= numSamplesThisTime;
+		}
+		
+		return true;
+	}
+	
+	/** The shortest delay (in samples) which reads only samples already written to the buffer, 
+	 where the delayed sample is read before the recirculated sample is written. */
+	inline float getMinimumDelay() const throw()
+	{
+		return (float)Interpolation::getNumPointsAfter(interpolation);
+	}
+	
 	float currentDelay;
 	float currentDecay;
 	float feedback;
@@ -211,7 +496,11 @@ public:
 class CombLUGenInternal : public RecircBaseUGenInternal
 {
 public:
-	CombLUGenInternal(UGen const& input, UGen const& delayTime, UGen const& decayTime, Buffer const& delayBuffer) throw();
+	CombLUGenInternal(UGen const& input, 
+					  UGen const& delayTime, 
+					  UGen const& decayTime, 
+					  Buffer const& delayBuffer, 
+					  const Interpolation::Mode interpolation = Interpolation::Linear) throw();
 	UGenInternal* getChannel(const int channel) throw();
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
 };
@@ -231,7 +520,11 @@ public:
 class AllpassLUGenInternal : public RecircBaseUGenInternal
 {
 public:
-	AllpassLUGenInternal(UGen const& input, UGen const& delayTime, UGen const& decayTime, Buffer const& delayBuffer) throw();
+	AllpassLUGenInternal(UGen const& input, 
+						 UGen const& delayTime, 
+						 UGen const& decayTime, 
+						 Buffer const& delayBuffer, 
+						 const Interpolation::Mode interpolation = Interpolation::Linear) throw();
 	UGenInternal* getChannel(const int channel) throw();
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
 };
@@ -244,6 +537,12 @@ public:
 							@param	delayTime			The delay time to use, this must be between 0 and the value		\
 														given for the maximumDelayTime on the UGen`s creation	
 
+#define DelayL_Docs			@param	interpolation		The interpolation mode, Interpolation::Cubic or				\
+														Interpolation::Sinc reduce the high frequency loss and			\
+														aliasing of linear interpolation when the delay time is			\
+														fractional or modulated but impose a minimum delay of 1 or		\
+														3 samples (or 2 or 4 samples for the recirculating delays).	
+
 #define Recirc_Docs			@param	decayTime			The time in seconds for the recirculated signal to decay		\
 														by 60 dBs	
 
@@ -254,12 +553,15 @@ UGenSublcassDeclaration(DelayN, (input, maximumDelayTime, delayTime),
 					   (UGen const& input, const float maximumDelayTime = 0.2f, UGen const& delayTime = 0.2f), 
 						COMMON_UGEN_DOCS Delay_Docs);
 
-/** Simple delay with linear interpolation. 
+/** Simple delay with linear (or optionally cubic or sinc) interpolation. 
  @see DelayN, CombN, CombL, AllpassN, AllpassL 
  @ingroup AllUGens DelayUGens */
-UGenSublcassDeclaration(DelayL, (input, maximumDelayTime, delayTime),
-					   (UGen const& input, const float maximumDelayTime = 0.2f, UGen const& delayTime = 0.2f), 
-						COMMON_UGEN_DOCS Delay_Docs);
+UGenSublcassDeclaration(DelayL, (input, maximumDelayTime, delayTime, interpolation),
+					   (UGen const& input, 
+						const float maximumDelayTime = 0.2f, 
+						UGen const& delayTime = 0.2f, 
+						const Interpolation::Mode interpolation = Interpolation::Linear), 
+						COMMON_UGEN_DOCS Delay_Docs DelayL_Docs);
 
 /** Comb delay with no interpolation. 
  @see DelayN, DelayL, CombL, AllpassN, AllpassL 
@@ -268,12 +570,16 @@ UGenSublcassDeclaration(CombN, (input, maximumDelayTime, delayTime, decayTime),
 					   (UGen const& input, const float maximumDelayTime = 0.2f, UGen const& delayTime = 0.2f, UGen const& decayTime = 0.2f), 
 						COMMON_UGEN_DOCS Delay_Docs Recirc_Docs);
 
-/** Comb delay with linear interpolation. 
+/** Comb delay with linear (or optionally cubic or sinc) interpolation. 
  @see DelayN, DelayL, CombN, AllpassN, AllpassL 
  @ingroup AllUGens DelayUGens */
-UGenSublcassDeclaration(CombL, (input, maximumDelayTime, delayTime, decayTime),
-						(UGen const& input, const float maximumDelayTime = 0.2f, UGen const& delayTime = 0.2f, UGen const& decayTime = 0.2f), 
-						COMMON_UGEN_DOCS Delay_Docs Recirc_Docs);
+UGenSublcassDeclaration(CombL, (input, maximumDelayTime, delayTime, decayTime, interpolation),
+						(UGen const& input, 
+						 const float maximumDelayTime = 0.2f, 
+						 UGen const& delayTime = 0.2f, 
+						 UGen const& decayTime = 0.2f, 
+						 const Interpolation::Mode interpolation = Interpolation::Linear), 
+						COMMON_UGEN_DOCS Delay_Docs Recirc_Docs DelayL_Docs);
 
 /** Allpass delay with no interpolation. 
  @see DelayN, DelayL, CombN, CombL, AllpassL, BAllPass 
@@ -282,12 +588,16 @@ UGenSublcassDeclaration(AllpassN, (input, maximumDelayTime, delayTime, decayTime
 						(UGen const& input, const float maximumDelayTime = 0.2f, UGen const& delayTime = 0.2f, UGen const& decayTime = 0.2f), 
 						COMMON_UGEN_DOCS  Delay_Docs Recirc_Docs);
 
-/** Allpass delay with linear interpolation. 
+/** Allpass delay with linear (or optionally cubic or sinc) interpolation. 
  @see DelayN, DelayL, CombN, CombL, AllpassN, BAllPass 
  @ingroup AllUGens DelayUGens */
-UGenSublcassDeclaration(AllpassL, (input, maximumDelayTime, delayTime, decayTime),
-						(UGen const& input, const float maximumDelayTime = 0.2f, UGen const& delayTime = 0.2f, UGen const& decayTime = 0.2f), 
-						COMMON_UGEN_DOCS  Delay_Docs Recirc_Docs);
+UGenSublcassDeclaration(AllpassL, (input, maximumDelayTime, delayTime, decayTime, interpolation),
+						(UGen const& input, 
+						 const float maximumDelayTime = 0.2f, 
+						 UGen const& delayTime = 0.2f, 
+						 UGen const& decayTime = 0.2f, 
+						 const Interpolation::Mode interpolation = Interpolation::Linear), 
+						COMMON_UGEN_DOCS  Delay_Docs Recirc_Docs DelayL_Docs);
 
 /** Creat a chain of allpass or comb delays.
  @tparam RecircBaseType		This must be one of the following (otherwise you may get very strange errors): 
@@ -411,7 +721,9 @@ protected:
 class TapOutLUGenInternal :	public ProxyOwnerUGenInternal
 {
 public:
-	TapOutLUGenInternal(Buffer const& buffer, UGen const& delayTime) throw();
+	TapOutLUGenInternal(Buffer const& buffer, 
+						UGen const& delayTime, 
+						const Interpolation::Mode interpolation = Interpolation::Linear) throw();
 	UGenInternal* getChannel(const int channel) throw();
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
 	
@@ -419,6 +731,7 @@ public:
 	
 protected:
 	Buffer buffer_;
+	const Interpolation::Mode interpolation_;
 };
 
 #define TapOut_Docs			@param	buffer				The Buffer being used as a circular delay buffer.							\
@@ -429,16 +742,22 @@ protected:
 														by the duration of the buffer.	
 
 
+#define TapOutL_Docs		@param	interpolation		The interpolation mode, Interpolation::Cubic or Interpolation::Sinc		\
+														add 1 or 3 samples to the minimum delay time.	
+
 /** Tap a delay line using no interpolation. 
  @see TapIn TapOutL PlayBuf
  @ingroup AllUGens DelayUGens */
 UGenSublcassDeclaration(TapOutN, (buffer, delayTime),
 						         (Buffer const& buffer, UGen const& delayTime = 0.f), COMMON_UGEN_DOCS TapOut_Docs);
 
-/** Tap a delay line using linear interpolation. 
+/** Tap a delay line using linear (or optionally cubic or sinc) interpolation. 
  @see TapIn TapOutN PlayBuf
  @ingroup AllUGens DelayUGens */
-UGenSublcassDeclaration(TapOutL, (buffer, delayTime),
-						         (Buffer const& buffer, UGen const& delayTime = 0.f), COMMON_UGEN_DOCS TapOut_Docs);
+UGenSublcassDeclaration(TapOutL, (buffer, delayTime, interpolation),
+						         (Buffer const& buffer, 
+								  UGen const& delayTime = 0.f, 
+								  const Interpolation::Mode interpolation = Interpolation::Linear), 
+						COMMON_UGEN_DOCS TapOut_Docs TapOutL_Docs);
 
 #endif // _UGEN_ugen_Delay_H_
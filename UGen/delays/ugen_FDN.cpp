@@ -0,0 +1,408 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_FDN.h"
+#include "../basics/ugen_InlineUnaryOps.h"
+#include "../basics/ugen_InlineBinaryOps.h"
+
+const double FDNUGenInternal::maximumModulationTime = 0.01;
+
+static bool ugen_FDNIsPrime(const int value) throw()
+{
+	if(value < 2) return false;
+	if(value < 4) return true;
+	if((value & 1) == 0) return false;
+	
+	for(int divisor = 3; divisor * divisor <= value; divisor += 2)
+	{
+		if((value % divisor) == 0) return false;
+	}
+	
+	return true;
+}
+
+static FDNUGenInternal::MixingMatrix ugen_FDNCheckMatrix(const int numLines, const FDNUGenInternal::MixingMatrix matrix) throw()
+{
+	// the Walsh-Hadamard transform needs a power of 2 number of lines
+	if((matrix == FDNUGenInternal::Hadamard) && ((numLines & (numLines - 1)) != 0))
+		return FDNUGenInternal::Householder;
+	
+	return matrix;
+}
+
+FDNUGenInternal::FDNUGenInternal(UGen const& input, 
+								 UGen const& decayTime, 
+								 UGen const& damping, 
+								 UGen const& modulationDepth, 
+								 UGen const& modulationRate,
+								 const int numLinesToUse,
+								 const float minimumDelayTime, 
+								 const float maximumDelayTime,
+								 const MixingMatrix matrixToUse) throw()
+:	ProxyOwnerUGenInternal(NumInputs, 1),
+	numLines(clip(numLinesToUse, 1, (int)MaxLines)),
+	matrix(ugen_FDNCheckMatrix(numLines, matrixToUse)),
+	chunkSize(ChunkSize),
+	maximumModulationSamples((int)ceil(maximumModulationTime * UGen::getSampleRate()) + 2),
+	scratch(BufferSpec(ChunkSize * (numLines + 1), 1, true)),
+	lineOffsets(IntArray::withSize(numLines, true)),
+	lineSizes(IntArray::withSize(numLines, true)),
+	lineDelays(IntArray::withSize(numLines, true)),
+	writePositions(IntArray::withSize(numLines, true)),
+	lineGains(BufferSpec(numLines, 1, true)),
+	dampingStates(BufferSpec(numLines, 1, true)),
+	modulationOffsets(BufferSpec(numLines, 1, true)),
+	modulationPhases(BufferSpec(numLines, 1, true)),
+	inputSigns(BufferSpec(numLines, 1, true)),
+	outputSigns(BufferSpec(numLines, 1, true)),
+	currentDecayTime(0.f),
+	currentDamping(0.f),
+	outputScale(matrix == Hadamard ? 1.f : 1.f / (float)sqrt((double)numLines))
+{
+	ugen_assert(minimumDelayTime > 0.f);
+	ugen_assert(maximumDelayTime >= minimumDelayTime);
+	
+	inputs[Input] = input;
+	inputs[DecayTime] = decayTime;
+	inputs[Damping] = damping;
+	inputs[ModulationDepth] = modulationDepth;
+	inputs[ModulationRate] = modulationRate;
+	
+	const double sampleRate = UGen::getSampleRate();
+	const double minimum = ugen::max(minimumDelayTime * sampleRate, 2.0);
+	const double maximum = ugen::max(maximumDelayTime * sampleRate, minimum);
+	const double ratio = maximum / minimum;
+	
+	float* phases = modulationPhases.getData(0);
+	float* inSigns = inputSigns.getData(0);
+	float* outSigns = outputSigns.getData(0);
+	
+	int totalSize = 0;
+	int previousDelay = 1;
+	
+	for(int line = 0; line < numLines; line++)
+	{
+		// exponentially spaced mutually prime lengths so the echo densities don't line up
+		const double position = numLines > 1 ? (double)line / (numLines - 1) : 0.0;
+		int delay = ugen::max((int)(minimum * pow(ratio, position) + 0.5), previousDelay + 1);
+		while(!ugen_FDNIsPrime(delay)) delay++;
+		
+		lineDelays[line] = delay;
+		lineOffsets[line] = totalSize;
+		lineSizes[line] = delay + maximumModulationSamples + ChunkSize + 2;
+		totalSize += lineSizes[line];
+		previousDelay = delay;
+		
+		phases[line] = (float)(twoPi * line / numLines);
+		
+		// irregular sign patterns decorrelate the left and right outputs
+		inSigns[line] = ((line * 5 + 1) & 2) ? -1.f : 1.f;
+		outSigns[line] = ((line * 3 + 2) & 4) ? -1.f : 1.f;
+	}
+	
+	// each chunk must be read completely before any of it is written back
+	chunkSize = ugen::min((int)ChunkSize, lineDelays[0]);
+	lineBuffer = Buffer(BufferSpec(totalSize, 1, true));
+}
+
+void FDNUGenInternal::updateParameters(const float decayTime, const float damping) throw()
+{
+	if((decayTime == currentDecayTime) && (damping == currentDamping))
+		return;
+	
+	currentDecayTime = decayTime;
+	currentDamping = damping;
+	
+	const double sampleRate = UGen::getSampleRate();
+	const double normalise = matrix == Hadamard ? 1.0 / sqrt((double)numLines) : 1.0;
+	float* gains = lineGains.getData(0);
+	
+	for(int line = 0; line < numLines; line++)
+	{
+		if(decayTime == 0.f)
+			gains[line] = 0.f;
+		else
+			gains[line] = (float)(exp(log001 * lineDelays[line] / sampleRate / decayTime) * normalise);
+	}
+}
+
+void FDNUGenInternal::readLine(const int line, float* lineSamples, const int numSamples, const float modulationTarget) throw()
+{
+	const float* bufferSamples = lineBuffer.getData(0) + lineOffsets[line];
+	const int size = lineSizes[line];
+	const int writePos = writePositions[line];
+	float* offsets = modulationOffsets.getData(0);
+	float offset = offsets[line];
+	
+	if((offset == 0.f) && (modulationTarget == 0.f))
+	{
+		// fixed integer delay, copy the chunk in at most two segments
+		int readPos = writePos - lineDelays[line];
+		if(readPos < 0) readPos += size;
+		
+		const int numSamplesToEnd = ugen::min(numSamples, size - readPos);
+		memcpy(lineSamples, bufferSamples + readPos, numSamplesToEnd * sizeof(float));
+		
+		if(numSamplesToEnd < numSamples)
+			memcpy(lineSamples + numSamplesToEnd, bufferSamples, (numSamples - numSamplesToEnd) * sizeof(float));
+	}
+	else
+	{
+		// ramp the extra delay to the new target over the chunk with linear interpolation
+		const float offsetIncrement = (modulationTarget - offset) / numSamples;
+		const int delay = lineDelays[line];
+		
+		for(int i = 0; i < numSamples; i++)
+		{
+			offset += offsetIncrement;
+			
+			const int offsetInt = (int)offset;
+			const float frac = offset - offsetInt;
+			
+			int readPos = writePos + i - delay - offsetInt;
+			if(readPos < 0) readPos += size;
+			int readPosPrev = readPos - 1;
+			if(readPosPrev < 0) readPosPrev += size;
+			
+			const float value = bufferSamples[readPos];
+			lineSamples[i] = value + frac * (bufferSamples[readPosPrev] - value);
+		}
+		
+		offsets[line] = modulationTarget;
+	}
+}
+
+void FDNUGenInternal::mixLines(const int numSamples) throw()
+{
+	float* rows = scratch.getData(0);
+	
+	if(matrix == Hadamard)
+	{
+		// in place fast Walsh-Hadamard transform, each butterfly is applied to a whole chunk
+		for(int half = 1; half < numLines; half *= 2)
+		{
+			for(int start = 0; start < numLines; start += half * 2)
+			{
+				for(int line = start; line < start + half; line++)
+				{
+					float* rowA = rows + line * ChunkSize;
+					float* rowB = rows + (line + half) * ChunkSize;
+					
+					for(int i = 0; i < numSamples; i++)
+					{
+						const float a = rowA[i];
+						const float b = rowB[i];
+						rowA[i] = a + b;
+						rowB[i] = a - b;
+					}
+				}
+			}
+		}
+	}
+	else
+	{
+		// Householder reflection: x - (2/N) * sum(x)
+		float* sums = rows + numLines * ChunkSize;
+		memset(sums, 0, numSamples * sizeof(float));
+		
+		for(int line = 0; line < numLines; line++)
+		{
+			const float* row = rows + line * ChunkSize;
+			for(int i = 0; i < numSamples; i++) 
+				sums[i] += row[i];
+		}
+		
+		const float factor = -2.f / numLines;
+		for(int i = 0; i < numSamples; i++) 
+			sums[i] *= factor;
+		
+		for(int line = 0; line < numLines; line++)
+		{
+			float* row = rows + line * ChunkSize;
+			for(int i = 0; i < numSamples; i++) 
+				row[i] += sums[i];
+		}
+	}
+}
+
+void FDNUGenInternal::writeLine(const int line, const float* lineSamples, const float* inputSamples, const int numSamples) throw()
+{
+	float* bufferSamples = lineBuffer.getData(0) + lineOffsets[line];
+	const int size = lineSizes[line];
+	const float inputSign = inputSigns.getData(0)[line];
+	int writePos = writePositions[line];
+	
+	const int numSamplesToEnd = ugen::min(numSamples, size - writePos);
+	float* writeSamples = bufferSamples + writePos;
+	
+	for(int i = 0; i < numSamplesToEnd; i++)
+		writeSamples[i] = lineSamples[i] + inputSamples[i] * inputSign;
+	
+	for(int i = numSamplesToEnd; i < numSamples; i++)
+		bufferSamples[i - numSamplesToEnd] = lineSamples[i] + inputSamples[i] * inputSign;
+	
+	writePos += numSamples;
+	if(writePos >= size) writePos -= size;
+	writePositions[line] = writePos;
+}
+
+void FDNUGenInternal::processChunk(const float* inputSamples, float* leftSamples, float* rightSamples, const int numSamples,
+								   const float modulationDepth, const float modulationRate) throw()
+{
+	float* rows = scratch.getData(0);
+	const float* gains = lineGains.getData(0);
+	const float* outSigns = outputSigns.getData(0);
+	float* states = dampingStates.getData(0);
+	float* phases = modulationPhases.getData(0);
+	const float damping = currentDamping;
+	const float phaseIncrement = (float)(twoPi * modulationRate * numSamples * UGen::getReciprocalSampleRate());
+	
+	memset(leftSamples, 0, numSamples * sizeof(float));
+	memset(rightSamples, 0, numSamples * sizeof(float));
+	
+	for(int line = 0; line < numLines; line++)
+	{
+		float* row = rows + line * ChunkSize;
+		
+		float modulationTarget = 0.f;
+		
+		if(modulationDepth > 0.f)
+		{
+			float phase = phases[line] + phaseIncrement;
+			if(phase >= (float)twoPi)		phase -= (float)twoPi;
+			else if(phase < 0.f)			phase += (float)twoPi;
+			phases[line] = phase;
+			
+			modulationTarget = modulationDepth * 0.5f * (1.f + sin(phase));
+		}
+		
+		readLine(line, row, numSamples, modulationTarget);
+		
+		// one pole lowpass damping and decay gain
+		const float gain = gains[line];
+		float state = states[line];
+		
+		for(int i = 0; i < numSamples; i++)
+		{
+			const float value = row[i];
+			state = value + damping * (state - value);
+			row[i] = state * gain;
+		}
+		
+		states[line] = zap(state);
+		
+		// even lines go to the left, odd lines to the right
+		float* outputSamples = (line & 1) ? rightSamples : leftSamples;
+		const float sign = outSigns[line] * outputScale;
+		
+		for(int i = 0; i < numSamples; i++)
+			outputSamples[i] += row[i] * sign;
+	}
+	
+	mixLines(numSamples);
+	
+	for(int line = 0; line < numLines; line++)
+		writeLine(line, rows + line * ChunkSize, inputSamples, numSamples);
+}
+
+void FDNUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
+{
+	const int blockSize = uGenOutput.getBlockSize();
+	float* leftSamples = proxies[0]->getSampleData();
+	float* rightSamples = proxies[1]->getSampleData();
+	const float* inputSamples = inputs[Input].processBlock(shouldDelete, blockID, 0);
+	const float* decayTimeSamples = inputs[DecayTime].processBlock(shouldDelete, blockID, 0);
+	const float* dampingSamples = inputs[Damping].processBlock(shouldDelete, blockID, 0);
+	const float* modulationDepthSamples = inputs[ModulationDepth].processBlock(shouldDelete, blockID, 0);
+	const float* modulationRateSamples = inputs[ModulationRate].processBlock(shouldDelete, blockID, 0);
+	
+	const float sampleRate = (float)UGen::getSampleRate();
+	const float maximumDepth = (float)(maximumModulationSamples - 2);
+	
+	int offset = 0;
+	
+	while(offset < blockSize)
+	{
+		const int numSamples = ugen::min(chunkSize, blockSize - offset);
+		
+		// the parameters are evaluated at the start of each chunk
+		updateParameters(ugen::max(decayTimeSamples[offset], 0.f), 
+						 ugen::clip(dampingSamples[offset], 0.f, 0.99f));
+		
+		processChunk(inputSamples + offset, 
+					 leftSamples + offset, 
+					 rightSamples + offset, 
+					 numSamples,
+					 ugen::clip(modulationDepthSamples[offset] * sampleRate, 0.f, maximumDepth),
+					 modulationRateSamples[offset]);
+		
+		offset += numSamples;
+	}
+}
+
+FDN::FDN(UGen const& input, 
+		 UGen const& decayTime, 
+		 UGen const& damping, 
+		 UGen const& modulationDepth, 
+		 UGen const& modulationRate, 
+		 const int numLines,
+		 const float minimumDelayTime, 
+		 const float maximumDelayTime,
+		 const FDNUGenInternal::MixingMatrix matrix) throw()
+{
+	initInternal(2);
+	
+	FDNUGenInternal* internal = new FDNUGenInternal(input.mix(), 
+													decayTime.mix(), 
+													damping.mix(), 
+													modulationDepth.mix(), 
+													modulationRate.mix(), 
+													numLines, 
+													minimumDelayTime, 
+													maximumDelayTime, 
+													matrix);
+	internalUGens[0] = internal;
+	internalUGens[1] = internal->getProxy(1);
+}
+
+END_UGEN_NAMESPACE
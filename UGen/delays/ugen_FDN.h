@@ -0,0 +1,152 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#ifndef _UGEN_ugen_FDN_H_
+#define _UGEN_ugen_FDN_H_
+
+#include "../core/ugen_UGen.h"
+#include "../core/ugen_Constants.h"
+#include "../buffers/ugen_Buffer.h"
+
+/** Feedback delay network internal.
+ 
+ All the delay lines are held in one contiguous Buffer and processed together in chunks
+ no longer than the shortest delay line. For each chunk every line is read, damped and
+ attenuated as a block then the lines are mixed through the feedback matrix with loops 
+ over the whole chunk for each pair of lines (which the compiler can vectorise) before
+ being written back with the input.
+ @ingroup UGenInternals */
+class FDNUGenInternal : public ProxyOwnerUGenInternal
+{
+public:
+	/** The feedback matrix. */
+	enum MixingMatrix 
+	{ 
+		Hadamard,		///< Normalised Hadamard matrix (computed as a fast Walsh-Hadamard transform), the number of lines must be a power of 2.
+		Householder		///< Householder reflection (identity minus 2/N), any number of lines.
+	};
+	
+	FDNUGenInternal(UGen const& input, 
+					UGen const& decayTime, 
+					UGen const& damping, 
+					UGen const& modulationDepth, 
+					UGen const& modulationRate,
+					const int numLines,
+					const float minimumDelayTime, 
+					const float maximumDelayTime,
+					const MixingMatrix matrix) throw();
+	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
+	enum Inputs { Input, DecayTime, Damping, ModulationDepth, ModulationRate, NumInputs };
+	enum Constants { ChunkSize = 64, MaxLines = 64 };
+	
+	/** The maximum modulation depth in seconds. */
+	static const double maximumModulationTime;
+	
+protected:
+	void updateParameters(const float decayTime, const float damping) throw();
+	void processChunk(const float* inputSamples, float* leftSamples, float* rightSamples, const int numSamples,
+					  const float modulationDepth, const float modulationRate) throw();
+	void readLine(const int line, float* lineSamples, const int numSamples, const float modulationTarget) throw();
+	void mixLines(const int numSamples) throw();
+	void writeLine(const int line, const float* lineSamples, const float* inputSamples, const int numSamples) throw();
+	
+	const int numLines;
+	const MixingMatrix matrix;
+	int chunkSize;
+	int maximumModulationSamples;
+	
+	Buffer lineBuffer;			// all the delay lines, one after the other
+	Buffer scratch;				// one chunk for each line plus one for the Householder sums
+	IntArray lineOffsets;		// start of each line in lineBuffer
+	IntArray lineSizes;			// size of each line's ring buffer
+	IntArray lineDelays;		// the fixed delay of each line in samples
+	IntArray writePositions;
+	Buffer lineGains;			// per line attenuation for the decay time
+	Buffer dampingStates;		// per line one pole lowpass state
+	Buffer modulationOffsets;	// per line extra delay in samples at the end of the last chunk
+	Buffer modulationPhases;
+	Buffer inputSigns;
+	Buffer outputSigns;
+	
+	float currentDecayTime;
+	float currentDamping;
+	float outputScale;
+};
+
+#define FDN_Docs	@param input			The input source, multichannel inputs are mixed to mono.				\
+					@param decayTime		The time in seconds for the reverberation to decay by 60dB.				\
+					@param damping			High frequency damping (0-1) applied to each line using a one			\
+											pole lowpass filter, 0 is no damping.									\
+					@param modulationDepth	The depth in seconds of the delay line modulation (up to 10ms).			\
+											0 disables the modulation which makes the processing cheaper.			\
+					@param modulationRate	The rate in Hz of the delay line modulation, each line uses a			\
+											different phase.														\
+					@param numLines			The number of delay lines (up to 64). This should be a power			\
+											of 2 for the Hadamard matrix.											\
+					@param minimumDelayTime	The shortest delay line in seconds. The line lengths are spaced			\
+											exponentially from this to the @c maximumDelayTime and rounded			\
+											to prime numbers of samples.											\
+					@param maximumDelayTime	The longest delay line in seconds.										\
+					@param matrix			The feedback matrix, FDNUGenInternal::Hadamard or						\
+											FDNUGenInternal::Householder.
+
+/** Feedback delay network reverb.
+ 
+ This holds all of its delay lines in a single UGen rather than using a chain of comb and 
+ allpass UGen instances (e.g., with RecircBaseChain) so it is much cheaper for a large
+ number of lines. The parameters are evaluated once per processing chunk (up to 64 samples
+ and never longer than the shortest line).
+ 
+ The output is two channels (left and right) taken from different combinations of the lines.
+ @ingroup AllUGens DelayUGens
+ @see RecircBaseChain, CombN, AllpassN */
+UGenSublcassDeclaration(FDN, (input, decayTime, damping, modulationDepth, modulationRate, numLines, minimumDelayTime, maximumDelayTime, matrix),
+						(UGen const& input, 
+						 UGen const& decayTime = 2.f, 
+						 UGen const& damping = 0.2f, 
+						 UGen const& modulationDepth = 0.f, 
+						 UGen const& modulationRate = 0.5f, 
+						 const int numLines = 16,
+						 const float minimumDelayTime = 0.02f, 
+						 const float maximumDelayTime = 0.08f,
+						 const FDNUGenInternal::MixingMatrix matrix = FDNUGenInternal::Hadamard), 
+						COMMON_UGEN_DOCS FDN_Docs);
+
+#endif // _UGEN_ugen_FDN_H_
@@ -71,6 +71,7 @@ void EnvGenUGenInternal::processBlock(bool& shouldDelete, const unsigned int /*b
 {
 	int numSamplesToProcess = uGenOutput.getBlockSize();
 	float* outputSamples = uGenOutput.getSampleData();
+	bool isConstantBlock = false;
 	
 	if(isStealing() == false && shouldSteal() == true)
 	{
@@ -102,6 +103,8 @@ void EnvGenUGenInternal::processBlock(bool& shouldDelete, const unsigned int /*b
 			}
 		}		
 		
+		isConstantBlock = isDone();
+		
 		while(numSamplesToProcess && isDone() == false)
 		{
 			int samplesThisTime = min(stepsUntilTarget, numSamplesToProcess);
@@ -187,6 +190,13 @@ void EnvGenUGenInternal::processBlock(bool& shouldDelete, const unsigned int /*b
 	{
 		*outputSamples++ = (float)currentValue;
 	}
+	
+	if(isConstantBlock == false)
+		uGenOutput.setSilent(false);
+	else if(currentValue == 0.0)
+		uGenOutput.setSilent(true);
+	else
+		uGenOutput.setConstant(true);
 		
 	return;
 	
@@ -195,6 +205,7 @@ exit:
 	{
 		*outputSamples++ = (float)currentValue;
 	}
+	uGenOutput.setSilent(false);
 	setIsDone();
 }
 
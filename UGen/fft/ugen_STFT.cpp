@@ -0,0 +1,397 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#if !defined(WIN32) && !defined(UGEN_IPHONE) && !defined(UGEN_ANDROID)
+	#include <Accelerate/Accelerate.h>
+	#include <CoreServices/CoreServices.h>
+#endif
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_STFT.h"
+#include "ugen_FFTEngineInternal.h"
+
+/** Processes batches of STFT frames, each batch has its own FFTEngine and scratch space. 
+ These are all allocated on the calling thread before the jobs are run. */
+class STFTJob : public ThreadPoolJob
+{
+public:
+	STFTJob(Buffer const& window, const int numFrames, const int numBatches) throw()
+	:	fftSize(window.size()),
+		fftSizeHalved(fftSize / 2),
+		numFrames(numFrames),
+		numBatches(numBatches),
+		windowSamples(window.getData()),
+		scratch(new float[2 * fftSize * numBatches])
+	{
+		for(int i = 0; i < numBatches; i++)
+		{
+			FFTEngine engine(fftSize);
+			engine.setFFTWindow(window);
+			engine.setIFFTWindow(window);
+			engines.add(engine);
+		}
+	}
+	
+	~STFTJob()
+	{
+		delete [] scratch;
+	}
+	
+	inline int getFirstFrame(const int batch) const throw() { return (int)((long long)batch * numFrames / numBatches); }
+	
+	// the start of a frame in samples relative to the start of the Buffer
+	inline int getFrameStart(const int frame, const int hopSize) const throw() { return frame * hopSize - fftSizeHalved; }
+	
+protected:
+	const int fftSize;
+	const int fftSizeHalved;
+	const int numFrames;
+	const int numBatches;
+	const float* windowSamples;
+	float* const scratch;
+	ObjectArray<FFTEngine> engines;
+};
+
+class STFTAnalysisJob : public STFTJob
+{
+public:
+	STFTAnalysisJob(Buffer const& window, 
+					const int hopSize, 
+					const float magnitudeScale,
+					const float* input, 
+					const int inputSize,
+					float** magnitudes, 
+					float** phases,
+					const int numFrames, 
+					const int numBatches) throw()
+	:	STFTJob(window, numFrames, numBatches),
+		hopSize(hopSize),
+		magnitudeScale(magnitudeScale),
+		input(input),
+		inputSize(inputSize),
+		magnitudes(magnitudes),
+		phases(phases)
+	{
+	}
+	
+	void runJob(const int batch) throw()
+	{
+		FFTEngineInternal* engine = engines[batch].getInternal();
+		float* frameSamples = scratch + 2 * fftSize * batch;
+		DSPSplitComplex spectrum;
+		spectrum.realp = frameSamples + fftSize;
+		spectrum.imagp = spectrum.realp + fftSizeHalved;
+		
+		const int endFrame = getFirstFrame(batch + 1);
+		
+		for(int frame = getFirstFrame(batch); frame < endFrame; frame++)
+		{
+			const int start = getFrameStart(frame, hopSize);
+			const int first = ugen::max(0, -start);
+			const int end = ugen::min(fftSize, inputSize - start);
+			
+			if(first > 0)
+				memset(frameSamples, 0, first * sizeof(float));
+			
+			if(end > first)
+				memcpy(frameSamples + first, input + start + first, (end - first) * sizeof(float));
+			
+			if(end < fftSize)
+				memset(frameSamples + ugen::max(first, end), 0, (fftSize - ugen::max(first, end)) * sizeof(float));
+			
+			engine->fft(spectrum, frameSamples, true);
+			
+			float* magnitudeSamples = magnitudes[frame];
+			float* phaseSamples = phases[frame];
+			
+			// DC and Nyquist are real, Nyquist is packed into the first imaginary value
+			magnitudeSamples[0] = (float)fabs(spectrum.realp[0]) * magnitudeScale;
+			phaseSamples[0] = (float)atan2(0.f, spectrum.realp[0]);
+			magnitudeSamples[fftSizeHalved] = (float)fabs(spectrum.imagp[0]) * magnitudeScale;
+			phaseSamples[fftSizeHalved] = (float)atan2(0.f, spectrum.imagp[0]);
+			
+			for(int bin = 1; bin < fftSizeHalved; bin++)
+			{
+				const float real = spectrum.realp[bin];
+				const float imag = spectrum.imagp[bin];
+				magnitudeSamples[bin] = (float)hypot(imag, real) * magnitudeScale;
+				phaseSamples[bin] = (float)atan2(imag, real);
+			}
+		}
+	}
+	
+private:
+	const int hopSize;
+	const float magnitudeScale;
+	const float* input;
+	const int inputSize;
+	float** magnitudes;
+	float** phases;
+};
+
+class STFTResynthesisJob : public STFTJob
+{
+public:
+	STFTResynthesisJob(Buffer const& window, 
+					   const int hopSize, 
+					   const float magnitudeScale,
+					   const float** magnitudes, 
+					   const float** phases,
+					   const int numFrames, 
+					   const int numBatches) throw()
+	:	STFTJob(window, numFrames, numBatches),
+		hopSize(hopSize),
+		magnitudeScale(magnitudeScale),
+		magnitudes(magnitudes),
+		phases(phases),
+		outputs(new float*[numBatches]),
+		overlaps(new float*[numBatches])
+	{
+		for(int batch = 0; batch < numBatches; batch++)
+		{
+			const int size = getBatchSize(batch);
+			outputs[batch] = new float[size];
+			overlaps[batch] = new float[size];
+			memset(outputs[batch], 0, size * sizeof(float));
+			memset(overlaps[batch], 0, size * sizeof(float));
+		}
+	}
+	
+	~STFTResynthesisJob()
+	{
+		for(int batch = 0; batch < numBatches; batch++)
+		{
+			delete [] outputs[batch];
+			delete [] overlaps[batch];
+		}
+		
+		delete [] outputs;
+		delete [] overlaps;
+	}
+	
+	// each batch overlap-adds into its own region, these are summed on the calling thread afterwards
+	inline int getBatchSize(const int batch) const throw()
+	{ 
+		return (getFirstFrame(batch + 1) - 1 - getFirstFrame(batch)) * hopSize + fftSize; 
+	}
+	
+	void runJob(const int batch) throw()
+	{
+		FFTEngineInternal* engine = engines[batch].getInternal();
+		float* frameSamples = scratch + 2 * fftSize * batch;
+		DSPSplitComplex spectrum;
+		spectrum.realp = frameSamples + fftSize;
+		spectrum.imagp = spectrum.realp + fftSizeHalved;
+		
+		const float inverseScale = 1.f / magnitudeScale;
+		const int firstFrame = getFirstFrame(batch);
+		const int endFrame = getFirstFrame(batch + 1);
+		
+		for(int frame = firstFrame; frame < endFrame; frame++)
+		{
+			const float* magnitudeSamples = magnitudes[frame];
+			const float* phaseSamples = phases[frame];
+			
+			spectrum.realp[0] = magnitudeSamples[0] * inverseScale * (float)cos(phaseSamples[0]);
+			spectrum.imagp[0] = magnitudeSamples[fftSizeHalved] * inverseScale * (float)cos(phaseSamples[fftSizeHalved]);
+			
+			for(int bin = 1; bin < fftSizeHalved; bin++)
+			{
+				const float magnitude = magnitudeSamples[bin] * inverseScale;
+				spectrum.realp[bin] = magnitude * (float)cos(phaseSamples[bin]);
+				spectrum.imagp[bin] = magnitude * (float)sin(phaseSamples[bin]);
+			}
+			
+			engine->ifft(frameSamples, spectrum, true, true);
+			
+			float* outputSamples = outputs[batch] + (frame - firstFrame) * hopSize;
+			float* overlapSamples = overlaps[batch] + (frame - firstFrame) * hopSize;
+			
+			for(int i = 0; i < fftSize; i++)
+			{
+				outputSamples[i] += frameSamples[i];
+				overlapSamples[i] += windowSamples[i] * windowSamples[i];
+			}
+		}
+	}
+	
+	/** Sum the batches into the output. */
+	void mix(float* output, const int numSamples) throw()
+	{
+		float* overlap = new float[numSamples];
+		memset(output, 0, numSamples * sizeof(float));
+		memset(overlap, 0, numSamples * sizeof(float));
+		
+		for(int batch = 0; batch < numBatches; batch++)
+		{
+			const int start = getFrameStart(getFirstFrame(batch), hopSize);
+			const int size = getBatchSize(batch);
+			const int first = ugen::max(0, -start);
+			const int end = ugen::min(size, numSamples - start);
+			
+			for(int i = first; i < end; i++)
+			{
+				output[start + i] += outputs[batch][i];
+				overlap[start + i] += overlaps[batch][i];
+			}
+		}
+		
+		for(int i = 0; i < numSamples; i++)
+			output[i] = overlap[i] > 1.0e-6f ? output[i] / overlap[i] : 0.f;
+		
+		delete [] overlap;
+	}
+	
+private:
+	const int hopSize;
+	const float magnitudeScale;
+	const float** magnitudes;
+	const float** phases;
+	float** const outputs;
+	float** const overlaps;
+};
+
+static float getSTFTMagnitudeScale(Buffer const& window) throw()
+{
+	// as FFTEngine::rawToMagnitudePhase() for a windowed FFT
+	const int fftSize = window.size();
+	return 1.f / (fftSize / 2 * (window.sum(0) / fftSize));
+}
+
+STFT::STFT(const int fftSizeToUse, const int hopSizeToUse, Buffer const& windowToUse) throw()
+:	fftSize(FFTEngine(fftSizeToUse).size()),
+	hopSize(ugen::max(1, hopSizeToUse)),
+	window(windowToUse.size() > 0 ? windowToUse.resample(fftSize) : Buffer::hannWindow(fftSize)),
+	magnitudeScale(getSTFTMagnitudeScale(window)),
+	pool(0)
+{
+	ugen_assert(hopSize < fftSize);
+}
+
+int STFT::getNumFrames(const int numSamples) const throw()
+{
+	return numSamples > 0 ? (numSamples - 1) / hopSize + 1 : 0;
+}
+
+int STFT::getNumBatches(const int numFrames) const throw()
+{
+	// a few batches per thread so they finish at about the same time
+	const int numThreads = pool != 0 ? pool->getNumThreads() + 1 : 1;
+	return ugen::max(1, ugen::min(numFrames, numThreads > 1 ? numThreads * 4 : 1));
+}
+
+void STFT::analyse(Buffer const& input, Buffer& magnitudes, Buffer& phases, const int channel) const throw()
+{
+	ugen_assert(channel >= 0 && channel < input.getNumChannels());
+	
+	const int numFrames = getNumFrames(input.size());
+	
+	if(numFrames == 0)
+	{
+		magnitudes = Buffer();
+		phases = Buffer();
+		return;
+	}
+	
+	magnitudes = Buffer::withSize(getNumBins(), numFrames, false);
+	phases = Buffer::withSize(getNumBins(), numFrames, false);
+	
+	float** magnitudeData = new float*[numFrames];
+	float** phaseData = new float*[numFrames];
+	
+	for(int frame = 0; frame < numFrames; frame++)
+	{
+		magnitudeData[frame] = magnitudes.getData(frame);
+		phaseData[frame] = phases.getData(frame);
+	}
+	
+	const int numBatches = getNumBatches(numFrames);
+	STFTAnalysisJob job(window, hopSize, magnitudeScale, input.getData(channel), input.size(), 
+						magnitudeData, phaseData, numFrames, numBatches);
+	
+	if(numBatches > 1)
+		pool->run(job, numBatches);
+	else
+		job.runJob(0);
+	
+	delete [] magnitudeData;
+	delete [] phaseData;
+}
+
+Buffer STFT::resynthesise(Buffer const& magnitudes, Buffer const& phases, const int numSamples) const throw()
+{
+	ugen_assert(magnitudes.getNumChannels() == phases.getNumChannels());
+	ugen_assert(magnitudes.size() == getNumBins() && phases.size() == getNumBins());
+	
+	const int numFrames = ugen::min(magnitudes.getNumChannels(), phases.getNumChannels());
+	
+	if((numFrames == 0) || (magnitudes.size() < getNumBins()) || (phases.size() < getNumBins()))
+		return Buffer();
+	
+	const int outputSize = numSamples > 0 ? numSamples : numFrames * hopSize;
+	
+	const float** magnitudeData = new const float*[numFrames];
+	const float** phaseData = new const float*[numFrames];
+	
+	for(int frame = 0; frame < numFrames; frame++)
+	{
+		magnitudeData[frame] = magnitudes.getData(frame);
+		phaseData[frame] = phases.getData(frame);
+	}
+	
+	const int numBatches = getNumBatches(numFrames);
+	STFTResynthesisJob job(window, hopSize, magnitudeScale, magnitudeData, phaseData, numFrames, numBatches);
+	
+	if(numBatches > 1)
+		pool->run(job, numBatches);
+	else
+		job.runJob(0);
+	
+	Buffer output = Buffer::withSize(outputSize, 1, false);
+	job.mix(output.getData(), outputSize);
+	
+	delete [] magnitudeData;
+	delete [] phaseData;
+	
+	return output;
+}
+
+END_UGEN_NAMESPACE
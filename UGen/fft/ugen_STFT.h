@@ -0,0 +1,107 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_STFT_H_
+#define _UGEN_ugen_STFT_H_
+
+#include "ugen_FFTEngine.h"
+#include "../core/ugen_ThreadPool.h"
+
+/** Short-time Fourier transform analysis and overlap-add resynthesis of whole Buffer objects.
+ 
+ Frames are taken every hop size samples, frame @c f is centred on sample f * hopSize with 
+ zeros beyond the ends of the input. analyse() returns the magnitude and phase of every frame as 
+ Buffer objects with one channel per frame, each with fftSize/2+1 bins. The magnitudes are scaled
+ in the same way as FFTEngine::rawToMagnitudePhase() for a windowed FFT. resynthesise() inverts 
+ this, windowing each frame again and dividing by the summed overlap of the squared windows. 
+ Unmodified frames reproduce the input only where this overlap is not close to zero, so the 
+ frames must overlap: the hop size must be less than the FFT size and, for windows which taper 
+ to zero like the default Hann window, no more than half of it. Elsewhere the output is 0.
+ 
+ The frames are processed on the calling thread unless a ThreadPool is set with setThreadPool(),
+ then they are divided into batches which are processed in parallel, each batch with its own 
+ FFTEngine. This is intended for offline use, not on the audio thread. Use a dedicated ThreadPool
+ (with a lower thread priority than the default) rather than ThreadPool::getShared() since a long
+ analysis would hold up its other users such as Spawn.
+ @see FFTEngine, ThreadPool */
+class STFT
+{
+public:
+	/** Create an STFT.
+	 @param fftSize		The size of each frame, this is rounded in the same way as by FFTEngine.
+	 @param hopSize		The number of samples between frames, this must be less than the FFT size.
+	 @param window		The analysis and resynthesis window (resampled to the FFT size), an empty
+						Buffer uses Buffer::hannWindow(). */
+	STFT(const int fftSize = 2048, const int hopSize = 512, Buffer const& window = Buffer()) throw();
+	
+	inline int getFFTSize() const throw()			{ return fftSize;		}
+	inline int getHopSize() const throw()			{ return hopSize;		}
+	inline int getNumBins() const throw()			{ return fftSize/2 + 1;	}
+	inline const Buffer& getWindow() const throw()	{ return window;		}
+	
+	/** Returns the number of frames needed to cover a number of samples. */
+	int getNumFrames(const int numSamples) const throw();
+	
+	/** Set the ThreadPool used to process the frames, 0 processes them on the calling thread. */
+	inline void setThreadPool(ThreadPool* poolToUse) throw() { pool = poolToUse; }
+	
+	/** Analyse one channel of a Buffer.
+	 @param input		The Buffer to analyse.
+	 @param magnitudes	Set to the magnitudes with one channel for each frame.
+	 @param phases		Set to the phases (in radians) with one channel for each frame.
+	 @param channel		The channel of the input to analyse. */
+	void analyse(Buffer const& input, Buffer& magnitudes, Buffer& phases, const int channel = 0) const throw();
+	
+	/** Resynthesise a single channel Buffer from magnitudes and phases in the format returned by analyse().
+	 @param magnitudes	The magnitudes with one channel for each frame.
+	 @param phases		The phases with one channel for each frame.
+	 @param numSamples	The size of the result, 0 uses the number of frames times the hop size
+						(which is at least the size of the Buffer that was analysed). */
+	Buffer resynthesise(Buffer const& magnitudes, Buffer const& phases, const int numSamples = 0) const throw();
+	
+private:
+	int getNumBatches(const int numFrames) const throw();
+	
+	const int fftSize;
+	const int hopSize;
+	const Buffer window;
+	const float magnitudeScale;
+	ThreadPool* pool;
+};
+
+#endif // _UGEN_ugen_STFT_H_
@@ -47,79 +47,173 @@ BEGIN_UGEN_NAMESPACE
 #include "../../basics/ugen_InlineBinaryOps.h"
 
 
-LPFUGenInternal::LPFUGenInternal(UGen const& input, UGen const& freq) throw()
+LPFUGenInternal::LPFUGenInternal(UGen const& input, UGen const& freq, const FilterCoeffTable::Mode coeffModeToUse) throw()
 :	UGenInternal(NumInputs),
 	y1(0.f), y2(0.f), a0(0.f), b1(0.f), b2(0.f),
-	currentFreq(0.f)
+	currentFreq(0.f),
+	coeffMode(coeffModeToUse),
+	coeffTable(coeffMode == FilterCoeffTable::Lookup ? FilterCoeffTable::getInstance(getCoeffs, 0.f, 0.f) : 0)
 {
 	inputs[Input] = input;
 	inputs[Freq] = freq;
 }
 
+LPFUGenInternal::~LPFUGenInternal()
+{
+	if(coeffTable != 0) 
+		coeffTable->release();
+}
+
 UGenInternal* LPFUGenInternal::getChannel(const int channel) throw()
 {
 	return new LPFUGenInternal(inputs[Input].getChannel(channel), 
-							   inputs[Freq].getChannel(channel));
+							   inputs[Freq].getChannel(channel),
+							   coeffMode);
+}
+
+void LPFUGenInternal::getCoeffs(const float freq, const float control, const float gain,
+							   float& a0, float& a1, float& a2, float& b1, float& b2) throw()
+{
+	(void)control;
+	(void)gain;
+	
+	const float pfreq = (float)(max(0.01f, freq) * UGen::getReciprocalSampleRate() * pi);
+	
+	const float C = 1.f / tan(pfreq);
+	const float C2 = C * C;
+	const float sqrt2C = (float)(C * sqrt2);
+	
+	a0 = 1.f / (1.f + sqrt2C + C2);
+	a1 = 2.f * a0;
+	a2 = a0;
+	b1 = -2.f * (1.f - C2) * a0;
+	b2 = -(1.f - sqrt2C + C2) * a0;
 }
 
 void LPFUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
 {
-	double piOverSampleRate = UGen::getReciprocalSampleRate() * pi;
 	int numSamplesToProcess = uGenOutput.getBlockSize();
 	float* outputSamples = uGenOutput.getSampleData();
 	float* inputSamples = inputs[Input].processBlock(shouldDelete, blockID, channel);
 	float* freqSamples = inputs[Freq].processBlock(shouldDelete, blockID, channel);
-	float y0;
-	float newFreq = *freqSamples;
-		
-	if(newFreq != currentFreq)
+	float y0, a1, a2;
+	
+	if((coeffTable != 0) && !(inputs[Freq].isConstant(channel) && (*freqSamples == currentFreq)))
 	{
-		float slope = 1.f / numSamplesToProcess;
-		float pfreq = max(0.01f, newFreq) * piOverSampleRate;
-		
-		float C = 1.f / tan(pfreq);
-		float C2 = C * C;
-		float sqrt2C = C * sqrt2;
-		
-		float next_a0 =   1.f / (1.f + sqrt2C + C2);
-		float next_b1 =  -2.f * (1.f - C2) * next_a0 ;
-		float next_b2 = -(1.f - sqrt2C + C2) * next_a0;
-			
-		float a0_slope = (next_a0 - a0) * slope;
-		float b1_slope = (next_b1 - b1) * slope;
-		float b2_slope = (next_b2 - b2) * slope;
-		
+		// look up the coefficients for every sample
 		while(numSamplesToProcess--)
 		{
+			coeffTable->lookup(*freqSamples++, a0, a1, a2, b1, b2);
+			
 			y0 = *inputSamples++ + b1 * y1 + b2 * y2; 
 			*outputSamples++ = a0 * (y0 + 2.f * y1 + y2);
 			y2 = y1; 
 			y1 = y0;			
+		}
+		
+		currentFreq = *(freqSamples-1);
+	}
+	else if(coeffMode == FilterCoeffTable::Exact)
+	{
+		// calculate the coefficients for the first sample and ramp them across the block
+		const float newFreq = *freqSamples;
 		
-			a0 += a0_slope;
-			b1 += b1_slope;
-			b2 += b2_slope;
-		}		
+		if(newFreq != currentFreq)
+		{
+			const float slope = 1.f / numSamplesToProcess;
+			
+			float next_a0, next_b1, next_b2;
+			getCoeffs(newFreq, 0.f, 0.f, next_a0, a1, a2, next_b1, next_b2);
+			
+			const float a0_slope = (next_a0 - a0) * slope;
+			const float b1_slope = (next_b1 - b1) * slope;
+			const float b2_slope = (next_b2 - b2) * slope;
+			
+			while(numSamplesToProcess--)
+			{
+				y0 = *inputSamples++ + b1 * y1 + b2 * y2; 
+				*outputSamples++ = a0 * (y0 + 2.f * y1 + y2);
+				y2 = y1; 
+				y1 = y0;			
+				
+				a0 += a0_slope;
+				b1 += b1_slope;
+				b2 += b2_slope;
+			}
+			
+			currentFreq = newFreq;
+		}
+		else
+		{
+			while(numSamplesToProcess--)
+			{
+				y0 = *inputSamples++ + b1 * y1 + b2 * y2; 
+				*outputSamples++ = a0 * (y0 + 2.f * y1 + y2);
+				y2 = y1; 
+				y1 = y0;			
+			}
+		}
 	}
 	else
 	{
-		while(numSamplesToProcess--)
+		// calculate the coefficients at the end of each sub-block and ramp them across it
+		while(numSamplesToProcess > 0)
 		{
-			y0 = *inputSamples++ + b1 * y1 + b2 * y2; 
-			*outputSamples++ = a0 * (y0 + 2.f * y1 + y2);
-			y2 = y1; 
-			y1 = y0;			
+			const int numSamples = min(numSamplesToProcess, (int)FilterCoeffTable::CoeffUpdateSize);
+			const float newFreq = freqSamples[numSamples - 1];
+			
+			if(newFreq != currentFreq)
+			{
+				const float slope = 1.f / numSamples;
+				
+				float next_a0, next_b1, next_b2;
+				getCoeffs(newFreq, 0.f, 0.f, next_a0, a1, a2, next_b1, next_b2);
+				
+				const float a0_slope = (next_a0 - a0) * slope;
+				const float b1_slope = (next_b1 - b1) * slope;
+				const float b2_slope = (next_b2 - b2) * slope;
+				
+				for(int i = 0; i < numSamples; i++)
+				{
+					y0 = inputSamples[i] + b1 * y1 + b2 * y2; 
+					outputSamples[i] = a0 * (y0 + 2.f * y1 + y2);
+					y2 = y1; 
+					y1 = y0;			
+					
+					a0 += a0_slope;
+					b1 += b1_slope;
+					b2 += b2_slope;
+				}
+				
+				a0 = next_a0;
+				b1 = next_b1;
+				b2 = next_b2;
+				currentFreq = newFreq;
+			}
+			else
+			{
+				for(int i = 0; i < numSamples; i++)
+				{
+					y0 = inputSamples[i] + b1 * y1 + b2 * y2; 
+					outputSamples[i] = a0 * (y0 + 2.f * y1 + y2);
+					y2 = y1; 
+					y1 = y0;			
+				}
+			}
+			
+			inputSamples += numSamples;
+			outputSamples += numSamples;
+			freqSamples += numSamples;
+			numSamplesToProcess -= numSamples;
 		}
 	}
 	
 	y1 = zap(y1);
 	y2 = zap(y2);
-	
-	currentFreq = newFreq;
 }
 
 
-LPF::LPF(UGen const& input, UGen const& freq) throw()
+LPF::LPF(UGen const& input, UGen const& freq, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	int numChannels = 1;
 	numChannels = input.getNumChannels() > numChannels ? input.getNumChannels()	: numChannels;
@@ -129,7 +223,7 @@ LPF::LPF(UGen const& input, UGen const& freq) throw()
 	
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		internalUGens[i] = new LPFUGenInternal(input, freq);
+		internalUGens[i] = new LPFUGenInternal(input, freq, coeffMode);
 	}
 }
 
@@ -41,19 +41,26 @@
 
 #include "../../core/ugen_UGen.h"
 #include "../../basics/ugen_MulAdd.h"
+#include "../ugen_FilterCoeffTable.h"
 
 /** @ingroup UGenInternals */
 class LPFUGenInternal : public UGenInternal
 {
 public:
-	LPFUGenInternal(UGen const& input, UGen const& freq) throw();
+	LPFUGenInternal(UGen const& input, UGen const& freq, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact) throw();
+	~LPFUGenInternal();
 	UGenInternal* getChannel(const int channel) throw();
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
 	
 	enum Inputs { Input, Freq, NumInputs };
 	
+	static void getCoeffs(const float freq, const float control, const float gain,
+						  float& a0, float& a1, float& a2, float& b1, float& b2) throw();
+	
 protected:
 	float y1, y2, a0, b1, b2, currentFreq;
+	const FilterCoeffTable::Mode coeffMode;
+	FilterCoeffTable* coeffTable;
 };
 
 #define LPF_Docs	@param input	The input source to filter.								\
@@ -62,11 +69,11 @@ protected:
 /** 1st order low pass filter.
  @ingroup AllUGens FilterUGens
  @see BLowPass, RLPF */
-DirectMulAddUGenDeclaration(LPF, (input, freq), 
-								 (input, freq, MulAdd_ArgsCall),
-								 (UGen const& input, UGen const& freq = 1000.f), 
-								 (UGen const& input, UGen const& freq = 1000.f, MulAdd_ArgsDeclare),
-							COMMON_UGEN_DOCS LPF_Docs MulAddArgs_Docs);
+DirectMulAddUGenDeclaration(LPF, (input, freq, coeffMode), 
+								 (input, freq, MulAdd_ArgsCall, coeffMode),
+								 (UGen const& input, UGen const& freq = 1000.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+								 (UGen const& input, UGen const& freq = 1000.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+							COMMON_UGEN_DOCS LPF_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 
 
@@ -48,10 +48,14 @@ BEGIN_UGEN_NAMESPACE
 
 
 
-BEQBaseUGenInternal::BEQBaseUGenInternal(UGen const& input, UGen const& freq, UGen const& control, UGen const& gain) throw()
+BEQBaseUGenInternal::BEQBaseUGenInternal(UGen const& input, UGen const& freq, UGen const& control, UGen const& gain,
+										 const FilterCoeffTable::Mode coeffModeToUse, FilterCoeffTable::CoeffFunction coeffFunctionToUse) throw()
 :	UGenInternal(NumInputs),
 	y1(0.f), y2(0.f), a0(0.f), a1(0.f), a2(0.f), b1(0.f), b2(0.f),
-	currentFreq(0.f), currentControl(0.f), currentGain(0.f)
+	currentFreq(0.f), currentControl(0.f), currentGain(0.f),
+	coeffMode(coeffModeToUse),
+	coeffFunction(coeffFunctionToUse),
+	coeffTable(coeffModeToUse == FilterCoeffTable::Lookup ? FilterCoeffTable::getInstance(coeffFunctionToUse, control.getValue(), gain.getValue()) : 0)
 {
 	inputs[Input] = input;
 	inputs[Freq] = freq;
@@ -59,6 +63,12 @@ BEQBaseUGenInternal::BEQBaseUGenInternal(UGen const& input, UGen const& freq, UG
 	inputs[Gain] = gain;
 }
 
+BEQBaseUGenInternal::~BEQBaseUGenInternal()
+{
+	if(coeffTable != 0) 
+		coeffTable->release();
+}
+
 
 //void BEQBaseUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
 //{
@@ -125,13 +135,44 @@ void BEQBaseUGenInternal::processBlock(bool& shouldDelete, const unsigned int bl
 	float* freqSamples = inputs[Freq].processBlock(shouldDelete, blockID, channel);
 	float* controlSamples = inputs[Control].processBlock(shouldDelete, blockID, channel);
 	float* gainSamples = inputs[Gain].processBlock(shouldDelete, blockID, channel);
+	const bool inputIsSilent = inputs[Input].isSilent(channel);
+	
+	if(inputIsSilent && (y1 == 0.f) && (y2 == 0.f))
+	{
+		// the tail has decayed so the coefficients will be updated when the input returns
+		uGenOutput.setSilentAndClear();
+		return;
+	}
+	
+	uGenOutput.setSilent(false);
+	
 	float newFreq = *freqSamples;
 	float newControl = *controlSamples;
 	float newGain = *gainSamples;
 	float y0;
 	
-	if((currentFreq != newFreq) || (currentControl != newControl) || (currentGain != newGain))
-	{				
+	if((coeffTable != 0) && (currentFreq != newFreq) && 
+	   (newControl == coeffTable->getControl()) && inputs[Control].isConstant(channel) &&
+	   (newGain == coeffTable->getGain()) && inputs[Gain].isConstant(channel))
+	{
+		// only the frequency is modulated so the coefficients can come from the shared table
+		while(numSamplesToProcess--)
+		{
+			coeffTable->lookup(*freqSamples++, a0, a1, a2, b1, b2);
+			
+			y0 = *inputSamples++ + b1 * y1 + b2 * y2; 
+			*outputSamples++ = a0 * y0 + a1 * y1 + a2 * y2;
+			y2 = y1; 
+			y1 = y0;
+		}
+		
+		currentFreq = *(freqSamples-1);
+		currentControl = newControl;
+		currentGain = newGain;
+	}
+	else if((coeffMode == FilterCoeffTable::Exact) && 
+			((currentFreq != newFreq) || (currentControl != newControl) || (currentGain != newGain)))
+	{
 		while(numSamplesToProcess--)
 		{
 			calculateCoeffs(*freqSamples++, *controlSamples++, *gainSamples++);
@@ -141,11 +182,56 @@ void BEQBaseUGenInternal::processBlock(bool& shouldDelete, const unsigned int bl
 			y2 = y1; 
 			y1 = y0;			
 		}
-				
+		
 		currentFreq = *(freqSamples-1);
 		currentControl = *(controlSamples-1);
 		currentGain = *(gainSamples-1);
 	}
+	else if((currentFreq != newFreq) || (currentControl != newControl) || (currentGain != newGain))
+	{				
+		// calculate the coefficients at the end of each sub-block and ramp them linearly across it
+		// rather than calling the trig functions every sample
+		while(numSamplesToProcess > 0)
+		{
+			const int numSamples = ugen::min(numSamplesToProcess, (int)FilterCoeffTable::CoeffUpdateSize);
+			const int last = numSamples - 1;
+			const BEQ_COEFF_TYPE slope = 1.f / numSamples;
+			
+			BEQ_COEFF_TYPE a0Ramp = a0, a1Ramp = a1, a2Ramp = a2, b1Ramp = b1, b2Ramp = b2;
+			calculateCoeffs(freqSamples[last], controlSamples[last], gainSamples[last]);
+			
+			const BEQ_COEFF_TYPE a0Slope = (a0 - a0Ramp) * slope;
+			const BEQ_COEFF_TYPE a1Slope = (a1 - a1Ramp) * slope;
+			const BEQ_COEFF_TYPE a2Slope = (a2 - a2Ramp) * slope;
+			const BEQ_COEFF_TYPE b1Slope = (b1 - b1Ramp) * slope;
+			const BEQ_COEFF_TYPE b2Slope = (b2 - b2Ramp) * slope;
+			
+			for(int i = 0; i < numSamples; i++)
+			{
+				a0Ramp += a0Slope;
+				a1Ramp += a1Slope;
+				a2Ramp += a2Slope;
+				b1Ramp += b1Slope;
+				b2Ramp += b2Slope;
+				
+				y0 = inputSamples[i] + b1Ramp * y1 + b2Ramp * y2; 
+				outputSamples[i] = (float)(a0Ramp * y0 + a1Ramp * y1 + a2Ramp * y2);
+				y2 = y1; 
+				y1 = y0;			
+			}
+			
+			currentFreq = freqSamples[last];
+			currentControl = controlSamples[last];
+			currentGain = gainSamples[last];
+			
+			inputSamples += numSamples;
+			outputSamples += numSamples;
+			freqSamples += numSamples;
+			controlSamples += numSamples;
+			gainSamples += numSamples;
+			numSamplesToProcess -= numSamples;
+		}
+	}
 	else
 	{		
 		while(numSamplesToProcess--)
@@ -160,9 +246,26 @@ void BEQBaseUGenInternal::processBlock(bool& shouldDelete, const unsigned int bl
 	
 	y1 = zap(y1);
 	y2 = zap(y2);
+	
+	if(inputIsSilent && (std::abs(y1) < silenceThreshold) && (std::abs(y2) < silenceThreshold))
+		y1 = y2 = 0.f;
 }
 
 
+void BEQBaseUGenInternal::initCoeffs(const float freq, const float control, const float gain) throw()
+{
+	calculateCoeffs(freq, control, gain);
+	
+	if(coeffMode == FilterCoeffTable::Lookup)
+	{
+		FilterCoeffTable* const previousTable = coeffTable;
+		coeffTable = FilterCoeffTable::getInstance(coeffFunction, control, gain);
+		
+		if(previousTable != 0) 
+			previousTable->release();
+	}
+}
+
 void BEQBaseUGenInternal::initValue(const float value) throw()
 {
 	float checkedValue = zap(value);
@@ -170,8 +273,8 @@ void BEQBaseUGenInternal::initValue(const float value) throw()
 	y1 = y2 = checkedValue;
 }
 
-BLowPassUGenInternal::BLowPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq) throw()
-:	BEQBaseUGenInternal(input, freq, rq, UGen::get0())
+BLowPassUGenInternal::BLowPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode) throw()
+:	BEQBaseUGenInternal(input, freq, rq, UGen::get0(), coeffMode, getCoeffs)
 {	
 }
 
@@ -179,7 +282,8 @@ UGenInternal* BLowPassUGenInternal::getChannel(const int channel) throw()
 {
 	return new BLowPassUGenInternal(inputs[Input].getChannel(channel),
 									inputs[Freq].getChannel(channel),
-									inputs[ReciprocalQ].getChannel(channel));
+									inputs[ReciprocalQ].getChannel(channel),
+									coeffMode);
 }
 
 //void BLowPassUGenInternal::calculateCoeffs(const float freq, const float rq, const float gain)
@@ -229,7 +333,8 @@ UGenInternal* BLowPassUGenInternal::getChannel(const int channel) throw()
 //}
 
 
-void BLowPassUGenInternal::calculateCoeffs(const float freq, const float rq, const float gain)
+void BLowPassUGenInternal::getCoeffs(const float freq, const float rq, const float gain,
+									BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw()
 {
 	(void)gain;
 	
@@ -247,10 +352,15 @@ void BLowPassUGenInternal::calculateCoeffs(const float freq, const float rq, con
 	b2 = (1.f - alpha) * -temp1;
 }
 
+void BLowPassUGenInternal::calculateCoeffs(const float freq, const float rq, const float gain)
+{
+	getCoeffs(freq, rq, gain, a0, a1, a2, b1, b2);
+}
+
 
 
 
-BLowPass::BLowPass(UGen const& input, UGen const& freq, UGen const& rq) throw()
+BLowPass::BLowPass(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	UGen inputs[] = { input, freq, rq };
 	const int numInputChannels = findMaxInputChannels(numElementsInArray(inputs), inputs);
@@ -258,14 +368,14 @@ BLowPass::BLowPass(UGen const& input, UGen const& freq, UGen const& rq) throw()
 			
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		BEQBaseUGenInternal* filter = new BLowPassUGenInternal(input, freq, rq);
-		filter->calculateCoeffs(freq.getValue(i), rq.getValue(i), 1.f);
+		BEQBaseUGenInternal* filter = new BLowPassUGenInternal(input, freq, rq, coeffMode);
+		filter->initCoeffs(freq.getValue(i), rq.getValue(i), 0.f);
 		filter->initValue(input.getValue(i));
 		internalUGens[i] = filter;
 	}
 }
 
-BLowPass4::BLowPass4(UGen const& input, UGen const& freq, UGen const& rq) throw()
+BLowPass4::BLowPass4(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	UGen inputs[] = { input, freq, rq };
 	const int numInputChannels = findMaxInputChannels(numElementsInArray(inputs), inputs);
@@ -273,17 +383,18 @@ BLowPass4::BLowPass4(UGen const& input, UGen const& freq, UGen const& rq) throw(
 	
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		BEQBaseUGenInternal* filter = new BLowPassUGenInternal(BLowPass::AR(input, freq, rq), 
+		BEQBaseUGenInternal* filter = new BLowPassUGenInternal(BLowPass::AR(input, freq, rq, 1.f, 0.f, coeffMode), 
 															   freq, 
-															   rq);
-		filter->calculateCoeffs(freq.getValue(i), rq.getValue(i), 1.f);
+															   rq,
+															   coeffMode);
+		filter->initCoeffs(freq.getValue(i), rq.getValue(i), 0.f);
 		filter->initValue(input.getValue(i));
 		internalUGens[i] = filter;
 	}
 }
 
-BHiPassUGenInternal::BHiPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq) throw()
-:	BEQBaseUGenInternal(input, freq, rq, UGen::get0())
+BHiPassUGenInternal::BHiPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode) throw()
+:	BEQBaseUGenInternal(input, freq, rq, UGen::get0(), coeffMode, getCoeffs)
 {	
 }
 
@@ -291,10 +402,12 @@ UGenInternal* BHiPassUGenInternal::getChannel(const int channel) throw()
 {
 	return new BHiPassUGenInternal(inputs[Input].getChannel(channel),
 								   inputs[Freq].getChannel(channel),
-								   inputs[ReciprocalQ].getChannel(channel));
+								   inputs[ReciprocalQ].getChannel(channel),
+								   coeffMode);
 }
 
-void BHiPassUGenInternal::calculateCoeffs(const float freq, const float rq, const float gain)
+void BHiPassUGenInternal::getCoeffs(const float freq, const float rq, const float gain,
+								   BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw()
 {
 	(void)gain; // not used in BHiPass
 	
@@ -310,7 +423,12 @@ void BHiPassUGenInternal::calculateCoeffs(const float freq, const float rq, cons
 	b2 = (1.0 - alpha) * -b0_temp; 
 }
 
-BHiPass::BHiPass(UGen const& input, UGen const& freq, UGen const& rq) throw()
+void BHiPassUGenInternal::calculateCoeffs(const float freq, const float rq, const float gain)
+{
+	getCoeffs(freq, rq, gain, a0, a1, a2, b1, b2);
+}
+
+BHiPass::BHiPass(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	UGen inputs[] = { input, freq, rq };
 	const int numInputChannels = findMaxInputChannels(numElementsInArray(inputs), inputs);
@@ -318,14 +436,14 @@ BHiPass::BHiPass(UGen const& input, UGen const& freq, UGen const& rq) throw()
 		
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		BEQBaseUGenInternal* filter = new BHiPassUGenInternal(input, freq, rq);
-		filter->calculateCoeffs(freq.getValue(i), rq.getValue(i), 1.f);
+		BEQBaseUGenInternal* filter = new BHiPassUGenInternal(input, freq, rq, coeffMode);
+		filter->initCoeffs(freq.getValue(i), rq.getValue(i), 0.f);
 		filter->initValue(input.getValue(i));
 		internalUGens[i] = filter;
 	}
 }
 
-BHiPass4::BHiPass4(UGen const& input, UGen const& freq, UGen const& rq) throw()
+BHiPass4::BHiPass4(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	UGen inputs[] = { input, freq, rq };
 	const int numInputChannels = findMaxInputChannels(numElementsInArray(inputs), inputs);
@@ -333,17 +451,18 @@ BHiPass4::BHiPass4(UGen const& input, UGen const& freq, UGen const& rq) throw()
 	
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		BEQBaseUGenInternal* filter = new BHiPassUGenInternal(BHiPass::AR(input, freq, rq), 
+		BEQBaseUGenInternal* filter = new BHiPassUGenInternal(BHiPass::AR(input, freq, rq, 1.f, 0.f, coeffMode), 
 												   freq, 
-												   rq);
-		filter->calculateCoeffs(freq.getValue(i), rq.getValue(i), 1.f);
+												   rq,
+												   coeffMode);
+		filter->initCoeffs(freq.getValue(i), rq.getValue(i), 0.f);
 		filter->initValue(input.getValue(i));
 		internalUGens[i] = filter;
 	}
 }
 
-BBandPassUGenInternal::BBandPassUGenInternal(UGen const& input, UGen const& freq, UGen const& bw) throw()
-:	BEQBaseUGenInternal(input, freq, bw, 0.f)
+BBandPassUGenInternal::BBandPassUGenInternal(UGen const& input, UGen const& freq, UGen const& bw, const FilterCoeffTable::Mode coeffMode) throw()
+:	BEQBaseUGenInternal(input, freq, bw, 0.f, coeffMode, getCoeffs)
 {	
 }
 
@@ -351,10 +470,12 @@ UGenInternal* BBandPassUGenInternal::getChannel(const int channel) throw()
 {
 	return new BBandPassUGenInternal(inputs[Input].getChannel(channel),
 									 inputs[Freq].getChannel(channel),
-									 inputs[BW].getChannel(channel));
+									 inputs[BW].getChannel(channel),
+									 coeffMode);
 }
 
-void BBandPassUGenInternal::calculateCoeffs(const float freq, const float bw, const float gain)
+void BBandPassUGenInternal::getCoeffs(const float freq, const float bw, const float gain,
+									 BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw()
 {
 	(void)gain; // not used in BBandPass
 	
@@ -369,7 +490,12 @@ void BBandPassUGenInternal::calculateCoeffs(const float freq, const float bw, co
 	b2 = (1.0 - alpha) * -b0_temp; 
 }
 
-BBandPass::BBandPass(UGen const& input, UGen const& freq, UGen const& bw) throw()
+void BBandPassUGenInternal::calculateCoeffs(const float freq, const float bw, const float gain)
+{
+	getCoeffs(freq, bw, gain, a0, a1, a2, b1, b2);
+}
+
+BBandPass::BBandPass(UGen const& input, UGen const& freq, UGen const& bw, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	UGen inputs[] = { input, freq, bw };
 	const int numInputChannels = findMaxInputChannels(numElementsInArray(inputs), inputs);
@@ -377,15 +503,15 @@ BBandPass::BBandPass(UGen const& input, UGen const& freq, UGen const& bw) throw(
 		
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		BEQBaseUGenInternal* filter = new BBandPassUGenInternal(input, freq, bw);
-		filter->calculateCoeffs(freq.getValue(i), bw.getValue(i), 1.f);
+		BEQBaseUGenInternal* filter = new BBandPassUGenInternal(input, freq, bw, coeffMode);
+		filter->initCoeffs(freq.getValue(i), bw.getValue(i), 0.f);
 		filter->initValue(input.getValue(i));
 		internalUGens[i] = filter;
 	}
 }
 
-BBandStopUGenInternal::BBandStopUGenInternal(UGen const& input, UGen const& freq, UGen const& bw) throw()
-:	BEQBaseUGenInternal(input, freq, bw, UGen::get0())
+BBandStopUGenInternal::BBandStopUGenInternal(UGen const& input, UGen const& freq, UGen const& bw, const FilterCoeffTable::Mode coeffMode) throw()
+:	BEQBaseUGenInternal(input, freq, bw, UGen::get0(), coeffMode, getCoeffs)
 {	
 }
 
@@ -393,10 +519,12 @@ UGenInternal* BBandStopUGenInternal::getChannel(const int channel) throw()
 {
 	return new BBandStopUGenInternal(inputs[Input].getChannel(channel),
 									 inputs[Freq].getChannel(channel),
-									 inputs[BW].getChannel(channel));
+									 inputs[BW].getChannel(channel),
+									 coeffMode);
 }
 
-void BBandStopUGenInternal::calculateCoeffs(const float freq, const float bw, const float gain)
+void BBandStopUGenInternal::getCoeffs(const float freq, const float bw, const float gain,
+									 BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw()
 {
 	(void)gain; // not used in BBandStop
 	
@@ -411,7 +539,12 @@ void BBandStopUGenInternal::calculateCoeffs(const float freq, const float bw, co
 	b2 = (1.0 - alpha) * -b0_temp; 
 }
 
-BBandStop::BBandStop(UGen const& input, UGen const& freq, UGen const& bw) throw()
+void BBandStopUGenInternal::calculateCoeffs(const float freq, const float bw, const float gain)
+{
+	getCoeffs(freq, bw, gain, a0, a1, a2, b1, b2);
+}
+
+BBandStop::BBandStop(UGen const& input, UGen const& freq, UGen const& bw, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	UGen inputs[] = { input, freq, bw };
 	const int numInputChannels = findMaxInputChannels(numElementsInArray(inputs), inputs);
@@ -419,15 +552,15 @@ BBandStop::BBandStop(UGen const& input, UGen const& freq, UGen const& bw) throw(
 		
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		BEQBaseUGenInternal* filter = new BBandStopUGenInternal(input, freq, bw);
-		filter->calculateCoeffs(freq.getValue(i), bw.getValue(i), 1.f);
+		BEQBaseUGenInternal* filter = new BBandStopUGenInternal(input, freq, bw, coeffMode);
+		filter->initCoeffs(freq.getValue(i), bw.getValue(i), 0.f);
 		filter->initValue(input.getValue(i));
 		internalUGens[i] = filter;
 	}
 }
 
-BPeakEQUGenInternal::BPeakEQUGenInternal(UGen const& input, UGen const& freq, UGen const& rq, UGen const& gain) throw()
-:	BEQBaseUGenInternal(input, freq, rq, gain)
+BPeakEQUGenInternal::BPeakEQUGenInternal(UGen const& input, UGen const& freq, UGen const& rq, UGen const& gain, const FilterCoeffTable::Mode coeffMode) throw()
+:	BEQBaseUGenInternal(input, freq, rq, gain, coeffMode, getCoeffs)
 {	
 }
 
@@ -436,10 +569,12 @@ UGenInternal* BPeakEQUGenInternal::getChannel(const int channel) throw()
 	return new BPeakEQUGenInternal(inputs[Input].getChannel(channel),
 								   inputs[Freq].getChannel(channel),
 								   inputs[ReciprocalQ].getChannel(channel),
-								   inputs[Gain].getChannel(channel));
+								   inputs[Gain].getChannel(channel),
+								   coeffMode);
 }
 
-void BPeakEQUGenInternal::calculateCoeffs(const float freq, const float rq, const float gain)
+void BPeakEQUGenInternal::getCoeffs(const float freq, const float rq, const float gain,
+								   BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw()
 {	
 	BEQ_CALC_TYPE a = pow(10., (BEQ_CALC_TYPE)gain * (1.0 / 40.0));
 	BEQ_CALC_TYPE w0 = twoPi * (BEQ_CALC_TYPE)freq * UGen::getReciprocalSampleRate(); 
@@ -454,7 +589,12 @@ void BPeakEQUGenInternal::calculateCoeffs(const float freq, const float rq, cons
 	b2 = (1.0 - alphaOver_a) * -b0_temp; 
 }
 
-BPeakEQ::BPeakEQ(UGen const& input, UGen const& freq, UGen const& rq, UGen const& gain) throw()
+void BPeakEQUGenInternal::calculateCoeffs(const float freq, const float rq, const float gain)
+{
+	getCoeffs(freq, rq, gain, a0, a1, a2, b1, b2);
+}
+
+BPeakEQ::BPeakEQ(UGen const& input, UGen const& freq, UGen const& rq, UGen const& gain, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	UGen inputs[] = { input, freq, rq, gain };
 	const int numInputChannels = findMaxInputChannels(numElementsInArray(inputs), inputs);	
@@ -462,15 +602,15 @@ BPeakEQ::BPeakEQ(UGen const& input, UGen const& freq, UGen const& rq, UGen const
 	
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		BEQBaseUGenInternal* filter = new BPeakEQUGenInternal(input, freq, rq, gain);
-		filter->calculateCoeffs(freq.getValue(i), rq.getValue(i), gain.getValue(i));
+		BEQBaseUGenInternal* filter = new BPeakEQUGenInternal(input, freq, rq, gain, coeffMode);
+		filter->initCoeffs(freq.getValue(i), rq.getValue(i), gain.getValue(i));
 		filter->initValue(input.getValue(i) * gain.getValue(i));
 		internalUGens[i] = filter;
 	}
 }
 
-BLowShelfUGenInternal::BLowShelfUGenInternal(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain) throw()
-:	BEQBaseUGenInternal(input, freq, rs, gain)
+BLowShelfUGenInternal::BLowShelfUGenInternal(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain, const FilterCoeffTable::Mode coeffMode) throw()
+:	BEQBaseUGenInternal(input, freq, rs, gain, coeffMode, getCoeffs)
 {	
 }
 
@@ -479,10 +619,12 @@ UGenInternal* BLowShelfUGenInternal::getChannel(const int channel) throw()
 	return new BLowShelfUGenInternal(inputs[Input].getChannel(channel),
 									 inputs[Freq].getChannel(channel),
 									 inputs[ReciprocalS].getChannel(channel),
-									 inputs[Gain].getChannel(channel));
+									 inputs[Gain].getChannel(channel),
+									 coeffMode);
 }
 
-void BLowShelfUGenInternal::calculateCoeffs(const float freq, const float rs, const float gain)
+void BLowShelfUGenInternal::getCoeffs(const float freq, const float rs, const float gain,
+									 BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw()
 {	
 	BEQ_CALC_TYPE a = pow(10., (BEQ_CALC_TYPE)gain * (1.0 / 40.0));
 	BEQ_CALC_TYPE w0 = twoPi * (BEQ_CALC_TYPE)freq * UGen::getReciprocalSampleRate(); 
@@ -504,7 +646,12 @@ void BLowShelfUGenInternal::calculateCoeffs(const float freq, const float rs, co
 	b2 = (aPlus1Minusk + j) * -b0_temp; 
 }
 
-BLowShelf::BLowShelf(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain) throw()
+void BLowShelfUGenInternal::calculateCoeffs(const float freq, const float rs, const float gain)
+{
+	getCoeffs(freq, rs, gain, a0, a1, a2, b1, b2);
+}
+
+BLowShelf::BLowShelf(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	UGen inputs[] = { input, freq, rs, gain };
 	const int numInputChannels = findMaxInputChannels(numElementsInArray(inputs), inputs);	
@@ -512,15 +659,15 @@ BLowShelf::BLowShelf(UGen const& input, UGen const& freq, UGen const& rs, UGen c
 	
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		BEQBaseUGenInternal* filter = new BLowShelfUGenInternal(input, freq, rs, gain);
-		filter->calculateCoeffs(freq.getValue(i), rs.getValue(i), gain.getValue(i));
+		BEQBaseUGenInternal* filter = new BLowShelfUGenInternal(input, freq, rs, gain, coeffMode);
+		filter->initCoeffs(freq.getValue(i), rs.getValue(i), gain.getValue(i));
 		filter->initValue(input.getValue(i) * gain.getValue(i));
 		internalUGens[i] = filter;
 	}
 }
 
-BHiShelfUGenInternal::BHiShelfUGenInternal(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain) throw()
-:	BEQBaseUGenInternal(input, freq, rs, gain)
+BHiShelfUGenInternal::BHiShelfUGenInternal(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain, const FilterCoeffTable::Mode coeffMode) throw()
+:	BEQBaseUGenInternal(input, freq, rs, gain, coeffMode, getCoeffs)
 {	
 }
 
@@ -529,10 +676,12 @@ UGenInternal* BHiShelfUGenInternal::getChannel(const int channel) throw()
 	return new BHiShelfUGenInternal(inputs[Input].getChannel(channel),
 									inputs[Freq].getChannel(channel),
 									inputs[ReciprocalS].getChannel(channel),
-									inputs[Gain].getChannel(channel));
+									inputs[Gain].getChannel(channel),
+									coeffMode);
 }
 
-void BHiShelfUGenInternal::calculateCoeffs(const float freq, const float rs, const float gain)
+void BHiShelfUGenInternal::getCoeffs(const float freq, const float rs, const float gain,
+									BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw()
 {	
 	BEQ_CALC_TYPE a = pow(10., (BEQ_CALC_TYPE)gain * 0.025);
 	BEQ_CALC_TYPE w0 = twoPi * (BEQ_CALC_TYPE)freq * UGen::getReciprocalSampleRate(); 
@@ -554,7 +703,12 @@ void BHiShelfUGenInternal::calculateCoeffs(const float freq, const float rs, con
 	b2 = (aPlus1Minusk - j) * -b0_temp; 
 }
 
-BHiShelf::BHiShelf(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain) throw()
+void BHiShelfUGenInternal::calculateCoeffs(const float freq, const float rs, const float gain)
+{
+	getCoeffs(freq, rs, gain, a0, a1, a2, b1, b2);
+}
+
+BHiShelf::BHiShelf(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	UGen inputs[] = { input, freq, rs, gain };
 	const int numInputChannels = findMaxInputChannels(numElementsInArray(inputs), inputs);	
@@ -562,15 +716,15 @@ BHiShelf::BHiShelf(UGen const& input, UGen const& freq, UGen const& rs, UGen con
 	
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		BEQBaseUGenInternal* filter = new BHiShelfUGenInternal(input, freq, rs, gain);
-		filter->calculateCoeffs(freq.getValue(i), rs.getValue(i), gain.getValue(i));
+		BEQBaseUGenInternal* filter = new BHiShelfUGenInternal(input, freq, rs, gain, coeffMode);
+		filter->initCoeffs(freq.getValue(i), rs.getValue(i), gain.getValue(i));
 		filter->initValue(input.getValue(i) * gain.getValue(i));
 		internalUGens[i] = filter;
 	}
 }
 
-BAllPassUGenInternal::BAllPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq) throw()
-:	BEQBaseUGenInternal(input, freq, rq, 0.f)
+BAllPassUGenInternal::BAllPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode) throw()
+:	BEQBaseUGenInternal(input, freq, rq, 0.f, coeffMode, getCoeffs)
 {	
 }
 
@@ -578,10 +732,12 @@ UGenInternal* BAllPassUGenInternal::getChannel(const int channel) throw()
 {
 	return new BAllPassUGenInternal(inputs[Input].getChannel(channel),
 									inputs[Freq].getChannel(channel),
-									inputs[ReciprocalQ].getChannel(channel));
+									inputs[ReciprocalQ].getChannel(channel),
+									coeffMode);
 }
 
-void BAllPassUGenInternal::calculateCoeffs(const float freq, const float rq, const float gain)
+void BAllPassUGenInternal::getCoeffs(const float freq, const float rq, const float gain,
+									BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw()
 {
 	(void)gain; // not used in BAllPass
 	
@@ -595,7 +751,12 @@ void BAllPassUGenInternal::calculateCoeffs(const float freq, const float rq, con
 	b2 = -a0; 
 }
 
-BAllPass::BAllPass(UGen const& input, UGen const& freq, UGen const& rq) throw()
+void BAllPassUGenInternal::calculateCoeffs(const float freq, const float rq, const float gain)
+{
+	getCoeffs(freq, rq, gain, a0, a1, a2, b1, b2);
+}
+
+BAllPass::BAllPass(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode) throw()
 {
 	UGen inputs[] = { input, freq, rq };
 	const int numInputChannels = findMaxInputChannels(numElementsInArray(inputs), inputs);
@@ -603,8 +764,8 @@ BAllPass::BAllPass(UGen const& input, UGen const& freq, UGen const& rq) throw()
 	
 	for(unsigned int i = 0; i < numInternalUGens; i++)
 	{
-		BEQBaseUGenInternal* filter = new BAllPassUGenInternal(input, freq, rq);
-		filter->calculateCoeffs(freq.getValue(i), rq.getValue(i), 1.f);
+		BEQBaseUGenInternal* filter = new BAllPassUGenInternal(input, freq, rq, coeffMode);
+		filter->initCoeffs(freq.getValue(i), rq.getValue(i), 0.f);
 		filter->initValue(input.getValue(i));
 		internalUGens[i] = filter;
 	}
@@ -41,6 +41,7 @@
 
 #include "../core/ugen_UGen.h"
 #include "../basics/ugen_MulAdd.h"
+#include "ugen_FilterCoeffTable.h"
 
 #define BEQ_COEFF_TYPE float
 #define BEQ_CALC_TYPE float
@@ -54,18 +55,28 @@
 class BEQBaseUGenInternal : public UGenInternal
 {
 public:
-	BEQBaseUGenInternal(UGen const& input, UGen const& freq, UGen const& control, UGen const& gain) throw();
+	BEQBaseUGenInternal(UGen const& input, UGen const& freq, UGen const& control, UGen const& gain,
+						const FilterCoeffTable::Mode coeffMode, FilterCoeffTable::CoeffFunction coeffFunction) throw();
+	~BEQBaseUGenInternal();
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
 	
 	enum Inputs { Input, Freq, Control, Gain, NumInputs }; // subclass should define their own interpretation of "Control" whether rQ, rS or bw
 	
 	virtual void calculateCoeffs(const float freq, const float control, const float gain) = 0;
+	
+	/** Calculate the initial coefficients and get the shared coefficient table if the mode is FilterCoeffTable::Lookup. 
+	 The constructor gets the table using the first value of the control and gain inputs, this is called 
+	 by the UGen constructors to use the values of each channel. */
+	void initCoeffs(const float freq, const float control, const float gain) throw();
 		
 	void initValue(const float value) throw();
 	
 protected:
 	BEQ_COEFF_TYPE y1, y2, a0, a1, a2, b1, b2;
 	float currentFreq, currentControl, currentGain;	
+	const FilterCoeffTable::Mode coeffMode;
+	const FilterCoeffTable::CoeffFunction coeffFunction;
+	FilterCoeffTable* coeffTable;
 };
 
 /**
@@ -74,12 +85,14 @@ protected:
 class BLowPassUGenInternal : public BEQBaseUGenInternal
 {
 public:
-	BLowPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq) throw();
+	BLowPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact) throw();
 	UGenInternal* getChannel(const int channel) throw();
 	
 	enum ControlInput { ReciprocalQ = Control };
 	
 	void calculateCoeffs(const float freq, const float control, const float gain);
+	static void getCoeffs(const float freq, const float control, const float gain,
+						  BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw();
 };
 
 #define BHiAndLowPass_Docs	@param input	The input source to filter.								\
@@ -94,11 +107,11 @@ public:
  @ingroup AllUGens FilterUGens
  @see LPF, RLPF, SOS, BLowPass4, BHiPass, BHiPass4, BBandPass, BBandStop, BHiShelf, BLowShelf, BPeakEQ
  */
-DirectMulAddUGenDeclaration(BLowPass, (input, freq, rq), 
-									  (input, freq, rq, MulAdd_ArgsCall), 
-									  (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f),
-									  (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, MulAdd_ArgsDeclare), 
-							COMMON_UGEN_DOCS BHiAndLowPass_Docs MulAddArgs_Docs);
+DirectMulAddUGenDeclaration(BLowPass, (input, freq, rq, coeffMode), 
+									  (input, freq, rq, MulAdd_ArgsCall, coeffMode), 
+									  (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+									  (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+							COMMON_UGEN_DOCS BHiAndLowPass_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 /**
  Low pass filter.
@@ -108,11 +121,11 @@ DirectMulAddUGenDeclaration(BLowPass, (input, freq, rq),
  @ingroup AllUGens FilterUGens
  @see LPF, RLPF, SOS, BLowPass, BHiPass, BHiPass4, BBandPass, BBandStop, BHiShelf, BLowShelf, BPeakEQ
  */
-DirectMulAddUGenDeclaration(BLowPass4, (input, freq, rq), 
-									   (input, freq, rq, MulAdd_ArgsCall), 
-									   (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f),
-									   (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, MulAdd_ArgsDeclare), 
-							COMMON_UGEN_DOCS BHiAndLowPass_Docs MulAddArgs_Docs);
+DirectMulAddUGenDeclaration(BLowPass4, (input, freq, rq, coeffMode), 
+									   (input, freq, rq, MulAdd_ArgsCall, coeffMode), 
+									   (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+									   (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+							COMMON_UGEN_DOCS BHiAndLowPass_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 /**
  High pass filter internal. @ingroup UGenInternals
@@ -120,12 +133,14 @@ DirectMulAddUGenDeclaration(BLowPass4, (input, freq, rq),
 class BHiPassUGenInternal : public BEQBaseUGenInternal
 {
 public:
-	BHiPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq) throw();
+	BHiPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact) throw();
 	UGenInternal* getChannel(const int channel) throw();
 	
 	enum ControlInput { ReciprocalQ = Control };
 	
 	void calculateCoeffs(const float freq, const float control, const float gain);
+	static void getCoeffs(const float freq, const float control, const float gain,
+						  BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw();
 };
 
 /**
@@ -136,11 +151,11 @@ public:
  @ingroup AllUGens FilterUGens
  @see HPF, RHPF, SOS, BLowPass, BLowPass4, BHiPass4, BBandPass, BBandStop, BHiShelf, BLowShelf, BPeakEQ
  */
-DirectMulAddUGenDeclaration(BHiPass, (input, freq, rq), 
-									 (input, freq, rq, MulAdd_ArgsCall), 
-									 (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f),
-									 (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, MulAdd_ArgsDeclare), 
-							COMMON_UGEN_DOCS BHiAndLowPass_Docs MulAddArgs_Docs);
+DirectMulAddUGenDeclaration(BHiPass, (input, freq, rq, coeffMode), 
+									 (input, freq, rq, MulAdd_ArgsCall, coeffMode), 
+									 (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+									 (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+							COMMON_UGEN_DOCS BHiAndLowPass_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 /**
  High pass filter.
@@ -150,11 +165,11 @@ DirectMulAddUGenDeclaration(BHiPass, (input, freq, rq),
  @ingroup AllUGens FilterUGens
  @see HPF, RHPF, SOS, BLowPass, BLowPass4, BHiPass, BBandPass, BBandStop, BHiShelf, BLowShelf, BPeakEQ
  */
-DirectMulAddUGenDeclaration(BHiPass4, (input, freq, rq), 
-									  (input, freq, rq, MulAdd_ArgsCall), 
-									  (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f),
-									  (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, MulAdd_ArgsDeclare), 
-							COMMON_UGEN_DOCS BHiAndLowPass_Docs MulAddArgs_Docs);
+DirectMulAddUGenDeclaration(BHiPass4, (input, freq, rq, coeffMode), 
+									  (input, freq, rq, MulAdd_ArgsCall, coeffMode), 
+									  (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+									  (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+							COMMON_UGEN_DOCS BHiAndLowPass_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 /**
  Band pass filter internal. @ingroup UGenInternals
@@ -162,12 +177,14 @@ DirectMulAddUGenDeclaration(BHiPass4, (input, freq, rq),
 class BBandPassUGenInternal : public BEQBaseUGenInternal
 {
 public:
-	BBandPassUGenInternal(UGen const& input, UGen const& freq, UGen const& bw) throw();
+	BBandPassUGenInternal(UGen const& input, UGen const& freq, UGen const& bw, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact) throw();
 	UGenInternal* getChannel(const int channel) throw();
 	
 	enum ControlInput { BW = Control };
 	
 	void calculateCoeffs(const float freq, const float control, const float gain);
+	static void getCoeffs(const float freq, const float control, const float gain,
+						  BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw();
 };
 
 #define BBandPassAndStop_Docs	@param input	The input source to filter.								\
@@ -181,11 +198,11 @@ public:
  @ingroup AllUGens FilterUGens
  @see SOS, BLowPass, BLowPass4, BHiPass, BHiPass4, BBandStop, BHiShelf, BLowShelf, BPeakEQ
  */
-DirectMulAddUGenDeclaration(BBandPass, (input, freq, bw), 
-									   (input, freq, bw, MulAdd_ArgsCall), 
-									   (UGen const& input, UGen const& freq = 1200.f, UGen const& bw = 1.f),
-									   (UGen const& input, UGen const& freq = 1200.f, UGen const& bw = 1.f, MulAdd_ArgsDeclare), 
-							COMMON_UGEN_DOCS BBandPassAndStop_Docs MulAddArgs_Docs);
+DirectMulAddUGenDeclaration(BBandPass, (input, freq, bw, coeffMode), 
+									   (input, freq, bw, MulAdd_ArgsCall, coeffMode), 
+									   (UGen const& input, UGen const& freq = 1200.f, UGen const& bw = 1.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+									   (UGen const& input, UGen const& freq = 1200.f, UGen const& bw = 1.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+							COMMON_UGEN_DOCS BBandPassAndStop_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 /**
  Band stop filter internal. @ingroup UGenInternals
@@ -193,12 +210,14 @@ DirectMulAddUGenDeclaration(BBandPass, (input, freq, bw),
 class BBandStopUGenInternal : public BEQBaseUGenInternal
 {
 public:
-	BBandStopUGenInternal(UGen const& input, UGen const& freq, UGen const& bw) throw();
+	BBandStopUGenInternal(UGen const& input, UGen const& freq, UGen const& bw, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact) throw();
 	UGenInternal* getChannel(const int channel) throw();
 	
 	enum ControlInput { BW = Control };
 	
 	void calculateCoeffs(const float freq, const float control, const float gain);
+	static void getCoeffs(const float freq, const float control, const float gain,
+						  BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw();
 };
 
 /**
@@ -207,11 +226,11 @@ public:
  @ingroup AllUGens FilterUGens
  @see SOS, BLowPass, BLowPass4, BHiPass, BHiPass4, BBandPass, BHiShelf, BLowShelf, BPeakEQ
  */
-DirectMulAddUGenDeclaration(BBandStop, (input, freq, bw), 
-									   (input, freq, bw, MulAdd_ArgsCall), 
-									   (UGen const& input, UGen const& freq = 1200.f, UGen const& bw = 1.f),
-									   (UGen const& input, UGen const& freq = 1200.f, UGen const& bw = 1.f, MulAdd_ArgsDeclare), 
-							COMMON_UGEN_DOCS BBandPassAndStop_Docs MulAddArgs_Docs);
+DirectMulAddUGenDeclaration(BBandStop, (input, freq, bw, coeffMode), 
+									   (input, freq, bw, MulAdd_ArgsCall, coeffMode), 
+									   (UGen const& input, UGen const& freq = 1200.f, UGen const& bw = 1.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+									   (UGen const& input, UGen const& freq = 1200.f, UGen const& bw = 1.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+							COMMON_UGEN_DOCS BBandPassAndStop_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 /**
  Peaking filter internal. @ingroup UGenInternals
@@ -219,12 +238,14 @@ DirectMulAddUGenDeclaration(BBandStop, (input, freq, bw),
 class BPeakEQUGenInternal : public BEQBaseUGenInternal
 {
 public:
-	BPeakEQUGenInternal(UGen const& input, UGen const& freq, UGen const& rq, UGen const& gain) throw();
+	BPeakEQUGenInternal(UGen const& input, UGen const& freq, UGen const& rq, UGen const& gain, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact) throw();
 	UGenInternal* getChannel(const int channel) throw();
 	
 	enum ControlInput { ReciprocalQ = Control };
 	
 	void calculateCoeffs(const float freq, const float control, const float gain);
+	static void getCoeffs(const float freq, const float control, const float gain,
+						  BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw();
 };
 
 #define BPeapEQ_Docs	@param input	The input source to filter.								\
@@ -238,11 +259,11 @@ public:
  @ingroup AllUGens FilterUGens
  @see SOS, BLowPass, BLowPass4, BHiPass, BHiPass4, BBandPass, BBandStop, BHiShelf, BLowShelf
 */
-DirectMulAddUGenDeclaration(BPeakEQ, (input, freq, rq, gain), 
-									 (input, freq, rq, gain, MulAdd_ArgsCall), 
-									 (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, UGen const& gain = 0.f),
-									 (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, UGen const& gain = 0.f, MulAdd_ArgsDeclare), 
-							COMMON_UGEN_DOCS BPeapEQ_Docs MulAddArgs_Docs);
+DirectMulAddUGenDeclaration(BPeakEQ, (input, freq, rq, gain, coeffMode), 
+									 (input, freq, rq, gain, MulAdd_ArgsCall, coeffMode), 
+									 (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, UGen const& gain = 0.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+									 (UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, UGen const& gain = 0.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+							COMMON_UGEN_DOCS BPeapEQ_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 /**
  Low shelving filter internal. @ingroup UGenInternals
@@ -250,12 +271,14 @@ DirectMulAddUGenDeclaration(BPeakEQ, (input, freq, rq, gain),
 class BLowShelfUGenInternal : public BEQBaseUGenInternal
 	{
 	public:
-		BLowShelfUGenInternal(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain) throw();
+		BLowShelfUGenInternal(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact) throw();
 		UGenInternal* getChannel(const int channel) throw();
 		
 		enum ControlInput { ReciprocalS = Control };
 		
 		void calculateCoeffs(const float freq, const float control, const float gain);
+		static void getCoeffs(const float freq, const float control, const float gain,
+							  BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw();
 	};
 
 #define BShelf_Docs		@param input	The input source to filter.								\
@@ -273,11 +296,11 @@ class BLowShelfUGenInternal : public BEQBaseUGenInternal
  @see SOS, BLowPass, BLowPass4, BHiPass, BHiPass4, BBandPass, BBandStop, BHiShelf, BPeakEQ
  */
 DirectMulAddUGenDeclaration(BLowShelf, 
-							(input, freq, rs, gain), 
-							(input, freq, rs, gain, MulAdd_ArgsCall), 
-							(UGen const& input, UGen const& freq = 1200.f, UGen const& rs = 1.f, UGen const& gain = 0.f),
-							(UGen const& input, UGen const& freq = 1200.f, UGen const& rs = 1.f, UGen const& gain = 0.f, MulAdd_ArgsDeclare), 
-							COMMON_UGEN_DOCS BShelf_Docs MulAddArgs_Docs);
+							(input, freq, rs, gain, coeffMode), 
+							(input, freq, rs, gain, MulAdd_ArgsCall, coeffMode), 
+							(UGen const& input, UGen const& freq = 1200.f, UGen const& rs = 1.f, UGen const& gain = 0.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+							(UGen const& input, UGen const& freq = 1200.f, UGen const& rs = 1.f, UGen const& gain = 0.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+							COMMON_UGEN_DOCS BShelf_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 /**
  High shelving filter internal. @ingroup UGenInternals
@@ -285,12 +308,14 @@ DirectMulAddUGenDeclaration(BLowShelf,
 class BHiShelfUGenInternal : public BEQBaseUGenInternal
 	{
 	public:
-		BHiShelfUGenInternal(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain) throw();
+		BHiShelfUGenInternal(UGen const& input, UGen const& freq, UGen const& rs, UGen const& gain, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact) throw();
 		UGenInternal* getChannel(const int channel) throw();
 		
 		enum ControlInput { ReciprocalS = Control };
 		
 		void calculateCoeffs(const float freq, const float control, const float gain);
+		static void getCoeffs(const float freq, const float control, const float gain,
+							  BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw();
 	};
 
 /**
@@ -300,11 +325,11 @@ class BHiShelfUGenInternal : public BEQBaseUGenInternal
  @see SOS, BLowPass, BLowPass4, BHiPass, BHiPass4, BBandPass, BBandStop, BLowShelf, BPeakEQ
  */
 DirectMulAddUGenDeclaration(BHiShelf, 
-							(input, freq, rs, gain), 
-							(input, freq, rs, gain, MulAdd_ArgsCall), 
-							(UGen const& input, UGen const& freq = 1200.f, UGen const& rs = 1.f, UGen const& gain = 0.f),
-							(UGen const& input, UGen const& freq = 1200.f, UGen const& rs = 1.f, UGen const& gain = 0.f, MulAdd_ArgsDeclare), 
-							COMMON_UGEN_DOCS BShelf_Docs MulAddArgs_Docs);
+							(input, freq, rs, gain, coeffMode), 
+							(input, freq, rs, gain, MulAdd_ArgsCall, coeffMode), 
+							(UGen const& input, UGen const& freq = 1200.f, UGen const& rs = 1.f, UGen const& gain = 0.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+							(UGen const& input, UGen const& freq = 1200.f, UGen const& rs = 1.f, UGen const& gain = 0.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+							COMMON_UGEN_DOCS BShelf_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 /**
  All pass filter internal. @ingroup UGenInternals
@@ -312,12 +337,14 @@ DirectMulAddUGenDeclaration(BHiShelf,
 class BAllPassUGenInternal : public BEQBaseUGenInternal
 	{
 	public:
-		BAllPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq) throw();
+		BAllPassUGenInternal(UGen const& input, UGen const& freq, UGen const& rq, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact) throw();
 		UGenInternal* getChannel(const int channel) throw();
 		
 		enum ControlInput { ReciprocalQ = Control };
 		
 		void calculateCoeffs(const float freq, const float control, const float gain);
+		static void getCoeffs(const float freq, const float control, const float gain,
+							  BEQ_COEFF_TYPE& a0, BEQ_COEFF_TYPE& a1, BEQ_COEFF_TYPE& a2, BEQ_COEFF_TYPE& b1, BEQ_COEFF_TYPE& b2) throw();
 	};
 
 #define BAllPass_Docs	@param input	The input source to filter.								\
@@ -332,11 +359,11 @@ class BAllPassUGenInternal : public BEQBaseUGenInternal
  @see AllpassL, AllpassN, SOS, BLowPass, BLowPass4, BHiPass, BHiPass4, BBandPass, BBandStop, BHiShelf, BLowShelf, BPeakEQ
   */
 DirectMulAddUGenDeclaration(BAllPass, 
-							(input, freq, rq), 
-							(input, freq, rq, MulAdd_ArgsCall), 
-							(UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f),
-							(UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, MulAdd_ArgsDeclare), 
-							COMMON_UGEN_DOCS BAllPass_Docs MulAddArgs_Docs);
+							(input, freq, rq, coeffMode), 
+							(input, freq, rq, MulAdd_ArgsCall, coeffMode), 
+							(UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact),
+							(UGen const& input, UGen const& freq = 1200.f, UGen const& rq = 1.f, MulAdd_ArgsDeclare, const FilterCoeffTable::Mode coeffMode = FilterCoeffTable::Exact), 
+							COMMON_UGEN_DOCS BAllPass_Docs MulAddArgs_Docs FilterCoeffMode_Docs);
 
 /** A macro as a shorthand for BLowPass. 
  Resonant low pass filter. */ 
@@ -0,0 +1,295 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_BiquadBank.h"
+#include "../basics/ugen_InlineUnaryOps.h"
+#include "../basics/ugen_InlineBinaryOps.h"
+
+BiquadBank::BiquadBank() throw()
+:	numLanes(0),
+	laneStride(0),
+	numSections(0)
+{
+}
+
+BiquadBank::BiquadBank(const int numLanesToUse, const int numSectionsToUse) throw()
+:	numLanes(ugen::max(numLanesToUse, 1)),
+	laneStride(numLanes == 1 ? 1 : (numLanes + 3) & ~3),
+	numSections(ugen::max(numSectionsToUse, 1)),
+	data(BufferSpec(numSections * laneStride, NumArrays, true)),
+	ramping(IntArray::withSize(numSections, true))
+{
+}
+
+void BiquadBank::setCoeffs(const int section, const int lane, 
+						   const float a0, const float a1, const float a2, const float b1, const float b2) throw()
+{
+	ugen_assert(section >= 0 && section < numSections);
+	ugen_assert(lane >= 0 && lane < numLanes);
+	
+	getArray(A0, section)[lane] = getArray(TargetA0, section)[lane] = a0;
+	getArray(A1, section)[lane] = getArray(TargetA1, section)[lane] = a1;
+	getArray(A2, section)[lane] = getArray(TargetA2, section)[lane] = a2;
+	getArray(B1, section)[lane] = getArray(TargetB1, section)[lane] = b1;
+	getArray(B2, section)[lane] = getArray(TargetB2, section)[lane] = b2;
+}
+
+void BiquadBank::setTargetCoeffs(const int section, const int lane, 
+								 const float a0, const float a1, const float a2, const float b1, const float b2) throw()
+{
+	ugen_assert(section >= 0 && section < numSections);
+	ugen_assert(lane >= 0 && lane < numLanes);
+	
+	getArray(TargetA0, section)[lane] = a0;
+	getArray(TargetA1, section)[lane] = a1;
+	getArray(TargetA2, section)[lane] = a2;
+	getArray(TargetB1, section)[lane] = b1;
+	getArray(TargetB2, section)[lane] = b2;
+	
+	ramping[section] = 1;
+}
+
+void BiquadBank::process(float* samples, const int numSamples) throw()
+{
+	if(numSamples <= 0) return;
+	
+	for(int section = 0; section < numSections; section++)
+	{
+		if(ramping[section])
+		{
+			processSectionRamp(section, samples, numSamples);
+			ramping[section] = 0;
+		}
+		else
+		{
+			processSection(section, samples, numSamples);
+		}
+	}
+}
+
+void BiquadBank::processSection(const int section, float* samples, const int numSamples) throw()
+{
+	const float* a0 = getArray(A0, section);
+	const float* a1 = getArray(A1, section);
+	const float* a2 = getArray(A2, section);
+	const float* b1 = getArray(B1, section);
+	const float* b2 = getArray(B2, section);
+	float* y1 = getArray(Y1, section);
+	float* y2 = getArray(Y2, section);
+	const int lanes = laneStride;
+	
+	for(int i = 0; i < numSamples; i++)
+	{
+		float* frame = samples + i * lanes;
+		
+		for(int lane = 0; lane < lanes; lane++)
+		{
+			const float y0 = frame[lane] + b1[lane] * y1[lane] + b2[lane] * y2[lane];
+			frame[lane] = a0[lane] * y0 + a1[lane] * y1[lane] + a2[lane] * y2[lane];
+			y2[lane] = y1[lane];
+			y1[lane] = y0;
+		}
+	}
+	
+	for(int lane = 0; lane < lanes; lane++)
+	{
+		y1[lane] = zap(y1[lane]);
+		y2[lane] = zap(y2[lane]);
+	}
+}
+
+void BiquadBank::processSectionRamp(const int section, float* samples, const int numSamples) throw()
+{
+	float* a0 = getArray(A0, section);
+	float* a1 = getArray(A1, section);
+	float* a2 = getArray(A2, section);
+	float* b1 = getArray(B1, section);
+	float* b2 = getArray(B2, section);
+	float* a0Step = getArray(StepA0, section);
+	float* a1Step = getArray(StepA1, section);
+	float* a2Step = getArray(StepA2, section);
+	float* b1Step = getArray(StepB1, section);
+	float* b2Step = getArray(StepB2, section);
+	float* y1 = getArray(Y1, section);
+	float* y2 = getArray(Y2, section);
+	const int lanes = laneStride;
+	const float slope = 1.f / numSamples;
+	
+	for(int lane = 0; lane < lanes; lane++)
+	{
+		a0Step[lane] = (getArray(TargetA0, section)[lane] - a0[lane]) * slope;
+		a1Step[lane] = (getArray(TargetA1, section)[lane] - a1[lane]) * slope;
+		a2Step[lane] = (getArray(TargetA2, section)[lane] - a2[lane]) * slope;
+		b1Step[lane] = (getArray(TargetB1, section)[lane] - b1[lane]) * slope;
+		b2Step[lane] = (getArray(TargetB2, section)[lane] - b2[lane]) * slope;
+	}
+	
+	for(int i = 0; i < numSamples; i++)
+	{
+		float* frame = samples + i * lanes;
+		
+		for(int lane = 0; lane < lanes; lane++)
+		{
+			a0[lane] += a0Step[lane];
+			a1[lane] += a1Step[lane];
+			a2[lane] += a2Step[lane];
+			b1[lane] += b1Step[lane];
+			b2[lane] += b2Step[lane];
+			
+			const float y0 = frame[lane] + b1[lane] * y1[lane] + b2[lane] * y2[lane];
+			frame[lane] = a0[lane] * y0 + a1[lane] * y1[lane] + a2[lane] * y2[lane];
+			y2[lane] = y1[lane];
+			y1[lane] = y0;
+		}
+	}
+	
+	// avoid accumulating rounding errors in the ramps
+	const int size = lanes * (int)sizeof(float);
+	memcpy(a0, getArray(TargetA0, section), size);
+	memcpy(a1, getArray(TargetA1, section), size);
+	memcpy(a2, getArray(TargetA2, section), size);
+	memcpy(b1, getArray(TargetB1, section), size);
+	memcpy(b2, getArray(TargetB2, section), size);
+	
+	for(int lane = 0; lane < lanes; lane++)
+	{
+		y1[lane] = zap(y1[lane]);
+		y2[lane] = zap(y2[lane]);
+	}
+}
+
+void BiquadBank::initValue(const int lane, const float value) throw()
+{
+	ugen_assert(lane >= 0 && lane < numLanes);
+	
+	float sectionInput = zap(value);
+	
+	for(int section = 0; section < numSections; section++)
+	{
+		// the steady state for a constant input
+		const float b1 = getArray(B1, section)[lane];
+		const float b2 = getArray(B2, section)[lane];
+		const float denominator = 1.f - b1 - b2;
+		const float state = denominator != 0.f ? zap(sectionInput / denominator) : 0.f;
+		
+		getArray(Y1, section)[lane] = state;
+		getArray(Y2, section)[lane] = state;
+		
+		sectionInput = state * (getArray(A0, section)[lane] + getArray(A1, section)[lane] + getArray(A2, section)[lane]);
+	}
+}
+
+void BiquadBank::clear() throw()
+{
+	const int size = numSections * laneStride * (int)sizeof(float);
+	memset(data.getData(Y1), 0, size);
+	memset(data.getData(Y2), 0, size);
+}
+
+bool BiquadBank::isBelow(const float threshold) const throw()
+{
+	const int size = numSections * laneStride;
+	const float* y1 = data.getData(Y1);
+	const float* y2 = data.getData(Y2);
+	
+	for(int i = 0; i < size; i++)
+	{
+		if((std::abs(y1[i]) >= threshold) || (std::abs(y2[i]) >= threshold))
+			return false;
+	}
+	
+	return true;
+}
+
+void BiquadBank::interleave(const float** laneSamples, const int numLanes, const int laneStride, 
+							float* samples, const int numSamples) throw()
+{
+	if(laneStride == 1)
+	{
+		if(samples != laneSamples[0])
+			memcpy(samples, laneSamples[0], numSamples * sizeof(float));
+		
+		return;
+	}
+	
+	for(int lane = 0; lane < numLanes; lane++)
+	{
+		const float* input = laneSamples[lane];
+		float* output = samples + lane;
+		
+		for(int i = 0; i < numSamples; i++)
+			output[i * laneStride] = input[i];
+	}
+	
+	// keep the padding lanes silent
+	for(int lane = numLanes; lane < laneStride; lane++)
+	{
+		float* output = samples + lane;
+		
+		for(int i = 0; i < numSamples; i++)
+			output[i * laneStride] = 0.f;
+	}
+}
+
+void BiquadBank::deinterleave(const float* samples, const int numLanes, const int laneStride, 
+							  float** laneSamples, const int numSamples) throw()
+{
+	if(laneStride == 1)
+	{
+		if(samples != laneSamples[0])
+			memcpy(laneSamples[0], samples, numSamples * sizeof(float));
+		
+		return;
+	}
+	
+	for(int lane = 0; lane < numLanes; lane++)
+	{
+		const float* input = samples + lane;
+		float* output = laneSamples[lane];
+		
+		for(int i = 0; i < numSamples; i++)
+			output[i] = input[i * laneStride];
+	}
+}
+
+END_UGEN_NAMESPACE
@@ -0,0 +1,126 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#ifndef _UGEN_ugen_BiquadBank_H_
+#define _UGEN_ugen_BiquadBank_H_
+
+#include "../core/ugen_UGen.h"
+#include "../buffers/ugen_Buffer.h"
+
+/** Processes a cascade of biquad sections on several independent lanes (e.g., channels) at once.
+ 
+ The coefficients and state for each section are stored lane by lane in contiguous arrays 
+ (padded to a multiple of 4 lanes) and the samples are interleaved so the inner loop runs across
+ the lanes. There are no dependencies between lanes so this loop can be vectorised by the compiler.
+ 
+ Each section uses the same direct form as BEQ and SOS:
+ 
+ y0 = in(i) + (b1 * y1) + (b2 * y2)
+ out(i) = (a0 * y0) + (a1 * y1) + (a2 * y2)
+ 
+ Coefficients set with setTargetCoeffs() are ramped linearly over the next call to process() 
+ which allows the coefficients to be calculated once per sub-block for modulated filters.
+ 
+ @see BEQBaseUGenInternal, SOS, ParametricEQ */
+class BiquadBank
+{
+public:
+	BiquadBank() throw();
+	BiquadBank(const int numLanes, const int numSections) throw();
+	
+	/** Set the coefficients for a section and lane immediately. */
+	void setCoeffs(const int section, const int lane, 
+				   const float a0, const float a1, const float a2, const float b1, const float b2) throw();
+	
+	/** Set the coefficients for a section and lane to be reached at the end of the next call to process(). */
+	void setTargetCoeffs(const int section, const int lane, 
+						 const float a0, const float a1, const float a2, const float b1, const float b2) throw();
+	
+	/** Filter interleaved samples in place through all the sections. 
+	 The samples for each lane are at laneIndex + sampleIndex * getLaneStride(). */
+	void process(float* samples, const int numSamples) throw();
+	
+	/** Set the state of all the sections of a lane as if the input had been constant at this value. */
+	void initValue(const int lane, const float value) throw();
+	
+	/** Clear the state of all the sections and lanes. */
+	void clear() throw();
+	
+	/** Returns true if the state of all the sections and lanes is below a threshold. */
+	bool isBelow(const float threshold) const throw();
+	
+	inline int getNumLanes() const throw()		{ return numLanes;		}
+	inline int getLaneStride() const throw()	{ return laneStride;	}
+	inline int getNumSections() const throw()	{ return numSections;	}
+	
+	/** Interleave blocks of samples (one per lane) into a buffer for process(). */
+	static void interleave(const float** laneSamples, const int numLanes, const int laneStride, 
+						   float* samples, const int numSamples) throw();
+	
+	/** Split samples processed with process() back into blocks (one per lane). */
+	static void deinterleave(const float* samples, const int numLanes, const int laneStride, 
+							 float** laneSamples, const int numSamples) throw();
+	
+private:
+	enum Arrays 
+	{ 
+		A0, A1, A2, B1, B2, 
+		TargetA0, TargetA1, TargetA2, TargetB1, TargetB2,
+		StepA0, StepA1, StepA2, StepB1, StepB2,
+		Y1, Y2,
+		NumArrays
+	};
+	
+	inline float* getArray(const int array, const int section) throw() 
+	{ 
+		return data.getData(array) + section * laneStride; 
+	}
+	
+	void processSection(const int section, float* samples, const int numSamples) throw();
+	void processSectionRamp(const int section, float* samples, const int numSamples) throw();
+	
+	int numLanes;
+	int laneStride;
+	int numSections;
+	Buffer data;			// one channel for each of Arrays, numSections * laneStride in each
+	IntArray ramping;		// whether each section has target coefficients to ramp to
+};
+
+
+#endif // _UGEN_ugen_BiquadBank_H_
@@ -0,0 +1,127 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_FilterCoeffTable.h"
+#include "../basics/ugen_InlineBinaryOps.h"
+
+FilterCoeffTable* FilterCoeffTable::first = 0;
+AtomicSpinLock FilterCoeffTable::lock;
+
+FilterCoeffTable::FilterCoeffTable(CoeffFunction functionToUse, const float controlToUse, const float gainToUse, const double sampleRateToUse) throw()
+:	function(functionToUse),
+	control(controlToUse),
+	gain(gainToUse),
+	sampleRate(sampleRateToUse),
+	minimumFreq((float)(1 << MinimumOctave)),
+	maximumPosition(0.f),
+	next(0),
+	refCount(1),
+	table(BufferSpec(TableSize * NumCoeffs, 1, true))
+{
+	// just below Nyquist since the coefficient functions are not valid beyond it
+	const double maximumFreq = sampleRate * 0.49;
+	float* entry = table.getData(0);
+	
+	for(int index = 0; index < TableSize; index++, entry += NumCoeffs)
+	{
+		const int octave = index / StepsPerOctave;
+		const double fraction = (double)(index % StepsPerOctave) / StepsPerOctave;
+		const double freq = ugen::min(ldexp(1.0 + fraction, MinimumOctave + octave), maximumFreq);
+		
+		function((float)freq, control, gain, entry[0], entry[1], entry[2], entry[3], entry[4]);
+		
+		if(freq < maximumFreq)
+			maximumPosition = (float)index;
+	}
+	
+	// the last entry below Nyquist is used for all the higher frequencies
+	maximumPosition = ugen::min(maximumPosition + 1.f, (float)(TableSize - 2));
+}
+
+FilterCoeffTable* FilterCoeffTable::getInstance(CoeffFunction function, const float control, const float gain) throw()
+{
+	// one for each function, control, gain and sample rate, kept while any filter is using it
+	const ScopedAtomicSpinLock sl(lock);
+	const double sampleRate = UGen::getSampleRate();
+	
+	for(FilterCoeffTable* table = first; table != 0; table = table->next)
+	{
+		if(table->function == function && 
+		   table->control == control && 
+		   table->gain == gain && 
+		   table->sampleRate == sampleRate)
+		{
+			table->refCount++;
+			return table;
+		}
+	}
+	
+	FilterCoeffTable* table = new FilterCoeffTable(function, control, gain, sampleRate);
+	table->next = first;
+	first = table;
+	
+	return table;
+}
+
+void FilterCoeffTable::release() throw()
+{
+	{
+		const ScopedAtomicSpinLock sl(lock);
+		
+		ugen_assert(refCount > 0);
+		
+		if(--refCount > 0)
+			return;
+		
+		FilterCoeffTable** link = &first;
+		
+		while(*link != this)
+			link = &(*link)->next;
+		
+		*link = next;
+	}
+	
+	delete this;
+}
+
+END_UGEN_NAMESPACE
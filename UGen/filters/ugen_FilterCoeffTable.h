@@ -0,0 +1,140 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#ifndef _UGEN_ugen_FilterCoeffTable_H_
+#define _UGEN_ugen_FilterCoeffTable_H_
+
+#include "../core/ugen_UGen.h"
+#include "../buffers/ugen_Buffer.h"
+#include "../core/ugen_AtomicSpinLock.h"
+
+/** A table of biquad coefficients indexed by frequency.
+ 
+ Tables are shared between all the filters using the same coefficient function, control and gain
+ values (and sample rate). The table covers 8Hz to the Nyquist frequency with the entries spaced 
+ linearly within each octave so that the index can be found from the exponent and mantissa of the 
+ frequency without calling log().
+ 
+ This also defines the coefficient update modes for the BEQ filters, LPF and HPF when their 
+ frequency is modulated.
+ @see BEQBaseUGenInternal, LPF, HPF */
+class FilterCoeffTable
+{
+public:
+	/** How a filter updates its coefficients when the parameters change. */
+	enum Mode 
+	{ 
+		Exact,			///< Calculate the coefficients as the filter always has (the default), for every sample for the BEQ filters and ramped across each block for LPF and HPF.
+		Interpolate,	///< Calculate the coefficients every CoeffUpdateSize samples and interpolate linearly in between.
+		Lookup			///< Look up the coefficients for every sample from a shared table, only the frequency may be modulated.
+	};
+	
+	enum Constants 
+	{ 
+		CoeffUpdateSize = 16, 
+		StepsPerOctave = 32, 
+		MinimumOctave = 3, 
+		NumOctaves = 13, 
+		TableSize = StepsPerOctave * NumOctaves + 2, 
+		NumCoeffs = 5 
+	};
+	
+	/** A function to calculate a set of coefficients, e.g., BLowPassUGenInternal::getCoeffs(). */
+	typedef void (*CoeffFunction)(const float freq, const float control, const float gain, 
+								  float& a0, float& a1, float& a2, float& b1, float& b2);
+	
+	/** Get the shared table for a coefficient function, control and gain at the current sample rate. 
+	 The table is created if necessary and a reference is added for the caller which must call release()
+	 when it no longer needs the table, the table is deleted when its last user releases it. This must be 
+	 called when the filter is constructed, never during processing. This is thread safe since filters 
+	 may be constructed on more than one thread. */
+	static FilterCoeffTable* getInstance(CoeffFunction function, const float control, const float gain) throw();
+	
+	/** Remove a reference added by getInstance(), the table is deleted if this was the last one. */
+	void release() throw();
+	
+	inline float getControl() const throw()		{ return control;	}
+	inline float getGain() const throw()		{ return gain;		}
+	
+	/** Get the coefficients for a frequency, interpolating linearly between the table entries. */
+	inline void lookup(const float freq, float& a0, float& a1, float& a2, float& b1, float& b2) const throw()
+	{
+		int exponent;
+		const float mantissa = (float)frexp(freq < minimumFreq ? minimumFreq : freq, &exponent); // 0.5 <= mantissa < 1
+		float position = ((exponent - 1 - MinimumOctave) + (mantissa * 2.f - 1.f)) * StepsPerOctave;
+		
+		if(position >= maximumPosition) 
+			position = maximumPosition;
+		
+		const int index = (int)position;
+		const float frac = position - index;
+		const float* entry = table.getData(0) + index * NumCoeffs;
+		
+		a0 = entry[0] + frac * (entry[NumCoeffs + 0] - entry[0]);
+		a1 = entry[1] + frac * (entry[NumCoeffs + 1] - entry[1]);
+		a2 = entry[2] + frac * (entry[NumCoeffs + 2] - entry[2]);
+		b1 = entry[3] + frac * (entry[NumCoeffs + 3] - entry[3]);
+		b2 = entry[4] + frac * (entry[NumCoeffs + 4] - entry[4]);
+	}
+	
+private:
+	FilterCoeffTable(CoeffFunction function, const float control, const float gain, const double sampleRate) throw();
+	
+	const CoeffFunction function;
+	const float control;
+	const float gain;
+	const double sampleRate;
+	const float minimumFreq;
+	float maximumPosition;
+	FilterCoeffTable* next;
+	int refCount;
+	Buffer table;		// NumCoeffs for each entry
+	
+	static FilterCoeffTable* first;
+	static AtomicSpinLock lock;
+};
+
+#define FilterCoeffMode_Docs	@param coeffMode	How the coefficients are updated when the frequency is modulated,					\
+												FilterCoeffTable::Exact (the default) calculates them as the filter always has,		\
+												FilterCoeffTable::Interpolate calculates them every 16 samples and interpolates		\
+												in between, FilterCoeffTable::Lookup reads them every sample from a table shared	\
+												between filters with the same settings (only the frequency should be modulated		\
+												in this mode).
+
+#endif // _UGEN_ugen_FilterCoeffTable_H_
@@ -0,0 +1,205 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#ifndef UGEN_NOEXTGPL
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_ParametricEQ.h"
+#include "ugen_BEQ.h"
+#include "../core/ugen_Constants.h"
+#include "../basics/ugen_InlineUnaryOps.h"
+#include "../basics/ugen_InlineBinaryOps.h"
+
+ParametricEQUGenInternal::ParametricEQUGenInternal(UGen const& input, 
+												   IntArray const& typesToUse, 
+												   UGen const& freqs, 
+												   UGen const& controls, 
+												   UGen const& gains) throw()
+:	ProxyOwnerUGenInternal(NumInputs, input.getNumChannels() - 1),
+	numChannels(input.getNumChannels()),
+	numBands(ugen::max(typesToUse.size(), 1)),
+	types(IntArray::withSize(numBands, true)),
+	bank(numChannels, numBands),
+	bandParameters(BufferSpec(numBands, 3, true)),
+	scratch(BufferSpec(CoeffUpdateSize * bank.getLaneStride(), 1, true)),
+	inputBlocks(ObjectArray<float*>::withSize(numChannels + numBands * 3)),
+	outputBlocks(ObjectArray<float*>::withSize(numChannels))
+{
+	inputs[Input] = input;
+	inputs[Freqs] = freqs;
+	inputs[Controls] = controls;
+	inputs[Gains] = gains;
+	
+	for(int band = 0; band < typesToUse.size(); band++)
+		types[band] = clip(typesToUse[band], 0, NumBandTypes - 1);
+	
+	if(typesToUse.size() == 0)
+		types[0] = AllPass;
+	
+	for(int band = 0; band < numBands; band++)
+		updateBand(band, freqs.getValue(band), controls.getValue(band), gains.getValue(band), false);
+	
+	for(int channel = 0; channel < numChannels; channel++)
+		bank.initValue(channel, input.getValue(channel));
+}
+
+void ParametricEQUGenInternal::getCoeffs(const int type, const float freq, const float control, const float gain,
+										 float& a0, float& a1, float& a2, float& b1, float& b2) throw()
+{
+	switch(type)
+	{
+		case LowPass:	BLowPassUGenInternal::getCoeffs(freq, control, gain, a0, a1, a2, b1, b2);	break;
+		case HiPass:	BHiPassUGenInternal::getCoeffs(freq, control, gain, a0, a1, a2, b1, b2);	break;
+		case BandPass:	BBandPassUGenInternal::getCoeffs(freq, control, gain, a0, a1, a2, b1, b2);	break;
+		case BandStop:	BBandStopUGenInternal::getCoeffs(freq, control, gain, a0, a1, a2, b1, b2);	break;
+		case PeakEQ:	BPeakEQUGenInternal::getCoeffs(freq, control, gain, a0, a1, a2, b1, b2);	break;
+		case LowShelf:	BLowShelfUGenInternal::getCoeffs(freq, control, gain, a0, a1, a2, b1, b2);	break;
+		case HiShelf:	BHiShelfUGenInternal::getCoeffs(freq, control, gain, a0, a1, a2, b1, b2);	break;
+		default:		BAllPassUGenInternal::getCoeffs(freq, control, gain, a0, a1, a2, b1, b2);	break;
+	}
+}
+
+void ParametricEQUGenInternal::updateBand(const int band, const float freq, const float control, const float gain, const bool ramp) throw()
+{
+	float* freqs = bandParameters.getData(0);
+	float* controls = bandParameters.getData(1);
+	float* gains = bandParameters.getData(2);
+	
+	if(ramp && (freqs[band] == freq) && (controls[band] == control) && (gains[band] == gain))
+		return;
+	
+	freqs[band] = freq;
+	controls[band] = control;
+	gains[band] = gain;
+	
+	float a0, a1, a2, b1, b2;
+	getCoeffs(types[band], freq, control, gain, a0, a1, a2, b1, b2);
+	
+	// the same coefficients are used for every channel
+	for(int channel = 0; channel < numChannels; channel++)
+	{
+		if(ramp)
+			bank.setTargetCoeffs(band, channel, a0, a1, a2, b1, b2);
+		else
+			bank.setCoeffs(band, channel, a0, a1, a2, b1, b2);
+	}
+}
+
+void ParametricEQUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
+{
+	const int blockSize = uGenOutput.getBlockSize();
+	float** inputSamples = inputBlocks.getArray();
+	float** freqSamples = inputSamples + numChannels;
+	float** controlSamples = freqSamples + numBands;
+	float** gainSamples = controlSamples + numBands;
+	float** outputSamples = outputBlocks.getArray();
+	bool inputIsSilent = true;
+	
+	for(int channel = 0; channel < numChannels; channel++)
+	{
+		inputSamples[channel] = inputs[Input].processBlock(shouldDelete, blockID, channel);
+		outputSamples[channel] = proxies[channel]->getSampleData();
+		inputIsSilent = inputIsSilent && inputs[Input].isSilent(channel);
+	}
+	
+	for(int band = 0; band < numBands; band++)
+	{
+		freqSamples[band] = inputs[Freqs].processBlock(shouldDelete, blockID, band);
+		controlSamples[band] = inputs[Controls].processBlock(shouldDelete, blockID, band);
+		gainSamples[band] = inputs[Gains].processBlock(shouldDelete, blockID, band);
+	}
+	
+	if(inputIsSilent && bank.isBelow(silenceThreshold))
+	{
+		// the tail has decayed
+		bank.clear();
+		
+		for(int channel = 0; channel < numChannels; channel++)
+			proxies[channel]->getOutputRef().setSilentAndClear();
+		
+		return;
+	}
+	
+	for(int channel = 0; channel < numChannels; channel++)
+		proxies[channel]->getOutputRef().setSilent(false);
+	
+	const int laneStride = bank.getLaneStride();
+	float* scratchSamples = scratch.getData(0);
+	int offset = 0;
+	
+	while(offset < blockSize)
+	{
+		const int numSamples = ugen::min((int)CoeffUpdateSize, blockSize - offset);
+		const int last = offset + numSamples - 1;
+		
+		// parameters are read at the end of each sub-block and the coefficients ramped towards them
+		for(int band = 0; band < numBands; band++)
+			updateBand(band, freqSamples[band][last], controlSamples[band][last], gainSamples[band][last], true);
+		
+		BiquadBank::interleave((const float**)inputSamples, numChannels, laneStride, scratchSamples, numSamples);
+		bank.process(scratchSamples, numSamples);
+		BiquadBank::deinterleave(scratchSamples, numChannels, laneStride, outputSamples, numSamples);
+		
+		for(int channel = 0; channel < numChannels; channel++)
+		{
+			inputSamples[channel] += numSamples;
+			outputSamples[channel] += numSamples;
+		}
+		
+		offset += numSamples;
+	}
+}
+
+ParametricEQ::ParametricEQ(UGen const& input, 
+						   IntArray const& types, 
+						   UGen const& freqs, 
+						   UGen const& controls, 
+						   UGen const& gains) throw()
+{
+	const int numChannels = input.getNumChannels();
+	initInternal(numChannels);
+	generateFromProxyOwner(new ParametricEQUGenInternal(input, types, freqs, controls, gains));
+}
+
+END_UGEN_NAMESPACE
+
+#endif // gpl
@@ -0,0 +1,123 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+
+#ifndef _UGEN_ugen_ParametricEQ_H_
+#define _UGEN_ugen_ParametricEQ_H_
+
+#include "../core/ugen_UGen.h"
+#include "ugen_BiquadBank.h"
+
+/** Multichannel multiband EQ internal. 
+ 
+ Applies the same cascade of bands to every channel using a BiquadBank with one lane per channel
+ so the coefficients are only calculated once for all the channels, and only when the band 
+ parameters change.
+ @ingroup UGenInternals */
+class ParametricEQUGenInternal : public ProxyOwnerUGenInternal
+{
+public:
+	/** The filter type of each band, these correspond to the BEQ filters. */
+	enum BandType 
+	{ 
+		LowPass,		///< BLowPass, control is rq.
+		HiPass,			///< BHiPass, control is rq.
+		BandPass,		///< BBandPass, control is bw.
+		BandStop,		///< BBandStop, control is bw.
+		PeakEQ,			///< BPeakEQ, control is rq.
+		LowShelf,		///< BLowShelf, control is rs.
+		HiShelf,		///< BHiShelf, control is rs.
+		AllPass,		///< BAllPass, control is rq.
+		NumBandTypes
+	};
+	
+	ParametricEQUGenInternal(UGen const& input, IntArray const& types, UGen const& freqs, UGen const& controls, UGen const& gains) throw();
+	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
+	enum Inputs { Input, Freqs, Controls, Gains, NumInputs };
+	
+	/** The band parameters are read every CoeffUpdateSize samples and the coefficients interpolated linearly in between. */
+	enum Constants { CoeffUpdateSize = 16 };
+	
+	static void getCoeffs(const int type, const float freq, const float control, const float gain,
+						  float& a0, float& a1, float& a2, float& b1, float& b2) throw();
+	
+protected:
+	void updateBand(const int band, const float freq, const float control, const float gain, const bool ramp) throw();
+	
+	const int numChannels;
+	const int numBands;
+	IntArray types;
+	BiquadBank bank;
+	Buffer bandParameters;				// the current freq, control and gain of each band
+	Buffer scratch;						// interleaved samples for one sub-block
+	ObjectArray<float*> inputBlocks;	// input blocks for each channel then freq, control and gain blocks for each band
+	ObjectArray<float*> outputBlocks;
+};
+
+#define ParametricEQ_Docs	@param input	The input source to filter, each channel is filtered with the same bands.		\
+							@param types	The ParametricEQUGenInternal::BandType of each band, the size of this			\
+											array sets the number of bands.													\
+							@param freqs	The frequency of each band, one channel per band.								\
+							@param controls	The rq, bw or rs of each band (depending on its type), one channel per band.	\
+							@param gains	The gain in dBs of each band (peak and shelf bands only), one channel per band.
+
+/** Multichannel multiband parametric EQ.
+ 
+ This is equivalent to a chain of BEQ filters (e.g., BLowShelf, BPeakEQ, BHiShelf) applied to each 
+ channel of the input but all the bands and channels are processed together. This is much cheaper
+ than separate BEQ filters for large EQs on many channels since the coefficients are shared between 
+ the channels and the filters run across the channels in parallel. The band parameter inputs
+ are read every 16 samples.
+ 
+ @code
+	IntArray types = IntArray(ParametricEQUGenInternal::LowShelf, ParametricEQUGenInternal::PeakEQ, ParametricEQUGenInternal::HiShelf);
+	UGen eq = ParametricEQ::AR(input, types, U(200, 1000, 5000), U(1, 0.5, 1), U(3, -6, 2));
+ @endcode
+ 
+ @ingroup AllUGens FilterUGens
+ @see BiquadBank, BPeakEQ, BLowShelf, BHiShelf, SOS */
+UGenSublcassDeclaration(ParametricEQ, (input, types, freqs, controls, gains),
+						(UGen const& input, 
+						 IntArray const& types, 
+						 UGen const& freqs, 
+						 UGen const& controls = 1.f, 
+						 UGen const& gains = 0.f), 
+						COMMON_UGEN_DOCS ParametricEQ_Docs);
+
+#endif // _UGEN_ugen_ParametricEQ_H_
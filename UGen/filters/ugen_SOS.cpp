@@ -79,14 +79,36 @@ void SOSUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockI
 	float* b1Samples = inputs[B1].processBlock(shouldDelete, blockID, channel);
 	float* b2Samples = inputs[B2].processBlock(shouldDelete, blockID, channel);
 	float y0;
+	
+	if(inputs[A0].isConstant(channel) && inputs[A1].isConstant(channel) && inputs[A2].isConstant(channel) &&
+	   inputs[B1].isConstant(channel) && inputs[B2].isConstant(channel))
+	{
+		// fixed coefficients so keep them in registers
+		const float a0 = *a0Samples;
+		const float a1 = *a1Samples;
+		const float a2 = *a2Samples;
+		const float b1 = *b1Samples;
+		const float b2 = *b2Samples;
 		
-	while(numSamplesToProcess--)
+		while(numSamplesToProcess--)
+		{
+			y0 = *inputSamples++ + b1 * y1 + b2 * y2; 
+			*outputSamples++ = a0 * y0 + a1 * y1 + a2 * y2;
+			
+			y2 = y1; 
+			y1 = y0;
+		}
+	}
+	else
 	{
-		y0 = *inputSamples++ + *b1Samples++ * y1 + *b2Samples++ * y2; 
-		*outputSamples++ = *a0Samples++ * y0 + *a1Samples++ * y1 + *a2Samples++ * y2;
+		while(numSamplesToProcess--)
+		{
+			y0 = *inputSamples++ + *b1Samples++ * y1 + *b2Samples++ * y2; 
+			*outputSamples++ = *a0Samples++ * y0 + *a1Samples++ * y1 + *a2Samples++ * y2;
 
-		y2 = y1; 
-		y1 = y0;
+			y2 = y1; 
+			y1 = y0;
+		}
 	}
 	
 	y1 = zap(y1);
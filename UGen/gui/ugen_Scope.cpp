@@ -575,7 +575,6 @@ void ScopeGUI::resizedGUI()
 
 BufferSenderUGenInternal::BufferSenderUGenInternal(UGen const& input, UGen const& duration) throw()
 :	UGenInternal(NumInputs),
-	audioBuffer(Buffer::withSize((int)(UGen::getSampleRate()), input.getNumChannels(), true)),
 	bufferIndex(0),
 	audioBufferSizeUsed(0),
 	samplesProcessed(0)
@@ -584,46 +583,34 @@ BufferSenderUGenInternal::BufferSenderUGenInternal(UGen const& input, UGen const
 	inputs[Duration] = duration;
 	
 	audioBufferSizeUsed = max(1, (int)(duration.getValue() * UGen::getSampleRate() + 0.5));
+	
+	// allocate enough for at least one second so changing the duration doesn't reallocate
+	const int audioBufferAllocatedSize = max(audioBufferSizeUsed, (int)UGen::getSampleRate());
+	audioBuffer = Buffer::withSize(audioBufferAllocatedSize, input.getNumChannels(), true);
+	
+	setMaximumBufferSize(audioBufferAllocatedSize, input.getNumChannels());
+	setDeferred(getDeferredByDefault());
 }
 
-
 void BufferSenderUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
 {
 	float duration = *(inputs[Duration].processBlock(shouldDelete, blockID, 0));	
-	int audioBufferSizeRequired = max(1, (int)(duration * UGen::getSampleRate() + 0.5));
-	int audioBufferAllocatedSize = audioBuffer.size();			  
+	const int audioBufferSizeRequired = max(1, (int)(duration * UGen::getSampleRate() + 0.5));
 	
-	if(audioBufferSizeRequired > audioBufferAllocatedSize)
+	if(audioBufferSizeRequired > audioBuffer.size())
 	{
-		if((audioBufferAllocatedSize > 1) && (bufferIndex >= audioBufferAllocatedSize))
-		{
-			sendBuffer(audioBuffer.getRegion(0, audioBufferAllocatedSize-1), samplesProcessed);
-		}
-		
-		audioBufferAllocatedSize = audioBufferSizeRequired;
-		audioBuffer = Buffer::withSize(audioBufferAllocatedSize, inputs[Input].getNumChannels(), false);
-		audioBufferSizeUsed = audioBufferSizeRequired;
+		// only reallocate if the duration grows beyond anything seen so far
+		// (deferred senders will drop these longer buffers)
+		audioBuffer = Buffer::withSize(audioBufferSizeRequired, audioBuffer.getNumChannels(), false);
 		bufferIndex = 0;
 	}
-	else if(audioBufferSizeRequired < audioBufferAllocatedSize)
+	
+	audioBufferSizeUsed = audioBufferSizeRequired;
+	
+	if(bufferIndex >= audioBufferSizeUsed)
 	{
-		audioBufferSizeUsed = audioBufferSizeRequired;
-		
-		if(bufferIndex >= audioBufferSizeUsed)
-		{
-			if(audioBufferSizeUsed == audioBuffer.size())
-			{
-				sendBuffer(audioBuffer, samplesProcessed);
-			}
-			else
-			{
-				sendBuffer(audioBuffer.getRegion(0, audioBufferSizeUsed-1), samplesProcessed);
-				audioBufferAllocatedSize = audioBufferSizeRequired;
-				audioBuffer = Buffer::withSize(audioBufferAllocatedSize, inputs[Input].getNumChannels(), false);
-			}
-			
-			bufferIndex = 0;
-		}
+		sendBufferRegion(audioBuffer, audioBufferSizeUsed, samplesProcessed);
+		bufferIndex = 0;
 	}
 	
 	int numSamplesRemaining = uGenOutput.getBlockSize();
@@ -636,12 +623,10 @@ void BufferSenderUGenInternal::processBlock(bool& shouldDelete, const unsigned i
 		
 		for(int channel = 0; channel < audioBuffer.getNumChannels(); channel++)
 		{
-			int numSamplesToProcess = numSamplesThisTime;
 			const float* inputSamples = inputs[Input].processBlock(shouldDelete, blockID, channel) + offset;
 			float* bufferSamples = audioBuffer.getData(channel) + bufferIndex;
-					
-			while(numSamplesToProcess--)
-				*bufferSamples++ = *inputSamples++;
+			
+			memcpy(bufferSamples, inputSamples, numSamplesThisTime * sizeof(float));
 		}
 		
 		numSamplesRemaining -= numSamplesThisTime;
@@ -651,17 +636,7 @@ void BufferSenderUGenInternal::processBlock(bool& shouldDelete, const unsigned i
 		
 		if(bufferIndex >= audioBufferSizeUsed)
 		{
-			if(audioBufferSizeUsed == audioBuffer.size())
-			{
-				sendBuffer(audioBuffer, samplesProcessed);
-			}
-			else
-			{
-				sendBuffer(audioBuffer.getRegion(0, audioBufferSizeUsed-1), samplesProcessed);
-				audioBufferAllocatedSize = audioBufferSizeRequired;
-				audioBuffer = Buffer::withSize(audioBufferAllocatedSize, inputs[Input].getNumChannels(), false);
-			}			
-			
+			sendBufferRegion(audioBuffer, audioBufferSizeUsed, samplesProcessed);
 			bufferIndex = 0;
 		}	
 	}	
@@ -849,6 +824,44 @@ FFTSenderUGenInternal::FFTSenderUGenInternal(UGen const& input,
 //	ugen_assert(numBins == numBins_);	// should be in range	
 	
 	inputs[Input] = input;	
+	
+	setMaximumBufferSize(fftSize, input.getNumChannels());
+	setDeferred(getDeferredByDefault());
+}
+
+FFTSenderUGenInternal::~FFTSenderUGenInternal()
+{
+	setDeferred(false);
+}
+
+Buffer FFTSenderUGenInternal::cook(Buffer const& raw) throw()
+{
+	switch(mode_)
+	{
+		case FFTEngine::RealImagRaw:
+			return raw;
+		case FFTEngine::RealImagRawSplit:
+			return fftEngine.rawToRealImagRawSplit(raw);
+		case FFTEngine::RealImagUnpacked:
+			return fftEngine.rawToRealImagUnpacked(raw, firstBin_, numBins_);
+		case FFTEngine::RealImagUnpackedSplit:
+			return fftEngine.rawToRealImagUnpackedSplit(raw, firstBin_, numBins_);
+		case FFTEngine::MagnitudePhase:
+			return fftEngine.rawToMagnitudePhase(raw, firstBin_, numBins_);
+		case FFTEngine::MagnitudePhaseSplit:
+			return fftEngine.rawToMagnitudePhaseSplit(raw, firstBin_, numBins_);
+		case FFTEngine::Magnitude: 
+			return fftEngine.rawToMagnitude(raw, firstBin_, numBins_);
+		case FFTEngine::Phase: 
+			return fftEngine.rawToPhase(raw, firstBin_, numBins_);
+		default:
+			return fftEngine.rawToMagnitude(raw, firstBin_, numBins_);
+	}
+}
+
+Buffer FFTSenderUGenInternal::prepareDeferredBuffer(Buffer const& raw) throw()
+{
+	return cook(raw);
 }
 
 void FFTSenderUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
@@ -890,43 +903,12 @@ void FFTSenderUGenInternal::processBlock(bool& shouldDelete, const unsigned int
 			fftEngine.fft(outputBuffer, inputBuffer, true, channel, channel);
 		}
 		
-		switch(mode_)
-		{
-			case FFTEngine::RealImagRaw:
-				sendBuffer(outputBuffer, 0, fftSize);
-				break;
-			case FFTEngine::RealImagRawSplit:
-				sendBuffer(fftEngine.rawToRealImagRawSplit(outputBuffer),
-						   0, fftSize);
-				break;
-			case FFTEngine::RealImagUnpacked:
-				sendBuffer(fftEngine.rawToRealImagUnpacked(outputBuffer, firstBin_, numBins_),
-						   firstBin_, fftSize);
-				break;
-			case FFTEngine::RealImagUnpackedSplit:
-				sendBuffer(fftEngine.rawToRealImagUnpackedSplit(outputBuffer, firstBin_, numBins_),
-						   firstBin_, fftSize);
-				break;
-			case FFTEngine::MagnitudePhase:
-				sendBuffer(fftEngine.rawToMagnitudePhase(outputBuffer, firstBin_, numBins_),
-						   firstBin_, fftSize);
-				break;
-			case FFTEngine::MagnitudePhaseSplit:
-				sendBuffer(fftEngine.rawToMagnitudePhaseSplit(outputBuffer, firstBin_, numBins_),
-						   firstBin_, fftSize);
-				break;					
-			case FFTEngine::Magnitude: 
-				sendBuffer(fftEngine.rawToMagnitude(outputBuffer, firstBin_, numBins_),
-						   firstBin_, fftSize);
-				break;
-			case FFTEngine::Phase: 
-				sendBuffer(fftEngine.rawToPhase(outputBuffer, firstBin_, numBins_),
-						   firstBin_, fftSize);
-				break;
-			default:
-				sendBuffer(fftEngine.rawToMagnitude(outputBuffer, firstBin_, numBins_),
-						   firstBin_, fftSize);
-		}
+		const int firstBinSent = ((mode_ == FFTEngine::RealImagRaw) || (mode_ == FFTEngine::RealImagRawSplit)) ? 0 : firstBin_;
+		
+		if(isDeferred())
+			sendBuffer(outputBuffer, firstBinSent, fftSize); // cooked by prepareDeferredBuffer()
+		else
+			sendBuffer(cook(outputBuffer), firstBinSent, fftSize);
 		
 		// keep overlapping samples for next FFT
 		if((overlap_ > 1) && (uGenOutput.getBlockSize() < fftSize))
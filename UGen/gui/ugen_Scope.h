@@ -336,11 +336,17 @@ public:
 						  const int overlap,
 						  const int firstBin,
 						  const int numBins) throw();	
+	~FFTSenderUGenInternal();
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
 	
 	enum Inputs { Input, NumInputs };
 	
+protected:
+	Buffer prepareDeferredBuffer(Buffer const& raw) throw();
+	
 private:
+	Buffer cook(Buffer const& raw) throw();
+	
 	FFTEngine::FFTModes mode_;
 	FFTEngine fftEngine;
 	const int fftSize, fftSizeHalved, overlap_, firstBin_, maxNumBins, numBins_;
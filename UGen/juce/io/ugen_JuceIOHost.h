@@ -338,6 +338,11 @@ inline void JuceIOHostInternal::audioDeviceIOCallback (const float** inputChanne
 	
 	int blockID = UGen::getNextBlockID(numSamples);
 	
+	// MIDI received during the last block is passed to the listeners (e.g., Voicer) with sample offsets
+	JuceMIDIInputBroadcaster* const midiBroadcaster = JuceMIDIInputBroadcaster::getInstanceWithoutCreating();
+	if(midiBroadcaster != 0)
+		midiBroadcaster->dispatchPendingMessages(numSamples, UGen::getSampleRate());
+	
 	owner_->preTick(numSamples, blockID);
 	
 	if(numInputs_ > 0)
@@ -371,10 +376,12 @@ inline void JuceIOHostInternal::audioDeviceAboutToStart (AudioIODevice* device)
 	//const ScopedLock sl(lock);	
 	UGen::prepareToPlay(device->getCurrentSampleRate(), device->getCurrentBufferSizeSamples());
 	output_.setSource(owner_->constructGraph(input_), true, 0.005f);
+	JuceMIDIInputBroadcaster::setDeferredDispatch(true);
 }
 
 inline void JuceIOHostInternal::audioDeviceStopped() 
 { 
+	JuceMIDIInputBroadcaster::setDeferredDispatch(false);
 	UGen::shutdown();
 }
 
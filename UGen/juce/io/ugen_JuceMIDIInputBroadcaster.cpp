@@ -62,14 +62,17 @@ JuceMIDIInputListener::~JuceMIDIInputListener() //throw()
 	}
 }
 
+volatile bool JuceMIDIInputBroadcaster::deferredDispatch = false;
+
 JuceMIDIInputBroadcaster::JuceMIDIInputBroadcaster() throw()
 {
 	const int numDevices = MidiInput::getDevices().size();
 	for(int i = 0; i < numDevices; i++)
 	{
 		MidiInput* midiInput = MidiInput::openDevice(i, this);
-		midiInput->start();
+		fifos.add(new LockFreeFifo<TimedMessage>(FifoSize));
 		midiInputs.add(midiInput);
+		midiInput->start();
 	}
 }
 
@@ -81,13 +84,68 @@ JuceMIDIInputBroadcaster::~JuceMIDIInputBroadcaster() throw()
 		midiInput->stop();
 		delete midiInput;
 	}
+	
+	for(int i = 0; i < fifos.size(); i++)
+		delete fifos.getUnchecked(i);
 }
 
 juce_ImplementSingleton (JuceMIDIInputBroadcaster);
 
 void JuceMIDIInputBroadcaster::handleIncomingMidiMessage (MidiInput* source, const MidiMessage& message) throw()
 {
-	sendIncomingMidiMessage(source, message);
+	const int index = midiInputs.indexOf(source);
+	
+	if(deferredDispatch && (index >= 0) && (message.getRawDataSize() <= 3))
+	{
+		TimedMessage timedMessage;
+		timedMessage.size = message.getRawDataSize();
+		timedMessage.timeStamp = message.getTimeStamp();
+		memcpy(timedMessage.data, message.getRawData(), timedMessage.size);
+		fifos.getUnchecked(index)->write(timedMessage);
+	}
+	else
+	{
+		sendIncomingMidiMessage(source, message);
+	}
+}
+
+void JuceMIDIInputBroadcaster::dispatchPendingMessages(const int numSamples, const double sampleRate) throw()
+{
+	// the messages received during the last block are placed at the same relative
+	// positions in this block (MidiInput time stamps are in seconds on this clock)
+	const double blockStartTime = Time::getMillisecondCounterHiRes() * 0.001 - numSamples / sampleRate;
+	TimedMessage timedMessage;
+	
+	for(int i = 0; i < fifos.size(); i++)
+	{
+		LockFreeFifo<TimedMessage>* fifo = fifos.getUnchecked(i);
+		MidiInput* source = midiInputs.getUnchecked(i);
+		
+		while(fifo->read(timedMessage))
+		{
+			const int sampleOffset = jlimit(0, numSamples-1, 
+											(int)((timedMessage.timeStamp - blockStartTime) * sampleRate));
+			const MidiMessage message(timedMessage.data, timedMessage.size, timedMessage.timeStamp);
+			
+			for (int j = midiInputListeners.size(); --j >= 0;)
+			{
+				JuceMIDIInputListener* const ml = (JuceMIDIInputListener*) midiInputListeners[j];
+				
+				if (ml != 0)
+					ml->handleTimedMidiMessage(source, message, sampleOffset);
+			}
+		}
+	}
+}
+
+int JuceMIDIInputBroadcaster::getNumDropped() const throw()
+{
+	int numDropped = 0;
+	
+	for(int i = 0; i < fifos.size(); i++)
+		numDropped += fifos.getUnchecked(i)->getNumDropped();
+	
+	return numDropped;
 }
 
 void JuceMIDIInputBroadcaster::addListener (JuceMIDIInputListener* const newListener) throw()
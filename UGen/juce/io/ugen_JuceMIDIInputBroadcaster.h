@@ -40,6 +40,7 @@
 #define _UGEN_ugen_JuceMIDIInputBroadcaster_H_
 
 #include "../../filters/control/ugen_Lag.h"
+#include "../../core/ugen_LockFreeFifo.h"
 
 #define DeclareJuceMIDIDataSourceCommonFunctions(CLASSNAME,							\
 												 CONSTRUCTOR_ARGS_CALL,				\
@@ -104,6 +105,18 @@ public:
 	virtual ~JuceMIDIInputListener();// throw();
 	virtual void handleIncomingMidiMessage (MidiInput* source, const MidiMessage& message) = 0;
 	
+	/** Called on the audio thread when the broadcaster uses deferred dispatch.
+	 @param source			The MIDI input the message arrived on.
+	 @param message			The message.
+	 @param sampleOffset	The offset of the message in samples from the start of the block about 
+							to be processed. The default calls handleIncomingMidiMessage() ignoring 
+							the offset, which suits listeners which only set values read once per block. */
+	virtual void handleTimedMidiMessage (MidiInput* source, const MidiMessage& message, const int sampleOffset)
+	{
+		(void)sampleOffset;
+		handleIncomingMidiMessage(source, message);
+	}
+	
 private:
 	const bool active;
 	JuceMIDIInputListener& operator=(JuceMIDIInputListener const&);
@@ -120,6 +133,14 @@ private:
  
  Be sure to remove a listener before it is deleted.
  
+ By default listeners are called directly on the MIDI thread(s). With deferred dispatch (see 
+ setDeferredDispatch(), the JuceIOHost turns this on while its audio device is running) each MIDI 
+ input instead pushes its messages with their time stamps into its own lock-free FIFO, the audio 
+ callback then calls dispatchPendingMessages() at the start of each block which passes the messages 
+ received during the previous block to JuceMIDIInputListener::handleTimedMidiMessage() with a sample 
+ offset. This delays MIDI by one block but removes the timing jitter and the need for listeners
+ to lock against the audio thread. System exclusive (and other long) messages are always sent directly.
+ 
  @see JuceMIDIInputListener
  */
 class JuceMIDIInputBroadcaster : public MidiInputCallback
@@ -135,12 +156,35 @@ public:
 	void removeListener (JuceMIDIInputListener* const listener) throw();
 	void sendIncomingMidiMessage(MidiInput* source, const MidiMessage& message) throw();
 	
+	/** Pass the messages received since the last call to the listeners, call this from the audio thread
+	 at the start of each block when using deferred dispatch. */
+	void dispatchPendingMessages(const int numSamples, const double sampleRate) throw();
+	
+	/** Set whether messages are queued for dispatchPendingMessages() or sent to the listeners directly. */
+	static void setDeferredDispatch(const bool shouldDefer) throw()	{ deferredDispatch = shouldDefer;	}
+	static bool isDeferredDispatch() throw()						{ return deferredDispatch;			}
+	
+	/** The number of messages lost because a FIFO was full. */
+	int getNumDropped() const throw();
+	
 	const Array<MidiInput*>& getMidiInputs() throw()	{ return midiInputs;		}
 	MidiInput* getMidiInput(const int index) throw()	{ return midiInputs[index]; }
 	
+	enum Constants { FifoSize = 1024 };
+	
 private:
+	struct TimedMessage
+	{
+		uint8 data[3];
+		int size;
+		double timeStamp;
+	};
+	
 	Array<MidiInput*> midiInputs;
+	Array<LockFreeFifo<TimedMessage>*> fifos;	// one per MIDI input so each has a single writer
 	SortedSet <void*> midiInputListeners;
+	
+	static volatile bool deferredDispatch;
 };
 
 #endif // _UGEN_ugen_JuceMIDIInputBroadcaster_H_
@@ -52,6 +52,8 @@ VoicerUGenInternal::VoicerUGenInternal(const int numChannels,
 :	VoicerBaseUGenInternal(numChannels, numVoices, forcedSteal),
 	JuceMIDIInputListener(direct),
 	midiChannel_(midiChannel),
+	midiInputEvents(FifoSize),
+	midiBufferEvents(FifoSize),
 	controllers(FloatArray::newClear(128)),
 	keyPressure(FloatArray::newClear(128)),
 	pitchWheel(0.f),
@@ -155,182 +157,129 @@ VoicerUGenInternal::VoicerUGenInternal(const int numChannels,
 
 void VoicerUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
 {	
-	if(shouldStopAllEvents() == true) initEvents();
+	// the events are queued at their sample times, the VoicerBase then starts, releases and
+	// steals voices at these times without splitting the rest of the voices into sub blocks
+	// (controllers etc are coalesced and applied at the start of the block they fall in)
+	VoicerScheduledEvent event;
 	
-	if(midiMessages.isEmpty() == true)
+	while(midiInputEvents.read(event))
 	{
-		const ScopedLock sl(lock);
-		SpawnBaseUGenInternal::processBlock(shouldDelete, blockID, -1);
+		event.time += blockID;
+		scheduleEvent(event);
 	}
-	else
+	
+	while(midiBufferEvents.read(event))
 	{
-		const int blockSize = uGenOutput.getBlockSize();
-		MidiBuffer::Iterator iter(midiMessages);
-		MidiMessage message(0xf4, 0.0);
-		
-		int samplePos = 0;
-		int startSample = 0;
-		
-		const int numChannels = getNumChannels();
-		const int midiChannel = midiChannel_;
-		
-		while(iter.getNextEvent(message, samplePos) && (samplePos < blockSize))
-		{
-			const ScopedLock sl(lock);
-				
-			if(samplePos < 0) samplePos = 0;
-			
-			const int numSamples = samplePos - startSample;
-		
-			if(numSamples > 0)
-			{				
-				for(int channel = 0; channel < numChannels; channel++)
-				{
-					bufferData[channel] = proxies[channel]->getSampleData() + startSample;
-				}
-				
-				mixer.prepareForBlock(numSamples, blockID + startSample, -1);
-				mixer.setOutputs(bufferData, numSamples, numChannels);
-				mixer.processBlock(shouldDelete, blockID + startSample, -1);				
-			}
-			
-			startSample = samplePos;
-			
-			if(message.isForChannel(midiChannel))
-			{
-				if(message.isNoteOnOrOff())
-				{
-					const int midiNote = message.getNoteNumber();
-					const int velocity = message.getVelocity();
-										
-					if(velocity > 0)
-					{
-						if(numVoices_ > 0)
-						{
-							const int voicesUsed = countNonstealingVoices();
-							if(voicesUsed >= numVoices_)
-							{
-								UGen stealee = chooseStealee();
-								
-								if(stealee.isNotNull())
-								{
-									stealee.userData = stealingUserData;
-									stealee.steal(forcedSteal_);
-								}
-							}
-						}
-						
-						// stop double notes, AU lab was sending two ons but one off - seems fixed in Au Lab 2.2
-						//stealNote(midiChannel, midiNote, false, true); 
-						
-						UGen newEvent = spawnEvent(*this, currentEventIndex++, midiChannel, midiNote, velocity);
-						newEvent.userData = createUserData(midiChannel, midiNote);
-						events.add(newEvent);
-					}
-					else
-					{
-						UGen releasee = chooseReleasee(midiChannel, midiNote);
-						if(releasee.isNotNull()) releasee.release();
-					}
-				}
-				else if(message.isController())
-				{
-					getController(message.getControllerNumber()) = message.getControllerValue() / 127.f;
-				}
-				else if(message.isPitchWheel())
-				{
-					getPitchWheel() = (jlimit(-8191, 8191, message.getPitchWheelValue() - 8192) / 8191.f);
-				}
-				else if(message.isChannelPressure())
-				{
-					getChannelPressure() = (message.getChannelPressureValue() / 127.f);
-				}
-				else if(message.isAftertouch())
-				{
-					getKeyPressure(message.getNoteNumber()) = (message.getAfterTouchValue() / 127.f);
-				}
-				else if(message.isProgramChange())
-				{
-					getProgram() = (message.getProgramChangeNumber());
-				}
-				else if(message.isAllNotesOff())
-				{
-					initEvents();
-				}
-			}
-		}
-		
-		const ScopedLock sl(lock);
-		
-		const int numSamples = blockSize - startSample;
-		
-		if(numSamples > 0)
-		{			
-			for(int channel = 0; channel < numChannels; channel++)
-			{
-				bufferData[channel] = proxies[channel]->getSampleData() + startSample;
-			}
-			
-			mixer.prepareForBlock(numSamples, blockID + startSample, -1);
-			mixer.setOutputs(bufferData, numSamples, numChannels);
-			mixer.processBlock(shouldDelete, blockID + startSample, -1);
-		}
-				
-		midiMessages.clear();
-		events.removeNulls();
-	}	
+		event.time += blockID;
+		scheduleEvent(event);
+	}
+	
+	VoicerBaseUGenInternal::processBlock(shouldDelete, blockID, -1);
 }
 
-void VoicerUGenInternal::handleIncomingMidiMessage (MidiInput* /*source*/, const MidiMessage& message) throw()
+bool VoicerUGenInternal::createEvent(MidiMessage const& message, const int sampleOffset, VoicerScheduledEvent& event) const throw()
 {
-	if(message.isForChannel(midiChannel_) == false)	return;
+	if(message.isForChannel(midiChannel_) == false) 
+		return false;
+	
+	event.time = sampleOffset < 0 ? 0 : sampleOffset;
+	event.midiChannel = midiChannel_;
+	event.data1 = 0;
+	event.data2 = 0;
 	
 	if(message.isNoteOnOrOff())
 	{
-		const ScopedLock sl(lock);
-		sendMidiNote(message.getChannel(), message.getNoteNumber(), message.getVelocity());
+		event.type = VoicerScheduledEvent::NoteEvent;
+		event.data1 = message.getNoteNumber();
+		event.data2 = message.isNoteOn() ? message.getVelocity() : 0;
+	}
+	else if(message.isAllNotesOff())
+	{
+		event.type = VoicerScheduledEvent::AllNotesOffEvent;
 	}
 	else if(message.isController())
 	{
-		if((message.getControllerNumber() == 123) && (message.getControllerValue() == 0))
-		{
-			const ScopedLock sl(lock);
-			initEvents();
-		}
-			
-		getController(message.getControllerNumber()) = 
-					 (message.getControllerValue() * (1.f / 127.f));
+		event.type = VoicerScheduledEvent::ControllerEvent;
+		event.data1 = message.getControllerNumber();
+		event.data2 = message.getControllerValue();
 	}
 	else if(message.isPitchWheel())
 	{
-		getPitchWheel() = (jlimit(-8191, 8191, message.getPitchWheelValue() - 8192) * (1.f / 8191.f));
+		event.type = VoicerScheduledEvent::PitchWheelEvent;
+		event.data2 = message.getPitchWheelValue();
 	}
 	else if(message.isChannelPressure())
 	{
-		getChannelPressure() = (message.getChannelPressureValue() * (1.f / 127.f));
+		event.type = VoicerScheduledEvent::ChannelPressureEvent;
+		event.data2 = message.getChannelPressureValue();
 	}
 	else if(message.isAftertouch())
 	{
-		getKeyPressure(message.getNoteNumber()) = 
-					  (message.getAfterTouchValue() * (1.f / 127.f));
+		event.type = VoicerScheduledEvent::KeyPressureEvent;
+		event.data1 = message.getNoteNumber();
+		event.data2 = message.getAfterTouchValue();
 	}
 	else if(message.isProgramChange())
 	{
-		getProgram() = (message.getProgramChangeNumber());
+		event.type = VoicerScheduledEvent::ProgramEvent;
+		event.data2 = message.getProgramChangeNumber();
 	}
-	else if(message.isAllNotesOff())
+	else return false;
+	
+	return true;
+}
+
+void VoicerUGenInternal::handleScheduledEvent(VoicerScheduledEvent const& event) throw()
+{
+	switch(event.type)
 	{
-		const ScopedLock sl(lock);
-		initEvents();
+		case VoicerScheduledEvent::ControllerEvent:
+			getController(event.data1) = event.data2 / 127.f;
+			break;
+		case VoicerScheduledEvent::PitchWheelEvent:
+			getPitchWheel() = (jlimit(-8191, 8191, event.data2 - 8192) / 8191.f);
+			break;
+		case VoicerScheduledEvent::ChannelPressureEvent:
+			getChannelPressure() = (event.data2 / 127.f);
+			break;
+		case VoicerScheduledEvent::KeyPressureEvent:
+			getKeyPressure(event.data1) = (event.data2 / 127.f);
+			break;
+		case VoicerScheduledEvent::ProgramEvent:
+			getProgram() = event.data2;
+			break;
+		default:
+			VoicerBaseUGenInternal::handleScheduledEvent(event);
+	}
+}
+
+void VoicerUGenInternal::handleIncomingMidiMessage (MidiInput* source, const MidiMessage& message) throw()
+{
+	handleTimedMidiMessage(source, message, 0);
+}
+
+void VoicerUGenInternal::handleTimedMidiMessage (MidiInput* /*source*/, const MidiMessage& message, const int sampleOffset) throw()
+{
+	VoicerScheduledEvent event;
+	
+	if(createEvent(message, sampleOffset, event))
+	{
+		const ScopedAtomicSpinLock sl(midiInputLock); // one writer at a time
+		midiInputEvents.write(event);
 	}
 }
 
 void VoicerUGenInternal::sendMidiBuffer(MidiBuffer const& midiMessagesToAdd) throw()
 {	
-	if(midiMessagesToAdd.isEmpty() == false)
+	MidiBuffer::Iterator iter(midiMessagesToAdd);
+	MidiMessage message(0xf4, 0.0);
+	int samplePos = 0;
+	VoicerScheduledEvent event;
+	
+	while(iter.getNextEvent(message, samplePos))
 	{
-		const ScopedLock sl(lock);
-		midiMessages.addEvents(midiMessagesToAdd, 0, -1, 0);
+		if(createEvent(message, samplePos, event))
+			midiBufferEvents.write(event);
 	}
 }
 
@@ -43,9 +43,16 @@
 #include "io/ugen_JuceMIDIInputBroadcaster.h"
 #include "../spawn/ugen_VoicerBase.h"
 #include "../core/ugen_Arrays.h"
+#include "../core/ugen_LockFreeFifo.h"
 
 
-/** @ingroup UGenInternals */
+/** @ingroup UGenInternals 
+ 
+ MIDI messages from the JuceMIDIInputBroadcaster and from sendMidiBuffer() are passed to the 
+ audio thread through two lock-free FIFOs (one for each so that each has a single writer thread)
+ and scheduled at their sample offsets in the next block to be processed. Messages from several
+ MIDI inputs may arrive on different threads so these writers are serialised with a spin lock, 
+ the audio thread reads the FIFO without locking. */
 class VoicerUGenInternal :  public VoicerBaseUGenInternal,
 							public JuceMIDIInputListener
 {
@@ -53,8 +60,14 @@ public:
 	VoicerUGenInternal(const int numChannels, const int midiChannel, const int numVoices, const bool forcedSteal, const bool direct) throw();
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();	
 	void handleIncomingMidiMessage (MidiInput* source, const MidiMessage& message) throw();
+	void handleTimedMidiMessage (MidiInput* source, const MidiMessage& message, const int sampleOffset) throw();
+	
+	/** Send the messages in a MidiBuffer, the sample positions are relative to the start of the next block. 
+	 This must be called from one thread only, usually the audio thread just before the Voicer is processed. */
 	void sendMidiBuffer(MidiBuffer const& midiMessages) throw();
 	
+	enum Constants { FifoSize = 1024 };
+	
 	const float& getController(const int index) const throw();
 	const float& getKeyPressure(const int index) const throw();
 	const float& getPitchWheel() const throw();
@@ -66,10 +79,15 @@ public:
 	float& getChannelPressure() throw();	
 	int& getProgram() throw();
 	
+protected:
+	void handleScheduledEvent(VoicerScheduledEvent const& event) throw();
+	bool createEvent(MidiMessage const& message, const int sampleOffset, VoicerScheduledEvent& event) const throw();
+	
 private:
-	CriticalSection lock;
 	const int midiChannel_;
-	MidiBuffer midiMessages;
+	LockFreeFifo<VoicerScheduledEvent> midiInputEvents;
+	AtomicSpinLock midiInputLock;
+	LockFreeFifo<VoicerScheduledEvent> midiBufferEvents;
 	
 	FloatArray controllers;
 	FloatArray keyPressure;
@@ -0,0 +1,208 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#include "../../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_OscBank.h"
+#include "../../basics/ugen_InlineBinaryOps.h"
+
+
+OscBankUGenInternal::OscBankUGenInternal(UGen const& freqs, UGen const& amps, Buffer const& initialPhases, const int numPartialsToUse) throw()
+:	UGenInternal(NumInputs),
+	numPartials(numPartialsToUse),
+	numGroups((numPartialsToUse + LaneSize - 1) / LaneSize),
+	freqsAreConst(freqs.isConst()),
+	ampsAreConst(amps.isConst()),
+	data(BufferSpec(numGroups * LaneSize, NumArrays, true)),
+	nyquist((float)(UGen::getSampleRate() * 0.5))
+{
+	inputs[Freqs] = freqs;
+	inputs[Amps] = amps;
+	
+	float* const realSamples = getArray(Real);
+	float* const imagSamples = getArray(Imag);
+	float* const cosSamples = getArray(Cos);
+	float* const ampSamples = getArray(Amp);
+	float* const ampTargetSamples = getArray(AmpTarget);
+	float initialValue = 0.f;
+	
+	for(int partial = 0; partial < numGroups * LaneSize; partial++)
+	{
+		cosSamples[partial] = 1.f; // padding lanes rotate at 0Hz with zero amplitude
+		
+		if(partial < numPartials)
+		{
+			const double phase = initialPhases.wrapAt(partial) * twoPi;
+			realSamples[partial] = (float)std::cos(phase);
+			imagSamples[partial] = (float)std::sin(phase);
+			
+			setFreq(partial, inputs[Freqs].getValue(partial % inputs[Freqs].getNumChannels()));
+			ampTargetSamples[partial] = inputs[Amps].getValue(partial % inputs[Amps].getNumChannels());
+			
+			// partials at or above Nyquist start silent, as in processGroup(), and stay silent if 
+			// their frequency can't change (otherwise they fade in from 0 when they drop below Nyquist)
+			if(std::abs(getArray(Freq)[partial]) < nyquist)
+			{
+				ampSamples[partial] = ampTargetSamples[partial];
+				initialValue += ampSamples[partial] * imagSamples[partial];
+			}
+			else
+			{
+				ampSamples[partial] = 0.f;
+				
+				if(freqsAreConst)
+					ampTargetSamples[partial] = 0.f;
+			}
+		}
+	}
+	
+	initValue(initialValue);
+}
+
+void OscBankUGenInternal::setFreq(const int partial, const float freq) throw()
+{
+	const double w = freq * twoPi * UGen::getReciprocalSampleRate();
+	getArray(Cos)[partial] = (float)std::cos(w);
+	getArray(Sin)[partial] = (float)std::sin(w);
+	getArray(Freq)[partial] = freq;
+}
+
+void OscBankUGenInternal::updateFreqs(bool& shouldDelete, const unsigned int blockID, const int numSamples) throw()
+{
+	const float* const freqSamples = getArray(Freq);
+	
+	for(int partial = 0; partial < numPartials; partial++)
+	{
+		const float freq = inputs[Freqs].processBlock(shouldDelete, blockID, partial)[numSamples - 1];
+		
+		if(freq != freqSamples[partial])
+			setFreq(partial, freq);
+	}
+}
+
+void OscBankUGenInternal::updateAmps(bool& shouldDelete, const unsigned int blockID, const int numSamples) throw()
+{
+	float* const ampTargetSamples = getArray(AmpTarget);
+	
+	for(int partial = 0; partial < numPartials; partial++)
+		ampTargetSamples[partial] = inputs[Amps].processBlock(shouldDelete, blockID, partial)[numSamples - 1];
+}
+
+void OscBankUGenInternal::processGroup(const int group, float* const outputSamples, const int numSamples) throw()
+{
+	const int offset = group * LaneSize;
+	float* const realSamples = getArray(Real) + offset;
+	float* const imagSamples = getArray(Imag) + offset;
+	float* const ampSamples = getArray(Amp) + offset;
+	const float* const cosSamples = getArray(Cos) + offset;
+	const float* const sinSamples = getArray(Sin) + offset;
+	const float* const ampTargetSamples = getArray(AmpTarget) + offset;
+	const float* const freqSamples = getArray(Freq) + offset;
+	
+	float re[LaneSize], im[LaneSize], c[LaneSize], s[LaneSize], amp[LaneSize], target[LaneSize], step[LaneSize];
+	bool silent = true;
+	
+	for(int lane = 0; lane < LaneSize; lane++)
+	{
+		re[lane] = realSamples[lane];
+		im[lane] = imagSamples[lane];
+		c[lane] = cosSamples[lane];
+		s[lane] = sinSamples[lane];
+		amp[lane] = ampSamples[lane];
+		target[lane] = std::abs(freqSamples[lane]) < nyquist ? ampTargetSamples[lane] : 0.f;
+		step[lane] = (target[lane] - amp[lane]) / numSamples;
+		
+		if(amp[lane] != 0.f || target[lane] != 0.f)
+			silent = false;
+	}
+	
+	// silent groups are skipped entirely, their phase is held until they are heard again
+	if(silent)
+		return;
+	
+	for(int i = 0; i < numSamples; i++)
+	{
+		float y[LaneSize];
+		
+		for(int lane = 0; lane < LaneSize; lane++)
+		{
+			y[lane] = amp[lane] * im[lane];
+			const float nextRe = re[lane] * c[lane] - im[lane] * s[lane];
+			im[lane] = re[lane] * s[lane] + im[lane] * c[lane];
+			re[lane] = nextRe;
+			amp[lane] += step[lane];
+		}
+		
+		outputSamples[i] += (y[0] + y[1]) + (y[2] + y[3]);
+	}
+	
+	for(int lane = 0; lane < LaneSize; lane++)
+	{
+		// one Newton step towards unit magnitude is enough to stop the phasor drifting
+		const float gain = 1.5f - 0.5f * (re[lane] * re[lane] + im[lane] * im[lane]);
+		realSamples[lane] = re[lane] * gain;
+		imagSamples[lane] = im[lane] * gain;
+		ampSamples[lane] = target[lane];
+	}
+}
+
+void OscBankUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
+{
+	const int numSamplesToProcess = uGenOutput.getBlockSize();
+	float* const outputSamples = uGenOutput.getSampleData();
+	
+	if(!freqsAreConst) updateFreqs(shouldDelete, blockID, numSamplesToProcess);
+	if(!ampsAreConst)  updateAmps(shouldDelete, blockID, numSamplesToProcess);
+	
+	memset(outputSamples, 0, numSamplesToProcess * sizeof(float));
+	
+	for(int group = 0; group < numGroups; group++)
+		processGroup(group, outputSamples, numSamplesToProcess);
+}
+
+OscBank::OscBank(UGen const& freqs, UGen const& amps, Buffer const& initialPhases) throw()
+{
+	const int numPartials = ugen::max(freqs.getNumChannels(), amps.getNumChannels());
+	
+	initInternal(1);
+	internalUGens[0] = new OscBankUGenInternal(freqs, amps, initialPhases, numPartials);
+}
+
+END_UGEN_NAMESPACE
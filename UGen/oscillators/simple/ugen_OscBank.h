@@ -0,0 +1,118 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_OscBank_H_
+#define _UGEN_ugen_OscBank_H_
+
+#include "../../core/ugen_UGen.h"
+#include "../../basics/ugen_MulAdd.h"
+#include "../../buffers/ugen_Buffer.h"
+
+/** @ingroup UGenInternals 
+ Renders many sine partials in one node using recursive (rotating phasor) oscillators.
+ The partials are processed in groups of LaneSize with the state of a group held in
+ locals for a whole block, the lanes of a group being independent so that the compiler
+ can vectorise them. Frequencies and amplitudes are read once per block: a frequency 
+ change takes effect at the start of the block and amplitudes are ramped over the block. */
+class OscBankUGenInternal : public UGenInternal
+{
+public:
+	OscBankUGenInternal(UGen const& freqs, UGen const& amps, Buffer const& initialPhases, const int numPartials) throw();
+	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
+	enum Inputs { Freqs, Amps, NumInputs };
+	enum Constants { LaneSize = 4 };
+	
+protected:
+	enum Arrays 
+	{ 
+		Real, Imag,			// the phasor
+		Cos, Sin,			// the rotation for each sample
+		Amp, AmpTarget,
+		Freq,
+		NumArrays 
+	};
+	
+	inline float* getArray(const int array) throw()	{ return data.getData(array); }
+	
+	void updateFreqs(bool& shouldDelete, const unsigned int blockID, const int numSamples) throw();
+	void updateAmps(bool& shouldDelete, const unsigned int blockID, const int numSamples) throw();
+	void setFreq(const int partial, const float freq) throw();
+	void processGroup(const int group, float* const outputSamples, const int numSamples) throw();
+	
+	const int numPartials;
+	const int numGroups;
+	const bool freqsAreConst;
+	const bool ampsAreConst;
+	Buffer data;			// one channel for each of Arrays, padded to a whole number of groups
+	float nyquist;
+};
+
+#define OscBank_Docs	@param freqs			The frequencies of the partials, one for each channel. This may be	\
+												a Buffer (as an array of values) or a multichannel UGen which is	\
+												read once per block.												\
+						@param amps				The amplitudes of the partials, one for each channel. This may be a	\
+												Buffer (as an array of values) or a multichannel UGen which is read	\
+												once per block and ramped over the block. Partials above the		\
+												Nyquist frequency are silenced.										\
+						@param initialPhases	The phase (0-1) at which each partial should start on creation.
+
+/** An additive oscillator bank.
+ 
+ This sums any number of sine partials into a single channel. It is much more efficient than
+ mixing many SinOsc or FSinOsc UGens (e.g., using MixFill) since all the partials are rendered 
+ by a single node without intermediate blocks. The number of partials is the larger of the number 
+ of channels in freqs and amps.
+ 
+ @code
+	Buffer freqs = Buffer::series(1000, 50, 50);		// 50Hz, 100Hz, 150Hz ...
+	Buffer amps = Buffer::series(1000, 1, 1).reciprocal() * 0.2;
+	UGen saw = OscBank::AR(freqs, amps);
+ @endcode
+ 
+ @ingroup AllUGens OscUGens
+ @see FSinOsc, SinOsc, HarmonicOsc */
+DirectMulAddUGenDeclaration(OscBank,	(freqs, amps, initialPhases), 
+										(freqs, amps, initialPhases, MulAdd_ArgsCall), 
+										(UGen const& freqs, UGen const& amps = 1.f, Buffer const& initialPhases = 0.f), 
+										(UGen const& freqs, UGen const& amps = 1.f, Buffer const& initialPhases = 0.f, MulAdd_ArgsDeclare), 
+							COMMON_UGEN_DOCS OscBank_Docs MulAddArgs_Docs);
+
+
+
+#endif // _UGEN_ugen_OscBank_H_
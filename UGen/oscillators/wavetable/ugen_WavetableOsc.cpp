@@ -0,0 +1,389 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#if !defined(WIN32) && !defined(UGEN_IPHONE) && !defined(UGEN_ANDROID)
+	#include <Accelerate/Accelerate.h>
+	#include <CoreServices/CoreServices.h>
+#endif
+
+#include "../../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_WavetableOsc.h"
+#include "../../fft/ugen_FFTEngine.h"
+#include "../../fft/ugen_FFTEngineInternal.h"
+#include "../../basics/ugen_InlineBinaryOps.h"
+#include "../../core/ugen_Bits.h"
+
+
+WavetableSet* WavetableSet::first = 0;
+AtomicSpinLock WavetableSet::lock;
+
+WavetableSet::WavetableSet(Buffer const& tables) throw()
+:	source(tables),
+	next(0),
+	refCount(1),
+	numTables(ugen::max(1, tables.getNumChannels())),
+	levels(BufferSpec(numTables * NumLevels * LevelSize, 1, true))
+{
+	const int sourceSize = source.size();
+	
+	if(sourceSize < 1)
+	{
+		ugen_assertfalse; // no tables, leave the levels silent
+		return;
+	}
+	
+	const int fftSizeHalved = TableSize / 2;
+	const bool transformSource = (sourceSize != TableSize) && Bits::isPowerOf2(sourceSize);
+	
+	FFTEngine fftEngine(TableSize);
+	FFTEngine sourceFFTEngine(transformSource ? sourceSize : 1);
+	Buffer temp(BufferSpec(ugen::max((int)TableSize, sourceSize), 1, false));
+	Buffer spectrumBuffer(BufferSpec(TableSize, 1, true));
+	Buffer levelSpectrumBuffer(BufferSpec(TableSize, 1, false));
+	Buffer sourceSpectrumBuffer(BufferSpec(transformSource ? sourceSize : 1, 1, false));
+	float* const tempSamples = temp.getData();
+	
+	DSPSplitComplex spectrum;
+	spectrum.realp = spectrumBuffer.getData();
+	spectrum.imagp = spectrum.realp + fftSizeHalved;
+	
+	DSPSplitComplex levelSpectrum;
+	levelSpectrum.realp = levelSpectrumBuffer.getData();
+	levelSpectrum.imagp = levelSpectrum.realp + fftSizeHalved;
+	
+	for(int table = 0; table < numTables; table++)
+	{
+		const float* const sourceSamples = source.getData(table);
+		
+		if(transformSource)
+		{
+			// power of 2 sizes are resampled in the frequency domain by truncating or zero-padding the spectrum
+			const int sourceSizeHalved = sourceSize / 2;
+			const int numBins = ugen::min(sourceSizeHalved, (int)fftSizeHalved);
+			const float scale = (float)TableSize / (float)sourceSize;
+			
+			DSPSplitComplex sourceSpectrum;
+			sourceSpectrum.realp = sourceSpectrumBuffer.getData();
+			sourceSpectrum.imagp = sourceSpectrum.realp + sourceSizeHalved;
+			
+			memcpy(tempSamples, sourceSamples, sourceSize * sizeof(float));
+			sourceFFTEngine.getInternal()->fft(sourceSpectrum, tempSamples);
+			
+			memset(spectrum.realp, 0, TableSize * sizeof(float));
+			
+			for(int bin = 0; bin < numBins; bin++)
+			{
+				spectrum.realp[bin] = sourceSpectrum.realp[bin] * scale;
+				spectrum.imagp[bin] = sourceSpectrum.imagp[bin] * scale;
+			}
+			
+			spectrum.imagp[0] = 0.f; // the Nyquist bin of either size can't be mapped to the other
+		}
+		else
+		{
+			if(sourceSize == TableSize)
+			{
+				memcpy(tempSamples, sourceSamples, TableSize * sizeof(float));
+			}
+			else
+			{
+				// other sizes are resampled periodically with linear interpolation
+				const double ratio = (double)sourceSize / (double)TableSize;
+				
+				for(int i = 0; i < TableSize; i++)
+				{
+					const double position = i * ratio;
+					const int index0 = (int)position;
+					const int index1 = index0 + 1 < sourceSize ? index0 + 1 : 0;
+					const float frac = (float)(position - index0);
+					tempSamples[i] = sourceSamples[index0] + frac * (sourceSamples[index1] - sourceSamples[index0]);
+				}
+			}
+			
+			fftEngine.getInternal()->fft(spectrum, tempSamples);
+		}
+		
+		for(int level = 0; level < NumLevels; level++)
+		{
+			const int maximumHarmonic = fftSizeHalved >> level;
+			
+			memcpy(levelSpectrum.realp, spectrum.realp, TableSize * sizeof(float));
+			
+			if(maximumHarmonic < fftSizeHalved)
+			{
+				const int numBinsToClear = fftSizeHalved - maximumHarmonic - 1;
+				memset(levelSpectrum.realp + maximumHarmonic + 1, 0, numBinsToClear * sizeof(float));
+				memset(levelSpectrum.imagp + maximumHarmonic + 1, 0, numBinsToClear * sizeof(float));
+				levelSpectrum.imagp[0] = 0.f; // Nyquist
+			}
+			
+			float* const levelSamples = levels.getData(0) + (table * NumLevels + level) * LevelSize;
+			fftEngine.getInternal()->ifft(levelSamples, levelSpectrum, false, true);
+			levelSamples[TableSize] = levelSamples[0];
+		}
+	}
+}
+
+WavetableSet& WavetableSet::getInstance(Buffer const& tables) throw()
+{
+	// one for each Buffer, kept while any WavetableOsc is using it
+	const ScopedAtomicSpinLock sl(lock);
+	
+	for(WavetableSet* set = first; set != 0; set = set->next)
+	{
+		if(set->source == tables)
+		{
+			set->refCount++;
+			return *set;
+		}
+	}
+	
+	WavetableSet* set = new WavetableSet(tables);
+	set->next = first;
+	first = set;
+	
+	return *set;
+}
+
+void WavetableSet::addReference() throw()
+{
+	const ScopedAtomicSpinLock sl(lock);
+	refCount++;
+}
+
+void WavetableSet::release() throw()
+{
+	{
+		const ScopedAtomicSpinLock sl(lock);
+		
+		ugen_assert(refCount > 0);
+		
+		if(--refCount > 0)
+			return;
+		
+		WavetableSet** link = &first;
+		
+		while(*link != this)
+			link = &(*link)->next;
+		
+		*link = next;
+	}
+	
+	delete this;
+}
+
+WavetableOscUGenInternal::WavetableOscUGenInternal(UGen const& freq, 
+												   UGen const& position, 
+												   const float initialPhase, 
+												   WavetableSet& setToUse) throw()
+:	UGenInternal(NumInputs),
+	set(setToUse),
+	maximumTable(set.getNumTables() - 1),
+	currentPhase((initialPhase < 0.f) || (initialPhase >= 1.f) ? 0.f : initialPhase * WavetableSet::TableSize)
+{
+	ugen_assert(initialPhase >= 0.f && initialPhase <= 1.f);
+	
+	set.addReference();
+	
+	inputs[Freq] = freq;
+	inputs[Position] = position;
+	initValue(set.getLevel(0, 0)[(int)currentPhase]);
+}
+
+WavetableOscUGenInternal::~WavetableOscUGenInternal() throw()
+{
+	set.release();
+}
+
+UGenInternal* WavetableOscUGenInternal::getChannel(const int channel) throw()
+{
+	return new WavetableOscUGenInternal(inputs[Freq].getChannel(channel),
+										inputs[Position].getChannel(channel),
+										currentPhase / WavetableSet::TableSize,
+										set);
+}
+
+void WavetableOscUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw()
+{
+	int numSamplesToProcess = uGenOutput.getBlockSize();
+	float* outputSamples = uGenOutput.getSampleData();
+	const float* freqSamples = inputs[Freq].processBlock(shouldDelete, blockID, channel);
+	const float* positionSamples = inputs[Position].processBlock(shouldDelete, blockID, channel);
+	
+	while(numSamplesToProcess > 0)
+	{
+		const int numSamplesThisTime = ugen::min(numSamplesToProcess, (int)ChunkSize);
+		
+		processChunk(outputSamples, freqSamples, positionSamples, numSamplesThisTime);
+		
+		numSamplesToProcess -= numSamplesThisTime;
+		outputSamples += numSamplesThisTime;
+		freqSamples += numSamplesThisTime;
+		positionSamples += numSamplesThisTime;
+	}
+}
+
+void WavetableOscUGenInternal::processChunk(float* const outputSamples, 
+											const float* const freqSamples, 
+											const float* const positionSamples, 
+											const int numSamples) throw()
+{
+	const float tableSize = (float)WavetableSet::TableSize;
+	const float tableSizeOverSampleRate = UGen::getReciprocalSampleRate() * tableSize;
+	int indices[ChunkSize];
+	float fractions[ChunkSize];
+	float maximumIncrement = 0.f;
+	LOCAL_DECLARE(float, currentPhase);
+	
+	// the phases for the whole chunk first, so the lookups below are independent of each other
+	for(int i = 0; i < numSamples; i++)
+	{
+		const int index = (int)currentPhase;
+		indices[i] = index;
+		fractions[i] = currentPhase - index;
+		
+		const float increment = freqSamples[i] * tableSizeOverSampleRate;
+		maximumIncrement = ugen::max(maximumIncrement, increment < 0.f ? -increment : increment);
+		currentPhase += increment;
+		
+		while(currentPhase >= tableSize)	currentPhase -= tableSize;
+		while(currentPhase < 0.f)			currentPhase += tableSize;
+	}
+	
+	LOCAL_COPY(currentPhase);
+	
+	// level n is free of aliasing up to an increment of 2^n samples per sample,
+	// log2 is approximated linearly between octaves from the exponent and mantissa
+	int level = 0;
+	float levelFrac = 0.f;
+	
+	if(maximumIncrement > 0.5f)
+	{
+		int exponent;
+		const float mantissa = (float)frexp(maximumIncrement, &exponent); // 0.5 <= mantissa < 1
+		level = exponent;
+		levelFrac = mantissa * 2.f - 1.f;
+		
+		if(level >= WavetableSet::NumLevels - 1)
+		{
+			level = WavetableSet::NumLevels - 1;
+			levelFrac = 0.f;
+		}
+	}
+	
+	const int nextLevel = ugen::min(level + 1, WavetableSet::NumLevels - 1);
+	
+	if(maximumTable == 0)
+	{
+		const float* const table0 = set.getLevel(0, level);
+		const float* const table1 = set.getLevel(0, nextLevel);
+		
+		for(int i = 0; i < numSamples; i++)
+		{
+			const int index = indices[i];
+			const float frac = fractions[i];
+			const float value0 = table0[index] + frac * (table0[index + 1] - table0[index]);
+			const float value1 = table1[index] + frac * (table1[index + 1] - table1[index]);
+			outputSamples[i] = value0 + levelFrac * (value1 - value0);
+		}
+	}
+	else
+	{
+		const int levelOffset = nextLevel - level;
+		
+		for(int i = 0; i < numSamples; i++)
+		{
+			const float position = ugen::clip(positionSamples[i], 0.f, 1.f) * maximumTable;
+			const int table = ugen::min((int)position, maximumTable - 1);
+			const float morph = position - table;
+			
+			// levels of the same table are adjacent, the next table is NumLevels levels further on
+			const float* const levelA0 = set.getLevel(table, level);
+			const float* const levelA1 = levelA0 + levelOffset * WavetableSet::LevelSize;
+			const float* const levelB0 = levelA0 + WavetableSet::NumLevels * WavetableSet::LevelSize;
+			const float* const levelB1 = levelB0 + levelOffset * WavetableSet::LevelSize;
+			
+			const int index = indices[i];
+			const float frac = fractions[i];
+			const float valueA0 = levelA0[index] + frac * (levelA0[index + 1] - levelA0[index]);
+			const float valueA1 = levelA1[index] + frac * (levelA1[index + 1] - levelA1[index]);
+			const float valueB0 = levelB0[index] + frac * (levelB0[index + 1] - levelB0[index]);
+			const float valueB1 = levelB1[index] + frac * (levelB1[index + 1] - levelB1[index]);
+			const float valueA = valueA0 + levelFrac * (valueA1 - valueA0);
+			const float valueB = valueB0 + levelFrac * (valueB1 - valueB0);
+			outputSamples[i] = valueA + morph * (valueB - valueA);
+		}
+	}
+}
+
+double WavetableOscUGenInternal::getDuration() const throw()
+{
+	return 1.0;
+}
+
+double WavetableOscUGenInternal::getPosition() const throw()
+{
+	return (double)currentPhase / (double)WavetableSet::TableSize;
+}
+
+bool WavetableOscUGenInternal::setPosition(const double newPosition) throw()
+{
+	currentPhase = (float)ugen::clip(newPosition, 0.0, 1.0 - 1.0 / WavetableSet::TableSize) * WavetableSet::TableSize;
+	return true;
+}
+
+WavetableOsc::WavetableOsc(Buffer const& tables, UGen const& freq, UGen const& position, Buffer const& initialPhase) throw()
+{
+	int numChannels = ugen::max(ugen::max(freq.getNumChannels(), position.getNumChannels()), initialPhase.size());
+	
+	initInternal(numChannels);
+	
+	WavetableSet& set = WavetableSet::getInstance(tables);
+	
+	for(unsigned int i = 0; i < numInternalUGens; i++)
+	{
+		internalUGens[i] = new WavetableOscUGenInternal(freq, position, initialPhase.wrapAt(i), set);
+	}
+	
+	set.release(); // the internals hold their own references
+}
+
+END_UGEN_NAMESPACE
@@ -0,0 +1,159 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_WavetableOsc_H_
+#define _UGEN_ugen_WavetableOsc_H_
+
+#include "../../core/ugen_UGen.h"
+#include "../../basics/ugen_MulAdd.h"
+#include "../../buffers/ugen_Buffer.h"
+#include "../../core/ugen_AtomicSpinLock.h"
+#include "ugen_TableOsc.h"
+
+/** A set of band-limited mip levels built from the single cycle tables in a Buffer.
+ 
+ Each channel of the source Buffer is one table. Each table is resampled to TableSize
+ samples and then filtered using an FFT into NumLevels octave spaced levels: level 0 contains 
+ all TableSize/2 harmonics, level 1 half of them, level 2 a quarter and so on until the last
+ level is a single sine. Every level has an interpolation sample after the last value.
+ 
+ The set is created once for each Buffer (when the first WavetableOsc using it is created)
+ and shared by all the WavetableOsc instances using the same Buffer. Buffers are compared
+ using Buffer::operator==() so a copy of a Buffer shares the set but changes to the Buffer's
+ data after the set is built are not seen. Sets are reference counted and deleted when the
+ last WavetableOsc using them is deleted.
+ @see WavetableOsc */
+class WavetableSet
+{
+public:
+	enum Constants 
+	{ 
+		TableSize = 2048, 
+		LevelSize = TableSize + 1, 
+		NumLevels = 11 
+	};
+	
+	/** Returns the set for a Buffer, creating it if needed.
+	 This adds a reference to the set which must be released with release(). */
+	static WavetableSet& getInstance(Buffer const& tables) throw();
+	
+	/** Adds a reference to the set. */
+	void addReference() throw();
+	
+	/** Removes a reference, the set is deleted when the last reference is released. */
+	void release() throw();
+	
+	inline int getNumTables() const throw()		{ return numTables; }
+	
+	/** Returns the samples for one level of a table, this has LevelSize samples. */
+	inline const float* getLevel(const int table, const int level) const throw()
+	{
+		return levels.getData(0) + (table * NumLevels + level) * LevelSize;
+	}
+	
+private:
+	WavetableSet(Buffer const& tables) throw();
+	
+	Buffer source;
+	WavetableSet* next;
+	int refCount;
+	int numTables;
+	Buffer levels;
+	
+	static WavetableSet* first;
+	static AtomicSpinLock lock;
+};
+
+/** @ingroup UGenInternals */
+class WavetableOscUGenInternal : public UGenInternal
+{
+public:
+	WavetableOscUGenInternal(UGen const& freq, 
+							 UGen const& position, 
+							 const float initialPhase, 
+							 WavetableSet& set) throw();
+	~WavetableOscUGenInternal() throw();
+	UGenInternal* getChannel(const int channel) throw();
+	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
+	double getDuration() const throw();
+	double getPosition() const throw();
+	bool setPosition(const double newPosition) throw();	
+	
+	enum Inputs { Freq, Position, NumInputs };
+	enum Constants { ChunkSize = 16 };
+	
+protected:
+	void processChunk(float* const outputSamples, 
+					  const float* const freqSamples, 
+					  const float* const positionSamples, 
+					  const int numSamples) throw();
+	
+	WavetableSet& set;
+	const int maximumTable;
+	float currentPhase;
+};
+
+#define WavetableOsc_Docs	@param	tables		The wavetables to use. Each channel of this Buffer should contain a single		\
+												cycle of a waveform, ideally 2048 samples long (other sizes are resampled,		\
+												power of 2 sizes without interpolation error). Unlike TableOsc there should		\
+												not be an interpolation sample after the last value. Band-limited versions		\
+												of the tables are built the first time a Buffer is used and shared between		\
+												all WavetableOsc UGens using it.												\
+							@param	position	The position (0-1) used to morph between the tables, 0 plays the first			\
+												channel, 1 the last channel and values in between crossfade between			\
+												adjacent channels.
+
+/**
+ A band-limited wavetable oscillator which can morph between several tables.
+ 
+ The band-limited level is chosen for each block of 16 samples using the highest frequency in
+ the block (so that no harmonics are above the Nyquist frequency) and levels are crossfaded as the 
+ frequency changes. This is more expensive than TableOsc but does not alias at high frequencies.
+ @ingroup AllUGens OscUGens
+ @see TableOsc, HarmonicOsc
+ */
+DirectMulAddUGenDeclaration(WavetableOsc, 
+							(tables, freq, position, initialPhase), 
+							(tables, freq, position, initialPhase, MulAdd_ArgsCall), 
+							(Buffer const& tables, UGen const& freq = 440.f, UGen const& position = 0.f, Buffer const& initialPhase = 0.f), 
+							(Buffer const& tables, UGen const& freq = 440.f, UGen const& position = 0.f, Buffer const& initialPhase = 0.f, MulAdd_ArgsDeclare), 
+							COMMON_UGEN_DOCS WavetableOsc_Docs Osc_Docs MulAddArgs_Docs);
+
+
+#endif // _UGEN_ugen_WavetableOsc_H_
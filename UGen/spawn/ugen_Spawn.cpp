@@ -44,13 +44,17 @@ BEGIN_UGEN_NAMESPACE
 #include "ugen_Spawn.h"
 #include "../basics/ugen_MixUGen.h"
 
+bool SpawnBaseUGenInternal::parallelByDefault = false;
+
 SpawnBaseUGenInternal::SpawnBaseUGenInternal(const int numInputs, const int _numChannels, const int maxRepeats) throw()
 :	ProxyOwnerUGenInternal(numInputs, _numChannels-1),
 	numChannels(_numChannels),
 	currentEventIndex(0),
 	maxRepeats_(maxRepeats),
 	bufferData(new float*[numChannels]),
-	stopEvents(false)
+	stopEvents(false),
+	pool(parallelByDefault ? ThreadPool::retainShared() : 0),
+	renderBlockID(0)
 {
 	ugen_assert(numChannels > 0);
 	ugen_assert(maxRepeats >= 0);
@@ -61,6 +65,9 @@ SpawnBaseUGenInternal::SpawnBaseUGenInternal(const int numInputs, const int _num
 SpawnBaseUGenInternal::~SpawnBaseUGenInternal()// throw()
 {
 	delete [] bufferData;
+	
+	if(pool != 0)
+		ThreadPool::releaseShared();
 }
 
 void SpawnBaseUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
@@ -76,11 +83,62 @@ void SpawnBaseUGenInternal::processBlock(bool& shouldDelete, const unsigned int
 		bufferData[channel] = proxies[channel]->getSampleData();
 	}
 	
-	mixer.prepareForBlock(numSamplesToProcess, blockID, -1);
-	mixer.setOutputs(bufferData, numSamplesToProcess, numChannels);
+	renderEvents(shouldDelete, blockID, numSamplesToProcess);
+}
+
+void SpawnBaseUGenInternal::renderEvents(bool& shouldDelete, const unsigned int blockID, const int numSamples) throw()
+{
+	mixer.prepareForBlock(numSamples, blockID, -1); // removes finished events
+	
+	if(pool != 0 && events.size() > 1)
+	{
+		// render the events on the pool, the mixer then finds their outputs are 
+		// already up to date for this block and only sums them (in order)
+		renderBlockID = blockID;
+		pool->run(*this, events.size());
+	}
+	
+	mixer.setOutputs(bufferData, numSamples, getNumChannels());
 	mixer.processBlock(shouldDelete, blockID, -1);
 }
 
+void SpawnBaseUGenInternal::runJob(const int index) throw()
+{
+	UGen& event = events[index];
+	
+	if(event.isNotNull())
+	{
+		bool shouldDeleteLocal = false;
+		event.processBlock(shouldDeleteLocal, renderBlockID, -1);
+	}
+}
+
+void SpawnBaseUGenInternal::setParallel(const bool shouldRenderInParallel) throw()
+{
+	if(shouldRenderInParallel == isParallel())
+		return;
+	
+	if(shouldRenderInParallel)
+	{
+		pool = ThreadPool::retainShared();
+	}
+	else
+	{
+		pool = 0;
+		ThreadPool::releaseShared();
+	}
+}
+
+void SpawnBaseUGenInternal::setParallelByDefault(const bool shouldRenderInParallel) throw()
+{
+	parallelByDefault = shouldRenderInParallel;
+}
+
+bool SpawnBaseUGenInternal::getParallelByDefault() throw()
+{
+	return parallelByDefault;
+}
+
 void SpawnBaseUGenInternal::releaseInternal() throw()
 {
 	UGenInternal::releaseInternal();
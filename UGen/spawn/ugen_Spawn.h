@@ -40,11 +40,27 @@
 
 #include "../core/ugen_UGen.h"
 #include "../core/ugen_UGenArray.h"
+#include "../core/ugen_ThreadPool.h"
 
 #define _FILEID_ _UGEN_ugen_Spawn_H_
 
-/** @ingroup UGenInternals */
-class SpawnBaseUGenInternal : public ProxyOwnerUGenInternal
+/** @ingroup UGenInternals 
+ The base for the event spawning UGenInternals (Spawn, TSpawn, VoicerBase, XFadeTexture, 
+ OverlapTexture and TrigXFade). Events are mixed to the outputs using a Mix of a UGenArray.
+ 
+ The events may optionally be rendered in parallel on the shared ThreadPool (see setParallel()),
+ this is off by default. Each event is rendered as a job on its own, then the events are mixed in 
+ order on the audio thread so the result is identical to rendering them in turn. This requires that 
+ each event's UGen graph is independent i.e., does not share UGen instances (or other state such as 
+ Buffer instances being written to) with other events or the rest of the graph.
+ 
+ The shared state used by the UGens themselves is safe to use from the pool threads: reference
+ counts are atomic, the FilterCoeffTable and WavetableSet lists are locked (and filled when the
+ UGens are created), HRTF responses are decoded under a lock and each BinauralPan has its own 
+ FFTEngine. Other UGens that keep state in statics or global objects (e.g., UGens reading Juce
+ GUI controls or MIDI inputs) should not be used in parallel events. */
+class SpawnBaseUGenInternal :	public ProxyOwnerUGenInternal,
+								public ThreadPoolJob
 {
 public:
 	SpawnBaseUGenInternal(const int numInputs, const int numChannels, const int maxRepeats) throw();
@@ -52,11 +68,24 @@ public:
 	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
 	void releaseInternal() throw();
 	void stealInternal() throw();
-	void initEvents() throw();
+	virtual void initEvents() throw();
 	bool stopAllEvents() throw();
 	bool shouldStopAllEvents() { return stopEvents; }
 	
 	inline UGenArray& getEvents() { return events; }
+	
+	/** Set whether the events should be rendered in parallel using the shared ThreadPool.
+	 This is only worthwhile for events with reasonably expensive UGen graphs. The spawning UGen 
+	 keeps a reference to the pool (see ThreadPool::retainShared()) while this is on. */
+	void setParallel(const bool shouldRenderInParallel) throw();
+	inline bool isParallel() const throw() { return pool != 0; }
+	
+	/** Set whether new event spawning UGens render their events in parallel, this is false by default. */
+	static void setParallelByDefault(const bool shouldRenderInParallel) throw();
+	static bool getParallelByDefault() throw();
+	
+	/** @internal Renders one event. */
+	void runJob(const int index) throw();
 		
 protected:	
 	const int numChannels;
@@ -66,6 +95,9 @@ protected:
 	const int maxRepeats_;
 	float** const bufferData;
 	
+	/** Render the events into bufferData (which should have been set already). */
+	void renderEvents(bool& shouldDelete, const unsigned int blockID, const int numSamples) throw();
+	
 	inline void accumulateSamples(float *outputSamples, const float *inputSamples, int numSamplesToProcess) throw()
 	{
 		while(numSamplesToProcess--)
@@ -82,6 +114,9 @@ protected:
 	
 private:
 	bool stopEvents;
+	ThreadPool* pool;
+	unsigned int renderBlockID;
+	static bool parallelByDefault;
 };
 
 /** @ingroup UGenInternals */
@@ -255,6 +290,10 @@ protected:
  }
  ...
  @endcode	
+ 
+ Events with expensive UGen graphs may be rendered in parallel by calling spawn.setParallel(true)
+ (or SpawnBaseUGenInternal::setParallelByDefault() for all spawning UGens). The events' graphs 
+ must then be independent of each other, see SpawnBaseUGenInternal.
  @ingroup AllUGens EventUGens
  @see SpawnEventBase<OwnerType>, TSpawn, XFadeTexture, OverlapTexture, TrigXFade
  */
@@ -85,9 +85,7 @@ void TSpawnUGenInternal::processBlock(bool& shouldDelete, const unsigned int blo
 						bufferData[channel] = proxies[channel]->getSampleData() + startSample;
 					}
 					
-					mixer.prepareForBlock(numSamples, blockID + startSample, -1);
-					mixer.setOutputs(bufferData, numSamples, numChannels);
-					mixer.processBlock(shouldDelete, blockID + startSample, -1);
+					renderEvents(shouldDelete, blockID + startSample, numSamples);
 				}
 				
 				startSample += numSamples;
@@ -111,9 +109,7 @@ void TSpawnUGenInternal::processBlock(bool& shouldDelete, const unsigned int blo
 			bufferData[channel] = proxies[channel]->getSampleData() + startSample;
 		}
 		
-		mixer.prepareForBlock(numSamples, blockID + startSample, -1);
-		mixer.setOutputs(bufferData, numSamples, numChannels);
-		mixer.processBlock(shouldDelete, blockID + startSample, -1);		
+		renderEvents(shouldDelete, blockID + startSample, numSamples);
 	}
 }
 
@@ -46,24 +46,440 @@ BEGIN_UGEN_NAMESPACE
 #include "../core/ugen_UGenArray.h"
 
 
+VoicerEventQueue::VoicerEventQueue(const int capacity_) throw()
+:	capacity(capacity_ < 1 ? 1 : capacity_),
+	events(new VoicerScheduledEvent[capacity]),
+	numEvents(0)
+{
+}
+
+VoicerEventQueue::~VoicerEventQueue()
+{
+	delete [] events;
+}
+
+bool VoicerEventQueue::add(VoicerScheduledEvent const& event) throw()
+{
+	if(numEvents >= capacity)
+		return false;
+	
+	// insertion sort from the end, events are usually added in time order anyway
+	// (the time difference is signed so this works if the sample time wraps)
+	int index = numEvents;
+	
+	while((index > 0) && ((int)(events[index-1].time - event.time) > 0))
+	{
+		events[index] = events[index-1];
+		index--;
+	}
+	
+	events[index] = event;
+	numEvents++;
+	
+	return true;
+}
+
+void VoicerEventQueue::removeFirst(const int numToRemove) throw()
+{
+	if(numToRemove <= 0) 
+		return;
+	
+	if(numToRemove >= numEvents)
+	{
+		numEvents = 0;
+		return;
+	}
+	
+	numEvents -= numToRemove;
+	
+	for(int i = 0; i < numEvents; i++)
+		events[i] = events[i + numToRemove];
+}
+
+const int VoicerBaseUGenInternal::stealingUserData = 0x7FFFFFFE; // deprecated, see isVoiceStealing()
+
 VoicerBaseUGenInternal::VoicerBaseUGenInternal(const int numChannels, const int numVoices, const bool forcedSteal) throw()
 :	SpawnBaseUGenInternal(0, numChannels, 0),
 	numVoices_(numVoices),
 	stealMode_(StealOldest),
 	forcedSteal_(forcedSteal),
-	ageCounter(0)
+	scheduledEvents(EventQueueCapacity),
+	nextBlockTime(0),
+	voiceActions(new VoiceAction[EventQueueCapacity * 2]),	// at most a steal and a start per note
+	splitIndices(new int[EventQueueCapacity * 2]),
+	splitVoices(new UGen[EventQueueCapacity * 2]),
+	voiceTable(numVoices > 0 ? numVoices * 2 : 32)	// allow for voices fading out after being stolen
 {
 	ugen_assert(numChannels > 0);
 	ugen_assert(numVoices >= 0);
 }
 
+VoicerBaseUGenInternal::~VoicerBaseUGenInternal()
+{
+	delete [] voiceActions;
+	delete [] splitIndices;
+	delete [] splitVoices;
+}
+
+void VoicerBaseUGenInternal::processBlock(bool& shouldDelete, const unsigned int blockID, const int /*channel*/) throw()
+{
+	const int blockSize = uGenOutput.getBlockSize();
+	const unsigned int endTime = blockID + blockSize;
+	
+	nextBlockTime = endTime;
+	
+	if(shouldStopAllEvents() == true) initEvents();
+	
+	updateVoiceTable();
+	
+	int numDue = 0;
+	
+	while((numDue < scheduledEvents.size()) && ((int)(scheduledEvents[numDue].time - endTime) < 0))
+		numDue++;
+	
+	// value events (controllers etc) only change values the voices read once per block so these 
+	// are handled at the start of the block, in time order, and don't split the voices
+	int numVoiceEvents = 0;
+	
+	for(int i = 0; i < numDue; i++)
+	{
+		VoicerScheduledEvent const& event = scheduledEvents[i];
+		
+		if(event.isValueEvent())
+			handleScheduledEvent(event);
+		else
+			numVoiceEvents++;
+	}
+	
+	if(numVoiceEvents == 0)
+	{
+		scheduledEvents.removeFirst(numDue);
+		SpawnBaseUGenInternal::processBlock(shouldDelete, blockID, -1);
+		return;
+	}
+	
+	// the other events are handled in time order, the block is split into segments at the non-note 
+	// events (which may affect every voice) while notes only split the voices they act on
+	int index = 0;
+	int startOffset = 0;
+	
+	while(startOffset < blockSize)
+	{
+		if(startOffset > 0) 
+			updateVoiceTable(); // voices may have finished during the previous segment
+		
+		// events at the start of the segment (or late ones at the start of the block) are dispatched now...
+		while((index < numDue) && ((int)(scheduledEvents[index].time - blockID) <= startOffset))
+		{
+			VoicerScheduledEvent const& event = scheduledEvents[index++];
+			
+			if(event.isValueEvent())
+			{
+				continue; // handled at the start of the block
+			}
+			else if(event.type != VoicerScheduledEvent::NoteEvent)
+			{
+				handleScheduledEvent(event);
+			}
+			else
+			{
+				const int numEventsBefore = events.size();
+				
+				sendMidiNote(event.midiChannel, event.data1, event.data2);
+				
+				// new voices are prepared for the full block first (as in renderVoiceSegment)
+				for(int i = numEventsBefore; (startOffset > 0) && (i < events.size()); i++)
+					events[i].prepareForBlock(blockSize, blockID, -1);
+			}
+		}
+		
+		// a forced steal leaves a null voice which the mixer would remove before rendering, 
+		// this must be done here so the voice indices of the actions below stay valid
+		updateVoiceTable();
+		
+		// ...the segment ends at the next non-note event, notes before it become actions on voices
+		int endOffset = blockSize;
+		int numActions = 0;
+		
+		while(index < numDue)
+		{
+			VoicerScheduledEvent const& event = scheduledEvents[index];
+			const int offset = (int)(event.time - blockID);
+			
+			if(event.isValueEvent())
+			{
+				index++;
+				continue;
+			}
+			else if(event.type != VoicerScheduledEvent::NoteEvent)
+			{
+				endOffset = offset;
+				break;
+			}
+			
+			numActions = dispatchScheduledNote(event, offset, numActions);
+			index++;
+		}
+		
+		renderSegment(shouldDelete, blockID, blockSize, startOffset, endOffset, numActions);
+		startOffset = endOffset;
+	}
+	
+	scheduledEvents.removeFirst(numDue);
+}
+
+void VoicerBaseUGenInternal::renderSegment(bool& shouldDelete, 
+										   const unsigned int blockID, 
+										   const int blockSize, 
+										   const int startOffset, 
+										   const int endOffset,
+										   const int numActions) throw()
+{
+	// the voices with actions are taken out of the mix (in index order)
+	int numSplit = 0;
+	
+	for(int i = 0; i < numActions; i++)
+	{
+		const int voiceIndex = voiceActions[i].voiceIndex;
+		int insertIndex = numSplit;
+		
+		while((insertIndex > 0) && (splitIndices[insertIndex-1] > voiceIndex))
+			insertIndex--;
+		
+		if((insertIndex > 0) && (splitIndices[insertIndex-1] == voiceIndex))
+			continue;
+		
+		for(int j = numSplit; j > insertIndex; j--)
+			splitIndices[j] = splitIndices[j-1];
+		
+		splitIndices[insertIndex] = voiceIndex;
+		numSplit++;
+	}
+	
+	for(int i = numSplit-1; i >= 0; i--)
+		splitVoices[i] = events.remove(splitIndices[i], false);
+	
+	// mix the other voices for the whole segment
+	const int numChannels = getNumChannels();
+	
+	for(int channel = 0; channel < numChannels; channel++)
+		bufferData[channel] = proxies[channel]->getSampleData() + startOffset;
+	
+	renderEvents(shouldDelete, blockID + startOffset, endOffset - startOffset);
+	
+	// then render each of the voices with actions in parts, between its actions
+	for(int i = 0; i < numSplit; i++)
+	{
+		UGen& voice = splitVoices[i];
+		const int voiceIndex = splitIndices[i];
+		int segmentStart = startOffset;
+		bool isNewVoice = false;
+		
+		for(int j = 0; j < numActions; j++)
+		{
+			VoiceAction const& action = voiceActions[j];
+			
+			if(action.voiceIndex != voiceIndex) continue;
+			
+			if(action.type == VoiceStart)
+			{
+				segmentStart = action.offset;
+				isNewVoice = true;
+			}
+			else
+			{
+				if(action.offset > segmentStart)
+				{
+					renderVoiceSegment(voice, blockID, blockSize, segmentStart, action.offset, isNewVoice);
+					segmentStart = action.offset;
+					isNewVoice = false;
+				}
+				
+				if(action.type == VoiceRelease)
+					voice.release();
+				else
+					voice.steal(forcedSteal_);
+			}
+		}
+		
+		renderVoiceSegment(voice, blockID, blockSize, segmentStart, endOffset, isNewVoice);
+	}
+	
+	// and put back in the same order (the array still has the space so this doesn't allocate)
+	for(int i = 0; i < numSplit; i++)
+	{
+		const int voiceIndex = splitIndices[i];
+		
+		ugen_assert(voiceIndex <= events.size());
+		
+		events.add(UGen::getNull());
+		
+		for(int j = events.size()-1; j > voiceIndex; j--)
+			events[j] = events[j-1];
+		
+		events[voiceIndex] = splitVoices[i];
+		splitVoices[i] = UGen::getNull();
+	}
+}
+
+int VoicerBaseUGenInternal::dispatchScheduledNote(VoicerScheduledEvent const& event, 
+												  const int offset, 
+												  int numActions) throw()
+{
+	const int midiChannel = event.midiChannel;
+	const int midiNote = event.data1;
+	const int velocity = event.data2;
+	
+	ugen_assert(velocity >= 0);
+	
+	if(velocity > 0)
+	{
+		if(numVoices_ > 0)
+		{
+			const int voicesUsed = countNonstealingVoices();
+			if(voicesUsed >= numVoices_)
+			{
+				const int slot = chooseStealeeSlot();
+				
+				if(slot >= 0)
+				{
+					voiceTable.setStealing(slot);
+					
+					VoiceAction& action = voiceActions[numActions++];
+					action.voiceIndex = voiceTable.getEventIndex(slot);
+					action.offset = offset;
+					action.type = VoiceSteal;
+				}
+			}
+		}
+		
+		UGen newEvent = spawnEvent(*this, currentEventIndex++, midiChannel, midiNote, velocity);
+		
+		if(newEvent.isNotNull())
+		{
+			const int slot = addVoice(newEvent, midiChannel, midiNote, velocity);
+			
+			VoiceAction& action = voiceActions[numActions++];
+			action.voiceIndex = voiceTable.getEventIndex(slot);
+			action.offset = offset;
+			action.type = VoiceStart;
+		}
+	}
+	else
+	{
+		const int slot = voiceTable.findReleasee(midiChannel, midiNote);
+		
+		if(slot >= 0)
+		{
+			voiceTable.setReleased(slot);
+			
+			VoiceAction& action = voiceActions[numActions++];
+			action.voiceIndex = voiceTable.getEventIndex(slot);
+			action.offset = offset;
+			action.type = VoiceRelease;
+		}
+	}
+	
+	return numActions;
+}
+
+void VoicerBaseUGenInternal::renderVoiceSegment(UGen& voice, 
+												const unsigned int blockID, 
+												const int blockSize, 
+												const int startOffset, 
+												const int endOffset,
+												const bool isNewVoice) throw()
+{
+	const int numSamplesToProcess = endOffset - startOffset;
+	
+	if((numSamplesToProcess <= 0) || voice.isNull()) 
+		return;
+	
+	const unsigned int segmentID = blockID + startOffset;
+	
+	if(isNewVoice)
+		voice.prepareForBlock(blockSize, blockID, -1); // prepare for full size (allocates the output buffers)
+	
+	voice.prepareForBlock(numSamplesToProcess, segmentID, -1); // prepare for sub block
+	
+	if(voice.isNull()) // finished
+		return;
+	
+	const int numChannels = getNumChannels();
+	
+	for(int channel = 0; channel < numChannels; channel++)
+	{
+		bool shouldDeleteLocal = false;
+		const float *voiceSamples = voice.processBlock(shouldDeleteLocal, segmentID, channel);
+		accumulateSamples(proxies[channel]->getSampleData() + startOffset, voiceSamples, numSamplesToProcess);
+	}
+}
+
+bool VoicerBaseUGenInternal::scheduleMidiNote(const int sampleOffset,
+											  const int midiChannel, 
+											  const int midiNote,
+											  const int velocity) throw()
+{
+	ugen_assert(sampleOffset >= 0);
+	
+	VoicerScheduledEvent event;
+	event.time = nextBlockTime + sampleOffset;
+	event.type = VoicerScheduledEvent::NoteEvent;
+	event.midiChannel = midiChannel;
+	event.data1 = midiNote;
+	event.data2 = velocity;
+	
+	return scheduleEvent(event);
+}
+
+bool VoicerBaseUGenInternal::scheduleEvent(VoicerScheduledEvent const& event) throw()
+{
+	ugen_assert(event.type >= 0 && event.type < VoicerScheduledEvent::NumTypes);
+	
+	if(event.isValueEvent())
+	{
+		// only the last value in a block is used so update a value event already in the same block
+		const int blockSize = uGenOutput.getBlockSize() > 0 ? uGenOutput.getBlockSize() : 1;
+		const int offset = (int)(event.time - nextBlockTime);
+		const int block = offset <= 0 ? 0 : offset / blockSize;
+		const bool hasIndex = (event.type == VoicerScheduledEvent::ControllerEvent) || 
+							  (event.type == VoicerScheduledEvent::KeyPressureEvent);
+		
+		for(int i = scheduledEvents.size()-1; i >= 0; i--)
+		{
+			VoicerScheduledEvent& queued = scheduledEvents[i];
+			const int queuedOffset = (int)(queued.time - nextBlockTime);
+			const int queuedBlock = queuedOffset <= 0 ? 0 : queuedOffset / blockSize;
+			
+			if(queuedBlock < block)
+				break;
+			
+			if((queuedBlock == block) && 
+			   (queued.type == event.type) && 
+			   (queued.midiChannel == event.midiChannel) &&
+			   ((hasIndex == false) || (queued.data1 == event.data1)))
+			{
+				if((int)(event.time - queued.time) >= 0) 
+					queued.data2 = event.data2;
+				
+				return true;
+			}
+		}
+	}
+	
+	return scheduledEvents.add(event);
+}
+
+void VoicerBaseUGenInternal::handleScheduledEvent(VoicerScheduledEvent const& event) throw()
+{
+	if(event.type == VoicerScheduledEvent::AllNotesOffEvent)
+		initEvents();
+}
+
 bool VoicerBaseUGenInternal::sendMidiNote(const int midiChannel, 
 										  const int midiNote,
 										  const int velocity) throw()
 {
-	const int userData = createUserData(midiChannel, midiNote);
-	
-	ugen_assert(userData != UGen::defaultUserData);
 	ugen_assert(velocity >= 0);
 
 	if(velocity > 0)
@@ -73,11 +489,13 @@ bool VoicerBaseUGenInternal::sendMidiNote(const int midiChannel,
 			const int voicesUsed = countNonstealingVoices();
 			if(voicesUsed >= numVoices_)
 			{
-				UGen stealee = chooseStealee();
+				const int slot = chooseStealeeSlot();
 					
-				if(stealee.isNotNull())
+				if(slot >= 0)
 				{
-					stealee.userData = stealingUserData;
+					// steal the voice in the array (not a copy) so that a forced steal takes effect
+					UGen& stealee = events[voiceTable.getEventIndex(slot)];
+					voiceTable.setStealing(slot);
 					stealee.steal(forcedSteal_);
 				}
 			}
@@ -89,19 +507,16 @@ bool VoicerBaseUGenInternal::sendMidiNote(const int midiChannel,
 		UGen newEvent = spawnEvent(*this, currentEventIndex++, midiChannel, midiNote, velocity);
         
         if(newEvent.isNotNull())
-        {
-            newEvent.userData = userData;
-            events.add(newEvent);
-        }        
+			addVoice(newEvent, midiChannel, midiNote, velocity);
 	}
 	else
 	{
-		UGen releasee = chooseReleasee(midiChannel, midiNote);
+		const int slot = voiceTable.findReleasee(midiChannel, midiNote);
 		
-		if(releasee.isNotNull())
+		if(slot >= 0)
 		{
-			//releasee.userData = UGen::defaultUserData; // need to rethink why I really wanted to do this
-			releasee.release();
+			voiceTable.setReleased(slot);
+			events[voiceTable.getEventIndex(slot)].release();
 		}
 	}
 	
@@ -113,84 +528,126 @@ bool VoicerBaseUGenInternal::stealNote(const int midiChannel,
 									   const bool forcedSteal,
 									   const bool stealAll) throw()
 {
-	const int userData = createUserData(midiChannel, midiNote);
 	bool didSteal = false;
+	int slot;
 	
-	for(int i = 0; i < events.size(); i++)
+	while((slot = voiceTable.findVoice(midiChannel, midiNote)) >= 0)
 	{
-		UGen& event = events[i];
-		if(event.userData == userData)
-		{
-			event.userData = stealingUserData;
-			event.steal(forcedSteal);
-			if(stealAll)
-				didSteal = true;
-			else
-				return true;
-		}
+		UGen& event = events[voiceTable.getEventIndex(slot)];
+		voiceTable.setStealing(slot);
+		event.steal(forcedSteal);
+		didSteal = true;
+		
+		if(stealAll == false)
+			break;
 	}
 	
 	return didSteal;
 }
 
+void VoicerBaseUGenInternal::setStealMode(const int mode) throw()
+{
+	ugen_assert(mode >= 0 && mode < NumStealModes);
+	stealMode_ = mode;
+}
+
+int VoicerBaseUGenInternal::getStealPriority(const int /*midiChannel*/, 
+											 const int /*midiNote*/, 
+											 const int /*velocity*/) throw()
+{
+	return 0;
+}
+
+void VoicerBaseUGenInternal::initEvents() throw()
+{
+	SpawnBaseUGenInternal::initEvents();
+	voiceTable.clear();
+}
+
 int VoicerBaseUGenInternal::countNonstealingVoices() const throw()
 {
-	const int numEvents = events.size();
-	int nonStealingVoices = 0;
-	
-	for(int i = 0; i < numEvents; i++)
+	return voiceTable.getNumActive();
+}
+
+int VoicerBaseUGenInternal::chooseStealeeSlot() const throw()
+{
+	switch(stealMode_)
 	{
-		if(events[i].userData != stealingUserData)
-			nonStealingVoices++;
+		case StealNewest:	return voiceTable.findNewest();
+		case StealHighest:	return voiceTable.findHighest();
+		case StealLowest:	return voiceTable.findLowest();
+		default:			return voiceTable.findOldest();
 	}
-	
-	return nonStealingVoices;
 }
 
 const UGen& VoicerBaseUGenInternal::chooseStealee() throw()
 {
-	// could use different methods in here to select the voice to steal
+	const int slot = chooseStealeeSlot();
+	return (slot < 0) ? UGen::getNull() : events[voiceTable.getEventIndex(slot)];
+}
+
+const UGen& VoicerBaseUGenInternal::chooseReleasee(const int midiChannel, const int midiNote) throw()
+{
+	const int slot = voiceTable.findReleasee(midiChannel, midiNote);
+	return (slot < 0) ? UGen::getNull() : events[voiceTable.getEventIndex(slot)];
+}
+
+int VoicerBaseUGenInternal::addVoice(UGen& voice, const int midiChannel, const int midiNote, const int velocity) throw()
+{
+	const int priority = getStealPriority(midiChannel, midiNote, velocity);
+	const int slot = voiceTable.add(midiChannel, midiNote, 
+									priority < 0 ? 0 : ugen::min((int)VoicerVoiceTable::NumPriorities-1, priority));
+	
+	voice.userData = slot;
+	voiceTable.setEventIndex(slot, events.size());
+	events.add(voice);
 	
+	return slot;
+}
+
+void VoicerBaseUGenInternal::updateVoiceTable() throw()
+{
+	// free the slots of the voices which finished last block and update the 
+	// indices of the others, this also removes the finished voices from the array
 	const int numEvents = events.size();
+	int eventIndex = 0;
 	
 	for(int i = 0; i < numEvents; i++)
 	{
-		UGen& stealee = events[i];
-		if(stealee.userData != stealingUserData && stealee.isNotNull())
-			return stealee;
+		UGen const& voice = events[i];
+		
+		ugen_assert(voiceTable.isInUse(voice.userData));
+		
+		if(voice.isNull())
+			voiceTable.remove(voice.userData);
+		else
+			voiceTable.setEventIndex(voice.userData, eventIndex++);
 	}
 	
-	return UGen::getNull();
+	if(eventIndex < numEvents)
+		events.removeNulls();
 }
 
-const UGen& VoicerBaseUGenInternal::chooseReleasee(const int midiChannel, const int midiNote) throw()
+int VoicerBaseUGenInternal::getVoiceMidiChannel(UGen const& voice) const throw()
 {
-	ugen_assert(midiChannel == char(midiChannel));
-	ugen_assert(midiNote == char(midiNote));
+	return voiceTable.isInUse(voice.userData) ? voiceTable.getMidiChannel(voice.userData) : -1;
+}
 
-	const int numEvents = events.size();
-	
-	for(int i = numEvents-1; i >= 0; i--) // release in reverse ?
-	{
-		UGen& releasee = events[i];
-		VoicerUserDataStruct data = getUserData(releasee.userData);
-		if((data.midiChannel == midiChannel)
-		   && (data.midiNote == midiNote) 
-		   // && (releasee.isReleasing() == false // something like this would be useful but tricky to implement
-		   )
-		{
-			return releasee;
-		}
-	}
-	
-	return UGen::getNull();
+int VoicerBaseUGenInternal::getVoiceMidiNote(UGen const& voice) const throw()
+{
+	return voiceTable.isInUse(voice.userData) ? voiceTable.getMidiNote(voice.userData) : -1;
+}
+
+bool VoicerBaseUGenInternal::isVoiceStealing(UGen const& voice) const throw()
+{
+	return voiceTable.isInUse(voice.userData) && !voiceTable.isActive(voice.userData);
 }
 
 int VoicerBaseUGenInternal::createUserData(const int midiChannel, const int midiNote) throw()
 {
 	ugen_assert(midiChannel == char(midiChannel));
 	ugen_assert(midiNote == char(midiNote));
-
+	
 	VoicerUserDataUnion data;
 	
 	data.i = 0;
@@ -200,24 +657,31 @@ int VoicerBaseUGenInternal::createUserData(const int midiChannel, const int midi
 	return data.i;
 }
 
-void VoicerBaseUGenInternal::parseUserData(const int userData, int& midiChannel, int& midiNote) throw()
+void VoicerBaseUGenInternal::parseUserData(const int userData, int& midiChannel, int& midiNote) const throw()
 {
-	VoicerUserDataUnion data;
-	
-	data.i = userData;
-	midiChannel = data.s.midiChannel;
-	midiNote = data.s.midiNote;
+	const VoicerUserDataStruct data = getUserData(userData);
+	midiChannel = data.midiChannel;
+	midiNote = data.midiNote;
 }
 
-VoicerUserDataStruct VoicerBaseUGenInternal::getUserData(const int userData) throw()
+VoicerUserDataStruct VoicerBaseUGenInternal::getUserData(const int userData) const throw()
 {
 	VoicerUserDataUnion data;
 	
-	data.i = userData;
+	if(voiceTable.isInUse(userData))
+	{
+		// the userData of a voice is its slot in the voice table
+		data.i = 0;
+		data.s.midiChannel = voiceTable.getMidiChannel(userData);
+		data.s.midiNote = voiceTable.getMidiNote(userData);
+	}
+	else
+	{
+		data.i = userData;
+	}
+	
 	return data.s;
 }
 
-const int VoicerBaseUGenInternal::stealingUserData = 0x7FFFFFFE; // used to label a voice that is being stolen
-
 
 END_UGEN_NAMESPACE
@@ -40,7 +40,11 @@
 
 #include "../core/ugen_UGen.h"
 #include "ugen_Spawn.h"
+#include "ugen_VoicerVoiceTable.h"
 
+/** @deprecated The MIDI channel and note packed into an int by VoicerBaseUGenInternal::createUserData(). 
+ Voices now store their slot in the VoicerVoiceTable in UGen::userData, use 
+ VoicerBaseUGenInternal::getUserData() or getVoiceMidiChannel() and getVoiceMidiNote() to look these up. */
 typedef struct VoicerUserDataStruct
 {
 	char midiChannel;
@@ -49,17 +53,97 @@ typedef struct VoicerUserDataStruct
 	char unused2;
 } VoicerUserDataStruct;
 
+/** @deprecated See VoicerUserDataStruct. */
 typedef union VoicerUserDataUnion
 {
 	VoicerUserDataStruct s;
 	int i;
 } VoicerUserDataUnion;
 
-/** @ingroup UGenInternals */
+/** A MIDI-style event scheduled for a particular sample time on a VoicerBaseUGenInternal.
+ The time is in the same units as the blockID passed to processBlock() (i.e., samples). */
+struct VoicerScheduledEvent
+{
+	enum Type
+	{
+		NoteEvent,				///< data1 is the note number, data2 the velocity (0 for note off)
+		ControllerEvent,		///< data1 is the controller number, data2 the value
+		PitchWheelEvent,		///< data2 is the pitch wheel value (0-16383)
+		ChannelPressureEvent,	///< data2 is the pressure value
+		KeyPressureEvent,		///< data1 is the note number, data2 the pressure value
+		ProgramEvent,			///< data2 is the program number
+		AllNotesOffEvent,
+		NumTypes
+	};
+	
+	unsigned int time;
+	int type;
+	int midiChannel;
+	int data1;
+	int data2;
+	
+	/** Return whether this only changes a value the voices read (controllers, pitch wheel, pressure
+	 and program) rather than starting or stopping voices. */
+	inline bool isValueEvent() const throw() { return (type != NoteEvent) && (type != AllNotesOffEvent); }
+};
+
+/** A queue of VoicerScheduledEvent items kept sorted by time.
+ 
+ The storage is allocated at construction time so adding and removing events never 
+ allocates memory. Events with the same time are kept in the order they were added. */
+class VoicerEventQueue
+{
+public:
+	VoicerEventQueue(const int capacity) throw();
+	~VoicerEventQueue();
+	
+	/** Insert an event in time order, returns false if the queue is full. */
+	bool add(VoicerScheduledEvent const& event) throw();
+	
+	/** Remove the first @c numToRemove (i.e., earliest) events. */
+	void removeFirst(const int numToRemove) throw();
+	
+	inline void clear() throw()													{ numEvents = 0;		}
+	inline int size() const throw()												{ return numEvents;		}
+	inline int getCapacity() const throw()										{ return capacity;		}
+	inline const VoicerScheduledEvent& operator[](const int index) const throw()	{ return events[index];	}
+	inline VoicerScheduledEvent& operator[](const int index) throw()				{ return events[index];	}
+	
+private:
+	const int capacity;
+	VoicerScheduledEvent* const events;
+	int numEvents;
+	
+	VoicerEventQueue (const VoicerEventQueue&);
+    const VoicerEventQueue& operator= (const VoicerEventQueue&);
+};
+
+/** @ingroup UGenInternals 
+ 
+ MIDI notes can be sent immediately with sendMidiNote() or scheduled for a sample time with
+ scheduleMidiNote() or scheduleEvent(). Scheduled notes are sample accurate without splitting 
+ the whole voice mixer into sub-blocks: the voices unaffected by the notes in a block are 
+ mixed for the full block then only a newly started voice is rendered from its sample offset
+ and only a voice released or stolen during the block is rendered in two (or more) parts. 
+ An AllNotesOffEvent is passed to handleScheduledEvent() at its sample offset, in time order 
+ with the notes, so the block is split into segments there (all the voices are rendered in parts). 
+ Controller, pitch wheel, pressure and program events only change values which the voices read 
+ once per block, so these are passed to handleScheduledEvent() in time order at the start of the 
+ block they fall in and never split the voices. Several of these for the same value in one block 
+ are coalesced when they are scheduled, so a dense stream of controller messages doesn't fill the 
+ event queue. 
+ 
+ The voices are indexed by a VoicerVoiceTable (the UGen::userData of each voice holds its slot 
+ in the table) so choosing a voice to steal or release doesn't scan all of the voices. */
 class VoicerBaseUGenInternal : public SpawnBaseUGenInternal
 {
 public:
 	VoicerBaseUGenInternal(const int numChannels, const int numVoices, const bool forcedSteal) throw();
+	~VoicerBaseUGenInternal();
+	
+	void processBlock(bool& shouldDelete, const unsigned int blockID, const int channel) throw();
+	
+	enum Constants { EventQueueCapacity = 256 };
 
 	/** Send a MIDI note message to the voicer.
 	 This should spawn a new voice if it is a note on (velocity is not zero), or release a voice if
@@ -73,6 +157,29 @@ public:
 					  const int midiNote,
 					  const int velocity) throw();
 
+	/** Schedule a MIDI note message.
+	 This must be called from the audio thread (or with the same lock held as processBlock()).
+	 @param sampleOffset	The offset in samples from the start of the next block to be processed,
+							this may be greater than the block size.
+	 @param midiChannel
+	 @param midiNote
+	 @param velocity		The note velocity, 0 for a note off.
+	 @return @c false if the event queue was full and the note was dropped. */
+	bool scheduleMidiNote(const int sampleOffset,
+						  const int midiChannel, 
+						  const int midiNote,
+						  const int velocity) throw();
+	
+	/** Schedule an event at an absolute sample time (see getNextBlockTime()).
+	 Events at a time before the start of the next block are dispatched at the start of that block.
+	 A value event (see VoicerScheduledEvent::isValueEvent()) replaces one already scheduled for 
+	 the same value in the same block.
+	 @return @c false if the event queue was full and the event was dropped. */
+	bool scheduleEvent(VoicerScheduledEvent const& event) throw();
+	
+	/** The sample time of the start of the next block to be processed. */
+	inline unsigned int getNextBlockTime() const throw() { return nextBlockTime; }
+	
 	virtual UGen spawnEvent(VoicerBaseUGenInternal& spawn, 
 							const int eventCount, 
 							const int midiChannel, 
@@ -105,21 +212,93 @@ public:
 		NumStealModes
 	};
 	
+	/** Set how a voice is chosen to be stolen when the number of voices is exceeded.
+	 Only voices in the lowest steal priority used are considered (see getStealPriority()).
+	 @param mode	One of the StealMode values, StealOldest is the default. */
+	void setStealMode(const int mode) throw();
+	inline int getStealMode() const throw() { return stealMode_; }
+	
+	/** Return the steal priority for a new voice.
+	 Voices with a lower priority are stolen before voices with a higher priority, the priority
+	 should be in the range 0 to VoicerVoiceTable::NumPriorities-1. This returns 0 for all voices,
+	 override it to protect some notes e.g., bass notes or loud notes, from being stolen. */
+	virtual int getStealPriority(const int midiChannel, const int midiNote, const int velocity) throw();
+	
+	void initEvents() throw();
+	
+	/** Return the MIDI channel of a voice in the events array, or -1 if it isn't one of this voicer's voices. 
+	 This replaces decoding the voice's UGen::userData which now holds its slot in the VoicerVoiceTable. */
+	int getVoiceMidiChannel(UGen const& voice) const throw();
+	
+	/** Return the MIDI note of a voice in the events array, or -1 if it isn't one of this voicer's voices. */
+	int getVoiceMidiNote(UGen const& voice) const throw();
+	
+	/** Return whether a voice in the events array is being stolen. 
+	 This replaces comparing the voice's UGen::userData with stealingUserData. */
+	bool isVoiceStealing(UGen const& voice) const throw();
+	
+	/** @deprecated Pack a MIDI channel and note into an int, voices are no longer labelled with 
+	 this so compare getVoiceMidiChannel() and getVoiceMidiNote() with the channel and note instead. */
 	static int createUserData(const int midiChannel, const int midiNote) throw();
-	static void parseUserData(const int userData, int& midiChannel, int& midiNote) throw();
-	static VoicerUserDataStruct getUserData(const int userData) throw();	
+	
+	/** @deprecated Get the MIDI channel and note from the UGen::userData of a voice, this is now
+	 looked up in the voice table (values made by createUserData() are still unpacked). 
+	 Use getVoiceMidiChannel() and getVoiceMidiNote() instead. */
+	void parseUserData(const int userData, int& midiChannel, int& midiNote) const throw();
+	
+	/** @deprecated As parseUserData() but returns the channel and note in a VoicerUserDataStruct. */
+	VoicerUserDataStruct getUserData(const int userData) const throw();
 	
 protected:	
 	int numVoices_;
 	int stealMode_;
 	const bool forcedSteal_;
-	int ageCounter;
 	
+	/** @deprecated Voices are no longer labelled with this UGen::userData value when they are 
+	 stolen, use isVoiceStealing() instead. */
 	static const int stealingUserData;
 	
 	int countNonstealingVoices() const throw();
+	int chooseStealeeSlot() const throw();
 	const UGen& chooseStealee() throw();
 	const UGen& chooseReleasee(const int midiChannel, const int midiNote) throw();
+	
+	/** Handle a scheduled event other than a note, the default handles AllNotesOffEvent only. 
+	 Value events are handled at the start of the block they are scheduled in. */
+	virtual void handleScheduledEvent(VoicerScheduledEvent const& event) throw();
+	
+private:
+	enum VoiceActionType { VoiceStart, VoiceRelease, VoiceSteal };
+	
+	struct VoiceAction
+	{
+		int voiceIndex;
+		int offset;
+		int type;
+	};
+	
+	VoicerEventQueue scheduledEvents;
+	unsigned int nextBlockTime;
+	VoiceAction* const voiceActions;
+	int* const splitIndices;
+	UGen* const splitVoices;
+	VoicerVoiceTable voiceTable;
+	
+	int addVoice(UGen& voice, const int midiChannel, const int midiNote, const int velocity) throw();
+	void updateVoiceTable() throw();
+	int dispatchScheduledNote(VoicerScheduledEvent const& event, const int offset, int numActions) throw();
+	void renderSegment(bool& shouldDelete, 
+					   const unsigned int blockID, 
+					   const int blockSize, 
+					   const int startOffset, 
+					   const int endOffset,
+					   const int numActions) throw();
+	void renderVoiceSegment(UGen& voice, 
+							const unsigned int blockID, 
+							const int blockSize, 
+							const int startOffset, 
+							const int endOffset,
+							const bool isNewVoice) throw();
 };
 
 
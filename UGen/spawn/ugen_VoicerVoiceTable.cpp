@@ -0,0 +1,328 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#include "../core/ugen_StandardHeader.h"
+
+BEGIN_UGEN_NAMESPACE
+
+#include "ugen_VoicerVoiceTable.h"
+#include "../core/ugen_Bits.h"
+
+VoicerVoiceTable::VoicerVoiceTable(const int initialCapacity) throw()
+:	slots(0),
+	capacity(0),
+	freeHead(-1)
+{
+	clear();
+	grow(initialCapacity < 4 ? 4 : initialCapacity);
+}
+
+VoicerVoiceTable::~VoicerVoiceTable()
+{
+	delete [] slots;
+}
+
+void VoicerVoiceTable::grow(const int newCapacity) throw()
+{
+	ugen_assert(newCapacity > capacity);
+	
+	Slot* newSlots = new Slot[newCapacity];
+	
+	for(int i = 0; i < capacity; i++)
+		newSlots[i] = slots[i];
+	
+	// the new slots go on the front of the free list
+	for(int i = newCapacity-1; i >= capacity; i--)
+	{
+		newSlots[i].state = Free;
+		newSlots[i].nextAge = freeHead;
+		freeHead = i;
+	}
+	
+	delete [] slots;
+	slots = newSlots;
+	capacity = newCapacity;
+}
+
+void VoicerVoiceTable::clear() throw()
+{
+	freeHead = -1;
+	
+	for(int i = capacity-1; i >= 0; i--)
+	{
+		slots[i].state = Free;
+		slots[i].nextAge = freeHead;
+		freeHead = i;
+	}
+	
+	numActive = 0;
+	
+	for(int priority = 0; priority < NumPriorities; priority++)
+	{
+		numInPriority[priority] = 0;
+		ageHead[priority] = -1;
+		ageTail[priority] = -1;
+		
+		for(int note = 0; note < NumNotes; note++)
+			noteCount[priority][note] = 0;
+		
+		for(int word = 0; word < NumNoteWords; word++)
+			noteBits[priority][word] = 0;
+	}
+	
+	for(int note = 0; note < NumNotes; note++)
+		noteHead[note] = -1;
+}
+
+int VoicerVoiceTable::add(const int midiChannel, const int midiNote, const int priority) throw()
+{
+	ugen_assert(midiNote >= 0 && midiNote < NumNotes);
+	ugen_assert(priority >= 0 && priority < NumPriorities);
+	
+	if(freeHead < 0) 
+		grow(capacity * 2);
+	
+	const int slot = freeHead;
+	Slot& s = slots[slot];
+	freeHead = s.nextAge;
+	
+	s.midiChannel = midiChannel;
+	s.midiNote = midiNote & (NumNotes-1);
+	s.priority = priority;
+	s.state = Held;
+	s.eventIndex = -1;
+	
+	link(slot);
+	
+	return slot;
+}
+
+void VoicerVoiceTable::remove(const int slot) throw()
+{
+	ugen_assert(isInUse(slot));
+	
+	if(isActive(slot)) 
+		unlink(slot);
+	
+	slots[slot].state = Free;
+	slots[slot].nextAge = freeHead;
+	freeHead = slot;
+}
+
+void VoicerVoiceTable::setStealing(const int slot) throw()
+{
+	ugen_assert(isInUse(slot));
+	
+	if(isActive(slot))
+	{
+		unlink(slot);
+		slots[slot].state = Stealing;
+	}
+}
+
+void VoicerVoiceTable::setReleased(const int slot) throw()
+{
+	ugen_assert(isInUse(slot));
+	
+	if(isActive(slot))
+		slots[slot].state = Released;
+}
+
+void VoicerVoiceTable::link(const int slot) throw()
+{
+	Slot& s = slots[slot];
+	const int priority = s.priority;
+	const int note = s.midiNote;
+	
+	// newest at the tail of the age list...
+	s.nextAge = -1;
+	s.prevAge = ageTail[priority];
+	
+	if(ageTail[priority] >= 0)
+		slots[ageTail[priority]].nextAge = slot;
+	else
+		ageHead[priority] = slot;
+	
+	ageTail[priority] = slot;
+	
+	// ...and at the head of the note list
+	s.prevNote = -1;
+	s.nextNote = noteHead[note];
+	
+	if(noteHead[note] >= 0)
+		slots[noteHead[note]].prevNote = slot;
+	
+	noteHead[note] = slot;
+	
+	if(noteCount[priority][note]++ == 0)
+		noteBits[priority][note >> 5] |= 1u << (note & 31);
+	
+	numInPriority[priority]++;
+	numActive++;
+}
+
+void VoicerVoiceTable::unlink(const int slot) throw()
+{
+	Slot& s = slots[slot];
+	const int priority = s.priority;
+	const int note = s.midiNote;
+	
+	if(s.prevAge >= 0)	slots[s.prevAge].nextAge = s.nextAge;
+	else				ageHead[priority] = s.nextAge;
+	
+	if(s.nextAge >= 0)	slots[s.nextAge].prevAge = s.prevAge;
+	else				ageTail[priority] = s.prevAge;
+	
+	if(s.prevNote >= 0)	slots[s.prevNote].nextNote = s.nextNote;
+	else				noteHead[note] = s.nextNote;
+	
+	if(s.nextNote >= 0)	slots[s.nextNote].prevNote = s.prevNote;
+	
+	if(--noteCount[priority][note] == 0)
+		noteBits[priority][note >> 5] &= ~(1u << (note & 31));
+	
+	numInPriority[priority]--;
+	numActive--;
+}
+
+int VoicerVoiceTable::findReleasee(const int midiChannel, const int midiNote) const throw()
+{
+	int released = -1;
+	
+	for(int slot = noteHead[midiNote & (NumNotes-1)]; slot >= 0; slot = slots[slot].nextNote)
+	{
+		Slot const& s = slots[slot];
+		
+		if(s.midiChannel == midiChannel && s.midiNote == midiNote)
+		{
+			if(s.state == Held) 
+				return slot;
+			else if(released < 0)
+				released = slot;
+		}
+	}
+	
+	return released;
+}
+
+int VoicerVoiceTable::findVoice(const int midiChannel, const int midiNote) const throw()
+{
+	for(int slot = noteHead[midiNote & (NumNotes-1)]; slot >= 0; slot = slots[slot].nextNote)
+	{
+		Slot const& s = slots[slot];
+		
+		if(s.midiChannel == midiChannel && s.midiNote == midiNote)
+			return slot;
+	}
+	
+	return -1;
+}
+
+int VoicerVoiceTable::findLowestPriority() const throw()
+{
+	for(int priority = 0; priority < NumPriorities; priority++)
+	{
+		if(numInPriority[priority] > 0)
+			return priority;
+	}
+	
+	return -1;
+}
+
+int VoicerVoiceTable::findOldestWithNote(const int priority, const int midiNote) const throw()
+{
+	int oldest = -1;
+	
+	for(int slot = noteHead[midiNote]; slot >= 0; slot = slots[slot].nextNote)
+	{
+		if(slots[slot].priority == priority)
+			oldest = slot;
+	}
+	
+	return oldest;
+}
+
+int VoicerVoiceTable::findOldest() const throw()
+{
+	const int priority = findLowestPriority();
+	return (priority < 0) ? -1 : ageHead[priority];
+}
+
+int VoicerVoiceTable::findNewest() const throw()
+{
+	const int priority = findLowestPriority();
+	return (priority < 0) ? -1 : ageTail[priority];
+}
+
+int VoicerVoiceTable::findHighest() const throw()
+{
+	const int priority = findLowestPriority();
+	
+	if(priority < 0) 
+		return -1;
+	
+	for(int word = NumNoteWords-1; word >= 0; word--)
+	{
+		const unsigned int bits = noteBits[priority][word];
+		
+		if(bits != 0)
+			return findOldestWithNote(priority, (word << 5) + (int)Bits::numBitsRequired((long)bits) - 1);
+	}
+	
+	return -1;
+}
+
+int VoicerVoiceTable::findLowest() const throw()
+{
+	const int priority = findLowestPriority();
+	
+	if(priority < 0) 
+		return -1;
+	
+	for(int word = 0; word < NumNoteWords; word++)
+	{
+		const unsigned int bits = noteBits[priority][word];
+		
+		if(bits != 0)
+			return findOldestWithNote(priority, (word << 5) + (int)Bits::countTrailingZeros((long)bits));
+	}
+	
+	return -1;
+}
+
+END_UGEN_NAMESPACE
@@ -0,0 +1,137 @@
+// $Id$
+// $HeadURL$
+
+/*
+ ==============================================================================
+ 
+ This file is part of the UGEN++ library
+ Copyright 2008-11 The University of the West of England.
+ by Martin Robinson
+ 
+ ------------------------------------------------------------------------------
+ 
+ UGEN++ can be redistributed and/or modified under the terms of the
+ GNU General Public License, as published by the Free Software Foundation;
+ either version 2 of the License, or (at your option) any later version.
+ 
+ UGEN++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with UGEN++; if not, visit www.gnu.org/licenses or write to the
+ Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ Boston, MA 02111-1307 USA
+ 
+ The idea for this project and code in the UGen implementations is
+ derived from SuperCollider which is also released under the 
+ GNU General Public License:
+ 
+ SuperCollider real time audio synthesis system
+ Copyright (c) 2002 James McCartney. All rights reserved.
+ http://www.audiosynth.com
+ 
+ ==============================================================================
+ */
+
+
+#ifndef _UGEN_ugen_VoicerVoiceTable_H_
+#define _UGEN_ugen_VoicerVoiceTable_H_
+
+/** An index of the voices of a VoicerBaseUGenInternal.
+ 
+ Each voice has a slot in the table, the VoicerBaseUGenInternal stores the slot number in the 
+ voice's UGen::userData. The voices which are not being stolen are linked into lists in age 
+ order and by note number (with a bitmap of the sounding note numbers) for each steal priority
+ so that finding a voice to steal or release doesn't need to scan all the voices. Slots are 
+ only allocated when the number of voices exceeds the previous maximum. */
+class VoicerVoiceTable
+{
+public:
+	enum Constants
+	{
+		NumNotes = 128,
+		NumPriorities = 4,
+		NumNoteWords = NumNotes / 32
+	};
+	
+	VoicerVoiceTable(const int initialCapacity) throw();
+	~VoicerVoiceTable();
+	
+	/** Add a new voice, returns its slot. */
+	int add(const int midiChannel, const int midiNote, const int priority) throw();
+	
+	/** Free the slot of a voice which has finished. */
+	void remove(const int slot) throw();
+	
+	/** Remove all the voices. */
+	void clear() throw();
+	
+	/** Mark a voice as being stolen, it is then no longer counted or chosen by the find functions. */
+	void setStealing(const int slot) throw();
+	
+	/** Mark a voice as released, findReleasee() then prefers other voices with the same note. */
+	void setReleased(const int slot) throw();
+	
+	/** Find the newest voice with this note which has not been released (or the newest released one), 
+	 returns -1 if there is no voice with this note. */
+	int findReleasee(const int midiChannel, const int midiNote) const throw();
+	
+	/** Find the newest voice with this note, returns -1 if there is no voice with this note. */
+	int findVoice(const int midiChannel, const int midiNote) const throw();
+	
+	/** Find a voice to steal from the lowest priority which has voices, returns -1 if there are no voices. */
+	int findOldest() const throw();
+	int findNewest() const throw();
+	int findHighest() const throw();
+	int findLowest() const throw();
+	
+	/** The number of voices not being stolen. */
+	inline int getNumActive() const throw()									{ return numActive;							}
+	
+	inline int getMidiChannel(const int slot) const throw()					{ return slots[slot].midiChannel;			}
+	inline int getMidiNote(const int slot) const throw()					{ return slots[slot].midiNote;				}
+	inline bool isActive(const int slot) const throw()						{ return slots[slot].state >= Held;			}
+	inline bool isInUse(const int slot) const throw()						{ return (slot >= 0) && (slot < capacity) && (slots[slot].state != Free); }
+	
+	/** The index of the voice in the events UGenArray, this is kept up to date by the VoicerBaseUGenInternal. */
+	inline int getEventIndex(const int slot) const throw()					{ return slots[slot].eventIndex;			}
+	inline void setEventIndex(const int slot, const int eventIndex) throw()	{ slots[slot].eventIndex = eventIndex;		}
+	
+private:
+	enum SlotState { Free, Stealing, Held, Released };
+	
+	struct Slot
+	{
+		int midiChannel;
+		int midiNote;
+		int priority;
+		int state;
+		int eventIndex;
+		int prevAge, nextAge;	// nextAge is also used for the free list
+		int prevNote, nextNote;
+	};
+	
+	Slot* slots;
+	int capacity;
+	int freeHead;
+	int numActive;
+	int numInPriority[NumPriorities];
+	int ageHead[NumPriorities];
+	int ageTail[NumPriorities];
+	int noteHead[NumNotes];
+	int noteCount[NumPriorities][NumNotes];
+	unsigned int noteBits[NumPriorities][NumNoteWords];
+	
+	void grow(const int newCapacity) throw();
+	void link(const int slot) throw();
+	void unlink(const int slot) throw();
+	int findLowestPriority() const throw();
+	int findOldestWithNote(const int priority, const int midiNote) const throw();
+	
+	VoicerVoiceTable (const VoicerVoiceTable&);
+    const VoicerVoiceTable& operator= (const VoicerVoiceTable&);
+};
+
+#endif // _UGEN_ugen_VoicerVoiceTable_H_